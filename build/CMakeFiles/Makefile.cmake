@@ -0,0 +1,111 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Dependencies.cmake"
+  "/root/repo/cmake/macros.cmake"
+  "/root/repo/cyber/examples/CMakeLists.txt"
+  "/root/repo/cyber/proto/CMakeLists.txt"
+  "/root/repo/cyber/tools/CMakeLists.txt"
+  "/usr/local/lib/fastcdr/cmake/fastcdrConfig.cmake"
+  "/usr/local/lib/fastcdr/cmake/fastcdrConfigVersion.cmake"
+  "/usr/local/lib/fastcdr/cmake/fastcdrTargets-release.cmake"
+  "/usr/local/lib/fastcdr/cmake/fastcdrTargets.cmake"
+  "/usr/local/lib/fastrtps/cmake/fastrtpsConfig.cmake"
+  "/usr/local/lib/fastrtps/cmake/fastrtpsConfigVersion.cmake"
+  "/usr/local/lib/fastrtps/cmake/fastrtpsTargets-release.cmake"
+  "/usr/local/lib/fastrtps/cmake/fastrtpsTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindProtobuf.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cyber/proto/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cyber/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cyber/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/cyber.dir/DependInfo.cmake"
+  "CMakeFiles/mainboard.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/talker.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/listener.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/paramserver.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/service.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/record.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/tcp_echo_server.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/tcp_echo_client.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/udp_echo_server.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/udp_echo_client.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/task_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/log_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/tcp_echo_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/service_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/parameter_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/topology_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/atomic_hash_map_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/signal_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/object_pool_benchmark.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/common_component_example.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/timer_component_example.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/timer_sender_01.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/timer_sender_02.dir/DependInfo.cmake"
+  "cyber/examples/CMakeFiles/timer_sender_03.dir/DependInfo.cmake"
+  "cyber/tools/CMakeFiles/cyber_monitor.dir/DependInfo.cmake"
+  "cyber/tools/CMakeFiles/cyber_recorder.dir/DependInfo.cmake"
+  "cyber/tools/CMakeFiles/cyber_log_decode.dir/DependInfo.cmake"
+  "cyber/tools/CMakeFiles/cyber_perf_trace.dir/DependInfo.cmake"
+  )
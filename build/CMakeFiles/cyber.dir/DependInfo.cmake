@@ -0,0 +1,158 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/cyber/croutine/detail/swap_x86_64.S" "/root/repo/build/CMakeFiles/cyber.dir/cyber/croutine/detail/swap_x86_64.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "cyber_EXPORTS"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "."
+  "/root/repo"
+  "/usr/local/include"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cyber/binary.cc" "CMakeFiles/cyber.dir/cyber/binary.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/binary.cc.o.d"
+  "/root/repo/cyber/blocker/blocker_manager.cc" "CMakeFiles/cyber.dir/cyber/blocker/blocker_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/blocker/blocker_manager.cc.o.d"
+  "/root/repo/cyber/class_loader/class_loader.cc" "CMakeFiles/cyber.dir/cyber/class_loader/class_loader.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/class_loader.cc.o.d"
+  "/root/repo/cyber/class_loader/class_loader_manager.cc" "CMakeFiles/cyber.dir/cyber/class_loader/class_loader_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/class_loader_manager.cc.o.d"
+  "/root/repo/cyber/class_loader/shared_library/sample.cc" "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/sample.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/sample.cc.o.d"
+  "/root/repo/cyber/class_loader/shared_library/shared_library.cc" "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/shared_library.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/shared_library.cc.o.d"
+  "/root/repo/cyber/class_loader/utility/class_factory.cc" "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_factory.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_factory.cc.o.d"
+  "/root/repo/cyber/class_loader/utility/class_loader_utility.cc" "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_loader_utility.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_loader_utility.cc.o.d"
+  "/root/repo/cyber/common/file.cc" "CMakeFiles/cyber.dir/cyber/common/file.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/common/file.cc.o.d"
+  "/root/repo/cyber/common/global_data.cc" "CMakeFiles/cyber.dir/cyber/common/global_data.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/common/global_data.cc.o.d"
+  "/root/repo/cyber/component/timer_component.cc" "CMakeFiles/cyber.dir/cyber/component/timer_component.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/component/timer_component.cc.o.d"
+  "/root/repo/cyber/croutine/croutine.cc" "CMakeFiles/cyber.dir/cyber/croutine/croutine.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/croutine/croutine.cc.o.d"
+  "/root/repo/cyber/croutine/detail/routine_context.cc" "CMakeFiles/cyber.dir/cyber/croutine/detail/routine_context.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/croutine/detail/routine_context.cc.o.d"
+  "/root/repo/cyber/cyber.cc" "CMakeFiles/cyber.dir/cyber/cyber.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/cyber.cc.o.d"
+  "/root/repo/cyber/event/latency_tracer.cc" "CMakeFiles/cyber.dir/cyber/event/latency_tracer.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/event/latency_tracer.cc.o.d"
+  "/root/repo/cyber/event/perf_event_cache.cc" "CMakeFiles/cyber.dir/cyber/event/perf_event_cache.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/event/perf_event_cache.cc.o.d"
+  "/root/repo/cyber/event/perf_event_file.cc" "CMakeFiles/cyber.dir/cyber/event/perf_event_file.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/event/perf_event_file.cc.o.d"
+  "/root/repo/cyber/init.cc" "CMakeFiles/cyber.dir/cyber/init.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/init.cc.o.d"
+  "/root/repo/cyber/io/poll_handler.cc" "CMakeFiles/cyber.dir/cyber/io/poll_handler.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/io/poll_handler.cc.o.d"
+  "/root/repo/cyber/io/poller.cc" "CMakeFiles/cyber.dir/cyber/io/poller.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/io/poller.cc.o.d"
+  "/root/repo/cyber/io/session.cc" "CMakeFiles/cyber.dir/cyber/io/session.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/io/session.cc.o.d"
+  "/root/repo/cyber/io/uring.cc" "CMakeFiles/cyber.dir/cyber/io/uring.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/io/uring.cc.o.d"
+  "/root/repo/cyber/logger/async_logger.cc" "CMakeFiles/cyber.dir/cyber/logger/async_logger.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/async_logger.cc.o.d"
+  "/root/repo/cyber/logger/binary_log.cc" "CMakeFiles/cyber.dir/cyber/logger/binary_log.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/binary_log.cc.o.d"
+  "/root/repo/cyber/logger/log_file_object.cc" "CMakeFiles/cyber.dir/cyber/logger/log_file_object.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/log_file_object.cc.o.d"
+  "/root/repo/cyber/logger/log_module.cc" "CMakeFiles/cyber.dir/cyber/logger/log_module.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/log_module.cc.o.d"
+  "/root/repo/cyber/logger/logger.cc" "CMakeFiles/cyber.dir/cyber/logger/logger.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/logger.cc.o.d"
+  "/root/repo/cyber/logger/logger_util.cc" "CMakeFiles/cyber.dir/cyber/logger/logger_util.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/logger/logger_util.cc.o.d"
+  "/root/repo/cyber/message/protobuf_factory.cc" "CMakeFiles/cyber.dir/cyber/message/protobuf_factory.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/message/protobuf_factory.cc.o.d"
+  "/root/repo/cyber/node/node.cc" "CMakeFiles/cyber.dir/cyber/node/node.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/node/node.cc.o.d"
+  "/root/repo/cyber/parameter/parameter.cc" "CMakeFiles/cyber.dir/cyber/parameter/parameter.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/parameter/parameter.cc.o.d"
+  "/root/repo/cyber/parameter/parameter_client.cc" "CMakeFiles/cyber.dir/cyber/parameter/parameter_client.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/parameter/parameter_client.cc.o.d"
+  "/root/repo/cyber/parameter/parameter_server.cc" "CMakeFiles/cyber.dir/cyber/parameter/parameter_server.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/parameter/parameter_server.cc.o.d"
+  "/root/repo/build/cyber/proto/choreography_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/choreography_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/choreography_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/classic_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/classic_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/classic_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/clock.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/clock.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/clock.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/component_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/component_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/component_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/cyber_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/cyber_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/cyber_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/dag_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/dag_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/dag_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/discovery_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/discovery_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/discovery_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/io_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/io_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/io_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/log_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/log_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/log_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/parameter.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/parameter.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/parameter.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/perception.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/perception.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/perception.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/perf_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/perf_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/perf_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/proto_desc.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/proto_desc.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/proto_desc.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/qos_profile.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/qos_profile.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/qos_profile.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/record.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/record.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/record.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/role_attributes.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/role_attributes.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/role_attributes.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/run_mode_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/run_mode_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/run_mode_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/scheduler_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/scheduler_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/scheduler_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/sysmo_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/sysmo_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/sysmo_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/task_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/task_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/task_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/timer_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/timer_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/timer_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/topology_change.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/topology_change.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/topology_change.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/transport_conf.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/transport_conf.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/transport_conf.pb.cc.o.d"
+  "/root/repo/build/cyber/proto/unit_test.pb.cc" "CMakeFiles/cyber.dir/cyber/proto/unit_test.pb.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/proto/unit_test.pb.cc.o.d"
+  "/root/repo/cyber/record/file/record_file_base.cc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_base.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_base.cc.o.d"
+  "/root/repo/cyber/record/file/record_file_reader.cc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_reader.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_reader.cc.o.d"
+  "/root/repo/cyber/record/file/record_file_writer.cc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_writer.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/file/record_file_writer.cc.o.d"
+  "/root/repo/cyber/record/header_builder.cc" "CMakeFiles/cyber.dir/cyber/record/header_builder.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/header_builder.cc.o.d"
+  "/root/repo/cyber/record/message_stager.cc" "CMakeFiles/cyber.dir/cyber/record/message_stager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/message_stager.cc.o.d"
+  "/root/repo/cyber/record/record_reader.cc" "CMakeFiles/cyber.dir/cyber/record/record_reader.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/record_reader.cc.o.d"
+  "/root/repo/cyber/record/record_viewer.cc" "CMakeFiles/cyber.dir/cyber/record/record_viewer.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/record_viewer.cc.o.d"
+  "/root/repo/cyber/record/record_writer.cc" "CMakeFiles/cyber.dir/cyber/record/record_writer.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/record/record_writer.cc.o.d"
+  "/root/repo/cyber/scheduler/common/pin_thread.cc" "CMakeFiles/cyber.dir/cyber/scheduler/common/pin_thread.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/common/pin_thread.cc.o.d"
+  "/root/repo/cyber/scheduler/policy/choreography_context.cc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/choreography_context.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/choreography_context.cc.o.d"
+  "/root/repo/cyber/scheduler/policy/classic_context.cc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/classic_context.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/classic_context.cc.o.d"
+  "/root/repo/cyber/scheduler/policy/scheduler_choreography.cc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_choreography.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_choreography.cc.o.d"
+  "/root/repo/cyber/scheduler/policy/scheduler_classic.cc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_classic.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_classic.cc.o.d"
+  "/root/repo/cyber/scheduler/processor.cc" "CMakeFiles/cyber.dir/cyber/scheduler/processor.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/processor.cc.o.d"
+  "/root/repo/cyber/scheduler/processor_context.cc" "CMakeFiles/cyber.dir/cyber/scheduler/processor_context.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/processor_context.cc.o.d"
+  "/root/repo/cyber/scheduler/scheduler.cc" "CMakeFiles/cyber.dir/cyber/scheduler/scheduler.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/scheduler.cc.o.d"
+  "/root/repo/cyber/scheduler/scheduler_factory.cc" "CMakeFiles/cyber.dir/cyber/scheduler/scheduler_factory.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/scheduler/scheduler_factory.cc.o.d"
+  "/root/repo/cyber/service_discovery/communication/participant_listener.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/participant_listener.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/participant_listener.cc.o.d"
+  "/root/repo/cyber/service_discovery/communication/shm_registry.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/shm_registry.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/shm_registry.cc.o.d"
+  "/root/repo/cyber/service_discovery/communication/subscriber_listener.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/subscriber_listener.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/communication/subscriber_listener.cc.o.d"
+  "/root/repo/cyber/service_discovery/container/graph.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/graph.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/graph.cc.o.d"
+  "/root/repo/cyber/service_discovery/container/multi_value_warehouse.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/multi_value_warehouse.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/multi_value_warehouse.cc.o.d"
+  "/root/repo/cyber/service_discovery/container/role_index.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/role_index.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/role_index.cc.o.d"
+  "/root/repo/cyber/service_discovery/container/single_value_warehouse.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/single_value_warehouse.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/container/single_value_warehouse.cc.o.d"
+  "/root/repo/cyber/service_discovery/role/role.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/role/role.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/role/role.cc.o.d"
+  "/root/repo/cyber/service_discovery/specific_manager/channel_manager.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/channel_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/channel_manager.cc.o.d"
+  "/root/repo/cyber/service_discovery/specific_manager/manager.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/manager.cc.o.d"
+  "/root/repo/cyber/service_discovery/specific_manager/node_manager.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/node_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/node_manager.cc.o.d"
+  "/root/repo/cyber/service_discovery/specific_manager/service_manager.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/service_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/service_manager.cc.o.d"
+  "/root/repo/cyber/service_discovery/topology_manager.cc" "CMakeFiles/cyber.dir/cyber/service_discovery/topology_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/service_discovery/topology_manager.cc.o.d"
+  "/root/repo/cyber/state.cc" "CMakeFiles/cyber.dir/cyber/state.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/state.cc.o.d"
+  "/root/repo/cyber/sysmo/sysmo.cc" "CMakeFiles/cyber.dir/cyber/sysmo/sysmo.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/sysmo/sysmo.cc.o.d"
+  "/root/repo/cyber/sysmo/sysmo_snapshot.cc" "CMakeFiles/cyber.dir/cyber/sysmo/sysmo_snapshot.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/sysmo/sysmo_snapshot.cc.o.d"
+  "/root/repo/cyber/task/task_manager.cc" "CMakeFiles/cyber.dir/cyber/task/task_manager.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/task/task_manager.cc.o.d"
+  "/root/repo/cyber/time/clock.cc" "CMakeFiles/cyber.dir/cyber/time/clock.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/time/clock.cc.o.d"
+  "/root/repo/cyber/time/duration.cc" "CMakeFiles/cyber.dir/cyber/time/duration.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/time/duration.cc.o.d"
+  "/root/repo/cyber/time/rate.cc" "CMakeFiles/cyber.dir/cyber/time/rate.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/time/rate.cc.o.d"
+  "/root/repo/cyber/time/time.cc" "CMakeFiles/cyber.dir/cyber/time/time.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/time/time.cc.o.d"
+  "/root/repo/cyber/timer/timer.cc" "CMakeFiles/cyber.dir/cyber/timer/timer.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/timer/timer.cc.o.d"
+  "/root/repo/cyber/timer/timing_wheel.cc" "CMakeFiles/cyber.dir/cyber/timer/timing_wheel.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/timer/timing_wheel.cc.o.d"
+  "/root/repo/cyber/transport/common/endpoint.cc" "CMakeFiles/cyber.dir/cyber/transport/common/endpoint.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/common/endpoint.cc.o.d"
+  "/root/repo/cyber/transport/common/identity.cc" "CMakeFiles/cyber.dir/cyber/transport/common/identity.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/common/identity.cc.o.d"
+  "/root/repo/cyber/transport/dispatcher/dispatcher.cc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/dispatcher.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/dispatcher.cc.o.d"
+  "/root/repo/cyber/transport/dispatcher/intra_dispatcher.cc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/intra_dispatcher.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/intra_dispatcher.cc.o.d"
+  "/root/repo/cyber/transport/dispatcher/rtps_dispatcher.cc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/rtps_dispatcher.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/rtps_dispatcher.cc.o.d"
+  "/root/repo/cyber/transport/dispatcher/shm_dispatcher.cc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/shm_dispatcher.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/dispatcher/shm_dispatcher.cc.o.d"
+  "/root/repo/cyber/transport/message/message_info.cc" "CMakeFiles/cyber.dir/cyber/transport/message/message_info.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/message/message_info.cc.o.d"
+  "/root/repo/cyber/transport/qos/qos_profile_conf.cc" "CMakeFiles/cyber.dir/cyber/transport/qos/qos_profile_conf.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/qos/qos_profile_conf.cc.o.d"
+  "/root/repo/cyber/transport/rtps/attributes_filler.cc" "CMakeFiles/cyber.dir/cyber/transport/rtps/attributes_filler.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/rtps/attributes_filler.cc.o.d"
+  "/root/repo/cyber/transport/rtps/participant.cc" "CMakeFiles/cyber.dir/cyber/transport/rtps/participant.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/rtps/participant.cc.o.d"
+  "/root/repo/cyber/transport/rtps/sub_listener.cc" "CMakeFiles/cyber.dir/cyber/transport/rtps/sub_listener.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/rtps/sub_listener.cc.o.d"
+  "/root/repo/cyber/transport/rtps/underlay_message.cc" "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message.cc.o.d"
+  "/root/repo/cyber/transport/rtps/underlay_message_type.cc" "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message_type.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message_type.cc.o.d"
+  "/root/repo/cyber/transport/shm/block.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/block.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/block.cc.o.d"
+  "/root/repo/cyber/transport/shm/condition_notifier.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/condition_notifier.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/condition_notifier.cc.o.d"
+  "/root/repo/cyber/transport/shm/multicast_notifier.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/multicast_notifier.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/multicast_notifier.cc.o.d"
+  "/root/repo/cyber/transport/shm/notifier_factory.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/notifier_factory.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/notifier_factory.cc.o.d"
+  "/root/repo/cyber/transport/shm/posix_segment.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/posix_segment.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/posix_segment.cc.o.d"
+  "/root/repo/cyber/transport/shm/readable_info.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/readable_info.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/readable_info.cc.o.d"
+  "/root/repo/cyber/transport/shm/segment.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/segment.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/segment.cc.o.d"
+  "/root/repo/cyber/transport/shm/segment_factory.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/segment_factory.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/segment_factory.cc.o.d"
+  "/root/repo/cyber/transport/shm/shm_conf.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/shm_conf.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/shm_conf.cc.o.d"
+  "/root/repo/cyber/transport/shm/state.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/state.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/state.cc.o.d"
+  "/root/repo/cyber/transport/shm/xsi_segment.cc" "CMakeFiles/cyber.dir/cyber/transport/shm/xsi_segment.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/shm/xsi_segment.cc.o.d"
+  "/root/repo/cyber/transport/transport.cc" "CMakeFiles/cyber.dir/cyber/transport/transport.cc.o" "gcc" "CMakeFiles/cyber.dir/cyber/transport/transport.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,254 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cyber.dir/cyber/binary.cc.o"
+  "CMakeFiles/cyber.dir/cyber/binary.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/blocker/blocker_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/blocker/blocker_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/class_loader.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/class_loader.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/class_loader_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/class_loader_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/sample.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/sample.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/shared_library.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/shared_library/shared_library.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_factory.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_factory.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_loader_utility.cc.o"
+  "CMakeFiles/cyber.dir/cyber/class_loader/utility/class_loader_utility.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/common/file.cc.o"
+  "CMakeFiles/cyber.dir/cyber/common/file.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/common/global_data.cc.o"
+  "CMakeFiles/cyber.dir/cyber/common/global_data.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/component/timer_component.cc.o"
+  "CMakeFiles/cyber.dir/cyber/component/timer_component.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/croutine/croutine.cc.o"
+  "CMakeFiles/cyber.dir/cyber/croutine/croutine.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/croutine/detail/routine_context.cc.o"
+  "CMakeFiles/cyber.dir/cyber/croutine/detail/routine_context.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/croutine/detail/swap_x86_64.S.o"
+  "CMakeFiles/cyber.dir/cyber/cyber.cc.o"
+  "CMakeFiles/cyber.dir/cyber/cyber.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/event/latency_tracer.cc.o"
+  "CMakeFiles/cyber.dir/cyber/event/latency_tracer.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/event/perf_event_cache.cc.o"
+  "CMakeFiles/cyber.dir/cyber/event/perf_event_cache.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/event/perf_event_file.cc.o"
+  "CMakeFiles/cyber.dir/cyber/event/perf_event_file.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/init.cc.o"
+  "CMakeFiles/cyber.dir/cyber/init.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/io/poll_handler.cc.o"
+  "CMakeFiles/cyber.dir/cyber/io/poll_handler.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/io/poller.cc.o"
+  "CMakeFiles/cyber.dir/cyber/io/poller.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/io/session.cc.o"
+  "CMakeFiles/cyber.dir/cyber/io/session.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/io/uring.cc.o"
+  "CMakeFiles/cyber.dir/cyber/io/uring.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/async_logger.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/async_logger.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/binary_log.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/binary_log.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/log_file_object.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/log_file_object.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/log_module.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/log_module.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/logger.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/logger.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/logger/logger_util.cc.o"
+  "CMakeFiles/cyber.dir/cyber/logger/logger_util.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/message/protobuf_factory.cc.o"
+  "CMakeFiles/cyber.dir/cyber/message/protobuf_factory.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/node/node.cc.o"
+  "CMakeFiles/cyber.dir/cyber/node/node.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter.cc.o"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter_client.cc.o"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter_client.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter_server.cc.o"
+  "CMakeFiles/cyber.dir/cyber/parameter/parameter_server.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/choreography_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/choreography_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/classic_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/classic_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/clock.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/clock.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/component_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/component_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/cyber_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/cyber_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/dag_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/dag_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/discovery_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/discovery_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/io_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/io_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/log_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/log_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/parameter.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/parameter.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/perception.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/perception.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/perf_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/perf_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/proto_desc.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/proto_desc.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/qos_profile.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/qos_profile.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/record.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/record.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/role_attributes.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/role_attributes.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/run_mode_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/run_mode_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/scheduler_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/scheduler_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/sysmo_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/sysmo_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/task_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/task_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/timer_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/timer_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/topology_change.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/topology_change.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/transport_conf.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/transport_conf.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/proto/unit_test.pb.cc.o"
+  "CMakeFiles/cyber.dir/cyber/proto/unit_test.pb.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_base.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_base.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_reader.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_reader.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_writer.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/file/record_file_writer.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/header_builder.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/header_builder.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/message_stager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/message_stager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/record_reader.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/record_reader.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/record_viewer.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/record_viewer.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/record/record_writer.cc.o"
+  "CMakeFiles/cyber.dir/cyber/record/record_writer.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/common/pin_thread.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/common/pin_thread.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/choreography_context.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/choreography_context.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/classic_context.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/classic_context.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_choreography.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_choreography.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_classic.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/policy/scheduler_classic.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/processor.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/processor.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/processor_context.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/processor_context.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/scheduler.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/scheduler.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/scheduler/scheduler_factory.cc.o"
+  "CMakeFiles/cyber.dir/cyber/scheduler/scheduler_factory.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/participant_listener.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/participant_listener.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/shm_registry.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/shm_registry.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/subscriber_listener.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/communication/subscriber_listener.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/graph.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/graph.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/multi_value_warehouse.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/multi_value_warehouse.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/role_index.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/role_index.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/single_value_warehouse.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/container/single_value_warehouse.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/role/role.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/role/role.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/channel_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/channel_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/node_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/node_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/service_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/specific_manager/service_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/topology_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/service_discovery/topology_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/state.cc.o"
+  "CMakeFiles/cyber.dir/cyber/state.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/sysmo/sysmo.cc.o"
+  "CMakeFiles/cyber.dir/cyber/sysmo/sysmo.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/sysmo/sysmo_snapshot.cc.o"
+  "CMakeFiles/cyber.dir/cyber/sysmo/sysmo_snapshot.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/task/task_manager.cc.o"
+  "CMakeFiles/cyber.dir/cyber/task/task_manager.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/time/clock.cc.o"
+  "CMakeFiles/cyber.dir/cyber/time/clock.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/time/duration.cc.o"
+  "CMakeFiles/cyber.dir/cyber/time/duration.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/time/rate.cc.o"
+  "CMakeFiles/cyber.dir/cyber/time/rate.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/time/time.cc.o"
+  "CMakeFiles/cyber.dir/cyber/time/time.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/timer/timer.cc.o"
+  "CMakeFiles/cyber.dir/cyber/timer/timer.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/timer/timing_wheel.cc.o"
+  "CMakeFiles/cyber.dir/cyber/timer/timing_wheel.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/common/endpoint.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/common/endpoint.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/common/identity.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/common/identity.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/dispatcher.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/dispatcher.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/intra_dispatcher.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/intra_dispatcher.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/rtps_dispatcher.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/rtps_dispatcher.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/shm_dispatcher.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/dispatcher/shm_dispatcher.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/message/message_info.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/message/message_info.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/qos/qos_profile_conf.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/qos/qos_profile_conf.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/attributes_filler.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/attributes_filler.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/participant.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/participant.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/sub_listener.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/sub_listener.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message_type.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/rtps/underlay_message_type.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/block.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/block.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/condition_notifier.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/condition_notifier.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/multicast_notifier.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/multicast_notifier.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/notifier_factory.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/notifier_factory.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/posix_segment.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/posix_segment.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/readable_info.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/readable_info.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/segment.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/segment.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/segment_factory.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/segment_factory.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/shm_conf.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/shm_conf.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/state.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/state.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/xsi_segment.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/shm/xsi_segment.cc.o.d"
+  "CMakeFiles/cyber.dir/cyber/transport/transport.cc.o"
+  "CMakeFiles/cyber.dir/cyber/transport/transport.cc.o.d"
+  "libcyber.pdb"
+  "libcyber.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM CXX)
+  include(CMakeFiles/cyber.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cyber/mainboard/mainboard.cc" "CMakeFiles/mainboard.dir/cyber/mainboard/mainboard.cc.o" "gcc" "CMakeFiles/mainboard.dir/cyber/mainboard/mainboard.cc.o.d"
+  "/root/repo/cyber/mainboard/module_argument.cc" "CMakeFiles/mainboard.dir/cyber/mainboard/module_argument.cc.o" "gcc" "CMakeFiles/mainboard.dir/cyber/mainboard/module_argument.cc.o.d"
+  "/root/repo/cyber/mainboard/module_controller.cc" "CMakeFiles/mainboard.dir/cyber/mainboard/module_controller.cc.o" "gcc" "CMakeFiles/mainboard.dir/cyber/mainboard/module_controller.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/CMakeFiles/cyber.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mainboard.dir/cyber/mainboard/mainboard.cc.o"
+  "CMakeFiles/mainboard.dir/cyber/mainboard/mainboard.cc.o.d"
+  "CMakeFiles/mainboard.dir/cyber/mainboard/module_argument.cc.o"
+  "CMakeFiles/mainboard.dir/cyber/mainboard/module_argument.cc.o.d"
+  "CMakeFiles/mainboard.dir/cyber/mainboard/module_controller.cc.o"
+  "CMakeFiles/mainboard.dir/cyber/mainboard/module_controller.cc.o.d"
+  "mainboard"
+  "mainboard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mainboard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
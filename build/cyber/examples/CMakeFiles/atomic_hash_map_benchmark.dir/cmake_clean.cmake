@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../atomic_hash_map_benchmark"
+  "../../atomic_hash_map_benchmark.pdb"
+  "CMakeFiles/atomic_hash_map_benchmark.dir/atomic_hash_map_benchmark.cc.o"
+  "CMakeFiles/atomic_hash_map_benchmark.dir/atomic_hash_map_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/atomic_hash_map_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
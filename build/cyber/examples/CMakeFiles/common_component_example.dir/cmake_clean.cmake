@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../libcommon_component_example.pdb"
+  "../../libcommon_component_example.so"
+  "CMakeFiles/common_component_example.dir/common_component_example/common_component_example.cc.o"
+  "CMakeFiles/common_component_example.dir/common_component_example/common_component_example.cc.o.d"
+  "CMakeFiles/common_component_example.dir/examples.pb.cc.o"
+  "CMakeFiles/common_component_example.dir/examples.pb.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/common_component_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../listener"
+  "../../listener.pdb"
+  "CMakeFiles/listener.dir/examples.pb.cc.o"
+  "CMakeFiles/listener.dir/examples.pb.cc.o.d"
+  "CMakeFiles/listener.dir/listener.cc.o"
+  "CMakeFiles/listener.dir/listener.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/listener.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../log_benchmark"
+  "../../log_benchmark.pdb"
+  "CMakeFiles/log_benchmark.dir/log_benchmark.cc.o"
+  "CMakeFiles/log_benchmark.dir/log_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
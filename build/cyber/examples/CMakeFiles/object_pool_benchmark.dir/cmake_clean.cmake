@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../object_pool_benchmark"
+  "../../object_pool_benchmark.pdb"
+  "CMakeFiles/object_pool_benchmark.dir/object_pool_benchmark.cc.o"
+  "CMakeFiles/object_pool_benchmark.dir/object_pool_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/object_pool_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../parameter_benchmark"
+  "../../parameter_benchmark.pdb"
+  "CMakeFiles/parameter_benchmark.dir/parameter_benchmark.cc.o"
+  "CMakeFiles/parameter_benchmark.dir/parameter_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parameter_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
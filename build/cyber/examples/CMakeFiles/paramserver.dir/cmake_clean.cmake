@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../paramserver"
+  "../../paramserver.pdb"
+  "CMakeFiles/paramserver.dir/paramserver.cc.o"
+  "CMakeFiles/paramserver.dir/paramserver.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/paramserver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../record"
+  "../../record.pdb"
+  "CMakeFiles/record.dir/record.cc.o"
+  "CMakeFiles/record.dir/record.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/record.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../service"
+  "../../service.pdb"
+  "CMakeFiles/service.dir/examples.pb.cc.o"
+  "CMakeFiles/service.dir/examples.pb.cc.o.d"
+  "CMakeFiles/service.dir/service.cc.o"
+  "CMakeFiles/service.dir/service.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build/cyber/examples/examples.pb.cc" "cyber/examples/CMakeFiles/service_benchmark.dir/examples.pb.cc.o" "gcc" "cyber/examples/CMakeFiles/service_benchmark.dir/examples.pb.cc.o.d"
+  "/root/repo/cyber/examples/service_benchmark.cc" "cyber/examples/CMakeFiles/service_benchmark.dir/service_benchmark.cc.o" "gcc" "cyber/examples/CMakeFiles/service_benchmark.dir/service_benchmark.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/cyber/examples/examples.pb.cc" "/root/repo/build/cyber/examples/examples.pb.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/CMakeFiles/cyber.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../service_benchmark"
+  "../../service_benchmark.pdb"
+  "CMakeFiles/service_benchmark.dir/examples.pb.cc.o"
+  "CMakeFiles/service_benchmark.dir/examples.pb.cc.o.d"
+  "CMakeFiles/service_benchmark.dir/service_benchmark.cc.o"
+  "CMakeFiles/service_benchmark.dir/service_benchmark.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/service_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
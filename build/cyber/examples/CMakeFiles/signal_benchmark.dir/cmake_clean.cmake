@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../signal_benchmark"
+  "../../signal_benchmark.pdb"
+  "CMakeFiles/signal_benchmark.dir/signal_benchmark.cc.o"
+  "CMakeFiles/signal_benchmark.dir/signal_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/signal_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../talker"
+  "../../talker.pdb"
+  "CMakeFiles/talker.dir/examples.pb.cc.o"
+  "CMakeFiles/talker.dir/examples.pb.cc.o.d"
+  "CMakeFiles/talker.dir/talker.cc.o"
+  "CMakeFiles/talker.dir/talker.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/talker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../task_benchmark"
+  "../../task_benchmark.pdb"
+  "CMakeFiles/task_benchmark.dir/task_benchmark.cc.o"
+  "CMakeFiles/task_benchmark.dir/task_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tcp_echo_benchmark"
+  "../../tcp_echo_benchmark.pdb"
+  "CMakeFiles/tcp_echo_benchmark.dir/tcp_echo_benchmark.cc.o"
+  "CMakeFiles/tcp_echo_benchmark.dir/tcp_echo_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp_echo_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tcp_echo_client"
+  "../../tcp_echo_client.pdb"
+  "CMakeFiles/tcp_echo_client.dir/tcp_echo_client.cc.o"
+  "CMakeFiles/tcp_echo_client.dir/tcp_echo_client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp_echo_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tcp_echo_server"
+  "../../tcp_echo_server.pdb"
+  "CMakeFiles/tcp_echo_server.dir/tcp_echo_server.cc.o"
+  "CMakeFiles/tcp_echo_server.dir/tcp_echo_server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../libtimer_component_example.pdb"
+  "../../libtimer_component_example.so"
+  "CMakeFiles/timer_component_example.dir/examples.pb.cc.o"
+  "CMakeFiles/timer_component_example.dir/examples.pb.cc.o.d"
+  "CMakeFiles/timer_component_example.dir/timer_component_example/timer_component_example.cc.o"
+  "CMakeFiles/timer_component_example.dir/timer_component_example/timer_component_example.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timer_component_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../libtimer_sender_03.pdb"
+  "../../libtimer_sender_03.so"
+  "CMakeFiles/timer_sender_03.dir/examples.pb.cc.o"
+  "CMakeFiles/timer_sender_03.dir/examples.pb.cc.o.d"
+  "CMakeFiles/timer_sender_03.dir/timer_send_component/timer_send_03.cc.o"
+  "CMakeFiles/timer_sender_03.dir/timer_send_component/timer_send_03.cc.o.d"
+  "examples.pb.cc"
+  "examples.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timer_sender_03.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
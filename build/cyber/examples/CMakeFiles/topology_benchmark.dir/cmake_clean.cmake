@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../topology_benchmark"
+  "../../topology_benchmark.pdb"
+  "CMakeFiles/topology_benchmark.dir/topology_benchmark.cc.o"
+  "CMakeFiles/topology_benchmark.dir/topology_benchmark.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/topology_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
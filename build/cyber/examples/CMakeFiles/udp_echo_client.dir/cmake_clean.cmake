@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../udp_echo_client"
+  "../../udp_echo_client.pdb"
+  "CMakeFiles/udp_echo_client.dir/udp_echo_client.cc.o"
+  "CMakeFiles/udp_echo_client.dir/udp_echo_client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_echo_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../udp_echo_server"
+  "../../udp_echo_server.pdb"
+  "CMakeFiles/udp_echo_server.dir/udp_echo_server.cc.o"
+  "CMakeFiles/udp_echo_server.dir/udp_echo_server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,368 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: clock.proto
+
+#include "clock.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class ClockDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Clock>
+      _instance;
+} _Clock_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_clock_2eproto {
+void InitDefaultsClockImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_Clock_default_instance_;
+    new (ptr) ::apollo::cyber::proto::Clock();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::Clock::InitAsDefaultInstance();
+}
+
+void InitDefaultsClock() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsClockImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Clock, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Clock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Clock, clock_),
+  0,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 6, sizeof(::apollo::cyber::proto::Clock)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_Clock_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "clock.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\013clock.proto\022\022apollo.cyber.proto\"\026\n\005Clo"
+      "ck\022\r\n\005clock\030\001 \002(\004"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 57);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "clock.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_clock_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void Clock::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Clock::kClockFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Clock::Clock()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_clock_2eproto::InitDefaultsClock();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.Clock)
+}
+Clock::Clock(const Clock& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  clock_ = from.clock_;
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.Clock)
+}
+
+void Clock::SharedCtor() {
+  _cached_size_ = 0;
+  clock_ = GOOGLE_ULONGLONG(0);
+}
+
+Clock::~Clock() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.Clock)
+  SharedDtor();
+}
+
+void Clock::SharedDtor() {
+}
+
+void Clock::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Clock::descriptor() {
+  ::protobuf_clock_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_clock_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const Clock& Clock::default_instance() {
+  ::protobuf_clock_2eproto::InitDefaultsClock();
+  return *internal_default_instance();
+}
+
+Clock* Clock::New(::google::protobuf::Arena* arena) const {
+  Clock* n = new Clock;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Clock::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.Clock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clock_ = GOOGLE_ULONGLONG(0);
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool Clock::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.Clock)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 clock = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_clock();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &clock_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.Clock)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.Clock)
+  return false;
+#undef DO_
+}
+
+void Clock::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.Clock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required uint64 clock = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->clock(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.Clock)
+}
+
+::google::protobuf::uint8* Clock::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.Clock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required uint64 clock = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->clock(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.Clock)
+  return target;
+}
+
+size_t Clock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.Clock)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // required uint64 clock = 1;
+  if (has_clock()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->clock());
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Clock::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.Clock)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Clock* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const Clock>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.Clock)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.Clock)
+    MergeFrom(*source);
+  }
+}
+
+void Clock::MergeFrom(const Clock& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.Clock)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_clock()) {
+    set_clock(from.clock());
+  }
+}
+
+void Clock::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.Clock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Clock::CopyFrom(const Clock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.Clock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Clock::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+  return true;
+}
+
+void Clock::Swap(Clock* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Clock::InternalSwap(Clock* other) {
+  using std::swap;
+  swap(clock_, other->clock_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata Clock::GetMetadata() const {
+  protobuf_clock_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_clock_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,221 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: clock.proto
+
+#ifndef PROTOBUF_clock_2eproto__INCLUDED
+#define PROTOBUF_clock_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_clock_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsClockImpl();
+void InitDefaultsClock();
+inline void InitDefaults() {
+  InitDefaultsClock();
+}
+}  // namespace protobuf_clock_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class Clock;
+class ClockDefaultTypeInternal;
+extern ClockDefaultTypeInternal _Clock_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class Clock : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.Clock) */ {
+ public:
+  Clock();
+  virtual ~Clock();
+
+  Clock(const Clock& from);
+
+  inline Clock& operator=(const Clock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  Clock(Clock&& from) noexcept
+    : Clock() {
+    *this = ::std::move(from);
+  }
+
+  inline Clock& operator=(Clock&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Clock& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Clock* internal_default_instance() {
+    return reinterpret_cast<const Clock*>(
+               &_Clock_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(Clock* other);
+  friend void swap(Clock& a, Clock& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Clock* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  Clock* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const Clock& from);
+  void MergeFrom(const Clock& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(Clock* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint64 clock = 1;
+  bool has_clock() const;
+  void clear_clock();
+  static const int kClockFieldNumber = 1;
+  ::google::protobuf::uint64 clock() const;
+  void set_clock(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.Clock)
+ private:
+  void set_has_clock();
+  void clear_has_clock();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::uint64 clock_;
+  friend struct ::protobuf_clock_2eproto::TableStruct;
+  friend void ::protobuf_clock_2eproto::InitDefaultsClockImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Clock
+
+// required uint64 clock = 1;
+inline bool Clock::has_clock() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Clock::set_has_clock() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Clock::clear_has_clock() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Clock::clear_clock() {
+  clock_ = GOOGLE_ULONGLONG(0);
+  clear_has_clock();
+}
+inline ::google::protobuf::uint64 Clock::clock() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.Clock.clock)
+  return clock_;
+}
+inline void Clock::set_clock(::google::protobuf::uint64 value) {
+  set_has_clock();
+  clock_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.Clock.clock)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_clock_2eproto__INCLUDED
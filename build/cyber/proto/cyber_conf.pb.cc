@@ -0,0 +1,935 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cyber_conf.proto
+
+#include "cyber_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class CyberConfigDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<CyberConfig>
+      _instance;
+} _CyberConfig_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_cyber_5fconf_2eproto {
+void InitDefaultsCyberConfigImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_scheduler_5fconf_2eproto::InitDefaultsSchedulerConf();
+  protobuf_transport_5fconf_2eproto::InitDefaultsTransportConf();
+  protobuf_run_5fmode_5fconf_2eproto::InitDefaultsRunModeConf();
+  protobuf_perf_5fconf_2eproto::InitDefaultsPerfConf();
+  protobuf_timer_5fconf_2eproto::InitDefaultsTimerConf();
+  protobuf_task_5fconf_2eproto::InitDefaultsTaskConf();
+  protobuf_log_5fconf_2eproto::InitDefaultsLogConf();
+  protobuf_sysmo_5fconf_2eproto::InitDefaultsSysMoConf();
+  protobuf_io_5fconf_2eproto::InitDefaultsIoConf();
+  protobuf_discovery_5fconf_2eproto::InitDefaultsDiscoveryConf();
+  {
+    void* ptr = &::apollo::cyber::proto::_CyberConfig_default_instance_;
+    new (ptr) ::apollo::cyber::proto::CyberConfig();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::CyberConfig::InitAsDefaultInstance();
+}
+
+void InitDefaultsCyberConfig() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsCyberConfigImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, scheduler_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, transport_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, run_mode_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, perf_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, timer_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, task_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, log_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, sysmo_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, io_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::CyberConfig, discovery_conf_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, sizeof(::apollo::cyber::proto::CyberConfig)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_CyberConfig_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "cyber_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\020cyber_conf.proto\022\022apollo.cyber.proto\032\024"
+      "scheduler_conf.proto\032\024transport_conf.pro"
+      "to\032\023run_mode_conf.proto\032\017perf_conf.proto"
+      "\032\020timer_conf.proto\032\017task_conf.proto\032\016log"
+      "_conf.proto\032\020sysmo_conf.proto\032\rio_conf.p"
+      "roto\032\024discovery_conf.proto\"\232\004\n\013CyberConf"
+      "ig\0229\n\016scheduler_conf\030\001 \001(\0132!.apollo.cybe"
+      "r.proto.SchedulerConf\0229\n\016transport_conf\030"
+      "\002 \001(\0132!.apollo.cyber.proto.TransportConf"
+      "\0226\n\rrun_mode_conf\030\003 \001(\0132\037.apollo.cyber.p"
+      "roto.RunModeConf\022/\n\tperf_conf\030\004 \001(\0132\034.ap"
+      "ollo.cyber.proto.PerfConf\0221\n\ntimer_conf\030"
+      "\005 \001(\0132\035.apollo.cyber.proto.TimerConf\022/\n\t"
+      "task_conf\030\006 \001(\0132\034.apollo.cyber.proto.Tas"
+      "kConf\022-\n\010log_conf\030\007 \001(\0132\033.apollo.cyber.p"
+      "roto.LogConf\0221\n\nsysmo_conf\030\010 \001(\0132\035.apoll"
+      "o.cyber.proto.SysMoConf\022+\n\007io_conf\030\t \001(\013"
+      "2\032.apollo.cyber.proto.IoConf\0229\n\016discover"
+      "y_conf\030\n \001(\0132!.apollo.cyber.proto.Discov"
+      "eryConf"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 767);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "cyber_conf.proto", &protobuf_RegisterTypes);
+  ::protobuf_scheduler_5fconf_2eproto::AddDescriptors();
+  ::protobuf_transport_5fconf_2eproto::AddDescriptors();
+  ::protobuf_run_5fmode_5fconf_2eproto::AddDescriptors();
+  ::protobuf_perf_5fconf_2eproto::AddDescriptors();
+  ::protobuf_timer_5fconf_2eproto::AddDescriptors();
+  ::protobuf_task_5fconf_2eproto::AddDescriptors();
+  ::protobuf_log_5fconf_2eproto::AddDescriptors();
+  ::protobuf_sysmo_5fconf_2eproto::AddDescriptors();
+  ::protobuf_io_5fconf_2eproto::AddDescriptors();
+  ::protobuf_discovery_5fconf_2eproto::AddDescriptors();
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_cyber_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void CyberConfig::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->scheduler_conf_ = const_cast< ::apollo::cyber::proto::SchedulerConf*>(
+      ::apollo::cyber::proto::SchedulerConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->transport_conf_ = const_cast< ::apollo::cyber::proto::TransportConf*>(
+      ::apollo::cyber::proto::TransportConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->run_mode_conf_ = const_cast< ::apollo::cyber::proto::RunModeConf*>(
+      ::apollo::cyber::proto::RunModeConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->perf_conf_ = const_cast< ::apollo::cyber::proto::PerfConf*>(
+      ::apollo::cyber::proto::PerfConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->timer_conf_ = const_cast< ::apollo::cyber::proto::TimerConf*>(
+      ::apollo::cyber::proto::TimerConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->task_conf_ = const_cast< ::apollo::cyber::proto::TaskConf*>(
+      ::apollo::cyber::proto::TaskConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->log_conf_ = const_cast< ::apollo::cyber::proto::LogConf*>(
+      ::apollo::cyber::proto::LogConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->sysmo_conf_ = const_cast< ::apollo::cyber::proto::SysMoConf*>(
+      ::apollo::cyber::proto::SysMoConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->io_conf_ = const_cast< ::apollo::cyber::proto::IoConf*>(
+      ::apollo::cyber::proto::IoConf::internal_default_instance());
+  ::apollo::cyber::proto::_CyberConfig_default_instance_._instance.get_mutable()->discovery_conf_ = const_cast< ::apollo::cyber::proto::DiscoveryConf*>(
+      ::apollo::cyber::proto::DiscoveryConf::internal_default_instance());
+}
+void CyberConfig::clear_scheduler_conf() {
+  if (scheduler_conf_ != NULL) scheduler_conf_->Clear();
+  clear_has_scheduler_conf();
+}
+void CyberConfig::clear_transport_conf() {
+  if (transport_conf_ != NULL) transport_conf_->Clear();
+  clear_has_transport_conf();
+}
+void CyberConfig::clear_run_mode_conf() {
+  if (run_mode_conf_ != NULL) run_mode_conf_->Clear();
+  clear_has_run_mode_conf();
+}
+void CyberConfig::clear_perf_conf() {
+  if (perf_conf_ != NULL) perf_conf_->Clear();
+  clear_has_perf_conf();
+}
+void CyberConfig::clear_timer_conf() {
+  if (timer_conf_ != NULL) timer_conf_->Clear();
+  clear_has_timer_conf();
+}
+void CyberConfig::clear_task_conf() {
+  if (task_conf_ != NULL) task_conf_->Clear();
+  clear_has_task_conf();
+}
+void CyberConfig::clear_log_conf() {
+  if (log_conf_ != NULL) log_conf_->Clear();
+  clear_has_log_conf();
+}
+void CyberConfig::clear_sysmo_conf() {
+  if (sysmo_conf_ != NULL) sysmo_conf_->Clear();
+  clear_has_sysmo_conf();
+}
+void CyberConfig::clear_io_conf() {
+  if (io_conf_ != NULL) io_conf_->Clear();
+  clear_has_io_conf();
+}
+void CyberConfig::clear_discovery_conf() {
+  if (discovery_conf_ != NULL) discovery_conf_->Clear();
+  clear_has_discovery_conf();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CyberConfig::kSchedulerConfFieldNumber;
+const int CyberConfig::kTransportConfFieldNumber;
+const int CyberConfig::kRunModeConfFieldNumber;
+const int CyberConfig::kPerfConfFieldNumber;
+const int CyberConfig::kTimerConfFieldNumber;
+const int CyberConfig::kTaskConfFieldNumber;
+const int CyberConfig::kLogConfFieldNumber;
+const int CyberConfig::kSysmoConfFieldNumber;
+const int CyberConfig::kIoConfFieldNumber;
+const int CyberConfig::kDiscoveryConfFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CyberConfig::CyberConfig()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_cyber_5fconf_2eproto::InitDefaultsCyberConfig();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.CyberConfig)
+}
+CyberConfig::CyberConfig(const CyberConfig& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_scheduler_conf()) {
+    scheduler_conf_ = new ::apollo::cyber::proto::SchedulerConf(*from.scheduler_conf_);
+  } else {
+    scheduler_conf_ = NULL;
+  }
+  if (from.has_transport_conf()) {
+    transport_conf_ = new ::apollo::cyber::proto::TransportConf(*from.transport_conf_);
+  } else {
+    transport_conf_ = NULL;
+  }
+  if (from.has_run_mode_conf()) {
+    run_mode_conf_ = new ::apollo::cyber::proto::RunModeConf(*from.run_mode_conf_);
+  } else {
+    run_mode_conf_ = NULL;
+  }
+  if (from.has_perf_conf()) {
+    perf_conf_ = new ::apollo::cyber::proto::PerfConf(*from.perf_conf_);
+  } else {
+    perf_conf_ = NULL;
+  }
+  if (from.has_timer_conf()) {
+    timer_conf_ = new ::apollo::cyber::proto::TimerConf(*from.timer_conf_);
+  } else {
+    timer_conf_ = NULL;
+  }
+  if (from.has_task_conf()) {
+    task_conf_ = new ::apollo::cyber::proto::TaskConf(*from.task_conf_);
+  } else {
+    task_conf_ = NULL;
+  }
+  if (from.has_log_conf()) {
+    log_conf_ = new ::apollo::cyber::proto::LogConf(*from.log_conf_);
+  } else {
+    log_conf_ = NULL;
+  }
+  if (from.has_sysmo_conf()) {
+    sysmo_conf_ = new ::apollo::cyber::proto::SysMoConf(*from.sysmo_conf_);
+  } else {
+    sysmo_conf_ = NULL;
+  }
+  if (from.has_io_conf()) {
+    io_conf_ = new ::apollo::cyber::proto::IoConf(*from.io_conf_);
+  } else {
+    io_conf_ = NULL;
+  }
+  if (from.has_discovery_conf()) {
+    discovery_conf_ = new ::apollo::cyber::proto::DiscoveryConf(*from.discovery_conf_);
+  } else {
+    discovery_conf_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.CyberConfig)
+}
+
+void CyberConfig::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&scheduler_conf_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&discovery_conf_) -
+      reinterpret_cast<char*>(&scheduler_conf_)) + sizeof(discovery_conf_));
+}
+
+CyberConfig::~CyberConfig() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.CyberConfig)
+  SharedDtor();
+}
+
+void CyberConfig::SharedDtor() {
+  if (this != internal_default_instance()) delete scheduler_conf_;
+  if (this != internal_default_instance()) delete transport_conf_;
+  if (this != internal_default_instance()) delete run_mode_conf_;
+  if (this != internal_default_instance()) delete perf_conf_;
+  if (this != internal_default_instance()) delete timer_conf_;
+  if (this != internal_default_instance()) delete task_conf_;
+  if (this != internal_default_instance()) delete log_conf_;
+  if (this != internal_default_instance()) delete sysmo_conf_;
+  if (this != internal_default_instance()) delete io_conf_;
+  if (this != internal_default_instance()) delete discovery_conf_;
+}
+
+void CyberConfig::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CyberConfig::descriptor() {
+  ::protobuf_cyber_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_cyber_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const CyberConfig& CyberConfig::default_instance() {
+  ::protobuf_cyber_5fconf_2eproto::InitDefaultsCyberConfig();
+  return *internal_default_instance();
+}
+
+CyberConfig* CyberConfig::New(::google::protobuf::Arena* arena) const {
+  CyberConfig* n = new CyberConfig;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void CyberConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.CyberConfig)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 255u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(scheduler_conf_ != NULL);
+      scheduler_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(transport_conf_ != NULL);
+      transport_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(run_mode_conf_ != NULL);
+      run_mode_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(perf_conf_ != NULL);
+      perf_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(timer_conf_ != NULL);
+      timer_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(task_conf_ != NULL);
+      task_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(log_conf_ != NULL);
+      log_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(sysmo_conf_ != NULL);
+      sysmo_conf_->Clear();
+    }
+  }
+  if (cached_has_bits & 768u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(io_conf_ != NULL);
+      io_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(discovery_conf_ != NULL);
+      discovery_conf_->Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool CyberConfig::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.CyberConfig)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_scheduler_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_transport_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_run_mode_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_perf_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_timer_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.TaskConf task_conf = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_task_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.LogConf log_conf = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_log_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_sysmo_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.IoConf io_conf = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_io_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_discovery_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.CyberConfig)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.CyberConfig)
+  return false;
+#undef DO_
+}
+
+void CyberConfig::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.CyberConfig)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->scheduler_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->transport_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->run_mode_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, *this->perf_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, *this->timer_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.TaskConf task_conf = 6;
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, *this->task_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.LogConf log_conf = 7;
+  if (cached_has_bits & 0x00000040u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->log_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+  if (cached_has_bits & 0x00000080u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, *this->sysmo_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.IoConf io_conf = 9;
+  if (cached_has_bits & 0x00000100u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, *this->io_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+  if (cached_has_bits & 0x00000200u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, *this->discovery_conf_, output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.CyberConfig)
+}
+
+::google::protobuf::uint8* CyberConfig::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.CyberConfig)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, *this->scheduler_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, *this->transport_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        3, *this->run_mode_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        4, *this->perf_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, *this->timer_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.TaskConf task_conf = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        6, *this->task_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.LogConf log_conf = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, *this->log_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        8, *this->sysmo_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.IoConf io_conf = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        9, *this->io_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        10, *this->discovery_conf_, deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.CyberConfig)
+  return target;
+}
+
+size_t CyberConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.CyberConfig)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 255u) {
+    // optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+    if (has_scheduler_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->scheduler_conf_);
+    }
+
+    // optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+    if (has_transport_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->transport_conf_);
+    }
+
+    // optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+    if (has_run_mode_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->run_mode_conf_);
+    }
+
+    // optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+    if (has_perf_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->perf_conf_);
+    }
+
+    // optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+    if (has_timer_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->timer_conf_);
+    }
+
+    // optional .apollo.cyber.proto.TaskConf task_conf = 6;
+    if (has_task_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->task_conf_);
+    }
+
+    // optional .apollo.cyber.proto.LogConf log_conf = 7;
+    if (has_log_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->log_conf_);
+    }
+
+    // optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+    if (has_sysmo_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->sysmo_conf_);
+    }
+
+  }
+  if (_has_bits_[8 / 32] & 768u) {
+    // optional .apollo.cyber.proto.IoConf io_conf = 9;
+    if (has_io_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->io_conf_);
+    }
+
+    // optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+    if (has_discovery_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->discovery_conf_);
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CyberConfig::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.CyberConfig)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CyberConfig* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CyberConfig>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.CyberConfig)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.CyberConfig)
+    MergeFrom(*source);
+  }
+}
+
+void CyberConfig::MergeFrom(const CyberConfig& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.CyberConfig)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 255u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_scheduler_conf()->::apollo::cyber::proto::SchedulerConf::MergeFrom(from.scheduler_conf());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      mutable_transport_conf()->::apollo::cyber::proto::TransportConf::MergeFrom(from.transport_conf());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      mutable_run_mode_conf()->::apollo::cyber::proto::RunModeConf::MergeFrom(from.run_mode_conf());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      mutable_perf_conf()->::apollo::cyber::proto::PerfConf::MergeFrom(from.perf_conf());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      mutable_timer_conf()->::apollo::cyber::proto::TimerConf::MergeFrom(from.timer_conf());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      mutable_task_conf()->::apollo::cyber::proto::TaskConf::MergeFrom(from.task_conf());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      mutable_log_conf()->::apollo::cyber::proto::LogConf::MergeFrom(from.log_conf());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      mutable_sysmo_conf()->::apollo::cyber::proto::SysMoConf::MergeFrom(from.sysmo_conf());
+    }
+  }
+  if (cached_has_bits & 768u) {
+    if (cached_has_bits & 0x00000100u) {
+      mutable_io_conf()->::apollo::cyber::proto::IoConf::MergeFrom(from.io_conf());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      mutable_discovery_conf()->::apollo::cyber::proto::DiscoveryConf::MergeFrom(from.discovery_conf());
+    }
+  }
+}
+
+void CyberConfig::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.CyberConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CyberConfig::CopyFrom(const CyberConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.CyberConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CyberConfig::IsInitialized() const {
+  if (has_scheduler_conf()) {
+    if (!this->scheduler_conf_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CyberConfig::Swap(CyberConfig* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void CyberConfig::InternalSwap(CyberConfig* other) {
+  using std::swap;
+  swap(scheduler_conf_, other->scheduler_conf_);
+  swap(transport_conf_, other->transport_conf_);
+  swap(run_mode_conf_, other->run_mode_conf_);
+  swap(perf_conf_, other->perf_conf_);
+  swap(timer_conf_, other->timer_conf_);
+  swap(task_conf_, other->task_conf_);
+  swap(log_conf_, other->log_conf_);
+  swap(sysmo_conf_, other->sysmo_conf_);
+  swap(io_conf_, other->io_conf_);
+  swap(discovery_conf_, other->discovery_conf_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CyberConfig::GetMetadata() const {
+  protobuf_cyber_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_cyber_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
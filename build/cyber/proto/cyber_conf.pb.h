@@ -0,0 +1,817 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cyber_conf.proto
+
+#ifndef PROTOBUF_cyber_5fconf_2eproto__INCLUDED
+#define PROTOBUF_cyber_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "scheduler_conf.pb.h"
+#include "transport_conf.pb.h"
+#include "run_mode_conf.pb.h"
+#include "perf_conf.pb.h"
+#include "timer_conf.pb.h"
+#include "task_conf.pb.h"
+#include "log_conf.pb.h"
+#include "sysmo_conf.pb.h"
+#include "io_conf.pb.h"
+#include "discovery_conf.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_cyber_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsCyberConfigImpl();
+void InitDefaultsCyberConfig();
+inline void InitDefaults() {
+  InitDefaultsCyberConfig();
+}
+}  // namespace protobuf_cyber_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class CyberConfig;
+class CyberConfigDefaultTypeInternal;
+extern CyberConfigDefaultTypeInternal _CyberConfig_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class CyberConfig : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.CyberConfig) */ {
+ public:
+  CyberConfig();
+  virtual ~CyberConfig();
+
+  CyberConfig(const CyberConfig& from);
+
+  inline CyberConfig& operator=(const CyberConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  CyberConfig(CyberConfig&& from) noexcept
+    : CyberConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline CyberConfig& operator=(CyberConfig&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CyberConfig& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const CyberConfig* internal_default_instance() {
+    return reinterpret_cast<const CyberConfig*>(
+               &_CyberConfig_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(CyberConfig* other);
+  friend void swap(CyberConfig& a, CyberConfig& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CyberConfig* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CyberConfig* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CyberConfig& from);
+  void MergeFrom(const CyberConfig& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CyberConfig* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+  bool has_scheduler_conf() const;
+  void clear_scheduler_conf();
+  static const int kSchedulerConfFieldNumber = 1;
+  const ::apollo::cyber::proto::SchedulerConf& scheduler_conf() const;
+  ::apollo::cyber::proto::SchedulerConf* release_scheduler_conf();
+  ::apollo::cyber::proto::SchedulerConf* mutable_scheduler_conf();
+  void set_allocated_scheduler_conf(::apollo::cyber::proto::SchedulerConf* scheduler_conf);
+
+  // optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+  bool has_transport_conf() const;
+  void clear_transport_conf();
+  static const int kTransportConfFieldNumber = 2;
+  const ::apollo::cyber::proto::TransportConf& transport_conf() const;
+  ::apollo::cyber::proto::TransportConf* release_transport_conf();
+  ::apollo::cyber::proto::TransportConf* mutable_transport_conf();
+  void set_allocated_transport_conf(::apollo::cyber::proto::TransportConf* transport_conf);
+
+  // optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+  bool has_run_mode_conf() const;
+  void clear_run_mode_conf();
+  static const int kRunModeConfFieldNumber = 3;
+  const ::apollo::cyber::proto::RunModeConf& run_mode_conf() const;
+  ::apollo::cyber::proto::RunModeConf* release_run_mode_conf();
+  ::apollo::cyber::proto::RunModeConf* mutable_run_mode_conf();
+  void set_allocated_run_mode_conf(::apollo::cyber::proto::RunModeConf* run_mode_conf);
+
+  // optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+  bool has_perf_conf() const;
+  void clear_perf_conf();
+  static const int kPerfConfFieldNumber = 4;
+  const ::apollo::cyber::proto::PerfConf& perf_conf() const;
+  ::apollo::cyber::proto::PerfConf* release_perf_conf();
+  ::apollo::cyber::proto::PerfConf* mutable_perf_conf();
+  void set_allocated_perf_conf(::apollo::cyber::proto::PerfConf* perf_conf);
+
+  // optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+  bool has_timer_conf() const;
+  void clear_timer_conf();
+  static const int kTimerConfFieldNumber = 5;
+  const ::apollo::cyber::proto::TimerConf& timer_conf() const;
+  ::apollo::cyber::proto::TimerConf* release_timer_conf();
+  ::apollo::cyber::proto::TimerConf* mutable_timer_conf();
+  void set_allocated_timer_conf(::apollo::cyber::proto::TimerConf* timer_conf);
+
+  // optional .apollo.cyber.proto.TaskConf task_conf = 6;
+  bool has_task_conf() const;
+  void clear_task_conf();
+  static const int kTaskConfFieldNumber = 6;
+  const ::apollo::cyber::proto::TaskConf& task_conf() const;
+  ::apollo::cyber::proto::TaskConf* release_task_conf();
+  ::apollo::cyber::proto::TaskConf* mutable_task_conf();
+  void set_allocated_task_conf(::apollo::cyber::proto::TaskConf* task_conf);
+
+  // optional .apollo.cyber.proto.LogConf log_conf = 7;
+  bool has_log_conf() const;
+  void clear_log_conf();
+  static const int kLogConfFieldNumber = 7;
+  const ::apollo::cyber::proto::LogConf& log_conf() const;
+  ::apollo::cyber::proto::LogConf* release_log_conf();
+  ::apollo::cyber::proto::LogConf* mutable_log_conf();
+  void set_allocated_log_conf(::apollo::cyber::proto::LogConf* log_conf);
+
+  // optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+  bool has_sysmo_conf() const;
+  void clear_sysmo_conf();
+  static const int kSysmoConfFieldNumber = 8;
+  const ::apollo::cyber::proto::SysMoConf& sysmo_conf() const;
+  ::apollo::cyber::proto::SysMoConf* release_sysmo_conf();
+  ::apollo::cyber::proto::SysMoConf* mutable_sysmo_conf();
+  void set_allocated_sysmo_conf(::apollo::cyber::proto::SysMoConf* sysmo_conf);
+
+  // optional .apollo.cyber.proto.IoConf io_conf = 9;
+  bool has_io_conf() const;
+  void clear_io_conf();
+  static const int kIoConfFieldNumber = 9;
+  const ::apollo::cyber::proto::IoConf& io_conf() const;
+  ::apollo::cyber::proto::IoConf* release_io_conf();
+  ::apollo::cyber::proto::IoConf* mutable_io_conf();
+  void set_allocated_io_conf(::apollo::cyber::proto::IoConf* io_conf);
+
+  // optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+  bool has_discovery_conf() const;
+  void clear_discovery_conf();
+  static const int kDiscoveryConfFieldNumber = 10;
+  const ::apollo::cyber::proto::DiscoveryConf& discovery_conf() const;
+  ::apollo::cyber::proto::DiscoveryConf* release_discovery_conf();
+  ::apollo::cyber::proto::DiscoveryConf* mutable_discovery_conf();
+  void set_allocated_discovery_conf(::apollo::cyber::proto::DiscoveryConf* discovery_conf);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.CyberConfig)
+ private:
+  void set_has_scheduler_conf();
+  void clear_has_scheduler_conf();
+  void set_has_transport_conf();
+  void clear_has_transport_conf();
+  void set_has_run_mode_conf();
+  void clear_has_run_mode_conf();
+  void set_has_perf_conf();
+  void clear_has_perf_conf();
+  void set_has_timer_conf();
+  void clear_has_timer_conf();
+  void set_has_task_conf();
+  void clear_has_task_conf();
+  void set_has_log_conf();
+  void clear_has_log_conf();
+  void set_has_sysmo_conf();
+  void clear_has_sysmo_conf();
+  void set_has_io_conf();
+  void clear_has_io_conf();
+  void set_has_discovery_conf();
+  void clear_has_discovery_conf();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::apollo::cyber::proto::SchedulerConf* scheduler_conf_;
+  ::apollo::cyber::proto::TransportConf* transport_conf_;
+  ::apollo::cyber::proto::RunModeConf* run_mode_conf_;
+  ::apollo::cyber::proto::PerfConf* perf_conf_;
+  ::apollo::cyber::proto::TimerConf* timer_conf_;
+  ::apollo::cyber::proto::TaskConf* task_conf_;
+  ::apollo::cyber::proto::LogConf* log_conf_;
+  ::apollo::cyber::proto::SysMoConf* sysmo_conf_;
+  ::apollo::cyber::proto::IoConf* io_conf_;
+  ::apollo::cyber::proto::DiscoveryConf* discovery_conf_;
+  friend struct ::protobuf_cyber_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_cyber_5fconf_2eproto::InitDefaultsCyberConfigImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CyberConfig
+
+// optional .apollo.cyber.proto.SchedulerConf scheduler_conf = 1;
+inline bool CyberConfig::has_scheduler_conf() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CyberConfig::set_has_scheduler_conf() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CyberConfig::clear_has_scheduler_conf() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::apollo::cyber::proto::SchedulerConf& CyberConfig::scheduler_conf() const {
+  const ::apollo::cyber::proto::SchedulerConf* p = scheduler_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.scheduler_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::SchedulerConf*>(
+      &::apollo::cyber::proto::_SchedulerConf_default_instance_);
+}
+inline ::apollo::cyber::proto::SchedulerConf* CyberConfig::release_scheduler_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.scheduler_conf)
+  clear_has_scheduler_conf();
+  ::apollo::cyber::proto::SchedulerConf* temp = scheduler_conf_;
+  scheduler_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::SchedulerConf* CyberConfig::mutable_scheduler_conf() {
+  set_has_scheduler_conf();
+  if (scheduler_conf_ == NULL) {
+    scheduler_conf_ = new ::apollo::cyber::proto::SchedulerConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.scheduler_conf)
+  return scheduler_conf_;
+}
+inline void CyberConfig::set_allocated_scheduler_conf(::apollo::cyber::proto::SchedulerConf* scheduler_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(scheduler_conf_);
+  }
+  if (scheduler_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      scheduler_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, scheduler_conf, submessage_arena);
+    }
+    set_has_scheduler_conf();
+  } else {
+    clear_has_scheduler_conf();
+  }
+  scheduler_conf_ = scheduler_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.scheduler_conf)
+}
+
+// optional .apollo.cyber.proto.TransportConf transport_conf = 2;
+inline bool CyberConfig::has_transport_conf() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CyberConfig::set_has_transport_conf() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CyberConfig::clear_has_transport_conf() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::apollo::cyber::proto::TransportConf& CyberConfig::transport_conf() const {
+  const ::apollo::cyber::proto::TransportConf* p = transport_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.transport_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::TransportConf*>(
+      &::apollo::cyber::proto::_TransportConf_default_instance_);
+}
+inline ::apollo::cyber::proto::TransportConf* CyberConfig::release_transport_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.transport_conf)
+  clear_has_transport_conf();
+  ::apollo::cyber::proto::TransportConf* temp = transport_conf_;
+  transport_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::TransportConf* CyberConfig::mutable_transport_conf() {
+  set_has_transport_conf();
+  if (transport_conf_ == NULL) {
+    transport_conf_ = new ::apollo::cyber::proto::TransportConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.transport_conf)
+  return transport_conf_;
+}
+inline void CyberConfig::set_allocated_transport_conf(::apollo::cyber::proto::TransportConf* transport_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(transport_conf_);
+  }
+  if (transport_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      transport_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, transport_conf, submessage_arena);
+    }
+    set_has_transport_conf();
+  } else {
+    clear_has_transport_conf();
+  }
+  transport_conf_ = transport_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.transport_conf)
+}
+
+// optional .apollo.cyber.proto.RunModeConf run_mode_conf = 3;
+inline bool CyberConfig::has_run_mode_conf() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void CyberConfig::set_has_run_mode_conf() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void CyberConfig::clear_has_run_mode_conf() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::apollo::cyber::proto::RunModeConf& CyberConfig::run_mode_conf() const {
+  const ::apollo::cyber::proto::RunModeConf* p = run_mode_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.run_mode_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::RunModeConf*>(
+      &::apollo::cyber::proto::_RunModeConf_default_instance_);
+}
+inline ::apollo::cyber::proto::RunModeConf* CyberConfig::release_run_mode_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.run_mode_conf)
+  clear_has_run_mode_conf();
+  ::apollo::cyber::proto::RunModeConf* temp = run_mode_conf_;
+  run_mode_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::RunModeConf* CyberConfig::mutable_run_mode_conf() {
+  set_has_run_mode_conf();
+  if (run_mode_conf_ == NULL) {
+    run_mode_conf_ = new ::apollo::cyber::proto::RunModeConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.run_mode_conf)
+  return run_mode_conf_;
+}
+inline void CyberConfig::set_allocated_run_mode_conf(::apollo::cyber::proto::RunModeConf* run_mode_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(run_mode_conf_);
+  }
+  if (run_mode_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      run_mode_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, run_mode_conf, submessage_arena);
+    }
+    set_has_run_mode_conf();
+  } else {
+    clear_has_run_mode_conf();
+  }
+  run_mode_conf_ = run_mode_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.run_mode_conf)
+}
+
+// optional .apollo.cyber.proto.PerfConf perf_conf = 4;
+inline bool CyberConfig::has_perf_conf() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void CyberConfig::set_has_perf_conf() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void CyberConfig::clear_has_perf_conf() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const ::apollo::cyber::proto::PerfConf& CyberConfig::perf_conf() const {
+  const ::apollo::cyber::proto::PerfConf* p = perf_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.perf_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::PerfConf*>(
+      &::apollo::cyber::proto::_PerfConf_default_instance_);
+}
+inline ::apollo::cyber::proto::PerfConf* CyberConfig::release_perf_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.perf_conf)
+  clear_has_perf_conf();
+  ::apollo::cyber::proto::PerfConf* temp = perf_conf_;
+  perf_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::PerfConf* CyberConfig::mutable_perf_conf() {
+  set_has_perf_conf();
+  if (perf_conf_ == NULL) {
+    perf_conf_ = new ::apollo::cyber::proto::PerfConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.perf_conf)
+  return perf_conf_;
+}
+inline void CyberConfig::set_allocated_perf_conf(::apollo::cyber::proto::PerfConf* perf_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(perf_conf_);
+  }
+  if (perf_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      perf_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, perf_conf, submessage_arena);
+    }
+    set_has_perf_conf();
+  } else {
+    clear_has_perf_conf();
+  }
+  perf_conf_ = perf_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.perf_conf)
+}
+
+// optional .apollo.cyber.proto.TimerConf timer_conf = 5;
+inline bool CyberConfig::has_timer_conf() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void CyberConfig::set_has_timer_conf() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void CyberConfig::clear_has_timer_conf() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const ::apollo::cyber::proto::TimerConf& CyberConfig::timer_conf() const {
+  const ::apollo::cyber::proto::TimerConf* p = timer_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.timer_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::TimerConf*>(
+      &::apollo::cyber::proto::_TimerConf_default_instance_);
+}
+inline ::apollo::cyber::proto::TimerConf* CyberConfig::release_timer_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.timer_conf)
+  clear_has_timer_conf();
+  ::apollo::cyber::proto::TimerConf* temp = timer_conf_;
+  timer_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::TimerConf* CyberConfig::mutable_timer_conf() {
+  set_has_timer_conf();
+  if (timer_conf_ == NULL) {
+    timer_conf_ = new ::apollo::cyber::proto::TimerConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.timer_conf)
+  return timer_conf_;
+}
+inline void CyberConfig::set_allocated_timer_conf(::apollo::cyber::proto::TimerConf* timer_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(timer_conf_);
+  }
+  if (timer_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      timer_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, timer_conf, submessage_arena);
+    }
+    set_has_timer_conf();
+  } else {
+    clear_has_timer_conf();
+  }
+  timer_conf_ = timer_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.timer_conf)
+}
+
+// optional .apollo.cyber.proto.TaskConf task_conf = 6;
+inline bool CyberConfig::has_task_conf() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void CyberConfig::set_has_task_conf() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void CyberConfig::clear_has_task_conf() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline const ::apollo::cyber::proto::TaskConf& CyberConfig::task_conf() const {
+  const ::apollo::cyber::proto::TaskConf* p = task_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.task_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::TaskConf*>(
+      &::apollo::cyber::proto::_TaskConf_default_instance_);
+}
+inline ::apollo::cyber::proto::TaskConf* CyberConfig::release_task_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.task_conf)
+  clear_has_task_conf();
+  ::apollo::cyber::proto::TaskConf* temp = task_conf_;
+  task_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::TaskConf* CyberConfig::mutable_task_conf() {
+  set_has_task_conf();
+  if (task_conf_ == NULL) {
+    task_conf_ = new ::apollo::cyber::proto::TaskConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.task_conf)
+  return task_conf_;
+}
+inline void CyberConfig::set_allocated_task_conf(::apollo::cyber::proto::TaskConf* task_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(task_conf_);
+  }
+  if (task_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      task_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, task_conf, submessage_arena);
+    }
+    set_has_task_conf();
+  } else {
+    clear_has_task_conf();
+  }
+  task_conf_ = task_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.task_conf)
+}
+
+// optional .apollo.cyber.proto.LogConf log_conf = 7;
+inline bool CyberConfig::has_log_conf() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void CyberConfig::set_has_log_conf() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void CyberConfig::clear_has_log_conf() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline const ::apollo::cyber::proto::LogConf& CyberConfig::log_conf() const {
+  const ::apollo::cyber::proto::LogConf* p = log_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.log_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::LogConf*>(
+      &::apollo::cyber::proto::_LogConf_default_instance_);
+}
+inline ::apollo::cyber::proto::LogConf* CyberConfig::release_log_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.log_conf)
+  clear_has_log_conf();
+  ::apollo::cyber::proto::LogConf* temp = log_conf_;
+  log_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::LogConf* CyberConfig::mutable_log_conf() {
+  set_has_log_conf();
+  if (log_conf_ == NULL) {
+    log_conf_ = new ::apollo::cyber::proto::LogConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.log_conf)
+  return log_conf_;
+}
+inline void CyberConfig::set_allocated_log_conf(::apollo::cyber::proto::LogConf* log_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(log_conf_);
+  }
+  if (log_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      log_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, log_conf, submessage_arena);
+    }
+    set_has_log_conf();
+  } else {
+    clear_has_log_conf();
+  }
+  log_conf_ = log_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.log_conf)
+}
+
+// optional .apollo.cyber.proto.SysMoConf sysmo_conf = 8;
+inline bool CyberConfig::has_sysmo_conf() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void CyberConfig::set_has_sysmo_conf() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void CyberConfig::clear_has_sysmo_conf() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline const ::apollo::cyber::proto::SysMoConf& CyberConfig::sysmo_conf() const {
+  const ::apollo::cyber::proto::SysMoConf* p = sysmo_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.sysmo_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::SysMoConf*>(
+      &::apollo::cyber::proto::_SysMoConf_default_instance_);
+}
+inline ::apollo::cyber::proto::SysMoConf* CyberConfig::release_sysmo_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.sysmo_conf)
+  clear_has_sysmo_conf();
+  ::apollo::cyber::proto::SysMoConf* temp = sysmo_conf_;
+  sysmo_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::SysMoConf* CyberConfig::mutable_sysmo_conf() {
+  set_has_sysmo_conf();
+  if (sysmo_conf_ == NULL) {
+    sysmo_conf_ = new ::apollo::cyber::proto::SysMoConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.sysmo_conf)
+  return sysmo_conf_;
+}
+inline void CyberConfig::set_allocated_sysmo_conf(::apollo::cyber::proto::SysMoConf* sysmo_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(sysmo_conf_);
+  }
+  if (sysmo_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      sysmo_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, sysmo_conf, submessage_arena);
+    }
+    set_has_sysmo_conf();
+  } else {
+    clear_has_sysmo_conf();
+  }
+  sysmo_conf_ = sysmo_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.sysmo_conf)
+}
+
+// optional .apollo.cyber.proto.IoConf io_conf = 9;
+inline bool CyberConfig::has_io_conf() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void CyberConfig::set_has_io_conf() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void CyberConfig::clear_has_io_conf() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline const ::apollo::cyber::proto::IoConf& CyberConfig::io_conf() const {
+  const ::apollo::cyber::proto::IoConf* p = io_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.io_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::IoConf*>(
+      &::apollo::cyber::proto::_IoConf_default_instance_);
+}
+inline ::apollo::cyber::proto::IoConf* CyberConfig::release_io_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.io_conf)
+  clear_has_io_conf();
+  ::apollo::cyber::proto::IoConf* temp = io_conf_;
+  io_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::IoConf* CyberConfig::mutable_io_conf() {
+  set_has_io_conf();
+  if (io_conf_ == NULL) {
+    io_conf_ = new ::apollo::cyber::proto::IoConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.io_conf)
+  return io_conf_;
+}
+inline void CyberConfig::set_allocated_io_conf(::apollo::cyber::proto::IoConf* io_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(io_conf_);
+  }
+  if (io_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      io_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, io_conf, submessage_arena);
+    }
+    set_has_io_conf();
+  } else {
+    clear_has_io_conf();
+  }
+  io_conf_ = io_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.io_conf)
+}
+
+// optional .apollo.cyber.proto.DiscoveryConf discovery_conf = 10;
+inline bool CyberConfig::has_discovery_conf() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void CyberConfig::set_has_discovery_conf() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void CyberConfig::clear_has_discovery_conf() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline const ::apollo::cyber::proto::DiscoveryConf& CyberConfig::discovery_conf() const {
+  const ::apollo::cyber::proto::DiscoveryConf* p = discovery_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.CyberConfig.discovery_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::DiscoveryConf*>(
+      &::apollo::cyber::proto::_DiscoveryConf_default_instance_);
+}
+inline ::apollo::cyber::proto::DiscoveryConf* CyberConfig::release_discovery_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.CyberConfig.discovery_conf)
+  clear_has_discovery_conf();
+  ::apollo::cyber::proto::DiscoveryConf* temp = discovery_conf_;
+  discovery_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::DiscoveryConf* CyberConfig::mutable_discovery_conf() {
+  set_has_discovery_conf();
+  if (discovery_conf_ == NULL) {
+    discovery_conf_ = new ::apollo::cyber::proto::DiscoveryConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.CyberConfig.discovery_conf)
+  return discovery_conf_;
+}
+inline void CyberConfig::set_allocated_discovery_conf(::apollo::cyber::proto::DiscoveryConf* discovery_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(discovery_conf_);
+  }
+  if (discovery_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      discovery_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, discovery_conf, submessage_arena);
+    }
+    set_has_discovery_conf();
+  } else {
+    clear_has_discovery_conf();
+  }
+  discovery_conf_ = discovery_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.CyberConfig.discovery_conf)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_cyber_5fconf_2eproto__INCLUDED
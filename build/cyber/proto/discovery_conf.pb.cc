@@ -0,0 +1,459 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: discovery_conf.proto
+
+#include "discovery_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class DiscoveryConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<DiscoveryConf>
+      _instance;
+} _DiscoveryConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_discovery_5fconf_2eproto {
+void InitDefaultsDiscoveryConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_DiscoveryConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::DiscoveryConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::DiscoveryConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsDiscoveryConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsDiscoveryConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::DiscoveryConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::DiscoveryConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::DiscoveryConf, snapshot_interval_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::DiscoveryConf, shm_registry_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::DiscoveryConf, registry_interval_ms_),
+  1,
+  2,
+  0,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, sizeof(::apollo::cyber::proto::DiscoveryConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_DiscoveryConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "discovery_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\024discovery_conf.proto\022\022apollo.cyber.pro"
+      "to\"o\n\rDiscoveryConf\022!\n\024snapshot_interval"
+      "_ms\030\001 \001(\r:\003100\022\032\n\014shm_registry\030\002 \001(\010:\004tr"
+      "ue\022\037\n\024registry_interval_ms\030\003 \001(\r:\0015"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 155);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "discovery_conf.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_discovery_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void DiscoveryConf::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DiscoveryConf::kSnapshotIntervalMsFieldNumber;
+const int DiscoveryConf::kShmRegistryFieldNumber;
+const int DiscoveryConf::kRegistryIntervalMsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DiscoveryConf::DiscoveryConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_discovery_5fconf_2eproto::InitDefaultsDiscoveryConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.DiscoveryConf)
+}
+DiscoveryConf::DiscoveryConf(const DiscoveryConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&registry_interval_ms_, &from.registry_interval_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&shm_registry_) -
+    reinterpret_cast<char*>(&registry_interval_ms_)) + sizeof(shm_registry_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.DiscoveryConf)
+}
+
+void DiscoveryConf::SharedCtor() {
+  _cached_size_ = 0;
+  registry_interval_ms_ = 5u;
+  snapshot_interval_ms_ = 100u;
+  shm_registry_ = true;
+}
+
+DiscoveryConf::~DiscoveryConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.DiscoveryConf)
+  SharedDtor();
+}
+
+void DiscoveryConf::SharedDtor() {
+}
+
+void DiscoveryConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DiscoveryConf::descriptor() {
+  ::protobuf_discovery_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_discovery_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DiscoveryConf& DiscoveryConf::default_instance() {
+  ::protobuf_discovery_5fconf_2eproto::InitDefaultsDiscoveryConf();
+  return *internal_default_instance();
+}
+
+DiscoveryConf* DiscoveryConf::New(::google::protobuf::Arena* arena) const {
+  DiscoveryConf* n = new DiscoveryConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DiscoveryConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.DiscoveryConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 7u) {
+    registry_interval_ms_ = 5u;
+    snapshot_interval_ms_ = 100u;
+    shm_registry_ = true;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool DiscoveryConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.DiscoveryConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint32 snapshot_interval_ms = 1 [default = 100];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_snapshot_interval_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &snapshot_interval_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool shm_registry = 2 [default = true];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_shm_registry();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &shm_registry_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 registry_interval_ms = 3 [default = 5];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_registry_interval_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &registry_interval_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.DiscoveryConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.DiscoveryConf)
+  return false;
+#undef DO_
+}
+
+void DiscoveryConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.DiscoveryConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 snapshot_interval_ms = 1 [default = 100];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->snapshot_interval_ms(), output);
+  }
+
+  // optional bool shm_registry = 2 [default = true];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->shm_registry(), output);
+  }
+
+  // optional uint32 registry_interval_ms = 3 [default = 5];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->registry_interval_ms(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.DiscoveryConf)
+}
+
+::google::protobuf::uint8* DiscoveryConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.DiscoveryConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 snapshot_interval_ms = 1 [default = 100];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->snapshot_interval_ms(), target);
+  }
+
+  // optional bool shm_registry = 2 [default = true];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->shm_registry(), target);
+  }
+
+  // optional uint32 registry_interval_ms = 3 [default = 5];
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->registry_interval_ms(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.DiscoveryConf)
+  return target;
+}
+
+size_t DiscoveryConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.DiscoveryConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional uint32 registry_interval_ms = 3 [default = 5];
+    if (has_registry_interval_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->registry_interval_ms());
+    }
+
+    // optional uint32 snapshot_interval_ms = 1 [default = 100];
+    if (has_snapshot_interval_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->snapshot_interval_ms());
+    }
+
+    // optional bool shm_registry = 2 [default = true];
+    if (has_shm_registry()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DiscoveryConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.DiscoveryConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DiscoveryConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DiscoveryConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.DiscoveryConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.DiscoveryConf)
+    MergeFrom(*source);
+  }
+}
+
+void DiscoveryConf::MergeFrom(const DiscoveryConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.DiscoveryConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      registry_interval_ms_ = from.registry_interval_ms_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      snapshot_interval_ms_ = from.snapshot_interval_ms_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      shm_registry_ = from.shm_registry_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void DiscoveryConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.DiscoveryConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DiscoveryConf::CopyFrom(const DiscoveryConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.DiscoveryConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DiscoveryConf::IsInitialized() const {
+  return true;
+}
+
+void DiscoveryConf::Swap(DiscoveryConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DiscoveryConf::InternalSwap(DiscoveryConf* other) {
+  using std::swap;
+  swap(registry_interval_ms_, other->registry_interval_ms_);
+  swap(snapshot_interval_ms_, other->snapshot_interval_ms_);
+  swap(shm_registry_, other->shm_registry_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DiscoveryConf::GetMetadata() const {
+  protobuf_discovery_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_discovery_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,289 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: discovery_conf.proto
+
+#ifndef PROTOBUF_discovery_5fconf_2eproto__INCLUDED
+#define PROTOBUF_discovery_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_discovery_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsDiscoveryConfImpl();
+void InitDefaultsDiscoveryConf();
+inline void InitDefaults() {
+  InitDefaultsDiscoveryConf();
+}
+}  // namespace protobuf_discovery_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class DiscoveryConf;
+class DiscoveryConfDefaultTypeInternal;
+extern DiscoveryConfDefaultTypeInternal _DiscoveryConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class DiscoveryConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.DiscoveryConf) */ {
+ public:
+  DiscoveryConf();
+  virtual ~DiscoveryConf();
+
+  DiscoveryConf(const DiscoveryConf& from);
+
+  inline DiscoveryConf& operator=(const DiscoveryConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DiscoveryConf(DiscoveryConf&& from) noexcept
+    : DiscoveryConf() {
+    *this = ::std::move(from);
+  }
+
+  inline DiscoveryConf& operator=(DiscoveryConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DiscoveryConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DiscoveryConf* internal_default_instance() {
+    return reinterpret_cast<const DiscoveryConf*>(
+               &_DiscoveryConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(DiscoveryConf* other);
+  friend void swap(DiscoveryConf& a, DiscoveryConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DiscoveryConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DiscoveryConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DiscoveryConf& from);
+  void MergeFrom(const DiscoveryConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DiscoveryConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional uint32 registry_interval_ms = 3 [default = 5];
+  bool has_registry_interval_ms() const;
+  void clear_registry_interval_ms();
+  static const int kRegistryIntervalMsFieldNumber = 3;
+  ::google::protobuf::uint32 registry_interval_ms() const;
+  void set_registry_interval_ms(::google::protobuf::uint32 value);
+
+  // optional uint32 snapshot_interval_ms = 1 [default = 100];
+  bool has_snapshot_interval_ms() const;
+  void clear_snapshot_interval_ms();
+  static const int kSnapshotIntervalMsFieldNumber = 1;
+  ::google::protobuf::uint32 snapshot_interval_ms() const;
+  void set_snapshot_interval_ms(::google::protobuf::uint32 value);
+
+  // optional bool shm_registry = 2 [default = true];
+  bool has_shm_registry() const;
+  void clear_shm_registry();
+  static const int kShmRegistryFieldNumber = 2;
+  bool shm_registry() const;
+  void set_shm_registry(bool value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.DiscoveryConf)
+ private:
+  void set_has_snapshot_interval_ms();
+  void clear_has_snapshot_interval_ms();
+  void set_has_shm_registry();
+  void clear_has_shm_registry();
+  void set_has_registry_interval_ms();
+  void clear_has_registry_interval_ms();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 registry_interval_ms_;
+  ::google::protobuf::uint32 snapshot_interval_ms_;
+  bool shm_registry_;
+  friend struct ::protobuf_discovery_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_discovery_5fconf_2eproto::InitDefaultsDiscoveryConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// DiscoveryConf
+
+// optional uint32 snapshot_interval_ms = 1 [default = 100];
+inline bool DiscoveryConf::has_snapshot_interval_ms() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void DiscoveryConf::set_has_snapshot_interval_ms() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void DiscoveryConf::clear_has_snapshot_interval_ms() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void DiscoveryConf::clear_snapshot_interval_ms() {
+  snapshot_interval_ms_ = 100u;
+  clear_has_snapshot_interval_ms();
+}
+inline ::google::protobuf::uint32 DiscoveryConf::snapshot_interval_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.DiscoveryConf.snapshot_interval_ms)
+  return snapshot_interval_ms_;
+}
+inline void DiscoveryConf::set_snapshot_interval_ms(::google::protobuf::uint32 value) {
+  set_has_snapshot_interval_ms();
+  snapshot_interval_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.DiscoveryConf.snapshot_interval_ms)
+}
+
+// optional bool shm_registry = 2 [default = true];
+inline bool DiscoveryConf::has_shm_registry() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void DiscoveryConf::set_has_shm_registry() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void DiscoveryConf::clear_has_shm_registry() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void DiscoveryConf::clear_shm_registry() {
+  shm_registry_ = true;
+  clear_has_shm_registry();
+}
+inline bool DiscoveryConf::shm_registry() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.DiscoveryConf.shm_registry)
+  return shm_registry_;
+}
+inline void DiscoveryConf::set_shm_registry(bool value) {
+  set_has_shm_registry();
+  shm_registry_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.DiscoveryConf.shm_registry)
+}
+
+// optional uint32 registry_interval_ms = 3 [default = 5];
+inline bool DiscoveryConf::has_registry_interval_ms() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void DiscoveryConf::set_has_registry_interval_ms() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void DiscoveryConf::clear_has_registry_interval_ms() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void DiscoveryConf::clear_registry_interval_ms() {
+  registry_interval_ms_ = 5u;
+  clear_has_registry_interval_ms();
+}
+inline ::google::protobuf::uint32 DiscoveryConf::registry_interval_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.DiscoveryConf.registry_interval_ms)
+  return registry_interval_ms_;
+}
+inline void DiscoveryConf::set_registry_interval_ms(::google::protobuf::uint32 value) {
+  set_has_registry_interval_ms();
+  registry_interval_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.DiscoveryConf.registry_interval_ms)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_discovery_5fconf_2eproto__INCLUDED
@@ -0,0 +1,566 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: io_conf.proto
+
+#include "io_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class IoConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<IoConf>
+      _instance;
+} _IoConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_io_5fconf_2eproto {
+void InitDefaultsIoConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_IoConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::IoConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::IoConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsIoConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsIoConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, persistent_poll_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, poller_threads_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, poll_batch_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, backend_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IoConf, uring_entries_),
+  0,
+  3,
+  4,
+  1,
+  2,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, sizeof(::apollo::cyber::proto::IoConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_IoConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "io_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, file_level_enum_descriptors, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\rio_conf.proto\022\022apollo.cyber.proto\"\263\001\n\006"
+      "IoConf\022\036\n\017persistent_poll\030\001 \001(\010:\005false\022\031"
+      "\n\016poller_threads\030\002 \001(\r:\0011\022\033\n\017poll_batch_"
+      "size\030\003 \001(\r:\00232\0225\n\007backend\030\004 \001(\0162\035.apollo"
+      ".cyber.proto.IoBackend:\005EPOLL\022\032\n\ruring_e"
+      "ntries\030\005 \001(\r:\003256*$\n\tIoBackend\022\t\n\005EPOLL\020"
+      "\000\022\014\n\010IO_URING\020\001"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 255);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "io_conf.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_io_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+const ::google::protobuf::EnumDescriptor* IoBackend_descriptor() {
+  protobuf_io_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_io_5fconf_2eproto::file_level_enum_descriptors[0];
+}
+bool IoBackend_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void IoConf::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int IoConf::kPersistentPollFieldNumber;
+const int IoConf::kPollerThreadsFieldNumber;
+const int IoConf::kPollBatchSizeFieldNumber;
+const int IoConf::kBackendFieldNumber;
+const int IoConf::kUringEntriesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+IoConf::IoConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_io_5fconf_2eproto::InitDefaultsIoConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.IoConf)
+}
+IoConf::IoConf(const IoConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&persistent_poll_, &from.persistent_poll_,
+    static_cast<size_t>(reinterpret_cast<char*>(&poll_batch_size_) -
+    reinterpret_cast<char*>(&persistent_poll_)) + sizeof(poll_batch_size_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.IoConf)
+}
+
+void IoConf::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&persistent_poll_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&backend_) -
+      reinterpret_cast<char*>(&persistent_poll_)) + sizeof(backend_));
+  uring_entries_ = 256u;
+  poller_threads_ = 1u;
+  poll_batch_size_ = 32u;
+}
+
+IoConf::~IoConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.IoConf)
+  SharedDtor();
+}
+
+void IoConf::SharedDtor() {
+}
+
+void IoConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* IoConf::descriptor() {
+  ::protobuf_io_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_io_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const IoConf& IoConf::default_instance() {
+  ::protobuf_io_5fconf_2eproto::InitDefaultsIoConf();
+  return *internal_default_instance();
+}
+
+IoConf* IoConf::New(::google::protobuf::Arena* arena) const {
+  IoConf* n = new IoConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void IoConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.IoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 31u) {
+    ::memset(&persistent_poll_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&backend_) -
+        reinterpret_cast<char*>(&persistent_poll_)) + sizeof(backend_));
+    uring_entries_ = 256u;
+    poller_threads_ = 1u;
+    poll_batch_size_ = 32u;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool IoConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.IoConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bool persistent_poll = 1 [default = false];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_persistent_poll();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &persistent_poll_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 poller_threads = 2 [default = 1];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_poller_threads();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &poller_threads_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 poll_batch_size = 3 [default = 32];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_poll_batch_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &poll_batch_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::IoBackend_IsValid(value)) {
+            set_backend(static_cast< ::apollo::cyber::proto::IoBackend >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                4, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 uring_entries = 5 [default = 256];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          set_has_uring_entries();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &uring_entries_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.IoConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.IoConf)
+  return false;
+#undef DO_
+}
+
+void IoConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.IoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool persistent_poll = 1 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->persistent_poll(), output);
+  }
+
+  // optional uint32 poller_threads = 2 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->poller_threads(), output);
+  }
+
+  // optional uint32 poll_batch_size = 3 [default = 32];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->poll_batch_size(), output);
+  }
+
+  // optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->backend(), output);
+  }
+
+  // optional uint32 uring_entries = 5 [default = 256];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->uring_entries(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.IoConf)
+}
+
+::google::protobuf::uint8* IoConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.IoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool persistent_poll = 1 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->persistent_poll(), target);
+  }
+
+  // optional uint32 poller_threads = 2 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->poller_threads(), target);
+  }
+
+  // optional uint32 poll_batch_size = 3 [default = 32];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->poll_batch_size(), target);
+  }
+
+  // optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      4, this->backend(), target);
+  }
+
+  // optional uint32 uring_entries = 5 [default = 256];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->uring_entries(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.IoConf)
+  return target;
+}
+
+size_t IoConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.IoConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 31u) {
+    // optional bool persistent_poll = 1 [default = false];
+    if (has_persistent_poll()) {
+      total_size += 1 + 1;
+    }
+
+    // optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+    if (has_backend()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->backend());
+    }
+
+    // optional uint32 uring_entries = 5 [default = 256];
+    if (has_uring_entries()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->uring_entries());
+    }
+
+    // optional uint32 poller_threads = 2 [default = 1];
+    if (has_poller_threads()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->poller_threads());
+    }
+
+    // optional uint32 poll_batch_size = 3 [default = 32];
+    if (has_poll_batch_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->poll_batch_size());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void IoConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.IoConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const IoConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const IoConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.IoConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.IoConf)
+    MergeFrom(*source);
+  }
+}
+
+void IoConf::MergeFrom(const IoConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.IoConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 31u) {
+    if (cached_has_bits & 0x00000001u) {
+      persistent_poll_ = from.persistent_poll_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      backend_ = from.backend_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      uring_entries_ = from.uring_entries_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      poller_threads_ = from.poller_threads_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      poll_batch_size_ = from.poll_batch_size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void IoConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.IoConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void IoConf::CopyFrom(const IoConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.IoConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IoConf::IsInitialized() const {
+  return true;
+}
+
+void IoConf::Swap(IoConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void IoConf::InternalSwap(IoConf* other) {
+  using std::swap;
+  swap(persistent_poll_, other->persistent_poll_);
+  swap(backend_, other->backend_);
+  swap(uring_entries_, other->uring_entries_);
+  swap(poller_threads_, other->poller_threads_);
+  swap(poll_batch_size_, other->poll_batch_size_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata IoConf::GetMetadata() const {
+  protobuf_io_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_io_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,390 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: io_conf.proto
+
+#ifndef PROTOBUF_io_5fconf_2eproto__INCLUDED
+#define PROTOBUF_io_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_io_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsIoConfImpl();
+void InitDefaultsIoConf();
+inline void InitDefaults() {
+  InitDefaultsIoConf();
+}
+}  // namespace protobuf_io_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class IoConf;
+class IoConfDefaultTypeInternal;
+extern IoConfDefaultTypeInternal _IoConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+enum IoBackend {
+  EPOLL = 0,
+  IO_URING = 1
+};
+bool IoBackend_IsValid(int value);
+const IoBackend IoBackend_MIN = EPOLL;
+const IoBackend IoBackend_MAX = IO_URING;
+const int IoBackend_ARRAYSIZE = IoBackend_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* IoBackend_descriptor();
+inline const ::std::string& IoBackend_Name(IoBackend value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    IoBackend_descriptor(), value);
+}
+inline bool IoBackend_Parse(
+    const ::std::string& name, IoBackend* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<IoBackend>(
+    IoBackend_descriptor(), name, value);
+}
+// ===================================================================
+
+class IoConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.IoConf) */ {
+ public:
+  IoConf();
+  virtual ~IoConf();
+
+  IoConf(const IoConf& from);
+
+  inline IoConf& operator=(const IoConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  IoConf(IoConf&& from) noexcept
+    : IoConf() {
+    *this = ::std::move(from);
+  }
+
+  inline IoConf& operator=(IoConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const IoConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const IoConf* internal_default_instance() {
+    return reinterpret_cast<const IoConf*>(
+               &_IoConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(IoConf* other);
+  friend void swap(IoConf& a, IoConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline IoConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  IoConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const IoConf& from);
+  void MergeFrom(const IoConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(IoConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional bool persistent_poll = 1 [default = false];
+  bool has_persistent_poll() const;
+  void clear_persistent_poll();
+  static const int kPersistentPollFieldNumber = 1;
+  bool persistent_poll() const;
+  void set_persistent_poll(bool value);
+
+  // optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+  bool has_backend() const;
+  void clear_backend();
+  static const int kBackendFieldNumber = 4;
+  ::apollo::cyber::proto::IoBackend backend() const;
+  void set_backend(::apollo::cyber::proto::IoBackend value);
+
+  // optional uint32 uring_entries = 5 [default = 256];
+  bool has_uring_entries() const;
+  void clear_uring_entries();
+  static const int kUringEntriesFieldNumber = 5;
+  ::google::protobuf::uint32 uring_entries() const;
+  void set_uring_entries(::google::protobuf::uint32 value);
+
+  // optional uint32 poller_threads = 2 [default = 1];
+  bool has_poller_threads() const;
+  void clear_poller_threads();
+  static const int kPollerThreadsFieldNumber = 2;
+  ::google::protobuf::uint32 poller_threads() const;
+  void set_poller_threads(::google::protobuf::uint32 value);
+
+  // optional uint32 poll_batch_size = 3 [default = 32];
+  bool has_poll_batch_size() const;
+  void clear_poll_batch_size();
+  static const int kPollBatchSizeFieldNumber = 3;
+  ::google::protobuf::uint32 poll_batch_size() const;
+  void set_poll_batch_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.IoConf)
+ private:
+  void set_has_persistent_poll();
+  void clear_has_persistent_poll();
+  void set_has_poller_threads();
+  void clear_has_poller_threads();
+  void set_has_poll_batch_size();
+  void clear_has_poll_batch_size();
+  void set_has_backend();
+  void clear_has_backend();
+  void set_has_uring_entries();
+  void clear_has_uring_entries();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  bool persistent_poll_;
+  int backend_;
+  ::google::protobuf::uint32 uring_entries_;
+  ::google::protobuf::uint32 poller_threads_;
+  ::google::protobuf::uint32 poll_batch_size_;
+  friend struct ::protobuf_io_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_io_5fconf_2eproto::InitDefaultsIoConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// IoConf
+
+// optional bool persistent_poll = 1 [default = false];
+inline bool IoConf::has_persistent_poll() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void IoConf::set_has_persistent_poll() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void IoConf::clear_has_persistent_poll() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void IoConf::clear_persistent_poll() {
+  persistent_poll_ = false;
+  clear_has_persistent_poll();
+}
+inline bool IoConf::persistent_poll() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.IoConf.persistent_poll)
+  return persistent_poll_;
+}
+inline void IoConf::set_persistent_poll(bool value) {
+  set_has_persistent_poll();
+  persistent_poll_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.IoConf.persistent_poll)
+}
+
+// optional uint32 poller_threads = 2 [default = 1];
+inline bool IoConf::has_poller_threads() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void IoConf::set_has_poller_threads() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void IoConf::clear_has_poller_threads() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void IoConf::clear_poller_threads() {
+  poller_threads_ = 1u;
+  clear_has_poller_threads();
+}
+inline ::google::protobuf::uint32 IoConf::poller_threads() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.IoConf.poller_threads)
+  return poller_threads_;
+}
+inline void IoConf::set_poller_threads(::google::protobuf::uint32 value) {
+  set_has_poller_threads();
+  poller_threads_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.IoConf.poller_threads)
+}
+
+// optional uint32 poll_batch_size = 3 [default = 32];
+inline bool IoConf::has_poll_batch_size() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void IoConf::set_has_poll_batch_size() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void IoConf::clear_has_poll_batch_size() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void IoConf::clear_poll_batch_size() {
+  poll_batch_size_ = 32u;
+  clear_has_poll_batch_size();
+}
+inline ::google::protobuf::uint32 IoConf::poll_batch_size() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.IoConf.poll_batch_size)
+  return poll_batch_size_;
+}
+inline void IoConf::set_poll_batch_size(::google::protobuf::uint32 value) {
+  set_has_poll_batch_size();
+  poll_batch_size_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.IoConf.poll_batch_size)
+}
+
+// optional .apollo.cyber.proto.IoBackend backend = 4 [default = EPOLL];
+inline bool IoConf::has_backend() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void IoConf::set_has_backend() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void IoConf::clear_has_backend() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void IoConf::clear_backend() {
+  backend_ = 0;
+  clear_has_backend();
+}
+inline ::apollo::cyber::proto::IoBackend IoConf::backend() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.IoConf.backend)
+  return static_cast< ::apollo::cyber::proto::IoBackend >(backend_);
+}
+inline void IoConf::set_backend(::apollo::cyber::proto::IoBackend value) {
+  assert(::apollo::cyber::proto::IoBackend_IsValid(value));
+  set_has_backend();
+  backend_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.IoConf.backend)
+}
+
+// optional uint32 uring_entries = 5 [default = 256];
+inline bool IoConf::has_uring_entries() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void IoConf::set_has_uring_entries() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void IoConf::clear_has_uring_entries() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void IoConf::clear_uring_entries() {
+  uring_entries_ = 256u;
+  clear_has_uring_entries();
+}
+inline ::google::protobuf::uint32 IoConf::uring_entries() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.IoConf.uring_entries)
+  return uring_entries_;
+}
+inline void IoConf::set_uring_entries(::google::protobuf::uint32 value) {
+  set_has_uring_entries();
+  uring_entries_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.IoConf.uring_entries)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+namespace google {
+namespace protobuf {
+
+template <> struct is_proto_enum< ::apollo::cyber::proto::IoBackend> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::apollo::cyber::proto::IoBackend>() {
+  return ::apollo::cyber::proto::IoBackend_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_io_5fconf_2eproto__INCLUDED
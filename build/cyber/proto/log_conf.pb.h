@@ -0,0 +1,491 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: log_conf.proto
+
+#ifndef PROTOBUF_log_5fconf_2eproto__INCLUDED
+#define PROTOBUF_log_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_log_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[2];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsLogModuleConfImpl();
+void InitDefaultsLogModuleConf();
+void InitDefaultsLogConfImpl();
+void InitDefaultsLogConf();
+inline void InitDefaults() {
+  InitDefaultsLogModuleConf();
+  InitDefaultsLogConf();
+}
+}  // namespace protobuf_log_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class LogConf;
+class LogConfDefaultTypeInternal;
+extern LogConfDefaultTypeInternal _LogConf_default_instance_;
+class LogModuleConf;
+class LogModuleConfDefaultTypeInternal;
+extern LogModuleConfDefaultTypeInternal _LogModuleConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class LogModuleConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.LogModuleConf) */ {
+ public:
+  LogModuleConf();
+  virtual ~LogModuleConf();
+
+  LogModuleConf(const LogModuleConf& from);
+
+  inline LogModuleConf& operator=(const LogModuleConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LogModuleConf(LogModuleConf&& from) noexcept
+    : LogModuleConf() {
+    *this = ::std::move(from);
+  }
+
+  inline LogModuleConf& operator=(LogModuleConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LogModuleConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const LogModuleConf* internal_default_instance() {
+    return reinterpret_cast<const LogModuleConf*>(
+               &_LogModuleConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(LogModuleConf* other);
+  friend void swap(LogModuleConf& a, LogModuleConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LogModuleConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LogModuleConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LogModuleConf& from);
+  void MergeFrom(const LogModuleConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LogModuleConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string name = 1;
+  bool has_name() const;
+  void clear_name();
+  static const int kNameFieldNumber = 1;
+  const ::std::string& name() const;
+  void set_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_name(::std::string&& value);
+  #endif
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  ::std::string* mutable_name();
+  ::std::string* release_name();
+  void set_allocated_name(::std::string* name);
+
+  // optional uint32 rate_limit = 2;
+  bool has_rate_limit() const;
+  void clear_rate_limit();
+  static const int kRateLimitFieldNumber = 2;
+  ::google::protobuf::uint32 rate_limit() const;
+  void set_rate_limit(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.LogModuleConf)
+ private:
+  void set_has_name();
+  void clear_has_name();
+  void set_has_rate_limit();
+  void clear_has_rate_limit();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::uint32 rate_limit_;
+  friend struct ::protobuf_log_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_log_5fconf_2eproto::InitDefaultsLogModuleConfImpl();
+};
+// -------------------------------------------------------------------
+
+class LogConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.LogConf) */ {
+ public:
+  LogConf();
+  virtual ~LogConf();
+
+  LogConf(const LogConf& from);
+
+  inline LogConf& operator=(const LogConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LogConf(LogConf&& from) noexcept
+    : LogConf() {
+    *this = ::std::move(from);
+  }
+
+  inline LogConf& operator=(LogConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LogConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const LogConf* internal_default_instance() {
+    return reinterpret_cast<const LogConf*>(
+               &_LogConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    1;
+
+  void Swap(LogConf* other);
+  friend void swap(LogConf& a, LogConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LogConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LogConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LogConf& from);
+  void MergeFrom(const LogConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LogConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .apollo.cyber.proto.LogModuleConf module_conf = 2;
+  int module_conf_size() const;
+  void clear_module_conf();
+  static const int kModuleConfFieldNumber = 2;
+  const ::apollo::cyber::proto::LogModuleConf& module_conf(int index) const;
+  ::apollo::cyber::proto::LogModuleConf* mutable_module_conf(int index);
+  ::apollo::cyber::proto::LogModuleConf* add_module_conf();
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::LogModuleConf >*
+      mutable_module_conf();
+  const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::LogModuleConf >&
+      module_conf() const;
+
+  // optional uint32 rate_limit = 1 [default = 0];
+  bool has_rate_limit() const;
+  void clear_rate_limit();
+  static const int kRateLimitFieldNumber = 1;
+  ::google::protobuf::uint32 rate_limit() const;
+  void set_rate_limit(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.LogConf)
+ private:
+  void set_has_rate_limit();
+  void clear_has_rate_limit();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::LogModuleConf > module_conf_;
+  ::google::protobuf::uint32 rate_limit_;
+  friend struct ::protobuf_log_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_log_5fconf_2eproto::InitDefaultsLogConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogModuleConf
+
+// optional string name = 1;
+inline bool LogModuleConf::has_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void LogModuleConf::set_has_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void LogModuleConf::clear_has_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void LogModuleConf::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_name();
+}
+inline const ::std::string& LogModuleConf::name() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LogModuleConf.name)
+  return name_.GetNoArena();
+}
+inline void LogModuleConf::set_name(const ::std::string& value) {
+  set_has_name();
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LogModuleConf.name)
+}
+#if LANG_CXX11
+inline void LogModuleConf::set_name(::std::string&& value) {
+  set_has_name();
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:apollo.cyber.proto.LogModuleConf.name)
+}
+#endif
+inline void LogModuleConf::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_name();
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:apollo.cyber.proto.LogModuleConf.name)
+}
+inline void LogModuleConf::set_name(const char* value, size_t size) {
+  set_has_name();
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:apollo.cyber.proto.LogModuleConf.name)
+}
+inline ::std::string* LogModuleConf::mutable_name() {
+  set_has_name();
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.LogModuleConf.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LogModuleConf::release_name() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.LogModuleConf.name)
+  clear_has_name();
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LogModuleConf::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    set_has_name();
+  } else {
+    clear_has_name();
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.LogModuleConf.name)
+}
+
+// optional uint32 rate_limit = 2;
+inline bool LogModuleConf::has_rate_limit() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void LogModuleConf::set_has_rate_limit() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void LogModuleConf::clear_has_rate_limit() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void LogModuleConf::clear_rate_limit() {
+  rate_limit_ = 0u;
+  clear_has_rate_limit();
+}
+inline ::google::protobuf::uint32 LogModuleConf::rate_limit() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LogModuleConf.rate_limit)
+  return rate_limit_;
+}
+inline void LogModuleConf::set_rate_limit(::google::protobuf::uint32 value) {
+  set_has_rate_limit();
+  rate_limit_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LogModuleConf.rate_limit)
+}
+
+// -------------------------------------------------------------------
+
+// LogConf
+
+// optional uint32 rate_limit = 1 [default = 0];
+inline bool LogConf::has_rate_limit() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void LogConf::set_has_rate_limit() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void LogConf::clear_has_rate_limit() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void LogConf::clear_rate_limit() {
+  rate_limit_ = 0u;
+  clear_has_rate_limit();
+}
+inline ::google::protobuf::uint32 LogConf::rate_limit() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LogConf.rate_limit)
+  return rate_limit_;
+}
+inline void LogConf::set_rate_limit(::google::protobuf::uint32 value) {
+  set_has_rate_limit();
+  rate_limit_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LogConf.rate_limit)
+}
+
+// repeated .apollo.cyber.proto.LogModuleConf module_conf = 2;
+inline int LogConf::module_conf_size() const {
+  return module_conf_.size();
+}
+inline void LogConf::clear_module_conf() {
+  module_conf_.Clear();
+}
+inline const ::apollo::cyber::proto::LogModuleConf& LogConf::module_conf(int index) const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LogConf.module_conf)
+  return module_conf_.Get(index);
+}
+inline ::apollo::cyber::proto::LogModuleConf* LogConf::mutable_module_conf(int index) {
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.LogConf.module_conf)
+  return module_conf_.Mutable(index);
+}
+inline ::apollo::cyber::proto::LogModuleConf* LogConf::add_module_conf() {
+  // @@protoc_insertion_point(field_add:apollo.cyber.proto.LogConf.module_conf)
+  return module_conf_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::LogModuleConf >*
+LogConf::mutable_module_conf() {
+  // @@protoc_insertion_point(field_mutable_list:apollo.cyber.proto.LogConf.module_conf)
+  return &module_conf_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::LogModuleConf >&
+LogConf::module_conf() const {
+  // @@protoc_insertion_point(field_list:apollo.cyber.proto.LogConf.module_conf)
+  return module_conf_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_log_5fconf_2eproto__INCLUDED
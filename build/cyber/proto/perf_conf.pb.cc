@@ -0,0 +1,1057 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: perf_conf.proto
+
+#include "perf_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class LatencyConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<LatencyConf>
+      _instance;
+} _LatencyConf_default_instance_;
+class PerfConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<PerfConf>
+      _instance;
+} _PerfConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_perf_5fconf_2eproto {
+void InitDefaultsLatencyConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::apollo::cyber::proto::LatencyConf::_default_export_dir_.DefaultConstruct();
+  *::apollo::cyber::proto::LatencyConf::_default_export_dir_.get_mutable() = ::std::string("/tmp/cyber_latency", 18);
+  ::google::protobuf::internal::OnShutdownDestroyString(
+      ::apollo::cyber::proto::LatencyConf::_default_export_dir_.get_mutable());
+  {
+    void* ptr = &::apollo::cyber::proto::_LatencyConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::LatencyConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::LatencyConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsLatencyConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsLatencyConfImpl);
+}
+
+void InitDefaultsPerfConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_perf_5fconf_2eproto::InitDefaultsLatencyConf();
+  {
+    void* ptr = &::apollo::cyber::proto::_PerfConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::PerfConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::PerfConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsPerfConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsPerfConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[2];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::LatencyConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::LatencyConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::LatencyConf, enable_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::LatencyConf, export_dir_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::LatencyConf, export_interval_ms_),
+  1,
+  0,
+  2,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, enable_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, flight_recorder_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, flight_recorder_seconds_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, ring_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, dump_signal_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::PerfConf, latency_conf_),
+  1,
+  3,
+  2,
+  4,
+  5,
+  6,
+  0,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, sizeof(::apollo::cyber::proto::LatencyConf)},
+  { 11, 23, sizeof(::apollo::cyber::proto::PerfConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_LatencyConf_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_PerfConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "perf_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, file_level_enum_descriptors, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 2);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\017perf_conf.proto\022\022apollo.cyber.proto\"n\n"
+      "\013LatencyConf\022\025\n\006enable\030\001 \001(\010:\005false\022&\n\ne"
+      "xport_dir\030\002 \001(\t:\022/tmp/cyber_latency\022 \n\022e"
+      "xport_interval_ms\030\003 \001(\r:\0041000\"\200\002\n\010PerfCo"
+      "nf\022\025\n\006enable\030\001 \001(\010:\005false\022/\n\004type\030\002 \001(\0162"
+      "\034.apollo.cyber.proto.PerfType:\003ALL\022\036\n\017fl"
+      "ight_recorder\030\003 \001(\010:\005false\022#\n\027flight_rec"
+      "order_seconds\030\004 \001(\r:\00210\022\027\n\tring_size\030\005 \001"
+      "(\r:\0048192\022\027\n\013dump_signal\030\006 \001(\005:\00212\0225\n\014lat"
+      "ency_conf\030\007 \001(\0132\037.apollo.cyber.proto.Lat"
+      "encyConf*=\n\010PerfType\022\t\n\005SCHED\020\001\022\r\n\tTRANS"
+      "PORT\020\002\022\016\n\nDATA_CACHE\020\003\022\007\n\003ALL\020\004"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 471);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "perf_conf.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_perf_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+const ::google::protobuf::EnumDescriptor* PerfType_descriptor() {
+  protobuf_perf_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_perf_5fconf_2eproto::file_level_enum_descriptors[0];
+}
+bool PerfType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void LatencyConf::InitAsDefaultInstance() {
+}
+::google::protobuf::internal::ExplicitlyConstructed< ::std::string> LatencyConf::_default_export_dir_;
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LatencyConf::kEnableFieldNumber;
+const int LatencyConf::kExportDirFieldNumber;
+const int LatencyConf::kExportIntervalMsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+LatencyConf::LatencyConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_perf_5fconf_2eproto::InitDefaultsLatencyConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.LatencyConf)
+}
+LatencyConf::LatencyConf(const LatencyConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  export_dir_.UnsafeSetDefault(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+  if (from.has_export_dir()) {
+    export_dir_.AssignWithDefault(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), from.export_dir_);
+  }
+  ::memcpy(&enable_, &from.enable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&export_interval_ms_) -
+    reinterpret_cast<char*>(&enable_)) + sizeof(export_interval_ms_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.LatencyConf)
+}
+
+void LatencyConf::SharedCtor() {
+  _cached_size_ = 0;
+  export_dir_.UnsafeSetDefault(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+  enable_ = false;
+  export_interval_ms_ = 1000u;
+}
+
+LatencyConf::~LatencyConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.LatencyConf)
+  SharedDtor();
+}
+
+void LatencyConf::SharedDtor() {
+  export_dir_.DestroyNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+}
+
+void LatencyConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LatencyConf::descriptor() {
+  ::protobuf_perf_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_perf_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const LatencyConf& LatencyConf::default_instance() {
+  ::protobuf_perf_5fconf_2eproto::InitDefaultsLatencyConf();
+  return *internal_default_instance();
+}
+
+LatencyConf* LatencyConf::New(::google::protobuf::Arena* arena) const {
+  LatencyConf* n = new LatencyConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void LatencyConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.LatencyConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(!export_dir_.IsDefault(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get()));
+    (*export_dir_.UnsafeRawStringPointer())->assign(*&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+  }
+  if (cached_has_bits & 6u) {
+    enable_ = false;
+    export_interval_ms_ = 1000u;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool LatencyConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.LatencyConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bool enable = 1 [default = false];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_enable();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &enable_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_export_dir()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->export_dir().data(), static_cast<int>(this->export_dir().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.LatencyConf.export_dir");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 export_interval_ms = 3 [default = 1000];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_export_interval_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &export_interval_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.LatencyConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.LatencyConf)
+  return false;
+#undef DO_
+}
+
+void LatencyConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.LatencyConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->enable(), output);
+  }
+
+  // optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->export_dir().data(), static_cast<int>(this->export_dir().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.LatencyConf.export_dir");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->export_dir(), output);
+  }
+
+  // optional uint32 export_interval_ms = 3 [default = 1000];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->export_interval_ms(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.LatencyConf)
+}
+
+::google::protobuf::uint8* LatencyConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.LatencyConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->enable(), target);
+  }
+
+  // optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->export_dir().data(), static_cast<int>(this->export_dir().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.LatencyConf.export_dir");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->export_dir(), target);
+  }
+
+  // optional uint32 export_interval_ms = 3 [default = 1000];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->export_interval_ms(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.LatencyConf)
+  return target;
+}
+
+size_t LatencyConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.LatencyConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+    if (has_export_dir()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->export_dir());
+    }
+
+    // optional bool enable = 1 [default = false];
+    if (has_enable()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 export_interval_ms = 3 [default = 1000];
+    if (has_export_interval_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->export_interval_ms());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LatencyConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.LatencyConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const LatencyConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LatencyConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.LatencyConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.LatencyConf)
+    MergeFrom(*source);
+  }
+}
+
+void LatencyConf::MergeFrom(const LatencyConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.LatencyConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_export_dir();
+      export_dir_.AssignWithDefault(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), from.export_dir_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      enable_ = from.enable_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      export_interval_ms_ = from.export_interval_ms_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void LatencyConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.LatencyConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LatencyConf::CopyFrom(const LatencyConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.LatencyConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyConf::IsInitialized() const {
+  return true;
+}
+
+void LatencyConf::Swap(LatencyConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LatencyConf::InternalSwap(LatencyConf* other) {
+  using std::swap;
+  export_dir_.Swap(&other->export_dir_);
+  swap(enable_, other->enable_);
+  swap(export_interval_ms_, other->export_interval_ms_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LatencyConf::GetMetadata() const {
+  protobuf_perf_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_perf_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void PerfConf::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_PerfConf_default_instance_._instance.get_mutable()->latency_conf_ = const_cast< ::apollo::cyber::proto::LatencyConf*>(
+      ::apollo::cyber::proto::LatencyConf::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int PerfConf::kEnableFieldNumber;
+const int PerfConf::kTypeFieldNumber;
+const int PerfConf::kFlightRecorderFieldNumber;
+const int PerfConf::kFlightRecorderSecondsFieldNumber;
+const int PerfConf::kRingSizeFieldNumber;
+const int PerfConf::kDumpSignalFieldNumber;
+const int PerfConf::kLatencyConfFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+PerfConf::PerfConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_perf_5fconf_2eproto::InitDefaultsPerfConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.PerfConf)
+}
+PerfConf::PerfConf(const PerfConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_latency_conf()) {
+    latency_conf_ = new ::apollo::cyber::proto::LatencyConf(*from.latency_conf_);
+  } else {
+    latency_conf_ = NULL;
+  }
+  ::memcpy(&enable_, &from.enable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&dump_signal_) -
+    reinterpret_cast<char*>(&enable_)) + sizeof(dump_signal_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.PerfConf)
+}
+
+void PerfConf::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&latency_conf_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&flight_recorder_) -
+      reinterpret_cast<char*>(&latency_conf_)) + sizeof(flight_recorder_));
+  type_ = 4;
+  flight_recorder_seconds_ = 10u;
+  ring_size_ = 8192u;
+  dump_signal_ = 12;
+}
+
+PerfConf::~PerfConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.PerfConf)
+  SharedDtor();
+}
+
+void PerfConf::SharedDtor() {
+  if (this != internal_default_instance()) delete latency_conf_;
+}
+
+void PerfConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PerfConf::descriptor() {
+  ::protobuf_perf_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_perf_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const PerfConf& PerfConf::default_instance() {
+  ::protobuf_perf_5fconf_2eproto::InitDefaultsPerfConf();
+  return *internal_default_instance();
+}
+
+PerfConf* PerfConf::New(::google::protobuf::Arena* arena) const {
+  PerfConf* n = new PerfConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void PerfConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.PerfConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(latency_conf_ != NULL);
+    latency_conf_->Clear();
+  }
+  ::memset(&enable_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&flight_recorder_) -
+      reinterpret_cast<char*>(&enable_)) + sizeof(flight_recorder_));
+  if (cached_has_bits & 120u) {
+    type_ = 4;
+    flight_recorder_seconds_ = 10u;
+    ring_size_ = 8192u;
+    dump_signal_ = 12;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool PerfConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.PerfConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bool enable = 1 [default = false];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_enable();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &enable_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::PerfType_IsValid(value)) {
+            set_type(static_cast< ::apollo::cyber::proto::PerfType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                2, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool flight_recorder = 3 [default = false];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_flight_recorder();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &flight_recorder_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 flight_recorder_seconds = 4 [default = 10];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_flight_recorder_seconds();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &flight_recorder_seconds_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 ring_size = 5 [default = 8192];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          set_has_ring_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &ring_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional int32 dump_signal = 6 [default = 12];
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+          set_has_dump_signal();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &dump_signal_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_latency_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.PerfConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.PerfConf)
+  return false;
+#undef DO_
+}
+
+void PerfConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.PerfConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->enable(), output);
+  }
+
+  // optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->type(), output);
+  }
+
+  // optional bool flight_recorder = 3 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->flight_recorder(), output);
+  }
+
+  // optional uint32 flight_recorder_seconds = 4 [default = 10];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->flight_recorder_seconds(), output);
+  }
+
+  // optional uint32 ring_size = 5 [default = 8192];
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->ring_size(), output);
+  }
+
+  // optional int32 dump_signal = 6 [default = 12];
+  if (cached_has_bits & 0x00000040u) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->dump_signal(), output);
+  }
+
+  // optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->latency_conf_, output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.PerfConf)
+}
+
+::google::protobuf::uint8* PerfConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.PerfConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->enable(), target);
+  }
+
+  // optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->type(), target);
+  }
+
+  // optional bool flight_recorder = 3 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->flight_recorder(), target);
+  }
+
+  // optional uint32 flight_recorder_seconds = 4 [default = 10];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->flight_recorder_seconds(), target);
+  }
+
+  // optional uint32 ring_size = 5 [default = 8192];
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->ring_size(), target);
+  }
+
+  // optional int32 dump_signal = 6 [default = 12];
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->dump_signal(), target);
+  }
+
+  // optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, *this->latency_conf_, deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.PerfConf)
+  return target;
+}
+
+size_t PerfConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.PerfConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 127u) {
+    // optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+    if (has_latency_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->latency_conf_);
+    }
+
+    // optional bool enable = 1 [default = false];
+    if (has_enable()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool flight_recorder = 3 [default = false];
+    if (has_flight_recorder()) {
+      total_size += 1 + 1;
+    }
+
+    // optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+    if (has_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    }
+
+    // optional uint32 flight_recorder_seconds = 4 [default = 10];
+    if (has_flight_recorder_seconds()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->flight_recorder_seconds());
+    }
+
+    // optional uint32 ring_size = 5 [default = 8192];
+    if (has_ring_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->ring_size());
+    }
+
+    // optional int32 dump_signal = 6 [default = 12];
+    if (has_dump_signal()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->dump_signal());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PerfConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.PerfConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PerfConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PerfConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.PerfConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.PerfConf)
+    MergeFrom(*source);
+  }
+}
+
+void PerfConf::MergeFrom(const PerfConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.PerfConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 127u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_latency_conf()->::apollo::cyber::proto::LatencyConf::MergeFrom(from.latency_conf());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      enable_ = from.enable_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      flight_recorder_ = from.flight_recorder_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      type_ = from.type_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      flight_recorder_seconds_ = from.flight_recorder_seconds_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      ring_size_ = from.ring_size_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      dump_signal_ = from.dump_signal_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void PerfConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.PerfConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PerfConf::CopyFrom(const PerfConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.PerfConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PerfConf::IsInitialized() const {
+  return true;
+}
+
+void PerfConf::Swap(PerfConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void PerfConf::InternalSwap(PerfConf* other) {
+  using std::swap;
+  swap(latency_conf_, other->latency_conf_);
+  swap(enable_, other->enable_);
+  swap(flight_recorder_, other->flight_recorder_);
+  swap(type_, other->type_);
+  swap(flight_recorder_seconds_, other->flight_recorder_seconds_);
+  swap(ring_size_, other->ring_size_);
+  swap(dump_signal_, other->dump_signal_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata PerfConf::GetMetadata() const {
+  protobuf_perf_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_perf_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,754 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: perf_conf.proto
+
+#ifndef PROTOBUF_perf_5fconf_2eproto__INCLUDED
+#define PROTOBUF_perf_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_perf_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[2];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsLatencyConfImpl();
+void InitDefaultsLatencyConf();
+void InitDefaultsPerfConfImpl();
+void InitDefaultsPerfConf();
+inline void InitDefaults() {
+  InitDefaultsLatencyConf();
+  InitDefaultsPerfConf();
+}
+}  // namespace protobuf_perf_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class LatencyConf;
+class LatencyConfDefaultTypeInternal;
+extern LatencyConfDefaultTypeInternal _LatencyConf_default_instance_;
+class PerfConf;
+class PerfConfDefaultTypeInternal;
+extern PerfConfDefaultTypeInternal _PerfConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+enum PerfType {
+  SCHED = 1,
+  TRANSPORT = 2,
+  DATA_CACHE = 3,
+  ALL = 4
+};
+bool PerfType_IsValid(int value);
+const PerfType PerfType_MIN = SCHED;
+const PerfType PerfType_MAX = ALL;
+const int PerfType_ARRAYSIZE = PerfType_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* PerfType_descriptor();
+inline const ::std::string& PerfType_Name(PerfType value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    PerfType_descriptor(), value);
+}
+inline bool PerfType_Parse(
+    const ::std::string& name, PerfType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<PerfType>(
+    PerfType_descriptor(), name, value);
+}
+// ===================================================================
+
+class LatencyConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.LatencyConf) */ {
+ public:
+  LatencyConf();
+  virtual ~LatencyConf();
+
+  LatencyConf(const LatencyConf& from);
+
+  inline LatencyConf& operator=(const LatencyConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LatencyConf(LatencyConf&& from) noexcept
+    : LatencyConf() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyConf& operator=(LatencyConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LatencyConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const LatencyConf* internal_default_instance() {
+    return reinterpret_cast<const LatencyConf*>(
+               &_LatencyConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(LatencyConf* other);
+  friend void swap(LatencyConf& a, LatencyConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LatencyConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LatencyConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LatencyConf& from);
+  void MergeFrom(const LatencyConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LatencyConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+  bool has_export_dir() const;
+  void clear_export_dir();
+  static const int kExportDirFieldNumber = 2;
+  const ::std::string& export_dir() const;
+  void set_export_dir(const ::std::string& value);
+  #if LANG_CXX11
+  void set_export_dir(::std::string&& value);
+  #endif
+  void set_export_dir(const char* value);
+  void set_export_dir(const char* value, size_t size);
+  ::std::string* mutable_export_dir();
+  ::std::string* release_export_dir();
+  void set_allocated_export_dir(::std::string* export_dir);
+
+  // optional bool enable = 1 [default = false];
+  bool has_enable() const;
+  void clear_enable();
+  static const int kEnableFieldNumber = 1;
+  bool enable() const;
+  void set_enable(bool value);
+
+  // optional uint32 export_interval_ms = 3 [default = 1000];
+  bool has_export_interval_ms() const;
+  void clear_export_interval_ms();
+  static const int kExportIntervalMsFieldNumber = 3;
+  ::google::protobuf::uint32 export_interval_ms() const;
+  void set_export_interval_ms(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.LatencyConf)
+ private:
+  void set_has_enable();
+  void clear_has_enable();
+  void set_has_export_dir();
+  void clear_has_export_dir();
+  void set_has_export_interval_ms();
+  void clear_has_export_interval_ms();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  static ::google::protobuf::internal::ExplicitlyConstructed< ::std::string> _default_export_dir_;
+  ::google::protobuf::internal::ArenaStringPtr export_dir_;
+  bool enable_;
+  ::google::protobuf::uint32 export_interval_ms_;
+  friend struct ::protobuf_perf_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_perf_5fconf_2eproto::InitDefaultsLatencyConfImpl();
+};
+// -------------------------------------------------------------------
+
+class PerfConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.PerfConf) */ {
+ public:
+  PerfConf();
+  virtual ~PerfConf();
+
+  PerfConf(const PerfConf& from);
+
+  inline PerfConf& operator=(const PerfConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  PerfConf(PerfConf&& from) noexcept
+    : PerfConf() {
+    *this = ::std::move(from);
+  }
+
+  inline PerfConf& operator=(PerfConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PerfConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PerfConf* internal_default_instance() {
+    return reinterpret_cast<const PerfConf*>(
+               &_PerfConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    1;
+
+  void Swap(PerfConf* other);
+  friend void swap(PerfConf& a, PerfConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PerfConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  PerfConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const PerfConf& from);
+  void MergeFrom(const PerfConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(PerfConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+  bool has_latency_conf() const;
+  void clear_latency_conf();
+  static const int kLatencyConfFieldNumber = 7;
+  const ::apollo::cyber::proto::LatencyConf& latency_conf() const;
+  ::apollo::cyber::proto::LatencyConf* release_latency_conf();
+  ::apollo::cyber::proto::LatencyConf* mutable_latency_conf();
+  void set_allocated_latency_conf(::apollo::cyber::proto::LatencyConf* latency_conf);
+
+  // optional bool enable = 1 [default = false];
+  bool has_enable() const;
+  void clear_enable();
+  static const int kEnableFieldNumber = 1;
+  bool enable() const;
+  void set_enable(bool value);
+
+  // optional bool flight_recorder = 3 [default = false];
+  bool has_flight_recorder() const;
+  void clear_flight_recorder();
+  static const int kFlightRecorderFieldNumber = 3;
+  bool flight_recorder() const;
+  void set_flight_recorder(bool value);
+
+  // optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+  bool has_type() const;
+  void clear_type();
+  static const int kTypeFieldNumber = 2;
+  ::apollo::cyber::proto::PerfType type() const;
+  void set_type(::apollo::cyber::proto::PerfType value);
+
+  // optional uint32 flight_recorder_seconds = 4 [default = 10];
+  bool has_flight_recorder_seconds() const;
+  void clear_flight_recorder_seconds();
+  static const int kFlightRecorderSecondsFieldNumber = 4;
+  ::google::protobuf::uint32 flight_recorder_seconds() const;
+  void set_flight_recorder_seconds(::google::protobuf::uint32 value);
+
+  // optional uint32 ring_size = 5 [default = 8192];
+  bool has_ring_size() const;
+  void clear_ring_size();
+  static const int kRingSizeFieldNumber = 5;
+  ::google::protobuf::uint32 ring_size() const;
+  void set_ring_size(::google::protobuf::uint32 value);
+
+  // optional int32 dump_signal = 6 [default = 12];
+  bool has_dump_signal() const;
+  void clear_dump_signal();
+  static const int kDumpSignalFieldNumber = 6;
+  ::google::protobuf::int32 dump_signal() const;
+  void set_dump_signal(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.PerfConf)
+ private:
+  void set_has_enable();
+  void clear_has_enable();
+  void set_has_type();
+  void clear_has_type();
+  void set_has_flight_recorder();
+  void clear_has_flight_recorder();
+  void set_has_flight_recorder_seconds();
+  void clear_has_flight_recorder_seconds();
+  void set_has_ring_size();
+  void clear_has_ring_size();
+  void set_has_dump_signal();
+  void clear_has_dump_signal();
+  void set_has_latency_conf();
+  void clear_has_latency_conf();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::apollo::cyber::proto::LatencyConf* latency_conf_;
+  bool enable_;
+  bool flight_recorder_;
+  int type_;
+  ::google::protobuf::uint32 flight_recorder_seconds_;
+  ::google::protobuf::uint32 ring_size_;
+  ::google::protobuf::int32 dump_signal_;
+  friend struct ::protobuf_perf_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_perf_5fconf_2eproto::InitDefaultsPerfConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LatencyConf
+
+// optional bool enable = 1 [default = false];
+inline bool LatencyConf::has_enable() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void LatencyConf::set_has_enable() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void LatencyConf::clear_has_enable() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void LatencyConf::clear_enable() {
+  enable_ = false;
+  clear_has_enable();
+}
+inline bool LatencyConf::enable() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LatencyConf.enable)
+  return enable_;
+}
+inline void LatencyConf::set_enable(bool value) {
+  set_has_enable();
+  enable_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LatencyConf.enable)
+}
+
+// optional string export_dir = 2 [default = "/tmp/cyber_latency"];
+inline bool LatencyConf::has_export_dir() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void LatencyConf::set_has_export_dir() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void LatencyConf::clear_has_export_dir() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void LatencyConf::clear_export_dir() {
+  export_dir_.ClearToDefaultNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+  clear_has_export_dir();
+}
+inline const ::std::string& LatencyConf::export_dir() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LatencyConf.export_dir)
+  return export_dir_.GetNoArena();
+}
+inline void LatencyConf::set_export_dir(const ::std::string& value) {
+  set_has_export_dir();
+  export_dir_.SetNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), value);
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LatencyConf.export_dir)
+}
+#if LANG_CXX11
+inline void LatencyConf::set_export_dir(::std::string&& value) {
+  set_has_export_dir();
+  export_dir_.SetNoArena(
+    &::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:apollo.cyber.proto.LatencyConf.export_dir)
+}
+#endif
+inline void LatencyConf::set_export_dir(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_export_dir();
+  export_dir_.SetNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:apollo.cyber.proto.LatencyConf.export_dir)
+}
+inline void LatencyConf::set_export_dir(const char* value, size_t size) {
+  set_has_export_dir();
+  export_dir_.SetNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:apollo.cyber.proto.LatencyConf.export_dir)
+}
+inline ::std::string* LatencyConf::mutable_export_dir() {
+  set_has_export_dir();
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.LatencyConf.export_dir)
+  return export_dir_.MutableNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+}
+inline ::std::string* LatencyConf::release_export_dir() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.LatencyConf.export_dir)
+  clear_has_export_dir();
+  return export_dir_.ReleaseNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get());
+}
+inline void LatencyConf::set_allocated_export_dir(::std::string* export_dir) {
+  if (export_dir != NULL) {
+    set_has_export_dir();
+  } else {
+    clear_has_export_dir();
+  }
+  export_dir_.SetAllocatedNoArena(&::apollo::cyber::proto::LatencyConf::_default_export_dir_.get(), export_dir);
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.LatencyConf.export_dir)
+}
+
+// optional uint32 export_interval_ms = 3 [default = 1000];
+inline bool LatencyConf::has_export_interval_ms() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void LatencyConf::set_has_export_interval_ms() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void LatencyConf::clear_has_export_interval_ms() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void LatencyConf::clear_export_interval_ms() {
+  export_interval_ms_ = 1000u;
+  clear_has_export_interval_ms();
+}
+inline ::google::protobuf::uint32 LatencyConf::export_interval_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.LatencyConf.export_interval_ms)
+  return export_interval_ms_;
+}
+inline void LatencyConf::set_export_interval_ms(::google::protobuf::uint32 value) {
+  set_has_export_interval_ms();
+  export_interval_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.LatencyConf.export_interval_ms)
+}
+
+// -------------------------------------------------------------------
+
+// PerfConf
+
+// optional bool enable = 1 [default = false];
+inline bool PerfConf::has_enable() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void PerfConf::set_has_enable() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void PerfConf::clear_has_enable() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void PerfConf::clear_enable() {
+  enable_ = false;
+  clear_has_enable();
+}
+inline bool PerfConf::enable() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.enable)
+  return enable_;
+}
+inline void PerfConf::set_enable(bool value) {
+  set_has_enable();
+  enable_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.enable)
+}
+
+// optional .apollo.cyber.proto.PerfType type = 2 [default = ALL];
+inline bool PerfConf::has_type() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void PerfConf::set_has_type() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void PerfConf::clear_has_type() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void PerfConf::clear_type() {
+  type_ = 4;
+  clear_has_type();
+}
+inline ::apollo::cyber::proto::PerfType PerfConf::type() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.type)
+  return static_cast< ::apollo::cyber::proto::PerfType >(type_);
+}
+inline void PerfConf::set_type(::apollo::cyber::proto::PerfType value) {
+  assert(::apollo::cyber::proto::PerfType_IsValid(value));
+  set_has_type();
+  type_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.type)
+}
+
+// optional bool flight_recorder = 3 [default = false];
+inline bool PerfConf::has_flight_recorder() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void PerfConf::set_has_flight_recorder() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void PerfConf::clear_has_flight_recorder() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void PerfConf::clear_flight_recorder() {
+  flight_recorder_ = false;
+  clear_has_flight_recorder();
+}
+inline bool PerfConf::flight_recorder() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.flight_recorder)
+  return flight_recorder_;
+}
+inline void PerfConf::set_flight_recorder(bool value) {
+  set_has_flight_recorder();
+  flight_recorder_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.flight_recorder)
+}
+
+// optional uint32 flight_recorder_seconds = 4 [default = 10];
+inline bool PerfConf::has_flight_recorder_seconds() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void PerfConf::set_has_flight_recorder_seconds() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void PerfConf::clear_has_flight_recorder_seconds() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void PerfConf::clear_flight_recorder_seconds() {
+  flight_recorder_seconds_ = 10u;
+  clear_has_flight_recorder_seconds();
+}
+inline ::google::protobuf::uint32 PerfConf::flight_recorder_seconds() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.flight_recorder_seconds)
+  return flight_recorder_seconds_;
+}
+inline void PerfConf::set_flight_recorder_seconds(::google::protobuf::uint32 value) {
+  set_has_flight_recorder_seconds();
+  flight_recorder_seconds_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.flight_recorder_seconds)
+}
+
+// optional uint32 ring_size = 5 [default = 8192];
+inline bool PerfConf::has_ring_size() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void PerfConf::set_has_ring_size() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void PerfConf::clear_has_ring_size() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void PerfConf::clear_ring_size() {
+  ring_size_ = 8192u;
+  clear_has_ring_size();
+}
+inline ::google::protobuf::uint32 PerfConf::ring_size() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.ring_size)
+  return ring_size_;
+}
+inline void PerfConf::set_ring_size(::google::protobuf::uint32 value) {
+  set_has_ring_size();
+  ring_size_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.ring_size)
+}
+
+// optional int32 dump_signal = 6 [default = 12];
+inline bool PerfConf::has_dump_signal() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void PerfConf::set_has_dump_signal() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void PerfConf::clear_has_dump_signal() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void PerfConf::clear_dump_signal() {
+  dump_signal_ = 12;
+  clear_has_dump_signal();
+}
+inline ::google::protobuf::int32 PerfConf::dump_signal() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.dump_signal)
+  return dump_signal_;
+}
+inline void PerfConf::set_dump_signal(::google::protobuf::int32 value) {
+  set_has_dump_signal();
+  dump_signal_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.PerfConf.dump_signal)
+}
+
+// optional .apollo.cyber.proto.LatencyConf latency_conf = 7;
+inline bool PerfConf::has_latency_conf() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void PerfConf::set_has_latency_conf() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void PerfConf::clear_has_latency_conf() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void PerfConf::clear_latency_conf() {
+  if (latency_conf_ != NULL) latency_conf_->Clear();
+  clear_has_latency_conf();
+}
+inline const ::apollo::cyber::proto::LatencyConf& PerfConf::latency_conf() const {
+  const ::apollo::cyber::proto::LatencyConf* p = latency_conf_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.PerfConf.latency_conf)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::LatencyConf*>(
+      &::apollo::cyber::proto::_LatencyConf_default_instance_);
+}
+inline ::apollo::cyber::proto::LatencyConf* PerfConf::release_latency_conf() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.PerfConf.latency_conf)
+  clear_has_latency_conf();
+  ::apollo::cyber::proto::LatencyConf* temp = latency_conf_;
+  latency_conf_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::LatencyConf* PerfConf::mutable_latency_conf() {
+  set_has_latency_conf();
+  if (latency_conf_ == NULL) {
+    latency_conf_ = new ::apollo::cyber::proto::LatencyConf;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.PerfConf.latency_conf)
+  return latency_conf_;
+}
+inline void PerfConf::set_allocated_latency_conf(::apollo::cyber::proto::LatencyConf* latency_conf) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete latency_conf_;
+  }
+  if (latency_conf) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      latency_conf = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, latency_conf, submessage_arena);
+    }
+    set_has_latency_conf();
+  } else {
+    clear_has_latency_conf();
+  }
+  latency_conf_ = latency_conf;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.PerfConf.latency_conf)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+namespace google {
+namespace protobuf {
+
+template <> struct is_proto_enum< ::apollo::cyber::proto::PerfType> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::apollo::cyber::proto::PerfType>() {
+  return ::apollo::cyber::proto::PerfType_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_perf_5fconf_2eproto__INCLUDED
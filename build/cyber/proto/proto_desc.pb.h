@@ -0,0 +1,311 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto_desc.proto
+
+#ifndef PROTOBUF_proto_5fdesc_2eproto__INCLUDED
+#define PROTOBUF_proto_5fdesc_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_proto_5fdesc_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsProtoDescImpl();
+void InitDefaultsProtoDesc();
+inline void InitDefaults() {
+  InitDefaultsProtoDesc();
+}
+}  // namespace protobuf_proto_5fdesc_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class ProtoDesc;
+class ProtoDescDefaultTypeInternal;
+extern ProtoDescDefaultTypeInternal _ProtoDesc_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class ProtoDesc : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.ProtoDesc) */ {
+ public:
+  ProtoDesc();
+  virtual ~ProtoDesc();
+
+  ProtoDesc(const ProtoDesc& from);
+
+  inline ProtoDesc& operator=(const ProtoDesc& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  ProtoDesc(ProtoDesc&& from) noexcept
+    : ProtoDesc() {
+    *this = ::std::move(from);
+  }
+
+  inline ProtoDesc& operator=(ProtoDesc&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ProtoDesc& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ProtoDesc* internal_default_instance() {
+    return reinterpret_cast<const ProtoDesc*>(
+               &_ProtoDesc_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(ProtoDesc* other);
+  friend void swap(ProtoDesc& a, ProtoDesc& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ProtoDesc* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ProtoDesc* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ProtoDesc& from);
+  void MergeFrom(const ProtoDesc& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ProtoDesc* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .apollo.cyber.proto.ProtoDesc dependencies = 2;
+  int dependencies_size() const;
+  void clear_dependencies();
+  static const int kDependenciesFieldNumber = 2;
+  const ::apollo::cyber::proto::ProtoDesc& dependencies(int index) const;
+  ::apollo::cyber::proto::ProtoDesc* mutable_dependencies(int index);
+  ::apollo::cyber::proto::ProtoDesc* add_dependencies();
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ProtoDesc >*
+      mutable_dependencies();
+  const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ProtoDesc >&
+      dependencies() const;
+
+  // optional bytes desc = 1;
+  bool has_desc() const;
+  void clear_desc();
+  static const int kDescFieldNumber = 1;
+  const ::std::string& desc() const;
+  void set_desc(const ::std::string& value);
+  #if LANG_CXX11
+  void set_desc(::std::string&& value);
+  #endif
+  void set_desc(const char* value);
+  void set_desc(const void* value, size_t size);
+  ::std::string* mutable_desc();
+  ::std::string* release_desc();
+  void set_allocated_desc(::std::string* desc);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.ProtoDesc)
+ private:
+  void set_has_desc();
+  void clear_has_desc();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ProtoDesc > dependencies_;
+  ::google::protobuf::internal::ArenaStringPtr desc_;
+  friend struct ::protobuf_proto_5fdesc_2eproto::TableStruct;
+  friend void ::protobuf_proto_5fdesc_2eproto::InitDefaultsProtoDescImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ProtoDesc
+
+// optional bytes desc = 1;
+inline bool ProtoDesc::has_desc() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ProtoDesc::set_has_desc() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ProtoDesc::clear_has_desc() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ProtoDesc::clear_desc() {
+  desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_desc();
+}
+inline const ::std::string& ProtoDesc::desc() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ProtoDesc.desc)
+  return desc_.GetNoArena();
+}
+inline void ProtoDesc::set_desc(const ::std::string& value) {
+  set_has_desc();
+  desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ProtoDesc.desc)
+}
+#if LANG_CXX11
+inline void ProtoDesc::set_desc(::std::string&& value) {
+  set_has_desc();
+  desc_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:apollo.cyber.proto.ProtoDesc.desc)
+}
+#endif
+inline void ProtoDesc::set_desc(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_desc();
+  desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:apollo.cyber.proto.ProtoDesc.desc)
+}
+inline void ProtoDesc::set_desc(const void* value, size_t size) {
+  set_has_desc();
+  desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:apollo.cyber.proto.ProtoDesc.desc)
+}
+inline ::std::string* ProtoDesc::mutable_desc() {
+  set_has_desc();
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.ProtoDesc.desc)
+  return desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ProtoDesc::release_desc() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.ProtoDesc.desc)
+  clear_has_desc();
+  return desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ProtoDesc::set_allocated_desc(::std::string* desc) {
+  if (desc != NULL) {
+    set_has_desc();
+  } else {
+    clear_has_desc();
+  }
+  desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), desc);
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.ProtoDesc.desc)
+}
+
+// repeated .apollo.cyber.proto.ProtoDesc dependencies = 2;
+inline int ProtoDesc::dependencies_size() const {
+  return dependencies_.size();
+}
+inline void ProtoDesc::clear_dependencies() {
+  dependencies_.Clear();
+}
+inline const ::apollo::cyber::proto::ProtoDesc& ProtoDesc::dependencies(int index) const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ProtoDesc.dependencies)
+  return dependencies_.Get(index);
+}
+inline ::apollo::cyber::proto::ProtoDesc* ProtoDesc::mutable_dependencies(int index) {
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.ProtoDesc.dependencies)
+  return dependencies_.Mutable(index);
+}
+inline ::apollo::cyber::proto::ProtoDesc* ProtoDesc::add_dependencies() {
+  // @@protoc_insertion_point(field_add:apollo.cyber.proto.ProtoDesc.dependencies)
+  return dependencies_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ProtoDesc >*
+ProtoDesc::mutable_dependencies() {
+  // @@protoc_insertion_point(field_mutable_list:apollo.cyber.proto.ProtoDesc.dependencies)
+  return &dependencies_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ProtoDesc >&
+ProtoDesc::dependencies() const {
+  // @@protoc_insertion_point(field_list:apollo.cyber.proto.ProtoDesc.dependencies)
+  return dependencies_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_proto_5fdesc_2eproto__INCLUDED
@@ -0,0 +1,621 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: qos_profile.proto
+
+#include "qos_profile.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class QosProfileDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<QosProfile>
+      _instance;
+} _QosProfile_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_qos_5fprofile_2eproto {
+void InitDefaultsQosProfileImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_QosProfile_default_instance_;
+    new (ptr) ::apollo::cyber::proto::QosProfile();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::QosProfile::InitAsDefaultInstance();
+}
+
+void InitDefaultsQosProfile() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsQosProfileImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[3];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, history_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, depth_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, mps_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, reliability_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::QosProfile, durability_),
+  1,
+  2,
+  0,
+  3,
+  4,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, sizeof(::apollo::cyber::proto::QosProfile)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_QosProfile_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "qos_profile.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, file_level_enum_descriptors, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\021qos_profile.proto\022\022apollo.cyber.proto\""
+      "\237\002\n\nQosProfile\022H\n\007history\030\001 \001(\0162$.apollo"
+      ".cyber.proto.QosHistoryPolicy:\021HISTORY_K"
+      "EEP_LAST\022\020\n\005depth\030\002 \001(\r:\0011\022\016\n\003mps\030\003 \001(\r:"
+      "\0010\022S\n\013reliability\030\004 \001(\0162(.apollo.cyber.p"
+      "roto.QosReliabilityPolicy:\024RELIABILITY_R"
+      "ELIABLE\022P\n\ndurability\030\005 \001(\0162\'.apollo.cyb"
+      "er.proto.QosDurabilityPolicy:\023DURABILITY"
+      "_VOLATILE*[\n\020QosHistoryPolicy\022\032\n\026HISTORY"
+      "_SYSTEM_DEFAULT\020\000\022\025\n\021HISTORY_KEEP_LAST\020\001"
+      "\022\024\n\020HISTORY_KEEP_ALL\020\002*m\n\024QosReliability"
+      "Policy\022\036\n\032RELIABILITY_SYSTEM_DEFAULT\020\000\022\030"
+      "\n\024RELIABILITY_RELIABLE\020\001\022\033\n\027RELIABILITY_"
+      "BEST_EFFORT\020\002*m\n\023QosDurabilityPolicy\022\035\n\031"
+      "DURABILITY_SYSTEM_DEFAULT\020\000\022\036\n\032DURABILIT"
+      "Y_TRANSIENT_LOCAL\020\001\022\027\n\023DURABILITY_VOLATI"
+      "LE\020\002"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 644);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "qos_profile.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_qos_5fprofile_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+const ::google::protobuf::EnumDescriptor* QosHistoryPolicy_descriptor() {
+  protobuf_qos_5fprofile_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_qos_5fprofile_2eproto::file_level_enum_descriptors[0];
+}
+bool QosHistoryPolicy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* QosReliabilityPolicy_descriptor() {
+  protobuf_qos_5fprofile_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_qos_5fprofile_2eproto::file_level_enum_descriptors[1];
+}
+bool QosReliabilityPolicy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* QosDurabilityPolicy_descriptor() {
+  protobuf_qos_5fprofile_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_qos_5fprofile_2eproto::file_level_enum_descriptors[2];
+}
+bool QosDurabilityPolicy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void QosProfile::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int QosProfile::kHistoryFieldNumber;
+const int QosProfile::kDepthFieldNumber;
+const int QosProfile::kMpsFieldNumber;
+const int QosProfile::kReliabilityFieldNumber;
+const int QosProfile::kDurabilityFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+QosProfile::QosProfile()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_qos_5fprofile_2eproto::InitDefaultsQosProfile();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.QosProfile)
+}
+QosProfile::QosProfile(const QosProfile& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&mps_, &from.mps_,
+    static_cast<size_t>(reinterpret_cast<char*>(&durability_) -
+    reinterpret_cast<char*>(&mps_)) + sizeof(durability_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.QosProfile)
+}
+
+void QosProfile::SharedCtor() {
+  _cached_size_ = 0;
+  mps_ = 0u;
+  history_ = 1;
+  depth_ = 1u;
+  reliability_ = 1;
+  durability_ = 2;
+}
+
+QosProfile::~QosProfile() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.QosProfile)
+  SharedDtor();
+}
+
+void QosProfile::SharedDtor() {
+}
+
+void QosProfile::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* QosProfile::descriptor() {
+  ::protobuf_qos_5fprofile_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_qos_5fprofile_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const QosProfile& QosProfile::default_instance() {
+  ::protobuf_qos_5fprofile_2eproto::InitDefaultsQosProfile();
+  return *internal_default_instance();
+}
+
+QosProfile* QosProfile::New(::google::protobuf::Arena* arena) const {
+  QosProfile* n = new QosProfile;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void QosProfile::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.QosProfile)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 31u) {
+    mps_ = 0u;
+    history_ = 1;
+    depth_ = 1u;
+    reliability_ = 1;
+    durability_ = 2;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool QosProfile::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.QosProfile)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .apollo.cyber.proto.QosHistoryPolicy history = 1 [default = HISTORY_KEEP_LAST];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::QosHistoryPolicy_IsValid(value)) {
+            set_history(static_cast< ::apollo::cyber::proto::QosHistoryPolicy >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                1, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 depth = 2 [default = 1];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_depth();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &depth_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 mps = 3 [default = 0];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_mps();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &mps_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.QosReliabilityPolicy reliability = 4 [default = RELIABILITY_RELIABLE];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::QosReliabilityPolicy_IsValid(value)) {
+            set_reliability(static_cast< ::apollo::cyber::proto::QosReliabilityPolicy >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                4, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.QosDurabilityPolicy durability = 5 [default = DURABILITY_VOLATILE];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::QosDurabilityPolicy_IsValid(value)) {
+            set_durability(static_cast< ::apollo::cyber::proto::QosDurabilityPolicy >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                5, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.QosProfile)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.QosProfile)
+  return false;
+#undef DO_
+}
+
+void QosProfile::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.QosProfile)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.QosHistoryPolicy history = 1 [default = HISTORY_KEEP_LAST];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->history(), output);
+  }
+
+  // optional uint32 depth = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->depth(), output);
+  }
+
+  // optional uint32 mps = 3 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->mps(), output);
+  }
+
+  // optional .apollo.cyber.proto.QosReliabilityPolicy reliability = 4 [default = RELIABILITY_RELIABLE];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->reliability(), output);
+  }
+
+  // optional .apollo.cyber.proto.QosDurabilityPolicy durability = 5 [default = DURABILITY_VOLATILE];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      5, this->durability(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.QosProfile)
+}
+
+::google::protobuf::uint8* QosProfile::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.QosProfile)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.QosHistoryPolicy history = 1 [default = HISTORY_KEEP_LAST];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->history(), target);
+  }
+
+  // optional uint32 depth = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->depth(), target);
+  }
+
+  // optional uint32 mps = 3 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->mps(), target);
+  }
+
+  // optional .apollo.cyber.proto.QosReliabilityPolicy reliability = 4 [default = RELIABILITY_RELIABLE];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      4, this->reliability(), target);
+  }
+
+  // optional .apollo.cyber.proto.QosDurabilityPolicy durability = 5 [default = DURABILITY_VOLATILE];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      5, this->durability(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.QosProfile)
+  return target;
+}
+
+size_t QosProfile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.QosProfile)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 31u) {
+    // optional uint32 mps = 3 [default = 0];
+    if (has_mps()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->mps());
+    }
+
+    // optional .apollo.cyber.proto.QosHistoryPolicy history = 1 [default = HISTORY_KEEP_LAST];
+    if (has_history()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->history());
+    }
+
+    // optional uint32 depth = 2 [default = 1];
+    if (has_depth()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->depth());
+    }
+
+    // optional .apollo.cyber.proto.QosReliabilityPolicy reliability = 4 [default = RELIABILITY_RELIABLE];
+    if (has_reliability()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->reliability());
+    }
+
+    // optional .apollo.cyber.proto.QosDurabilityPolicy durability = 5 [default = DURABILITY_VOLATILE];
+    if (has_durability()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->durability());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void QosProfile::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.QosProfile)
+  GOOGLE_DCHECK_NE(&from, this);
+  const QosProfile* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const QosProfile>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.QosProfile)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.QosProfile)
+    MergeFrom(*source);
+  }
+}
+
+void QosProfile::MergeFrom(const QosProfile& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.QosProfile)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 31u) {
+    if (cached_has_bits & 0x00000001u) {
+      mps_ = from.mps_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      history_ = from.history_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      depth_ = from.depth_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      reliability_ = from.reliability_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      durability_ = from.durability_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void QosProfile::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.QosProfile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void QosProfile::CopyFrom(const QosProfile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.QosProfile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QosProfile::IsInitialized() const {
+  return true;
+}
+
+void QosProfile::Swap(QosProfile* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void QosProfile::InternalSwap(QosProfile* other) {
+  using std::swap;
+  swap(mps_, other->mps_);
+  swap(history_, other->history_);
+  swap(depth_, other->depth_);
+  swap(reliability_, other->reliability_);
+  swap(durability_, other->durability_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata QosProfile::GetMetadata() const {
+  protobuf_qos_5fprofile_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_qos_5fprofile_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,6028 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: record.proto
+
+#include "record.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class SingleIndexDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<SingleIndex>
+      _instance;
+  const ::apollo::cyber::proto::ChannelCache* channel_cache_;
+  const ::apollo::cyber::proto::ChunkHeaderCache* chunk_header_cache_;
+  const ::apollo::cyber::proto::ChunkBodyCache* chunk_body_cache_;
+} _SingleIndex_default_instance_;
+class ChunkHeaderCacheDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChunkHeaderCache>
+      _instance;
+} _ChunkHeaderCache_default_instance_;
+class ChunkBodyCacheDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChunkBodyCache>
+      _instance;
+} _ChunkBodyCache_default_instance_;
+class ChannelCacheDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChannelCache>
+      _instance;
+} _ChannelCache_default_instance_;
+class SingleMessageDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<SingleMessage>
+      _instance;
+} _SingleMessage_default_instance_;
+class HeaderDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Header>
+      _instance;
+} _Header_default_instance_;
+class ChannelDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Channel>
+      _instance;
+} _Channel_default_instance_;
+class ChunkHeaderDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChunkHeader>
+      _instance;
+} _ChunkHeader_default_instance_;
+class ChunkBodyDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChunkBody>
+      _instance;
+} _ChunkBody_default_instance_;
+class IndexDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<Index>
+      _instance;
+} _Index_default_instance_;
+class IndexCheckpointDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<IndexCheckpoint>
+      _instance;
+} _IndexCheckpoint_default_instance_;
+class ChannelTimeIndexDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChannelTimeIndex>
+      _instance;
+} _ChannelTimeIndex_default_instance_;
+class TimeIndexDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<TimeIndex>
+      _instance;
+} _TimeIndex_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_record_2eproto {
+void InitDefaultsSingleIndexImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_record_2eproto::InitDefaultsChannelCache();
+  protobuf_record_2eproto::InitDefaultsChunkHeaderCache();
+  protobuf_record_2eproto::InitDefaultsChunkBodyCache();
+  {
+    void* ptr = &::apollo::cyber::proto::_SingleIndex_default_instance_;
+    new (ptr) ::apollo::cyber::proto::SingleIndex();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::SingleIndex::InitAsDefaultInstance();
+}
+
+void InitDefaultsSingleIndex() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsSingleIndexImpl);
+}
+
+void InitDefaultsChunkHeaderCacheImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_ChunkHeaderCache_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChunkHeaderCache();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChunkHeaderCache::InitAsDefaultInstance();
+}
+
+void InitDefaultsChunkHeaderCache() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChunkHeaderCacheImpl);
+}
+
+void InitDefaultsChunkBodyCacheImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_ChunkBodyCache_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChunkBodyCache();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChunkBodyCache::InitAsDefaultInstance();
+}
+
+void InitDefaultsChunkBodyCache() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChunkBodyCacheImpl);
+}
+
+void InitDefaultsChannelCacheImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_ChannelCache_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChannelCache();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChannelCache::InitAsDefaultInstance();
+}
+
+void InitDefaultsChannelCache() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChannelCacheImpl);
+}
+
+void InitDefaultsSingleMessageImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_SingleMessage_default_instance_;
+    new (ptr) ::apollo::cyber::proto::SingleMessage();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::SingleMessage::InitAsDefaultInstance();
+}
+
+void InitDefaultsSingleMessage() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsSingleMessageImpl);
+}
+
+void InitDefaultsHeaderImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_Header_default_instance_;
+    new (ptr) ::apollo::cyber::proto::Header();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::Header::InitAsDefaultInstance();
+}
+
+void InitDefaultsHeader() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsHeaderImpl);
+}
+
+void InitDefaultsChannelImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_Channel_default_instance_;
+    new (ptr) ::apollo::cyber::proto::Channel();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::Channel::InitAsDefaultInstance();
+}
+
+void InitDefaultsChannel() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChannelImpl);
+}
+
+void InitDefaultsChunkHeaderImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_ChunkHeader_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChunkHeader();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChunkHeader::InitAsDefaultInstance();
+}
+
+void InitDefaultsChunkHeader() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChunkHeaderImpl);
+}
+
+void InitDefaultsChunkBodyImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_record_2eproto::InitDefaultsSingleMessage();
+  {
+    void* ptr = &::apollo::cyber::proto::_ChunkBody_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChunkBody();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChunkBody::InitAsDefaultInstance();
+}
+
+void InitDefaultsChunkBody() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChunkBodyImpl);
+}
+
+void InitDefaultsIndexImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_record_2eproto::InitDefaultsSingleIndex();
+  {
+    void* ptr = &::apollo::cyber::proto::_Index_default_instance_;
+    new (ptr) ::apollo::cyber::proto::Index();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::Index::InitAsDefaultInstance();
+}
+
+void InitDefaultsIndex() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsIndexImpl);
+}
+
+void InitDefaultsIndexCheckpointImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_record_2eproto::InitDefaultsHeader();
+  protobuf_record_2eproto::InitDefaultsIndex();
+  {
+    void* ptr = &::apollo::cyber::proto::_IndexCheckpoint_default_instance_;
+    new (ptr) ::apollo::cyber::proto::IndexCheckpoint();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::IndexCheckpoint::InitAsDefaultInstance();
+}
+
+void InitDefaultsIndexCheckpoint() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsIndexCheckpointImpl);
+}
+
+void InitDefaultsChannelTimeIndexImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_ChannelTimeIndex_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChannelTimeIndex();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChannelTimeIndex::InitAsDefaultInstance();
+}
+
+void InitDefaultsChannelTimeIndex() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChannelTimeIndexImpl);
+}
+
+void InitDefaultsTimeIndexImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_record_2eproto::InitDefaultsChannelTimeIndex();
+  {
+    void* ptr = &::apollo::cyber::proto::_TimeIndex_default_instance_;
+    new (ptr) ::apollo::cyber::proto::TimeIndex();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::TimeIndex::InitAsDefaultInstance();
+}
+
+void InitDefaultsTimeIndex() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsTimeIndexImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[13];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[2];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, position_),
+  offsetof(::apollo::cyber::proto::SingleIndexDefaultTypeInternal, channel_cache_),
+  offsetof(::apollo::cyber::proto::SingleIndexDefaultTypeInternal, chunk_header_cache_),
+  offsetof(::apollo::cyber::proto::SingleIndexDefaultTypeInternal, chunk_body_cache_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleIndex, cache_),
+  1,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, message_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, begin_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, end_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeaderCache, raw_size_),
+  0,
+  1,
+  2,
+  3,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBodyCache, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBodyCache, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBodyCache, message_number_),
+  0,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, message_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, message_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, proto_desc_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelCache, dropped_number_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleMessage, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleMessage, channel_name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleMessage, time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SingleMessage, content_),
+  0,
+  2,
+  1,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, major_version_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, minor_version_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, compress_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, chunk_interval_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, segment_interval_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, index_position_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, chunk_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, channel_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, begin_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, end_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, message_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, is_complete_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, chunk_raw_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, segment_raw_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, time_index_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, time_index_position_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, checkpoint_position_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, checkpoint_chunk_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, checkpoint_interval_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Header, dropped_number_),
+  0,
+  1,
+  9,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  12,
+  13,
+  10,
+  14,
+  15,
+  11,
+  16,
+  17,
+  18,
+  19,
+  20,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Channel, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Channel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Channel, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Channel, message_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Channel, proto_desc_),
+  0,
+  1,
+  2,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, begin_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, end_time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, message_number_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkHeader, raw_size_),
+  0,
+  1,
+  2,
+  3,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBody, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBody, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChunkBody, messages_),
+  ~0u,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Index, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Index, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::Index, indexes_),
+  ~0u,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IndexCheckpoint, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IndexCheckpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IndexCheckpoint, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IndexCheckpoint, index_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::IndexCheckpoint, previous_position_),
+  0,
+  1,
+  2,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, time_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, chunk_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, offset_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChannelTimeIndex, size_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TimeIndex, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TimeIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TimeIndex, channels_),
+  ~0u,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 11, sizeof(::apollo::cyber::proto::SingleIndex)},
+  { 16, 25, sizeof(::apollo::cyber::proto::ChunkHeaderCache)},
+  { 29, 35, sizeof(::apollo::cyber::proto::ChunkBodyCache)},
+  { 36, 46, sizeof(::apollo::cyber::proto::ChannelCache)},
+  { 51, 59, sizeof(::apollo::cyber::proto::SingleMessage)},
+  { 62, 88, sizeof(::apollo::cyber::proto::Header)},
+  { 109, 117, sizeof(::apollo::cyber::proto::Channel)},
+  { 120, 129, sizeof(::apollo::cyber::proto::ChunkHeader)},
+  { 133, 139, sizeof(::apollo::cyber::proto::ChunkBody)},
+  { 140, 146, sizeof(::apollo::cyber::proto::Index)},
+  { 147, 155, sizeof(::apollo::cyber::proto::IndexCheckpoint)},
+  { 158, 168, sizeof(::apollo::cyber::proto::ChannelTimeIndex)},
+  { 173, 179, sizeof(::apollo::cyber::proto::TimeIndex)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_SingleIndex_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChunkHeaderCache_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChunkBodyCache_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChannelCache_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_SingleMessage_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_Header_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_Channel_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChunkHeader_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChunkBody_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_Index_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_IndexCheckpoint_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChannelTimeIndex_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_TimeIndex_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "record.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, file_level_enum_descriptors, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 13);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\014record.proto\022\022apollo.cyber.proto\"\226\002\n\013S"
+      "ingleIndex\022-\n\004type\030\001 \001(\0162\037.apollo.cyber."
+      "proto.SectionType\022\020\n\010position\030\002 \001(\004\0229\n\rc"
+      "hannel_cache\030e \001(\0132 .apollo.cyber.proto."
+      "ChannelCacheH\000\022B\n\022chunk_header_cache\030f \001"
+      "(\0132$.apollo.cyber.proto.ChunkHeaderCache"
+      "H\000\022>\n\020chunk_body_cache\030g \001(\0132\".apollo.cy"
+      "ber.proto.ChunkBodyCacheH\000B\007\n\005cache\"b\n\020C"
+      "hunkHeaderCache\022\026\n\016message_number\030\001 \001(\004\022"
+      "\022\n\nbegin_time\030\002 \001(\004\022\020\n\010end_time\030\003 \001(\004\022\020\n"
+      "\010raw_size\030\004 \001(\004\"(\n\016ChunkBodyCache\022\026\n\016mes"
+      "sage_number\030\001 \001(\004\"y\n\014ChannelCache\022\026\n\016mes"
+      "sage_number\030\001 \001(\004\022\014\n\004name\030\002 \001(\t\022\024\n\014messa"
+      "ge_type\030\003 \001(\t\022\022\n\nproto_desc\030\004 \001(\014\022\031\n\016dro"
+      "pped_number\030\005 \001(\004:\0010\"D\n\rSingleMessage\022\024\n"
+      "\014channel_name\030\001 \001(\t\022\014\n\004time\030\002 \001(\004\022\017\n\007con"
+      "tent\030\003 \001(\014\"\313\004\n\006Header\022\025\n\rmajor_version\030\001"
+      " \001(\r\022\025\n\rminor_version\030\002 \001(\r\0222\n\010compress\030"
+      "\003 \001(\0162 .apollo.cyber.proto.CompressType\022"
+      "\026\n\016chunk_interval\030\004 \001(\004\022\030\n\020segment_inter"
+      "val\030\005 \001(\004\022\031\n\016index_position\030\006 \001(\004:\0010\022\027\n\014"
+      "chunk_number\030\007 \001(\004:\0010\022\031\n\016channel_number\030"
+      "\010 \001(\004:\0010\022\025\n\nbegin_time\030\t \001(\004:\0010\022\023\n\010end_t"
+      "ime\030\n \001(\004:\0010\022\031\n\016message_number\030\013 \001(\004:\0010\022"
+      "\017\n\004size\030\014 \001(\004:\0010\022\032\n\013is_complete\030\r \001(\010:\005f"
+      "alse\022\026\n\016chunk_raw_size\030\016 \001(\004\022\030\n\020segment_"
+      "raw_size\030\017 \001(\004\022\031\n\ntime_index\030\020 \001(\010:\005fals"
+      "e\022\036\n\023time_index_position\030\021 \001(\004:\0010\022\036\n\023che"
+      "ckpoint_position\030\022 \001(\004:\0010\022\"\n\027checkpoint_"
+      "chunk_number\030\023 \001(\004:\0010\022\036\n\023checkpoint_inte"
+      "rval\030\024 \001(\004:\0010\022\031\n\016dropped_number\030\025 \001(\004:\0010"
+      "\"A\n\007Channel\022\014\n\004name\030\001 \001(\t\022\024\n\014message_typ"
+      "e\030\002 \001(\t\022\022\n\nproto_desc\030\003 \001(\014\"]\n\013ChunkHead"
+      "er\022\022\n\nbegin_time\030\001 \001(\004\022\020\n\010end_time\030\002 \001(\004"
+      "\022\026\n\016message_number\030\003 \001(\004\022\020\n\010raw_size\030\004 \001"
+      "(\004\"@\n\tChunkBody\0223\n\010messages\030\001 \003(\0132!.apol"
+      "lo.cyber.proto.SingleMessage\"9\n\005Index\0220\n"
+      "\007indexes\030\001 \003(\0132\037.apollo.cyber.proto.Sing"
+      "leIndex\"\202\001\n\017IndexCheckpoint\022*\n\006header\030\001 "
+      "\001(\0132\032.apollo.cyber.proto.Header\022(\n\005index"
+      "\030\002 \001(\0132\031.apollo.cyber.proto.Index\022\031\n\021pre"
+      "vious_position\030\003 \001(\004\"k\n\020ChannelTimeIndex"
+      "\022\014\n\004name\030\001 \001(\t\022\020\n\004time\030\002 \003(\004B\002\020\001\022\021\n\005chun"
+      "k\030\003 \003(\rB\002\020\001\022\022\n\006offset\030\004 \003(\004B\002\020\001\022\020\n\004size\030"
+      "\005 \003(\rB\002\020\001\"C\n\tTimeIndex\0226\n\010channels\030\001 \003(\013"
+      "2$.apollo.cyber.proto.ChannelTimeIndex*\261"
+      "\001\n\013SectionType\022\022\n\016SECTION_HEADER\020\000\022\030\n\024SE"
+      "CTION_CHUNK_HEADER\020\001\022\026\n\022SECTION_CHUNK_BO"
+      "DY\020\002\022\021\n\rSECTION_INDEX\020\003\022\023\n\017SECTION_CHANN"
+      "EL\020\004\022\026\n\022SECTION_TIME_INDEX\020\005\022\034\n\030SECTION_"
+      "INDEX_CHECKPOINT\020\006*E\n\014CompressType\022\021\n\rCO"
+      "MPRESS_NONE\020\000\022\020\n\014COMPRESS_BZ2\020\001\022\020\n\014COMPR"
+      "ESS_LZ4\020\002"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 2089);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "record.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_record_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+const ::google::protobuf::EnumDescriptor* SectionType_descriptor() {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_record_2eproto::file_level_enum_descriptors[0];
+}
+bool SectionType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* CompressType_descriptor() {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_record_2eproto::file_level_enum_descriptors[1];
+}
+bool CompressType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void SingleIndex::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_SingleIndex_default_instance_.channel_cache_ = const_cast< ::apollo::cyber::proto::ChannelCache*>(
+      ::apollo::cyber::proto::ChannelCache::internal_default_instance());
+  ::apollo::cyber::proto::_SingleIndex_default_instance_.chunk_header_cache_ = const_cast< ::apollo::cyber::proto::ChunkHeaderCache*>(
+      ::apollo::cyber::proto::ChunkHeaderCache::internal_default_instance());
+  ::apollo::cyber::proto::_SingleIndex_default_instance_.chunk_body_cache_ = const_cast< ::apollo::cyber::proto::ChunkBodyCache*>(
+      ::apollo::cyber::proto::ChunkBodyCache::internal_default_instance());
+}
+void SingleIndex::set_allocated_channel_cache(::apollo::cyber::proto::ChannelCache* channel_cache) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  clear_cache();
+  if (channel_cache) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      channel_cache = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, channel_cache, submessage_arena);
+    }
+    set_has_channel_cache();
+    cache_.channel_cache_ = channel_cache;
+  }
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.SingleIndex.channel_cache)
+}
+void SingleIndex::set_allocated_chunk_header_cache(::apollo::cyber::proto::ChunkHeaderCache* chunk_header_cache) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  clear_cache();
+  if (chunk_header_cache) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      chunk_header_cache = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, chunk_header_cache, submessage_arena);
+    }
+    set_has_chunk_header_cache();
+    cache_.chunk_header_cache_ = chunk_header_cache;
+  }
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.SingleIndex.chunk_header_cache)
+}
+void SingleIndex::set_allocated_chunk_body_cache(::apollo::cyber::proto::ChunkBodyCache* chunk_body_cache) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  clear_cache();
+  if (chunk_body_cache) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      chunk_body_cache = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, chunk_body_cache, submessage_arena);
+    }
+    set_has_chunk_body_cache();
+    cache_.chunk_body_cache_ = chunk_body_cache;
+  }
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.SingleIndex.chunk_body_cache)
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SingleIndex::kTypeFieldNumber;
+const int SingleIndex::kPositionFieldNumber;
+const int SingleIndex::kChannelCacheFieldNumber;
+const int SingleIndex::kChunkHeaderCacheFieldNumber;
+const int SingleIndex::kChunkBodyCacheFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SingleIndex::SingleIndex()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsSingleIndex();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.SingleIndex)
+}
+SingleIndex::SingleIndex(const SingleIndex& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&position_, &from.position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
+    reinterpret_cast<char*>(&position_)) + sizeof(type_));
+  clear_has_cache();
+  switch (from.cache_case()) {
+    case kChannelCache: {
+      mutable_channel_cache()->::apollo::cyber::proto::ChannelCache::MergeFrom(from.channel_cache());
+      break;
+    }
+    case kChunkHeaderCache: {
+      mutable_chunk_header_cache()->::apollo::cyber::proto::ChunkHeaderCache::MergeFrom(from.chunk_header_cache());
+      break;
+    }
+    case kChunkBodyCache: {
+      mutable_chunk_body_cache()->::apollo::cyber::proto::ChunkBodyCache::MergeFrom(from.chunk_body_cache());
+      break;
+    }
+    case CACHE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.SingleIndex)
+}
+
+void SingleIndex::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&position_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&type_) -
+      reinterpret_cast<char*>(&position_)) + sizeof(type_));
+  clear_has_cache();
+}
+
+SingleIndex::~SingleIndex() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.SingleIndex)
+  SharedDtor();
+}
+
+void SingleIndex::SharedDtor() {
+  if (has_cache()) {
+    clear_cache();
+  }
+}
+
+void SingleIndex::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SingleIndex::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const SingleIndex& SingleIndex::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsSingleIndex();
+  return *internal_default_instance();
+}
+
+SingleIndex* SingleIndex::New(::google::protobuf::Arena* arena) const {
+  SingleIndex* n = new SingleIndex;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SingleIndex::clear_cache() {
+// @@protoc_insertion_point(one_of_clear_start:apollo.cyber.proto.SingleIndex)
+  switch (cache_case()) {
+    case kChannelCache: {
+      delete cache_.channel_cache_;
+      break;
+    }
+    case kChunkHeaderCache: {
+      delete cache_.chunk_header_cache_;
+      break;
+    }
+    case kChunkBodyCache: {
+      delete cache_.chunk_body_cache_;
+      break;
+    }
+    case CACHE_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = CACHE_NOT_SET;
+}
+
+
+void SingleIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.SingleIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 3u) {
+    ::memset(&position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&type_) -
+        reinterpret_cast<char*>(&position_)) + sizeof(type_));
+  }
+  clear_cache();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool SingleIndex::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.SingleIndex)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .apollo.cyber.proto.SectionType type = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::SectionType_IsValid(value)) {
+            set_type(static_cast< ::apollo::cyber::proto::SectionType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                1, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 position = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_position();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &position_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ChannelCache channel_cache = 101;
+      case 101: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 810 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_channel_cache()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ChunkHeaderCache chunk_header_cache = 102;
+      case 102: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 818 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_chunk_header_cache()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ChunkBodyCache chunk_body_cache = 103;
+      case 103: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 826 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_chunk_body_cache()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.SingleIndex)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.SingleIndex)
+  return false;
+#undef DO_
+}
+
+void SingleIndex::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.SingleIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.SectionType type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->type(), output);
+  }
+
+  // optional uint64 position = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->position(), output);
+  }
+
+  switch (cache_case()) {
+    case kChannelCache:
+      ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+        101, *cache_.channel_cache_, output);
+      break;
+    case kChunkHeaderCache:
+      ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+        102, *cache_.chunk_header_cache_, output);
+      break;
+    case kChunkBodyCache:
+      ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+        103, *cache_.chunk_body_cache_, output);
+      break;
+    default: ;
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.SingleIndex)
+}
+
+::google::protobuf::uint8* SingleIndex::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.SingleIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.SectionType type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->type(), target);
+  }
+
+  // optional uint64 position = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->position(), target);
+  }
+
+  switch (cache_case()) {
+    case kChannelCache:
+      target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessageToArray(
+          101, *cache_.channel_cache_, deterministic, target);
+      break;
+    case kChunkHeaderCache:
+      target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessageToArray(
+          102, *cache_.chunk_header_cache_, deterministic, target);
+      break;
+    case kChunkBodyCache:
+      target = ::google::protobuf::internal::WireFormatLite::
+        InternalWriteMessageToArray(
+          103, *cache_.chunk_body_cache_, deterministic, target);
+      break;
+    default: ;
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.SingleIndex)
+  return target;
+}
+
+size_t SingleIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.SingleIndex)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 3u) {
+    // optional uint64 position = 2;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->position());
+    }
+
+    // optional .apollo.cyber.proto.SectionType type = 1;
+    if (has_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    }
+
+  }
+  switch (cache_case()) {
+    // optional .apollo.cyber.proto.ChannelCache channel_cache = 101;
+    case kChannelCache: {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *cache_.channel_cache_);
+      break;
+    }
+    // optional .apollo.cyber.proto.ChunkHeaderCache chunk_header_cache = 102;
+    case kChunkHeaderCache: {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *cache_.chunk_header_cache_);
+      break;
+    }
+    // optional .apollo.cyber.proto.ChunkBodyCache chunk_body_cache = 103;
+    case kChunkBodyCache: {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *cache_.chunk_body_cache_);
+      break;
+    }
+    case CACHE_NOT_SET: {
+      break;
+    }
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SingleIndex::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.SingleIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SingleIndex* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SingleIndex>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.SingleIndex)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.SingleIndex)
+    MergeFrom(*source);
+  }
+}
+
+void SingleIndex::MergeFrom(const SingleIndex& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.SingleIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 3u) {
+    if (cached_has_bits & 0x00000001u) {
+      position_ = from.position_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      type_ = from.type_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.cache_case()) {
+    case kChannelCache: {
+      mutable_channel_cache()->::apollo::cyber::proto::ChannelCache::MergeFrom(from.channel_cache());
+      break;
+    }
+    case kChunkHeaderCache: {
+      mutable_chunk_header_cache()->::apollo::cyber::proto::ChunkHeaderCache::MergeFrom(from.chunk_header_cache());
+      break;
+    }
+    case kChunkBodyCache: {
+      mutable_chunk_body_cache()->::apollo::cyber::proto::ChunkBodyCache::MergeFrom(from.chunk_body_cache());
+      break;
+    }
+    case CACHE_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void SingleIndex::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.SingleIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SingleIndex::CopyFrom(const SingleIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.SingleIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SingleIndex::IsInitialized() const {
+  return true;
+}
+
+void SingleIndex::Swap(SingleIndex* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SingleIndex::InternalSwap(SingleIndex* other) {
+  using std::swap;
+  swap(position_, other->position_);
+  swap(type_, other->type_);
+  swap(cache_, other->cache_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SingleIndex::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChunkHeaderCache::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChunkHeaderCache::kMessageNumberFieldNumber;
+const int ChunkHeaderCache::kBeginTimeFieldNumber;
+const int ChunkHeaderCache::kEndTimeFieldNumber;
+const int ChunkHeaderCache::kRawSizeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChunkHeaderCache::ChunkHeaderCache()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChunkHeaderCache();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChunkHeaderCache)
+}
+ChunkHeaderCache::ChunkHeaderCache(const ChunkHeaderCache& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&message_number_, &from.message_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&raw_size_) -
+    reinterpret_cast<char*>(&message_number_)) + sizeof(raw_size_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChunkHeaderCache)
+}
+
+void ChunkHeaderCache::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&message_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&raw_size_) -
+      reinterpret_cast<char*>(&message_number_)) + sizeof(raw_size_));
+}
+
+ChunkHeaderCache::~ChunkHeaderCache() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChunkHeaderCache)
+  SharedDtor();
+}
+
+void ChunkHeaderCache::SharedDtor() {
+}
+
+void ChunkHeaderCache::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChunkHeaderCache::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChunkHeaderCache& ChunkHeaderCache::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChunkHeaderCache();
+  return *internal_default_instance();
+}
+
+ChunkHeaderCache* ChunkHeaderCache::New(::google::protobuf::Arena* arena) const {
+  ChunkHeaderCache* n = new ChunkHeaderCache;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChunkHeaderCache::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChunkHeaderCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 15u) {
+    ::memset(&message_number_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&raw_size_) -
+        reinterpret_cast<char*>(&message_number_)) + sizeof(raw_size_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChunkHeaderCache::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChunkHeaderCache)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint64 message_number = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_message_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &message_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 begin_time = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_begin_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &begin_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 end_time = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_end_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &end_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 raw_size = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_raw_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &raw_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChunkHeaderCache)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChunkHeaderCache)
+  return false;
+#undef DO_
+}
+
+void ChunkHeaderCache::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChunkHeaderCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->message_number(), output);
+  }
+
+  // optional uint64 begin_time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->begin_time(), output);
+  }
+
+  // optional uint64 end_time = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->end_time(), output);
+  }
+
+  // optional uint64 raw_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->raw_size(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChunkHeaderCache)
+}
+
+::google::protobuf::uint8* ChunkHeaderCache::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChunkHeaderCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->message_number(), target);
+  }
+
+  // optional uint64 begin_time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->begin_time(), target);
+  }
+
+  // optional uint64 end_time = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->end_time(), target);
+  }
+
+  // optional uint64 raw_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->raw_size(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChunkHeaderCache)
+  return target;
+}
+
+size_t ChunkHeaderCache::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChunkHeaderCache)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 15u) {
+    // optional uint64 message_number = 1;
+    if (has_message_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->message_number());
+    }
+
+    // optional uint64 begin_time = 2;
+    if (has_begin_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->begin_time());
+    }
+
+    // optional uint64 end_time = 3;
+    if (has_end_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->end_time());
+    }
+
+    // optional uint64 raw_size = 4;
+    if (has_raw_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->raw_size());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChunkHeaderCache::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChunkHeaderCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChunkHeaderCache* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkHeaderCache>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChunkHeaderCache)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChunkHeaderCache)
+    MergeFrom(*source);
+  }
+}
+
+void ChunkHeaderCache::MergeFrom(const ChunkHeaderCache& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChunkHeaderCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      message_number_ = from.message_number_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      begin_time_ = from.begin_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      end_time_ = from.end_time_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      raw_size_ = from.raw_size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void ChunkHeaderCache::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChunkHeaderCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChunkHeaderCache::CopyFrom(const ChunkHeaderCache& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChunkHeaderCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkHeaderCache::IsInitialized() const {
+  return true;
+}
+
+void ChunkHeaderCache::Swap(ChunkHeaderCache* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChunkHeaderCache::InternalSwap(ChunkHeaderCache* other) {
+  using std::swap;
+  swap(message_number_, other->message_number_);
+  swap(begin_time_, other->begin_time_);
+  swap(end_time_, other->end_time_);
+  swap(raw_size_, other->raw_size_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChunkHeaderCache::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChunkBodyCache::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChunkBodyCache::kMessageNumberFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChunkBodyCache::ChunkBodyCache()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChunkBodyCache();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChunkBodyCache)
+}
+ChunkBodyCache::ChunkBodyCache(const ChunkBodyCache& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  message_number_ = from.message_number_;
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChunkBodyCache)
+}
+
+void ChunkBodyCache::SharedCtor() {
+  _cached_size_ = 0;
+  message_number_ = GOOGLE_ULONGLONG(0);
+}
+
+ChunkBodyCache::~ChunkBodyCache() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChunkBodyCache)
+  SharedDtor();
+}
+
+void ChunkBodyCache::SharedDtor() {
+}
+
+void ChunkBodyCache::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChunkBodyCache::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChunkBodyCache& ChunkBodyCache::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChunkBodyCache();
+  return *internal_default_instance();
+}
+
+ChunkBodyCache* ChunkBodyCache::New(::google::protobuf::Arena* arena) const {
+  ChunkBodyCache* n = new ChunkBodyCache;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChunkBodyCache::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChunkBodyCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  message_number_ = GOOGLE_ULONGLONG(0);
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChunkBodyCache::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChunkBodyCache)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint64 message_number = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_message_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &message_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChunkBodyCache)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChunkBodyCache)
+  return false;
+#undef DO_
+}
+
+void ChunkBodyCache::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChunkBodyCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->message_number(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChunkBodyCache)
+}
+
+::google::protobuf::uint8* ChunkBodyCache::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChunkBodyCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->message_number(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChunkBodyCache)
+  return target;
+}
+
+size_t ChunkBodyCache::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChunkBodyCache)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // optional uint64 message_number = 1;
+  if (has_message_number()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->message_number());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChunkBodyCache::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChunkBodyCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChunkBodyCache* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkBodyCache>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChunkBodyCache)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChunkBodyCache)
+    MergeFrom(*source);
+  }
+}
+
+void ChunkBodyCache::MergeFrom(const ChunkBodyCache& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChunkBodyCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_message_number()) {
+    set_message_number(from.message_number());
+  }
+}
+
+void ChunkBodyCache::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChunkBodyCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChunkBodyCache::CopyFrom(const ChunkBodyCache& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChunkBodyCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkBodyCache::IsInitialized() const {
+  return true;
+}
+
+void ChunkBodyCache::Swap(ChunkBodyCache* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChunkBodyCache::InternalSwap(ChunkBodyCache* other) {
+  using std::swap;
+  swap(message_number_, other->message_number_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChunkBodyCache::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChannelCache::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChannelCache::kMessageNumberFieldNumber;
+const int ChannelCache::kNameFieldNumber;
+const int ChannelCache::kMessageTypeFieldNumber;
+const int ChannelCache::kProtoDescFieldNumber;
+const int ChannelCache::kDroppedNumberFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChannelCache::ChannelCache()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChannelCache();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChannelCache)
+}
+ChannelCache::ChannelCache(const ChannelCache& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_name()) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  message_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_message_type()) {
+    message_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_type_);
+  }
+  proto_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_proto_desc()) {
+    proto_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.proto_desc_);
+  }
+  ::memcpy(&message_number_, &from.message_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&dropped_number_) -
+    reinterpret_cast<char*>(&message_number_)) + sizeof(dropped_number_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChannelCache)
+}
+
+void ChannelCache::SharedCtor() {
+  _cached_size_ = 0;
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  proto_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&message_number_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&dropped_number_) -
+      reinterpret_cast<char*>(&message_number_)) + sizeof(dropped_number_));
+}
+
+ChannelCache::~ChannelCache() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChannelCache)
+  SharedDtor();
+}
+
+void ChannelCache::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_type_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  proto_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void ChannelCache::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChannelCache::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChannelCache& ChannelCache::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChannelCache();
+  return *internal_default_instance();
+}
+
+ChannelCache* ChannelCache::New(::google::protobuf::Arena* arena) const {
+  ChannelCache* n = new ChannelCache;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChannelCache::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChannelCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*name_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!message_type_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*message_type_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(!proto_desc_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*proto_desc_.UnsafeRawStringPointer())->clear();
+    }
+  }
+  if (cached_has_bits & 24u) {
+    ::memset(&message_number_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&dropped_number_) -
+        reinterpret_cast<char*>(&message_number_)) + sizeof(dropped_number_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChannelCache::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChannelCache)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint64 message_number = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_message_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &message_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string name = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.ChannelCache.name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string message_type = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_message_type()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->message_type().data(), static_cast<int>(this->message_type().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.ChannelCache.message_type");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes proto_desc = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_proto_desc()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 dropped_number = 5 [default = 0];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          set_has_dropped_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &dropped_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChannelCache)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChannelCache)
+  return false;
+#undef DO_
+}
+
+void ChannelCache::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChannelCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->message_number(), output);
+  }
+
+  // optional string name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelCache.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->name(), output);
+  }
+
+  // optional string message_type = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->message_type().data(), static_cast<int>(this->message_type().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelCache.message_type");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->message_type(), output);
+  }
+
+  // optional bytes proto_desc = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->proto_desc(), output);
+  }
+
+  // optional uint64 dropped_number = 5 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->dropped_number(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChannelCache)
+}
+
+::google::protobuf::uint8* ChannelCache::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChannelCache)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 message_number = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->message_number(), target);
+  }
+
+  // optional string name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelCache.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->name(), target);
+  }
+
+  // optional string message_type = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->message_type().data(), static_cast<int>(this->message_type().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelCache.message_type");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->message_type(), target);
+  }
+
+  // optional bytes proto_desc = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->proto_desc(), target);
+  }
+
+  // optional uint64 dropped_number = 5 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->dropped_number(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChannelCache)
+  return target;
+}
+
+size_t ChannelCache::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChannelCache)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 31u) {
+    // optional string name = 2;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+    // optional string message_type = 3;
+    if (has_message_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->message_type());
+    }
+
+    // optional bytes proto_desc = 4;
+    if (has_proto_desc()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->proto_desc());
+    }
+
+    // optional uint64 message_number = 1;
+    if (has_message_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->message_number());
+    }
+
+    // optional uint64 dropped_number = 5 [default = 0];
+    if (has_dropped_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->dropped_number());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChannelCache::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChannelCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChannelCache* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChannelCache>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChannelCache)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChannelCache)
+    MergeFrom(*source);
+  }
+}
+
+void ChannelCache::MergeFrom(const ChannelCache& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChannelCache)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 31u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_name();
+      name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_message_type();
+      message_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_type_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      set_has_proto_desc();
+      proto_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.proto_desc_);
+    }
+    if (cached_has_bits & 0x00000008u) {
+      message_number_ = from.message_number_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      dropped_number_ = from.dropped_number_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void ChannelCache::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChannelCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChannelCache::CopyFrom(const ChannelCache& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChannelCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelCache::IsInitialized() const {
+  return true;
+}
+
+void ChannelCache::Swap(ChannelCache* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChannelCache::InternalSwap(ChannelCache* other) {
+  using std::swap;
+  name_.Swap(&other->name_);
+  message_type_.Swap(&other->message_type_);
+  proto_desc_.Swap(&other->proto_desc_);
+  swap(message_number_, other->message_number_);
+  swap(dropped_number_, other->dropped_number_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChannelCache::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void SingleMessage::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SingleMessage::kChannelNameFieldNumber;
+const int SingleMessage::kTimeFieldNumber;
+const int SingleMessage::kContentFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SingleMessage::SingleMessage()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsSingleMessage();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.SingleMessage)
+}
+SingleMessage::SingleMessage(const SingleMessage& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  channel_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_channel_name()) {
+    channel_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.channel_name_);
+  }
+  content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_content()) {
+    content_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.content_);
+  }
+  time_ = from.time_;
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.SingleMessage)
+}
+
+void SingleMessage::SharedCtor() {
+  _cached_size_ = 0;
+  channel_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  time_ = GOOGLE_ULONGLONG(0);
+}
+
+SingleMessage::~SingleMessage() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.SingleMessage)
+  SharedDtor();
+}
+
+void SingleMessage::SharedDtor() {
+  channel_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  content_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void SingleMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SingleMessage::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const SingleMessage& SingleMessage::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsSingleMessage();
+  return *internal_default_instance();
+}
+
+SingleMessage* SingleMessage::New(::google::protobuf::Arena* arena) const {
+  SingleMessage* n = new SingleMessage;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SingleMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.SingleMessage)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 3u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!channel_name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*channel_name_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!content_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*content_.UnsafeRawStringPointer())->clear();
+    }
+  }
+  time_ = GOOGLE_ULONGLONG(0);
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool SingleMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.SingleMessage)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string channel_name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_channel_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->channel_name().data(), static_cast<int>(this->channel_name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.SingleMessage.channel_name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 time = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes content = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_content()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.SingleMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.SingleMessage)
+  return false;
+#undef DO_
+}
+
+void SingleMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.SingleMessage)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string channel_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->channel_name().data(), static_cast<int>(this->channel_name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SingleMessage.channel_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->channel_name(), output);
+  }
+
+  // optional uint64 time = 2;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->time(), output);
+  }
+
+  // optional bytes content = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->content(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.SingleMessage)
+}
+
+::google::protobuf::uint8* SingleMessage::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.SingleMessage)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string channel_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->channel_name().data(), static_cast<int>(this->channel_name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SingleMessage.channel_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->channel_name(), target);
+  }
+
+  // optional uint64 time = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->time(), target);
+  }
+
+  // optional bytes content = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->content(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.SingleMessage)
+  return target;
+}
+
+size_t SingleMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.SingleMessage)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional string channel_name = 1;
+    if (has_channel_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->channel_name());
+    }
+
+    // optional bytes content = 3;
+    if (has_content()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->content());
+    }
+
+    // optional uint64 time = 2;
+    if (has_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->time());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SingleMessage::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.SingleMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SingleMessage* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SingleMessage>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.SingleMessage)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.SingleMessage)
+    MergeFrom(*source);
+  }
+}
+
+void SingleMessage::MergeFrom(const SingleMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.SingleMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_channel_name();
+      channel_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.channel_name_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_content();
+      content_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.content_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      time_ = from.time_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void SingleMessage::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.SingleMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SingleMessage::CopyFrom(const SingleMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.SingleMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SingleMessage::IsInitialized() const {
+  return true;
+}
+
+void SingleMessage::Swap(SingleMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SingleMessage::InternalSwap(SingleMessage* other) {
+  using std::swap;
+  channel_name_.Swap(&other->channel_name_);
+  content_.Swap(&other->content_);
+  swap(time_, other->time_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SingleMessage::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void Header::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Header::kMajorVersionFieldNumber;
+const int Header::kMinorVersionFieldNumber;
+const int Header::kCompressFieldNumber;
+const int Header::kChunkIntervalFieldNumber;
+const int Header::kSegmentIntervalFieldNumber;
+const int Header::kIndexPositionFieldNumber;
+const int Header::kChunkNumberFieldNumber;
+const int Header::kChannelNumberFieldNumber;
+const int Header::kBeginTimeFieldNumber;
+const int Header::kEndTimeFieldNumber;
+const int Header::kMessageNumberFieldNumber;
+const int Header::kSizeFieldNumber;
+const int Header::kIsCompleteFieldNumber;
+const int Header::kChunkRawSizeFieldNumber;
+const int Header::kSegmentRawSizeFieldNumber;
+const int Header::kTimeIndexFieldNumber;
+const int Header::kTimeIndexPositionFieldNumber;
+const int Header::kCheckpointPositionFieldNumber;
+const int Header::kCheckpointChunkNumberFieldNumber;
+const int Header::kCheckpointIntervalFieldNumber;
+const int Header::kDroppedNumberFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Header::Header()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsHeader();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.Header)
+}
+Header::Header(const Header& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&major_version_, &from.major_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&dropped_number_) -
+    reinterpret_cast<char*>(&major_version_)) + sizeof(dropped_number_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.Header)
+}
+
+void Header::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&major_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&dropped_number_) -
+      reinterpret_cast<char*>(&major_version_)) + sizeof(dropped_number_));
+}
+
+Header::~Header() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.Header)
+  SharedDtor();
+}
+
+void Header::SharedDtor() {
+}
+
+void Header::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Header::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const Header& Header::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsHeader();
+  return *internal_default_instance();
+}
+
+Header* Header::New(::google::protobuf::Arena* arena) const {
+  Header* n = new Header;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Header::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.Header)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 255u) {
+    ::memset(&major_version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&begin_time_) -
+        reinterpret_cast<char*>(&major_version_)) + sizeof(begin_time_));
+  }
+  if (cached_has_bits & 65280u) {
+    ::memset(&end_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&segment_raw_size_) -
+        reinterpret_cast<char*>(&end_time_)) + sizeof(segment_raw_size_));
+  }
+  if (cached_has_bits & 2031616u) {
+    ::memset(&time_index_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&dropped_number_) -
+        reinterpret_cast<char*>(&time_index_position_)) + sizeof(dropped_number_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool Header::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.Header)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint32 major_version = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_major_version();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &major_version_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 minor_version = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_minor_version();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &minor_version_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.CompressType compress = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::CompressType_IsValid(value)) {
+            set_compress(static_cast< ::apollo::cyber::proto::CompressType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                3, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 chunk_interval = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_chunk_interval();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &chunk_interval_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 segment_interval = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          set_has_segment_interval();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &segment_interval_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 index_position = 6 [default = 0];
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+          set_has_index_position();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &index_position_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 chunk_number = 7 [default = 0];
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+          set_has_chunk_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &chunk_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 channel_number = 8 [default = 0];
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+          set_has_channel_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &channel_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 begin_time = 9 [default = 0];
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+          set_has_begin_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &begin_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 end_time = 10 [default = 0];
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+          set_has_end_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &end_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 message_number = 11 [default = 0];
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(88u /* 88 & 0xFF */)) {
+          set_has_message_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &message_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 size = 12 [default = 0];
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(96u /* 96 & 0xFF */)) {
+          set_has_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool is_complete = 13 [default = false];
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+          set_has_is_complete();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &is_complete_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 chunk_raw_size = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(112u /* 112 & 0xFF */)) {
+          set_has_chunk_raw_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &chunk_raw_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 segment_raw_size = 15;
+      case 15: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(120u /* 120 & 0xFF */)) {
+          set_has_segment_raw_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &segment_raw_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool time_index = 16 [default = false];
+      case 16: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(128u /* 128 & 0xFF */)) {
+          set_has_time_index();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &time_index_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 time_index_position = 17 [default = 0];
+      case 17: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(136u /* 136 & 0xFF */)) {
+          set_has_time_index_position();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &time_index_position_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 checkpoint_position = 18 [default = 0];
+      case 18: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(144u /* 144 & 0xFF */)) {
+          set_has_checkpoint_position();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &checkpoint_position_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 checkpoint_chunk_number = 19 [default = 0];
+      case 19: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(152u /* 152 & 0xFF */)) {
+          set_has_checkpoint_chunk_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &checkpoint_chunk_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 checkpoint_interval = 20 [default = 0];
+      case 20: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(160u /* 160 & 0xFF */)) {
+          set_has_checkpoint_interval();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &checkpoint_interval_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 dropped_number = 21 [default = 0];
+      case 21: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(168u /* 168 & 0xFF */)) {
+          set_has_dropped_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &dropped_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.Header)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.Header)
+  return false;
+#undef DO_
+}
+
+void Header::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.Header)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 major_version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->major_version(), output);
+  }
+
+  // optional uint32 minor_version = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->minor_version(), output);
+  }
+
+  // optional .apollo.cyber.proto.CompressType compress = 3;
+  if (cached_has_bits & 0x00000200u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->compress(), output);
+  }
+
+  // optional uint64 chunk_interval = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->chunk_interval(), output);
+  }
+
+  // optional uint64 segment_interval = 5;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->segment_interval(), output);
+  }
+
+  // optional uint64 index_position = 6 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->index_position(), output);
+  }
+
+  // optional uint64 chunk_number = 7 [default = 0];
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->chunk_number(), output);
+  }
+
+  // optional uint64 channel_number = 8 [default = 0];
+  if (cached_has_bits & 0x00000040u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->channel_number(), output);
+  }
+
+  // optional uint64 begin_time = 9 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->begin_time(), output);
+  }
+
+  // optional uint64 end_time = 10 [default = 0];
+  if (cached_has_bits & 0x00000100u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->end_time(), output);
+  }
+
+  // optional uint64 message_number = 11 [default = 0];
+  if (cached_has_bits & 0x00001000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(11, this->message_number(), output);
+  }
+
+  // optional uint64 size = 12 [default = 0];
+  if (cached_has_bits & 0x00002000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(12, this->size(), output);
+  }
+
+  // optional bool is_complete = 13 [default = false];
+  if (cached_has_bits & 0x00000400u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->is_complete(), output);
+  }
+
+  // optional uint64 chunk_raw_size = 14;
+  if (cached_has_bits & 0x00004000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(14, this->chunk_raw_size(), output);
+  }
+
+  // optional uint64 segment_raw_size = 15;
+  if (cached_has_bits & 0x00008000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(15, this->segment_raw_size(), output);
+  }
+
+  // optional bool time_index = 16 [default = false];
+  if (cached_has_bits & 0x00000800u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(16, this->time_index(), output);
+  }
+
+  // optional uint64 time_index_position = 17 [default = 0];
+  if (cached_has_bits & 0x00010000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(17, this->time_index_position(), output);
+  }
+
+  // optional uint64 checkpoint_position = 18 [default = 0];
+  if (cached_has_bits & 0x00020000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(18, this->checkpoint_position(), output);
+  }
+
+  // optional uint64 checkpoint_chunk_number = 19 [default = 0];
+  if (cached_has_bits & 0x00040000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(19, this->checkpoint_chunk_number(), output);
+  }
+
+  // optional uint64 checkpoint_interval = 20 [default = 0];
+  if (cached_has_bits & 0x00080000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(20, this->checkpoint_interval(), output);
+  }
+
+  // optional uint64 dropped_number = 21 [default = 0];
+  if (cached_has_bits & 0x00100000u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(21, this->dropped_number(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.Header)
+}
+
+::google::protobuf::uint8* Header::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.Header)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 major_version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->major_version(), target);
+  }
+
+  // optional uint32 minor_version = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->minor_version(), target);
+  }
+
+  // optional .apollo.cyber.proto.CompressType compress = 3;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->compress(), target);
+  }
+
+  // optional uint64 chunk_interval = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->chunk_interval(), target);
+  }
+
+  // optional uint64 segment_interval = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->segment_interval(), target);
+  }
+
+  // optional uint64 index_position = 6 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->index_position(), target);
+  }
+
+  // optional uint64 chunk_number = 7 [default = 0];
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->chunk_number(), target);
+  }
+
+  // optional uint64 channel_number = 8 [default = 0];
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->channel_number(), target);
+  }
+
+  // optional uint64 begin_time = 9 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->begin_time(), target);
+  }
+
+  // optional uint64 end_time = 10 [default = 0];
+  if (cached_has_bits & 0x00000100u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->end_time(), target);
+  }
+
+  // optional uint64 message_number = 11 [default = 0];
+  if (cached_has_bits & 0x00001000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(11, this->message_number(), target);
+  }
+
+  // optional uint64 size = 12 [default = 0];
+  if (cached_has_bits & 0x00002000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(12, this->size(), target);
+  }
+
+  // optional bool is_complete = 13 [default = false];
+  if (cached_has_bits & 0x00000400u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(13, this->is_complete(), target);
+  }
+
+  // optional uint64 chunk_raw_size = 14;
+  if (cached_has_bits & 0x00004000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(14, this->chunk_raw_size(), target);
+  }
+
+  // optional uint64 segment_raw_size = 15;
+  if (cached_has_bits & 0x00008000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(15, this->segment_raw_size(), target);
+  }
+
+  // optional bool time_index = 16 [default = false];
+  if (cached_has_bits & 0x00000800u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(16, this->time_index(), target);
+  }
+
+  // optional uint64 time_index_position = 17 [default = 0];
+  if (cached_has_bits & 0x00010000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(17, this->time_index_position(), target);
+  }
+
+  // optional uint64 checkpoint_position = 18 [default = 0];
+  if (cached_has_bits & 0x00020000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(18, this->checkpoint_position(), target);
+  }
+
+  // optional uint64 checkpoint_chunk_number = 19 [default = 0];
+  if (cached_has_bits & 0x00040000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(19, this->checkpoint_chunk_number(), target);
+  }
+
+  // optional uint64 checkpoint_interval = 20 [default = 0];
+  if (cached_has_bits & 0x00080000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(20, this->checkpoint_interval(), target);
+  }
+
+  // optional uint64 dropped_number = 21 [default = 0];
+  if (cached_has_bits & 0x00100000u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(21, this->dropped_number(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.Header)
+  return target;
+}
+
+size_t Header::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.Header)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 255u) {
+    // optional uint32 major_version = 1;
+    if (has_major_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->major_version());
+    }
+
+    // optional uint32 minor_version = 2;
+    if (has_minor_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->minor_version());
+    }
+
+    // optional uint64 chunk_interval = 4;
+    if (has_chunk_interval()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->chunk_interval());
+    }
+
+    // optional uint64 segment_interval = 5;
+    if (has_segment_interval()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->segment_interval());
+    }
+
+    // optional uint64 index_position = 6 [default = 0];
+    if (has_index_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->index_position());
+    }
+
+    // optional uint64 chunk_number = 7 [default = 0];
+    if (has_chunk_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->chunk_number());
+    }
+
+    // optional uint64 channel_number = 8 [default = 0];
+    if (has_channel_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->channel_number());
+    }
+
+    // optional uint64 begin_time = 9 [default = 0];
+    if (has_begin_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->begin_time());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & 65280u) {
+    // optional uint64 end_time = 10 [default = 0];
+    if (has_end_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->end_time());
+    }
+
+    // optional .apollo.cyber.proto.CompressType compress = 3;
+    if (has_compress()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->compress());
+    }
+
+    // optional bool is_complete = 13 [default = false];
+    if (has_is_complete()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool time_index = 16 [default = false];
+    if (has_time_index()) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint64 message_number = 11 [default = 0];
+    if (has_message_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->message_number());
+    }
+
+    // optional uint64 size = 12 [default = 0];
+    if (has_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->size());
+    }
+
+    // optional uint64 chunk_raw_size = 14;
+    if (has_chunk_raw_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->chunk_raw_size());
+    }
+
+    // optional uint64 segment_raw_size = 15;
+    if (has_segment_raw_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->segment_raw_size());
+    }
+
+  }
+  if (_has_bits_[16 / 32] & 2031616u) {
+    // optional uint64 time_index_position = 17 [default = 0];
+    if (has_time_index_position()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->time_index_position());
+    }
+
+    // optional uint64 checkpoint_position = 18 [default = 0];
+    if (has_checkpoint_position()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->checkpoint_position());
+    }
+
+    // optional uint64 checkpoint_chunk_number = 19 [default = 0];
+    if (has_checkpoint_chunk_number()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->checkpoint_chunk_number());
+    }
+
+    // optional uint64 checkpoint_interval = 20 [default = 0];
+    if (has_checkpoint_interval()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->checkpoint_interval());
+    }
+
+    // optional uint64 dropped_number = 21 [default = 0];
+    if (has_dropped_number()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->dropped_number());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Header::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.Header)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Header* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const Header>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.Header)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.Header)
+    MergeFrom(*source);
+  }
+}
+
+void Header::MergeFrom(const Header& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.Header)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 255u) {
+    if (cached_has_bits & 0x00000001u) {
+      major_version_ = from.major_version_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      minor_version_ = from.minor_version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      chunk_interval_ = from.chunk_interval_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      segment_interval_ = from.segment_interval_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      index_position_ = from.index_position_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      chunk_number_ = from.chunk_number_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      channel_number_ = from.channel_number_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      begin_time_ = from.begin_time_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 65280u) {
+    if (cached_has_bits & 0x00000100u) {
+      end_time_ = from.end_time_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      compress_ = from.compress_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      is_complete_ = from.is_complete_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      time_index_ = from.time_index_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      message_number_ = from.message_number_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      size_ = from.size_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      chunk_raw_size_ = from.chunk_raw_size_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      segment_raw_size_ = from.segment_raw_size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 2031616u) {
+    if (cached_has_bits & 0x00010000u) {
+      time_index_position_ = from.time_index_position_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      checkpoint_position_ = from.checkpoint_position_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      checkpoint_chunk_number_ = from.checkpoint_chunk_number_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      checkpoint_interval_ = from.checkpoint_interval_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      dropped_number_ = from.dropped_number_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void Header::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.Header)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Header::CopyFrom(const Header& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.Header)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Header::IsInitialized() const {
+  return true;
+}
+
+void Header::Swap(Header* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Header::InternalSwap(Header* other) {
+  using std::swap;
+  swap(major_version_, other->major_version_);
+  swap(minor_version_, other->minor_version_);
+  swap(chunk_interval_, other->chunk_interval_);
+  swap(segment_interval_, other->segment_interval_);
+  swap(index_position_, other->index_position_);
+  swap(chunk_number_, other->chunk_number_);
+  swap(channel_number_, other->channel_number_);
+  swap(begin_time_, other->begin_time_);
+  swap(end_time_, other->end_time_);
+  swap(compress_, other->compress_);
+  swap(is_complete_, other->is_complete_);
+  swap(time_index_, other->time_index_);
+  swap(message_number_, other->message_number_);
+  swap(size_, other->size_);
+  swap(chunk_raw_size_, other->chunk_raw_size_);
+  swap(segment_raw_size_, other->segment_raw_size_);
+  swap(time_index_position_, other->time_index_position_);
+  swap(checkpoint_position_, other->checkpoint_position_);
+  swap(checkpoint_chunk_number_, other->checkpoint_chunk_number_);
+  swap(checkpoint_interval_, other->checkpoint_interval_);
+  swap(dropped_number_, other->dropped_number_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata Header::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void Channel::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Channel::kNameFieldNumber;
+const int Channel::kMessageTypeFieldNumber;
+const int Channel::kProtoDescFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Channel::Channel()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChannel();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.Channel)
+}
+Channel::Channel(const Channel& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_name()) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  message_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_message_type()) {
+    message_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_type_);
+  }
+  proto_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_proto_desc()) {
+    proto_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.proto_desc_);
+  }
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.Channel)
+}
+
+void Channel::SharedCtor() {
+  _cached_size_ = 0;
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  proto_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+Channel::~Channel() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.Channel)
+  SharedDtor();
+}
+
+void Channel::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_type_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  proto_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void Channel::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Channel::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const Channel& Channel::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChannel();
+  return *internal_default_instance();
+}
+
+Channel* Channel::New(::google::protobuf::Arena* arena) const {
+  Channel* n = new Channel;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Channel::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.Channel)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*name_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!message_type_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*message_type_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(!proto_desc_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*proto_desc_.UnsafeRawStringPointer())->clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool Channel::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.Channel)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.Channel.name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string message_type = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_message_type()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->message_type().data(), static_cast<int>(this->message_type().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.Channel.message_type");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes proto_desc = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_proto_desc()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.Channel)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.Channel)
+  return false;
+#undef DO_
+}
+
+void Channel::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.Channel)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.Channel.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // optional string message_type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->message_type().data(), static_cast<int>(this->message_type().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.Channel.message_type");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->message_type(), output);
+  }
+
+  // optional bytes proto_desc = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->proto_desc(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.Channel)
+}
+
+::google::protobuf::uint8* Channel::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.Channel)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.Channel.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // optional string message_type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->message_type().data(), static_cast<int>(this->message_type().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.Channel.message_type");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->message_type(), target);
+  }
+
+  // optional bytes proto_desc = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->proto_desc(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.Channel)
+  return target;
+}
+
+size_t Channel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.Channel)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional string name = 1;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+    // optional string message_type = 2;
+    if (has_message_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->message_type());
+    }
+
+    // optional bytes proto_desc = 3;
+    if (has_proto_desc()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->proto_desc());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Channel::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.Channel)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Channel* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const Channel>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.Channel)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.Channel)
+    MergeFrom(*source);
+  }
+}
+
+void Channel::MergeFrom(const Channel& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.Channel)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_name();
+      name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_message_type();
+      message_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_type_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      set_has_proto_desc();
+      proto_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.proto_desc_);
+    }
+  }
+}
+
+void Channel::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.Channel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Channel::CopyFrom(const Channel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.Channel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Channel::IsInitialized() const {
+  return true;
+}
+
+void Channel::Swap(Channel* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Channel::InternalSwap(Channel* other) {
+  using std::swap;
+  name_.Swap(&other->name_);
+  message_type_.Swap(&other->message_type_);
+  proto_desc_.Swap(&other->proto_desc_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata Channel::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChunkHeader::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChunkHeader::kBeginTimeFieldNumber;
+const int ChunkHeader::kEndTimeFieldNumber;
+const int ChunkHeader::kMessageNumberFieldNumber;
+const int ChunkHeader::kRawSizeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChunkHeader::ChunkHeader()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChunkHeader();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChunkHeader)
+}
+ChunkHeader::ChunkHeader(const ChunkHeader& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&begin_time_, &from.begin_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&raw_size_) -
+    reinterpret_cast<char*>(&begin_time_)) + sizeof(raw_size_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChunkHeader)
+}
+
+void ChunkHeader::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&begin_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&raw_size_) -
+      reinterpret_cast<char*>(&begin_time_)) + sizeof(raw_size_));
+}
+
+ChunkHeader::~ChunkHeader() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChunkHeader)
+  SharedDtor();
+}
+
+void ChunkHeader::SharedDtor() {
+}
+
+void ChunkHeader::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChunkHeader::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChunkHeader& ChunkHeader::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChunkHeader();
+  return *internal_default_instance();
+}
+
+ChunkHeader* ChunkHeader::New(::google::protobuf::Arena* arena) const {
+  ChunkHeader* n = new ChunkHeader;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChunkHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChunkHeader)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 15u) {
+    ::memset(&begin_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&raw_size_) -
+        reinterpret_cast<char*>(&begin_time_)) + sizeof(raw_size_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChunkHeader::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChunkHeader)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint64 begin_time = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_begin_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &begin_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 end_time = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_end_time();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &end_time_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 message_number = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_message_number();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &message_number_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 raw_size = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_raw_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &raw_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChunkHeader)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChunkHeader)
+  return false;
+#undef DO_
+}
+
+void ChunkHeader::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChunkHeader)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 begin_time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->begin_time(), output);
+  }
+
+  // optional uint64 end_time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->end_time(), output);
+  }
+
+  // optional uint64 message_number = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->message_number(), output);
+  }
+
+  // optional uint64 raw_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->raw_size(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChunkHeader)
+}
+
+::google::protobuf::uint8* ChunkHeader::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChunkHeader)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 begin_time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->begin_time(), target);
+  }
+
+  // optional uint64 end_time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->end_time(), target);
+  }
+
+  // optional uint64 message_number = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->message_number(), target);
+  }
+
+  // optional uint64 raw_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->raw_size(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChunkHeader)
+  return target;
+}
+
+size_t ChunkHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChunkHeader)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 15u) {
+    // optional uint64 begin_time = 1;
+    if (has_begin_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->begin_time());
+    }
+
+    // optional uint64 end_time = 2;
+    if (has_end_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->end_time());
+    }
+
+    // optional uint64 message_number = 3;
+    if (has_message_number()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->message_number());
+    }
+
+    // optional uint64 raw_size = 4;
+    if (has_raw_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->raw_size());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChunkHeader::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChunkHeader)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChunkHeader* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkHeader>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChunkHeader)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChunkHeader)
+    MergeFrom(*source);
+  }
+}
+
+void ChunkHeader::MergeFrom(const ChunkHeader& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChunkHeader)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      begin_time_ = from.begin_time_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      end_time_ = from.end_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      message_number_ = from.message_number_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      raw_size_ = from.raw_size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void ChunkHeader::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChunkHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChunkHeader::CopyFrom(const ChunkHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChunkHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkHeader::IsInitialized() const {
+  return true;
+}
+
+void ChunkHeader::Swap(ChunkHeader* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChunkHeader::InternalSwap(ChunkHeader* other) {
+  using std::swap;
+  swap(begin_time_, other->begin_time_);
+  swap(end_time_, other->end_time_);
+  swap(message_number_, other->message_number_);
+  swap(raw_size_, other->raw_size_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChunkHeader::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChunkBody::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChunkBody::kMessagesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChunkBody::ChunkBody()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChunkBody();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChunkBody)
+}
+ChunkBody::ChunkBody(const ChunkBody& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      messages_(from.messages_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChunkBody)
+}
+
+void ChunkBody::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+ChunkBody::~ChunkBody() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChunkBody)
+  SharedDtor();
+}
+
+void ChunkBody::SharedDtor() {
+}
+
+void ChunkBody::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChunkBody::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChunkBody& ChunkBody::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChunkBody();
+  return *internal_default_instance();
+}
+
+ChunkBody* ChunkBody::New(::google::protobuf::Arena* arena) const {
+  ChunkBody* n = new ChunkBody;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChunkBody::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChunkBody)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  messages_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChunkBody::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChunkBody)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .apollo.cyber.proto.SingleMessage messages = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_messages()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChunkBody)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChunkBody)
+  return false;
+#undef DO_
+}
+
+void ChunkBody::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChunkBody)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.SingleMessage messages = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->messages_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->messages(static_cast<int>(i)), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChunkBody)
+}
+
+::google::protobuf::uint8* ChunkBody::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChunkBody)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.SingleMessage messages = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->messages_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, this->messages(static_cast<int>(i)), deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChunkBody)
+  return target;
+}
+
+size_t ChunkBody::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChunkBody)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated .apollo.cyber.proto.SingleMessage messages = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->messages_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->messages(static_cast<int>(i)));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChunkBody::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChunkBody)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChunkBody* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkBody>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChunkBody)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChunkBody)
+    MergeFrom(*source);
+  }
+}
+
+void ChunkBody::MergeFrom(const ChunkBody& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChunkBody)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  messages_.MergeFrom(from.messages_);
+}
+
+void ChunkBody::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChunkBody)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChunkBody::CopyFrom(const ChunkBody& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChunkBody)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkBody::IsInitialized() const {
+  return true;
+}
+
+void ChunkBody::Swap(ChunkBody* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChunkBody::InternalSwap(ChunkBody* other) {
+  using std::swap;
+  messages_.InternalSwap(&other->messages_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChunkBody::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void Index::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int Index::kIndexesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+Index::Index()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsIndex();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.Index)
+}
+Index::Index(const Index& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      indexes_(from.indexes_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.Index)
+}
+
+void Index::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+Index::~Index() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.Index)
+  SharedDtor();
+}
+
+void Index::SharedDtor() {
+}
+
+void Index::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Index::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const Index& Index::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsIndex();
+  return *internal_default_instance();
+}
+
+Index* Index::New(::google::protobuf::Arena* arena) const {
+  Index* n = new Index;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void Index::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.Index)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  indexes_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool Index::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.Index)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .apollo.cyber.proto.SingleIndex indexes = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_indexes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.Index)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.Index)
+  return false;
+#undef DO_
+}
+
+void Index::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.Index)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.SingleIndex indexes = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->indexes_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->indexes(static_cast<int>(i)), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.Index)
+}
+
+::google::protobuf::uint8* Index::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.Index)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.SingleIndex indexes = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->indexes_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, this->indexes(static_cast<int>(i)), deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.Index)
+  return target;
+}
+
+size_t Index::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.Index)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated .apollo.cyber.proto.SingleIndex indexes = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->indexes_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->indexes(static_cast<int>(i)));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Index::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.Index)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Index* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const Index>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.Index)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.Index)
+    MergeFrom(*source);
+  }
+}
+
+void Index::MergeFrom(const Index& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.Index)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  indexes_.MergeFrom(from.indexes_);
+}
+
+void Index::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.Index)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Index::CopyFrom(const Index& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.Index)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Index::IsInitialized() const {
+  return true;
+}
+
+void Index::Swap(Index* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void Index::InternalSwap(Index* other) {
+  using std::swap;
+  indexes_.InternalSwap(&other->indexes_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata Index::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void IndexCheckpoint::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_IndexCheckpoint_default_instance_._instance.get_mutable()->header_ = const_cast< ::apollo::cyber::proto::Header*>(
+      ::apollo::cyber::proto::Header::internal_default_instance());
+  ::apollo::cyber::proto::_IndexCheckpoint_default_instance_._instance.get_mutable()->index_ = const_cast< ::apollo::cyber::proto::Index*>(
+      ::apollo::cyber::proto::Index::internal_default_instance());
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int IndexCheckpoint::kHeaderFieldNumber;
+const int IndexCheckpoint::kIndexFieldNumber;
+const int IndexCheckpoint::kPreviousPositionFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+IndexCheckpoint::IndexCheckpoint()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsIndexCheckpoint();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.IndexCheckpoint)
+}
+IndexCheckpoint::IndexCheckpoint(const IndexCheckpoint& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::apollo::cyber::proto::Header(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_index()) {
+    index_ = new ::apollo::cyber::proto::Index(*from.index_);
+  } else {
+    index_ = NULL;
+  }
+  previous_position_ = from.previous_position_;
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.IndexCheckpoint)
+}
+
+void IndexCheckpoint::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&previous_position_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(previous_position_));
+}
+
+IndexCheckpoint::~IndexCheckpoint() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.IndexCheckpoint)
+  SharedDtor();
+}
+
+void IndexCheckpoint::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete index_;
+}
+
+void IndexCheckpoint::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* IndexCheckpoint::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const IndexCheckpoint& IndexCheckpoint::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsIndexCheckpoint();
+  return *internal_default_instance();
+}
+
+IndexCheckpoint* IndexCheckpoint::New(::google::protobuf::Arena* arena) const {
+  IndexCheckpoint* n = new IndexCheckpoint;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void IndexCheckpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.IndexCheckpoint)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 3u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(header_ != NULL);
+      header_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(index_ != NULL);
+      index_->Clear();
+    }
+  }
+  previous_position_ = GOOGLE_ULONGLONG(0);
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool IndexCheckpoint::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.IndexCheckpoint)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .apollo.cyber.proto.Header header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.Index index = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_index()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 previous_position = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_previous_position();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &previous_position_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.IndexCheckpoint)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.IndexCheckpoint)
+  return false;
+#undef DO_
+}
+
+void IndexCheckpoint::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.IndexCheckpoint)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.Header header = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // optional .apollo.cyber.proto.Index index = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->index_, output);
+  }
+
+  // optional uint64 previous_position = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->previous_position(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.IndexCheckpoint)
+}
+
+::google::protobuf::uint8* IndexCheckpoint::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.IndexCheckpoint)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .apollo.cyber.proto.Header header = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.Index index = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        2, *this->index_, deterministic, target);
+  }
+
+  // optional uint64 previous_position = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->previous_position(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.IndexCheckpoint)
+  return target;
+}
+
+size_t IndexCheckpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.IndexCheckpoint)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional .apollo.cyber.proto.Header header = 1;
+    if (has_header()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->header_);
+    }
+
+    // optional .apollo.cyber.proto.Index index = 2;
+    if (has_index()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->index_);
+    }
+
+    // optional uint64 previous_position = 3;
+    if (has_previous_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->previous_position());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void IndexCheckpoint::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.IndexCheckpoint)
+  GOOGLE_DCHECK_NE(&from, this);
+  const IndexCheckpoint* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const IndexCheckpoint>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.IndexCheckpoint)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.IndexCheckpoint)
+    MergeFrom(*source);
+  }
+}
+
+void IndexCheckpoint::MergeFrom(const IndexCheckpoint& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.IndexCheckpoint)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_header()->::apollo::cyber::proto::Header::MergeFrom(from.header());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      mutable_index()->::apollo::cyber::proto::Index::MergeFrom(from.index());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      previous_position_ = from.previous_position_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void IndexCheckpoint::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.IndexCheckpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void IndexCheckpoint::CopyFrom(const IndexCheckpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.IndexCheckpoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IndexCheckpoint::IsInitialized() const {
+  return true;
+}
+
+void IndexCheckpoint::Swap(IndexCheckpoint* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void IndexCheckpoint::InternalSwap(IndexCheckpoint* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(index_, other->index_);
+  swap(previous_position_, other->previous_position_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata IndexCheckpoint::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void ChannelTimeIndex::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChannelTimeIndex::kNameFieldNumber;
+const int ChannelTimeIndex::kTimeFieldNumber;
+const int ChannelTimeIndex::kChunkFieldNumber;
+const int ChannelTimeIndex::kOffsetFieldNumber;
+const int ChannelTimeIndex::kSizeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChannelTimeIndex::ChannelTimeIndex()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsChannelTimeIndex();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChannelTimeIndex)
+}
+ChannelTimeIndex::ChannelTimeIndex(const ChannelTimeIndex& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      time_(from.time_),
+      chunk_(from.chunk_),
+      offset_(from.offset_),
+      size_(from.size_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_name()) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChannelTimeIndex)
+}
+
+void ChannelTimeIndex::SharedCtor() {
+  _cached_size_ = 0;
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+ChannelTimeIndex::~ChannelTimeIndex() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChannelTimeIndex)
+  SharedDtor();
+}
+
+void ChannelTimeIndex::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void ChannelTimeIndex::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChannelTimeIndex::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChannelTimeIndex& ChannelTimeIndex::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsChannelTimeIndex();
+  return *internal_default_instance();
+}
+
+ChannelTimeIndex* ChannelTimeIndex::New(::google::protobuf::Arena* arena) const {
+  ChannelTimeIndex* n = new ChannelTimeIndex;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChannelTimeIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChannelTimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  time_.Clear();
+  chunk_.Clear();
+  offset_.Clear();
+  size_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(!name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+    (*name_.UnsafeRawStringPointer())->clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChannelTimeIndex::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChannelTimeIndex)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.ChannelTimeIndex.name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 time = 2 [packed = true];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_time())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 18u, input, this->mutable_time())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 chunk = 3 [packed = true];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_chunk())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 26u, input, this->mutable_chunk())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 offset = 4 [packed = true];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_offset())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 34u, input, this->mutable_offset())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 size = 5 [packed = true];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_size())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 42u, input, this->mutable_size())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChannelTimeIndex)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChannelTimeIndex)
+  return false;
+#undef DO_
+}
+
+void ChannelTimeIndex::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChannelTimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelTimeIndex.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // repeated uint64 time = 2 [packed = true];
+  if (this->time_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _time_cached_byte_size_));
+  }
+  for (int i = 0, n = this->time_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->time(i), output);
+  }
+
+  // repeated uint32 chunk = 3 [packed = true];
+  if (this->chunk_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _chunk_cached_byte_size_));
+  }
+  for (int i = 0, n = this->chunk_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->chunk(i), output);
+  }
+
+  // repeated uint64 offset = 4 [packed = true];
+  if (this->offset_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _offset_cached_byte_size_));
+  }
+  for (int i = 0, n = this->offset_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->offset(i), output);
+  }
+
+  // repeated uint32 size = 5 [packed = true];
+  if (this->size_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(5, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _size_cached_byte_size_));
+  }
+  for (int i = 0, n = this->size_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->size(i), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChannelTimeIndex)
+}
+
+::google::protobuf::uint8* ChannelTimeIndex::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChannelTimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.ChannelTimeIndex.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // repeated uint64 time = 2 [packed = true];
+  if (this->time_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _time_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->time_, target);
+  }
+
+  // repeated uint32 chunk = 3 [packed = true];
+  if (this->chunk_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _chunk_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->chunk_, target);
+  }
+
+  // repeated uint64 offset = 4 [packed = true];
+  if (this->offset_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _offset_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->offset_, target);
+  }
+
+  // repeated uint32 size = 5 [packed = true];
+  if (this->size_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      5,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _size_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32NoTagToArray(this->size_, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChannelTimeIndex)
+  return target;
+}
+
+size_t ChannelTimeIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChannelTimeIndex)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated uint64 time = 2 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->time_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _time_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated uint32 chunk = 3 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt32Size(this->chunk_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _chunk_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated uint64 offset = 4 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->offset_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _offset_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated uint32 size = 5 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt32Size(this->size_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _size_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // optional string name = 1;
+  if (has_name()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChannelTimeIndex::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChannelTimeIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChannelTimeIndex* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChannelTimeIndex>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChannelTimeIndex)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChannelTimeIndex)
+    MergeFrom(*source);
+  }
+}
+
+void ChannelTimeIndex::MergeFrom(const ChannelTimeIndex& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChannelTimeIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  time_.MergeFrom(from.time_);
+  chunk_.MergeFrom(from.chunk_);
+  offset_.MergeFrom(from.offset_);
+  size_.MergeFrom(from.size_);
+  if (from.has_name()) {
+    set_has_name();
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+}
+
+void ChannelTimeIndex::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChannelTimeIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChannelTimeIndex::CopyFrom(const ChannelTimeIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChannelTimeIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelTimeIndex::IsInitialized() const {
+  return true;
+}
+
+void ChannelTimeIndex::Swap(ChannelTimeIndex* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChannelTimeIndex::InternalSwap(ChannelTimeIndex* other) {
+  using std::swap;
+  time_.InternalSwap(&other->time_);
+  chunk_.InternalSwap(&other->chunk_);
+  offset_.InternalSwap(&other->offset_);
+  size_.InternalSwap(&other->size_);
+  name_.Swap(&other->name_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChannelTimeIndex::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TimeIndex::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TimeIndex::kChannelsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TimeIndex::TimeIndex()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_record_2eproto::InitDefaultsTimeIndex();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.TimeIndex)
+}
+TimeIndex::TimeIndex(const TimeIndex& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      channels_(from.channels_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.TimeIndex)
+}
+
+void TimeIndex::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+TimeIndex::~TimeIndex() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.TimeIndex)
+  SharedDtor();
+}
+
+void TimeIndex::SharedDtor() {
+}
+
+void TimeIndex::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TimeIndex::descriptor() {
+  ::protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const TimeIndex& TimeIndex::default_instance() {
+  ::protobuf_record_2eproto::InitDefaultsTimeIndex();
+  return *internal_default_instance();
+}
+
+TimeIndex* TimeIndex::New(::google::protobuf::Arena* arena) const {
+  TimeIndex* n = new TimeIndex;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TimeIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.TimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  channels_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TimeIndex::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.TimeIndex)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .apollo.cyber.proto.ChannelTimeIndex channels = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_channels()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.TimeIndex)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.TimeIndex)
+  return false;
+#undef DO_
+}
+
+void TimeIndex::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.TimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.ChannelTimeIndex channels = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->channels_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->channels(static_cast<int>(i)), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.TimeIndex)
+}
+
+::google::protobuf::uint8* TimeIndex::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.TimeIndex)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .apollo.cyber.proto.ChannelTimeIndex channels = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->channels_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, this->channels(static_cast<int>(i)), deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.TimeIndex)
+  return target;
+}
+
+size_t TimeIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.TimeIndex)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated .apollo.cyber.proto.ChannelTimeIndex channels = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->channels_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->channels(static_cast<int>(i)));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TimeIndex::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.TimeIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TimeIndex* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const TimeIndex>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.TimeIndex)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.TimeIndex)
+    MergeFrom(*source);
+  }
+}
+
+void TimeIndex::MergeFrom(const TimeIndex& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.TimeIndex)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  channels_.MergeFrom(from.channels_);
+}
+
+void TimeIndex::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.TimeIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TimeIndex::CopyFrom(const TimeIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.TimeIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimeIndex::IsInitialized() const {
+  return true;
+}
+
+void TimeIndex::Swap(TimeIndex* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TimeIndex::InternalSwap(TimeIndex* other) {
+  using std::swap;
+  channels_.InternalSwap(&other->channels_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata TimeIndex::GetMetadata() const {
+  protobuf_record_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_record_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
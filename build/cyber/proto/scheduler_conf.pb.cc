@@ -0,0 +1,1192 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: scheduler_conf.proto
+
+#include "scheduler_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class InnerThreadDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<InnerThread>
+      _instance;
+} _InnerThread_default_instance_;
+class SchedulerConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<SchedulerConf>
+      _instance;
+} _SchedulerConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_scheduler_5fconf_2eproto {
+void InitDefaultsInnerThreadImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_InnerThread_default_instance_;
+    new (ptr) ::apollo::cyber::proto::InnerThread();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::InnerThread::InitAsDefaultInstance();
+}
+
+void InitDefaultsInnerThread() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsInnerThreadImpl);
+}
+
+void InitDefaultsSchedulerConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_scheduler_5fconf_2eproto::InitDefaultsInnerThread();
+  protobuf_classic_5fconf_2eproto::InitDefaultsClassicConf();
+  protobuf_choreography_5fconf_2eproto::InitDefaultsChoreographyConf();
+  {
+    void* ptr = &::apollo::cyber::proto::_SchedulerConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::SchedulerConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::SchedulerConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsSchedulerConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsSchedulerConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[2];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, cpuset_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, policy_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::InnerThread, prio_),
+  0,
+  1,
+  2,
+  3,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, policy_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, routine_num_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, default_proc_num_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, process_level_cpuset_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, threads_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, classic_conf_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SchedulerConf, choreography_conf_),
+  0,
+  4,
+  5,
+  1,
+  ~0u,
+  2,
+  3,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, sizeof(::apollo::cyber::proto::InnerThread)},
+  { 13, 25, sizeof(::apollo::cyber::proto::SchedulerConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_InnerThread_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_SchedulerConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "scheduler_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 2);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\024scheduler_conf.proto\022\022apollo.cyber.pro"
+      "to\032\022classic_conf.proto\032\027choreography_con"
+      "f.proto\"L\n\013InnerThread\022\014\n\004name\030\001 \001(\t\022\016\n\006"
+      "cpuset\030\002 \001(\t\022\016\n\006policy\030\003 \001(\t\022\017\n\004prio\030\004 \001"
+      "(\r:\0011\"\226\002\n\rSchedulerConf\022\016\n\006policy\030\001 \001(\t\022"
+      "\023\n\013routine_num\030\002 \001(\r\022\030\n\020default_proc_num"
+      "\030\003 \001(\r\022\034\n\024process_level_cpuset\030\004 \001(\t\0220\n\007"
+      "threads\030\005 \003(\0132\037.apollo.cyber.proto.Inner"
+      "Thread\0225\n\014classic_conf\030\006 \001(\0132\037.apollo.cy"
+      "ber.proto.ClassicConf\022\?\n\021choreography_co"
+      "nf\030\007 \001(\0132$.apollo.cyber.proto.Choreograp"
+      "hyConf"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 446);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "scheduler_conf.proto", &protobuf_RegisterTypes);
+  ::protobuf_classic_5fconf_2eproto::AddDescriptors();
+  ::protobuf_choreography_5fconf_2eproto::AddDescriptors();
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_scheduler_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void InnerThread::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InnerThread::kNameFieldNumber;
+const int InnerThread::kCpusetFieldNumber;
+const int InnerThread::kPolicyFieldNumber;
+const int InnerThread::kPrioFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InnerThread::InnerThread()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_scheduler_5fconf_2eproto::InitDefaultsInnerThread();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.InnerThread)
+}
+InnerThread::InnerThread(const InnerThread& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_name()) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  cpuset_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_cpuset()) {
+    cpuset_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpuset_);
+  }
+  policy_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_policy()) {
+    policy_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.policy_);
+  }
+  prio_ = from.prio_;
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.InnerThread)
+}
+
+void InnerThread::SharedCtor() {
+  _cached_size_ = 0;
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpuset_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  policy_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  prio_ = 1u;
+}
+
+InnerThread::~InnerThread() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.InnerThread)
+  SharedDtor();
+}
+
+void InnerThread::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cpuset_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  policy_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void InnerThread::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InnerThread::descriptor() {
+  ::protobuf_scheduler_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_scheduler_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InnerThread& InnerThread::default_instance() {
+  ::protobuf_scheduler_5fconf_2eproto::InitDefaultsInnerThread();
+  return *internal_default_instance();
+}
+
+InnerThread* InnerThread::New(::google::protobuf::Arena* arena) const {
+  InnerThread* n = new InnerThread;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InnerThread::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.InnerThread)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*name_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!cpuset_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*cpuset_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(!policy_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*policy_.UnsafeRawStringPointer())->clear();
+    }
+    prio_ = 1u;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool InnerThread::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.InnerThread)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.InnerThread.name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string cpuset = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_cpuset()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->cpuset().data(), static_cast<int>(this->cpuset().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.InnerThread.cpuset");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string policy = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_policy()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->policy().data(), static_cast<int>(this->policy().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.InnerThread.policy");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 prio = 4 [default = 1];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_prio();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &prio_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.InnerThread)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.InnerThread)
+  return false;
+#undef DO_
+}
+
+void InnerThread::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.InnerThread)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // optional string cpuset = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->cpuset().data(), static_cast<int>(this->cpuset().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.cpuset");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->cpuset(), output);
+  }
+
+  // optional string policy = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->policy().data(), static_cast<int>(this->policy().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.policy");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->policy(), output);
+  }
+
+  // optional uint32 prio = 4 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->prio(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.InnerThread)
+}
+
+::google::protobuf::uint8* InnerThread::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.InnerThread)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // optional string cpuset = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->cpuset().data(), static_cast<int>(this->cpuset().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.cpuset");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->cpuset(), target);
+  }
+
+  // optional string policy = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->policy().data(), static_cast<int>(this->policy().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.InnerThread.policy");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->policy(), target);
+  }
+
+  // optional uint32 prio = 4 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->prio(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.InnerThread)
+  return target;
+}
+
+size_t InnerThread::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.InnerThread)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 15u) {
+    // optional string name = 1;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+    // optional string cpuset = 2;
+    if (has_cpuset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->cpuset());
+    }
+
+    // optional string policy = 3;
+    if (has_policy()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->policy());
+    }
+
+    // optional uint32 prio = 4 [default = 1];
+    if (has_prio()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->prio());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InnerThread::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.InnerThread)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InnerThread* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InnerThread>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.InnerThread)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.InnerThread)
+    MergeFrom(*source);
+  }
+}
+
+void InnerThread::MergeFrom(const InnerThread& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.InnerThread)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_name();
+      name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_cpuset();
+      cpuset_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cpuset_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      set_has_policy();
+      policy_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.policy_);
+    }
+    if (cached_has_bits & 0x00000008u) {
+      prio_ = from.prio_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void InnerThread::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.InnerThread)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InnerThread::CopyFrom(const InnerThread& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.InnerThread)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InnerThread::IsInitialized() const {
+  return true;
+}
+
+void InnerThread::Swap(InnerThread* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InnerThread::InternalSwap(InnerThread* other) {
+  using std::swap;
+  name_.Swap(&other->name_);
+  cpuset_.Swap(&other->cpuset_);
+  policy_.Swap(&other->policy_);
+  swap(prio_, other->prio_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InnerThread::GetMetadata() const {
+  protobuf_scheduler_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_scheduler_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void SchedulerConf::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_SchedulerConf_default_instance_._instance.get_mutable()->classic_conf_ = const_cast< ::apollo::cyber::proto::ClassicConf*>(
+      ::apollo::cyber::proto::ClassicConf::internal_default_instance());
+  ::apollo::cyber::proto::_SchedulerConf_default_instance_._instance.get_mutable()->choreography_conf_ = const_cast< ::apollo::cyber::proto::ChoreographyConf*>(
+      ::apollo::cyber::proto::ChoreographyConf::internal_default_instance());
+}
+void SchedulerConf::clear_classic_conf() {
+  if (classic_conf_ != NULL) classic_conf_->Clear();
+  clear_has_classic_conf();
+}
+void SchedulerConf::clear_choreography_conf() {
+  if (choreography_conf_ != NULL) choreography_conf_->Clear();
+  clear_has_choreography_conf();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SchedulerConf::kPolicyFieldNumber;
+const int SchedulerConf::kRoutineNumFieldNumber;
+const int SchedulerConf::kDefaultProcNumFieldNumber;
+const int SchedulerConf::kProcessLevelCpusetFieldNumber;
+const int SchedulerConf::kThreadsFieldNumber;
+const int SchedulerConf::kClassicConfFieldNumber;
+const int SchedulerConf::kChoreographyConfFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SchedulerConf::SchedulerConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_scheduler_5fconf_2eproto::InitDefaultsSchedulerConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.SchedulerConf)
+}
+SchedulerConf::SchedulerConf(const SchedulerConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      threads_(from.threads_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  policy_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_policy()) {
+    policy_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.policy_);
+  }
+  process_level_cpuset_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_process_level_cpuset()) {
+    process_level_cpuset_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.process_level_cpuset_);
+  }
+  if (from.has_classic_conf()) {
+    classic_conf_ = new ::apollo::cyber::proto::ClassicConf(*from.classic_conf_);
+  } else {
+    classic_conf_ = NULL;
+  }
+  if (from.has_choreography_conf()) {
+    choreography_conf_ = new ::apollo::cyber::proto::ChoreographyConf(*from.choreography_conf_);
+  } else {
+    choreography_conf_ = NULL;
+  }
+  ::memcpy(&routine_num_, &from.routine_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&default_proc_num_) -
+    reinterpret_cast<char*>(&routine_num_)) + sizeof(default_proc_num_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.SchedulerConf)
+}
+
+void SchedulerConf::SharedCtor() {
+  _cached_size_ = 0;
+  policy_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  process_level_cpuset_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&classic_conf_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&default_proc_num_) -
+      reinterpret_cast<char*>(&classic_conf_)) + sizeof(default_proc_num_));
+}
+
+SchedulerConf::~SchedulerConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.SchedulerConf)
+  SharedDtor();
+}
+
+void SchedulerConf::SharedDtor() {
+  policy_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  process_level_cpuset_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete classic_conf_;
+  if (this != internal_default_instance()) delete choreography_conf_;
+}
+
+void SchedulerConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SchedulerConf::descriptor() {
+  ::protobuf_scheduler_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_scheduler_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const SchedulerConf& SchedulerConf::default_instance() {
+  ::protobuf_scheduler_5fconf_2eproto::InitDefaultsSchedulerConf();
+  return *internal_default_instance();
+}
+
+SchedulerConf* SchedulerConf::New(::google::protobuf::Arena* arena) const {
+  SchedulerConf* n = new SchedulerConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SchedulerConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.SchedulerConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  threads_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!policy_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*policy_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!process_level_cpuset_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*process_level_cpuset_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(classic_conf_ != NULL);
+      classic_conf_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(choreography_conf_ != NULL);
+      choreography_conf_->Clear();
+    }
+  }
+  if (cached_has_bits & 48u) {
+    ::memset(&routine_num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&default_proc_num_) -
+        reinterpret_cast<char*>(&routine_num_)) + sizeof(default_proc_num_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool SchedulerConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.SchedulerConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string policy = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_policy()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->policy().data(), static_cast<int>(this->policy().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.SchedulerConf.policy");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 routine_num = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_routine_num();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &routine_num_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 default_proc_num = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_default_proc_num();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &default_proc_num_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string process_level_cpuset = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_process_level_cpuset()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->process_level_cpuset().data(), static_cast<int>(this->process_level_cpuset().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.SchedulerConf.process_level_cpuset");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .apollo.cyber.proto.InnerThread threads = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_threads()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ClassicConf classic_conf = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_classic_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ChoreographyConf choreography_conf = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_choreography_conf()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.SchedulerConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.SchedulerConf)
+  return false;
+#undef DO_
+}
+
+void SchedulerConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.SchedulerConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string policy = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->policy().data(), static_cast<int>(this->policy().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SchedulerConf.policy");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->policy(), output);
+  }
+
+  // optional uint32 routine_num = 2;
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->routine_num(), output);
+  }
+
+  // optional uint32 default_proc_num = 3;
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->default_proc_num(), output);
+  }
+
+  // optional string process_level_cpuset = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->process_level_cpuset().data(), static_cast<int>(this->process_level_cpuset().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SchedulerConf.process_level_cpuset");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->process_level_cpuset(), output);
+  }
+
+  // repeated .apollo.cyber.proto.InnerThread threads = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->threads_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->threads(static_cast<int>(i)), output);
+  }
+
+  // optional .apollo.cyber.proto.ClassicConf classic_conf = 6;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, *this->classic_conf_, output);
+  }
+
+  // optional .apollo.cyber.proto.ChoreographyConf choreography_conf = 7;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->choreography_conf_, output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.SchedulerConf)
+}
+
+::google::protobuf::uint8* SchedulerConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.SchedulerConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string policy = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->policy().data(), static_cast<int>(this->policy().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SchedulerConf.policy");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->policy(), target);
+  }
+
+  // optional uint32 routine_num = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->routine_num(), target);
+  }
+
+  // optional uint32 default_proc_num = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->default_proc_num(), target);
+  }
+
+  // optional string process_level_cpuset = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->process_level_cpuset().data(), static_cast<int>(this->process_level_cpuset().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SchedulerConf.process_level_cpuset");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->process_level_cpuset(), target);
+  }
+
+  // repeated .apollo.cyber.proto.InnerThread threads = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->threads_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, this->threads(static_cast<int>(i)), deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.ClassicConf classic_conf = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        6, *this->classic_conf_, deterministic, target);
+  }
+
+  // optional .apollo.cyber.proto.ChoreographyConf choreography_conf = 7;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, *this->choreography_conf_, deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.SchedulerConf)
+  return target;
+}
+
+size_t SchedulerConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.SchedulerConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated .apollo.cyber.proto.InnerThread threads = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->threads_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->threads(static_cast<int>(i)));
+    }
+  }
+
+  if (_has_bits_[0 / 32] & 63u) {
+    // optional string policy = 1;
+    if (has_policy()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->policy());
+    }
+
+    // optional string process_level_cpuset = 4;
+    if (has_process_level_cpuset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->process_level_cpuset());
+    }
+
+    // optional .apollo.cyber.proto.ClassicConf classic_conf = 6;
+    if (has_classic_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->classic_conf_);
+    }
+
+    // optional .apollo.cyber.proto.ChoreographyConf choreography_conf = 7;
+    if (has_choreography_conf()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->choreography_conf_);
+    }
+
+    // optional uint32 routine_num = 2;
+    if (has_routine_num()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->routine_num());
+    }
+
+    // optional uint32 default_proc_num = 3;
+    if (has_default_proc_num()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->default_proc_num());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SchedulerConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.SchedulerConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SchedulerConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SchedulerConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.SchedulerConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.SchedulerConf)
+    MergeFrom(*source);
+  }
+}
+
+void SchedulerConf::MergeFrom(const SchedulerConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.SchedulerConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  threads_.MergeFrom(from.threads_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 63u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_policy();
+      policy_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.policy_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_process_level_cpuset();
+      process_level_cpuset_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.process_level_cpuset_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      mutable_classic_conf()->::apollo::cyber::proto::ClassicConf::MergeFrom(from.classic_conf());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      mutable_choreography_conf()->::apollo::cyber::proto::ChoreographyConf::MergeFrom(from.choreography_conf());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      routine_num_ = from.routine_num_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      default_proc_num_ = from.default_proc_num_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void SchedulerConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.SchedulerConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SchedulerConf::CopyFrom(const SchedulerConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.SchedulerConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SchedulerConf::IsInitialized() const {
+  if (has_classic_conf()) {
+    if (!this->classic_conf_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void SchedulerConf::Swap(SchedulerConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SchedulerConf::InternalSwap(SchedulerConf* other) {
+  using std::swap;
+  threads_.InternalSwap(&other->threads_);
+  policy_.Swap(&other->policy_);
+  process_level_cpuset_.Swap(&other->process_level_cpuset_);
+  swap(classic_conf_, other->classic_conf_);
+  swap(choreography_conf_, other->choreography_conf_);
+  swap(routine_num_, other->routine_num_);
+  swap(default_proc_num_, other->default_proc_num_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SchedulerConf::GetMetadata() const {
+  protobuf_scheduler_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_scheduler_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,568 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sysmo_conf.proto
+
+#include "sysmo_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class SysMoConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<SysMoConf>
+      _instance;
+} _SysMoConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_sysmo_5fconf_2eproto {
+void InitDefaultsSysMoConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::apollo::cyber::proto::SysMoConf::_default_channel_.DefaultConstruct();
+  *::apollo::cyber::proto::SysMoConf::_default_channel_.get_mutable() = ::std::string("/apollo/cyber/sysmo", 19);
+  ::google::protobuf::internal::OnShutdownDestroyString(
+      ::apollo::cyber::proto::SysMoConf::_default_channel_.get_mutable());
+  {
+    void* ptr = &::apollo::cyber::proto::_SysMoConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::SysMoConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::SysMoConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsSysMoConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsSysMoConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, enable_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, check_interval_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, hung_threshold_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, publish_interval_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::SysMoConf, channel_),
+  1,
+  3,
+  4,
+  2,
+  0,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, sizeof(::apollo::cyber::proto::SysMoConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_SysMoConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "sysmo_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\020sysmo_conf.proto\022\022apollo.cyber.proto\"\254"
+      "\001\n\tSysMoConf\022\025\n\006enable\030\001 \001(\010:\005false\022\036\n\021c"
+      "heck_interval_ms\030\002 \001(\r:\003100\022\037\n\021hung_thre"
+      "shold_ms\030\003 \001(\r:\0041000\022!\n\023publish_interval"
+      "_ms\030\004 \001(\r:\0041000\022$\n\007channel\030\005 \001(\t:\023/apoll"
+      "o/cyber/sysmo"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 213);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "sysmo_conf.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_sysmo_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void SysMoConf::InitAsDefaultInstance() {
+}
+::google::protobuf::internal::ExplicitlyConstructed< ::std::string> SysMoConf::_default_channel_;
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SysMoConf::kEnableFieldNumber;
+const int SysMoConf::kCheckIntervalMsFieldNumber;
+const int SysMoConf::kHungThresholdMsFieldNumber;
+const int SysMoConf::kPublishIntervalMsFieldNumber;
+const int SysMoConf::kChannelFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SysMoConf::SysMoConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_sysmo_5fconf_2eproto::InitDefaultsSysMoConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.SysMoConf)
+}
+SysMoConf::SysMoConf(const SysMoConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  channel_.UnsafeSetDefault(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+  if (from.has_channel()) {
+    channel_.AssignWithDefault(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(), from.channel_);
+  }
+  ::memcpy(&enable_, &from.enable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&hung_threshold_ms_) -
+    reinterpret_cast<char*>(&enable_)) + sizeof(hung_threshold_ms_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.SysMoConf)
+}
+
+void SysMoConf::SharedCtor() {
+  _cached_size_ = 0;
+  channel_.UnsafeSetDefault(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+  enable_ = false;
+  publish_interval_ms_ = 1000u;
+  check_interval_ms_ = 100u;
+  hung_threshold_ms_ = 1000u;
+}
+
+SysMoConf::~SysMoConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.SysMoConf)
+  SharedDtor();
+}
+
+void SysMoConf::SharedDtor() {
+  channel_.DestroyNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+}
+
+void SysMoConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SysMoConf::descriptor() {
+  ::protobuf_sysmo_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_sysmo_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const SysMoConf& SysMoConf::default_instance() {
+  ::protobuf_sysmo_5fconf_2eproto::InitDefaultsSysMoConf();
+  return *internal_default_instance();
+}
+
+SysMoConf* SysMoConf::New(::google::protobuf::Arena* arena) const {
+  SysMoConf* n = new SysMoConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SysMoConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.SysMoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(!channel_.IsDefault(&::apollo::cyber::proto::SysMoConf::_default_channel_.get()));
+    (*channel_.UnsafeRawStringPointer())->assign(*&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+  }
+  if (cached_has_bits & 30u) {
+    enable_ = false;
+    publish_interval_ms_ = 1000u;
+    check_interval_ms_ = 100u;
+    hung_threshold_ms_ = 1000u;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool SysMoConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.SysMoConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bool enable = 1 [default = false];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_enable();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &enable_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 check_interval_ms = 2 [default = 100];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_check_interval_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &check_interval_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 hung_threshold_ms = 3 [default = 1000];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_hung_threshold_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &hung_threshold_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 publish_interval_ms = 4 [default = 1000];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_publish_interval_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &publish_interval_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_channel()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->channel().data(), static_cast<int>(this->channel().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.SysMoConf.channel");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.SysMoConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.SysMoConf)
+  return false;
+#undef DO_
+}
+
+void SysMoConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.SysMoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->enable(), output);
+  }
+
+  // optional uint32 check_interval_ms = 2 [default = 100];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->check_interval_ms(), output);
+  }
+
+  // optional uint32 hung_threshold_ms = 3 [default = 1000];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->hung_threshold_ms(), output);
+  }
+
+  // optional uint32 publish_interval_ms = 4 [default = 1000];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->publish_interval_ms(), output);
+  }
+
+  // optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->channel().data(), static_cast<int>(this->channel().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SysMoConf.channel");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      5, this->channel(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.SysMoConf)
+}
+
+::google::protobuf::uint8* SysMoConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.SysMoConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bool enable = 1 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->enable(), target);
+  }
+
+  // optional uint32 check_interval_ms = 2 [default = 100];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->check_interval_ms(), target);
+  }
+
+  // optional uint32 hung_threshold_ms = 3 [default = 1000];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->hung_threshold_ms(), target);
+  }
+
+  // optional uint32 publish_interval_ms = 4 [default = 1000];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->publish_interval_ms(), target);
+  }
+
+  // optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->channel().data(), static_cast<int>(this->channel().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.SysMoConf.channel");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->channel(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.SysMoConf)
+  return target;
+}
+
+size_t SysMoConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.SysMoConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 31u) {
+    // optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+    if (has_channel()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->channel());
+    }
+
+    // optional bool enable = 1 [default = false];
+    if (has_enable()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 publish_interval_ms = 4 [default = 1000];
+    if (has_publish_interval_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->publish_interval_ms());
+    }
+
+    // optional uint32 check_interval_ms = 2 [default = 100];
+    if (has_check_interval_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->check_interval_ms());
+    }
+
+    // optional uint32 hung_threshold_ms = 3 [default = 1000];
+    if (has_hung_threshold_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->hung_threshold_ms());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SysMoConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.SysMoConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SysMoConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SysMoConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.SysMoConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.SysMoConf)
+    MergeFrom(*source);
+  }
+}
+
+void SysMoConf::MergeFrom(const SysMoConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.SysMoConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 31u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_channel();
+      channel_.AssignWithDefault(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(), from.channel_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      enable_ = from.enable_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      publish_interval_ms_ = from.publish_interval_ms_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      check_interval_ms_ = from.check_interval_ms_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      hung_threshold_ms_ = from.hung_threshold_ms_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void SysMoConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.SysMoConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SysMoConf::CopyFrom(const SysMoConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.SysMoConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SysMoConf::IsInitialized() const {
+  return true;
+}
+
+void SysMoConf::Swap(SysMoConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SysMoConf::InternalSwap(SysMoConf* other) {
+  using std::swap;
+  channel_.Swap(&other->channel_);
+  swap(enable_, other->enable_);
+  swap(publish_interval_ms_, other->publish_interval_ms_);
+  swap(check_interval_ms_, other->check_interval_ms_);
+  swap(hung_threshold_ms_, other->hung_threshold_ms_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SysMoConf::GetMetadata() const {
+  protobuf_sysmo_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_sysmo_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
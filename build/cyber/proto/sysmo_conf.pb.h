@@ -0,0 +1,405 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sysmo_conf.proto
+
+#ifndef PROTOBUF_sysmo_5fconf_2eproto__INCLUDED
+#define PROTOBUF_sysmo_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_sysmo_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsSysMoConfImpl();
+void InitDefaultsSysMoConf();
+inline void InitDefaults() {
+  InitDefaultsSysMoConf();
+}
+}  // namespace protobuf_sysmo_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class SysMoConf;
+class SysMoConfDefaultTypeInternal;
+extern SysMoConfDefaultTypeInternal _SysMoConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class SysMoConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.SysMoConf) */ {
+ public:
+  SysMoConf();
+  virtual ~SysMoConf();
+
+  SysMoConf(const SysMoConf& from);
+
+  inline SysMoConf& operator=(const SysMoConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  SysMoConf(SysMoConf&& from) noexcept
+    : SysMoConf() {
+    *this = ::std::move(from);
+  }
+
+  inline SysMoConf& operator=(SysMoConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SysMoConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SysMoConf* internal_default_instance() {
+    return reinterpret_cast<const SysMoConf*>(
+               &_SysMoConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(SysMoConf* other);
+  friend void swap(SysMoConf& a, SysMoConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SysMoConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  SysMoConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const SysMoConf& from);
+  void MergeFrom(const SysMoConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(SysMoConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+  bool has_channel() const;
+  void clear_channel();
+  static const int kChannelFieldNumber = 5;
+  const ::std::string& channel() const;
+  void set_channel(const ::std::string& value);
+  #if LANG_CXX11
+  void set_channel(::std::string&& value);
+  #endif
+  void set_channel(const char* value);
+  void set_channel(const char* value, size_t size);
+  ::std::string* mutable_channel();
+  ::std::string* release_channel();
+  void set_allocated_channel(::std::string* channel);
+
+  // optional bool enable = 1 [default = false];
+  bool has_enable() const;
+  void clear_enable();
+  static const int kEnableFieldNumber = 1;
+  bool enable() const;
+  void set_enable(bool value);
+
+  // optional uint32 publish_interval_ms = 4 [default = 1000];
+  bool has_publish_interval_ms() const;
+  void clear_publish_interval_ms();
+  static const int kPublishIntervalMsFieldNumber = 4;
+  ::google::protobuf::uint32 publish_interval_ms() const;
+  void set_publish_interval_ms(::google::protobuf::uint32 value);
+
+  // optional uint32 check_interval_ms = 2 [default = 100];
+  bool has_check_interval_ms() const;
+  void clear_check_interval_ms();
+  static const int kCheckIntervalMsFieldNumber = 2;
+  ::google::protobuf::uint32 check_interval_ms() const;
+  void set_check_interval_ms(::google::protobuf::uint32 value);
+
+  // optional uint32 hung_threshold_ms = 3 [default = 1000];
+  bool has_hung_threshold_ms() const;
+  void clear_hung_threshold_ms();
+  static const int kHungThresholdMsFieldNumber = 3;
+  ::google::protobuf::uint32 hung_threshold_ms() const;
+  void set_hung_threshold_ms(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.SysMoConf)
+ private:
+  void set_has_enable();
+  void clear_has_enable();
+  void set_has_check_interval_ms();
+  void clear_has_check_interval_ms();
+  void set_has_hung_threshold_ms();
+  void clear_has_hung_threshold_ms();
+  void set_has_publish_interval_ms();
+  void clear_has_publish_interval_ms();
+  void set_has_channel();
+  void clear_has_channel();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  static ::google::protobuf::internal::ExplicitlyConstructed< ::std::string> _default_channel_;
+  ::google::protobuf::internal::ArenaStringPtr channel_;
+  bool enable_;
+  ::google::protobuf::uint32 publish_interval_ms_;
+  ::google::protobuf::uint32 check_interval_ms_;
+  ::google::protobuf::uint32 hung_threshold_ms_;
+  friend struct ::protobuf_sysmo_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_sysmo_5fconf_2eproto::InitDefaultsSysMoConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SysMoConf
+
+// optional bool enable = 1 [default = false];
+inline bool SysMoConf::has_enable() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SysMoConf::set_has_enable() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SysMoConf::clear_has_enable() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SysMoConf::clear_enable() {
+  enable_ = false;
+  clear_has_enable();
+}
+inline bool SysMoConf::enable() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.SysMoConf.enable)
+  return enable_;
+}
+inline void SysMoConf::set_enable(bool value) {
+  set_has_enable();
+  enable_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.SysMoConf.enable)
+}
+
+// optional uint32 check_interval_ms = 2 [default = 100];
+inline bool SysMoConf::has_check_interval_ms() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void SysMoConf::set_has_check_interval_ms() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void SysMoConf::clear_has_check_interval_ms() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void SysMoConf::clear_check_interval_ms() {
+  check_interval_ms_ = 100u;
+  clear_has_check_interval_ms();
+}
+inline ::google::protobuf::uint32 SysMoConf::check_interval_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.SysMoConf.check_interval_ms)
+  return check_interval_ms_;
+}
+inline void SysMoConf::set_check_interval_ms(::google::protobuf::uint32 value) {
+  set_has_check_interval_ms();
+  check_interval_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.SysMoConf.check_interval_ms)
+}
+
+// optional uint32 hung_threshold_ms = 3 [default = 1000];
+inline bool SysMoConf::has_hung_threshold_ms() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void SysMoConf::set_has_hung_threshold_ms() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void SysMoConf::clear_has_hung_threshold_ms() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void SysMoConf::clear_hung_threshold_ms() {
+  hung_threshold_ms_ = 1000u;
+  clear_has_hung_threshold_ms();
+}
+inline ::google::protobuf::uint32 SysMoConf::hung_threshold_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.SysMoConf.hung_threshold_ms)
+  return hung_threshold_ms_;
+}
+inline void SysMoConf::set_hung_threshold_ms(::google::protobuf::uint32 value) {
+  set_has_hung_threshold_ms();
+  hung_threshold_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.SysMoConf.hung_threshold_ms)
+}
+
+// optional uint32 publish_interval_ms = 4 [default = 1000];
+inline bool SysMoConf::has_publish_interval_ms() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void SysMoConf::set_has_publish_interval_ms() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void SysMoConf::clear_has_publish_interval_ms() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void SysMoConf::clear_publish_interval_ms() {
+  publish_interval_ms_ = 1000u;
+  clear_has_publish_interval_ms();
+}
+inline ::google::protobuf::uint32 SysMoConf::publish_interval_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.SysMoConf.publish_interval_ms)
+  return publish_interval_ms_;
+}
+inline void SysMoConf::set_publish_interval_ms(::google::protobuf::uint32 value) {
+  set_has_publish_interval_ms();
+  publish_interval_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.SysMoConf.publish_interval_ms)
+}
+
+// optional string channel = 5 [default = "/apollo/cyber/sysmo"];
+inline bool SysMoConf::has_channel() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SysMoConf::set_has_channel() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SysMoConf::clear_has_channel() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SysMoConf::clear_channel() {
+  channel_.ClearToDefaultNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+  clear_has_channel();
+}
+inline const ::std::string& SysMoConf::channel() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.SysMoConf.channel)
+  return channel_.GetNoArena();
+}
+inline void SysMoConf::set_channel(const ::std::string& value) {
+  set_has_channel();
+  channel_.SetNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(), value);
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.SysMoConf.channel)
+}
+#if LANG_CXX11
+inline void SysMoConf::set_channel(::std::string&& value) {
+  set_has_channel();
+  channel_.SetNoArena(
+    &::apollo::cyber::proto::SysMoConf::_default_channel_.get(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:apollo.cyber.proto.SysMoConf.channel)
+}
+#endif
+inline void SysMoConf::set_channel(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_channel();
+  channel_.SetNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:apollo.cyber.proto.SysMoConf.channel)
+}
+inline void SysMoConf::set_channel(const char* value, size_t size) {
+  set_has_channel();
+  channel_.SetNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:apollo.cyber.proto.SysMoConf.channel)
+}
+inline ::std::string* SysMoConf::mutable_channel() {
+  set_has_channel();
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.SysMoConf.channel)
+  return channel_.MutableNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+}
+inline ::std::string* SysMoConf::release_channel() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.SysMoConf.channel)
+  clear_has_channel();
+  return channel_.ReleaseNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get());
+}
+inline void SysMoConf::set_allocated_channel(::std::string* channel) {
+  if (channel != NULL) {
+    set_has_channel();
+  } else {
+    clear_has_channel();
+  }
+  channel_.SetAllocatedNoArena(&::apollo::cyber::proto::SysMoConf::_default_channel_.get(), channel);
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.SysMoConf.channel)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_sysmo_5fconf_2eproto__INCLUDED
@@ -0,0 +1,540 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: task_conf.proto
+
+#include "task_conf.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class TaskConfDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<TaskConf>
+      _instance;
+} _TaskConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_task_5fconf_2eproto {
+void InitDefaultsTaskConfImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  {
+    void* ptr = &::apollo::cyber::proto::_TaskConf_default_instance_;
+    new (ptr) ::apollo::cyber::proto::TaskConf();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::TaskConf::InitAsDefaultInstance();
+}
+
+void InitDefaultsTaskConf() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsTaskConfImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[1];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, min_workers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, max_workers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, idle_timeout_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, queue_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TaskConf, unbounded_queue_),
+  0,
+  1,
+  3,
+  4,
+  2,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, sizeof(::apollo::cyber::proto::TaskConf)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_TaskConf_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "task_conf.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, NULL, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 1);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\017task_conf.proto\022\022apollo.cyber.proto\"\223\001"
+      "\n\010TaskConf\022\026\n\013min_workers\030\001 \001(\r:\0010\022\026\n\013ma"
+      "x_workers\030\002 \001(\r:\0010\022\035\n\017idle_timeout_ms\030\003 "
+      "\001(\r:\0045000\022\030\n\nqueue_size\030\004 \001(\r:\0041024\022\036\n\017u"
+      "nbounded_queue\030\005 \001(\010:\005false"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 187);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "task_conf.proto", &protobuf_RegisterTypes);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_task_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+void TaskConf::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TaskConf::kMinWorkersFieldNumber;
+const int TaskConf::kMaxWorkersFieldNumber;
+const int TaskConf::kIdleTimeoutMsFieldNumber;
+const int TaskConf::kQueueSizeFieldNumber;
+const int TaskConf::kUnboundedQueueFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TaskConf::TaskConf()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_task_5fconf_2eproto::InitDefaultsTaskConf();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.TaskConf)
+}
+TaskConf::TaskConf(const TaskConf& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&min_workers_, &from.min_workers_,
+    static_cast<size_t>(reinterpret_cast<char*>(&queue_size_) -
+    reinterpret_cast<char*>(&min_workers_)) + sizeof(queue_size_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.TaskConf)
+}
+
+void TaskConf::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&min_workers_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&unbounded_queue_) -
+      reinterpret_cast<char*>(&min_workers_)) + sizeof(unbounded_queue_));
+  idle_timeout_ms_ = 5000u;
+  queue_size_ = 1024u;
+}
+
+TaskConf::~TaskConf() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.TaskConf)
+  SharedDtor();
+}
+
+void TaskConf::SharedDtor() {
+}
+
+void TaskConf::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TaskConf::descriptor() {
+  ::protobuf_task_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_task_5fconf_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const TaskConf& TaskConf::default_instance() {
+  ::protobuf_task_5fconf_2eproto::InitDefaultsTaskConf();
+  return *internal_default_instance();
+}
+
+TaskConf* TaskConf::New(::google::protobuf::Arena* arena) const {
+  TaskConf* n = new TaskConf;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TaskConf::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.TaskConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 31u) {
+    ::memset(&min_workers_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&unbounded_queue_) -
+        reinterpret_cast<char*>(&min_workers_)) + sizeof(unbounded_queue_));
+    idle_timeout_ms_ = 5000u;
+    queue_size_ = 1024u;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TaskConf::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.TaskConf)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint32 min_workers = 1 [default = 0];
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_min_workers();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &min_workers_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 max_workers = 2 [default = 0];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_max_workers();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &max_workers_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 idle_timeout_ms = 3 [default = 5000];
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_idle_timeout_ms();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &idle_timeout_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint32 queue_size = 4 [default = 1024];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          set_has_queue_size();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &queue_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool unbounded_queue = 5 [default = false];
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+          set_has_unbounded_queue();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &unbounded_queue_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.TaskConf)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.TaskConf)
+  return false;
+#undef DO_
+}
+
+void TaskConf::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.TaskConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 min_workers = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->min_workers(), output);
+  }
+
+  // optional uint32 max_workers = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->max_workers(), output);
+  }
+
+  // optional uint32 idle_timeout_ms = 3 [default = 5000];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->idle_timeout_ms(), output);
+  }
+
+  // optional uint32 queue_size = 4 [default = 1024];
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->queue_size(), output);
+  }
+
+  // optional bool unbounded_queue = 5 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->unbounded_queue(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.TaskConf)
+}
+
+::google::protobuf::uint8* TaskConf::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.TaskConf)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 min_workers = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->min_workers(), target);
+  }
+
+  // optional uint32 max_workers = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->max_workers(), target);
+  }
+
+  // optional uint32 idle_timeout_ms = 3 [default = 5000];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->idle_timeout_ms(), target);
+  }
+
+  // optional uint32 queue_size = 4 [default = 1024];
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->queue_size(), target);
+  }
+
+  // optional bool unbounded_queue = 5 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->unbounded_queue(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.TaskConf)
+  return target;
+}
+
+size_t TaskConf::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.TaskConf)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 31u) {
+    // optional uint32 min_workers = 1 [default = 0];
+    if (has_min_workers()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->min_workers());
+    }
+
+    // optional uint32 max_workers = 2 [default = 0];
+    if (has_max_workers()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->max_workers());
+    }
+
+    // optional bool unbounded_queue = 5 [default = false];
+    if (has_unbounded_queue()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 idle_timeout_ms = 3 [default = 5000];
+    if (has_idle_timeout_ms()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->idle_timeout_ms());
+    }
+
+    // optional uint32 queue_size = 4 [default = 1024];
+    if (has_queue_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->queue_size());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TaskConf::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.TaskConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TaskConf* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const TaskConf>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.TaskConf)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.TaskConf)
+    MergeFrom(*source);
+  }
+}
+
+void TaskConf::MergeFrom(const TaskConf& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.TaskConf)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 31u) {
+    if (cached_has_bits & 0x00000001u) {
+      min_workers_ = from.min_workers_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      max_workers_ = from.max_workers_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      unbounded_queue_ = from.unbounded_queue_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      idle_timeout_ms_ = from.idle_timeout_ms_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      queue_size_ = from.queue_size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TaskConf::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.TaskConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TaskConf::CopyFrom(const TaskConf& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.TaskConf)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TaskConf::IsInitialized() const {
+  return true;
+}
+
+void TaskConf::Swap(TaskConf* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TaskConf::InternalSwap(TaskConf* other) {
+  using std::swap;
+  swap(min_workers_, other->min_workers_);
+  swap(max_workers_, other->max_workers_);
+  swap(unbounded_queue_, other->unbounded_queue_);
+  swap(idle_timeout_ms_, other->idle_timeout_ms_);
+  swap(queue_size_, other->queue_size_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata TaskConf::GetMetadata() const {
+  protobuf_task_5fconf_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_task_5fconf_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,357 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: task_conf.proto
+
+#ifndef PROTOBUF_task_5fconf_2eproto__INCLUDED
+#define PROTOBUF_task_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_task_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsTaskConfImpl();
+void InitDefaultsTaskConf();
+inline void InitDefaults() {
+  InitDefaultsTaskConf();
+}
+}  // namespace protobuf_task_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class TaskConf;
+class TaskConfDefaultTypeInternal;
+extern TaskConfDefaultTypeInternal _TaskConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class TaskConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.TaskConf) */ {
+ public:
+  TaskConf();
+  virtual ~TaskConf();
+
+  TaskConf(const TaskConf& from);
+
+  inline TaskConf& operator=(const TaskConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  TaskConf(TaskConf&& from) noexcept
+    : TaskConf() {
+    *this = ::std::move(from);
+  }
+
+  inline TaskConf& operator=(TaskConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TaskConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TaskConf* internal_default_instance() {
+    return reinterpret_cast<const TaskConf*>(
+               &_TaskConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(TaskConf* other);
+  friend void swap(TaskConf& a, TaskConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TaskConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TaskConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const TaskConf& from);
+  void MergeFrom(const TaskConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(TaskConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional uint32 min_workers = 1 [default = 0];
+  bool has_min_workers() const;
+  void clear_min_workers();
+  static const int kMinWorkersFieldNumber = 1;
+  ::google::protobuf::uint32 min_workers() const;
+  void set_min_workers(::google::protobuf::uint32 value);
+
+  // optional uint32 max_workers = 2 [default = 0];
+  bool has_max_workers() const;
+  void clear_max_workers();
+  static const int kMaxWorkersFieldNumber = 2;
+  ::google::protobuf::uint32 max_workers() const;
+  void set_max_workers(::google::protobuf::uint32 value);
+
+  // optional bool unbounded_queue = 5 [default = false];
+  bool has_unbounded_queue() const;
+  void clear_unbounded_queue();
+  static const int kUnboundedQueueFieldNumber = 5;
+  bool unbounded_queue() const;
+  void set_unbounded_queue(bool value);
+
+  // optional uint32 idle_timeout_ms = 3 [default = 5000];
+  bool has_idle_timeout_ms() const;
+  void clear_idle_timeout_ms();
+  static const int kIdleTimeoutMsFieldNumber = 3;
+  ::google::protobuf::uint32 idle_timeout_ms() const;
+  void set_idle_timeout_ms(::google::protobuf::uint32 value);
+
+  // optional uint32 queue_size = 4 [default = 1024];
+  bool has_queue_size() const;
+  void clear_queue_size();
+  static const int kQueueSizeFieldNumber = 4;
+  ::google::protobuf::uint32 queue_size() const;
+  void set_queue_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.TaskConf)
+ private:
+  void set_has_min_workers();
+  void clear_has_min_workers();
+  void set_has_max_workers();
+  void clear_has_max_workers();
+  void set_has_idle_timeout_ms();
+  void clear_has_idle_timeout_ms();
+  void set_has_queue_size();
+  void clear_has_queue_size();
+  void set_has_unbounded_queue();
+  void clear_has_unbounded_queue();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 min_workers_;
+  ::google::protobuf::uint32 max_workers_;
+  bool unbounded_queue_;
+  ::google::protobuf::uint32 idle_timeout_ms_;
+  ::google::protobuf::uint32 queue_size_;
+  friend struct ::protobuf_task_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_task_5fconf_2eproto::InitDefaultsTaskConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TaskConf
+
+// optional uint32 min_workers = 1 [default = 0];
+inline bool TaskConf::has_min_workers() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TaskConf::set_has_min_workers() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TaskConf::clear_has_min_workers() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TaskConf::clear_min_workers() {
+  min_workers_ = 0u;
+  clear_has_min_workers();
+}
+inline ::google::protobuf::uint32 TaskConf::min_workers() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TaskConf.min_workers)
+  return min_workers_;
+}
+inline void TaskConf::set_min_workers(::google::protobuf::uint32 value) {
+  set_has_min_workers();
+  min_workers_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TaskConf.min_workers)
+}
+
+// optional uint32 max_workers = 2 [default = 0];
+inline bool TaskConf::has_max_workers() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TaskConf::set_has_max_workers() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TaskConf::clear_has_max_workers() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TaskConf::clear_max_workers() {
+  max_workers_ = 0u;
+  clear_has_max_workers();
+}
+inline ::google::protobuf::uint32 TaskConf::max_workers() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TaskConf.max_workers)
+  return max_workers_;
+}
+inline void TaskConf::set_max_workers(::google::protobuf::uint32 value) {
+  set_has_max_workers();
+  max_workers_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TaskConf.max_workers)
+}
+
+// optional uint32 idle_timeout_ms = 3 [default = 5000];
+inline bool TaskConf::has_idle_timeout_ms() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TaskConf::set_has_idle_timeout_ms() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void TaskConf::clear_has_idle_timeout_ms() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void TaskConf::clear_idle_timeout_ms() {
+  idle_timeout_ms_ = 5000u;
+  clear_has_idle_timeout_ms();
+}
+inline ::google::protobuf::uint32 TaskConf::idle_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TaskConf.idle_timeout_ms)
+  return idle_timeout_ms_;
+}
+inline void TaskConf::set_idle_timeout_ms(::google::protobuf::uint32 value) {
+  set_has_idle_timeout_ms();
+  idle_timeout_ms_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TaskConf.idle_timeout_ms)
+}
+
+// optional uint32 queue_size = 4 [default = 1024];
+inline bool TaskConf::has_queue_size() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TaskConf::set_has_queue_size() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void TaskConf::clear_has_queue_size() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void TaskConf::clear_queue_size() {
+  queue_size_ = 1024u;
+  clear_has_queue_size();
+}
+inline ::google::protobuf::uint32 TaskConf::queue_size() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TaskConf.queue_size)
+  return queue_size_;
+}
+inline void TaskConf::set_queue_size(::google::protobuf::uint32 value) {
+  set_has_queue_size();
+  queue_size_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TaskConf.queue_size)
+}
+
+// optional bool unbounded_queue = 5 [default = false];
+inline bool TaskConf::has_unbounded_queue() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TaskConf::set_has_unbounded_queue() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void TaskConf::clear_has_unbounded_queue() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void TaskConf::clear_unbounded_queue() {
+  unbounded_queue_ = false;
+  clear_has_unbounded_queue();
+}
+inline bool TaskConf::unbounded_queue() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TaskConf.unbounded_queue)
+  return unbounded_queue_;
+}
+inline void TaskConf::set_unbounded_queue(bool value) {
+  set_has_unbounded_queue();
+  unbounded_queue_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TaskConf.unbounded_queue)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_task_5fconf_2eproto__INCLUDED
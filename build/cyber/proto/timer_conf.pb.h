@@ -0,0 +1,255 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: timer_conf.proto
+
+#ifndef PROTOBUF_timer_5fconf_2eproto__INCLUDED
+#define PROTOBUF_timer_5fconf_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_timer_5fconf_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[1];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsTimerConfImpl();
+void InitDefaultsTimerConf();
+inline void InitDefaults() {
+  InitDefaultsTimerConf();
+}
+}  // namespace protobuf_timer_5fconf_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class TimerConf;
+class TimerConfDefaultTypeInternal;
+extern TimerConfDefaultTypeInternal _TimerConf_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+// ===================================================================
+
+class TimerConf : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.TimerConf) */ {
+ public:
+  TimerConf();
+  virtual ~TimerConf();
+
+  TimerConf(const TimerConf& from);
+
+  inline TimerConf& operator=(const TimerConf& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  TimerConf(TimerConf&& from) noexcept
+    : TimerConf() {
+    *this = ::std::move(from);
+  }
+
+  inline TimerConf& operator=(TimerConf&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TimerConf& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TimerConf* internal_default_instance() {
+    return reinterpret_cast<const TimerConf*>(
+               &_TimerConf_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(TimerConf* other);
+  friend void swap(TimerConf& a, TimerConf& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TimerConf* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TimerConf* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const TimerConf& from);
+  void MergeFrom(const TimerConf& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(TimerConf* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional bool fire_on_croutine = 2 [default = false];
+  bool has_fire_on_croutine() const;
+  void clear_fire_on_croutine();
+  static const int kFireOnCroutineFieldNumber = 2;
+  bool fire_on_croutine() const;
+  void set_fire_on_croutine(bool value);
+
+  // optional uint32 resolution_us = 1 [default = 2000];
+  bool has_resolution_us() const;
+  void clear_resolution_us();
+  static const int kResolutionUsFieldNumber = 1;
+  ::google::protobuf::uint32 resolution_us() const;
+  void set_resolution_us(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.TimerConf)
+ private:
+  void set_has_resolution_us();
+  void clear_has_resolution_us();
+  void set_has_fire_on_croutine();
+  void clear_has_fire_on_croutine();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  bool fire_on_croutine_;
+  ::google::protobuf::uint32 resolution_us_;
+  friend struct ::protobuf_timer_5fconf_2eproto::TableStruct;
+  friend void ::protobuf_timer_5fconf_2eproto::InitDefaultsTimerConfImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TimerConf
+
+// optional uint32 resolution_us = 1 [default = 2000];
+inline bool TimerConf::has_resolution_us() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TimerConf::set_has_resolution_us() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TimerConf::clear_has_resolution_us() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TimerConf::clear_resolution_us() {
+  resolution_us_ = 2000u;
+  clear_has_resolution_us();
+}
+inline ::google::protobuf::uint32 TimerConf::resolution_us() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TimerConf.resolution_us)
+  return resolution_us_;
+}
+inline void TimerConf::set_resolution_us(::google::protobuf::uint32 value) {
+  set_has_resolution_us();
+  resolution_us_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TimerConf.resolution_us)
+}
+
+// optional bool fire_on_croutine = 2 [default = false];
+inline bool TimerConf::has_fire_on_croutine() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TimerConf::set_has_fire_on_croutine() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TimerConf::clear_has_fire_on_croutine() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TimerConf::clear_fire_on_croutine() {
+  fire_on_croutine_ = false;
+  clear_has_fire_on_croutine();
+}
+inline bool TimerConf::fire_on_croutine() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TimerConf.fire_on_croutine)
+  return fire_on_croutine_;
+}
+inline void TimerConf::set_fire_on_croutine(bool value) {
+  set_has_fire_on_croutine();
+  fire_on_croutine_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TimerConf.fire_on_croutine)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_timer_5fconf_2eproto__INCLUDED
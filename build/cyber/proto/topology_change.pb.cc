@@ -0,0 +1,1122 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: topology_change.proto
+
+#include "topology_change.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// This is a temporary google only hack
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+#include "third_party/protobuf/version.h"
+#endif
+// @@protoc_insertion_point(includes)
+namespace apollo {
+namespace cyber {
+namespace proto {
+class ChangeMsgDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<ChangeMsg>
+      _instance;
+} _ChangeMsg_default_instance_;
+class TopologySnapshotDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<TopologySnapshot>
+      _instance;
+} _TopologySnapshot_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace protobuf_topology_5fchange_2eproto {
+void InitDefaultsChangeMsgImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_role_5fattributes_2eproto::InitDefaultsRoleAttributes();
+  {
+    void* ptr = &::apollo::cyber::proto::_ChangeMsg_default_instance_;
+    new (ptr) ::apollo::cyber::proto::ChangeMsg();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::ChangeMsg::InitAsDefaultInstance();
+}
+
+void InitDefaultsChangeMsg() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsChangeMsgImpl);
+}
+
+void InitDefaultsTopologySnapshotImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_topology_5fchange_2eproto::InitDefaultsChangeMsg();
+  {
+    void* ptr = &::apollo::cyber::proto::_TopologySnapshot_default_instance_;
+    new (ptr) ::apollo::cyber::proto::TopologySnapshot();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::apollo::cyber::proto::TopologySnapshot::InitAsDefaultInstance();
+}
+
+void InitDefaultsTopologySnapshot() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsTopologySnapshotImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[2];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[3];
+
+const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, timestamp_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, change_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, operate_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, role_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, role_attr_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::ChangeMsg, seq_),
+  1,
+  4,
+  5,
+  3,
+  0,
+  2,
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, _has_bits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, host_name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, process_id_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, seq_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::apollo::cyber::proto::TopologySnapshot, changes_),
+  0,
+  2,
+  1,
+  ~0u,
+};
+static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 11, sizeof(::apollo::cyber::proto::ChangeMsg)},
+  { 17, 26, sizeof(::apollo::cyber::proto::TopologySnapshot)},
+};
+
+static ::google::protobuf::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_ChangeMsg_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::apollo::cyber::proto::_TopologySnapshot_default_instance_),
+};
+
+void protobuf_AssignDescriptors() {
+  AddDescriptors();
+  ::google::protobuf::MessageFactory* factory = NULL;
+  AssignDescriptors(
+      "topology_change.proto", schemas, file_default_instances, TableStruct::offsets, factory,
+      file_level_metadata, file_level_enum_descriptors, NULL);
+}
+
+void protobuf_AssignDescriptorsOnce() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 2);
+}
+
+void AddDescriptorsImpl() {
+  InitDefaults();
+  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+      "\n\025topology_change.proto\022\022apollo.cyber.pr"
+      "oto\032\025role_attributes.proto\"\377\001\n\tChangeMsg"
+      "\022\021\n\ttimestamp\030\001 \001(\004\0223\n\013change_type\030\002 \001(\016"
+      "2\036.apollo.cyber.proto.ChangeType\0225\n\014oper"
+      "ate_type\030\003 \001(\0162\037.apollo.cyber.proto.Oper"
+      "ateType\022/\n\trole_type\030\004 \001(\0162\034.apollo.cybe"
+      "r.proto.RoleType\0225\n\trole_attr\030\005 \001(\0132\".ap"
+      "ollo.cyber.proto.RoleAttributes\022\013\n\003seq\030\006"
+      " \001(\004\"v\n\020TopologySnapshot\022\021\n\thost_name\030\001 "
+      "\001(\t\022\022\n\nprocess_id\030\002 \001(\005\022\013\n\003seq\030\003 \001(\004\022.\n\007"
+      "changes\030\004 \003(\0132\035.apollo.cyber.proto.Chang"
+      "eMsg*]\n\nChangeType\022\017\n\013CHANGE_NODE\020\001\022\022\n\016C"
+      "HANGE_CHANNEL\020\002\022\022\n\016CHANGE_SERVICE\020\003\022\026\n\022C"
+      "HANGE_PARTICIPANT\020\004**\n\013OperateType\022\014\n\010OP"
+      "T_JOIN\020\001\022\r\n\tOPT_LEAVE\020\002*s\n\010RoleType\022\r\n\tR"
+      "OLE_NODE\020\001\022\017\n\013ROLE_WRITER\020\002\022\017\n\013ROLE_READ"
+      "ER\020\003\022\017\n\013ROLE_SERVER\020\004\022\017\n\013ROLE_CLIENT\020\005\022\024"
+      "\n\020ROLE_PARTICIPANT\020\006"
+  };
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+      descriptor, 700);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "topology_change.proto", &protobuf_RegisterTypes);
+  ::protobuf_role_5fattributes_2eproto::AddDescriptors();
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+// Force AddDescriptors() to be called at dynamic initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+}  // namespace protobuf_topology_5fchange_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+const ::google::protobuf::EnumDescriptor* ChangeType_descriptor() {
+  protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_topology_5fchange_2eproto::file_level_enum_descriptors[0];
+}
+bool ChangeType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* OperateType_descriptor() {
+  protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_topology_5fchange_2eproto::file_level_enum_descriptors[1];
+}
+bool OperateType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* RoleType_descriptor() {
+  protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_topology_5fchange_2eproto::file_level_enum_descriptors[2];
+}
+bool RoleType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void ChangeMsg::InitAsDefaultInstance() {
+  ::apollo::cyber::proto::_ChangeMsg_default_instance_._instance.get_mutable()->role_attr_ = const_cast< ::apollo::cyber::proto::RoleAttributes*>(
+      ::apollo::cyber::proto::RoleAttributes::internal_default_instance());
+}
+void ChangeMsg::clear_role_attr() {
+  if (role_attr_ != NULL) role_attr_->Clear();
+  clear_has_role_attr();
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChangeMsg::kTimestampFieldNumber;
+const int ChangeMsg::kChangeTypeFieldNumber;
+const int ChangeMsg::kOperateTypeFieldNumber;
+const int ChangeMsg::kRoleTypeFieldNumber;
+const int ChangeMsg::kRoleAttrFieldNumber;
+const int ChangeMsg::kSeqFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChangeMsg::ChangeMsg()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_topology_5fchange_2eproto::InitDefaultsChangeMsg();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.ChangeMsg)
+}
+ChangeMsg::ChangeMsg(const ChangeMsg& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_role_attr()) {
+    role_attr_ = new ::apollo::cyber::proto::RoleAttributes(*from.role_attr_);
+  } else {
+    role_attr_ = NULL;
+  }
+  ::memcpy(&timestamp_, &from.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&operate_type_) -
+    reinterpret_cast<char*>(&timestamp_)) + sizeof(operate_type_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.ChangeMsg)
+}
+
+void ChangeMsg::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&role_attr_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&seq_) -
+      reinterpret_cast<char*>(&role_attr_)) + sizeof(seq_));
+  role_type_ = 1;
+  change_type_ = 1;
+  operate_type_ = 1;
+}
+
+ChangeMsg::~ChangeMsg() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.ChangeMsg)
+  SharedDtor();
+}
+
+void ChangeMsg::SharedDtor() {
+  if (this != internal_default_instance()) delete role_attr_;
+}
+
+void ChangeMsg::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChangeMsg::descriptor() {
+  ::protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_topology_5fchange_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ChangeMsg& ChangeMsg::default_instance() {
+  ::protobuf_topology_5fchange_2eproto::InitDefaultsChangeMsg();
+  return *internal_default_instance();
+}
+
+ChangeMsg* ChangeMsg::New(::google::protobuf::Arena* arena) const {
+  ChangeMsg* n = new ChangeMsg;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChangeMsg::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.ChangeMsg)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(role_attr_ != NULL);
+    role_attr_->Clear();
+  }
+  if (cached_has_bits & 62u) {
+    ::memset(&timestamp_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&seq_) -
+        reinterpret_cast<char*>(&timestamp_)) + sizeof(seq_));
+    role_type_ = 1;
+    change_type_ = 1;
+    operate_type_ = 1;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool ChangeMsg::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.ChangeMsg)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional uint64 timestamp = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+          set_has_timestamp();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &timestamp_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.ChangeType change_type = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::ChangeType_IsValid(value)) {
+            set_change_type(static_cast< ::apollo::cyber::proto::ChangeType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                2, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.OperateType operate_type = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::OperateType_IsValid(value)) {
+            set_operate_type(static_cast< ::apollo::cyber::proto::OperateType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                3, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.RoleType role_type = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::apollo::cyber::proto::RoleType_IsValid(value)) {
+            set_role_type(static_cast< ::apollo::cyber::proto::RoleType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(
+                4, static_cast< ::google::protobuf::uint64>(value));
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
+               input, mutable_role_attr()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 seq = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+          set_has_seq();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &seq_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.ChangeMsg)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.ChangeMsg)
+  return false;
+#undef DO_
+}
+
+void ChangeMsg::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.ChangeMsg)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 timestamp = 1;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->timestamp(), output);
+  }
+
+  // optional .apollo.cyber.proto.ChangeType change_type = 2;
+  if (cached_has_bits & 0x00000010u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->change_type(), output);
+  }
+
+  // optional .apollo.cyber.proto.OperateType operate_type = 3;
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->operate_type(), output);
+  }
+
+  // optional .apollo.cyber.proto.RoleType role_type = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->role_type(), output);
+  }
+
+  // optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, *this->role_attr_, output);
+  }
+
+  // optional uint64 seq = 6;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->seq(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.ChangeMsg)
+}
+
+::google::protobuf::uint8* ChangeMsg::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.ChangeMsg)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional uint64 timestamp = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->timestamp(), target);
+  }
+
+  // optional .apollo.cyber.proto.ChangeType change_type = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->change_type(), target);
+  }
+
+  // optional .apollo.cyber.proto.OperateType operate_type = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->operate_type(), target);
+  }
+
+  // optional .apollo.cyber.proto.RoleType role_type = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      4, this->role_type(), target);
+  }
+
+  // optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, *this->role_attr_, deterministic, target);
+  }
+
+  // optional uint64 seq = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->seq(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.ChangeMsg)
+  return target;
+}
+
+size_t ChangeMsg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.ChangeMsg)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  if (_has_bits_[0 / 32] & 63u) {
+    // optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+    if (has_role_attr()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          *this->role_attr_);
+    }
+
+    // optional uint64 timestamp = 1;
+    if (has_timestamp()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->timestamp());
+    }
+
+    // optional uint64 seq = 6;
+    if (has_seq()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->seq());
+    }
+
+    // optional .apollo.cyber.proto.RoleType role_type = 4;
+    if (has_role_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->role_type());
+    }
+
+    // optional .apollo.cyber.proto.ChangeType change_type = 2;
+    if (has_change_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->change_type());
+    }
+
+    // optional .apollo.cyber.proto.OperateType operate_type = 3;
+    if (has_operate_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->operate_type());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChangeMsg::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.ChangeMsg)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ChangeMsg* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChangeMsg>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.ChangeMsg)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.ChangeMsg)
+    MergeFrom(*source);
+  }
+}
+
+void ChangeMsg::MergeFrom(const ChangeMsg& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.ChangeMsg)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 63u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_role_attr()->::apollo::cyber::proto::RoleAttributes::MergeFrom(from.role_attr());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      timestamp_ = from.timestamp_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      seq_ = from.seq_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      role_type_ = from.role_type_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      change_type_ = from.change_type_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      operate_type_ = from.operate_type_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void ChangeMsg::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.ChangeMsg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChangeMsg::CopyFrom(const ChangeMsg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.ChangeMsg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChangeMsg::IsInitialized() const {
+  return true;
+}
+
+void ChangeMsg::Swap(ChangeMsg* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChangeMsg::InternalSwap(ChangeMsg* other) {
+  using std::swap;
+  swap(role_attr_, other->role_attr_);
+  swap(timestamp_, other->timestamp_);
+  swap(seq_, other->seq_);
+  swap(role_type_, other->role_type_);
+  swap(change_type_, other->change_type_);
+  swap(operate_type_, other->operate_type_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChangeMsg::GetMetadata() const {
+  protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_topology_5fchange_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// ===================================================================
+
+void TopologySnapshot::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TopologySnapshot::kHostNameFieldNumber;
+const int TopologySnapshot::kProcessIdFieldNumber;
+const int TopologySnapshot::kSeqFieldNumber;
+const int TopologySnapshot::kChangesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TopologySnapshot::TopologySnapshot()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_topology_5fchange_2eproto::InitDefaultsTopologySnapshot();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:apollo.cyber.proto.TopologySnapshot)
+}
+TopologySnapshot::TopologySnapshot(const TopologySnapshot& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      changes_(from.changes_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  host_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_host_name()) {
+    host_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.host_name_);
+  }
+  ::memcpy(&seq_, &from.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&process_id_) -
+    reinterpret_cast<char*>(&seq_)) + sizeof(process_id_));
+  // @@protoc_insertion_point(copy_constructor:apollo.cyber.proto.TopologySnapshot)
+}
+
+void TopologySnapshot::SharedCtor() {
+  _cached_size_ = 0;
+  host_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&process_id_) -
+      reinterpret_cast<char*>(&seq_)) + sizeof(process_id_));
+}
+
+TopologySnapshot::~TopologySnapshot() {
+  // @@protoc_insertion_point(destructor:apollo.cyber.proto.TopologySnapshot)
+  SharedDtor();
+}
+
+void TopologySnapshot::SharedDtor() {
+  host_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void TopologySnapshot::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TopologySnapshot::descriptor() {
+  ::protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_topology_5fchange_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const TopologySnapshot& TopologySnapshot::default_instance() {
+  ::protobuf_topology_5fchange_2eproto::InitDefaultsTopologySnapshot();
+  return *internal_default_instance();
+}
+
+TopologySnapshot* TopologySnapshot::New(::google::protobuf::Arena* arena) const {
+  TopologySnapshot* n = new TopologySnapshot;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TopologySnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:apollo.cyber.proto.TopologySnapshot)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  changes_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(!host_name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+    (*host_name_.UnsafeRawStringPointer())->clear();
+  }
+  if (cached_has_bits & 6u) {
+    ::memset(&seq_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&process_id_) -
+        reinterpret_cast<char*>(&seq_)) + sizeof(process_id_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TopologySnapshot::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:apollo.cyber.proto.TopologySnapshot)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string host_name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_host_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->host_name().data(), static_cast<int>(this->host_name().length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "apollo.cyber.proto.TopologySnapshot.host_name");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional int32 process_id = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          set_has_process_id();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &process_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional uint64 seq = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          set_has_seq();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &seq_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_changes()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:apollo.cyber.proto.TopologySnapshot)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:apollo.cyber.proto.TopologySnapshot)
+  return false;
+#undef DO_
+}
+
+void TopologySnapshot::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:apollo.cyber.proto.TopologySnapshot)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string host_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->host_name().data(), static_cast<int>(this->host_name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.TopologySnapshot.host_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->host_name(), output);
+  }
+
+  // optional int32 process_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->process_id(), output);
+  }
+
+  // optional uint64 seq = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->seq(), output);
+  }
+
+  // repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->changes_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->changes(static_cast<int>(i)), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:apollo.cyber.proto.TopologySnapshot)
+}
+
+::google::protobuf::uint8* TopologySnapshot::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:apollo.cyber.proto.TopologySnapshot)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string host_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->host_name().data(), static_cast<int>(this->host_name().length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "apollo.cyber.proto.TopologySnapshot.host_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->host_name(), target);
+  }
+
+  // optional int32 process_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->process_id(), target);
+  }
+
+  // optional uint64 seq = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->seq(), target);
+  }
+
+  // repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->changes_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        4, this->changes(static_cast<int>(i)), deterministic, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:apollo.cyber.proto.TopologySnapshot)
+  return target;
+}
+
+size_t TopologySnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:apollo.cyber.proto.TopologySnapshot)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  // repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->changes_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->changes(static_cast<int>(i)));
+    }
+  }
+
+  if (_has_bits_[0 / 32] & 7u) {
+    // optional string host_name = 1;
+    if (has_host_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->host_name());
+    }
+
+    // optional uint64 seq = 3;
+    if (has_seq()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->seq());
+    }
+
+    // optional int32 process_id = 2;
+    if (has_process_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->process_id());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TopologySnapshot::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:apollo.cyber.proto.TopologySnapshot)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TopologySnapshot* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const TopologySnapshot>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:apollo.cyber.proto.TopologySnapshot)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:apollo.cyber.proto.TopologySnapshot)
+    MergeFrom(*source);
+  }
+}
+
+void TopologySnapshot::MergeFrom(const TopologySnapshot& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:apollo.cyber.proto.TopologySnapshot)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  changes_.MergeFrom(from.changes_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 7u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_host_name();
+      host_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.host_name_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      seq_ = from.seq_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      process_id_ = from.process_id_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TopologySnapshot::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:apollo.cyber.proto.TopologySnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TopologySnapshot::CopyFrom(const TopologySnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:apollo.cyber.proto.TopologySnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TopologySnapshot::IsInitialized() const {
+  return true;
+}
+
+void TopologySnapshot::Swap(TopologySnapshot* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TopologySnapshot::InternalSwap(TopologySnapshot* other) {
+  using std::swap;
+  changes_.InternalSwap(&other->changes_);
+  host_name_.Swap(&other->host_name_);
+  swap(seq_, other->seq_);
+  swap(process_id_, other->process_id_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata TopologySnapshot::GetMetadata() const {
+  protobuf_topology_5fchange_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_topology_5fchange_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+// @@protoc_insertion_point(global_scope)
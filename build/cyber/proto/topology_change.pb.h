@@ -0,0 +1,813 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: topology_change.proto
+
+#ifndef PROTOBUF_topology_5fchange_2eproto__INCLUDED
+#define PROTOBUF_topology_5fchange_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3005001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "role_attributes.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_topology_5fchange_2eproto {
+// Internal implementation detail -- do not use these members.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[2];
+  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
+  static const ::google::protobuf::internal::SerializationTable serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+};
+void AddDescriptors();
+void InitDefaultsChangeMsgImpl();
+void InitDefaultsChangeMsg();
+void InitDefaultsTopologySnapshotImpl();
+void InitDefaultsTopologySnapshot();
+inline void InitDefaults() {
+  InitDefaultsChangeMsg();
+  InitDefaultsTopologySnapshot();
+}
+}  // namespace protobuf_topology_5fchange_2eproto
+namespace apollo {
+namespace cyber {
+namespace proto {
+class ChangeMsg;
+class ChangeMsgDefaultTypeInternal;
+extern ChangeMsgDefaultTypeInternal _ChangeMsg_default_instance_;
+class TopologySnapshot;
+class TopologySnapshotDefaultTypeInternal;
+extern TopologySnapshotDefaultTypeInternal _TopologySnapshot_default_instance_;
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+namespace apollo {
+namespace cyber {
+namespace proto {
+
+enum ChangeType {
+  CHANGE_NODE = 1,
+  CHANGE_CHANNEL = 2,
+  CHANGE_SERVICE = 3,
+  CHANGE_PARTICIPANT = 4
+};
+bool ChangeType_IsValid(int value);
+const ChangeType ChangeType_MIN = CHANGE_NODE;
+const ChangeType ChangeType_MAX = CHANGE_PARTICIPANT;
+const int ChangeType_ARRAYSIZE = ChangeType_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* ChangeType_descriptor();
+inline const ::std::string& ChangeType_Name(ChangeType value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    ChangeType_descriptor(), value);
+}
+inline bool ChangeType_Parse(
+    const ::std::string& name, ChangeType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<ChangeType>(
+    ChangeType_descriptor(), name, value);
+}
+enum OperateType {
+  OPT_JOIN = 1,
+  OPT_LEAVE = 2
+};
+bool OperateType_IsValid(int value);
+const OperateType OperateType_MIN = OPT_JOIN;
+const OperateType OperateType_MAX = OPT_LEAVE;
+const int OperateType_ARRAYSIZE = OperateType_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* OperateType_descriptor();
+inline const ::std::string& OperateType_Name(OperateType value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    OperateType_descriptor(), value);
+}
+inline bool OperateType_Parse(
+    const ::std::string& name, OperateType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<OperateType>(
+    OperateType_descriptor(), name, value);
+}
+enum RoleType {
+  ROLE_NODE = 1,
+  ROLE_WRITER = 2,
+  ROLE_READER = 3,
+  ROLE_SERVER = 4,
+  ROLE_CLIENT = 5,
+  ROLE_PARTICIPANT = 6
+};
+bool RoleType_IsValid(int value);
+const RoleType RoleType_MIN = ROLE_NODE;
+const RoleType RoleType_MAX = ROLE_PARTICIPANT;
+const int RoleType_ARRAYSIZE = RoleType_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* RoleType_descriptor();
+inline const ::std::string& RoleType_Name(RoleType value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    RoleType_descriptor(), value);
+}
+inline bool RoleType_Parse(
+    const ::std::string& name, RoleType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<RoleType>(
+    RoleType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ChangeMsg : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.ChangeMsg) */ {
+ public:
+  ChangeMsg();
+  virtual ~ChangeMsg();
+
+  ChangeMsg(const ChangeMsg& from);
+
+  inline ChangeMsg& operator=(const ChangeMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  ChangeMsg(ChangeMsg&& from) noexcept
+    : ChangeMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeMsg& operator=(ChangeMsg&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ChangeMsg& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ChangeMsg* internal_default_instance() {
+    return reinterpret_cast<const ChangeMsg*>(
+               &_ChangeMsg_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(ChangeMsg* other);
+  friend void swap(ChangeMsg& a, ChangeMsg& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ChangeMsg* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ChangeMsg* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ChangeMsg& from);
+  void MergeFrom(const ChangeMsg& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ChangeMsg* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+  bool has_role_attr() const;
+  void clear_role_attr();
+  static const int kRoleAttrFieldNumber = 5;
+  const ::apollo::cyber::proto::RoleAttributes& role_attr() const;
+  ::apollo::cyber::proto::RoleAttributes* release_role_attr();
+  ::apollo::cyber::proto::RoleAttributes* mutable_role_attr();
+  void set_allocated_role_attr(::apollo::cyber::proto::RoleAttributes* role_attr);
+
+  // optional uint64 timestamp = 1;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 1;
+  ::google::protobuf::uint64 timestamp() const;
+  void set_timestamp(::google::protobuf::uint64 value);
+
+  // optional uint64 seq = 6;
+  bool has_seq() const;
+  void clear_seq();
+  static const int kSeqFieldNumber = 6;
+  ::google::protobuf::uint64 seq() const;
+  void set_seq(::google::protobuf::uint64 value);
+
+  // optional .apollo.cyber.proto.RoleType role_type = 4;
+  bool has_role_type() const;
+  void clear_role_type();
+  static const int kRoleTypeFieldNumber = 4;
+  ::apollo::cyber::proto::RoleType role_type() const;
+  void set_role_type(::apollo::cyber::proto::RoleType value);
+
+  // optional .apollo.cyber.proto.ChangeType change_type = 2;
+  bool has_change_type() const;
+  void clear_change_type();
+  static const int kChangeTypeFieldNumber = 2;
+  ::apollo::cyber::proto::ChangeType change_type() const;
+  void set_change_type(::apollo::cyber::proto::ChangeType value);
+
+  // optional .apollo.cyber.proto.OperateType operate_type = 3;
+  bool has_operate_type() const;
+  void clear_operate_type();
+  static const int kOperateTypeFieldNumber = 3;
+  ::apollo::cyber::proto::OperateType operate_type() const;
+  void set_operate_type(::apollo::cyber::proto::OperateType value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.ChangeMsg)
+ private:
+  void set_has_timestamp();
+  void clear_has_timestamp();
+  void set_has_change_type();
+  void clear_has_change_type();
+  void set_has_operate_type();
+  void clear_has_operate_type();
+  void set_has_role_type();
+  void clear_has_role_type();
+  void set_has_role_attr();
+  void clear_has_role_attr();
+  void set_has_seq();
+  void clear_has_seq();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::apollo::cyber::proto::RoleAttributes* role_attr_;
+  ::google::protobuf::uint64 timestamp_;
+  ::google::protobuf::uint64 seq_;
+  int role_type_;
+  int change_type_;
+  int operate_type_;
+  friend struct ::protobuf_topology_5fchange_2eproto::TableStruct;
+  friend void ::protobuf_topology_5fchange_2eproto::InitDefaultsChangeMsgImpl();
+};
+// -------------------------------------------------------------------
+
+class TopologySnapshot : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:apollo.cyber.proto.TopologySnapshot) */ {
+ public:
+  TopologySnapshot();
+  virtual ~TopologySnapshot();
+
+  TopologySnapshot(const TopologySnapshot& from);
+
+  inline TopologySnapshot& operator=(const TopologySnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  TopologySnapshot(TopologySnapshot&& from) noexcept
+    : TopologySnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline TopologySnapshot& operator=(TopologySnapshot&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TopologySnapshot& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TopologySnapshot* internal_default_instance() {
+    return reinterpret_cast<const TopologySnapshot*>(
+               &_TopologySnapshot_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    1;
+
+  void Swap(TopologySnapshot* other);
+  friend void swap(TopologySnapshot& a, TopologySnapshot& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TopologySnapshot* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TopologySnapshot* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const TopologySnapshot& from);
+  void MergeFrom(const TopologySnapshot& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(TopologySnapshot* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+  int changes_size() const;
+  void clear_changes();
+  static const int kChangesFieldNumber = 4;
+  const ::apollo::cyber::proto::ChangeMsg& changes(int index) const;
+  ::apollo::cyber::proto::ChangeMsg* mutable_changes(int index);
+  ::apollo::cyber::proto::ChangeMsg* add_changes();
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ChangeMsg >*
+      mutable_changes();
+  const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ChangeMsg >&
+      changes() const;
+
+  // optional string host_name = 1;
+  bool has_host_name() const;
+  void clear_host_name();
+  static const int kHostNameFieldNumber = 1;
+  const ::std::string& host_name() const;
+  void set_host_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_host_name(::std::string&& value);
+  #endif
+  void set_host_name(const char* value);
+  void set_host_name(const char* value, size_t size);
+  ::std::string* mutable_host_name();
+  ::std::string* release_host_name();
+  void set_allocated_host_name(::std::string* host_name);
+
+  // optional uint64 seq = 3;
+  bool has_seq() const;
+  void clear_seq();
+  static const int kSeqFieldNumber = 3;
+  ::google::protobuf::uint64 seq() const;
+  void set_seq(::google::protobuf::uint64 value);
+
+  // optional int32 process_id = 2;
+  bool has_process_id() const;
+  void clear_process_id();
+  static const int kProcessIdFieldNumber = 2;
+  ::google::protobuf::int32 process_id() const;
+  void set_process_id(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:apollo.cyber.proto.TopologySnapshot)
+ private:
+  void set_has_host_name();
+  void clear_has_host_name();
+  void set_has_process_id();
+  void clear_has_process_id();
+  void set_has_seq();
+  void clear_has_seq();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ChangeMsg > changes_;
+  ::google::protobuf::internal::ArenaStringPtr host_name_;
+  ::google::protobuf::uint64 seq_;
+  ::google::protobuf::int32 process_id_;
+  friend struct ::protobuf_topology_5fchange_2eproto::TableStruct;
+  friend void ::protobuf_topology_5fchange_2eproto::InitDefaultsTopologySnapshotImpl();
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ChangeMsg
+
+// optional uint64 timestamp = 1;
+inline bool ChangeMsg::has_timestamp() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ChangeMsg::set_has_timestamp() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ChangeMsg::clear_has_timestamp() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ChangeMsg::clear_timestamp() {
+  timestamp_ = GOOGLE_ULONGLONG(0);
+  clear_has_timestamp();
+}
+inline ::google::protobuf::uint64 ChangeMsg::timestamp() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.timestamp)
+  return timestamp_;
+}
+inline void ChangeMsg::set_timestamp(::google::protobuf::uint64 value) {
+  set_has_timestamp();
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ChangeMsg.timestamp)
+}
+
+// optional .apollo.cyber.proto.ChangeType change_type = 2;
+inline bool ChangeMsg::has_change_type() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ChangeMsg::set_has_change_type() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ChangeMsg::clear_has_change_type() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ChangeMsg::clear_change_type() {
+  change_type_ = 1;
+  clear_has_change_type();
+}
+inline ::apollo::cyber::proto::ChangeType ChangeMsg::change_type() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.change_type)
+  return static_cast< ::apollo::cyber::proto::ChangeType >(change_type_);
+}
+inline void ChangeMsg::set_change_type(::apollo::cyber::proto::ChangeType value) {
+  assert(::apollo::cyber::proto::ChangeType_IsValid(value));
+  set_has_change_type();
+  change_type_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ChangeMsg.change_type)
+}
+
+// optional .apollo.cyber.proto.OperateType operate_type = 3;
+inline bool ChangeMsg::has_operate_type() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void ChangeMsg::set_has_operate_type() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void ChangeMsg::clear_has_operate_type() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void ChangeMsg::clear_operate_type() {
+  operate_type_ = 1;
+  clear_has_operate_type();
+}
+inline ::apollo::cyber::proto::OperateType ChangeMsg::operate_type() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.operate_type)
+  return static_cast< ::apollo::cyber::proto::OperateType >(operate_type_);
+}
+inline void ChangeMsg::set_operate_type(::apollo::cyber::proto::OperateType value) {
+  assert(::apollo::cyber::proto::OperateType_IsValid(value));
+  set_has_operate_type();
+  operate_type_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ChangeMsg.operate_type)
+}
+
+// optional .apollo.cyber.proto.RoleType role_type = 4;
+inline bool ChangeMsg::has_role_type() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ChangeMsg::set_has_role_type() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ChangeMsg::clear_has_role_type() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ChangeMsg::clear_role_type() {
+  role_type_ = 1;
+  clear_has_role_type();
+}
+inline ::apollo::cyber::proto::RoleType ChangeMsg::role_type() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.role_type)
+  return static_cast< ::apollo::cyber::proto::RoleType >(role_type_);
+}
+inline void ChangeMsg::set_role_type(::apollo::cyber::proto::RoleType value) {
+  assert(::apollo::cyber::proto::RoleType_IsValid(value));
+  set_has_role_type();
+  role_type_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ChangeMsg.role_type)
+}
+
+// optional .apollo.cyber.proto.RoleAttributes role_attr = 5;
+inline bool ChangeMsg::has_role_attr() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ChangeMsg::set_has_role_attr() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ChangeMsg::clear_has_role_attr() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::apollo::cyber::proto::RoleAttributes& ChangeMsg::role_attr() const {
+  const ::apollo::cyber::proto::RoleAttributes* p = role_attr_;
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.role_attr)
+  return p != NULL ? *p : *reinterpret_cast<const ::apollo::cyber::proto::RoleAttributes*>(
+      &::apollo::cyber::proto::_RoleAttributes_default_instance_);
+}
+inline ::apollo::cyber::proto::RoleAttributes* ChangeMsg::release_role_attr() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.ChangeMsg.role_attr)
+  clear_has_role_attr();
+  ::apollo::cyber::proto::RoleAttributes* temp = role_attr_;
+  role_attr_ = NULL;
+  return temp;
+}
+inline ::apollo::cyber::proto::RoleAttributes* ChangeMsg::mutable_role_attr() {
+  set_has_role_attr();
+  if (role_attr_ == NULL) {
+    role_attr_ = new ::apollo::cyber::proto::RoleAttributes;
+  }
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.ChangeMsg.role_attr)
+  return role_attr_;
+}
+inline void ChangeMsg::set_allocated_role_attr(::apollo::cyber::proto::RoleAttributes* role_attr) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete reinterpret_cast< ::google::protobuf::MessageLite*>(role_attr_);
+  }
+  if (role_attr) {
+    ::google::protobuf::Arena* submessage_arena = NULL;
+    if (message_arena != submessage_arena) {
+      role_attr = ::google::protobuf::internal::GetOwnedMessage(
+          message_arena, role_attr, submessage_arena);
+    }
+    set_has_role_attr();
+  } else {
+    clear_has_role_attr();
+  }
+  role_attr_ = role_attr;
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.ChangeMsg.role_attr)
+}
+
+// optional uint64 seq = 6;
+inline bool ChangeMsg::has_seq() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ChangeMsg::set_has_seq() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ChangeMsg::clear_has_seq() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ChangeMsg::clear_seq() {
+  seq_ = GOOGLE_ULONGLONG(0);
+  clear_has_seq();
+}
+inline ::google::protobuf::uint64 ChangeMsg::seq() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.ChangeMsg.seq)
+  return seq_;
+}
+inline void ChangeMsg::set_seq(::google::protobuf::uint64 value) {
+  set_has_seq();
+  seq_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.ChangeMsg.seq)
+}
+
+// -------------------------------------------------------------------
+
+// TopologySnapshot
+
+// optional string host_name = 1;
+inline bool TopologySnapshot::has_host_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TopologySnapshot::set_has_host_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TopologySnapshot::clear_has_host_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TopologySnapshot::clear_host_name() {
+  host_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_host_name();
+}
+inline const ::std::string& TopologySnapshot::host_name() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TopologySnapshot.host_name)
+  return host_name_.GetNoArena();
+}
+inline void TopologySnapshot::set_host_name(const ::std::string& value) {
+  set_has_host_name();
+  host_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TopologySnapshot.host_name)
+}
+#if LANG_CXX11
+inline void TopologySnapshot::set_host_name(::std::string&& value) {
+  set_has_host_name();
+  host_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:apollo.cyber.proto.TopologySnapshot.host_name)
+}
+#endif
+inline void TopologySnapshot::set_host_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_host_name();
+  host_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:apollo.cyber.proto.TopologySnapshot.host_name)
+}
+inline void TopologySnapshot::set_host_name(const char* value, size_t size) {
+  set_has_host_name();
+  host_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:apollo.cyber.proto.TopologySnapshot.host_name)
+}
+inline ::std::string* TopologySnapshot::mutable_host_name() {
+  set_has_host_name();
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.TopologySnapshot.host_name)
+  return host_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* TopologySnapshot::release_host_name() {
+  // @@protoc_insertion_point(field_release:apollo.cyber.proto.TopologySnapshot.host_name)
+  clear_has_host_name();
+  return host_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void TopologySnapshot::set_allocated_host_name(::std::string* host_name) {
+  if (host_name != NULL) {
+    set_has_host_name();
+  } else {
+    clear_has_host_name();
+  }
+  host_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), host_name);
+  // @@protoc_insertion_point(field_set_allocated:apollo.cyber.proto.TopologySnapshot.host_name)
+}
+
+// optional int32 process_id = 2;
+inline bool TopologySnapshot::has_process_id() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TopologySnapshot::set_has_process_id() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void TopologySnapshot::clear_has_process_id() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void TopologySnapshot::clear_process_id() {
+  process_id_ = 0;
+  clear_has_process_id();
+}
+inline ::google::protobuf::int32 TopologySnapshot::process_id() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TopologySnapshot.process_id)
+  return process_id_;
+}
+inline void TopologySnapshot::set_process_id(::google::protobuf::int32 value) {
+  set_has_process_id();
+  process_id_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TopologySnapshot.process_id)
+}
+
+// optional uint64 seq = 3;
+inline bool TopologySnapshot::has_seq() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TopologySnapshot::set_has_seq() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TopologySnapshot::clear_has_seq() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TopologySnapshot::clear_seq() {
+  seq_ = GOOGLE_ULONGLONG(0);
+  clear_has_seq();
+}
+inline ::google::protobuf::uint64 TopologySnapshot::seq() const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TopologySnapshot.seq)
+  return seq_;
+}
+inline void TopologySnapshot::set_seq(::google::protobuf::uint64 value) {
+  set_has_seq();
+  seq_ = value;
+  // @@protoc_insertion_point(field_set:apollo.cyber.proto.TopologySnapshot.seq)
+}
+
+// repeated .apollo.cyber.proto.ChangeMsg changes = 4;
+inline int TopologySnapshot::changes_size() const {
+  return changes_.size();
+}
+inline void TopologySnapshot::clear_changes() {
+  changes_.Clear();
+}
+inline const ::apollo::cyber::proto::ChangeMsg& TopologySnapshot::changes(int index) const {
+  // @@protoc_insertion_point(field_get:apollo.cyber.proto.TopologySnapshot.changes)
+  return changes_.Get(index);
+}
+inline ::apollo::cyber::proto::ChangeMsg* TopologySnapshot::mutable_changes(int index) {
+  // @@protoc_insertion_point(field_mutable:apollo.cyber.proto.TopologySnapshot.changes)
+  return changes_.Mutable(index);
+}
+inline ::apollo::cyber::proto::ChangeMsg* TopologySnapshot::add_changes() {
+  // @@protoc_insertion_point(field_add:apollo.cyber.proto.TopologySnapshot.changes)
+  return changes_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ChangeMsg >*
+TopologySnapshot::mutable_changes() {
+  // @@protoc_insertion_point(field_mutable_list:apollo.cyber.proto.TopologySnapshot.changes)
+  return &changes_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::apollo::cyber::proto::ChangeMsg >&
+TopologySnapshot::changes() const {
+  // @@protoc_insertion_point(field_list:apollo.cyber.proto.TopologySnapshot.changes)
+  return changes_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto
+}  // namespace cyber
+}  // namespace apollo
+
+namespace google {
+namespace protobuf {
+
+template <> struct is_proto_enum< ::apollo::cyber::proto::ChangeType> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::apollo::cyber::proto::ChangeType>() {
+  return ::apollo::cyber::proto::ChangeType_descriptor();
+}
+template <> struct is_proto_enum< ::apollo::cyber::proto::OperateType> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::apollo::cyber::proto::OperateType>() {
+  return ::apollo::cyber::proto::OperateType_descriptor();
+}
+template <> struct is_proto_enum< ::apollo::cyber::proto::RoleType> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::apollo::cyber::proto::RoleType>() {
+  return ::apollo::cyber::proto::RoleType_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_topology_5fchange_2eproto__INCLUDED
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../cyber_log_decode"
+  "../../cyber_log_decode.pdb"
+  "CMakeFiles/cyber_log_decode.dir/cyber_log_decode/main.cc.o"
+  "CMakeFiles/cyber_log_decode.dir/cyber_log_decode/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyber_log_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cyber/tools/cyber_monitor/cyber_topology_message.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/cyber_topology_message.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/cyber_topology_message.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/general_channel_message.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_channel_message.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_channel_message.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/general_message.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/general_message_base.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message_base.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message_base.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/main.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/main.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/main.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/renderable_message.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/renderable_message.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/renderable_message.cc.o.d"
+  "/root/repo/cyber/tools/cyber_monitor/screen.cc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/screen.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_monitor.dir/cyber_monitor/screen.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/CMakeFiles/cyber.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../cyber_monitor"
+  "../../cyber_monitor.pdb"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/cyber_topology_message.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/cyber_topology_message.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_channel_message.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_channel_message.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message_base.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/general_message_base.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/main.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/main.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/renderable_message.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/renderable_message.cc.o.d"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/screen.cc.o"
+  "CMakeFiles/cyber_monitor.dir/cyber_monitor/screen.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyber_monitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../cyber_perf_trace"
+  "../../cyber_perf_trace.pdb"
+  "CMakeFiles/cyber_perf_trace.dir/cyber_perf_trace/main.cc.o"
+  "CMakeFiles/cyber_perf_trace.dir/cyber_perf_trace/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyber_perf_trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cyber/tools/cyber_recorder/info.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/info.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/info.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/main.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/main.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/main.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/player/play_task.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/player/play_task_buffer.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_buffer.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_buffer.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/player/play_task_consumer.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_consumer.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_consumer.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/player/play_task_producer.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_producer.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_producer.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/player/player.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/player.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/player/player.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/recorder.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/recorder.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/recorder.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/recoverer.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/recoverer.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/recoverer.cc.o.d"
+  "/root/repo/cyber/tools/cyber_recorder/spliter.cc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/spliter.cc.o" "gcc" "cyber/tools/CMakeFiles/cyber_recorder.dir/cyber_recorder/spliter.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/CMakeFiles/cyber.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
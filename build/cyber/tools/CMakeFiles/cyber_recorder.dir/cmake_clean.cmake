@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../cyber_recorder"
+  "../../cyber_recorder.pdb"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/info.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/info.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/main.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/main.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_buffer.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_buffer.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_consumer.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_consumer.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_producer.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/play_task_producer.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/player.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/player/player.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/recorder.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/recorder.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/recoverer.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/recoverer.cc.o.d"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/spliter.cc.o"
+  "CMakeFiles/cyber_recorder.dir/cyber_recorder/spliter.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyber_recorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -19,275 +19,347 @@
 
 #include <atomic>
 #include <cstdint>
-#include <type_traits>
+#include <functional>
 #include <utility>
 
+#include "cyber/base/epoch_reclaimer.h"
+
 namespace apollo {
 namespace cyber {
 namespace base {
 /**
- * @brief A implementation of lock-free fixed size hash map
+ * @brief A implementation of lock-free resizable hash map
+ *
+ * All entries live in one lock-free list ordered by their bit-reversed hash
+ * (split-ordered list), buckets are shortcuts into it. Doubling the number
+ * of buckets moves nothing: a new bucket is linked into the list the first
+ * time it is used, right behind the entries of its parent bucket. Removed
+ * entries and replaced values are reclaimed through EpochReclaimer, a value
+ * pointer returned by Get stays valid until its key is set again or removed.
  *
- * @tparam K Type of key, must be integral
+ * @tparam K Type of key
  * @tparam V Type of value
- * @tparam 128 Size of hash table
- * @tparam 0 Type traits, use for checking types of key & value
+ * @tparam 128 Initial number of buckets, a power of 2
+ * @tparam Hash Hash function of K
+ * @tparam KeyEqual Equality of K
  */
 template <typename K, typename V, std::size_t TableSize = 128,
-	typename std::enable_if<std::is_integral<K>::value && (TableSize & (TableSize - 1)) == 0, int>::type = 0>
+          typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
 class AtomicHashMap {
+  static_assert(TableSize != 0 && (TableSize & (TableSize - 1)) == 0,
+                "TableSize must be a power of 2");
+
  public:
-  AtomicHashMap() : capacity_(TableSize), mode_num_(capacity_ - 1) {}
+  AtomicHashMap() : size_(TableSize), count_(0) {
+    for (auto &segment : segments_) {
+      segment.store(nullptr, std::memory_order_relaxed);
+    }
+    // bucket 0 is the head of the list
+    auto head = new Node(0);
+    BucketOf(0)->store(head, std::memory_order_release);
+  }
   AtomicHashMap(const AtomicHashMap &other) = delete;
   AtomicHashMap &operator=(const AtomicHashMap &other) = delete;
 
-  bool Has(K key) {
-    uint64_t index = key & mode_num_;
-    return table_[index].Has(key);
+  ~AtomicHashMap() {
+    Node *node = BucketOf(0)->load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node *next = Unmarked(node->next.load(std::memory_order_relaxed));
+      Delete(node);
+      node = next;
+    }
+    for (auto &segment : segments_) {
+      delete[] segment.load(std::memory_order_relaxed);
+    }
   }
 
-  bool Get(K key, V **value) {
-    uint64_t index = key & mode_num_;
-    return table_[index].Get(key, value);
+  bool Has(const K &key) {
+    EpochReclaimer::Guard guard;
+    return Find(key) != nullptr;
   }
 
-  bool Get(K key, V *value) {
-    uint64_t index = key & mode_num_;
-    V *val = nullptr;
-    bool res = table_[index].Get(key, &val);
-    if (res) {
-      *value = *val;
+  bool Get(const K &key, V **value) {
+    EpochReclaimer::Guard guard;
+    auto entry = Find(key);
+    if (entry == nullptr) {
+      return false;
     }
-    return res;
+    *value = entry->value_ptr.load(std::memory_order_acquire);
+    return true;
   }
 
-  void Set(K key) {
-    uint64_t index = key & mode_num_;
-    table_[index].Insert(key);
+  bool Get(const K &key, V *value) {
+    EpochReclaimer::Guard guard;
+    auto entry = Find(key);
+    if (entry == nullptr) {
+      return false;
+    }
+    *value = *entry->value_ptr.load(std::memory_order_acquire);
+    return true;
   }
 
-  void Set(K key, const V &value) {
-    uint64_t index = key & mode_num_;
-    table_[index].Insert(key, value);
+  void Set(const K &key) { Insert(key, new V()); }
+
+  void Set(const K &key, const V &value) { Insert(key, new V(value)); }
+
+  void Set(const K &key, V &&value) {
+    Insert(key, new V(std::forward<V>(value)));
   }
 
-  void Set(K key, V &&value) {
-    uint64_t index = key & mode_num_;
-    table_[index].Insert(key, std::forward<V>(value));
+  /**
+   * @brief Remove key, its entry is deleted once no reader can reach it
+   *
+   * @return false if key was absent
+   */
+  bool Remove(const K &key) {
+    EpochReclaimer::Guard guard;
+    uint64_t hash = Hash()(key);
+    uint64_t order = RegularOrder(hash);
+    auto bucket = Bucket(hash);
+    while (true) {
+      Position pos;
+      if (!Search(bucket, order, &key, &pos)) {
+        return false;
+      }
+      uintptr_t next = pos.curr->next.load(std::memory_order_acquire);
+      if (IsMarked(next)) {
+        continue;
+      }
+      // the mark makes the entry logically removed, unlinking can be left
+      // to the next Search passing by
+      if (!pos.curr->next.compare_exchange_strong(next, Marked(next))) {
+        continue;
+      }
+      uintptr_t expected = reinterpret_cast<uintptr_t>(pos.curr);
+      if (pos.prev->compare_exchange_strong(expected, next)) {
+        Retire(pos.curr);
+      } else {
+        Search(bucket, order, &key, &pos);
+      }
+      count_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
   }
 
+  std::size_t Size() const { return count_.load(std::memory_order_relaxed); }
+
  private:
-  struct Entry {
-    Entry() {}
-    explicit Entry(K key) : key(key) {
-      value_ptr.store(new V(), std::memory_order_release);
-    }
-    Entry(K key, const V &value) : key(key) {
-      value_ptr.store(new V(value), std::memory_order_release);
-    }
-    Entry(K key, V &&value) : key(key) {
-      value_ptr.store(new V(std::forward<V>(value)), std::memory_order_release);
-    }
+  static constexpr std::size_t kMaxSegments = 48;
+  static constexpr std::size_t kMaxLoad = 2;
+
+  // buckets only have the order, entries have the low bit of it set
+  struct Node {
+    explicit Node(uint64_t order) : order(order) {}
+
+    const uint64_t order;
+    std::atomic<uintptr_t> next = {0};
+  };
+
+  struct Entry : public Node {
+    Entry(uint64_t order, const K &key, V *value)
+        : Node(order), key(key), value_ptr(value) {}
     ~Entry() { delete value_ptr.load(std::memory_order_acquire); }
 
-    K key = 0;
-    std::atomic<V *> value_ptr = {nullptr};
-    std::atomic<Entry *> next = {nullptr};
+    const K key;
+    std::atomic<V *> value_ptr;
   };
 
-  class Bucket {
-   public:
-    Bucket() : head_(new Entry()) {}
-    ~Bucket() {
-      Entry *ite = head_;
-      while (ite) {
-        auto tmp = ite->next.load(std::memory_order_acquire);
-        delete ite;
-        ite = tmp;
-      }
+  struct Position {
+    std::atomic<uintptr_t> *prev;
+    Node *curr;
+  };
+
+  static bool IsMarked(uintptr_t next) { return (next & 1) != 0; }
+  static uintptr_t Marked(uintptr_t next) { return next | 1; }
+  static Node *Unmarked(uintptr_t next) {
+    return reinterpret_cast<Node *>(next & ~static_cast<uintptr_t>(1));
+  }
+
+  static uint64_t Reverse(uint64_t v) {
+    v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+    v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    v = ((v >> 8) & 0x00FF00FF00FF00FFULL) | ((v & 0x00FF00FF00FF00FFULL) << 8);
+    v = ((v >> 16) & 0x0000FFFF0000FFFFULL) |
+        ((v & 0x0000FFFF0000FFFFULL) << 16);
+    return (v >> 32) | (v << 32);
+  }
+  static uint64_t RegularOrder(uint64_t hash) {
+    return Reverse(hash | (1ULL << 63));
+  }
+  static uint64_t BucketOrder(uint64_t bucket) { return Reverse(bucket); }
+
+  static void Delete(Node *node) {
+    if ((node->order & 1) != 0) {
+      delete static_cast<Entry *>(node);
+    } else {
+      delete node;
     }
+  }
+  static void Retire(Node *node) {
+    EpochReclaimer::Instance()->Retire(node, [](void *ptr) {
+      Delete(static_cast<Node *>(ptr));
+    });
+  }
 
-    bool Has(K key) {
-      Entry *m_target = head_->next.load(std::memory_order_acquire);
-      while (Entry *target = m_target) {
-        if (target->key < key) {
-          m_target = target->next.load(std::memory_order_acquire);
-          continue;
-        } else {
-          return target->key == key;
-        }
+  // segment 0 holds the first TableSize buckets, segment s the next
+  // TableSize << (s - 1) ones
+  std::atomic<Node *> *BucketOf(uint64_t bucket) {
+    std::size_t segment = 0;
+    uint64_t offset = bucket;
+    if (bucket >= TableSize) {
+      segment = 64 - __builtin_clzll(bucket / TableSize);
+      offset = bucket - (static_cast<uint64_t>(TableSize) << (segment - 1));
+    }
+    auto buckets = segments_[segment].load(std::memory_order_acquire);
+    if (buckets == nullptr) {
+      std::size_t length =
+          segment == 0 ? TableSize : TableSize << (segment - 1);
+      auto fresh = new std::atomic<Node *>[length];
+      for (std::size_t i = 0; i < length; ++i) {
+        fresh[i].store(nullptr, std::memory_order_relaxed);
+      }
+      if (segments_[segment].compare_exchange_strong(buckets, fresh)) {
+        buckets = fresh;
+      } else {
+        delete[] fresh;
       }
-      return false;
     }
+    return &buckets[offset];
+  }
 
-    bool Find(K key, Entry **prev_ptr, Entry **target_ptr) {
-      Entry *prev = head_;
-      Entry *m_target = head_->next.load(std::memory_order_acquire);
-      while (Entry *target = m_target) {
-        if (target->key == key) {
-          *prev_ptr = prev;
-          *target_ptr = target;
-          return true;
-        } else if (target->key > key) {
-          *prev_ptr = prev;
-          *target_ptr = target;
-          return false;
-        } else {
-          prev = target;
-          m_target = target->next.load(std::memory_order_acquire);
-        }
-      }
-      *prev_ptr = prev;
-      *target_ptr = nullptr;
-      return false;
+  // the head of bucket, linked into the list on first use
+  Node *Bucket(uint64_t hash) {
+    uint64_t bucket = hash & (size_.load(std::memory_order_acquire) - 1);
+    auto slot = BucketOf(bucket);
+    auto head = slot->load(std::memory_order_acquire);
+    return head != nullptr ? head : InitBucket(bucket, slot);
+  }
+
+  Node *InitBucket(uint64_t bucket, std::atomic<Node *> *slot) {
+    // the parent is the bucket this one was split from
+    uint64_t parent = bucket & ~(1ULL << (63 - __builtin_clzll(bucket)));
+    auto parent_slot = BucketOf(parent);
+    auto parent_head = parent_slot->load(std::memory_order_acquire);
+    if (parent_head == nullptr) {
+      parent_head = InitBucket(parent, parent_slot);
     }
 
-    void Insert(K key, const V &value) {
-      Entry *prev = nullptr;
-      Entry *target = nullptr;
-      Entry *new_entry = nullptr;
-      V *new_value = nullptr;
-      while (true) {
-        if (Find(key, &prev, &target)) {
-          // key exists, update value
-          if (!new_value) {
-            new_value = new V(value);
-          }
-          auto old_val_ptr = target->value_ptr.load(std::memory_order_acquire);
-          if (target->value_ptr.compare_exchange_strong(
-                  old_val_ptr, new_value, std::memory_order_acq_rel,
-                  std::memory_order_relaxed)) {
-            delete old_val_ptr;
-            if (new_entry) {
-              delete new_entry;
-              new_entry = nullptr;
-            }
-            return;
-          }
-          continue;
-        } else {
-          if (!new_entry) {
-            new_entry = new Entry(key, value);
-          }
-          new_entry->next.store(target, std::memory_order_release);
-          if (prev->next.compare_exchange_strong(target, new_entry,
-                                                 std::memory_order_acq_rel,
-                                                 std::memory_order_relaxed)) {
-            // Insert success
-            if (new_value) {
-              delete new_value;
-              new_value = nullptr;
-            }
-            return;
-          }
-          // another entry has been inserted, retry
-        }
+    auto head = new Node(BucketOrder(bucket));
+    while (true) {
+      Position pos;
+      if (Search(parent_head, head->order, nullptr, &pos)) {
+        delete head;
+        head = pos.curr;
+        break;
+      }
+      head->next.store(reinterpret_cast<uintptr_t>(pos.curr),
+                       std::memory_order_relaxed);
+      uintptr_t expected = reinterpret_cast<uintptr_t>(pos.curr);
+      if (pos.prev->compare_exchange_strong(
+              expected, reinterpret_cast<uintptr_t>(head))) {
+        break;
       }
     }
+    slot->store(head, std::memory_order_release);
+    return head;
+  }
 
-    void Insert(K key, V &&value) {
-      Entry *prev = nullptr;
-      Entry *target = nullptr;
-      Entry *new_entry = nullptr;
-      V *new_value = nullptr;
-      while (true) {
-        if (Find(key, &prev, &target)) {
-          // key exists, update value
-          if (!new_value) {
-            new_value = new V(std::forward<V>(value));
-          }
-          auto old_val_ptr = target->value_ptr.load(std::memory_order_acquire);
-          if (target->value_ptr.compare_exchange_strong(
-                  old_val_ptr, new_value, std::memory_order_acq_rel,
-                  std::memory_order_relaxed)) {
-            delete old_val_ptr;
-            if (new_entry) {
-              delete new_entry;
-              new_entry = nullptr;
-            }
-            return;
-          }
-          continue;
-        } else {
-          if (!new_entry) {
-            new_entry = new Entry(key, value);
-          }
-          new_entry->next.store(target, std::memory_order_release);
-          if (prev->next.compare_exchange_strong(target, new_entry,
-                                                 std::memory_order_acq_rel,
-                                                 std::memory_order_relaxed)) {
-            // Insert success
-            if (new_value) {
-              delete new_value;
-              new_value = nullptr;
-            }
-            return;
-          }
-          // another entry has been inserted, retry
+  /**
+   * @brief Walk from head to the node of order (and key, for entries),
+   * unlinking the marked nodes met on the way
+   *
+   * @return true if found, pos then points at it, otherwise at the node it
+   * would be inserted before
+   */
+  bool Search(Node *head, uint64_t order, const K *key, Position *pos) {
+  retry:
+    pos->prev = &head->next;
+    pos->curr = Unmarked(pos->prev->load(std::memory_order_acquire));
+    while (pos->curr != nullptr) {
+      uintptr_t next = pos->curr->next.load(std::memory_order_acquire);
+      if (IsMarked(next)) {
+        uintptr_t expected = reinterpret_cast<uintptr_t>(pos->curr);
+        uintptr_t unmarked = reinterpret_cast<uintptr_t>(Unmarked(next));
+        if (!pos->prev->compare_exchange_strong(expected, unmarked)) {
+          goto retry;
         }
+        Retire(pos->curr);
+        pos->curr = Unmarked(next);
+        continue;
       }
+      if (pos->curr->order > order) {
+        return false;
+      }
+      if (pos->curr->order == order &&
+          (key == nullptr ||
+           KeyEqual()(static_cast<Entry *>(pos->curr)->key, *key))) {
+        return true;
+      }
+      pos->prev = &pos->curr->next;
+      pos->curr = Unmarked(next);
     }
+    return false;
+  }
 
-    void Insert(K key) {
-      Entry *prev = nullptr;
-      Entry *target = nullptr;
-      Entry *new_entry = nullptr;
-      V *new_value = nullptr;
-      while (true) {
-        if (Find(key, &prev, &target)) {
-          // key exists, update value
-          if (!new_value) {
-            new_value = new V();
-          }
-          auto old_val_ptr = target->value_ptr.load(std::memory_order_acquire);
-          if (target->value_ptr.compare_exchange_strong(
-                  old_val_ptr, new_value, std::memory_order_acq_rel,
-                  std::memory_order_relaxed)) {
-            delete old_val_ptr;
-            if (new_entry) {
-              delete new_entry;
-              new_entry = nullptr;
-            }
-            return;
-          }
-          continue;
-        } else {
-          if (!new_entry) {
-            new_entry = new Entry(key);
-          }
-          new_entry->next.store(target, std::memory_order_release);
-          if (prev->next.compare_exchange_strong(target, new_entry,
-                                                 std::memory_order_acq_rel,
-                                                 std::memory_order_relaxed)) {
-            // Insert success
-            if (new_value) {
-              delete new_value;
-              new_value = nullptr;
-            }
-            return;
-          }
-          // another entry has been inserted, retry
-        }
+  Entry *Find(const K &key) {
+    uint64_t hash = Hash()(key);
+    uint64_t order = RegularOrder(hash);
+    // a plain walk, unlinking is left to writers
+    Node *node = Bucket(hash);
+    while (node != nullptr && node->order <= order) {
+      uintptr_t next = node->next.load(std::memory_order_acquire);
+      if (node->order == order && !IsMarked(next) &&
+          KeyEqual()(static_cast<Entry *>(node)->key, key)) {
+        return static_cast<Entry *>(node);
       }
+      node = Unmarked(next);
     }
+    return nullptr;
+  }
 
-    bool Get(K key, V **value) {
-      Entry *prev = nullptr;
-      Entry *target = nullptr;
-      if (Find(key, &prev, &target)) {
-        *value = target->value_ptr.load(std::memory_order_acquire);
-        return true;
+  void Insert(const K &key, V *value) {
+    EpochReclaimer::Guard guard;
+    uint64_t hash = Hash()(key);
+    uint64_t order = RegularOrder(hash);
+    auto bucket = Bucket(hash);
+    Entry *entry = nullptr;
+    while (true) {
+      Position pos;
+      if (Search(bucket, order, &key, &pos)) {
+        // key exists, update value
+        auto old_value = static_cast<Entry *>(pos.curr)->value_ptr.exchange(
+            value, std::memory_order_acq_rel);
+        EpochReclaimer::Instance()->Retire(old_value);
+        if (entry != nullptr) {
+          entry->value_ptr.store(nullptr, std::memory_order_relaxed);
+          delete entry;
+        }
+        return;
       }
-      return false;
+      if (entry == nullptr) {
+        entry = new Entry(order, key, value);
+      }
+      entry->next.store(reinterpret_cast<uintptr_t>(pos.curr),
+                        std::memory_order_relaxed);
+      uintptr_t expected = reinterpret_cast<uintptr_t>(pos.curr);
+      if (pos.prev->compare_exchange_strong(
+              expected, reinterpret_cast<uintptr_t>(entry))) {
+        break;
+      }
+      // another entry has been inserted, retry
     }
 
-    Entry *head_;
-  };
+    auto count = count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto size = size_.load(std::memory_order_relaxed);
+    if (count > size * kMaxLoad && size < (TableSize << (kMaxSegments - 1))) {
+      size_.compare_exchange_strong(size, size * 2);
+    }
+  }
 
- private:
-  Bucket table_[TableSize];
-  uint64_t capacity_;
-  uint64_t mode_num_;
+  std::atomic<uint64_t> size_;
+  std::atomic<std::size_t> count_;
+  std::atomic<std::atomic<Node *> *> segments_[kMaxSegments];
 };
 
 }  // namespace base
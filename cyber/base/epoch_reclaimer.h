@@ -0,0 +1,232 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_EPOCH_RECLAIMER_H_
+#define CYBER_BASE_EPOCH_RECLAIMER_H_
+
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief Epoch based reclamation for lock-free structures
+ *
+ * Readers wrap their accesses in a Guard, which announces the global epoch
+ * they started in. Writers unlink an object and Retire() it instead of
+ * deleting it; it is deleted once the epoch has moved twice, by then no
+ * Guard that could have seen it is left. Entering and leaving a Guard only
+ * touches a record of the calling thread, retiring takes a mutex. Where the
+ * kernel has membarrier(2), moving the epoch pays for the memory barrier
+ * entering a Guard would otherwise need.
+ */
+class EpochReclaimer {
+ private:
+  struct Record;
+
+ public:
+  using Deleter = void (*)(void *);
+
+  class Guard {
+   public:
+    Guard() : record_(EpochReclaimer::Instance()->Enter()) {}
+    ~Guard() { EpochReclaimer::Instance()->Exit(record_); }
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+   private:
+    Record *record_;
+  };
+
+  // never destroyed, objects may be retired during static destruction
+  static EpochReclaimer *Instance() {
+    static EpochReclaimer *instance = new EpochReclaimer();
+    return instance;
+  }
+
+  template <typename T>
+  void Retire(T *ptr) {
+    Retire(ptr, [](void *p) { delete static_cast<T *>(p); });
+  }
+
+  void Retire(void *ptr, Deleter deleter) {
+    std::vector<Retired> ready;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      limbo_[epoch_.load() % 3].push_back({ptr, deleter});
+      if (++since_advance_ >= kAdvanceBatch) {
+        TryAdvance(&ready);
+      }
+    }
+    for (auto &item : ready) {
+      item.deleter(item.ptr);
+    }
+  }
+
+  /**
+   * @brief Delete what is safe to delete now, otherwise retired objects wait
+   * for the epoch to be moved on by later Retire() calls
+   */
+  void Reclaim() {
+    std::vector<Retired> ready;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      TryAdvance(&ready);
+      TryAdvance(&ready);
+    }
+    for (auto &item : ready) {
+      item.deleter(item.ptr);
+    }
+  }
+
+  std::size_t Pending() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return limbo_[0].size() + limbo_[1].size() + limbo_[2].size();
+  }
+
+ private:
+  static constexpr uint32_t kAdvanceBatch = 32;
+
+  struct Retired {
+    void *ptr;
+    Deleter deleter;
+  };
+
+  EpochReclaimer() : epoch_(1), records_(nullptr), since_advance_(0) {
+    asymmetric_ = syscall(SYS_membarrier,
+                          MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0;
+  }
+
+  Record *Enter();
+  void Exit(Record *record);
+
+  // moves the epoch on if every thread inside a Guard entered in it, what
+  // was retired two epochs before is then handed out in ready
+  void TryAdvance(std::vector<Retired> *ready);
+
+  Record *Acquire();
+
+  // readers only need a compiler barrier, see Enter()
+  bool asymmetric_;
+  std::atomic<uint64_t> epoch_;
+  std::atomic<Record *> records_;
+  std::mutex mutex_;
+  // by epoch % 3, guarded by mutex_
+  std::vector<Retired> limbo_[3];
+  uint32_t since_advance_;
+};
+
+// one per thread, reused by later threads once its thread has exited
+struct EpochReclaimer::Record {
+  // (epoch << 1) | 1 while inside a Guard, 0 outside
+  std::atomic<uint64_t> state = {0};
+  std::atomic<bool> in_use = {false};
+  uint32_t nesting = 0;
+  Record *next = nullptr;
+};
+
+inline EpochReclaimer::Record *EpochReclaimer::Acquire() {
+  struct Holder {
+    Record *record = nullptr;
+    ~Holder() {
+      if (record != nullptr) {
+        record->in_use.store(false, std::memory_order_release);
+      }
+    }
+  };
+  static thread_local Holder holder;
+  if (holder.record != nullptr) {
+    return holder.record;
+  }
+
+  for (auto record = records_.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    bool expected = false;
+    if (!record->in_use.load(std::memory_order_relaxed) &&
+        record->in_use.compare_exchange_strong(expected, true)) {
+      holder.record = record;
+      return record;
+    }
+  }
+  auto record = new Record();
+  record->in_use.store(true, std::memory_order_relaxed);
+  auto head = records_.load(std::memory_order_relaxed);
+  do {
+    record->next = head;
+  } while (!records_.compare_exchange_weak(head, record,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed));
+  holder.record = record;
+  return record;
+}
+
+inline EpochReclaimer::Record *EpochReclaimer::Enter() {
+  auto record = Acquire();
+  if (record->nesting++ == 0) {
+    uint64_t state = (epoch_.load(std::memory_order_relaxed) << 1) | 1;
+    // the announcement must be visible before anything shared is read:
+    // TryAdvance forces that on every cpu with membarrier, otherwise a
+    // seq_cst exchange is the cheapest full barrier
+    if (asymmetric_) {
+      record->state.store(state, std::memory_order_relaxed);
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+    } else {
+      record->state.exchange(state, std::memory_order_seq_cst);
+    }
+  }
+  return record;
+}
+
+inline void EpochReclaimer::Exit(Record *record) {
+  if (--record->nesting == 0) {
+    record->state.store(0, std::memory_order_release);
+  }
+}
+
+inline void EpochReclaimer::TryAdvance(std::vector<Retired> *ready) {
+  since_advance_ = 0;
+  if (!asymmetric_ ||
+      syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0) != 0) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+  uint64_t epoch = epoch_.load();
+  for (auto record = records_.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    uint64_t state = record->state.load(std::memory_order_acquire);
+    if ((state & 1) != 0 && (state >> 1) != epoch) {
+      return;
+    }
+  }
+  // only advanced under mutex_, so this cannot fail
+  epoch_.store(epoch + 1);
+  auto &oldest = limbo_[(epoch + 1) % 3];
+  ready->insert(ready->end(), oldest.begin(), oldest.end());
+  oldest.clear();
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_EPOCH_RECLAIMER_H_
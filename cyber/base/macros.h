@@ -19,6 +19,7 @@
 
 #include <cstdlib>
 #include <new>
+#include <utility>
 
 #if __GNUC__ >= 3
 #define cyber_likely(x) (__builtin_expect((x), 1))
@@ -72,4 +73,33 @@ inline void* CheckedCalloc(size_t num, size_t size) {
   return ptr;
 }
 
+inline void* CheckedAlignedMalloc(size_t alignment, size_t size) {
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, alignment, size) != 0) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+// operator new only honours alignof(std::max_align_t) before C++17, types
+// with cache line aligned members go through these instead
+template <typename T, typename... Args>
+T* AlignedNew(Args&&... args) {
+  void* ptr = CheckedAlignedMalloc(alignof(T), sizeof(T));
+  try {
+    return new (ptr) T(std::forward<Args>(args)...);
+  } catch (...) {
+    std::free(ptr);
+    throw;
+  }
+}
+
+template <typename T>
+struct AlignedDeleter {
+  void operator()(T* ptr) const {
+    ptr->~T();
+    std::free(ptr);
+  }
+};
+
 #endif  // CYBER_BASE_MACROS_H_
@@ -0,0 +1,610 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_MAGAZINE_POOL_H_
+#define CYBER_BASE_MAGAZINE_POOL_H_
+
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+struct MagazinePoolOptions {
+  // blocks in each of the two magazines a thread caches
+  uint32_t magazine_size = 32;
+  // blocks in the first chunk of an arena, every later chunk is
+  // growth_factor times larger until it holds max_chunk_blocks
+  uint32_t initial_chunk_blocks = 64;
+  uint32_t growth_factor = 2;
+  uint32_t max_chunk_blocks = 4096;
+  // blocks an arena carves at most, 0 for no limit; Allocate returns
+  // nullptr once they are all in use
+  uint32_t max_blocks = 0;
+  // one arena per NUMA node, with its chunks bound to the node
+  bool numa_aware = false;
+};
+
+/**
+ * @brief NUMA nodes and the cpus they own, read from sysfs
+ *
+ * A machine without /sys/devices/system/node is one node.
+ */
+class NumaTopology {
+ public:
+  static const NumaTopology *Instance() {
+    static NumaTopology *instance = new NumaTopology();
+    return instance;
+  }
+
+  // highest node id plus one
+  uint32_t NodeCount() const { return node_count_; }
+
+  // node of the cpu the calling thread runs on now
+  uint32_t CurrentNode() const {
+    int cpu = sched_getcpu();
+    if (cpu < 0 || static_cast<std::size_t>(cpu) >= cpu_nodes_.size()) {
+      return 0;
+    }
+    return cpu_nodes_[cpu];
+  }
+
+ private:
+  NumaTopology() : node_count_(1) {
+    const std::string root = "/sys/devices/system/node/";
+    for (uint32_t node : ReadList(root + "online")) {
+      for (uint32_t cpu : ReadList(root + "node" + std::to_string(node) +
+                                   "/cpulist")) {
+        if (cpu >= cpu_nodes_.size()) {
+          cpu_nodes_.resize(cpu + 1, 0);
+        }
+        cpu_nodes_[cpu] = node;
+      }
+      node_count_ = std::max(node_count_, node + 1);
+    }
+  }
+
+  // parses a cpu or node list such as "0-3,8-11"
+  static std::vector<uint32_t> ReadList(const std::string &path) {
+    std::vector<uint32_t> ids;
+    std::ifstream file(path);
+    std::string list;
+    if (!std::getline(file, list)) {
+      return ids;
+    }
+    std::size_t pos = 0;
+    while (pos < list.size()) {
+      std::size_t end = list.find(',', pos);
+      if (end == std::string::npos) {
+        end = list.size();
+      }
+      std::string range = list.substr(pos, end - pos);
+      std::size_t dash = range.find('-');
+      char *rest = nullptr;
+      uint32_t first =
+          static_cast<uint32_t>(std::strtoul(range.c_str(), &rest, 10));
+      uint32_t last = first;
+      if (dash != std::string::npos) {
+        last = static_cast<uint32_t>(
+            std::strtoul(range.c_str() + dash + 1, &rest, 10));
+      }
+      if (rest != range.c_str()) {
+        for (uint32_t id = first; id <= last; ++id) {
+          ids.push_back(id);
+        }
+      }
+      pos = end + 1;
+    }
+    return ids;
+  }
+
+  uint32_t node_count_;
+  std::vector<uint32_t> cpu_nodes_;
+};
+
+/**
+ * @brief Thread-safe pool of fixed size blocks with per-thread caches
+ *
+ * Every thread caches free blocks in two magazines, so allocating and
+ * freeing usually neither locks nor touches shared cache lines. When both
+ * magazines are empty, or both full, the thread swaps one with the depot of
+ * its arena under the arena mutex; a depot without full magazines is refilled
+ * from chunks, which grow as configured up to max_blocks. Memory is only
+ * given back when the pool is destroyed, every block must be freed before
+ * that. Like malloc,
+ * blocks are aligned for any fundamental type.
+ *
+ * With numa_aware, each NUMA node has its own arena and chunks are preferably
+ * placed on that node. A thread stays with the arena of the node it first
+ * allocated or freed on, a block freed on another node moves to that node.
+ */
+class MagazinePool {
+ public:
+  MagazinePool(std::size_t block_size, std::size_t block_align,
+               const MagazinePoolOptions &options = MagazinePoolOptions());
+  ~MagazinePool();
+
+  void *Allocate();
+  void Deallocate(void *block);
+
+  // blocks carved from chunks so far, in use or cached
+  std::size_t Capacity();
+  uint32_t ArenaCount() const { return static_cast<uint32_t>(arenas_.size()); }
+
+ private:
+  MagazinePool(const MagazinePool &) = delete;
+  MagazinePool &operator=(const MagazinePool &) = delete;
+
+  struct Magazine {
+    uint32_t count;
+    Magazine *next;
+    void *blocks[1];
+  };
+
+  struct Chunk {
+    void *memory;
+    std::size_t bytes;
+  };
+
+  struct Arena {
+    std::mutex mutex;
+    uint32_t node = 0;
+    // depot, magazines in full are not empty but may be partly filled
+    Magazine *full = nullptr;
+    Magazine *empty = nullptr;
+    // single blocks freed by exiting threads
+    void *loose = nullptr;
+    char *cursor = nullptr;
+    char *limit = nullptr;
+    uint32_t next_chunk_blocks = 0;
+    std::size_t capacity = 0;
+    std::vector<Chunk> chunks;
+    std::vector<Magazine *> magazines;
+  };
+
+  struct ThreadCache {
+    uint64_t pool_id = 0;
+    MagazinePool *pool = nullptr;
+    Arena *arena = nullptr;
+    Magazine *loaded = nullptr;
+    Magazine *previous = nullptr;
+  };
+
+  // indexed by pool slot, flushed into the pools still alive at thread exit
+  struct ThreadCaches {
+    std::vector<ThreadCache> caches;
+    ~ThreadCaches();
+  };
+
+  // live pool ids by slot, 0 for a free slot
+  struct Registry {
+    std::mutex mutex;
+    std::vector<uint64_t> ids;
+    uint64_t next_id = 1;
+  };
+
+  static Registry *GetRegistry() {
+    static Registry *registry = new Registry();
+    return registry;
+  }
+
+  static ThreadCaches *GetThreadCaches();
+
+  ThreadCache *Cache() {
+    auto caches = GetThreadCaches();
+    if (cyber_likely(caches != nullptr && slot_ < caches->caches.size() &&
+                     caches->caches[slot_].pool_id == id_)) {
+      return &caches->caches[slot_];
+    }
+    return InitCache(caches);
+  }
+
+  ThreadCache *InitCache(ThreadCaches *caches);
+  void *Refill(ThreadCache *cache);
+  void Drain(ThreadCache *cache, void *block);
+  void Flush(ThreadCache *cache);
+
+  // the following are called with arena->mutex held
+  Magazine *NewMagazine(Arena *arena);
+  void *Carve(Arena *arena);
+
+  std::size_t block_size_;
+  std::size_t block_align_;
+  MagazinePoolOptions options_;
+  std::vector<std::unique_ptr<Arena>> arenas_;
+  std::size_t slot_ = 0;
+  uint64_t id_ = 0;
+};
+
+inline MagazinePool::MagazinePool(std::size_t block_size,
+                                  std::size_t block_align,
+                                  const MagazinePoolOptions &options)
+    : block_align_(std::max(block_align, alignof(std::max_align_t))),
+      options_(options) {
+  options_.magazine_size = std::max(options_.magazine_size, 1u);
+  options_.initial_chunk_blocks = std::max(options_.initial_chunk_blocks, 1u);
+  options_.growth_factor = std::max(options_.growth_factor, 1u);
+  options_.max_chunk_blocks =
+      std::max(options_.max_chunk_blocks, options_.initial_chunk_blocks);
+  block_size_ = std::max(block_size, sizeof(void *));
+  block_size_ = (block_size_ + block_align_ - 1) / block_align_ * block_align_;
+
+  uint32_t nodes =
+      options_.numa_aware ? NumaTopology::Instance()->NodeCount() : 1;
+  for (uint32_t node = 0; node < nodes; ++node) {
+    arenas_.emplace_back(new Arena());
+    arenas_.back()->node = node;
+    arenas_.back()->next_chunk_blocks = options_.initial_chunk_blocks;
+  }
+
+  auto registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  slot_ = std::find(registry->ids.begin(), registry->ids.end(), 0) -
+          registry->ids.begin();
+  if (slot_ == registry->ids.size()) {
+    registry->ids.push_back(0);
+  }
+  id_ = registry->next_id++;
+  registry->ids[slot_] = id_;
+}
+
+inline MagazinePool::~MagazinePool() {
+  {
+    // no thread flushes its cache into this pool after this
+    auto registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    registry->ids[slot_] = 0;
+  }
+  for (auto &arena : arenas_) {
+    for (auto magazine : arena->magazines) {
+      std::free(magazine);
+    }
+    for (auto &chunk : arena->chunks) {
+      if (options_.numa_aware) {
+        munmap(chunk.memory, chunk.bytes);
+      } else {
+        std::free(chunk.memory);
+      }
+    }
+  }
+}
+
+inline MagazinePool::ThreadCaches *MagazinePool::GetThreadCaches() {
+  // a pool may still be used by thread_local destructors running after
+  // caches is gone, exited tells them to go to the arena directly
+  static thread_local bool exited = false;
+  if (cyber_unlikely(exited)) {
+    return nullptr;
+  }
+  static thread_local struct Holder {
+    ThreadCaches caches;
+    ~Holder() { exited = true; }
+  } holder;
+  return &holder.caches;
+}
+
+inline MagazinePool::ThreadCaches::~ThreadCaches() {
+  auto registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  for (std::size_t slot = 0; slot < caches.size(); ++slot) {
+    auto &cache = caches[slot];
+    if (cache.pool != nullptr && slot < registry->ids.size() &&
+        registry->ids[slot] == cache.pool_id) {
+      cache.pool->Flush(&cache);
+    }
+  }
+}
+
+inline MagazinePool::ThreadCache *MagazinePool::InitCache(
+    ThreadCaches *caches) {
+  if (caches == nullptr) {
+    return nullptr;
+  }
+  if (slot_ >= caches->caches.size()) {
+    caches->caches.resize(slot_ + 1);
+  }
+  // an entry left by a destroyed pool points to freed magazines, drop it
+  auto cache = &caches->caches[slot_];
+  cache->pool_id = id_;
+  cache->pool = this;
+  cache->arena =
+      arenas_[NumaTopology::Instance()->CurrentNode() % arenas_.size()].get();
+  std::lock_guard<std::mutex> lock(cache->arena->mutex);
+  cache->loaded = NewMagazine(cache->arena);
+  cache->previous = NewMagazine(cache->arena);
+  return cache;
+}
+
+inline void *MagazinePool::Allocate() {
+  auto cache = Cache();
+  if (cyber_unlikely(cache == nullptr)) {
+    auto arena = arenas_.front().get();
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    return Carve(arena);
+  }
+  if (cyber_likely(cache->loaded->count > 0)) {
+    return cache->loaded->blocks[--cache->loaded->count];
+  }
+  if (cache->previous->count > 0) {
+    std::swap(cache->loaded, cache->previous);
+    return cache->loaded->blocks[--cache->loaded->count];
+  }
+  return Refill(cache);
+}
+
+inline void MagazinePool::Deallocate(void *block) {
+  auto cache = Cache();
+  if (cyber_unlikely(cache == nullptr)) {
+    auto arena = arenas_.front().get();
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    *static_cast<void **>(block) = arena->loose;
+    arena->loose = block;
+    return;
+  }
+  if (cyber_likely(cache->loaded->count < options_.magazine_size)) {
+    cache->loaded->blocks[cache->loaded->count++] = block;
+    return;
+  }
+  if (cache->previous->count == 0) {
+    std::swap(cache->loaded, cache->previous);
+    cache->loaded->blocks[cache->loaded->count++] = block;
+    return;
+  }
+  Drain(cache, block);
+}
+
+inline void *MagazinePool::Refill(ThreadCache *cache) {
+  auto arena = cache->arena;
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  if (arena->full != nullptr) {
+    // both cached magazines are empty, trade one for a full one
+    auto full = arena->full;
+    arena->full = full->next;
+    cache->previous->next = arena->empty;
+    arena->empty = cache->previous;
+    cache->previous = cache->loaded;
+    cache->loaded = full;
+    return cache->loaded->blocks[--cache->loaded->count];
+  }
+  // fill half of a magazine at once, the other half is room for frees
+  auto magazine = cache->loaded;
+  uint32_t batch = std::max(options_.magazine_size / 2, 1u);
+  while (magazine->count < batch) {
+    void *block = Carve(arena);
+    if (block == nullptr) {
+      break;
+    }
+    magazine->blocks[magazine->count++] = block;
+  }
+  if (magazine->count == 0) {
+    return nullptr;
+  }
+  return magazine->blocks[--magazine->count];
+}
+
+inline void MagazinePool::Drain(ThreadCache *cache, void *block) {
+  auto arena = cache->arena;
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  // both cached magazines hold blocks, hand one to the depot
+  cache->previous->next = arena->full;
+  arena->full = cache->previous;
+  cache->previous = cache->loaded;
+  if (arena->empty != nullptr) {
+    cache->loaded = arena->empty;
+    arena->empty = arena->empty->next;
+  } else {
+    cache->loaded = NewMagazine(arena);
+  }
+  cache->loaded->blocks[cache->loaded->count++] = block;
+}
+
+inline void MagazinePool::Flush(ThreadCache *cache) {
+  auto arena = cache->arena;
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  for (auto magazine : {cache->loaded, cache->previous}) {
+    auto &list = magazine->count > 0 ? arena->full : arena->empty;
+    magazine->next = list;
+    list = magazine;
+  }
+  cache->pool = nullptr;
+  cache->loaded = nullptr;
+  cache->previous = nullptr;
+}
+
+inline MagazinePool::Magazine *MagazinePool::NewMagazine(Arena *arena) {
+  if (arena->empty != nullptr) {
+    auto magazine = arena->empty;
+    arena->empty = magazine->next;
+    return magazine;
+  }
+  auto magazine = static_cast<Magazine *>(CheckedMalloc(
+      sizeof(Magazine) + (options_.magazine_size - 1) * sizeof(void *)));
+  magazine->count = 0;
+  magazine->next = nullptr;
+  arena->magazines.push_back(magazine);
+  return magazine;
+}
+
+inline void *MagazinePool::Carve(Arena *arena) {
+  if (arena->loose != nullptr) {
+    void *block = arena->loose;
+    arena->loose = *static_cast<void **>(block);
+    return block;
+  }
+  if (cyber_unlikely(arena->cursor == arena->limit)) {
+    std::size_t blocks = arena->next_chunk_blocks;
+    if (options_.max_blocks > 0) {
+      blocks = std::min(blocks, options_.max_blocks - arena->capacity);
+      if (blocks == 0) {
+        return nullptr;
+      }
+    }
+    std::size_t bytes = blocks * block_size_;
+    void *memory = nullptr;
+    if (options_.numa_aware) {
+      memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (memory == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      // best effort, without the permission or a kernel with NUMA the
+      // pages just land where they are first touched
+      if (arena->node < 64) {
+        unsigned long mask = 1ul << arena->node;
+        syscall(SYS_mbind, memory, bytes, MPOL_PREFERRED, &mask, 65, 0);
+      }
+    } else if (posix_memalign(&memory, block_align_, bytes) != 0) {
+      throw std::bad_alloc();
+    }
+    arena->chunks.push_back({memory, bytes});
+    arena->cursor = static_cast<char *>(memory);
+    arena->limit = arena->cursor + bytes;
+    arena->capacity += blocks;
+    arena->next_chunk_blocks = static_cast<uint32_t>(
+        std::min<uint64_t>(blocks * options_.growth_factor,
+                           options_.max_chunk_blocks));
+  }
+  void *block = arena->cursor;
+  arena->cursor += block_size_;
+  return block;
+}
+
+inline std::size_t MagazinePool::Capacity() {
+  std::size_t capacity = 0;
+  for (auto &arena : arenas_) {
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    capacity += arena->capacity;
+  }
+  return capacity;
+}
+
+/**
+ * @brief Objects of type T from a MagazinePool, handed out as shared_ptr
+ *
+ * Unlike CCObjectPool it grows instead of running out, unless max_blocks is
+ * set: then it returns nullptr like CCObjectPool. The pool must outlive the
+ * objects it handed out.
+ */
+template <typename T>
+class MagazineObjectPool {
+ public:
+  explicit MagazineObjectPool(
+      const MagazinePoolOptions &options = MagazinePoolOptions())
+      : blocks_(sizeof(T), alignof(T), options) {}
+
+  template <typename... Args>
+  std::shared_ptr<T> ConstructObject(Args &&... args) {
+    void *block = blocks_.Allocate();
+    if (cyber_unlikely(block == nullptr)) {
+      return nullptr;
+    }
+    T *object = new (block) T(std::forward<Args>(args)...);
+    return std::shared_ptr<T>(object, Deleter{this});
+  }
+
+  // default-initialized, a large buffer in T is not zeroed first
+  std::shared_ptr<T> GetObject() {
+    void *block = blocks_.Allocate();
+    if (cyber_unlikely(block == nullptr)) {
+      return nullptr;
+    }
+    T *object = new (block) T;
+    return std::shared_ptr<T>(object, Deleter{this});
+  }
+
+  std::size_t Capacity() { return blocks_.Capacity(); }
+
+ private:
+  struct Deleter {
+    void operator()(T *object) const {
+      object->~T();
+      pool->blocks_.Deallocate(object);
+    }
+    MagazineObjectPool *pool;
+  };
+
+  MagazinePool blocks_;
+};
+
+/**
+ * @brief Allocator backed by a never destroyed MagazinePool per type
+ *
+ * With std::allocate_shared, an object and its control block come from one
+ * pooled block: std::allocate_shared<T>(PoolAllocator<T>(), args...).
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  PoolAllocator() = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &) {}  // NOLINT
+
+  T *allocate(std::size_t n) {
+    if (cyber_likely(n == 1)) {
+      return static_cast<T *>(Pool()->Allocate());
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, std::size_t n) {
+    if (cyber_likely(n == 1)) {
+      Pool()->Deallocate(ptr);
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+
+  static MagazinePool *Pool() {
+    static MagazinePool *pool = new MagazinePool(sizeof(T), alignof(T));
+    return pool;
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &) {
+  return false;
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_MAGAZINE_POOL_H_
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_MPMC_QUEUE_H_
+#define CYBER_BASE_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+// Lock-free ring for any number of producers and consumers. Every slot
+// carries a sequence number telling whose turn it is, so elements are moved
+// in and out of their slot instead of copied, and move-only types work.
+// Capacity is rounded up to a power of two, at least 2, so that indexing is
+// a mask.
+template <typename T>
+class MpmcQueue {
+public:
+	using value_type = T;
+	using size_type = uint64_t;
+
+public:
+	MpmcQueue() {}
+	MpmcQueue& operator=(const MpmcQueue& other) = delete;
+	MpmcQueue(const MpmcQueue& other) = delete;
+	~MpmcQueue();
+	bool Init(uint64_t size);
+	bool Enqueue(const T& element);
+	// |element| is left untouched when the queue is full
+	bool Enqueue(T&& element);
+	bool Dequeue(T* element);
+	uint64_t Size() const;
+	bool Empty() const { return Size() == 0; }
+	uint64_t Capacity() const { return capacity_; }
+
+private:
+	struct Slot {
+		std::atomic<uint64_t> sequence;
+		T data;
+	};
+
+	alignas(CACHELINE_SIZE) std::atomic<uint64_t> head_ = {0};
+	alignas(CACHELINE_SIZE) std::atomic<uint64_t> tail_ = {0};
+	alignas(CACHELINE_SIZE) uint64_t capacity_ = 0;
+	uint64_t mask_ = 0;
+	Slot* pool_ = nullptr;
+};
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue() {
+	if (pool_) {
+		for (uint64_t i = 0; i < capacity_; ++i) {
+			pool_[i].~Slot();
+		}
+		std::free(pool_);
+	}
+}
+
+template <typename T>
+bool MpmcQueue<T>::Init(uint64_t size) {
+	if (size == 0 || pool_ != nullptr) {
+		return false;
+	}
+	// with a single slot the sequence of a full and an empty slot coincide
+	capacity_ = 2;
+	while (capacity_ < size) {
+		capacity_ <<= 1;
+	}
+	mask_ = capacity_ - 1;
+	pool_ = reinterpret_cast<Slot*>(std::calloc(capacity_, sizeof(Slot)));
+	if (pool_ == nullptr) {
+		return false;
+	}
+	for (uint64_t i = 0; i < capacity_; ++i) {
+		new (&(pool_[i])) Slot();
+		pool_[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::Enqueue(const T& element) {
+	T copy(element);
+	return Enqueue(std::move(copy));
+}
+
+template <typename T>
+bool MpmcQueue<T>::Enqueue(T&& element) {
+	uint64_t tail = tail_.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+	while (true) {
+		slot = &pool_[tail & mask_];
+		uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+		int64_t diff = static_cast<int64_t>(sequence - tail);
+		if (diff == 0) {
+			if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			// the slot still holds the element of the previous lap
+			return false;
+		} else {
+			tail = tail_.load(std::memory_order_relaxed);
+		}
+	}
+	slot->data = std::move(element);
+	slot->sequence.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::Dequeue(T* element) {
+	uint64_t head = head_.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+	while (true) {
+		slot = &pool_[head & mask_];
+		uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+		int64_t diff = static_cast<int64_t>(sequence - (head + 1));
+		if (diff == 0) {
+			if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;
+		} else {
+			head = head_.load(std::memory_order_relaxed);
+		}
+	}
+	*element = std::move(slot->data);
+	// release the slot content before handing it to the next lap
+	slot->data = T();
+	slot->sequence.store(head + capacity_, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+inline uint64_t MpmcQueue<T>::Size() const {
+	uint64_t head = head_.load(std::memory_order_acquire);
+	uint64_t tail = tail_.load(std::memory_order_acquire);
+	return tail > head ? tail - head : 0;
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_MPMC_QUEUE_H_
@@ -17,11 +17,13 @@
 #ifndef CYBER_BASE_SIGNAL_H_
 #define CYBER_BASE_SIGNAL_H_
 
-#include <algorithm>
+#include <atomic>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
+
+#include "cyber/base/epoch_reclaimer.h"
 
 namespace apollo {
 namespace cyber {
@@ -33,82 +35,97 @@ class Slot;
 template <typename... Args>
 class Connection;
 
+/**
+ * @brief Emission reads an immutable array of slots without locking or
+ * copying it. Connect and Disconnect replace the array under a mutex, the
+ * replaced one is released through EpochReclaimer once no emission uses it.
+ * Slots run inside an EpochReclaimer::Guard, a slot that blocks holds back
+ * reclamation until it returns.
+ */
 template <typename... Args>
 class Signal {
 public:
 	using Callback = std::function<void(Args...)>;
 	using SlotPtr = std::shared_ptr<Slot<Args...>>;
-	using SlotList = std::list<SlotPtr>;
+	using SlotList = std::vector<SlotPtr>;
 	using ConnectionType = Connection<Args...>;
 
-	Signal() {}
-	virtual ~Signal() { DisconnectAllSlots(); }
+	Signal() : slots_(new SlotList()) {}
+	virtual ~Signal() {
+		DisconnectAllSlots();
+		delete slots_.load(std::memory_order_acquire);
+	}
 
 	void operator()(Args... args) {
-		SlotList local;
-		{
-			std::lock_guard<std::mutex> lock(mutex_);
-			for (auto& slot : slots_) {
-				local.emplace_back(slot);
-			}
-		}
-
-		if (!local.empty()) {
-			for (auto& slot : local) {
-				(*slot)(args...);
-			}
+		EpochReclaimer::Guard guard;
+		auto slots = slots_.load(std::memory_order_acquire);
+		for (auto& slot : *slots) {
+			(*slot)(args...);
 		}
-
-		ClearDisconnectedSlots();
 	}
 
 	ConnectionType Connect(const Callback& cb) {
 		auto slot = std::make_shared<Slot<Args...>>(cb);
 		{
 			std::lock_guard<std::mutex> lock(mutex_);
-			slots_.emplace_back(slot);
+			auto current = slots_.load(std::memory_order_relaxed);
+			auto slots = new SlotList();
+			slots->reserve(current->size() + 1);
+			// slots disconnected on their own are dropped on the way
+			for (auto& connected : *current) {
+				if (connected->connected()) {
+					slots->emplace_back(connected);
+				}
+			}
+			slots->emplace_back(slot);
+			Publish(slots);
 		}
 
 		return ConnectionType(slot, this);
 	}
 
 	bool Disconnect(const ConnectionType& conn) {
-		bool find = false;
-		{
 		std::lock_guard<std::mutex> lock(mutex_);
-			for (auto& slot : slots_) {
-				if (conn.HasSlot(slot)) {
-					find = true;
-					slot->Disconnect();
-				}
+		auto current = slots_.load(std::memory_order_relaxed);
+		auto slots = new SlotList();
+		slots->reserve(current->size());
+		bool find = false;
+		for (auto& slot : *current) {
+			if (conn.HasSlot(slot)) {
+				find = true;
+				slot->Disconnect();
+			} else if (slot->connected()) {
+				slots->emplace_back(slot);
 			}
 		}
 
 		if (find) {
-			ClearDisconnectedSlots();
+			Publish(slots);
+		} else {
+			delete slots;
 		}
 		return find;
 	}
 
 	void DisconnectAllSlots() {
 		std::lock_guard<std::mutex> lock(mutex_);
-		for (auto& slot : slots_) {
+		for (auto& slot : *slots_.load(std::memory_order_relaxed)) {
 			slot->Disconnect();
 		}
-		slots_.clear();
+		Publish(new SlotList());
 	}
 
 private:
 	Signal(const Signal&) = delete;
 	Signal& operator=(const Signal&) = delete;
 
-	void ClearDisconnectedSlots() {
-		std::lock_guard<std::mutex> lock(mutex_);
-		slots_.erase(std::remove_if(slots_.begin(), slots_.end(), [](const SlotPtr& slot) { return !slot->connected(); }),
-		slots_.end());
+	// with mutex_ held
+	void Publish(SlotList* slots) {
+		auto old_slots = slots_.exchange(slots, std::memory_order_acq_rel);
+		EpochReclaimer::Instance()->Retire(old_slots);
 	}
 
-	SlotList slots_;
+	std::atomic<SlotList*> slots_;
 	std::mutex mutex_;
 };
 
@@ -165,23 +182,23 @@ class Slot {
 public:
 	using Callback = std::function<void(Args...)>;
 	Slot(const Slot& another)
-		: cb_(another.cb_), connected_(another.connected_) {}
+		: cb_(another.cb_), connected_(another.connected()) {}
 	explicit Slot(const Callback& cb, bool connected = true)
 		: cb_(cb), connected_(connected) {}
 	virtual ~Slot() {}
 
 	void operator()(Args... args) {
-		if (connected_ && cb_) {
+		if (connected_.load(std::memory_order_acquire) && cb_) {
 			cb_(args...);
 		}
 	}
 
-void Disconnect() { connected_ = false; }
-bool connected() const { return connected_; }
+	void Disconnect() { connected_.store(false, std::memory_order_release); }
+	bool connected() const { return connected_.load(std::memory_order_acquire); }
 
 private:
 	Callback cb_;
-	bool connected_ = true;
+	std::atomic<bool> connected_ = {true};
 };
 
 }  // namespace base
@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_SPSC_QUEUE_H_
+#define CYBER_BASE_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+// Wait-free ring for exactly one producer thread and one consumer thread.
+// Capacity is rounded up to a power of two so that indexing is a mask.
+template <typename T>
+class SpscQueue {
+public:
+	using value_type = T;
+	using size_type = uint64_t;
+
+public:
+	SpscQueue() {}
+	SpscQueue& operator=(const SpscQueue& other) = delete;
+	SpscQueue(const SpscQueue& other) = delete;
+	~SpscQueue();
+	bool Init(uint64_t size);
+	bool Enqueue(const T& element);
+	bool Enqueue(T&& element);
+	bool Dequeue(T* element);
+	// only valid on the consumer side, returns nullptr when empty
+	T* Front();
+	void PopFront();
+	uint64_t Size() const;
+	bool Empty() const { return Size() == 0; }
+	uint64_t Capacity() const { return capacity_; }
+
+private:
+	alignas(CACHELINE_SIZE) std::atomic<uint64_t> head_ = {0};
+	// consumer side copy of tail_, refreshed only when the ring looks empty
+	uint64_t cached_tail_ = 0;
+	alignas(CACHELINE_SIZE) std::atomic<uint64_t> tail_ = {0};
+	// producer side copy of head_, refreshed only when the ring looks full
+	uint64_t cached_head_ = 0;
+	alignas(CACHELINE_SIZE) uint64_t capacity_ = 0;
+	uint64_t mask_ = 0;
+	T* pool_ = nullptr;
+};
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+	if (pool_) {
+		for (uint64_t i = 0; i < capacity_; ++i) {
+			pool_[i].~T();
+		}
+		std::free(pool_);
+	}
+}
+
+template <typename T>
+bool SpscQueue<T>::Init(uint64_t size) {
+	if (size == 0 || pool_ != nullptr) {
+		return false;
+	}
+	capacity_ = 1;
+	while (capacity_ < size) {
+		capacity_ <<= 1;
+	}
+	mask_ = capacity_ - 1;
+	pool_ = reinterpret_cast<T*>(std::calloc(capacity_, sizeof(T)));
+	if (pool_ == nullptr) {
+		return false;
+	}
+	for (uint64_t i = 0; i < capacity_; ++i) {
+		new (&(pool_[i])) T();
+	}
+	return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::Enqueue(const T& element) {
+	T copy(element);
+	return Enqueue(std::move(copy));
+}
+
+template <typename T>
+bool SpscQueue<T>::Enqueue(T&& element) {
+	uint64_t tail = tail_.load(std::memory_order_relaxed);
+	if (tail - cached_head_ == capacity_) {
+		cached_head_ = head_.load(std::memory_order_acquire);
+		if (tail - cached_head_ == capacity_) {
+			return false;
+		}
+	}
+	pool_[tail & mask_] = std::move(element);
+	tail_.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+T* SpscQueue<T>::Front() {
+	uint64_t head = head_.load(std::memory_order_relaxed);
+	if (head == cached_tail_) {
+		cached_tail_ = tail_.load(std::memory_order_acquire);
+		if (head == cached_tail_) {
+			return nullptr;
+		}
+	}
+	return &pool_[head & mask_];
+}
+
+template <typename T>
+void SpscQueue<T>::PopFront() {
+	uint64_t head = head_.load(std::memory_order_relaxed);
+	if (head == cached_tail_) {
+		cached_tail_ = tail_.load(std::memory_order_acquire);
+		if (head == cached_tail_) {
+			return;
+		}
+	}
+	// release the slot content before handing it back to the producer
+	pool_[head & mask_] = T();
+	head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool SpscQueue<T>::Dequeue(T* element) {
+	T* front = Front();
+	if (front == nullptr) {
+		return false;
+	}
+	*element = std::move(*front);
+	PopFront();
+	return true;
+}
+
+template <typename T>
+inline uint64_t SpscQueue<T>::Size() const {
+	uint64_t head = head_.load(std::memory_order_acquire);
+	uint64_t tail = tail_.load(std::memory_order_acquire);
+	return tail > head ? tail - head : 0;
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_SPSC_QUEUE_H_
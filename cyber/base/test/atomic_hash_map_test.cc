@@ -16,6 +16,7 @@
 
 #include "cyber/base/atomic_hash_map.h"
 
+#include <atomic>
 #include <string>
 #include <thread>
 
@@ -98,6 +99,85 @@ TEST(AtomicHashMapTest, concurrency) {
   EXPECT_EQ("0", *str);
 }
 
+TEST(AtomicHashMapTest, remove) {
+  AtomicHashMap<int, int, 4> map;
+  int value = 0;
+  for (int i = 0; i < 10000; i++) {
+    map.Set(i, i);
+  }
+  EXPECT_EQ(10000, map.Size());
+  for (int i = 0; i < 10000; i += 2) {
+    EXPECT_TRUE(map.Remove(i));
+    EXPECT_FALSE(map.Remove(i));
+  }
+  EXPECT_EQ(5000, map.Size());
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(i % 2 == 1, map.Get(i, &value));
+    if (i % 2 == 1) {
+      EXPECT_EQ(i, value);
+    }
+  }
+  map.Set(0, 42);
+  EXPECT_TRUE(map.Get(0, &value));
+  EXPECT_EQ(42, value);
+}
+
+TEST(AtomicHashMapTest, str_key) {
+  AtomicHashMap<std::string, int> map;
+  int value = 0;
+  for (int i = 0; i < 1000; i++) {
+    map.Set("/channel/" + std::to_string(i), i);
+  }
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_TRUE(map.Get("/channel/" + std::to_string(i), &value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(map.Has("/channel/1000"));
+  EXPECT_TRUE(map.Remove("/channel/10"));
+  EXPECT_FALSE(map.Has("/channel/10"));
+}
+
+TEST(AtomicHashMapTest, concurrent_remove) {
+  AtomicHashMap<int, std::string> map;
+  const int key_num = 4096;
+  std::atomic<bool> stop(false);
+  for (int i = 0; i < key_num; i++) {
+    map.Set(i, std::to_string(i));
+  }
+
+  std::thread writers[2];
+  for (int w = 0; w < 2; w++) {
+    writers[w] = std::thread([&, w]() {
+      for (int round = 0; round < 20; round++) {
+        for (int i = w; i < key_num; i += 2) {
+          map.Remove(i);
+          map.Set(i, std::to_string(i));
+        }
+      }
+    });
+  }
+  std::thread reader([&]() {
+    std::string value;
+    while (!stop.load()) {
+      for (int i = 0; i < key_num; i++) {
+        if (map.Get(i, &value)) {
+          EXPECT_EQ(std::to_string(i), value);
+        }
+      }
+    }
+  });
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  stop.store(true);
+  reader.join();
+
+  EXPECT_EQ(key_num, map.Size());
+  for (int i = 0; i < key_num; i++) {
+    EXPECT_TRUE(map.Has(i));
+  }
+}
+
 }  // namespace base
 }  // namespace cyber
 }  // namespace apollo
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/epoch_reclaimer.h"
+
+#include <atomic>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+std::atomic<int> deleted(0);
+
+struct Counted {
+  ~Counted() { deleted.fetch_add(1); }
+};
+
+TEST(EpochReclaimerTest, retire) {
+  auto reclaimer = EpochReclaimer::Instance();
+  reclaimer->Reclaim();
+  deleted.store(0);
+
+  reclaimer->Retire(new Counted());
+  reclaimer->Reclaim();
+  reclaimer->Reclaim();
+  EXPECT_EQ(1, deleted.load());
+}
+
+TEST(EpochReclaimerTest, guard) {
+  auto reclaimer = EpochReclaimer::Instance();
+  reclaimer->Reclaim();
+  deleted.store(0);
+
+  std::atomic<bool> entered(false);
+  std::atomic<bool> leave(false);
+  std::thread reader([&]() {
+    EpochReclaimer::Guard guard;
+    entered.store(true);
+    while (!leave.load()) {
+      std::this_thread::yield();
+    }
+  });
+  while (!entered.load()) {
+    std::this_thread::yield();
+  }
+
+  // the reader may still see it
+  reclaimer->Retire(new Counted());
+  for (int i = 0; i < 4; i++) {
+    reclaimer->Reclaim();
+  }
+  EXPECT_EQ(0, deleted.load());
+
+  leave.store(true);
+  reader.join();
+  reclaimer->Reclaim();
+  reclaimer->Reclaim();
+  EXPECT_EQ(1, deleted.load());
+  EXPECT_EQ(0, reclaimer->Pending());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
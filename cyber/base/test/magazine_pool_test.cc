@@ -0,0 +1,218 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/magazine_pool.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/base/for_each.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+std::atomic<int> alive(0);
+
+struct TestNode {
+  TestNode() { alive.fetch_add(1); }
+  explicit TestNode(int data) : value(data) { alive.fetch_add(1); }
+  ~TestNode() { alive.fetch_sub(1); }
+  int value = 0;
+  std::string name = "node";
+};
+
+TEST(MagazinePoolTest, base) {
+  MagazinePoolOptions options;
+  options.magazine_size = 2;
+  options.initial_chunk_blocks = 4;
+  options.max_chunk_blocks = 8;
+  MagazineObjectPool<TestNode> pool(options);
+  EXPECT_EQ(0, pool.Capacity());
+
+  std::vector<std::shared_ptr<TestNode>> vec;
+  FOR_EACH(i, 0, 20) {
+    vec.push_back(pool.ConstructObject(i));
+    EXPECT_EQ(i, vec.back()->value);
+  }
+  EXPECT_EQ(20, alive.load());
+  // chunks of 4, 8 and 8 blocks
+  EXPECT_EQ(20, pool.Capacity());
+
+  TestNode *released = vec.back().get();
+  vec.pop_back();
+  EXPECT_EQ(19, alive.load());
+  auto reused = pool.GetObject();
+  EXPECT_EQ(released, reused.get());
+  EXPECT_EQ(0, reused->value);
+  EXPECT_EQ("node", reused->name);
+
+  vec.clear();
+  reused.reset();
+  EXPECT_EQ(0, alive.load());
+  FOR_EACH(i, 0, 20) { vec.push_back(pool.ConstructObject(i)); }
+  EXPECT_EQ(20, pool.Capacity());
+  vec.clear();
+}
+
+TEST(MagazinePoolTest, max_blocks) {
+  MagazinePoolOptions options;
+  options.magazine_size = 2;
+  options.initial_chunk_blocks = 4;
+  options.max_blocks = 6;
+  MagazineObjectPool<TestNode> pool(options);
+
+  std::vector<std::shared_ptr<TestNode>> vec;
+  FOR_EACH(i, 0, 6) {
+    vec.push_back(pool.ConstructObject(i));
+    ASSERT_NE(nullptr, vec.back());
+  }
+  // chunks of 4 and 2 blocks, then nothing more
+  EXPECT_EQ(nullptr, pool.ConstructObject(6));
+  EXPECT_EQ(nullptr, pool.GetObject());
+  EXPECT_EQ(6, pool.Capacity());
+
+  vec.pop_back();
+  EXPECT_NE(nullptr, pool.GetObject());
+  vec.clear();
+  EXPECT_EQ(0, alive.load());
+}
+
+TEST(MagazinePoolTest, multi_thread) {
+  const uint64_t count = 20000;
+  MagazinePoolOptions options;
+  options.magazine_size = 8;
+  MagazinePool pool(sizeof(uint64_t), alignof(uint64_t), options);
+  // a locked handoff, the producers of a lock-free ring spin on each other
+  // when a single cpu preempts one of them mid-commit
+  std::mutex handoff_mutex;
+  std::deque<uint64_t *> handoff;
+
+  // blocks taken by the producers are freed by the consumers, so magazines
+  // keep moving through the depot; a block handed out twice would lose the
+  // value written first
+  std::vector<std::thread> threads;
+  FOR_EACH(t, 0, 4) {
+    threads.emplace_back([&pool, &handoff_mutex, &handoff, count, t]() {
+      FOR_EACH(i, 0, count) {
+        auto value = static_cast<uint64_t *>(pool.Allocate());
+        *value = t * count + i;
+        while (true) {
+          {
+            std::lock_guard<std::mutex> lock(handoff_mutex);
+            if (handoff.size() < 1024) {
+              handoff.push_back(value);
+              break;
+            }
+          }
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  std::atomic<uint64_t> sum(0);
+  FOR_EACH(t, 0, 4) {
+    threads.emplace_back([&pool, &handoff_mutex, &handoff, &sum, count]() {
+      FOR_EACH(i, 0, count) {
+        uint64_t *value = nullptr;
+        while (value == nullptr) {
+          {
+            std::lock_guard<std::mutex> lock(handoff_mutex);
+            if (!handoff.empty()) {
+              value = handoff.front();
+              handoff.pop_front();
+            }
+          }
+          if (value == nullptr) {
+            std::this_thread::yield();
+          }
+        }
+        sum.fetch_add(*value);
+        pool.Deallocate(value);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(4 * count * (4 * count - 1) / 2, sum.load());
+  EXPECT_LT(pool.Capacity(), 4 * count);
+}
+
+TEST(MagazinePoolTest, thread_exit) {
+  MagazineObjectPool<TestNode> pool;
+  std::thread([&pool]() {
+    std::vector<std::shared_ptr<TestNode>> vec;
+    FOR_EACH(i, 0, 100) { vec.push_back(pool.ConstructObject(i)); }
+  }).join();
+  std::size_t capacity = pool.Capacity();
+  EXPECT_GE(capacity, 100);
+
+  // what the thread cached went back to the depot when it exited
+  std::vector<std::shared_ptr<TestNode>> vec;
+  FOR_EACH(i, 0, 100) { vec.push_back(pool.ConstructObject(i)); }
+  EXPECT_EQ(capacity, pool.Capacity());
+}
+
+TEST(MagazinePoolTest, destroyed_pool) {
+  {
+    MagazineObjectPool<TestNode> pool;
+    std::thread([&pool]() { pool.ConstructObject(1); }).join();
+    pool.ConstructObject(2);
+  }
+  // a new pool may get the same slot in the thread caches
+  MagazineObjectPool<TestNode> pool;
+  EXPECT_EQ(3, pool.ConstructObject(3)->value);
+}
+
+TEST(MagazinePoolTest, numa_aware) {
+  MagazinePoolOptions options;
+  options.numa_aware = true;
+  MagazinePool pool(sizeof(TestNode), alignof(TestNode), options);
+  EXPECT_EQ(NumaTopology::Instance()->NodeCount(), pool.ArenaCount());
+  EXPECT_LT(NumaTopology::Instance()->CurrentNode(),
+            NumaTopology::Instance()->NodeCount());
+
+  void *block = pool.Allocate();
+  EXPECT_NE(nullptr, block);
+  pool.Deallocate(block);
+  EXPECT_EQ(block, pool.Allocate());
+  pool.Deallocate(block);
+}
+
+TEST(MagazinePoolTest, pool_allocator) {
+  auto node = std::allocate_shared<TestNode>(PoolAllocator<TestNode>(), 7);
+  EXPECT_EQ(7, node->value);
+  TestNode *released = node.get();
+  node.reset();
+  EXPECT_EQ(0, alive.load());
+  node = std::allocate_shared<TestNode>(PoolAllocator<TestNode>(), 8);
+  EXPECT_EQ(released, node.get());
+  EXPECT_EQ(8, node->value);
+
+  std::vector<int, PoolAllocator<int>> vec(100, 1);
+  EXPECT_EQ(100, vec.size());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/mpmc_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(MpmcQueueTest, Init) {
+  MpmcQueue<int> queue;
+  EXPECT_FALSE(queue.Init(0));
+  EXPECT_TRUE(queue.Init(100));
+  EXPECT_EQ(128, queue.Capacity());
+  EXPECT_FALSE(queue.Init(100));
+}
+
+TEST(MpmcQueueTest, EnqueueDequeue) {
+  MpmcQueue<int> queue;
+  queue.Init(8);
+  EXPECT_TRUE(queue.Empty());
+  for (int i = 1; i <= 8; ++i) {
+    EXPECT_TRUE(queue.Enqueue(i));
+    EXPECT_EQ(i, queue.Size());
+  }
+  EXPECT_FALSE(queue.Enqueue(9));
+  int value = 0;
+  for (int i = 1; i <= 8; ++i) {
+    EXPECT_TRUE(queue.Dequeue(&value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(queue.Dequeue(&value));
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(MpmcQueueTest, MoveOnly) {
+  MpmcQueue<std::unique_ptr<int>> queue;
+  queue.Init(1);
+  EXPECT_EQ(2, queue.Capacity());
+  std::unique_ptr<int> first(new int(1));
+  std::unique_ptr<int> second(new int(2));
+  std::unique_ptr<int> third(new int(3));
+  EXPECT_TRUE(queue.Enqueue(std::move(first)));
+  EXPECT_EQ(nullptr, first);
+  EXPECT_TRUE(queue.Enqueue(std::move(second)));
+  // a full queue leaves the element with the caller
+  EXPECT_FALSE(queue.Enqueue(std::move(third)));
+  ASSERT_NE(nullptr, third);
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(queue.Dequeue(&value));
+  EXPECT_EQ(1, *value);
+}
+
+TEST(MpmcQueueTest, concurrency) {
+  const int kProducers = 4;
+  const int kConsumers = 4;
+  const uint64_t kCount = 50000;
+  MpmcQueue<uint64_t> queue;
+  queue.Init(64);
+  std::atomic<uint64_t> sum = {0};
+  std::atomic<uint64_t> consumed = {0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue]() {
+      for (uint64_t i = 1; i <= kCount; ++i) {
+        while (!queue.Enqueue(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&]() {
+      uint64_t value = 0;
+      while (consumed.load() < kProducers * kCount) {
+        if (queue.Dequeue(&value)) {
+          sum += value;
+          ++consumed;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(kProducers * kCount * (kCount + 1) / 2, sum.load());
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
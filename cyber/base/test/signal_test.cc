@@ -16,7 +16,9 @@
 
 #include "cyber/base/signal.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -135,6 +137,33 @@ TEST(SignalTest, module) {
   EXPECT_NE(sum_b, lhs + rhs);
 }
 
+TEST(SignalTest, concurrency) {
+  Signal<int> sig;
+  std::atomic<int> sum(0);
+  auto conn = sig.Connect([&sum](int value) { sum.fetch_add(value); });
+
+  std::atomic<bool> stop(false);
+  std::thread churner([&]() {
+    while (!stop.load()) {
+      auto other = sig.Connect([](int) {});
+      other.Disconnect();
+    }
+  });
+  for (int i = 0; i < 100000; i++) {
+    sig(1);
+  }
+  stop.store(true);
+  churner.join();
+  EXPECT_EQ(100000, sum.load());
+
+  // a slot disconnected through its connection is no longer called
+  auto slot_conn = sig.Connect([&sum](int value) { sum.fetch_add(value); });
+  EXPECT_TRUE(slot_conn.IsConnected());
+  conn.Disconnect();
+  sig(1);
+  EXPECT_EQ(100001, sum.load());
+}
+
 }  // namespace base
 }  // namespace cyber
 }  // namespace apollo
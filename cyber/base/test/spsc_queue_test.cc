@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/spsc_queue.h"
+
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(SpscQueueTest, Init) {
+  SpscQueue<int> queue;
+  EXPECT_FALSE(queue.Init(0));
+  EXPECT_TRUE(queue.Init(100));
+  EXPECT_EQ(128, queue.Capacity());
+  EXPECT_FALSE(queue.Init(100));
+}
+
+TEST(SpscQueueTest, EnqueueDequeue) {
+  SpscQueue<int> queue;
+  queue.Init(8);
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(nullptr, queue.Front());
+  for (int i = 1; i <= 8; ++i) {
+    EXPECT_TRUE(queue.Enqueue(i));
+    EXPECT_EQ(i, queue.Size());
+  }
+  EXPECT_FALSE(queue.Enqueue(9));
+  EXPECT_EQ(1, *queue.Front());
+  queue.PopFront();
+  int value = 0;
+  for (int i = 2; i <= 8; ++i) {
+    EXPECT_TRUE(queue.Dequeue(&value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(queue.Dequeue(&value));
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(SpscQueueTest, ReleaseOnPop) {
+  SpscQueue<std::shared_ptr<int>> queue;
+  queue.Init(4);
+  auto ptr = std::make_shared<int>(1);
+  EXPECT_TRUE(queue.Enqueue(ptr));
+  EXPECT_EQ(2, ptr.use_count());
+  queue.PopFront();
+  EXPECT_EQ(1, ptr.use_count());
+}
+
+TEST(SpscQueueTest, concurrency) {
+  SpscQueue<uint64_t> queue;
+  queue.Init(64);
+  const uint64_t kCount = 100000;
+  std::thread producer([&]() {
+    for (uint64_t i = 0; i < kCount; ++i) {
+      while (!queue.Enqueue(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  uint64_t expected = 0;
+  uint64_t value = 0;
+  while (expected < kCount) {
+    if (queue.Dequeue(&value)) {
+      ASSERT_EQ(expected, value);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
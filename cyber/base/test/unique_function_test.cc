@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/unique_function.h"
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(UniqueFunctionTest, Empty) {
+  UniqueFunction<void()> func;
+  EXPECT_FALSE(func);
+  UniqueFunction<void()> null_func(nullptr);
+  EXPECT_FALSE(null_func);
+}
+
+TEST(UniqueFunctionTest, Invoke) {
+  int base = 10;
+  UniqueFunction<int(int, int)> add = [base](int a, int b) {
+    return base + a + b;
+  };
+  EXPECT_TRUE(add);
+  EXPECT_EQ(13, add(1, 2));
+}
+
+TEST(UniqueFunctionTest, MoveOnlyCapture) {
+  std::unique_ptr<int> value(new int(7));
+  UniqueFunction<int()> func = [value = std::move(value)]() { return *value; };
+  UniqueFunction<int()> moved = std::move(func);
+  EXPECT_FALSE(func);
+  EXPECT_EQ(7, moved());
+  func = std::move(moved);
+  EXPECT_EQ(7, func());
+}
+
+TEST(UniqueFunctionTest, InlineOrHeap) {
+  auto small = [](int x) { return x; };
+  std::array<char, 128> big_payload;
+  big_payload.fill(1);
+  auto big = [big_payload](int x) { return x + big_payload[100]; };
+  EXPECT_LE(sizeof(UniqueFunction<int(int)>), 64);
+  EXPECT_TRUE(UniqueFunction<int(int)>::IsStoredInline<decltype(small)>());
+  EXPECT_FALSE(UniqueFunction<int(int)>::IsStoredInline<decltype(big)>());
+
+  UniqueFunction<int(int)> func = big;
+  UniqueFunction<int(int)> moved = std::move(func);
+  EXPECT_EQ(2, moved(1));
+}
+
+TEST(UniqueFunctionTest, ReleaseCapture) {
+  auto value = std::make_shared<int>(1);
+  {
+    UniqueFunction<void()> func = [value]() {};
+    EXPECT_EQ(2, value.use_count());
+    UniqueFunction<void()> moved = std::move(func);
+    EXPECT_EQ(2, value.use_count());
+    moved = nullptr;
+    EXPECT_EQ(1, value.use_count());
+    moved = [value]() {};
+  }
+  EXPECT_EQ(1, value.use_count());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
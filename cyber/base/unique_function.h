@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_UNIQUE_FUNCTION_H_
+#define CYBER_BASE_UNIQUE_FUNCTION_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+template <typename Signature>
+class UniqueFunction;
+
+// Move-only std::function. Callables of up to kInlineSize bytes are stored in
+// the object itself, which is one cache line, so wrapping a small lambda never
+// allocates. Larger, over-aligned or throwing-move callables go to the heap.
+template <typename R, typename... Args>
+class UniqueFunction<R(Args...)> {
+public:
+	static const size_t kInlineSize = 64 - sizeof(void*);
+
+	template <typename F>
+	static constexpr bool IsStoredInline() {
+		return sizeof(F) <= kInlineSize && alignof(F) <= alignof(void*) &&
+			std::is_nothrow_move_constructible<F>::value;
+	}
+
+	UniqueFunction() {}
+	UniqueFunction(std::nullptr_t) {}
+
+	template <typename F, typename D = typename std::decay<F>::type,
+		typename = typename std::enable_if<!std::is_same<D, UniqueFunction>::value>::type>
+	UniqueFunction(F&& func) {
+		Assign<D>(std::forward<F>(func), std::integral_constant<bool, IsStoredInline<D>()>());
+	}
+
+	UniqueFunction(UniqueFunction&& other) noexcept { MoveFrom(&other); }
+
+	UniqueFunction& operator=(UniqueFunction&& other) noexcept {
+		if (this != &other) {
+			Reset();
+			MoveFrom(&other);
+		}
+		return *this;
+	}
+
+	UniqueFunction& operator=(std::nullptr_t) {
+		Reset();
+		return *this;
+	}
+
+	UniqueFunction(const UniqueFunction& other) = delete;
+	UniqueFunction& operator=(const UniqueFunction& other) = delete;
+
+	~UniqueFunction() { Reset(); }
+
+	explicit operator bool() const { return ops_ != nullptr; }
+
+	R operator()(Args... args) { return ops_->invoke(&storage_, std::forward<Args>(args)...); }
+
+private:
+	struct Ops {
+		R (*invoke)(void* storage, Args&&... args);
+		// move constructs into |dst| and destroys |src|
+		void (*relocate)(void* dst, void* src);
+		void (*destroy)(void* storage);
+	};
+
+	template <typename F>
+	struct InlineOps {
+		static R Invoke(void* storage, Args&&... args) {
+			return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+		}
+		static void Relocate(void* dst, void* src) {
+			new (dst) F(std::move(*static_cast<F*>(src)));
+			static_cast<F*>(src)->~F();
+		}
+		static void Destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+		static const Ops kOps;
+	};
+
+	template <typename F>
+	struct HeapOps {
+		static R Invoke(void* storage, Args&&... args) {
+			return (**static_cast<F**>(storage))(std::forward<Args>(args)...);
+		}
+		static void Relocate(void* dst, void* src) { *static_cast<F**>(dst) = *static_cast<F**>(src); }
+		static void Destroy(void* storage) { delete *static_cast<F**>(storage); }
+		static const Ops kOps;
+	};
+
+	template <typename D, typename F>
+	void Assign(F&& func, std::true_type) {
+		new (&storage_) D(std::forward<F>(func));
+		ops_ = &InlineOps<D>::kOps;
+	}
+
+	template <typename D, typename F>
+	void Assign(F&& func, std::false_type) {
+		*reinterpret_cast<D**>(&storage_) = new D(std::forward<F>(func));
+		ops_ = &HeapOps<D>::kOps;
+	}
+
+	void MoveFrom(UniqueFunction* other) {
+		if (other->ops_ != nullptr) {
+			other->ops_->relocate(&storage_, &other->storage_);
+			ops_ = other->ops_;
+			other->ops_ = nullptr;
+		}
+	}
+
+	void Reset() {
+		if (ops_ != nullptr) {
+			ops_->destroy(&storage_);
+			ops_ = nullptr;
+		}
+	}
+
+	typename std::aligned_storage<kInlineSize, alignof(void*)>::type storage_;
+	const Ops* ops_ = nullptr;
+};
+
+template <typename R, typename... Args>
+template <typename F>
+const typename UniqueFunction<R(Args...)>::Ops UniqueFunction<R(Args...)>::InlineOps<F>::kOps = {
+	&InlineOps<F>::Invoke, &InlineOps<F>::Relocate, &InlineOps<F>::Destroy};
+
+template <typename R, typename... Args>
+template <typename F>
+const typename UniqueFunction<R(Args...)>::Ops UniqueFunction<R(Args...)>::HeapOps<F>::kOps = {
+	&HeapOps<F>::Invoke, &HeapOps<F>::Relocate, &HeapOps<F>::Destroy};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_UNIQUE_FUNCTION_H_
@@ -16,12 +16,15 @@
 
 #include "cyber/binary.h"
 
+#include <atomic>
 #include <mutex>
 #include <string>
 
 namespace {
 std::mutex m;
 std::string binary_name; // NOLINT
+// every name ever set, never freed
+std::atomic<const std::string*> stable_name = {nullptr};
 }  // namespace
 
 namespace apollo {
@@ -32,9 +35,15 @@ std::string GetName() {
   std::lock_guard<std::mutex> lock(m);
   return binary_name;
 }
+const char* GetNameCStr() {
+  const std::string* name = stable_name.load(std::memory_order_acquire);
+  return name == nullptr ? "" : name->c_str();
+}
+
 void SetName(const std::string& name) {
   std::lock_guard<std::mutex> lock(m);
   binary_name = name;
+  stable_name.store(new std::string(name), std::memory_order_release);
 }
 
 }  // namespace binary
@@ -23,6 +23,9 @@ namespace apollo {
 namespace cyber {
 namespace binary {
 std::string GetName();
+// the same name, valid for the life of the process; it only changes its
+// address on SetName, so log call sites may cache by pointer
+const char* GetNameCStr();
 void SetName(const std::string& name);
 }  // namespace binary
 }  // namespace cyber
@@ -28,12 +28,14 @@
 #include "glog/raw_logging.h"
 
 #include "cyber/binary.h"
+#include "cyber/logger/binary_log.h"
+#include "cyber/logger/log_module.h"
 
 #define LEFT_BRACKET "["
 #define RIGHT_BRACKET "]"
 
 #ifndef MODULE_NAME
-#define MODULE_NAME apollo::cyber::binary::GetName().c_str()
+#define MODULE_NAME apollo::cyber::binary::GetNameCStr()
 #endif
 
 #define ADEBUG_MODULE(module) \
@@ -53,29 +55,68 @@
   ALOG_MODULE_STREAM(log_severity)(module)
 #endif
 
-#define ALOG_MODULE_STREAM_INFO(module)                         \
-  google::LogMessage(__FILE__, __LINE__, google::INFO).stream() \
-      << LEFT_BRACKET << module << RIGHT_BRACKET
-
-#define ALOG_MODULE_STREAM_WARN(module)                            \
-  google::LogMessage(__FILE__, __LINE__, google::WARNING).stream() \
-      << LEFT_BRACKET << module << RIGHT_BRACKET
-
-#define ALOG_MODULE_STREAM_ERROR(module)                         \
-  google::LogMessage(__FILE__, __LINE__, google::ERROR).stream() \
-      << LEFT_BRACKET << module << RIGHT_BRACKET
-
-#define ALOG_MODULE_STREAM_FATAL(module)                         \
-  google::LogMessage(__FILE__, __LINE__, google::FATAL).stream() \
-      << LEFT_BRACKET << module << RIGHT_BRACKET
+// Every call site keeps the interned id of its module, so the logger routes
+// the line without parsing it, and may be rate limited, see SetLogRateLimit.
+// A const char* module is cached by address and has to be a literal or keep
+// its contents there; pass computed names as std::string.
+#define ALOG_MODULE_SITE()                                  \
+  ([]() {                                                   \
+    static apollo::cyber::logger::LogSite cyber_log_site;   \
+    return &cyber_log_site;                                 \
+  }())
+
+#define ALOG_MODULE_STREAM_SEVERITY(module, severity)                     \
+  !apollo::cyber::logger::LogSite::Enter(ALOG_MODULE_SITE(), severity,    \
+                                         module)                          \
+      ? (void)0                                                           \
+      : google::LogMessageVoidify() &                                     \
+            apollo::cyber::logger::ModuleLogMessage(__FILE__, __LINE__,   \
+                                                    severity)             \
+                .stream()
+
+#define ALOG_MODULE_STREAM_INFO(module) \
+  ALOG_MODULE_STREAM_SEVERITY(module, google::INFO)
+
+#define ALOG_MODULE_STREAM_WARN(module) \
+  ALOG_MODULE_STREAM_SEVERITY(module, google::WARNING)
+
+#define ALOG_MODULE_STREAM_ERROR(module) \
+  ALOG_MODULE_STREAM_SEVERITY(module, google::ERROR)
+
+#define ALOG_MODULE_STREAM_FATAL(module) \
+  ALOG_MODULE_STREAM_SEVERITY(module, google::FATAL)
+
+// printf style logging with deferred formatting, the format string has to be
+// a literal. Every call site registers itself once; in binary mode only the
+// format id and the raw arguments are queued, see cyber/logger/binary_log.h.
+#define ALOG_FORMAT_MODULE(module, severity, format, ...)                  \
+  do {                                                                     \
+    static apollo::cyber::logger::LogSite cyber_log_site;                  \
+    if (severity >= FLAGS_minloglevel &&                                   \
+        apollo::cyber::logger::LogSite::Enter(&cyber_log_site, severity,   \
+                                              module)) {                   \
+      static const uint32_t cyber_log_format_id =                          \
+          apollo::cyber::logger::RegisterLogFormat(module, __FILE__,       \
+                                                   __LINE__, severity,     \
+                                                   format);                \
+      apollo::cyber::logger::LogWithFormat(cyber_log_format_id, severity,  \
+                                           ##__VA_ARGS__);                 \
+    }                                                                      \
+  } while (0)
+
+#define AINFO_F(format, ...) \
+  ALOG_FORMAT_MODULE(MODULE_NAME, google::INFO, format, ##__VA_ARGS__)
+#define AWARN_F(format, ...) \
+  ALOG_FORMAT_MODULE(MODULE_NAME, google::WARNING, format, ##__VA_ARGS__)
+#define AERROR_F(format, ...) \
+  ALOG_FORMAT_MODULE(MODULE_NAME, google::ERROR, format, ##__VA_ARGS__)
 
 #define AINFO_IF(cond) ALOG_IF(INFO, cond, MODULE_NAME)
 #define AWARN_IF(cond) ALOG_IF(WARN, cond, MODULE_NAME)
 #define AERROR_IF(cond) ALOG_IF(ERROR, cond, MODULE_NAME)
 #define AFATAL_IF(cond) ALOG_IF(FATAL, cond, MODULE_NAME)
 #define ALOG_IF(severity, cond, module) \
-  !(cond) ? (void)0                     \
-          : google::LogMessageVoidify() & ALOG_MODULE(module, severity)
+  !(cond) ? (void)0 : ALOG_MODULE(module, severity)
 
 #define ACHECK(cond) CHECK(cond) << LEFT_BRACKET << MODULE_NAME << RIGHT_BRACKET
 
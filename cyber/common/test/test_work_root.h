@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_COMMON_TEST_TEST_WORK_ROOT_H_
+#define CYBER_COMMON_TEST_TEST_WORK_ROOT_H_
+
+#include <ftw.h>
+#include <stdlib.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/file.h"
+#include "cyber/init.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+/**
+ * @class TestWorkRoot
+ * @brief A temporary CYBER_PATH for tests that run under cyber::Init with a
+ * cyber.pb.conf of their own. The whole tree is removed once the tests ran.
+ *
+ * int main(int argc, char** argv) {
+ *   testing::InitGoogleTest(&argc, argv);
+ *   apollo::cyber::common::TestWorkRoot work_root("foo_test");
+ *   return work_root.RunAllTests(argv[0], "scheduler_conf { ... }");
+ * }
+ */
+class TestWorkRoot {
+ public:
+  explicit TestWorkRoot(const std::string& name) {
+    std::string pattern = "/tmp/" + name + "_XXXXXX";
+    if (mkdtemp(&pattern[0]) != nullptr) {
+      path_ = pattern;
+    }
+  }
+
+  ~TestWorkRoot() {
+    if (!path_.empty()) {
+      // no logging, the logger is stopped by Clear()
+      nftw(path_.c_str(), RemoveEntry, 16, FTW_DEPTH | FTW_PHYS);
+    }
+  }
+
+  // empty when the directory could not be created
+  const std::string& path() const { return path_; }
+
+  /**
+   * @brief Write |conf| as conf/cyber.pb.conf, point CYBER_PATH here, and run
+   * all the tests between cyber::Init and cyber::Clear.
+   */
+  int RunAllTests(const char* binary_name, const std::string& conf) {
+    if (path_.empty()) {
+      return -1;
+    }
+    std::string conf_dir = path_ + "/conf";
+    EnsureDirectory(conf_dir);
+    std::ofstream conf_file(conf_dir + "/cyber.pb.conf");
+    conf_file << conf;
+    conf_file.close();
+    setenv("CYBER_PATH", path_.c_str(), 1);
+    Init(binary_name);
+    int ret = RUN_ALL_TESTS();
+    Clear();
+    return ret;
+  }
+
+ private:
+  static int RemoveEntry(const char* path, const struct stat*, int,
+                         struct FTW*) {
+    return remove(path);
+  }
+
+  std::string path_;
+};
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_COMMON_TEST_TEST_WORK_ROOT_H_
@@ -42,6 +42,8 @@ enum Relation : std::uint8_t {
 
 static const char SRV_CHANNEL_REQ_SUFFIX[] = "__SRV__REQUEST";
 static const char SRV_CHANNEL_RES_SUFFIX[] = "__SRV__RESPONSE";
+// set in the seq_num of the empty response to a request the Service rejected
+static const uint64_t SRV_REJECTED_SEQ_FLAG = 1ULL << 63;
 
 }  // namespace cyber
 }  // namespace apollo
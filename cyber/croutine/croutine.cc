@@ -19,10 +19,11 @@
 #include <algorithm>
 #include <utility>
 
-#include "cyber/base/concurrent_object_pool.h"
+#include "cyber/base/magazine_pool.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/croutine/detail/routine_context.h"
+#include "cyber/event/perf_event_cache.h"
 
 namespace apollo {
 namespace cyber {
@@ -32,7 +33,7 @@ thread_local CRoutine *CRoutine::current_routine_ = nullptr;
 thread_local char *CRoutine::main_stack_ = nullptr;
 
 namespace {
-std::shared_ptr<base::CCObjectPool<RoutineContext>> context_pool = nullptr;
+base::MagazineObjectPool<RoutineContext> *context_pool = nullptr;
 std::once_flag pool_init_flag;
 
 void CRoutineEntry(void *arg) {
@@ -49,7 +50,15 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
 	if (global_conf.has_scheduler_conf() && global_conf.scheduler_conf().has_routine_num()) {
 		routine_num = std::max(routine_num, global_conf.scheduler_conf().routine_num());
 	}
-	context_pool.reset(new base::CCObjectPool<RoutineContext>(routine_num));
+	// contexts hold 2MB stacks: pool routine_num of them and keep the
+	// per-thread caches small, the rest come from the heap and go back to it
+	// with their routine. The pool is not NUMA aware, the thread creating a
+	// routine rarely runs it.
+	base::MagazinePoolOptions options;
+	options.magazine_size = 2;
+	options.initial_chunk_blocks = std::max(routine_num, 1u);
+	options.max_blocks = options.initial_chunk_blocks;
+	context_pool = new base::MagazineObjectPool<RoutineContext>(options);
 	});
 
 	context_ = context_pool->GetObject();
@@ -77,8 +86,11 @@ RoutineState CRoutine::Resume() {
 	}
 
 	current_routine_ = this; //init to croutin each thread owns different pointer
+	event::PerfEventCache::Instance()->AddSchedEvent(event::SchedPerf::SWAP_IN, id_, processor_id_);
 	SwapContext(GetMainStack(), GetStack());
 	current_routine_ = nullptr;
+	event::PerfEventCache::Instance()->AddSchedEvent(event::SchedPerf::SWAP_OUT, id_, processor_id_,
+													static_cast<int>(state_));
 	return state_;
 }
 
@@ -69,6 +69,8 @@ public:
 	void Wake();
 	void HangUp();
 	void Sleep(const Duration &sleep_duration);
+	// IO_WAIT until notified or until wake_time, whichever comes first
+	void IoWaitUntil(const std::chrono::steady_clock::time_point &wake_time);
 
 	// getter and setter
 	RoutineState state() const;
@@ -110,6 +112,8 @@ private:
 	RoutineState state_;
 
 	bool force_stop_ = false;
+	// wake_time_ also ends an IO_WAIT
+	bool timed_io_wait_ = false;
 
 	int processor_id_ = -1;
 	uint32_t priority_ = 0;
@@ -156,6 +160,14 @@ inline void CRoutine::Sleep(const Duration &sleep_duration) {
 	CRoutine::Yield(RoutineState::SLEEP);
 }
 
+inline void CRoutine::IoWaitUntil(
+	const std::chrono::steady_clock::time_point &wake_time) {
+	wake_time_ = wake_time;
+	timed_io_wait_ = true;
+	CRoutine::Yield(RoutineState::IO_WAIT);
+	timed_io_wait_ = false;
+}
+
 inline uint64_t CRoutine::id() const { return id_; }
 
 inline void CRoutine::set_id(uint64_t id) { id_ = id; }
@@ -172,7 +184,8 @@ inline void CRoutine::set_processor_id(int processor_id) {
 
 inline RoutineState CRoutine::UpdateState() {
 	// Synchronous Event Mechanism
-	if (state_ == RoutineState::SLEEP &&
+	if ((state_ == RoutineState::SLEEP ||
+		(state_ == RoutineState::IO_WAIT && timed_io_wait_)) &&
 		std::chrono::steady_clock::now() > wake_time_) {
 		state_ = RoutineState::READY;
 		return state_;
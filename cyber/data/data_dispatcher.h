@@ -21,6 +21,7 @@
 #include <mutex>
 #include <vector>
 
+#include "cyber/base/epoch_reclaimer.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/data/channel_buffer.h"
@@ -42,10 +43,15 @@ public:
 
 	void AddBuffer(const ChannelBuffer<T>& channel_buffer);
 
+	// drops the channel once its last buffer is removed
+	void RemoveBuffer(const ChannelBuffer<T>& channel_buffer);
+
 	bool Dispatch(const uint64_t channel_id, const std::shared_ptr<T>& msg);
 
 private:
 	DataNotifier* notifier_ = DataNotifier::Instance();
+	// writers replace a vector instead of changing it, Dispatch walks it
+	// inside an epoch guard
 	std::mutex buffers_map_mutex_;
 	AtomicHashMap<uint64_t, BufferVector> buffers_map_;
 
@@ -59,22 +65,49 @@ template <typename T>
 void DataDispatcher<T>::AddBuffer(const ChannelBuffer<T>& channel_buffer) {
 	std::lock_guard<std::mutex> lock(buffers_map_mutex_);
 	auto buffer = channel_buffer.Buffer();
+	BufferVector new_buffers;
 	BufferVector* buffers = nullptr;
 	if (buffers_map_.Get(channel_buffer.channel_id(), &buffers)) {
-		buffers->emplace_back(buffer);
+		for (auto& buffer_wptr : *buffers) {
+			if (!buffer_wptr.expired()) {
+				new_buffers.emplace_back(buffer_wptr);
+			}
+		}
+	}
+	new_buffers.emplace_back(buffer);
+	buffers_map_.Set(channel_buffer.channel_id(), std::move(new_buffers));
+}
+
+template <typename T>
+void DataDispatcher<T>::RemoveBuffer(const ChannelBuffer<T>& channel_buffer) {
+	std::lock_guard<std::mutex> lock(buffers_map_mutex_);
+	auto buffer = channel_buffer.Buffer();
+	BufferVector* buffers = nullptr;
+	if (!buffers_map_.Get(channel_buffer.channel_id(), &buffers)) {
+		return;
+	}
+	BufferVector new_buffers;
+	for (auto& buffer_wptr : *buffers) {
+		auto item = buffer_wptr.lock();
+		if (item && item != buffer) {
+			new_buffers.emplace_back(buffer_wptr);
+		}
+	}
+	if (new_buffers.empty()) {
+		buffers_map_.Remove(channel_buffer.channel_id());
 	} else {
-		BufferVector new_buffers = {buffer};
-		buffers_map_.Set(channel_buffer.channel_id(), new_buffers);
+		buffers_map_.Set(channel_buffer.channel_id(), std::move(new_buffers));
 	}
 }
 
 template <typename T>
 bool DataDispatcher<T>::Dispatch(const uint64_t channel_id,
                                  const std::shared_ptr<T>& msg) {
-  BufferVector* buffers = nullptr;
   if (apollo::cyber::IsShutdown()) {
     return false;
   }
+  base::EpochReclaimer::Guard guard;
+  BufferVector* buffers = nullptr;
   if (buffers_map_.Get(channel_id, &buffers)) {
     for (auto& buffer_wptr : *buffers) {
       if (auto buffer = buffer_wptr.lock()) {
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <vector>
 
+#include "cyber/base/epoch_reclaimer.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/data/cache_buffer.h"
@@ -47,9 +48,15 @@ public:
 	void AddNotifier(uint64_t channel_id,
 	const std::shared_ptr<Notifier>& notifier);
 
+	// drops the channel once its last notifier is removed
+	void RemoveNotifier(uint64_t channel_id,
+	const std::shared_ptr<Notifier>& notifier);
+
 	bool Notify(const uint64_t channel_id);
 
 private:
+	// writers replace a vector instead of changing it, Notify walks it
+	// inside an epoch guard
 	std::mutex notifies_map_mutex_;
 	AtomicHashMap<uint64_t, NotifyVector> notifies_map_;
 
@@ -61,16 +68,37 @@ inline DataNotifier::DataNotifier() {}
 inline void DataNotifier::AddNotifier(uint64_t channel_id, const std::shared_ptr<Notifier>& notifier) 
 {
 	std::lock_guard<std::mutex> lock(notifies_map_mutex_);
+	NotifyVector new_notify;
 	NotifyVector* notifies = nullptr;
 	if (notifies_map_.Get(channel_id, &notifies)) {
-		notifies->emplace_back(notifier);
+		new_notify = *notifies;
+	}
+	new_notify.emplace_back(notifier);
+	notifies_map_.Set(channel_id, std::move(new_notify));
+}
+
+inline void DataNotifier::RemoveNotifier(uint64_t channel_id, const std::shared_ptr<Notifier>& notifier)
+{
+	std::lock_guard<std::mutex> lock(notifies_map_mutex_);
+	NotifyVector* notifies = nullptr;
+	if (!notifies_map_.Get(channel_id, &notifies)) {
+		return;
+	}
+	NotifyVector new_notify;
+	for (auto& item : *notifies) {
+		if (item != notifier) {
+			new_notify.emplace_back(item);
+		}
+	}
+	if (new_notify.empty()) {
+		notifies_map_.Remove(channel_id);
 	} else {
-		NotifyVector new_notify = {notifier};
-	notifies_map_.Set(channel_id, new_notify);
+		notifies_map_.Set(channel_id, std::move(new_notify));
 	}
 }
 
 inline bool DataNotifier::Notify(const uint64_t channel_id) {
+	base::EpochReclaimer::Guard guard;
 	NotifyVector* notifies = nullptr;
 	if (notifies_map_.Get(channel_id, &notifies)) {
 		for (auto& notifier : *notifies) {
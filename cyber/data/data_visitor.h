@@ -70,6 +70,11 @@ class DataVisitor : public DataVisitorBase {
       delete data_fusion_;
       data_fusion_ = nullptr;
     }
+    data_notifier_->RemoveNotifier(buffer_m0_.channel_id(), notifier_);
+    DataDispatcher<M0>::Instance()->RemoveBuffer(buffer_m0_);
+    DataDispatcher<M1>::Instance()->RemoveBuffer(buffer_m1_);
+    DataDispatcher<M2>::Instance()->RemoveBuffer(buffer_m2_);
+    DataDispatcher<M3>::Instance()->RemoveBuffer(buffer_m3_);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,    // NOLINT
@@ -112,6 +117,10 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
       delete data_fusion_;
       data_fusion_ = nullptr;
     }
+    data_notifier_->RemoveNotifier(buffer_m0_.channel_id(), notifier_);
+    DataDispatcher<M0>::Instance()->RemoveBuffer(buffer_m0_);
+    DataDispatcher<M1>::Instance()->RemoveBuffer(buffer_m1_);
+    DataDispatcher<M2>::Instance()->RemoveBuffer(buffer_m2_);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,  // NOLINT
@@ -147,6 +156,9 @@ public:
 			delete data_fusion_;
 			data_fusion_ = nullptr;
 		}
+		data_notifier_->RemoveNotifier(buffer_m0_.channel_id(), notifier_);
+		DataDispatcher<M0>::Instance()->RemoveBuffer(buffer_m0_);
+		DataDispatcher<M1>::Instance()->RemoveBuffer(buffer_m1_);
 	}
 
 	bool TryFetch(std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1) {  // NOLINT
@@ -178,6 +190,11 @@ public:
 		data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
 	}
 
+	~DataVisitor() {
+		data_notifier_->RemoveNotifier(buffer_.channel_id(), notifier_);
+		DataDispatcher<M0>::Instance()->RemoveBuffer(buffer_);
+	}
+
 	bool TryFetch(std::shared_ptr<M0>& m0) {  // NOLINT
 		if (buffer_.Fetch(&next_msg_index_, m0)) {
 			next_msg_index_++;
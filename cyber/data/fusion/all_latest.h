@@ -25,6 +25,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "cyber/base/magazine_pool.h"
 #include "cyber/common/types.h"
 #include "cyber/data/channel_buffer.h"
 #include "cyber/data/fusion/data_fusion.h"
@@ -62,7 +63,8 @@ class AllLatest : public DataFusion<M0, M1, M2, M3> {
             return;
           }
 
-          auto data = std::make_shared<FusionDataType>(m0, m1, m2, m3);
+          auto data = std::allocate_shared<FusionDataType>(
+              base::PoolAllocator<FusionDataType>(), m0, m1, m2, m3);
           std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
           buffer_fusion_.Buffer()->Fill(data);
         });
@@ -112,7 +114,8 @@ class AllLatest<M0, M1, M2, NullType> : public DataFusion<M0, M1, M2> {
             return;
           }
 
-          auto data = std::make_shared<FusionDataType>(m0, m1, m2);
+          auto data = std::allocate_shared<FusionDataType>(
+              base::PoolAllocator<FusionDataType>(), m0, m1, m2);
           std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
           buffer_fusion_.Buffer()->Fill(data);
         });
@@ -156,7 +159,8 @@ class AllLatest<M0, M1, NullType, NullType> : public DataFusion<M0, M1> {
             return;
           }
 
-          auto data = std::make_shared<FusionDataType>(m0, m1);
+          auto data = std::allocate_shared<FusionDataType>(
+              base::PoolAllocator<FusionDataType>(), m0, m1);
           std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
           buffer_fusion_.Buffer()->Fill(data);
         });
@@ -58,6 +58,29 @@ TEST(DataDispatcher, Dispatch) {
   EXPECT_TRUE(dispatcher->Dispatch(channel0, msg));
 }
 
+TEST(DataDispatcher, RemoveBuffer) {
+  auto channel2 = common::Hash("/channel2");
+  auto cache_buffer = new CacheBuffer<std::shared_ptr<int>>(10);
+  auto buffer = ChannelBuffer<int>(channel2, cache_buffer);
+  auto dispatcher = DataDispatcher<int>::Instance();
+  auto notifier = std::make_shared<Notifier>();
+  auto msg = std::make_shared<int>(1);
+
+  dispatcher->AddBuffer(buffer);
+  DataNotifier::Instance()->AddNotifier(channel2, notifier);
+  EXPECT_TRUE(dispatcher->Dispatch(channel2, msg));
+  EXPECT_EQ(1, cache_buffer->Size());
+
+  DataNotifier::Instance()->RemoveNotifier(channel2, notifier);
+  EXPECT_FALSE(DataNotifier::Instance()->Notify(channel2));
+  EXPECT_FALSE(dispatcher->Dispatch(channel2, msg));
+  EXPECT_EQ(2, cache_buffer->Size());
+
+  dispatcher->RemoveBuffer(buffer);
+  EXPECT_FALSE(dispatcher->Dispatch(channel2, msg));
+  EXPECT_EQ(2, cache_buffer->Size());
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
@@ -0,0 +1,497 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/event/latency_tracer.h"
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "cyber/binary.h"
+#include "cyber/common/file.h"
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+using common::GlobalData;
+
+namespace {
+
+const int kHopNum = static_cast<int>(LatencyHop::HOP_NUM);
+const char kHistogramName[] = "cyber_latency_seconds";
+const char kMaxName[] = "cyber_latency_max_seconds";
+
+std::string Escape(const std::string& value) {
+  std::string result;
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+      result.push_back(c);
+    } else if (c == '\n') {
+      result.append("\\n");
+    } else {
+      result.push_back(c);
+    }
+  }
+  return result;
+}
+
+std::string Seconds(uint64_t nanoseconds, const char* format) {
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), format,
+           static_cast<double>(nanoseconds) / 1e9);
+  return buffer;
+}
+
+// splits 'name{key="value",...} number', false for anything else
+bool ParseSample(const std::string& line, std::string* name,
+                 std::map<std::string, std::string>* labels,
+                 std::string* value) {
+  auto brace = line.find('{');
+  if (brace == std::string::npos) {
+    return false;
+  }
+  *name = line.substr(0, brace);
+  size_t pos = brace + 1;
+  while (pos < line.size() && line[pos] != '}') {
+    auto equal = line.find('=', pos);
+    if (equal == std::string::npos || equal + 1 >= line.size() ||
+        line[equal + 1] != '"') {
+      return false;
+    }
+    std::string key = line.substr(pos, equal - pos);
+    std::string label;
+    pos = equal + 2;
+    while (pos < line.size() && line[pos] != '"') {
+      if (line[pos] == '\\' && pos + 1 < line.size()) {
+        ++pos;
+        label.push_back(line[pos] == 'n' ? '\n' : line[pos]);
+      } else {
+        label.push_back(line[pos]);
+      }
+      ++pos;
+    }
+    if (pos >= line.size()) {
+      return false;
+    }
+    (*labels)[key] = label;
+    ++pos;
+    if (pos < line.size() && line[pos] == ',') {
+      ++pos;
+    }
+  }
+  if (pos + 2 > line.size()) {
+    return false;
+  }
+  *value = line.substr(pos + 2);
+  return true;
+}
+
+int HopIndex(const std::string& name) {
+  for (int i = 0; i < kHopNum; ++i) {
+    if (name == LatencyHopName(static_cast<LatencyHop>(i))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+}  // namespace
+
+const char* LatencyHopName(LatencyHop hop) {
+  switch (hop) {
+    case LatencyHop::SERIALIZE:
+      return "serialize";
+    case LatencyHop::SEND:
+      return "send";
+    case LatencyHop::TRANSPORT:
+      return "transport";
+    case LatencyHop::PARSE:
+      return "parse";
+    case LatencyHop::DISPATCH:
+      return "dispatch";
+    case LatencyHop::CALLBACK:
+      return "callback";
+    case LatencyHop::END_TO_END:
+      return "end_to_end";
+    default:
+      return "";
+  }
+}
+
+uint64_t LatencySnapshot::BucketBound(int index) {
+  return index < kBuckets - 1 ? 1000ULL << index : UINT64_MAX;
+}
+
+int LatencySnapshot::BucketIndex(uint64_t latency) {
+  if (latency <= 1000) {
+    return 0;
+  }
+  int index = 64 - __builtin_clzll((latency - 1) / 1000);
+  return std::min(index, kBuckets - 1);
+}
+
+uint64_t LatencySnapshot::Percentile(double percent) const {
+  if (count == 0) {
+    return 0;
+  }
+  auto target = static_cast<uint64_t>(
+      std::ceil(static_cast<double>(count) * percent / 100.0));
+  uint64_t seen = 0;
+  for (int i = 0; i < kBuckets; ++i) {
+    seen += buckets[i];
+    if (seen >= target) {
+      return std::min(BucketBound(i), max);
+    }
+  }
+  return max;
+}
+
+void LatencySnapshot::Merge(const LatencySnapshot& other) {
+  for (int i = 0; i < kBuckets; ++i) {
+    buckets[i] += other.buckets[i];
+  }
+  count += other.count;
+  sum += other.sum;
+  max = std::max(max, other.max);
+}
+
+LatencyHistogram::LatencyHistogram() {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Add(uint64_t latency) {
+  buckets_[LatencySnapshot::BucketIndex(latency)].fetch_add(
+      1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(latency, std::memory_order_relaxed);
+  uint64_t max = max_.load(std::memory_order_relaxed);
+  while (latency > max &&
+         !max_.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::Snapshot(LatencySnapshot* snapshot) const {
+  for (int i = 0; i < LatencySnapshot::kBuckets; ++i) {
+    snapshot->buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  snapshot->count = count_.load(std::memory_order_relaxed);
+  snapshot->sum = sum_.load(std::memory_order_relaxed);
+  snapshot->max = max_.load(std::memory_order_relaxed);
+}
+
+LatencyTracer::LatencyTracer() {
+  auto& global_conf = GlobalData::Instance()->Config();
+  if (global_conf.has_perf_conf() &&
+      global_conf.perf_conf().has_latency_conf()) {
+    conf_.CopyFrom(global_conf.perf_conf().latency_conf());
+    enable_ = conf_.enable();
+  }
+  if (!enable_) {
+    return;
+  }
+
+  std::string name = binary::GetName();
+  std::replace(name.begin(), name.end(), '/', '_');
+  export_file_ = conf_.export_dir() + "/" + name + "." +
+                 std::to_string(getpid()) + ".prom";
+  export_thread_ = std::thread(&LatencyTracer::Run, this);
+}
+
+LatencyTracer::~LatencyTracer() { Shutdown(); }
+
+void LatencyTracer::Shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(export_mutex_);
+    if (!enable_ || shutdown_) {
+      return;
+    }
+    shutdown_ = true;
+  }
+  export_cv_.notify_all();
+  if (export_thread_.joinable()) {
+    export_thread_.join();
+  }
+  // the file describes a running process
+  common::DeleteFile(export_file_);
+}
+
+LatencyTracer::ChannelLatency* LatencyTracer::GetChannel(uint64_t channel_id) {
+  ChannelLatency* channel = nullptr;
+  if (channel_map_.Get(channel_id, &channel)) {
+    return channel;
+  }
+  std::lock_guard<std::mutex> lock(channels_mutex_);
+  if (channel_map_.Get(channel_id, &channel)) {
+    return channel;
+  }
+  channels_.emplace_back(new ChannelLatency());
+  channel = channels_.back().get();
+  channel->channel_id = channel_id;
+  channel_map_.Set(channel_id, channel);
+  return channel;
+}
+
+void LatencyTracer::Record(uint64_t channel_id, LatencyHop hop, uint64_t begin,
+                           uint64_t end) {
+  if (!enable_ || begin == 0 || begin > end) {
+    return;
+  }
+  GetChannel(channel_id)->hops[static_cast<int>(hop)].Add(end - begin);
+}
+
+void LatencyTracer::OnDispatched(uint64_t channel_id, const void* message,
+                                 uint64_t send_time, uint64_t dispatch_time) {
+  if (!enable_ || send_time == 0) {
+    return;
+  }
+  ChannelLatency* channel = GetChannel(channel_id);
+  std::lock_guard<std::mutex> lock(channel->pending_mutex);
+  // a message address reused by the allocator replaces the old entry
+  PendingMessage* slot = nullptr;
+  for (auto& pending : channel->pending) {
+    if (pending.message == message) {
+      slot = &pending;
+      break;
+    }
+  }
+  if (slot == nullptr) {
+    slot = &channel->pending[channel->next_pending];
+    channel->next_pending =
+        (channel->next_pending + 1) % ChannelLatency::kPendingNum;
+  }
+  slot->message = message;
+  slot->send_time = send_time;
+  slot->dispatch_time = dispatch_time;
+}
+
+void LatencyTracer::OnCallback(uint64_t channel_id, const void* message) {
+  if (!enable_) {
+    return;
+  }
+  uint64_t now = Now();
+  PendingMessage found;
+  ChannelLatency* channel = GetChannel(channel_id);
+  {
+    std::lock_guard<std::mutex> lock(channel->pending_mutex);
+    for (const auto& pending : channel->pending) {
+      if (pending.message == message) {
+        found = pending;
+        break;
+      }
+    }
+  }
+  // every reader of the channel sees the same message, nothing is removed
+  Record(channel_id, LatencyHop::CALLBACK, found.dispatch_time, now);
+  Record(channel_id, LatencyHop::END_TO_END, found.send_time, now);
+}
+
+bool LatencyTracer::GetSnapshot(uint64_t channel_id, LatencyHop hop,
+                                LatencySnapshot* snapshot) {
+  ChannelLatency* channel = nullptr;
+  if (!channel_map_.Get(channel_id, &channel)) {
+    return false;
+  }
+  channel->hops[static_cast<int>(hop)].Snapshot(snapshot);
+  return true;
+}
+
+std::string LatencyTracer::ExportText() {
+  struct Series {
+    std::string labels;
+    LatencySnapshot snapshot;
+  };
+  std::vector<Series> series;
+  std::string process = Escape(binary::GetName());
+  {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+    for (const auto& channel : channels_) {
+      std::string channel_name = GlobalData::GetChannelById(channel->channel_id);
+      if (channel_name.empty()) {
+        channel_name = std::to_string(channel->channel_id);
+      }
+      for (int i = 0; i < kHopNum; ++i) {
+        Series item;
+        channel->hops[i].Snapshot(&item.snapshot);
+        if (item.snapshot.count == 0) {
+          continue;
+        }
+        item.labels = "process=\"" + process + "\",channel=\"" +
+                      Escape(channel_name) + "\",hop=\"" +
+                      LatencyHopName(static_cast<LatencyHop>(i)) + "\"";
+        series.push_back(std::move(item));
+      }
+    }
+  }
+
+  std::ostringstream out;
+  out << "# HELP " << kHistogramName
+      << " Latency of traced messages per channel and hop.\n"
+      << "# TYPE " << kHistogramName << " histogram\n";
+  for (const auto& item : series) {
+    uint64_t cumulative = 0;
+    for (int i = 0; i < LatencySnapshot::kBuckets; ++i) {
+      cumulative += item.snapshot.buckets[i];
+      out << kHistogramName << "_bucket{" << item.labels << ",le=\""
+          << (i == LatencySnapshot::kBuckets - 1
+                  ? "+Inf"
+                  : Seconds(LatencySnapshot::BucketBound(i), "%.6f"))
+          << "\"} " << cumulative << "\n";
+    }
+    out << kHistogramName << "_sum{" << item.labels << "} "
+        << Seconds(item.snapshot.sum, "%.9f") << "\n"
+        << kHistogramName << "_count{" << item.labels << "} "
+        << item.snapshot.count << "\n";
+  }
+  out << "# HELP " << kMaxName
+      << " Largest latency of traced messages per channel and hop.\n"
+      << "# TYPE " << kMaxName << " gauge\n";
+  for (const auto& item : series) {
+    out << kMaxName << "{" << item.labels << "} "
+        << Seconds(item.snapshot.max, "%.9f") << "\n";
+  }
+  return out.str();
+}
+
+bool LatencyTracer::Export() {
+  if (!enable_) {
+    return false;
+  }
+  if (!common::EnsureDirectory(conf_.export_dir())) {
+    AERROR << "create latency export dir " << conf_.export_dir() << " failed.";
+    return false;
+  }
+  // readers never see a half written file
+  std::string tmp_file = export_file_ + ".tmp";
+  {
+    std::ofstream out(tmp_file, std::ios::trunc);
+    if (!out) {
+      AERROR << "open " << tmp_file << " failed.";
+      return false;
+    }
+    out << ExportText();
+  }
+  if (rename(tmp_file.c_str(), export_file_.c_str()) != 0) {
+    AERROR << "rename " << tmp_file << " failed, errno: " << errno;
+    return false;
+  }
+  return true;
+}
+
+void LatencyTracer::Run() {
+  std::unique_lock<std::mutex> lock(export_mutex_);
+  while (!shutdown_) {
+    export_cv_.wait_for(lock,
+                        std::chrono::milliseconds(conf_.export_interval_ms()),
+                        [this]() { return shutdown_; });
+    if (shutdown_) {
+      break;
+    }
+    lock.unlock();
+    Export();
+    lock.lock();
+  }
+}
+
+bool ParseLatencyText(const std::string& text, LatencyReport* report) {
+  // buckets are cumulative until all lines are read
+  LatencyReport parsed;
+  std::istringstream in(text);
+  std::string line;
+  std::string name;
+  std::string value;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::map<std::string, std::string> labels;
+    if (!ParseSample(line, &name, &labels, &value)) {
+      AWARN << "unknown latency sample: " << line;
+      return false;
+    }
+    int hop = HopIndex(labels["hop"]);
+    if (hop < 0) {
+      continue;
+    }
+    LatencySnapshot& snapshot = parsed[labels["channel"]].hops[hop];
+    if (name == std::string(kHistogramName) + "_bucket") {
+      int index = LatencySnapshot::kBuckets - 1;
+      if (labels["le"] != "+Inf") {
+        index = LatencySnapshot::BucketIndex(
+            std::llround(std::strtod(labels["le"].c_str(), nullptr) * 1e9));
+      }
+      snapshot.buckets[index] = std::strtoull(value.c_str(), nullptr, 10);
+    } else if (name == std::string(kHistogramName) + "_sum") {
+      snapshot.sum = std::llround(std::strtod(value.c_str(), nullptr) * 1e9);
+    } else if (name == std::string(kHistogramName) + "_count") {
+      snapshot.count = std::strtoull(value.c_str(), nullptr, 10);
+    } else if (name == kMaxName) {
+      snapshot.max = std::llround(std::strtod(value.c_str(), nullptr) * 1e9);
+    }
+  }
+
+  for (auto& channel : parsed) {
+    for (int hop = 0; hop < kHopNum; ++hop) {
+      LatencySnapshot& snapshot = channel.second.hops[hop];
+      for (int i = LatencySnapshot::kBuckets - 1; i > 0; --i) {
+        snapshot.buckets[i] -= std::min(snapshot.buckets[i - 1],
+                                        snapshot.buckets[i]);
+      }
+      (*report)[channel.first].hops[hop].Merge(snapshot);
+    }
+  }
+  return true;
+}
+
+bool LoadLatencyExports(const std::string& dir, LatencyReport* report) {
+  if (!common::PathExists(dir)) {
+    return false;
+  }
+  for (const auto& file : common::Glob(dir + "/*.prom")) {
+    // <process>.<pid>.prom, skip the files of dead processes
+    std::string stem = file.substr(0, file.size() - 5);
+    auto dot = stem.rfind('.');
+    if (dot == std::string::npos) {
+      continue;
+    }
+    int pid = std::atoi(stem.c_str() + dot + 1);
+    if (pid <= 0 || (kill(pid, 0) != 0 && errno == ESRCH)) {
+      continue;
+    }
+    std::string text;
+    if (common::GetContent(file, &text)) {
+      ParseLatencyText(text, report);
+    }
+  }
+  return true;
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_EVENT_LATENCY_TRACER_H_
+#define CYBER_EVENT_LATENCY_TRACER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/proto/perf_conf.pb.h"
+
+#include "cyber/base/atomic_hash_map.h"
+#include "cyber/common/macros.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+// Stages a traced message goes through, each measured from the end of the
+// previous one.
+enum class LatencyHop {
+  // writer: Write() called -> serialized into the shm block or rtps buffer
+  SERIALIZE = 0,
+  // writer: serialized -> readers notified
+  SEND = 1,
+  // serialized -> read by the dispatcher of the reading process
+  TRANSPORT = 2,
+  // read -> deserialized
+  PARSE = 3,
+  // time spent in DataDispatcher filling the channel buffers
+  DISPATCH = 4,
+  // buffers filled -> reader callback starts
+  CALLBACK = 5,
+  // Write() called -> reader callback starts
+  END_TO_END = 6,
+  HOP_NUM = 7,
+};
+
+const char* LatencyHopName(LatencyHop hop);
+
+struct LatencySnapshot {
+  // bucket i counts latencies up to 2^i us, the last one everything above
+  static const int kBuckets = 22;
+  static uint64_t BucketBound(int index);
+  static int BucketIndex(uint64_t latency);
+
+  // upper bound of the bucket holding the |percent| percentile, in ns
+  uint64_t Percentile(double percent) const;
+  void Merge(const LatencySnapshot& other);
+
+  uint64_t buckets[kBuckets] = {0};
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  uint64_t max = 0;
+};
+
+class LatencyHistogram {
+ public:
+  LatencyHistogram();
+  void Add(uint64_t latency);
+  void Snapshot(LatencySnapshot* snapshot) const;
+
+ private:
+  std::atomic<uint64_t> buckets_[LatencySnapshot::kBuckets];
+  std::atomic<uint64_t> count_ = {0};
+  std::atomic<uint64_t> sum_ = {0};
+  std::atomic<uint64_t> max_ = {0};
+};
+
+/**
+ * @brief Per channel latency histograms of traced messages. With
+ * perf_conf.latency_conf.enable, writers stamp MessageInfo and every hop
+ * adds to the histogram of its channel. The histograms are written as a
+ * Prometheus text file to latency_conf.export_dir, one file per process.
+ */
+class LatencyTracer {
+ public:
+  ~LatencyTracer();
+
+  bool enabled() const { return enable_; }
+
+  static uint64_t Now() { return Time::Now().ToNanosecond(); }
+
+  // adds end - begin, nothing when begin is 0 or after end
+  void Record(uint64_t channel_id, LatencyHop hop, uint64_t begin,
+              uint64_t end);
+
+  // remembers when |message| went through DataDispatcher for OnCallback,
+  // called on entering and again on leaving it
+  void OnDispatched(uint64_t channel_id, const void* message,
+                    uint64_t send_time, uint64_t dispatch_time);
+  // records CALLBACK and END_TO_END if |message| was dispatched recently
+  void OnCallback(uint64_t channel_id, const void* message);
+
+  bool GetSnapshot(uint64_t channel_id, LatencyHop hop,
+                   LatencySnapshot* snapshot);
+
+  std::string ExportText();
+  bool Export();
+  const std::string& ExportFile() const { return export_file_; }
+
+  void Shutdown();
+
+ private:
+  struct PendingMessage {
+    const void* message = nullptr;
+    uint64_t send_time = 0;
+    uint64_t dispatch_time = 0;
+  };
+
+  struct ChannelLatency {
+    static const int kPendingNum = 64;
+    uint64_t channel_id = 0;
+    LatencyHistogram hops[static_cast<int>(LatencyHop::HOP_NUM)];
+    std::mutex pending_mutex;
+    PendingMessage pending[kPendingNum];
+    int next_pending = 0;
+  };
+
+  ChannelLatency* GetChannel(uint64_t channel_id);
+  void Run();
+
+  bool enable_ = false;
+  proto::LatencyConf conf_;
+  std::string export_file_;
+
+  base::AtomicHashMap<uint64_t, ChannelLatency*> channel_map_;
+  std::mutex channels_mutex_;
+  std::vector<std::unique_ptr<ChannelLatency>> channels_;
+
+  std::thread export_thread_;
+  std::mutex export_mutex_;
+  std::condition_variable export_cv_;
+  bool shutdown_ = false;
+
+  DECLARE_SINGLETON(LatencyTracer)
+};
+
+struct ChannelLatencyReport {
+  LatencySnapshot hops[static_cast<int>(LatencyHop::HOP_NUM)];
+};
+
+// channel name -> histograms merged over processes
+using LatencyReport = std::map<std::string, ChannelLatencyReport>;
+
+// merges the histograms of a text written by LatencyTracer into |report|
+bool ParseLatencyText(const std::string& text, LatencyReport* report);
+
+// merges the export files of the running processes in |dir|
+bool LoadLatencyExports(const std::string& dir, LatencyReport* report);
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_LATENCY_TRACER_H_
@@ -16,11 +16,18 @@
 
 #include "cyber/event/perf_event_cache.h"
 
+#include <semaphore.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <csignal>
+#include <ctime>
 #include <string>
 
+#include "cyber/base/macros.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
-#include "cyber/state.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
@@ -31,6 +38,29 @@ using common::GlobalData;
 using proto::PerfConf;
 using proto::PerfType;
 
+namespace {
+
+// wakes the io thread, posted from the dump signal handler and Shutdown
+sem_t wake_sem;
+std::atomic<bool> dump_requested = {false};
+
+void OnDumpSignal(int sig) {
+	(void)sig;
+	dump_requested.store(true);
+	sem_post(&wake_sem);
+}
+
+uint64_t MonoNow() { return Time::MonoTime().ToNanosecond(); }
+
+std::string PerfFileName(const std::string& prefix) {
+	std::string perf_file = prefix + Time::Now().ToString() + ".data";
+	std::replace(perf_file.begin(), perf_file.end(), ' ', '_');
+	std::replace(perf_file.begin(), perf_file.end(), ':', '-');
+	return perf_file;
+}
+
+}  // namespace
+
 PerfEventCache::PerfEventCache() {
 	auto& global_conf = GlobalData::Instance()->Config();
 	if (global_conf.has_perf_conf()) {
@@ -39,10 +69,8 @@ PerfEventCache::PerfEventCache() {
 	}
 
 	if (enable_) {
-		if (!event_queue_.Init(kEventQueueSize)) {
-			AERROR << "Event queue init failed.";
-			throw std::runtime_error("Event queue init failed.");
-		}
+		sched_enable_ = perf_conf_.type() == PerfType::SCHED || perf_conf_.type() == PerfType::ALL;
+		transport_enable_ = perf_conf_.type() == PerfType::TRANSPORT || perf_conf_.type() == PerfType::ALL;
 		Start();
 	}
 }
@@ -50,91 +78,226 @@ PerfEventCache::PerfEventCache() {
 PerfEventCache::~PerfEventCache() { Shutdown(); }
 
 void PerfEventCache::Shutdown() {
-	if (!enable_) {
+	if (!enable_ || shutdown_.exchange(true)) {
 		return;
 	}
 
-	shutdown_ = true;
-	event_queue_.BreakAllWait();
+	if (perf_conf_.flight_recorder()) {
+		std::signal(perf_conf_.dump_signal(), SIG_DFL);
+	}
+	sem_post(&wake_sem);
 	if (io_thread_.joinable()) {
 		io_thread_.join();
 	}
-
-	of_ << cyber::Time::Now().ToNanosecond() << std::endl;
-	of_.flush();
-	of_.close();
 }
 
 void PerfEventCache::AddSchedEvent(const SchedPerf event_id, const uint64_t cr_id, const int proc_id,
 											const int cr_state) 
 {
-	if (!enable_) {
+	if (!sched_enable_) {
 		return;
 	}
 
-	if (perf_conf_.type() != PerfType::SCHED &&
-		perf_conf_.type() != PerfType::ALL) {
+	PerfRecord record;
+	record.stamp = MonoNow();
+	record.id = cr_id;
+	record.cr_state = cr_state;
+	record.proc_id = static_cast<int16_t>(proc_id);
+	record.etype = static_cast<uint8_t>(EventType::SCHED_EVENT);
+	record.eid = static_cast<uint8_t>(event_id);
+	Record(&record);
+}
+
+void PerfEventCache::AddTransportEvent(const TransPerf event_id, const uint64_t channel_id, const uint64_t msg_seq,
+												const uint64_t stamp) 
+{
+	if (!transport_enable_) {
 		return;
 	}
 
-	EventBasePtr e = std::make_shared<SchedEvent>();
-	e->set_eid(static_cast<int>(event_id));
-	e->set_stamp(Time::Now().ToNanosecond());
-	e->set_cr_state(cr_state);
-	e->set_cr_id(cr_id);
-	e->set_proc_id(proc_id);
+	PerfRecord record;
+	record.stamp = stamp == 0 ? MonoNow() : stamp - real_base_ + mono_base_;
+	record.id = channel_id;
+	record.seq = msg_seq;
+	record.etype = static_cast<uint8_t>(EventType::TRANS_EVENT);
+	record.eid = static_cast<uint8_t>(event_id);
+	Record(&record);
+}
 
-	event_queue_.Enqueue(e);
+void PerfEventCache::Record(PerfRecord* record) {
+	ThreadRing* thread_ring = GetThreadRing();
+	record->tid = thread_ring->tid;
+	thread_ring->ring.Push(*record);
 }
 
-void PerfEventCache::AddTransportEvent(const TransPerf event_id, const uint64_t channel_id, const uint64_t msg_seq,
-												const uint64_t stamp, const std::string& adder) 
+PerfEventCache::ThreadRing* PerfEventCache::GetThreadRing() {
+	struct Holder {
+		~Holder() {
+			if (thread_ring != nullptr) {
+				thread_ring->closed.store(true, std::memory_order_release);
+			}
+		}
+		ThreadRingPtr thread_ring;
+	};
+	static thread_local Holder holder;
+	if (cyber_unlikely(holder.thread_ring == nullptr)) {
+		holder.thread_ring = std::make_shared<ThreadRing>(perf_conf_.ring_size());
+		holder.thread_ring->tid = static_cast<int32_t>(syscall(SYS_gettid));
+		std::lock_guard<std::mutex> lock(rings_mutex_);
+		rings_.push_back(holder.thread_ring);
+	}
+	return holder.thread_ring.get();
+}
+
+std::vector<PerfEventCache::ThreadRingPtr> PerfEventCache::Rings() {
+	std::lock_guard<std::mutex> lock(rings_mutex_);
+	return rings_;
+}
+
+void PerfEventCache::WriteRecord(const PerfRecord& record, PerfFileWriter* writer,
+										IdSet* tasks, IdSet* channels)
 {
-	if (!enable_) {
-		return;
+	// names are looked up once per file, the first time an id shows up
+	if (record.etype == static_cast<uint8_t>(EventType::SCHED_EVENT)) {
+		if (tasks->insert(record.id).second) {
+			writer->WriteName(PERF_NAME_TASK, record.id, GlobalData::GetTaskNameById(record.id));
+		}
+	} else if (channels->insert(record.id).second) {
+		writer->WriteName(PERF_NAME_CHANNEL, record.id, GlobalData::GetChannelById(record.id));
 	}
+	writer->WriteEvent(record);
+}
 
-	if (perf_conf_.type() != PerfType::TRANSPORT && perf_conf_.type() != PerfType::ALL) {
-		return;
+void PerfEventCache::Drain() {
+	PerfRecord record;
+	for (auto& thread_ring : Rings()) {
+		const PerfEventRing& ring = thread_ring->ring;
+		uint64_t head = ring.Head();
+		uint64_t lost = 0;
+		// lapped by the writer since the last drain
+		if (head - thread_ring->read > ring.Capacity()) {
+			lost += head - ring.Capacity() - thread_ring->read;
+			thread_ring->read = head - ring.Capacity();
+		}
+		for (; thread_ring->read < head; ++thread_ring->read) {
+			if (ring.Read(thread_ring->read, &record)) {
+				WriteRecord(record, &writer_, &named_tasks_, &named_channels_);
+			} else {
+				++lost;
+			}
+		}
+		if (lost > 0) {
+			writer_.WriteLost(lost);
+			lost_.fetch_add(lost);
+		}
+	}
+	writer_.Flush();
+
+	std::lock_guard<std::mutex> lock(rings_mutex_);
+	rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+								[](const ThreadRingPtr& thread_ring) {
+									return thread_ring->closed.load(std::memory_order_acquire) &&
+											thread_ring->read == thread_ring->ring.Head();
+								}),
+				rings_.end());
+}
+
+void PerfEventCache::PruneClosed(uint64_t now) {
+	// a closed ring stays as long as it holds events a dump would write
+	uint64_t window = static_cast<uint64_t>(perf_conf_.flight_recorder_seconds()) * 1000000000UL;
+	std::lock_guard<std::mutex> lock(rings_mutex_);
+	rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+								[now, window](const ThreadRingPtr& thread_ring) {
+									if (!thread_ring->closed.load(std::memory_order_acquire)) {
+										return false;
+									}
+									PerfRecord last;
+									uint64_t head = thread_ring->ring.Head();
+									return head == 0 || !thread_ring->ring.Read(head - 1, &last) ||
+											last.stamp + window < now;
+								}),
+				rings_.end());
+}
+
+std::string PerfEventCache::Dump() {
+	if (!enable_) {
+		return "";
 	}
 
-	EventBasePtr e = std::make_shared<TransportEvent>();
-	e->set_eid(static_cast<int>(event_id));
-	e->set_channel_id(channel_id);
-	e->set_msg_seq(msg_seq);
-	e->set_adder(adder);
-	auto t = stamp;
-	if (stamp == 0) {
-		t = Time::Now().ToNanosecond();
+	std::lock_guard<std::mutex> lock(dump_mutex_);
+	uint64_t now = MonoNow();
+	uint64_t window = static_cast<uint64_t>(perf_conf_.flight_recorder_seconds()) * 1000000000UL;
+	uint64_t begin = now > window ? now - window : 0;
+	std::vector<PerfRecord> records;
+	PerfRecord record;
+	for (auto& thread_ring : Rings()) {
+		const PerfEventRing& ring = thread_ring->ring;
+		uint64_t head = ring.Head();
+		uint64_t index = head > ring.Capacity() ? head - ring.Capacity() : 0;
+		for (; index < head; ++index) {
+			if (ring.Read(index, &record) && record.stamp >= begin) {
+				records.push_back(record);
+			}
+		}
 	}
-	e->set_stamp(t);
 
-	event_queue_.Enqueue(e);
+	std::string dump_file = PerfFileName("cyber_perf_dump_");
+	PerfFileWriter writer;
+	if (!writer.Open(dump_file, mono_base_, real_base_)) {
+		return "";
+	}
+	IdSet tasks;
+	IdSet channels;
+	for (const auto& r : records) {
+		WriteRecord(r, &writer, &tasks, &channels);
+	}
+	writer.Close();
+	AINFO << "dump " << records.size() << " perf events to " << dump_file;
+	return dump_file;
 }
 
 void PerfEventCache::Run() {
-	EventBasePtr event;
-	int buf_size = 0;
-	while (!shutdown_ && !apollo::cyber::IsShutdown()) {
-		if (event_queue_.WaitDequeue(&event)) {
-			of_ << event->SerializeToString() << std::endl;
-			buf_size++;
-			if (buf_size >= kFlushSize) {
-				of_.flush();
-				buf_size = 0;
-			}
+	const bool streaming = !perf_conf_.flight_recorder();
+	const uint32_t interval_ms = streaming ? kDrainIntervalMs : kPruneIntervalMs;
+	while (!shutdown_.load()) {
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += static_cast<long>(interval_ms) * 1000000L;
+		deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+		deadline.tv_nsec %= 1000000000L;
+		sem_timedwait(&wake_sem, &deadline);
+
+		if (dump_requested.exchange(false)) {
+			Dump();
+		}
+		if (streaming) {
+			Drain();
+		} else {
+			PruneClosed(MonoNow());
 		}
 	}
+
+	if (streaming) {
+		Drain();
+		writer_.Close();
+	}
 }
 
 void PerfEventCache::Start() {
-	auto now = Time::Now();
-	std::string perf_file = "cyber_perf_" + now.ToString() + ".data";
-	std::replace(perf_file.begin(), perf_file.end(), ' ', '_');
-	std::replace(perf_file.begin(), perf_file.end(), ':', '-');
-	of_.open(perf_file, std::ios::trunc);
-	perf_file_ = perf_file;
-	of_ << Time::Now().ToNanosecond() << std::endl;
+	real_base_ = Time::Now().ToNanosecond();
+	mono_base_ = MonoNow();
+	sem_init(&wake_sem, 0, 0);
+
+	if (!perf_conf_.flight_recorder()) {
+		perf_file_ = PerfFileName("cyber_perf_");
+		if (!writer_.Open(perf_file_, mono_base_, real_base_)) {
+			AERROR << "Perf file open failed, perf events are only kept in memory.";
+			perf_conf_.set_flight_recorder(true);
+		}
+	}
+	if (perf_conf_.flight_recorder()) {
+		std::signal(perf_conf_.dump_signal(), OnDumpSignal);
+	}
 	io_thread_ = std::thread(&PerfEventCache::Run, this);
 }
 
@@ -17,53 +17,100 @@
 #ifndef CYBER_EVENT_PERF_EVENT_CACHE_H_
 #define CYBER_EVENT_PERF_EVENT_CACHE_H_
 
-#include <chrono>
-#include <fstream>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "cyber/proto/perf_conf.pb.h"
 
-#include "cyber/base/bounded_queue.h"
 #include "cyber/common/macros.h"
 #include "cyber/event/perf_event.h"
+#include "cyber/event/perf_event_file.h"
+#include "cyber/event/perf_event_ring.h"
 
 namespace apollo {
 namespace cyber {
 namespace event {
 
+/**
+ * @brief Records perf events into a lock-free ring per thread. By default a
+ * thread drains the rings into cyber_perf_<time>.data every few
+ * milliseconds; in flight recorder mode the rings are only read when the
+ * dump signal arrives or Dump() is called, and the events of the last
+ * seconds are written to cyber_perf_dump_<time>.data. Convert either file
+ * with cyber_perf_trace.
+ */
 class PerfEventCache {
 public:
-	using EventBasePtr = std::shared_ptr<EventBase>;
-
 	~PerfEventCache();
 	void AddSchedEvent(const SchedPerf event_id, const uint64_t cr_id,
 	const int proc_id, const int cr_state = -1);
+	// |stamp| is a Time::Now() nanosecond stamp, 0 for the current time
 	void AddTransportEvent(const TransPerf event_id, const uint64_t channel_id,
-	const uint64_t msg_seq, const uint64_t stamp = 0,
-	const std::string& adder = "-");
+	const uint64_t msg_seq, const uint64_t stamp = 0);
 
 	std::string PerfFile() { return perf_file_; }
 
+	// writes the recent events of every ring to a new file and returns its
+	// name, empty when perf is disabled or the file can not be opened
+	std::string Dump();
+
+	// number of events overwritten before they were written out
+	uint64_t GetLostNumber() const { return lost_.load(); }
+
 	void Shutdown();
 
 private:
+	struct ThreadRing {
+		explicit ThreadRing(uint32_t capacity) : ring(capacity) {}
+		PerfEventRing ring;
+		int32_t tid = 0;
+		// next index to stream out, only used by the io thread
+		uint64_t read = 0;
+		// set when the thread exits, the ring goes once drained
+		std::atomic<bool> closed = {false};
+	};
+	using ThreadRingPtr = std::shared_ptr<ThreadRing>;
+	using IdSet = std::unordered_set<uint64_t>;
+
 	void Start();
 	void Run();
+	void Record(PerfRecord* record);
+	ThreadRing* GetThreadRing();
+	std::vector<ThreadRingPtr> Rings();
+	void Drain();
+	void PruneClosed(uint64_t now);
+	void WriteRecord(const PerfRecord& record, PerfFileWriter* writer,
+	IdSet* tasks, IdSet* channels);
 
 	std::thread io_thread_;
-	std::ofstream of_;
 
 	bool enable_ = false;
-	bool shutdown_ = false;
+	bool sched_enable_ = false;
+	bool transport_enable_ = false;
+	std::atomic<bool> shutdown_ = {false};
 
 	proto::PerfConf perf_conf_;
 	std::string perf_file_ = "";
-	base::BoundedQueue<EventBasePtr> event_queue_;
+	PerfFileWriter writer_;
+	IdSet named_tasks_;
+	IdSet named_channels_;
+	std::atomic<uint64_t> lost_ = {0};
+
+	// realtime and monotonic stamp of the same instant
+	uint64_t real_base_ = 0;
+	uint64_t mono_base_ = 0;
+
+	std::mutex rings_mutex_;
+	std::vector<ThreadRingPtr> rings_;
+	std::mutex dump_mutex_;
 
-	const int kFlushSize = 512;
-	const uint64_t kEventQueueSize = 8192;
+	const uint32_t kDrainIntervalMs = 20;
+	const uint32_t kPruneIntervalMs = 1000;
 
 	DECLARE_SINGLETON(PerfEventCache)
 };
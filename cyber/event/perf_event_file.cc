@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/event/perf_event_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <utility>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+namespace {
+
+const int kSchedPid = 1;
+const int kTransportPid = 2;
+
+template <typename T>
+void WriteValue(FILE* file, const T& value) {
+  fwrite(&value, sizeof(value), 1, file);
+}
+
+template <typename T>
+bool ReadValue(std::istream* in, T* value) {
+  return static_cast<bool>(in->read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+std::string Escape(const std::string& value) {
+  std::string result;
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+      result.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buffer[8];
+      snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+      result.append(buffer);
+    } else {
+      result.push_back(c);
+    }
+  }
+  return result;
+}
+
+std::string NameOf(const std::unordered_map<uint64_t, std::string>& names,
+                   uint64_t id) {
+  auto search = names.find(id);
+  return search == names.end() ? std::to_string(id) : search->second;
+}
+
+class TraceWriter {
+ public:
+  TraceWriter(std::ostream* out, uint64_t begin) : out_(out), begin_(begin) {
+    *out_ << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  }
+
+  // starts an event, the caller adds fields and calls End()
+  std::ostream& Begin(const char* phase, const std::string& name, int pid,
+                      int64_t tid, uint64_t stamp) {
+    *out_ << (first_ ? "\n" : ",\n") << "{\"ph\":\"" << phase
+          << "\",\"name\":\"" << Escape(name) << "\",\"pid\":" << pid
+          << ",\"tid\":" << tid << ",\"ts\":"
+          << static_cast<double>(stamp - begin_) / 1000.0;
+    first_ = false;
+    return *out_;
+  }
+
+  void End() { *out_ << "}"; }
+
+  void Metadata(const char* name, int pid, int64_t tid,
+                const std::string& value) {
+    *out_ << (first_ ? "\n" : ",\n") << "{\"ph\":\"M\",\"name\":\"" << name
+          << "\",\"pid\":" << pid << ",\"tid\":" << tid
+          << ",\"args\":{\"name\":\"" << Escape(value) << "\"}}";
+    first_ = false;
+  }
+
+  void Finish(const PerfFileContent& content) {
+    *out_ << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"begin_ns\":"
+          << content.real_base - content.mono_base + begin_
+          << ",\"lost_events\":" << content.lost << "}}" << std::endl;
+  }
+
+ private:
+  std::ostream* out_;
+  uint64_t begin_;
+  bool first_ = true;
+};
+
+void WriteSchedEvents(const PerfFileContent& content,
+                      const std::vector<const PerfRecord*>& events,
+                      TraceWriter* writer) {
+  writer->Metadata("process_name", kSchedPid, 0, "sched");
+  // processor thread -> the croutine swapped in on it
+  std::map<int32_t, const PerfRecord*> running;
+  for (auto event : events) {
+    if (running.find(event->tid) == running.end()) {
+      running[event->tid] = nullptr;
+      writer->Metadata("thread_name", kSchedPid, event->tid,
+                       event->proc_id < 0
+                           ? "thread " + std::to_string(event->tid)
+                           : "processor " + std::to_string(event->proc_id));
+    }
+    auto type = static_cast<SchedPerf>(event->eid);
+    const PerfRecord*& swap_in = running[event->tid];
+    if (type == SchedPerf::SWAP_IN) {
+      swap_in = event;
+      continue;
+    }
+    if (type == SchedPerf::SWAP_OUT) {
+      if (swap_in != nullptr && swap_in->id == event->id) {
+        writer->Begin("X", NameOf(content.task_names, event->id), kSchedPid,
+                      event->tid, swap_in->stamp)
+            << ",\"dur\":"
+            << static_cast<double>(event->stamp - swap_in->stamp) / 1000.0
+            << ",\"args\":{\"cr_id\":" << event->id
+            << ",\"state_out\":" << event->cr_state << "}";
+        writer->End();
+      }
+      swap_in = nullptr;
+      continue;
+    }
+    writer->Begin("i", ShowSchedPerf(type), kSchedPid, event->tid,
+                  event->stamp)
+        << ",\"s\":\"t\",\"args\":{\"task\":\""
+        << Escape(NameOf(content.task_names, event->id)) << "\"}";
+    writer->End();
+  }
+}
+
+void WriteTransportEvents(const PerfFileContent& content,
+                          const std::vector<const PerfRecord*>& events,
+                          TraceWriter* writer) {
+  writer->Metadata("process_name", kTransportPid, 0, "transport");
+  // all stages of a message, in time order
+  std::map<std::pair<uint64_t, uint64_t>, std::vector<const PerfRecord*>>
+      messages;
+  for (auto event : events) {
+    messages[{event->id, event->seq}].push_back(event);
+  }
+  uint64_t async_id = 0;
+  for (const auto& message : messages) {
+    const auto& stages = message.second;
+    std::string channel = NameOf(content.channel_names, message.first.first);
+    ++async_id;
+    writer->Begin("b", channel, kTransportPid, stages.front()->tid,
+                  stages.front()->stamp)
+        << ",\"cat\":\"transport\",\"id\":" << async_id
+        << ",\"args\":{\"seq\":" << message.first.second << "}";
+    writer->End();
+    for (auto stage : stages) {
+      writer->Begin("n", channel, kTransportPid, stage->tid, stage->stamp)
+          << ",\"cat\":\"transport\",\"id\":" << async_id
+          << ",\"args\":{\"stage\":\""
+          << ShowTransPerf(static_cast<TransPerf>(stage->eid)) << "\"}";
+      writer->End();
+    }
+    writer->Begin("e", channel, kTransportPid, stages.back()->tid,
+                  stages.back()->stamp)
+        << ",\"cat\":\"transport\",\"id\":" << async_id;
+    writer->End();
+  }
+}
+
+}  // namespace
+
+PerfFileWriter::~PerfFileWriter() { Close(); }
+
+bool PerfFileWriter::Open(const std::string& path, uint64_t mono_base,
+                          uint64_t real_base) {
+  Close();
+  file_ = fopen(path.c_str(), "wb");
+  if (file_ == nullptr) {
+    AERROR << "open perf file " << path << " failed.";
+    return false;
+  }
+  fwrite(kPerfFileMagic, 1, sizeof(kPerfFileMagic) - 1, file_);
+  WriteValue(file_, kPerfFileVersion);
+  WriteValue(file_, static_cast<uint32_t>(sizeof(PerfRecord)));
+  WriteValue(file_, mono_base);
+  WriteValue(file_, real_base);
+  return true;
+}
+
+void PerfFileWriter::WriteEvent(const PerfRecord& record) {
+  WriteValue(file_, static_cast<uint8_t>(PERF_RECORD_EVENT));
+  WriteValue(file_, record);
+}
+
+void PerfFileWriter::WriteName(PerfNameKind kind, uint64_t id,
+                               const std::string& name) {
+  WriteValue(file_, static_cast<uint8_t>(PERF_RECORD_NAME));
+  WriteValue(file_, static_cast<uint8_t>(kind));
+  WriteValue(file_, id);
+  WriteValue(file_, static_cast<uint32_t>(name.size()));
+  fwrite(name.data(), 1, name.size(), file_);
+}
+
+void PerfFileWriter::WriteLost(uint64_t count) {
+  WriteValue(file_, static_cast<uint8_t>(PERF_RECORD_LOST));
+  WriteValue(file_, count);
+}
+
+void PerfFileWriter::Flush() {
+  if (file_ != nullptr) {
+    fflush(file_);
+  }
+}
+
+void PerfFileWriter::Close() {
+  if (file_ != nullptr) {
+    fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+bool ReadPerfFile(const std::string& path, PerfFileContent* content) {
+  std::ifstream in(path, std::ios::binary);
+  char magic[sizeof(kPerfFileMagic) - 1];
+  uint32_t version = 0;
+  uint32_t record_size = 0;
+  if (!in.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kPerfFileMagic, sizeof(magic)) != 0 ||
+      !ReadValue(&in, &version) || version != kPerfFileVersion ||
+      !ReadValue(&in, &record_size) || record_size != sizeof(PerfRecord) ||
+      !ReadValue(&in, &content->mono_base) ||
+      !ReadValue(&in, &content->real_base)) {
+    AERROR << path << " is not a perf file of version " << kPerfFileVersion;
+    return false;
+  }
+  uint8_t type = 0;
+  while (ReadValue(&in, &type)) {
+    if (type == PERF_RECORD_EVENT) {
+      PerfRecord record;
+      if (!ReadValue(&in, &record)) {
+        break;
+      }
+      content->events.push_back(record);
+    } else if (type == PERF_RECORD_NAME) {
+      uint8_t kind = 0;
+      uint64_t id = 0;
+      uint32_t length = 0;
+      if (!ReadValue(&in, &kind) || !ReadValue(&in, &id) ||
+          !ReadValue(&in, &length)) {
+        break;
+      }
+      std::string name(length, '\0');
+      if (length > 0 && !in.read(&name[0], length)) {
+        break;
+      }
+      auto& names = kind == PERF_NAME_TASK ? content->task_names
+                                           : content->channel_names;
+      names[id] = name;
+    } else if (type == PERF_RECORD_LOST) {
+      uint64_t count = 0;
+      if (!ReadValue(&in, &count)) {
+        break;
+      }
+      content->lost += count;
+    } else {
+      AERROR << "unknown record type " << static_cast<int>(type) << " in "
+             << path;
+      return false;
+    }
+  }
+  // a dump of several rings is only ordered per thread
+  std::stable_sort(content->events.begin(), content->events.end(),
+                   [](const PerfRecord& lhs, const PerfRecord& rhs) {
+                     return lhs.stamp < rhs.stamp;
+                   });
+  return true;
+}
+
+void WriteChromeTrace(const PerfFileContent& content, std::ostream* out) {
+  std::vector<const PerfRecord*> sched_events;
+  std::vector<const PerfRecord*> transport_events;
+  for (const auto& event : content.events) {
+    if (event.etype == static_cast<uint8_t>(EventType::SCHED_EVENT)) {
+      sched_events.push_back(&event);
+    } else if (event.etype == static_cast<uint8_t>(EventType::TRANS_EVENT)) {
+      transport_events.push_back(&event);
+    }
+  }
+  uint64_t begin = content.events.empty() ? content.mono_base
+                                          : content.events.front().stamp;
+  TraceWriter writer(out, begin);
+  WriteSchedEvents(content, sched_events, &writer);
+  WriteTransportEvents(content, transport_events, &writer);
+  writer.Finish(content);
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_EVENT_PERF_EVENT_FILE_H_
+#define CYBER_EVENT_PERF_EVENT_FILE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/event/perf_event.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+// binary perf file layout: kPerfFileMagic, version, size of PerfRecord, the
+// same instant on the monotonic and the realtime clock, then records
+// starting with a PerfFileRecordType byte
+static const char kPerfFileMagic[] = "CYBERPRF";
+static const uint32_t kPerfFileVersion = 1;
+
+enum PerfFileRecordType : uint8_t {
+  // a PerfRecord
+  PERF_RECORD_EVENT = 1,
+  // kind, id, name length, name
+  PERF_RECORD_NAME = 2,
+  // number of events overwritten before they were written out
+  PERF_RECORD_LOST = 3,
+};
+
+enum PerfNameKind : uint8_t {
+  PERF_NAME_TASK = 0,
+  PERF_NAME_CHANNEL = 1,
+};
+
+class PerfFileWriter {
+ public:
+  PerfFileWriter() = default;
+  ~PerfFileWriter();
+
+  bool Open(const std::string& path, uint64_t mono_base, uint64_t real_base);
+  void WriteEvent(const PerfRecord& record);
+  void WriteName(PerfNameKind kind, uint64_t id, const std::string& name);
+  void WriteLost(uint64_t count);
+  void Flush();
+  void Close();
+  bool IsOpen() const { return file_ != nullptr; }
+
+ private:
+  FILE* file_ = nullptr;
+};
+
+struct PerfFileContent {
+  uint64_t mono_base = 0;
+  uint64_t real_base = 0;
+  std::vector<PerfRecord> events;
+  std::unordered_map<uint64_t, std::string> task_names;
+  std::unordered_map<uint64_t, std::string> channel_names;
+  uint64_t lost = 0;
+};
+
+bool ReadPerfFile(const std::string& path, PerfFileContent* content);
+
+/**
+ * @brief Write SCHED and TRANSPORT events in the Chrome trace event format,
+ * for chrome://tracing or Perfetto. A croutine run is a complete event on
+ * the track of the processor thread, a message is an async event per
+ * channel with its transport stages as steps.
+ */
+void WriteChromeTrace(const PerfFileContent& content, std::ostream* out);
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_PERF_EVENT_FILE_H_
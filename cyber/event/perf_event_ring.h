@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_EVENT_PERF_EVENT_RING_H_
+#define CYBER_EVENT_PERF_EVENT_RING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "cyber/base/macros.h"
+#include "cyber/event/perf_event.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+// Ring of PerfRecords written by one thread. The writer never waits: a full
+// ring overwrites its oldest record. Readers on other threads copy records
+// by index and find out from the slot sequence whether the copy is intact.
+class PerfEventRing {
+ public:
+  // |capacity| is rounded up to a power of two
+  explicit PerfEventRing(uint32_t capacity) {
+    capacity_ = 2;
+    while (capacity_ < capacity) {
+      capacity_ <<= 1;
+    }
+    slots_.reset(new Slot[capacity_]);
+  }
+
+  void Push(const PerfRecord& record) {
+    uint64_t index = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[index & (capacity_ - 1)];
+    // odd while the words are rewritten
+    slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    uint64_t words[kWords];
+    std::memcpy(words, &record, sizeof(record));
+    for (int i = 0; i < kWords; ++i) {
+      slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.seq.store(2 * index + 2, std::memory_order_release);
+    head_.store(index + 1, std::memory_order_release);
+  }
+
+  // index of the next record to be written
+  uint64_t Head() const { return head_.load(std::memory_order_acquire); }
+
+  uint64_t Capacity() const { return capacity_; }
+
+  // false when record |index| is not written yet or overwritten
+  bool Read(uint64_t index, PerfRecord* record) const {
+    const Slot& slot = slots_[index & (capacity_ - 1)];
+    uint64_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != 2 * index + 2) {
+      return false;
+    }
+    uint64_t words[kWords];
+    for (int i = 0; i < kWords; ++i) {
+      words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) != seq) {
+      return false;
+    }
+    std::memcpy(record, words, sizeof(*record));
+    return true;
+  }
+
+ private:
+  static const int kWords = sizeof(PerfRecord) / sizeof(uint64_t);
+
+  struct Slot {
+    std::atomic<uint64_t> seq = {0};
+    std::atomic<uint64_t> words[kWords];
+  };
+
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> head_ = {0};
+  uint64_t capacity_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_PERF_EVENT_RING_H_
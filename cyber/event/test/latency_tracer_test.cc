@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/event/latency_tracer.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "cyber/proto/unit_test.pb.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/global_data.h"
+#include "cyber/common/test/test_work_root.h"
+#include "cyber/cyber.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+std::string export_dir;  // NOLINT
+
+TEST(LatencyTracerTest, Histogram) {
+  EXPECT_EQ(0, LatencySnapshot::BucketIndex(0));
+  EXPECT_EQ(0, LatencySnapshot::BucketIndex(1000));
+  EXPECT_EQ(1, LatencySnapshot::BucketIndex(1001));
+  EXPECT_EQ(1, LatencySnapshot::BucketIndex(2000));
+  EXPECT_EQ(2, LatencySnapshot::BucketIndex(2001));
+  EXPECT_EQ(LatencySnapshot::kBuckets - 1,
+            LatencySnapshot::BucketIndex(100000000000ULL));
+
+  LatencyHistogram histogram;
+  for (uint64_t i = 1; i <= 100; ++i) {
+    histogram.Add(i * 1000);
+  }
+  LatencySnapshot snapshot;
+  histogram.Snapshot(&snapshot);
+  EXPECT_EQ(100, snapshot.count);
+  EXPECT_EQ(5050000, snapshot.sum);
+  EXPECT_EQ(100000, snapshot.max);
+  EXPECT_EQ(64000, snapshot.Percentile(50));
+  // capped by the largest latency seen
+  EXPECT_EQ(100000, snapshot.Percentile(99));
+  EXPECT_EQ(0, LatencySnapshot().Percentile(50));
+}
+
+TEST(LatencyTracerTest, ExportText) {
+  auto tracer = LatencyTracer::Instance();
+  ASSERT_TRUE(tracer->enabled());
+  uint64_t channel_id = common::GlobalData::RegisterChannel("/latency/\"text\"");
+  for (uint64_t i = 1; i <= 10; ++i) {
+    tracer->Record(channel_id, LatencyHop::TRANSPORT, 1000, 1000 + i * 3000);
+  }
+  // ignored
+  tracer->Record(channel_id, LatencyHop::TRANSPORT, 0, 1000);
+  tracer->Record(channel_id, LatencyHop::TRANSPORT, 2000, 1000);
+
+  LatencySnapshot expected;
+  ASSERT_TRUE(tracer->GetSnapshot(channel_id, LatencyHop::TRANSPORT, &expected));
+  EXPECT_EQ(10, expected.count);
+
+  LatencyReport report;
+  ASSERT_TRUE(ParseLatencyText(tracer->ExportText(), &report));
+  ASSERT_EQ(1, report.count("/latency/\"text\""));
+  const auto& parsed = report["/latency/\"text\""].hops[static_cast<int>(
+      LatencyHop::TRANSPORT)];
+  EXPECT_EQ(expected.count, parsed.count);
+  EXPECT_EQ(expected.sum, parsed.sum);
+  EXPECT_EQ(expected.max, parsed.max);
+  for (int i = 0; i < LatencySnapshot::kBuckets; ++i) {
+    EXPECT_EQ(expected.buckets[i], parsed.buckets[i]);
+  }
+
+  // a second process doubles the counts
+  ASSERT_TRUE(ParseLatencyText(tracer->ExportText(), &report));
+  EXPECT_EQ(2 * expected.count,
+            report["/latency/\"text\""]
+                .hops[static_cast<int>(LatencyHop::TRANSPORT)]
+                .count);
+}
+
+TEST(LatencyTracerTest, ShmHops) {
+  const std::string channel_name = "/latency/shm";
+  uint64_t channel_id = common::GlobalData::RegisterChannel(channel_name);
+  auto node = CreateNode("latency_tracer_test");
+  std::atomic<int> received = {0};
+  auto reader = node->CreateReader<proto::UnitTest>(
+      channel_name,
+      [&received](const std::shared_ptr<proto::UnitTest>&) { ++received; });
+  auto writer = node->CreateWriter<proto::UnitTest>(channel_name);
+  ASSERT_NE(nullptr, reader);
+  ASSERT_NE(nullptr, writer);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  const int kMessages = 20;
+  for (int i = 0; i < kMessages; ++i) {
+    auto message = std::make_shared<proto::UnitTest>();
+    message->set_class_name("latency");
+    writer->Write(message);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  for (int i = 0; i < 200 && received.load() < kMessages; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(kMessages, received.load());
+
+  auto tracer = LatencyTracer::Instance();
+  for (auto hop : {LatencyHop::SERIALIZE, LatencyHop::SEND,
+                   LatencyHop::TRANSPORT, LatencyHop::PARSE,
+                   LatencyHop::DISPATCH, LatencyHop::CALLBACK,
+                   LatencyHop::END_TO_END}) {
+    LatencySnapshot snapshot;
+    ASSERT_TRUE(tracer->GetSnapshot(channel_id, hop, &snapshot));
+    EXPECT_EQ(kMessages, snapshot.count) << LatencyHopName(hop);
+  }
+
+  ASSERT_TRUE(tracer->Export());
+  EXPECT_TRUE(common::PathExists(tracer->ExportFile()));
+  LatencyReport report;
+  ASSERT_TRUE(LoadLatencyExports(export_dir, &report));
+  EXPECT_EQ(kMessages,
+            report[channel_name]
+                .hops[static_cast<int>(LatencyHop::END_TO_END)]
+                .count);
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::common::TestWorkRoot work_root("latency_tracer_test");
+  apollo::cyber::event::export_dir = work_root.path() + "/latency";
+  return work_root.RunAllTests(
+      argv[0],
+      "scheduler_conf { routine_num: 100 default_proc_num: 2 }\n"
+      "transport_conf { communication_mode { same_proc: SHM } }\n"
+      "perf_conf { latency_conf { enable: true export_dir: \"" +
+          apollo::cyber::event::export_dir + "\" } }\n");
+}
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "cyber/event/perf_event_file.h"
+#include "cyber/event/perf_event_ring.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+constexpr char kPerfFile[] = "perf_event_test.data";
+
+PerfRecord MakeSched(SchedPerf eid, uint64_t cr_id, uint64_t stamp) {
+  PerfRecord record;
+  record.stamp = stamp;
+  record.id = cr_id;
+  record.tid = 3;
+  record.proc_id = 1;
+  record.etype = static_cast<uint8_t>(EventType::SCHED_EVENT);
+  record.eid = static_cast<uint8_t>(eid);
+  return record;
+}
+
+PerfRecord MakeTransport(TransPerf eid, uint64_t channel_id, uint64_t seq,
+                         uint64_t stamp) {
+  PerfRecord record;
+  record.stamp = stamp;
+  record.id = channel_id;
+  record.seq = seq;
+  record.tid = 7;
+  record.etype = static_cast<uint8_t>(EventType::TRANS_EVENT);
+  record.eid = static_cast<uint8_t>(eid);
+  return record;
+}
+
+TEST(PerfEventRingTest, PushAndRead) {
+  PerfEventRing ring(5);
+  EXPECT_EQ(8, ring.Capacity());
+  PerfRecord record;
+  EXPECT_FALSE(ring.Read(0, &record));
+  for (uint64_t i = 0; i < 12; ++i) {
+    ring.Push(MakeSched(SchedPerf::SWAP_IN, i, i * 10));
+  }
+  EXPECT_EQ(12, ring.Head());
+  // the first four are overwritten
+  for (uint64_t i = 0; i < 4; ++i) {
+    EXPECT_FALSE(ring.Read(i, &record));
+  }
+  for (uint64_t i = 4; i < 12; ++i) {
+    ASSERT_TRUE(ring.Read(i, &record));
+    EXPECT_EQ(i, record.id);
+    EXPECT_EQ(i * 10, record.stamp);
+  }
+  EXPECT_FALSE(ring.Read(12, &record));
+}
+
+TEST(PerfEventRingTest, ConcurrentReadIsConsistent) {
+  PerfEventRing ring(64);
+  const uint64_t kEvents = 200000;
+  std::thread writer([&ring, kEvents]() {
+    for (uint64_t i = 0; i < kEvents; ++i) {
+      ring.Push(MakeTransport(TransPerf::SEND, i, i, i));
+    }
+  });
+  uint64_t read = 0;
+  PerfRecord record;
+  while (read < kEvents) {
+    uint64_t head = ring.Head();
+    if (head - read > ring.Capacity()) {
+      read = head - ring.Capacity();
+    }
+    for (; read < head; ++read) {
+      if (ring.Read(read, &record)) {
+        // a torn copy would mix two records
+        ASSERT_EQ(read, record.id);
+        ASSERT_EQ(read, record.seq);
+        ASSERT_EQ(read, record.stamp);
+      }
+    }
+  }
+  writer.join();
+}
+
+TEST(PerfEventFileTest, WriteReadAndTrace) {
+  {
+    PerfFileWriter writer;
+    ASSERT_TRUE(writer.Open(kPerfFile, 1000, 5000));
+    writer.WriteName(PERF_NAME_TASK, 42, "planning \"main\"");
+    writer.WriteName(PERF_NAME_CHANNEL, 9, "/apollo/test");
+    writer.WriteEvent(MakeSched(SchedPerf::SWAP_IN, 42, 2000));
+    writer.WriteEvent(MakeSched(SchedPerf::SWAP_OUT, 42, 5000));
+    writer.WriteEvent(MakeSched(SchedPerf::NOTIFY_IN, 42, 6000));
+    writer.WriteEvent(MakeTransport(TransPerf::TRANSMIT_BEGIN, 9, 3, 2500));
+    writer.WriteEvent(MakeTransport(TransPerf::DISPATCH, 9, 3, 3500));
+    writer.WriteEvent(MakeTransport(TransPerf::NOTIFY, 9, 3, 4500));
+    writer.WriteLost(2);
+    writer.Close();
+  }
+
+  PerfFileContent content;
+  ASSERT_TRUE(ReadPerfFile(kPerfFile, &content));
+  EXPECT_EQ(1000, content.mono_base);
+  EXPECT_EQ(5000, content.real_base);
+  EXPECT_EQ(6, content.events.size());
+  EXPECT_EQ(2, content.lost);
+  EXPECT_EQ("/apollo/test", content.channel_names[9]);
+  // sorted by time
+  for (size_t i = 1; i < content.events.size(); ++i) {
+    EXPECT_LE(content.events[i - 1].stamp, content.events[i].stamp);
+  }
+
+  std::ostringstream trace;
+  WriteChromeTrace(content, &trace);
+  std::string json = trace.str();
+  EXPECT_NE(std::string::npos,
+            json.find("{\"ph\":\"X\",\"name\":\"planning \\\"main\\\"\","
+                      "\"pid\":1,\"tid\":3,\"ts\":0.000,\"dur\":3.000"));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"NOTIFY_IN\""));
+  EXPECT_NE(std::string::npos, json.find("{\"name\":\"processor 1\"}"));
+  EXPECT_NE(std::string::npos,
+            json.find("{\"ph\":\"b\",\"name\":\"/apollo/test\",\"pid\":2,"
+                      "\"tid\":7,\"ts\":0.500"));
+  EXPECT_NE(std::string::npos, json.find("{\"stage\":\"DISPATCH\"}"));
+  EXPECT_NE(std::string::npos,
+            json.find("{\"ph\":\"e\",\"name\":\"/apollo/test\",\"pid\":2,"
+                      "\"tid\":7,\"ts\":2.500"));
+  EXPECT_NE(std::string::npos, json.find("\"lost_events\":2"));
+  remove(kPerfFile);
+}
+
+TEST(PerfEventFileTest, RejectsOtherFiles) {
+  FILE* file = fopen(kPerfFile, "w");
+  ASSERT_NE(nullptr, file);
+  fputs("1234567890\n", file);
+  fclose(file);
+  PerfFileContent content;
+  EXPECT_FALSE(ReadPerfFile(kPerfFile, &content));
+  remove(kPerfFile);
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
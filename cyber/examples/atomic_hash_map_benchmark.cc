@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/base/atomic_hash_map.h"
+#include "cyber/time/time.h"
+
+// Fills an AtomicHashMap with 10 to 100k random ids, the way GlobalData
+// hashes names into ids, then times lookups of present and absent keys on
+// reader threads. With churn, one more thread keeps removing and re-adding
+// keys while the readers run.
+// Usage: atomic_hash_map_benchmark [lookups] [threads] [churn]
+
+using apollo::cyber::Time;
+using apollo::cyber::base::AtomicHashMap;
+
+using Map = AtomicHashMap<uint64_t, uint64_t>;
+
+// runs op(thread, i) count times on each of threads threads, returns ns per op
+uint64_t Measure(int threads, int count,
+                 const std::function<void(int, int)>& op) {
+  std::vector<std::thread> workers;
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([t, count, &op]() {
+      for (int i = 0; i < count; ++i) {
+        op(t, i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  uint64_t elapsed_ns = Time::MonoTime().ToNanosecond() - begin;
+  return elapsed_ns / (static_cast<uint64_t>(threads) * count);
+}
+
+int main(int argc, char* argv[]) {
+  int lookups = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  int threads = argc > 2 ? std::atoi(argv[2]) : 1;
+  bool churn = argc > 3 && std::string(argv[3]) == "churn";
+  if (lookups <= 0 || threads <= 0) {
+    std::cout << "Usage: " << argv[0] << " [lookups] [threads] [churn]"
+              << std::endl;
+    return -1;
+  }
+
+  std::mt19937_64 random(42);
+  for (int size : {10, 100, 1000, 10000, 100000}) {
+    std::vector<uint64_t> keys(size);
+    std::vector<uint64_t> absent(size);
+    for (int i = 0; i < size; ++i) {
+      keys[i] = random();
+      absent[i] = random();
+    }
+
+    Map map;
+    uint64_t insert_ns = Measure(1, size, [&](int, int i) {
+      map.Set(keys[i], i);
+    });
+
+    std::atomic<bool> stop(false);
+    std::thread churner;
+    if (churn) {
+      churner = std::thread([&]() {
+        for (int i = 0; !stop.load(); i = (i + 1) % size) {
+          map.Remove(keys[i]);
+          map.Set(keys[i], i);
+        }
+      });
+    }
+
+    std::atomic<uint64_t> found(0);
+    uint64_t hit_ns = Measure(threads, lookups, [&](int t, int i) {
+      uint64_t value = 0;
+      if (map.Get(keys[(i * 7 + t) % size], &value)) {
+        found.fetch_add(value == 0 ? 0 : 1, std::memory_order_relaxed);
+      }
+    });
+    uint64_t miss_ns = Measure(threads, lookups, [&](int t, int i) {
+      if (map.Has(absent[(i * 7 + t) % size])) {
+        found.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+
+    stop.store(true);
+    if (churner.joinable()) {
+      churner.join();
+    }
+    std::cout << size << " keys: insert " << insert_ns << " ns, hit "
+              << hit_ns << " ns, miss " << miss_ns << " ns"
+              << " (" << found.load() << ")" << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/init.h"
+#include "cyber/logger/async_logger.h"
+#include "cyber/time/time.h"
+
+// Cost of a log call in the calling thread and messages lost under bursts.
+// Usage: log_benchmark [messages per thread]
+
+using apollo::cyber::Time;
+using apollo::cyber::logger::AsyncLogger;
+
+const int kBurstThreads = 8;
+
+enum class Mode { STREAM, FORMAT_TEXT, FORMAT_BINARY };
+
+void LogOne(Mode mode, uint64_t i, const std::string& name) {
+  if (mode == Mode::STREAM) {
+    AINFO << "benchmark message " << i << " from " << name << " value "
+          << 0.5 * static_cast<double>(i);
+  } else {
+    AINFO_F("benchmark message %lu from %s value %f", i, name,
+            0.5 * static_cast<double>(i));
+  }
+}
+
+// each thread logs |count| messages as fast as it can, the cost is the wall
+// time of the calling threads divided by all messages
+void Run(AsyncLogger* logger, Mode mode, int threads, uint64_t count,
+         const std::string& title) {
+  logger->SetBinaryMode(mode == Mode::FORMAT_BINARY);
+  logger->Flush();
+  uint64_t dropped = logger->GetDroppedNumber();
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      std::string name = "thread" + std::to_string(t);
+      for (uint64_t i = 0; i < count; ++i) {
+        LogOne(mode, i, name);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  uint64_t spent_ns = Time::MonoTime().ToNanosecond() - begin;
+  logger->Flush();
+  uint64_t total = count * threads;
+  uint64_t lost = logger->GetDroppedNumber() - dropped;
+  std::cout << title << ": " << threads << " x " << count << " messages, "
+            << spent_ns / total << " ns/message, " << lost
+            << " lost (" << 100.0 * static_cast<double>(lost) / total << "%)"
+            << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  uint64_t count = 100000;
+  if (argc > 1) {
+    count = std::strtoull(argv[1], nullptr, 10);
+  }
+  if (count == 0) {
+    std::cout << "Usage: " << argv[0] << " [messages per thread]" << std::endl;
+    return -1;
+  }
+  apollo::cyber::Init(argv[0]);
+  auto logger =
+      dynamic_cast<AsyncLogger*>(google::base::GetLogger(FLAGS_minloglevel));
+  if (logger == nullptr) {
+    std::cout << "async logger is not installed." << std::endl;
+    return -1;
+  }
+
+  Run(logger, Mode::STREAM, 1, count, "AINFO");
+  Run(logger, Mode::FORMAT_TEXT, 1, count, "AINFO_F text");
+  Run(logger, Mode::FORMAT_BINARY, 1, count, "AINFO_F binary");
+  Run(logger, Mode::STREAM, kBurstThreads, count, "AINFO burst");
+  Run(logger, Mode::FORMAT_TEXT, kBurstThreads, count, "AINFO_F text burst");
+  Run(logger, Mode::FORMAT_BINARY, kBurstThreads, count,
+      "AINFO_F binary burst");
+
+  apollo::cyber::Clear();
+  return 0;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "cyber/base/concurrent_object_pool.h"
+#include "cyber/base/magazine_pool.h"
+#include "cyber/record/record_message.h"
+#include "cyber/time/time.h"
+#include "cyber/transport/shm/segment.h"
+
+// Allocates and releases the objects cyber makes per message: a shm
+// ReadableBlock, a fused tuple and a RecordMessage, with make_shared, with a
+// CCObjectPool and with the magazine pool. Every thread keeps a window of
+// objects alive, so releases do not simply undo the last allocation.
+// Usage: object_pool_benchmark [objects] [threads]
+
+using apollo::cyber::Time;
+using apollo::cyber::base::CCObjectPool;
+using apollo::cyber::base::PoolAllocator;
+using apollo::cyber::record::RecordMessage;
+using apollo::cyber::transport::ReadableBlock;
+
+using Fused = std::tuple<std::shared_ptr<int>, std::shared_ptr<int>,
+                         std::shared_ptr<int>>;
+
+const int kWindow = 64;
+
+// runs count allocations on each of threads threads, returns ns per object
+template <typename T>
+uint64_t Measure(int threads, int count,
+                 const std::function<std::shared_ptr<T>()>& make) {
+  std::vector<std::thread> workers;
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([count, &make]() {
+      std::vector<std::shared_ptr<T>> window(kWindow);
+      for (int i = 0; i < count; ++i) {
+        window[(i * 7) % kWindow] = make();
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  uint64_t elapsed_ns = Time::MonoTime().ToNanosecond() - begin;
+  return elapsed_ns / (static_cast<uint64_t>(threads) * count);
+}
+
+template <typename T>
+void Compare(const std::string& name, int threads, int count) {
+  auto pool = std::make_shared<CCObjectPool<T>>(threads * kWindow + 1);
+  uint64_t heap_ns =
+      Measure<T>(threads, count, []() { return std::make_shared<T>(); });
+  uint64_t cc_ns = Measure<T>(threads, count,
+                              [&pool]() { return pool->ConstructObject(); });
+  uint64_t magazine_ns = Measure<T>(threads, count, []() {
+    return std::allocate_shared<T>(PoolAllocator<T>());
+  });
+  std::cout << name << ": make_shared " << heap_ns << " ns, CCObjectPool "
+            << cc_ns << " ns, magazine pool " << magazine_ns << " ns"
+            << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  int objects = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  int threads = argc > 2 ? std::atoi(argv[2]) : 1;
+  if (objects <= 0 || threads <= 0) {
+    std::cout << "Usage: " << argv[0] << " [objects] [threads]" << std::endl;
+    return -1;
+  }
+
+  Compare<ReadableBlock>("ReadableBlock", threads, objects);
+  Compare<Fused>("fused tuple", threads, objects);
+  Compare<RecordMessage>("RecordMessage", threads, objects);
+  return 0;
+}
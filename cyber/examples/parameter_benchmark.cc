@@ -0,0 +1,226 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/parameter/parameter_client.h"
+#include "cyber/parameter/parameter_server.h"
+#include "cyber/time/time.h"
+
+// Every client loads its own parameters from one ParameterServer: one
+// request per parameter, one batch request, or from the local copy kept by
+// Watch(). The clients are spread over loader threads, each with its own
+// ParameterClient. intra keeps the server in this process, shm forks it.
+// Usage: parameter_benchmark [intra|shm] [clients] [parameters] [threads]
+
+using apollo::cyber::Parameter;
+using apollo::cyber::ParameterClient;
+using apollo::cyber::ParameterServer;
+using apollo::cyber::Time;
+
+const char kServerNode[] = "parameter_benchmark_server";
+
+std::string ParamName(int client, int param) {
+  return "/client_" + std::to_string(client) + "/param_" +
+         std::to_string(param);
+}
+
+bool WriteConf(const std::string& conf_dir) {
+  std::ofstream conf(conf_dir + "/cyber.pb.conf");
+  conf << "scheduler_conf { routine_num: 100 default_proc_num: 2 }\n"
+       << "transport_conf { communication_mode { same_proc: INTRA "
+          "diff_proc: SHM } }\n";
+  return conf.good();
+}
+
+std::unique_ptr<ParameterServer> RunServer(int clients, int params) {
+  std::shared_ptr<apollo::cyber::Node> node(
+      apollo::cyber::CreateNode(kServerNode));
+  std::unique_ptr<ParameterServer> server(new ParameterServer(node));
+  for (int client = 0; client < clients; ++client) {
+    std::vector<Parameter> parameters;
+    for (int param = 0; param < params; ++param) {
+      parameters.emplace_back(ParamName(client, param),
+                              static_cast<int64_t>(client * params + param));
+    }
+    server->SetParameters(parameters);
+  }
+  return server;
+}
+
+// runs load(loader, client) for every client, spread over the loaders
+void Measure(const std::string& name,
+             std::vector<std::unique_ptr<ParameterClient>>* loaders,
+             int clients, int params,
+             const std::function<bool(ParameterClient*, int)>& load) {
+  std::vector<std::thread> threads;
+  std::vector<int> failed(loaders->size(), 0);
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (size_t i = 0; i < loaders->size(); ++i) {
+    threads.emplace_back([&, i]() {
+      for (int client = static_cast<int>(i); client < clients;
+           client += static_cast<int>(loaders->size())) {
+        if (!load((*loaders)[i].get(), client)) {
+          ++failed[i];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  uint64_t elapsed_us = (Time::MonoTime().ToNanosecond() - begin) / 1000;
+  int failures = 0;
+  for (int count : failed) {
+    failures += count;
+  }
+  std::cout << name << ": " << clients << " clients x " << params
+            << " parameters in " << elapsed_us / 1000 << " ms, "
+            << static_cast<uint64_t>(clients) * params * 1000000 /
+                   std::max<uint64_t>(elapsed_us, 1)
+            << " parameters/s, " << failures << " clients failed"
+            << std::endl;
+}
+
+void RunLoaders(int clients, int params, int threads) {
+  std::vector<std::shared_ptr<apollo::cyber::Node>> nodes;
+  std::vector<std::unique_ptr<ParameterClient>> loaders;
+  for (int i = 0; i < threads; ++i) {
+    nodes.emplace_back(
+        apollo::cyber::CreateNode("parameter_loader_" + std::to_string(i)));
+    loaders.emplace_back(new ParameterClient(nodes.back(), kServerNode));
+  }
+  // the first requests may go out before the transports are matched
+  Parameter probe;
+  bool ready = false;
+  for (int i = 0; i < 100 && !ready; ++i) {
+    ready = loaders[0]->GetParameter(ParamName(clients - 1, params - 1),
+                                     &probe);
+    if (!ready) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+  }
+  if (!ready) {
+    std::cout << "parameter server does not answer" << std::endl;
+    return;
+  }
+
+  auto single = [params](ParameterClient* loader, int client) {
+    Parameter parameter;
+    for (int param = 0; param < params; ++param) {
+      if (!loader->GetParameter(ParamName(client, param), &parameter)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  auto batch = [params](ParameterClient* loader, int client) {
+    std::vector<std::string> names;
+    for (int param = 0; param < params; ++param) {
+      names.emplace_back(ParamName(client, param));
+    }
+    std::vector<Parameter> parameters;
+    return loader->GetParameters(names, &parameters) &&
+           parameters.size() == names.size();
+  };
+  Measure("single", &loaders, clients, params, single);
+  Measure("batch", &loaders, clients, params, batch);
+
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (auto& loader : loaders) {
+    if (!loader->Watch()) {
+      std::cout << "watch failed" << std::endl;
+      return;
+    }
+  }
+  std::cout << "watch: " << threads << " copies of " << clients * params
+            << " parameters in "
+            << (Time::MonoTime().ToNanosecond() - begin) / 1000000 << " ms"
+            << std::endl;
+  Measure("cached single", &loaders, clients, params, single);
+  Measure("cached batch", &loaders, clients, params, batch);
+}
+
+int main(int argc, char* argv[]) {
+  std::string mode = argc > 1 ? argv[1] : "shm";
+  int clients = argc > 2 ? std::atoi(argv[2]) : 1000;
+  int params = argc > 3 ? std::atoi(argv[3]) : 50;
+  int threads = argc > 4 ? std::atoi(argv[4]) : 8;
+  if ((mode != "intra" && mode != "shm") || clients <= 0 || params <= 0 ||
+      threads <= 0) {
+    std::cout << "Usage: " << argv[0]
+              << " [intra|shm] [clients] [parameters] [threads]" << std::endl;
+    return -1;
+  }
+
+  char work_root[] = "/tmp/parameter_benchmark_XXXXXX";
+  if (mkdtemp(work_root) == nullptr) {
+    return -1;
+  }
+  std::string conf_dir = std::string(work_root) + "/conf";
+  apollo::cyber::common::EnsureDirectory(conf_dir);
+  if (!WriteConf(conf_dir)) {
+    return -1;
+  }
+  setenv("CYBER_PATH", work_root, 1);
+
+  pid_t server_pid = -1;
+  if (mode == "shm") {
+    server_pid = fork();
+    if (server_pid < 0) {
+      return -1;
+    }
+    if (server_pid == 0) {
+      apollo::cyber::Init("parameter_benchmark_server");
+      auto server = RunServer(clients, params);
+      apollo::cyber::WaitForShutdown();
+      return 0;
+    }
+  }
+
+  apollo::cyber::Init(argv[0]);
+  std::unique_ptr<ParameterServer> server;
+  if (mode == "intra") {
+    server = RunServer(clients, params);
+  }
+  std::cout << mode << " transport" << std::endl;
+  RunLoaders(clients, params, threads);
+
+  if (server_pid > 0) {
+    kill(server_pid, SIGINT);
+    waitpid(server_pid, nullptr, 0);
+  }
+  apollo::cyber::common::RemoveAllFiles(conf_dir);
+  rmdir(conf_dir.c_str());
+  apollo::cyber::Clear();
+  rmdir(work_root);
+  return 0;
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "cyber/cyber.h"
+#include "cyber/examples/proto/examples.pb.h"
+#include "cyber/init.h"
+#include "cyber/time/time.h"
+
+// Ping-pong round trips between a Client and a Service with 64B and 1MB
+// payloads. intra keeps both in this process, shm and rtps fork the Service
+// into a second process and pin the transport between them.
+// Usage: service_benchmark [intra|shm|rtps] [round trips]
+
+using apollo::cyber::Time;
+using apollo::cyber::examples::proto::Chatter;
+
+const char kServiceName[] = "/benchmark/ping_pong";
+
+bool WriteConf(const std::string& conf_dir, const std::string& mode) {
+  std::string same_proc = mode == "rtps" ? "RTPS" : "INTRA";
+  std::string diff_proc = mode == "rtps" ? "RTPS" : "SHM";
+  std::ofstream conf(conf_dir + "/cyber.pb.conf");
+  conf << "scheduler_conf { routine_num: 100 default_proc_num: 2 }\n"
+       << "transport_conf { communication_mode { same_proc: " << same_proc
+       << " diff_proc: " << diff_proc << " } }\n";
+  return conf.good();
+}
+
+void RunServer(const std::shared_ptr<apollo::cyber::Node>& node,
+               std::shared_ptr<apollo::cyber::Service<Chatter, Chatter>>*
+                   service) {
+  *service = node->CreateService<Chatter, Chatter>(
+      kServiceName, [](const std::shared_ptr<Chatter>& request,
+                       std::shared_ptr<Chatter>& response) {
+        response->CopyFrom(*request);
+      });
+}
+
+void Measure(const std::shared_ptr<apollo::cyber::Client<Chatter, Chatter>>&
+                 client,
+             size_t payload, int round_trips) {
+  auto request = std::make_shared<Chatter>();
+  request->set_content(std::string(payload, 'x'));
+  std::vector<uint64_t> latency_us;
+  latency_us.reserve(round_trips);
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (int i = 0; i < round_trips; ++i) {
+    request->set_seq(i);
+    uint64_t start = Time::MonoTime().ToNanosecond();
+    auto response = client->SendRequest(request);
+    if (response == nullptr || response->seq() != static_cast<uint64_t>(i)) {
+      std::cout << "round trip " << i << " failed" << std::endl;
+      return;
+    }
+    latency_us.push_back((Time::MonoTime().ToNanosecond() - start) / 1000);
+  }
+  uint64_t elapsed_ns = Time::MonoTime().ToNanosecond() - begin;
+  std::sort(latency_us.begin(), latency_us.end());
+  std::cout << payload << " bytes: " << round_trips << " round trips, "
+            << elapsed_ns / 1000 / round_trips << " us avg, p50 "
+            << latency_us[latency_us.size() / 2] << " us, p99 "
+            << latency_us[latency_us.size() * 99 / 100] << " us" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  std::string mode = argc > 1 ? argv[1] : "shm";
+  int round_trips = argc > 2 ? std::atoi(argv[2]) : 1000;
+  if ((mode != "intra" && mode != "shm" && mode != "rtps") ||
+      round_trips <= 0) {
+    std::cout << "Usage: " << argv[0] << " [intra|shm|rtps] [round trips]"
+              << std::endl;
+    return -1;
+  }
+
+  char work_root[] = "/tmp/service_benchmark_XXXXXX";
+  if (mkdtemp(work_root) == nullptr) {
+    return -1;
+  }
+  std::string conf_dir = std::string(work_root) + "/conf";
+  apollo::cyber::common::EnsureDirectory(conf_dir);
+  if (!WriteConf(conf_dir, mode)) {
+    return -1;
+  }
+  setenv("CYBER_PATH", work_root, 1);
+
+  pid_t server_pid = -1;
+  if (mode != "intra") {
+    server_pid = fork();
+    if (server_pid < 0) {
+      return -1;
+    }
+    if (server_pid == 0) {
+      apollo::cyber::Init("service_benchmark_server");
+      auto node = apollo::cyber::CreateNode("ping_pong_server");
+      std::shared_ptr<apollo::cyber::Service<Chatter, Chatter>> service;
+      RunServer(std::shared_ptr<apollo::cyber::Node>(std::move(node)),
+                &service);
+      apollo::cyber::WaitForShutdown();
+      return 0;
+    }
+  }
+
+  apollo::cyber::Init(argv[0]);
+  std::shared_ptr<apollo::cyber::Node> node(
+      apollo::cyber::CreateNode("ping_pong_client"));
+  std::shared_ptr<apollo::cyber::Service<Chatter, Chatter>> service;
+  if (mode == "intra") {
+    RunServer(node, &service);
+  }
+  auto client = node->CreateClient<Chatter, Chatter>(kServiceName);
+  if (!client->WaitForService(std::chrono::seconds(10))) {
+    std::cout << "service not found" << std::endl;
+  } else {
+    // the first requests may go out before the transports are matched
+    auto probe = std::make_shared<Chatter>();
+    bool ready = false;
+    for (int i = 0; i < 10 && !ready; ++i) {
+      ready = client->SendRequest(probe, std::chrono::seconds(1)) != nullptr;
+    }
+    if (ready) {
+      std::cout << mode << " transport" << std::endl;
+      Measure(client, 64, round_trips);
+      Measure(client, 1 << 20, std::max(round_trips / 10, 1));
+    } else {
+      std::cout << "service does not answer" << std::endl;
+    }
+  }
+
+  if (server_pid > 0) {
+    kill(server_pid, SIGINT);
+    waitpid(server_pid, nullptr, 0);
+  }
+  apollo::cyber::common::RemoveAllFiles(conf_dir);
+  rmdir(conf_dir.c_str());
+  apollo::cyber::Clear();
+  rmdir(work_root);
+  return 0;
+}
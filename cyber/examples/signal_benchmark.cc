@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "cyber/base/signal.h"
+#include "cyber/message/raw_message.h"
+#include "cyber/time/time.h"
+#include "cyber/transport/message/listener_handler.h"
+
+// Fans messages out to 1 to 32 subscribers of one channel: through a bare
+// base::Signal, and through a ListenerHandler whose subscribers listen to
+// every writer or to one writer among 16. With churn, one more thread keeps
+// connecting and disconnecting a subscriber meanwhile.
+// Usage: signal_benchmark [messages] [churn]
+
+using apollo::cyber::Time;
+using apollo::cyber::base::Signal;
+using apollo::cyber::message::RawMessage;
+using apollo::cyber::transport::Identity;
+using apollo::cyber::transport::ListenerHandler;
+using apollo::cyber::transport::MessageInfo;
+
+using Handler = ListenerHandler<RawMessage>;
+
+const int kWriters = 16;
+
+template <typename Op>
+uint64_t Measure(int count, const Op& op) {
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (int i = 0; i < count; ++i) {
+    op(i);
+  }
+  return (Time::MonoTime().ToNanosecond() - begin) / count;
+}
+
+int main(int argc, char* argv[]) {
+  int messages = argc > 1 ? std::atoi(argv[1]) : 200000;
+  bool churn = argc > 2 && std::string(argv[2]) == "churn";
+  if (messages <= 0) {
+    std::cout << "Usage: " << argv[0] << " [messages] [churn]" << std::endl;
+    return -1;
+  }
+
+  auto msg = std::make_shared<RawMessage>("benchmark");
+  Identity writers[kWriters];
+  MessageInfo infos[kWriters];
+  for (int w = 0; w < kWriters; ++w) {
+    infos[w].set_sender_id(writers[w]);
+  }
+
+  for (int subscribers : {1, 2, 4, 8, 16, 32}) {
+    std::atomic<uint64_t> calls(0);
+    auto count = [&calls](const std::shared_ptr<RawMessage>&,
+                          const MessageInfo&) {
+      calls.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    Signal<const std::shared_ptr<RawMessage>&, const MessageInfo&> signal;
+    Handler all;
+    Handler per_writer;
+    for (int s = 0; s < subscribers; ++s) {
+      signal.Connect(count);
+      all.Connect(s, count);
+      per_writer.Connect(s, writers[s % kWriters].HashValue(), count);
+    }
+
+    std::atomic<bool> stop(false);
+    std::thread churner;
+    if (churn) {
+      churner = std::thread([&]() {
+        for (uint64_t id = subscribers; !stop.load(); ++id) {
+          auto conn = signal.Connect(count);
+          all.Connect(id, count);
+          per_writer.Connect(id, writers[id % kWriters].HashValue(), count);
+          conn.Disconnect();
+          all.Disconnect(id);
+          per_writer.Disconnect(id, writers[id % kWriters].HashValue());
+        }
+      });
+    }
+
+    uint64_t signal_ns =
+        Measure(messages, [&](int i) { signal(msg, infos[i % kWriters]); });
+    uint64_t all_ns =
+        Measure(messages, [&](int i) { all.Run(msg, infos[i % kWriters]); });
+    uint64_t per_writer_ns = Measure(
+        messages, [&](int i) { per_writer.Run(msg, infos[i % kWriters]); });
+
+    stop.store(true);
+    if (churner.joinable()) {
+      churner.join();
+    }
+    std::cout << subscribers << " subscribers: signal " << signal_ns
+              << " ns, handler " << all_ns << " ns, handler by writer "
+              << per_writer_ns << " ns per message (" << calls.load()
+              << " calls)" << std::endl;
+  }
+  return 0;
+}
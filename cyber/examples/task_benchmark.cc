@@ -0,0 +1,188 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/base/mpmc_queue.h"
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/task/task.h"
+#include "cyber/time/time.h"
+
+// Enqueue/dequeue cost and heap allocations of the task pool, measured from
+// 8 producer threads. Usage: task_benchmark [tasks per producer]
+
+using apollo::cyber::TaskFunction;
+using apollo::cyber::Time;
+using apollo::cyber::base::MpmcQueue;
+
+static std::atomic<uint64_t> g_allocations = {0};
+
+void* operator new(size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = std::malloc(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+const int kProducers = 8;
+// what a typical task captures besides its target, e.g. a message pointer
+// and a few ids, too big for the inline buffer of std::function
+struct Payload {
+  uint64_t values[3] = {1, 2, 3};
+};
+// keeps the bounded task queue from overflowing
+const uint64_t kMaxInFlight = 512;
+
+struct Result {
+  uint64_t ops = 0;
+  uint64_t enqueue_ns = 0;
+  uint64_t total_ns = 0;
+  uint64_t allocations = 0;
+};
+
+void Print(const std::string& name, const Result& result) {
+  std::cout << name << ": " << result.ops << " tasks, "
+            << result.enqueue_ns / result.ops << " ns/enqueue per producer, "
+            << result.total_ns / result.ops << " ns/task end to end, "
+            << static_cast<double>(result.allocations) / result.ops
+            << " allocations/task" << std::endl;
+}
+
+// raw queue: 8 producers, one consumer thread draining and running tasks
+template <typename Queue, typename Task>
+Result RunQueue(uint64_t per_producer) {
+  Queue queue;
+  queue.Init(1024);
+  std::atomic<uint64_t> done = {0};
+  std::atomic<uint64_t> enqueue_ns = {0};
+  uint64_t total = per_producer * kProducers;
+  uint64_t alloc_begin = g_allocations.load();
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  std::thread consumer([&]() {
+    Task task;
+    uint64_t consumed = 0;
+    while (consumed < total) {
+      if (queue.Dequeue(&task)) {
+        task();
+        task = nullptr;
+        ++consumed;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&]() {
+      uint64_t spent = 0;
+      for (uint64_t i = 0; i < per_producer; ++i) {
+        uint64_t start = Time::MonoTime().ToNanosecond();
+        Payload payload;
+        while (!queue.Enqueue(
+            Task([&done, payload]() { done += payload.values[0]; }))) {
+          std::this_thread::yield();
+        }
+        spent += Time::MonoTime().ToNanosecond() - start;
+      }
+      enqueue_ns += spent;
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  consumer.join();
+  Result result;
+  result.ops = total;
+  result.total_ns = Time::MonoTime().ToNanosecond() - begin;
+  result.enqueue_ns = enqueue_ns.load() / kProducers;
+  result.allocations = g_allocations.load() - alloc_begin;
+  return result;
+}
+
+// the task pool, through cyber::Post or the future returning cyber::Async
+Result RunPool(uint64_t per_producer, bool post) {
+  std::atomic<uint64_t> done = {0};
+  std::atomic<uint64_t> submitted = {0};
+  std::atomic<uint64_t> enqueue_ns = {0};
+  uint64_t total = per_producer * kProducers;
+  uint64_t alloc_begin = g_allocations.load();
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&]() {
+      uint64_t spent = 0;
+      for (uint64_t i = 0; i < per_producer; ++i) {
+        while (submitted.load() - done.load() >= kMaxInFlight) {
+          std::this_thread::yield();
+        }
+        ++submitted;
+        uint64_t start = Time::MonoTime().ToNanosecond();
+        Payload payload;
+        if (post) {
+          apollo::cyber::Post([&done, payload]() { done += payload.values[0]; });
+        } else {
+          apollo::cyber::Async([&done, payload]() { done += payload.values[0]; });
+        }
+        spent += Time::MonoTime().ToNanosecond() - start;
+      }
+      enqueue_ns += spent;
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  while (done.load() < total) {
+    std::this_thread::yield();
+  }
+  Result result;
+  result.ops = total;
+  result.total_ns = Time::MonoTime().ToNanosecond() - begin;
+  result.enqueue_ns = enqueue_ns.load() / kProducers;
+  result.allocations = g_allocations.load() - alloc_begin;
+  return result;
+}
+
+int main(int argc, char* argv[]) {
+  uint64_t per_producer = 100000;
+  if (argc > 1) {
+    per_producer = std::strtoull(argv[1], nullptr, 10);
+  }
+  if (per_producer == 0) {
+    std::cout << "Usage: " << argv[0] << " [tasks per producer]" << std::endl;
+    return -1;
+  }
+  apollo::cyber::Init(argv[0]);
+
+  Print("MpmcQueue<TaskFunction>",
+        RunQueue<MpmcQueue<TaskFunction>, TaskFunction>(per_producer));
+  Print("cyber::Async", RunPool(per_producer, false));
+  Print("cyber::Post", RunPool(per_producer, true));
+
+  apollo::cyber::Clear();
+  return 0;
+}
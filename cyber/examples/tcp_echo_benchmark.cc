@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/io/session.h"
+#include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/time/time.h"
+
+// Round trips per second and latency of a croutine echo server holding many
+// concurrent connections, driven by plain epoll client threads in the same
+// process. Every connection keeps one 64 byte request in flight. The server
+// waits on sockets through oneshot or persistent epoll registrations, or
+// through io_uring; run once per mode to compare them.
+// Usage: tcp_echo_benchmark [connections] [seconds]
+//                           [oneshot|persistent|uring] [poller threads]
+// Each connection costs one croutine, i.e. STACK_SIZE bytes of the routine
+// pool, and two file descriptors.
+
+using apollo::cyber::Time;
+using apollo::cyber::io::Session;
+
+const uint16_t kPort = 18999;
+const int kClientThreads = 2;
+const size_t kMessageSize = 64;
+
+void Echo(const std::shared_ptr<Session>& session) {
+  char buffer[kMessageSize * 4];
+  ssize_t nbytes = 0;
+  while ((nbytes = session->Recv(buffer, sizeof(buffer), 0)) > 0) {
+    if (session->Write(buffer, nbytes) != nbytes) {
+      break;
+    }
+  }
+  session->Close();
+}
+
+void Acceptor(int connections) {
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(kPort);
+
+  Session listener;
+  listener.Socket(AF_INET, SOCK_STREAM, 0);
+  int reuse = 1;
+  setsockopt(listener.fd(), SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  if (listener.Bind(reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) <
+      0) {
+    std::cout << "bind to port[" << kPort << "] failed." << std::endl;
+    return;
+  }
+  listener.Listen(4096);
+  for (int i = 0; i < connections; ++i) {
+    auto session = listener.Accept(nullptr, nullptr);
+    if (session == nullptr) {
+      break;
+    }
+    apollo::cyber::scheduler::Instance()->CreateTask(
+        std::bind(Echo, session), "echo_" + std::to_string(i));
+  }
+  listener.Close();
+}
+
+struct Connection {
+  int fd = -1;
+  size_t received = 0;
+  uint64_t sent_ns = 0;
+};
+
+struct ClientResult {
+  uint64_t round_trips = 0;
+  std::vector<uint32_t> latency_us;
+};
+
+bool SendRequest(Connection* conn, const char* request) {
+  conn->received = 0;
+  conn->sent_ns = Time::MonoTime().ToNanosecond();
+  return send(conn->fd, request, kMessageSize, MSG_NOSIGNAL) ==
+         static_cast<ssize_t>(kMessageSize);
+}
+
+// drives its share of the connections until the deadline, the first request
+// of each connection goes out once all connections are established
+void RunClient(std::vector<Connection>* conns, uint64_t deadline_ns,
+               ClientResult* result) {
+  char request[kMessageSize];
+  std::memset(request, 'x', sizeof(request));
+  char buffer[kMessageSize];
+  int epfd = epoll_create1(EPOLL_CLOEXEC);
+  for (auto& conn : *conns) {
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &conn;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, conn.fd, &ev);
+    SendRequest(&conn, request);
+  }
+  std::vector<struct epoll_event> events(256);
+  result->latency_us.reserve(1 << 20);
+  while (Time::MonoTime().ToNanosecond() < deadline_ns) {
+    int nfds = epoll_wait(epfd, events.data(), static_cast<int>(events.size()),
+                          10);
+    for (int i = 0; i < nfds; ++i) {
+      auto conn = static_cast<Connection*>(events[i].data.ptr);
+      ssize_t nbytes =
+          recv(conn->fd, buffer, kMessageSize - conn->received, 0);
+      if (nbytes <= 0) {
+        if (nbytes == 0 || (errno != EAGAIN && errno != EINTR)) {
+          epoll_ctl(epfd, EPOLL_CTL_DEL, conn->fd, nullptr);
+        }
+        continue;
+      }
+      conn->received += nbytes;
+      if (conn->received < kMessageSize) {
+        continue;
+      }
+      uint64_t now = Time::MonoTime().ToNanosecond();
+      ++result->round_trips;
+      if (result->latency_us.size() < result->latency_us.capacity()) {
+        result->latency_us.push_back(
+            static_cast<uint32_t>((now - conn->sent_ns) / 1000));
+      }
+      SendRequest(conn, request);
+    }
+  }
+  close(epfd);
+}
+
+bool WriteConf(const std::string& conf_dir, int connections,
+               const std::string& mode, int poller_threads) {
+  std::ofstream conf(conf_dir + "/cyber.pb.conf");
+  conf << "scheduler_conf { routine_num: " << connections + 16
+       << " default_proc_num: " << std::thread::hardware_concurrency()
+       << " }\n"
+       << "io_conf { persistent_poll: "
+       << (mode == "persistent" ? "true" : "false")
+       << " poller_threads: " << poller_threads << " poll_batch_size: 128"
+       << " backend: " << (mode == "uring" ? "IO_URING" : "EPOLL") << " }\n";
+  return conf.good();
+}
+
+int main(int argc, char* argv[]) {
+  int connections = argc > 1 ? std::atoi(argv[1]) : 10000;
+  int seconds = argc > 2 ? std::atoi(argv[2]) : 10;
+  std::string mode = argc > 3 ? argv[3] : "persistent";
+  int poller_threads = argc > 4 ? std::atoi(argv[4]) : 1;
+  if (connections <= 0 || seconds <= 0 || poller_threads <= 0 ||
+      (mode != "oneshot" && mode != "persistent" && mode != "uring")) {
+    std::cout << "Usage: " << argv[0]
+              << " [connections] [seconds] [oneshot|persistent|uring]"
+                 " [poller threads]"
+              << std::endl;
+    return -1;
+  }
+
+  struct rlimit limit;
+  getrlimit(RLIMIT_NOFILE, &limit);
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+  rlim_t needed = static_cast<rlim_t>(connections) * 2 + 256;
+  if (limit.rlim_cur < needed) {
+    std::cout << "need " << needed << " file descriptors, limit is "
+              << limit.rlim_cur << std::endl;
+    return -1;
+  }
+
+  char work_root[] = "/tmp/tcp_echo_benchmark_XXXXXX";
+  if (mkdtemp(work_root) == nullptr) {
+    return -1;
+  }
+  std::string conf_dir = std::string(work_root) + "/conf";
+  apollo::cyber::common::EnsureDirectory(conf_dir);
+  if (!WriteConf(conf_dir, connections, mode, poller_threads)) {
+    return -1;
+  }
+  setenv("CYBER_PATH", work_root, 1);
+  apollo::cyber::Init(argv[0]);
+
+  apollo::cyber::scheduler::Instance()->CreateTask(
+      std::bind(Acceptor, connections), "echo_acceptor");
+  // give the acceptor time to listen
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(kPort);
+  std::vector<std::vector<Connection>> conns(kClientThreads);
+  uint64_t connect_begin = Time::MonoTime().ToNanosecond();
+  for (int i = 0; i < connections; ++i) {
+    Connection conn;
+    conn.fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(conn.fd, reinterpret_cast<struct sockaddr*>(&addr),
+                sizeof(addr)) < 0) {
+      std::cout << "connect " << i << " failed: " << std::strerror(errno)
+                << std::endl;
+      close(conn.fd);
+      break;
+    }
+    int nodelay = 1;
+    setsockopt(conn.fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    conns[i % kClientThreads].push_back(conn);
+  }
+  uint64_t connect_ns = Time::MonoTime().ToNanosecond() - connect_begin;
+  size_t established = conns[0].size() + conns[1].size();
+  std::cout << "established " << established << " connections in "
+            << connect_ns / 1000000 << " ms" << std::endl;
+
+  std::vector<ClientResult> results(kClientThreads);
+  std::vector<std::thread> clients;
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  uint64_t deadline = begin + static_cast<uint64_t>(seconds) * 1000000000UL;
+  for (int i = 0; i < kClientThreads; ++i) {
+    clients.emplace_back(RunClient, &conns[i], deadline, &results[i]);
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  uint64_t elapsed_ns = Time::MonoTime().ToNanosecond() - begin;
+
+  uint64_t round_trips = 0;
+  std::vector<uint32_t> latency_us;
+  for (auto& result : results) {
+    round_trips += result.round_trips;
+    latency_us.insert(latency_us.end(), result.latency_us.begin(),
+                      result.latency_us.end());
+  }
+  std::sort(latency_us.begin(), latency_us.end());
+  std::cout << mode << ", " << poller_threads << " poller thread(s), "
+            << established << " connections: "
+            << round_trips * 1000000000UL / elapsed_ns << " round trips/s";
+  if (!latency_us.empty()) {
+    std::cout << ", p50 " << latency_us[latency_us.size() / 2]
+              << " us, p99 " << latency_us[latency_us.size() * 99 / 100]
+              << " us";
+  }
+  std::cout << std::endl;
+
+  for (auto& thread_conns : conns) {
+    for (auto& conn : thread_conns) {
+      close(conn.fd);
+    }
+  }
+  // let the echo croutines see the hang ups
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  apollo::cyber::common::RemoveAllFiles(conf_dir);
+  rmdir(conf_dir.c_str());
+  apollo::cyber::Clear();
+  rmdir(work_root);
+  return 0;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/service_discovery/specific_manager/channel_manager.h"
+#include "cyber/time/time.h"
+
+// Fills a ChannelManager with one writer and two readers per channel, spread
+// over the nodes of 50 remote processes, then times the topology queries.
+// Usage: topology_benchmark [nodes] [channels] [queries]
+
+using apollo::cyber::Time;
+using apollo::cyber::common::GlobalData;
+using apollo::cyber::proto::RoleAttributes;
+using apollo::cyber::proto::RoleType;
+using apollo::cyber::service_discovery::ChannelManager;
+
+const int kProcesses = 50;
+
+RoleAttributes Role(int node, int channel, int index) {
+  RoleAttributes attr;
+  std::string node_name = "node_" + std::to_string(node);
+  std::string channel_name = "channel_" + std::to_string(channel);
+  attr.set_host_name("topology_benchmark");
+  attr.set_process_id(100000 + node % kProcesses);
+  attr.set_node_name(node_name);
+  attr.set_node_id(GlobalData::RegisterNode(node_name));
+  attr.set_channel_name(channel_name);
+  attr.set_channel_id(GlobalData::RegisterChannel(channel_name));
+  attr.set_id(static_cast<uint64_t>(channel) * 3 + index);
+  attr.set_message_type("apollo.cyber.examples.proto.Chatter");
+  return attr;
+}
+
+// runs op(i) count times
+void Measure(const std::string& name, int count,
+             const std::function<void(int)>& op) {
+  uint64_t begin = Time::MonoTime().ToNanosecond();
+  for (int i = 0; i < count; ++i) {
+    op(i);
+  }
+  uint64_t elapsed_ns = Time::MonoTime().ToNanosecond() - begin;
+  std::cout << name << ": " << count << " in " << elapsed_ns / 1000000
+            << " ms, " << elapsed_ns / 1000 / std::max(count, 1)
+            << " us each" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  int nodes = argc > 1 ? std::atoi(argv[1]) : 5000;
+  int channels = argc > 2 ? std::atoi(argv[2]) : 20000;
+  int queries = argc > 3 ? std::atoi(argv[3]) : 2000;
+  if (nodes <= 0 || channels <= 0 || queries <= 0) {
+    std::cout << "Usage: " << argv[0] << " [nodes] [channels] [queries]"
+              << std::endl;
+    return -1;
+  }
+
+  auto writer = [nodes](int channel) {
+    return Role(channel % nodes, channel, 0);
+  };
+  auto reader = [nodes](int channel, int index) {
+    int node = index == 1 ? (channel * 7 + 1) % nodes
+                          : (channel * 13 + 5) % nodes;
+    return Role(node, channel, index);
+  };
+  auto node_name = [nodes](int i) {
+    return "node_" + std::to_string((i * 7919) % nodes);
+  };
+
+  ChannelManager manager;
+  Measure("join", channels, [&](int channel) {
+    manager.Join(writer(channel), RoleType::ROLE_WRITER);
+    manager.Join(reader(channel, 1), RoleType::ROLE_READER);
+    manager.Join(reader(channel, 2), RoleType::ROLE_READER);
+  });
+
+  ChannelManager::RoleAttrVec roles;
+  Measure("HasWriter", queries, [&](int i) {
+    manager.HasWriter("channel_" + std::to_string((i * 104729) % channels));
+  });
+  Measure("GetWritersOfNode", queries, [&](int i) {
+    roles.clear();
+    manager.GetWritersOfNode(node_name(i), &roles);
+  });
+  Measure("GetReadersOfChannel", queries, [&](int i) {
+    roles.clear();
+    manager.GetReadersOfChannel(
+        "channel_" + std::to_string((i * 104729) % channels), &roles);
+  });
+  Measure("GetUpstreamOfNode", queries, [&](int i) {
+    roles.clear();
+    manager.GetUpstreamOfNode(node_name(i), &roles);
+  });
+  Measure("GetDownstreamOfNode", queries, [&](int i) {
+    roles.clear();
+    manager.GetDownstreamOfNode(node_name(i), &roles);
+  });
+  Measure("GetFlowDirection", queries / 10 + 1, [&](int i) {
+    manager.GetFlowDirection(node_name(i), node_name(i + 1));
+  });
+  Measure("GetChannelNames", 10, [&](int i) {
+    std::vector<std::string> names;
+    manager.GetChannelNames(&names);
+  });
+
+  Measure("leave", channels, [&](int channel) {
+    manager.Leave(writer(channel), RoleType::ROLE_WRITER);
+    manager.Leave(reader(channel, 1), RoleType::ROLE_READER);
+    manager.Leave(reader(channel, 2), RoleType::ROLE_READER);
+  });
+  manager.Shutdown();
+  return 0;
+}
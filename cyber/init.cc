@@ -29,10 +29,15 @@
 #include "cyber/proto/clock.pb.h"
 
 #include "cyber/binary.h"
+#include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/common/global_data.h"
 #include "cyber/data/data_dispatcher.h"
+#include "cyber/event/latency_tracer.h"
+#include "cyber/event/perf_event_cache.h"
+#include "cyber/io/uring.h"
 #include "cyber/logger/async_logger.h"
+#include "cyber/logger/log_module.h"
 #include "cyber/node/node.h"
 #include "cyber/scheduler/scheduler.h"
 #include "cyber/service_discovery/topology_manager.h"
@@ -77,6 +82,14 @@ void InitLogger(const char* binary_name) {
 	async_logger = new ::apollo::cyber::logger::AsyncLogger(google::base::GetLogger(FLAGS_minloglevel));
 	google::base::SetLogger(FLAGS_minloglevel, async_logger);
 	async_logger->Start();
+	// AINFO_F and friends are written undecoded, see cyber_log_decode
+	async_logger->SetBinaryMode(common::GetEnv("cyber_binary_log") == "1");
+
+	const auto& log_conf = common::GlobalData::Instance()->Config().log_conf();
+	logger::SetDefaultLogRateLimit(log_conf.rate_limit());
+	for (const auto& module_conf : log_conf.module_conf()) {
+		logger::SetLogRateLimit(module_conf.name(), module_conf.rate_limit());
+	}
 
 }
 
@@ -142,9 +155,13 @@ void Clear() {
 	SysMo::CleanUp();
 	TaskManager::CleanUp();
 	TimingWheel::CleanUp();
+	// wakes croutines parked on io_uring while the scheduler still runs
+	io::Uring::CleanUp();
 	scheduler::CleanUp();
 	service_discovery::TopologyManager::CleanUp();
 	transport::Transport::CleanUp();
+	event::PerfEventCache::CleanUp();
+	event::LatencyTracer::CleanUp();
 	StopLogger();
 	SetState(STATE_SHUTDOWN);
 }
@@ -30,6 +30,13 @@ using croutine::RoutineState;
 PollHandler::PollHandler(int fd)
 	: fd_(fd), is_read_(false), is_blocking_(false), routine_(nullptr) {}
 
+PollHandler::~PollHandler() {
+	// the poller must not call back into a destroyed handler
+	if (is_watched_) {
+		Poller::Instance()->Unwatch(fd_);
+	}
+}
+
 bool PollHandler::Block(int timeout_ms, bool is_read) {
 	if (!Check(timeout_ms)) {
 		return false;
@@ -40,13 +47,23 @@ bool PollHandler::Block(int timeout_ms, bool is_read) {
 		return false;
 	}
 
+	if (Poller::Instance()->persistent()) {
+		bool result = BlockWatched(timeout_ms, is_read);
+		is_blocking_.store(false);
+		return result;
+	}
+
 	Fill(timeout_ms, is_read);
+	// IO_WAIT before registering, a response arriving ahead of the yield
+	// would otherwise find the routine running and never wake it
+	routine_->set_state(RoutineState::IO_WAIT);
 	if (!Poller::Instance()->Register(request_)) {
+		routine_->set_state(RoutineState::READY);
 		is_blocking_.store(false);
 		return false;
 	}
 
-	routine_->Yield(RoutineState::IO_WAIT);
+	CRoutine::Yield();
 
 	bool result = false;
 	uint32_t target_events = is_read ? EPOLLIN : EPOLLOUT;
@@ -60,9 +77,78 @@ bool PollHandler::Block(int timeout_ms, bool is_read) {
 
 bool PollHandler::Unblock() {
 	is_blocking_.store(false);
+	if (is_watched_) {
+		is_watched_ = false;
+		request_.events = 0;
+		ready_events_.store(0);
+		return Poller::Instance()->Unwatch(fd_);
+	}
+	if (request_.callback == nullptr) {
+		// never blocked, nothing registered
+		return true;
+	}
 	return Poller::Instance()->Unregister(request_);
 }
 
+bool PollHandler::BlockWatched(int timeout_ms, bool is_read) {
+	is_read_.store(is_read);
+	uint32_t target_events = is_read ? EPOLLIN : EPOLLOUT;
+	// most sockets never fill their send buffer, EPOLLOUT is only watched
+	// from the first write that has to wait, it would wake the poller on
+	// every ack otherwise
+	if (!is_watched_ || (request_.events & target_events) == 0) {
+		request_.fd = fd_;
+		request_.events |= EPOLLIN | EPOLLRDHUP | EPOLLET | target_events;
+		request_.timeout_ms = -1;
+		request_.callback = std::bind(&PollHandler::WatchCallback, this, std::placeholders::_1);
+		if (!Poller::Instance()->Watch(request_)) {
+			return false;
+		}
+		is_watched_ = true;
+	}
+
+	// IO_WAIT before looking at the edges, so one arriving in between still
+	// wakes the routine once it yields
+	routine_->set_state(RoutineState::IO_WAIT);
+	if (ready_events_.fetch_and(~target_events) & target_events) {
+		routine_->set_state(RoutineState::READY);
+		return true;
+	}
+
+	if (timeout_ms > 0) {
+		Poller::Instance()->SetTimeout(fd_, timeout_ms);
+	}
+	CRoutine::Yield();
+	if (timeout_ms > 0) {
+		Poller::Instance()->CancelTimeout(fd_);
+	}
+	return ready_events_.fetch_and(~target_events) & target_events;
+}
+
+void PollHandler::WatchCallback(const PollResponse& rsp) {
+	uint32_t events = rsp.events;
+	// errors and hang ups are reported by the next read or write
+	if (events & (EPOLLERR | EPOLLHUP)) {
+		events |= EPOLLIN | EPOLLOUT;
+	}
+	if (events & EPOLLRDHUP) {
+		events |= EPOLLIN;
+	}
+	ready_events_.fetch_or(events & (EPOLLIN | EPOLLOUT));
+
+	if (!is_blocking_.load() || routine_ == nullptr) {
+		return;
+	}
+	uint32_t target_events = is_read_.load() ? EPOLLIN : EPOLLOUT;
+	// no events means the timeout expired
+	if ((events & target_events) == 0 && rsp.events != 0) {
+		return;
+	}
+	if (routine_->state() == RoutineState::IO_WAIT) {
+		Poller::NotifyTask(routine_->id());
+	}
+}
+
 bool PollHandler::Check(int timeout_ms) {
 	if (timeout_ms == 0) {
 		AINFO << "timeout[" << timeout_ms << "] must be larger than zero or less than zero.";
@@ -105,7 +191,7 @@ void PollHandler::ResponseCallback(const PollResponse& rsp) {
 	response_ = rsp;
 
 	if (routine_->state() == RoutineState::IO_WAIT) {
-		scheduler::Instance()->NotifyTask(routine_->id());
+		Poller::NotifyTask(routine_->id());
 	}
 }
 
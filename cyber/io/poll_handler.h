@@ -30,7 +30,7 @@ namespace io {
 class PollHandler {
 public:
 	explicit PollHandler(int fd);
-	virtual ~PollHandler() = default;
+	virtual ~PollHandler();
 
 	bool Block(int timeout_ms, bool is_read);
 	bool Unblock();
@@ -43,12 +43,20 @@ private:
 	void Fill(int timeout_ms, bool is_read);
 	void ResponseCallback(const PollResponse& rsp);
 
+	// persistent mode, the fd is watched from the first block until Unblock
+	bool BlockWatched(int timeout_ms, bool is_read);
+	void WatchCallback(const PollResponse& rsp);
+
 	int fd_;
 	PollRequest request_;
 	PollResponse response_;
 	std::atomic<bool> is_read_;
 	std::atomic<bool> is_blocking_;
 	croutine::CRoutine* routine_;
+
+	bool is_watched_ = false;
+	// readiness reported by edges not consumed by a block yet
+	std::atomic<uint32_t> ready_events_ = {0};
 };
 
 }  // namespace io
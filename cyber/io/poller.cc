@@ -18,11 +18,14 @@
 
 #include <fcntl.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <csignal>
 #include <cstring>
 
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/time/time.h"
@@ -34,33 +37,120 @@ namespace io {
 using base::AtomicRWLock;
 using base::ReadLockGuard;
 using base::WriteLockGuard;
+using common::GlobalData;
+
+namespace {
+
+// wakeups collected while a poller thread runs the callbacks of a batch
+thread_local std::vector<uint64_t>* pending_notifies = nullptr;
+
+}  // namespace
+
+// One epoll instance and its thread, owning the fds hashed to it.
+class Poller::Shard {
+public:
+	explicit Shard(uint32_t batch_size) : events_(batch_size) {}
+	~Shard() { Stop(); }
+
+	bool Init();
+	void Stop();
+
+	bool Register(const PollRequest& req);
+	bool Unregister(const PollRequest& req);
+	bool Watch(const PollRequest& req);
+	bool Unwatch(int fd);
+	void SetTimeout(int fd, int timeout_ms);
+	void CancelTimeout(int fd);
+
+private:
+	void Poll(int timeout_ms);
+	void ThreadFunc();
+	void HandleChanges();
+	void HandleDeadlines();
+	int GetTimeoutMs();
+	void Notify();
+
+	int epoll_fd_ = -1;
+	int event_fd_ = -1;
+	std::thread thread_;
+	std::atomic<bool> is_shutdown_ = {true};
+	std::atomic<bool> wakeup_pending_ = {false};
+	std::vector<epoll_event> events_;
+
+	RequestMap requests_;
+	CtrlParamMap ctrl_params_;
+	AtomicRWLock poll_data_lock_;
+
+	RequestMap watches_;
+	AtomicRWLock watch_lock_;
+
+	// monotonic deadlines of watched fds, in ns
+	std::mutex deadline_mutex_;
+	std::unordered_map<int, uint64_t> deadlines_;
+
+	const int kPollTimeoutMs = 100;
+};
+
+bool Poller::Shard::Init() {
+	epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll_fd_ < 0) {
+		AERROR << "epoll create failed, " << strerror(errno);
+		return false;
+	}
 
-Poller::Poller() {
-	if (!Init()) {
-		AERROR << "Poller init failed!";
-		Clear();
+	event_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (event_fd_ < 0) {
+		AERROR << "create eventfd failed, " << strerror(errno);
+		return false;
 	}
+
+	epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.fd = event_fd_;
+	if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, event_fd_, &event) != 0) {
+		AERROR << "epoll ctl failed, " << strerror(errno);
+		return false;
+	}
+
+	is_shutdown_.store(false);
+	thread_ = std::thread(&Poller::Shard::ThreadFunc, this);
+	scheduler::Instance()->SetInnerThreadAttr("io_poller", &thread_);
+	return true;
 }
 
-Poller::~Poller() { Shutdown(); }
+void Poller::Shard::Stop() {
+	is_shutdown_.store(true);
+	if (thread_.joinable()) {
+		Notify();
+		thread_.join();
+	}
 
-void Poller::Shutdown() {
-	if (is_shutdown_.exchange(true)) {
-		return;
+	if (epoll_fd_ >= 0) {
+		close(epoll_fd_);
+		epoll_fd_ = -1;
 	}
-	Clear();
-}
 
-bool Poller::Register(const PollRequest& req) {
-	if (is_shutdown_.load()) {
-		return false;
+	if (event_fd_ >= 0) {
+		close(event_fd_);
+		event_fd_ = -1;
 	}
 
-	if (req.fd < 0 || req.callback == nullptr) {
-		AERROR << "input is invalid";
-		return false;
+	{
+		WriteLockGuard<AtomicRWLock> lck(poll_data_lock_);
+		requests_.clear();
+		ctrl_params_.clear();
 	}
+	{
+		WriteLockGuard<AtomicRWLock> lck(watch_lock_);
+		watches_.clear();
+	}
+	{
+		std::lock_guard<std::mutex> lck(deadline_mutex_);
+		deadlines_.clear();
+	}
+}
 
+bool Poller::Shard::Register(const PollRequest& req) {
 	PollCtrlParam ctrl_param{};
 	ctrl_param.fd = req.fd;
 	ctrl_param.event.data.fd = req.fd;
@@ -82,16 +172,7 @@ bool Poller::Register(const PollRequest& req) {
 	return true;
 }
 
-bool Poller::Unregister(const PollRequest& req) {
-	if (is_shutdown_.load()) {
-		return false;
-	}
-
-	if (req.fd < 0 || req.callback == nullptr) {
-		AERROR << "input is invalid";
-		return false;
-	}
-
+bool Poller::Shard::Unregister(const PollRequest& req) {
 	{
 		WriteLockGuard<AtomicRWLock> lck(poll_data_lock_);
 		auto size = requests_.erase(req.fd);
@@ -110,83 +191,54 @@ bool Poller::Unregister(const PollRequest& req) {
 	return true;
 }
 
-bool Poller::Init() {
-	epoll_fd_ = epoll_create(kPollSize);
-	if (epoll_fd_ < 0) {
-		AERROR << "epoll create failed, " << strerror(errno);
+bool Poller::Shard::Watch(const PollRequest& req) {
+	epoll_event event{};
+	event.events = req.events;
+	event.data.fd = req.fd;
+
+	WriteLockGuard<AtomicRWLock> lck(watch_lock_);
+	auto search = watches_.find(req.fd);
+	int operation = search == watches_.end() ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+	// epoll_ctl is safe against a concurrent epoll_wait, no wakeup needed
+	if (epoll_ctl(epoll_fd_, operation, req.fd, &event) != 0) {
+		AERROR << "epoll ctl failed, fd: " << req.fd << ", " << strerror(errno);
 		return false;
 	}
+	watches_[req.fd] = std::make_shared<PollRequest>(req);
+	return true;
+}
 
-	// create pipe, and set nonblock
-	if (pipe(pipe_fd_) == -1) {
-		AERROR << "create pipe failed, " << strerror(errno);
-		return false;
-	}
-	if (fcntl(pipe_fd_[0], F_SETFL, O_NONBLOCK) == -1) {
-		AERROR << "set nonblock failed, " << strerror(errno);
+bool Poller::Shard::Unwatch(int fd) {
+	CancelTimeout(fd);
+	WriteLockGuard<AtomicRWLock> lck(watch_lock_);
+	if (watches_.erase(fd) == 0) {
 		return false;
 	}
-	if (fcntl(pipe_fd_[1], F_SETFL, O_NONBLOCK) == -1) {
-		AERROR << "set nonblock failed, " << strerror(errno);
-		return false;
+	if (epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr) != 0 && errno != EBADF) {
+		AERROR << "epoll ctl failed, fd: " << fd << ", " << strerror(errno);
 	}
-
-	// add pipe[0] to epoll
-	auto request = std::make_shared<PollRequest>();
-	request->fd = pipe_fd_[0];
-	request->events = EPOLLIN;
-	request->timeout_ms = -1;
-	request->callback = [this](const PollResponse&) {
-		char c = 0;
-		while (read(pipe_fd_[0], &c, 1) > 0) {
-		}
-	};
-	requests_[request->fd] = request;
-
-	PollCtrlParam ctrl_param{};
-	ctrl_param.operation = EPOLL_CTL_ADD;
-	ctrl_param.fd = pipe_fd_[0];
-	ctrl_param.event.data.fd = pipe_fd_[0];
-	ctrl_param.event.events = EPOLLIN;
-	ctrl_params_[ctrl_param.fd] = ctrl_param;
-
-	is_shutdown_.store(false);
-	thread_ = std::thread(&Poller::ThreadFunc, this);
-	scheduler::Instance()->SetInnerThreadAttr("io_poller", &thread_);
 	return true;
 }
 
-void Poller::Clear() {
-	if (thread_.joinable()) {
-		thread_.join();
-	}
-
-	if (epoll_fd_ >= 0) {
-		close(epoll_fd_);
-		epoll_fd_ = -1;
-	}
-
-	if (pipe_fd_[0] >= 0) {
-		close(pipe_fd_[0]);
-		pipe_fd_[0] = -1;
-	}
-
-	if (pipe_fd_[1] >= 0) {
-		close(pipe_fd_[1]);
-		pipe_fd_[1] = -1;
-	}
-
+void Poller::Shard::SetTimeout(int fd, int timeout_ms) {
+	uint64_t deadline = Time::MonoTime().ToNanosecond() + static_cast<uint64_t>(timeout_ms) * 1000000;
 	{
-		WriteLockGuard<AtomicRWLock> lck(poll_data_lock_);
-		requests_.clear();
-		ctrl_params_.clear();
+		std::lock_guard<std::mutex> lck(deadline_mutex_);
+		deadlines_[fd] = deadline;
 	}
+	// the thread may sleep past the new deadline
+	Notify();
+}
+
+void Poller::Shard::CancelTimeout(int fd) {
+	std::lock_guard<std::mutex> lck(deadline_mutex_);
+	deadlines_.erase(fd);
 }
 
-void Poller::Poll(int timeout_ms) {
-	epoll_event evt[kPollSize];
+void Poller::Shard::Poll(int timeout_ms) {
+	int max_events = static_cast<int>(events_.size());
 	auto before_time_ns = Time::Now().ToNanosecond();
-	int ready_num = epoll_wait(epoll_fd_, evt, kPollSize, timeout_ms);
+	int ready_num = epoll_wait(epoll_fd_, events_.data(), max_events, timeout_ms);
 	auto after_time_ns = Time::Now().ToNanosecond();
 	int interval_ms =
 		static_cast<int>((after_time_ns - before_time_ns) / 1000000);
@@ -217,12 +269,26 @@ void Poller::Poll(int timeout_ms) {
 		}
 	}
 
-	if (ready_num > 0) {
-		for (int i = 0; i < ready_num; ++i) {
-			int fd = evt[i].data.fd;
-			uint32_t events = evt[i].events;
-			responses[fd] = PollResponse(events);
+	for (int i = 0; i < ready_num; ++i) {
+		int fd = events_[i].data.fd;
+		uint32_t events = events_[i].events;
+		if (fd == event_fd_) {
+			wakeup_pending_.store(false);
+			uint64_t count = 0;
+			while (read(event_fd_, &count, sizeof(count)) > 0) {
+			}
+			continue;
 		}
+
+		{
+			ReadLockGuard<AtomicRWLock> lck(watch_lock_);
+			auto search = watches_.find(fd);
+			if (search != watches_.end()) {
+				search->second->callback(PollResponse(events));
+				continue;
+			}
+		}
+		responses[fd] = PollResponse(events);
 	}
 
 	for (auto& item : responses) {
@@ -237,6 +303,8 @@ void Poller::Poll(int timeout_ms) {
 		}
 	}
 
+	HandleDeadlines();
+
 	if (ready_num < 0) {
 		if (errno != EINTR) {
 			AERROR << "epoll wait failed, " << strerror(errno);
@@ -244,21 +312,55 @@ void Poller::Poll(int timeout_ms) {
 	}
 }
 
-void Poller::ThreadFunc() {
+void Poller::Shard::HandleDeadlines() {
+	std::vector<int> expired;
+	{
+		std::lock_guard<std::mutex> lck(deadline_mutex_);
+		if (deadlines_.empty()) {
+			return;
+		}
+		auto now = Time::MonoTime().ToNanosecond();
+		for (auto iter = deadlines_.begin(); iter != deadlines_.end();) {
+			if (iter->second <= now) {
+				expired.emplace_back(iter->first);
+				iter = deadlines_.erase(iter);
+			} else {
+				++iter;
+			}
+		}
+	}
+
+	ReadLockGuard<AtomicRWLock> lck(watch_lock_);
+	for (int fd : expired) {
+		auto search = watches_.find(fd);
+		if (search != watches_.end()) {
+			search->second->callback(PollResponse());
+		}
+	}
+}
+
+void Poller::Shard::ThreadFunc() {
 	// block all signals in this thread
 	sigset_t signal_set;
 	sigfillset(&signal_set);
 	pthread_sigmask(SIG_BLOCK, &signal_set, nullptr);
 
+	std::vector<uint64_t> notifies;
+	pending_notifies = &notifies;
 	while (!is_shutdown_.load()) {
 		HandleChanges();
 		int timeout_ms = GetTimeoutMs();
 		ADEBUG << "this poll timeout ms: " << timeout_ms;
 		Poll(timeout_ms);
+		if (!notifies.empty()) {
+			scheduler::Instance()->NotifyTasks(notifies);
+			notifies.clear();
+		}
 	}
+	pending_notifies = nullptr;
 }
 
-void Poller::HandleChanges() {
+void Poller::Shard::HandleChanges() {
 	CtrlParamMap local_params;
 	{
 		ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
@@ -280,30 +382,150 @@ void Poller::HandleChanges() {
 }
 
 // min heap can be used to optimize
-int Poller::GetTimeoutMs() {
+int Poller::Shard::GetTimeoutMs() {
 	int timeout_ms = kPollTimeoutMs;
-	ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
-	for (auto& item : requests_) {
-		auto& req = item.second;
-		if (req->timeout_ms >= 0 && req->timeout_ms < timeout_ms) {
-			timeout_ms = req->timeout_ms;
+	{
+		ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
+		for (auto& item : requests_) {
+			auto& req = item.second;
+			if (req->timeout_ms >= 0 && req->timeout_ms < timeout_ms) {
+				timeout_ms = req->timeout_ms;
+			}
+		}
+	}
+
+	std::lock_guard<std::mutex> lck(deadline_mutex_);
+	if (!deadlines_.empty()) {
+		auto now = Time::MonoTime().ToNanosecond();
+		for (auto& item : deadlines_) {
+			if (item.second <= now) {
+				return 0;
+			}
+			// round up, waking early would spin until the deadline
+			int left_ms = static_cast<int>((item.second - now + 999999) / 1000000);
+			timeout_ms = std::min(timeout_ms, left_ms);
 		}
 	}
 	return timeout_ms;
 }
 
-void Poller::Notify() {
-	std::unique_lock<std::mutex> lock(pipe_mutex_, std::try_to_lock);
-	if (!lock.owns_lock()) {
+void Poller::Shard::Notify() {
+	if (wakeup_pending_.exchange(true)) {
 		return;
 	}
 
-	char msg = 'C';
-	if (write(pipe_fd_[1], &msg, 1) < 0) {
+	uint64_t count = 1;
+	if (write(event_fd_, &count, sizeof(count)) < 0) {
 		AWARN << "notify failed, " << strerror(errno);
 	}
 }
 
+Poller::Poller() {
+	uint32_t thread_num = 1;
+	uint32_t batch_size = 32;
+	auto& global_conf = GlobalData::Instance()->Config();
+	if (global_conf.has_io_conf()) {
+		auto& io_conf = global_conf.io_conf();
+		persistent_ = io_conf.persistent_poll();
+		thread_num = std::max(io_conf.poller_threads(), 1u);
+		batch_size = std::max(io_conf.poll_batch_size(), 1u);
+	}
+
+	for (uint32_t i = 0; i < thread_num; ++i) {
+		shards_.emplace_back(new Shard(batch_size));
+		if (!shards_.back()->Init()) {
+			AERROR << "Poller init failed!";
+			shards_.clear();
+			return;
+		}
+	}
+	is_shutdown_.store(false);
+}
+
+Poller::~Poller() { Shutdown(); }
+
+void Poller::Shutdown() {
+	if (is_shutdown_.exchange(true)) {
+		return;
+	}
+	for (auto& shard : shards_) {
+		shard->Stop();
+	}
+}
+
+Poller::Shard* Poller::GetShard(int fd) const {
+	return shards_[static_cast<size_t>(fd) % shards_.size()].get();
+}
+
+bool Poller::Register(const PollRequest& req) {
+	if (is_shutdown_.load()) {
+		return false;
+	}
+
+	if (req.fd < 0 || req.callback == nullptr) {
+		AERROR << "input is invalid";
+		return false;
+	}
+
+	return GetShard(req.fd)->Register(req);
+}
+
+bool Poller::Unregister(const PollRequest& req) {
+	if (is_shutdown_.load()) {
+		return false;
+	}
+
+	if (req.fd < 0 || req.callback == nullptr) {
+		AERROR << "input is invalid";
+		return false;
+	}
+
+	return GetShard(req.fd)->Unregister(req);
+}
+
+bool Poller::Watch(const PollRequest& req) {
+	if (is_shutdown_.load()) {
+		return false;
+	}
+
+	if (req.fd < 0 || req.callback == nullptr) {
+		AERROR << "input is invalid";
+		return false;
+	}
+
+	return GetShard(req.fd)->Watch(req);
+}
+
+bool Poller::Unwatch(int fd) {
+	if (is_shutdown_.load() || fd < 0) {
+		return false;
+	}
+	return GetShard(fd)->Unwatch(fd);
+}
+
+bool Poller::SetTimeout(int fd, int timeout_ms) {
+	if (is_shutdown_.load() || fd < 0 || timeout_ms < 0) {
+		return false;
+	}
+	GetShard(fd)->SetTimeout(fd, timeout_ms);
+	return true;
+}
+
+void Poller::CancelTimeout(int fd) {
+	if (is_shutdown_.load() || fd < 0) {
+		return;
+	}
+	GetShard(fd)->CancelTimeout(fd);
+}
+
+void Poller::NotifyTask(uint64_t crid) {
+	if (pending_notifies != nullptr) {
+		pending_notifies->emplace_back(crid);
+		return;
+	}
+	scheduler::Instance()->NotifyTask(crid);
+}
+
 }  // namespace io
 }  // namespace cyber
 }  // namespace apollo
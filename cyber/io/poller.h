@@ -43,31 +43,35 @@ public:
 
 	void Shutdown();
 
+	// oneshot request, re-armed by every call
 	bool Register(const PollRequest& req);
 	bool Unregister(const PollRequest& req);
 
+	// Persistent registration: the fd stays in epoll with req.events until
+	// Unwatch, and req.callback runs for every event. A callback running
+	// concurrently with Unwatch is waited for.
+	bool Watch(const PollRequest& req);
+	bool Unwatch(int fd);
+	// runs the callback of a watched fd with no events after timeout_ms,
+	// unless CancelTimeout comes first
+	bool SetTimeout(int fd, int timeout_ms);
+	void CancelTimeout(int fd);
+
+	// whether PollHandler keeps its fd watched instead of re-arming requests
+	bool persistent() const { return persistent_; }
+
+	// Wakes an IO_WAIT croutine. On a poller thread the wakeups are collected
+	// and handed to the scheduler once per batch of events.
+	static void NotifyTask(uint64_t crid);
+
 private:
-	bool Init();
-	void Clear();
-	void Poll(int timeout_ms);
-	void ThreadFunc();
-	void HandleChanges();
-	int GetTimeoutMs();
-	void Notify();
-
-	int epoll_fd_ = -1;
-	std::thread thread_;
-	std::atomic<bool> is_shutdown_ = {true};
-	std::mutex pipe_mutex_;
+	class Shard;
 
-	int pipe_fd_[2] = {-1, -1};
-	
-	RequestMap requests_;
-	CtrlParamMap ctrl_params_;
-	base::AtomicRWLock poll_data_lock_;
+	Shard* GetShard(int fd) const;
 
-	const int kPollSize = 32;
-	const int kPollTimeoutMs = 100;
+	std::vector<std::unique_ptr<Shard>> shards_;
+	std::atomic<bool> is_shutdown_ = {true};
+	bool persistent_ = false;
 
 	DECLARE_SINGLETON(Poller)
 };
@@ -17,11 +17,20 @@
 #include "cyber/io/session.h"
 
 #include "cyber/common/log.h"
+#include "cyber/io/uring.h"
 
 namespace apollo {
 namespace cyber {
 namespace io {
 
+namespace {
+
+bool WouldBlock(ssize_t res) {
+  return res == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+}  // namespace
+
 Session::Session() : Session(-1) {}
 
 Session::Session(int fd) : fd_(fd), poll_handler_(nullptr) {
@@ -51,13 +60,22 @@ int Session::Bind(const struct sockaddr *addr, socklen_t addrlen) {
   return bind(fd_, addr, addrlen);
 }
 
-auto Session::Accept(struct sockaddr *addr, socklen_t *addrlen) -> SessionPtr {
+auto Session::Accept(struct sockaddr *addr, socklen_t *addrlen, int timeout_ms)
+    -> SessionPtr {
   ACHECK(fd_ != -1);
 
   int sock_fd = accept4(fd_, addr, addrlen, SOCK_NONBLOCK);
-  while (sock_fd == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
-    poll_handler_->Block(-1, true);
-    sock_fd = accept4(fd_, addr, addrlen, SOCK_NONBLOCK);
+  if (WouldBlock(sock_fd) && timeout_ms != 0 && Uring::Instance()->enabled()) {
+    sock_fd = Uring::Instance()->Accept(fd_, addr, addrlen, SOCK_NONBLOCK,
+                                        timeout_ms);
+  }
+  while (WouldBlock(sock_fd) && timeout_ms != 0) {
+    if (poll_handler_->Block(timeout_ms, true)) {
+      sock_fd = accept4(fd_, addr, addrlen, SOCK_NONBLOCK);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
   }
 
   if (sock_fd == -1) {
@@ -67,14 +85,21 @@ auto Session::Accept(struct sockaddr *addr, socklen_t *addrlen) -> SessionPtr {
   return std::make_shared<Session>(sock_fd);
 }
 
-int Session::Connect(const struct sockaddr *addr, socklen_t addrlen) {
+int Session::Connect(const struct sockaddr *addr, socklen_t addrlen, int timeout_ms) {
 	ACHECK(fd_ != -1);
 
+	if (Uring::Instance()->enabled()) {
+		return Uring::Instance()->Connect(fd_, addr, addrlen, timeout_ms);
+	}
+
 	int optval;
 	socklen_t optlen = sizeof(optval);
 	int res = connect(fd_, addr, addrlen);
 	if (res == -1 && errno == EINPROGRESS) {
-		poll_handler_->Block(-1, false);
+		if (!poll_handler_->Block(timeout_ms, false)) {
+			errno = ETIMEDOUT;
+			return -1;
+		}
 		getsockopt(fd_, SOL_SOCKET, SO_ERROR, reinterpret_cast<void *>(&optval), &optlen);
 		if (optval == 0) {
 			res = 0;
@@ -89,6 +114,7 @@ int Session::Close() {
   ACHECK(fd_ != -1);
   
   poll_handler_->Unblock();
+  Uring::Instance()->Cancel(fd_);
   int res = close(fd_);
   fd_ = -1;
   return res;
@@ -102,6 +128,9 @@ ssize_t Session::Recv(void *buf, size_t len, int flags, int timeout_ms) {
   if (timeout_ms == 0) {
     return nbytes;
   }
+  if (WouldBlock(nbytes) && Uring::Instance()->enabled()) {
+    return Uring::Instance()->Recv(fd_, buf, len, flags, timeout_ms);
+  }
 
   while (nbytes == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
     if (poll_handler_->Block(timeout_ms, true)) {
@@ -144,6 +173,9 @@ ssize_t Session::Send(const void *buf, size_t len, int flags, int timeout_ms) {
   if (timeout_ms == 0) {
     return nbytes;
   }
+  if (WouldBlock(nbytes) && Uring::Instance()->enabled()) {
+    return Uring::Instance()->Send(fd_, buf, len, flags, timeout_ms);
+  }
 
   while ((nbytes == -1) && (errno == EAGAIN || errno == EWOULDBLOCK)) {
     if (poll_handler_->Block(timeout_ms, false)) {
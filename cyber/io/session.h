@@ -42,13 +42,20 @@ public:
 	int Socket(int domain, int type, int protocol);
 	int Listen(int backlog);
 	int Bind(const struct sockaddr *addr, socklen_t addrlen);
-	SessionPtr Accept(struct sockaddr *addr, socklen_t *addrlen);
-	int Connect(const struct sockaddr *addr, socklen_t addrlen);
+	// timeout_ms < 0 waits until a connection comes in, a timeout fails
+	// with EAGAIN
+	SessionPtr Accept(struct sockaddr *addr, socklen_t *addrlen,
+	int timeout_ms = -1);
+	// a timeout fails with ETIMEDOUT
+	int Connect(const struct sockaddr *addr, socklen_t addrlen,
+	int timeout_ms = -1);
 	int Close();
 
 	// timeout_ms < 0, keep trying until the operation is successfully
 	// timeout_ms == 0, try once
 	// timeout_ms > 0, keep trying while there is still time left
+	// With io_conf.backend IO_URING, Accept/Connect/Recv/Send that would
+	// block are handed to io_uring instead of waiting on the Poller.
 	ssize_t Recv(void *buf, size_t len, int flags, int timeout_ms = -1);
 	ssize_t RecvFrom(void *buf, size_t len, int flags, struct sockaddr *src_addr,
 	socklen_t *addrlen, int timeout_ms = -1);
@@ -19,6 +19,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -29,6 +30,56 @@ namespace apollo {
 namespace cyber {
 namespace io {
 
+TEST(PollerTest, watch) {
+  auto poller = Poller::Instance();
+  ASSERT_NE(poller, nullptr);
+
+  int pipe_fd[2] = {-1, -1};
+  ASSERT_EQ(pipe(pipe_fd), 0);
+  ASSERT_EQ(fcntl(pipe_fd[0], F_SETFL, O_NONBLOCK), 0);
+
+  std::atomic<int> calls = {0};
+  std::atomic<uint32_t> events = {0};
+  PollRequest request;
+  request.fd = pipe_fd[0];
+  request.events = EPOLLIN | EPOLLET;
+  request.callback = [&](const PollResponse& rsp) {
+    events.store(rsp.events);
+    ++calls;
+  };
+  EXPECT_TRUE(poller->Watch(request));
+
+  // stays registered, every write is reported without re-arming
+  char msg = 'C';
+  for (int i = 1; i <= 3; ++i) {
+    ASSERT_EQ(write(pipe_fd[1], &msg, 1), 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(calls.load(), i);
+    EXPECT_NE(events.load() & EPOLLIN, 0);
+  }
+
+  // timeouts report no events, and can be cancelled
+  EXPECT_TRUE(poller->SetTimeout(pipe_fd[0], 30));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(calls.load(), 3);
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  EXPECT_EQ(calls.load(), 4);
+  EXPECT_EQ(events.load(), 0);
+  EXPECT_TRUE(poller->SetTimeout(pipe_fd[0], 30));
+  poller->CancelTimeout(pipe_fd[0]);
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  EXPECT_EQ(calls.load(), 4);
+
+  EXPECT_TRUE(poller->Unwatch(pipe_fd[0]));
+  EXPECT_FALSE(poller->Unwatch(pipe_fd[0]));
+  ASSERT_EQ(write(pipe_fd[1], &msg, 1), 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(calls.load(), 4);
+
+  close(pipe_fd[0]);
+  close(pipe_fd[1]);
+}
+
 TEST(PollerTest, operation) {
   auto poller = Poller::Instance();
   ASSERT_NE(poller, nullptr);
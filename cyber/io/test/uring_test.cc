@@ -0,0 +1,251 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/uring.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/test/test_work_root.h"
+#include "cyber/io/session.h"
+#include "cyber/scheduler/scheduler_factory.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+uint64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct sockaddr_in LoopbackAddr(uint16_t port) {
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  return addr;
+}
+
+// the kernel may lack io_uring or one of the ops, Session then uses epoll
+#define SKIP_IF_URING_DISABLED()                 \
+  if (!Uring::Instance()->enabled()) {           \
+    GTEST_SKIP() << "io_uring is not enabled";   \
+  }
+
+TEST(UringTest, session) {
+  SKIP_IF_URING_DISABLED();
+
+  std::promise<uint16_t> port_promise;
+  auto port_future = port_promise.get_future().share();
+  std::atomic<int> accept_errno = {0};
+  std::atomic<uint64_t> accept_wait_ms = {0};
+  std::atomic<int> recv_errno = {0};
+  std::atomic<int> echoed = {0};
+  std::atomic<bool> peer_closed = {false};
+  std::atomic<int> connect_res = {-1};
+  std::atomic<bool> reply_ok = {false};
+  std::promise<void> server_done;
+  std::promise<void> client_done;
+
+  scheduler::Instance()->CreateTask(
+      [&]() {
+        Session listener;
+        listener.Socket(AF_INET, SOCK_STREAM, 0);
+        auto addr = LoopbackAddr(0);
+        socklen_t len = sizeof(addr);
+        listener.Bind(reinterpret_cast<struct sockaddr*>(&addr), len);
+        listener.Listen(16);
+        getsockname(listener.fd(), reinterpret_cast<struct sockaddr*>(&addr),
+                    &len);
+
+        uint64_t begin = NowMs();
+        if (listener.Accept(nullptr, nullptr, 50) == nullptr) {
+          accept_errno = errno;
+        }
+        accept_wait_ms = NowMs() - begin;
+
+        port_promise.set_value(ntohs(addr.sin_port));
+        auto session = listener.Accept(nullptr, nullptr);
+        if (session != nullptr) {
+          char buf[16];
+          if (session->Recv(buf, sizeof(buf), 0, 50) < 0) {
+            recv_errno = errno;
+          }
+          ssize_t nbytes = session->Recv(buf, sizeof(buf), 0);
+          if (nbytes > 0) {
+            echoed = static_cast<int>(session->Send(buf, nbytes, 0));
+          }
+          peer_closed = session->Recv(buf, sizeof(buf), 0) == 0;
+          session->Close();
+        }
+        listener.Close();
+        server_done.set_value();
+      },
+      "uring_server");
+
+  scheduler::Instance()->CreateTask(
+      [&]() {
+        auto addr = LoopbackAddr(port_future.get());
+        Session session;
+        session.Socket(AF_INET, SOCK_STREAM, 0);
+        connect_res = session.Connect(
+            reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr), 1000);
+        // outlasts the receive timeout of the server
+        char buf[16];
+        session.Recv(buf, sizeof(buf), 0, 100);
+        std::string msg = "hello";
+        session.Send(msg.data(), msg.size(), 0);
+        ssize_t nbytes = session.Recv(buf, sizeof(buf), 0, 1000);
+        reply_ok = nbytes == static_cast<ssize_t>(msg.size()) &&
+                   std::string(buf, nbytes) == msg;
+        session.Close();
+        client_done.set_value();
+      },
+      "uring_client");
+
+  ASSERT_EQ(server_done.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  ASSERT_EQ(client_done.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  EXPECT_EQ(accept_errno.load(), EAGAIN);
+  EXPECT_GE(accept_wait_ms.load(), 45);
+  EXPECT_EQ(connect_res.load(), 0);
+  EXPECT_EQ(recv_errno.load(), EAGAIN);
+  EXPECT_EQ(echoed.load(), 5);
+  EXPECT_TRUE(reply_ok.load());
+  EXPECT_TRUE(peer_closed.load());
+}
+
+TEST(UringTest, connect_refused) {
+  SKIP_IF_URING_DISABLED();
+  // a port nobody listens on
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  auto addr = LoopbackAddr(0);
+  socklen_t len = sizeof(addr);
+  bind(fd, reinterpret_cast<struct sockaddr*>(&addr), len);
+  getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &len);
+
+  std::atomic<int> res = {0};
+  std::atomic<int> error = {0};
+  std::promise<void> done;
+  scheduler::Instance()->CreateTask(
+      [&]() {
+        Session session;
+        session.Socket(AF_INET, SOCK_STREAM, 0);
+        res = session.Connect(reinterpret_cast<struct sockaddr*>(&addr),
+                              sizeof(addr), 1000);
+        error = errno;
+        session.Close();
+        done.set_value();
+      },
+      "uring_refused");
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  EXPECT_EQ(res.load(), -1);
+  EXPECT_EQ(error.load(), ECONNREFUSED);
+  close(fd);
+}
+
+TEST(UringTest, cancel) {
+  SKIP_IF_URING_DISABLED();
+  int fds[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+
+  std::atomic<bool> started = {false};
+  std::atomic<ssize_t> res = {0};
+  std::atomic<int> error = {0};
+  std::promise<void> done;
+  scheduler::Instance()->CreateTask(
+      [&]() {
+        char buf[16];
+        started = true;
+        // a cancel is not a timeout, although one is linked
+        res = Uring::Instance()->Recv(fds[0], buf, sizeof(buf), 0, 1000);
+        error = errno;
+        done.set_value();
+      },
+      "uring_cancel");
+  while (!started) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  Uring::Instance()->Cancel(fds[0]);
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::milliseconds(500)),
+            std::future_status::ready);
+  EXPECT_EQ(res.load(), -1);
+  EXPECT_EQ(error.load(), ECANCELED);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+// shuts the ring down, has to stay the last test
+TEST(UringTest, shutdown) {
+  SKIP_IF_URING_DISABLED();
+  int fds[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+
+  std::atomic<bool> started = {false};
+  std::atomic<ssize_t> res = {0};
+  std::atomic<int> error = {0};
+  std::promise<void> done;
+  scheduler::Instance()->CreateTask(
+      [&]() {
+        char buf[16];
+        started = true;
+        res = Uring::Instance()->Recv(fds[0], buf, sizeof(buf), 0, 0);
+        error = errno;
+        done.set_value();
+      },
+      "uring_shutdown");
+  while (!started) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  Uring::Instance()->Shutdown();
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  EXPECT_EQ(res.load(), -1);
+  EXPECT_EQ(error.load(), ESHUTDOWN);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::common::TestWorkRoot work_root("uring_test");
+  return work_root.RunAllTests(argv[0],
+                               "scheduler_conf { routine_num: 100 "
+                               "default_proc_num: 2 }\n"
+                               "io_conf { backend: IO_URING }\n");
+}
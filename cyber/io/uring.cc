@@ -0,0 +1,528 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/uring.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+#include "cyber/croutine/croutine.h"
+#include "cyber/scheduler/scheduler_factory.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+using common::GlobalData;
+using croutine::CRoutine;
+using croutine::RoutineState;
+
+namespace {
+
+int UringSetup(unsigned entries, struct io_uring_params* params) {
+	return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int UringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+			   unsigned flags) {
+	return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+									min_complete, flags, nullptr, 0));
+}
+
+int UringRegister(int ring_fd, unsigned opcode, void* arg, unsigned nr_args) {
+	return static_cast<int>(
+		syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+ssize_t ToResult(int res) {
+	if (res >= 0) {
+		return res;
+	}
+	errno = -res;
+	return -1;
+}
+
+// user_data of a linked timeout, the completion is at least 8 aligned
+const uint64_t kTimeoutTag = 1;
+
+// how long Shutdown waits for cancelled operations to complete
+const auto kDrainTimeout = std::chrono::milliseconds(100);
+
+}  // namespace
+
+// lives on the stack of the waiting croutine until done is set
+struct Uring::Completion {
+	uint64_t crid = 0;
+	int result = 0;
+	// a linked timeout posts a completion of its own, the croutine may only
+	// return once both are reaped
+	int pending = 1;
+	bool timed_out = false;
+	std::atomic<bool> done = {false};
+};
+
+Uring::Uring() {
+	auto& global_conf = GlobalData::Instance()->Config();
+	if (!global_conf.has_io_conf() ||
+		global_conf.io_conf().backend() != proto::IO_URING) {
+		return;
+	}
+
+	uint32_t entries = std::max(global_conf.io_conf().uring_entries(), 2u);
+	if (!Init(entries) || !Probe()) {
+		AWARN << "io_uring is not available, falling back to epoll.";
+		Release();
+		return;
+	}
+	is_shutdown_.store(false);
+	reaper_ = std::thread(&Uring::Reap, this);
+	enabled_ = true;
+	AINFO << "io_uring backend enabled, sq entries: " << sq_entries_;
+}
+
+Uring::~Uring() { Shutdown(); }
+
+bool Uring::Init(uint32_t entries) {
+	struct io_uring_params params;
+	std::memset(&params, 0, sizeof(params));
+	ring_fd_ = UringSetup(entries, &params);
+	if (ring_fd_ < 0) {
+		AWARN << "io_uring setup failed, " << strerror(errno);
+		return false;
+	}
+	// without NODROP an overflowing completion queue loses wakeups
+	if ((params.features & IORING_FEAT_NODROP) == 0) {
+		AWARN << "io_uring lacks IORING_FEAT_NODROP.";
+		return false;
+	}
+
+	sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	cq_ring_size_ =
+		params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (single_mmap) {
+		sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+		cq_ring_size_ = sq_ring_size_;
+	}
+
+	void* ring = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+					  MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+	if (ring == MAP_FAILED) {
+		AWARN << "io_uring mmap failed, " << strerror(errno);
+		return false;
+	}
+	sq_ring_ = ring;
+	if (single_mmap) {
+		cq_ring_ = sq_ring_;
+	} else {
+		ring = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+					MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+		if (ring == MAP_FAILED) {
+			AWARN << "io_uring mmap failed, " << strerror(errno);
+			return false;
+		}
+		cq_ring_ = ring;
+	}
+	sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+	if (ring == MAP_FAILED) {
+		AWARN << "io_uring mmap failed, " << strerror(errno);
+		return false;
+	}
+	sqes_ = static_cast<struct io_uring_sqe*>(ring);
+
+	auto sq = static_cast<char*>(sq_ring_);
+	sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+	sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+	sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+	sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+	sq_entries_ = params.sq_entries;
+
+	auto cq = static_cast<char*>(cq_ring_);
+	cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+	cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+	cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+	cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+	return true;
+}
+
+bool Uring::Probe() {
+	const unsigned kProbeOps = 256;
+	std::vector<char> buffer(sizeof(struct io_uring_probe) +
+							 kProbeOps * sizeof(struct io_uring_probe_op));
+	auto probe = reinterpret_cast<struct io_uring_probe*>(buffer.data());
+	if (UringRegister(ring_fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+		AWARN << "io_uring probe failed, " << strerror(errno);
+		return false;
+	}
+	for (int op : {IORING_OP_NOP, IORING_OP_ACCEPT, IORING_OP_CONNECT,
+				   IORING_OP_RECV, IORING_OP_SEND, IORING_OP_LINK_TIMEOUT,
+				   IORING_OP_ASYNC_CANCEL}) {
+		if (op > probe->last_op ||
+			(probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+			AWARN << "io_uring op " << op << " is not supported.";
+			return false;
+		}
+	}
+	return true;
+}
+
+void Uring::Release() {
+	std::lock_guard<std::mutex> lck(sq_mutex_);
+	if (sqes_ != nullptr) {
+		munmap(sqes_, sqes_size_);
+		sqes_ = nullptr;
+	}
+	if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+		munmap(cq_ring_, cq_ring_size_);
+	}
+	cq_ring_ = nullptr;
+	if (sq_ring_ != nullptr) {
+		munmap(sq_ring_, sq_ring_size_);
+		sq_ring_ = nullptr;
+	}
+	if (ring_fd_ >= 0) {
+		close(ring_fd_);
+		ring_fd_ = -1;
+	}
+}
+
+void Uring::Shutdown() {
+	if (is_shutdown_.exchange(true)) {
+		return;
+	}
+
+	// croutines parked on pending operations are woken with ESHUTDOWN, a
+	// completion wakes the reaper up to see the flag
+	{
+		std::lock_guard<std::mutex> lck(sq_mutex_);
+		CancelInflight();
+		struct io_uring_sqe sqe;
+		std::memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode = IORING_OP_NOP;
+		if (Reserve(1)) {
+			Push(sqe);
+		}
+		Submit();
+	}
+	if (reaper_.joinable()) {
+		reaper_.join();
+	}
+	Release();
+}
+
+int Uring::Accept(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags,
+				  int timeout_ms) {
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_ACCEPT;
+	sqe.fd = fd;
+	sqe.addr = reinterpret_cast<uint64_t>(addr);
+	sqe.addr2 = reinterpret_cast<uint64_t>(addrlen);
+	sqe.accept_flags = static_cast<uint32_t>(flags);
+	return static_cast<int>(ToResult(Execute(&sqe, timeout_ms, EAGAIN)));
+}
+
+int Uring::Connect(int fd, const struct sockaddr* addr, socklen_t addrlen,
+				   int timeout_ms) {
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_CONNECT;
+	sqe.fd = fd;
+	sqe.addr = reinterpret_cast<uint64_t>(addr);
+	sqe.off = addrlen;
+	return static_cast<int>(ToResult(Execute(&sqe, timeout_ms, ETIMEDOUT)));
+}
+
+ssize_t Uring::Recv(int fd, void* buf, size_t len, int flags, int timeout_ms) {
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_RECV;
+	sqe.fd = fd;
+	sqe.addr = reinterpret_cast<uint64_t>(buf);
+	sqe.len = static_cast<uint32_t>(len);
+	sqe.msg_flags = static_cast<uint32_t>(flags);
+	return ToResult(Execute(&sqe, timeout_ms, EAGAIN));
+}
+
+ssize_t Uring::Send(int fd, const void* buf, size_t len, int flags,
+					int timeout_ms) {
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_SEND;
+	sqe.fd = fd;
+	sqe.addr = reinterpret_cast<uint64_t>(buf);
+	sqe.len = static_cast<uint32_t>(len);
+	sqe.msg_flags = static_cast<uint32_t>(flags);
+	return ToResult(Execute(&sqe, timeout_ms, EAGAIN));
+}
+
+void Uring::Cancel(int fd) {
+	if (!enabled_) {
+		return;
+	}
+
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_ASYNC_CANCEL;
+	sqe.fd = fd;
+	sqe.cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+	std::lock_guard<std::mutex> lck(sq_mutex_);
+	if (!is_shutdown_.load() && Reserve(1)) {
+		Push(sqe);
+		Submit();
+	}
+}
+
+int Uring::Execute(struct io_uring_sqe* sqe, int timeout_ms, int timeout_errno) {
+	auto routine = CRoutine::GetCurrentRoutine();
+	if (routine == nullptr) {
+		AERROR << "routine nullptr, please use IO in routine context.";
+		return -EINVAL;
+	}
+
+	Completion completion;
+	completion.crid = routine->id();
+	sqe->user_data = reinterpret_cast<uint64_t>(&completion);
+
+	struct __kernel_timespec timeout;
+	struct io_uring_sqe timeout_sqe;
+	unsigned count = 1;
+	if (timeout_ms > 0) {
+		sqe->flags |= IOSQE_IO_LINK;
+		timeout.tv_sec = timeout_ms / 1000;
+		timeout.tv_nsec = static_cast<int64_t>(timeout_ms % 1000) * 1000000;
+		std::memset(&timeout_sqe, 0, sizeof(timeout_sqe));
+		timeout_sqe.opcode = IORING_OP_LINK_TIMEOUT;
+		timeout_sqe.fd = -1;
+		timeout_sqe.addr = reinterpret_cast<uint64_t>(&timeout);
+		timeout_sqe.len = 1;
+		timeout_sqe.user_data = reinterpret_cast<uint64_t>(&completion) | kTimeoutTag;
+		completion.pending = 2;
+		count = 2;
+	}
+
+	// IO_WAIT before submitting, the completion may be reaped ahead of the
+	// yield
+	routine->set_state(RoutineState::IO_WAIT);
+	{
+		std::lock_guard<std::mutex> lck(sq_mutex_);
+		if (is_shutdown_.load() || !Reserve(count)) {
+			routine->set_state(RoutineState::READY);
+			return -ESHUTDOWN;
+		}
+		{
+			std::lock_guard<std::mutex> inflight_lck(inflight_mutex_);
+			inflight_.insert(&completion);
+		}
+		Push(*sqe);
+		if (count == 2) {
+			Push(timeout_sqe);
+		}
+		if (!Submit()) {
+			std::lock_guard<std::mutex> inflight_lck(inflight_mutex_);
+			inflight_.erase(&completion);
+			routine->set_state(RoutineState::READY);
+			return -EIO;
+		}
+	}
+
+	CRoutine::Yield();
+	while (!completion.done.load(std::memory_order_acquire)) {
+		routine->set_state(RoutineState::IO_WAIT);
+		if (completion.done.load(std::memory_order_acquire)) {
+			routine->set_state(RoutineState::READY);
+			break;
+		}
+		CRoutine::Yield();
+	}
+	// the linked timeout cancels the operation when it fires
+	if (completion.result == -ECANCELED && completion.timed_out) {
+		return -timeout_errno;
+	}
+	return completion.result;
+}
+
+bool Uring::Reserve(unsigned count) {
+	if (ring_fd_ < 0) {
+		return false;
+	}
+	unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+	if (sq_entries_ - (*sq_tail_ - head) >= count) {
+		return true;
+	}
+	// the kernel consumes every submitted entry before io_uring_enter returns
+	return Submit();
+}
+
+void Uring::Push(const struct io_uring_sqe& sqe) {
+	unsigned tail = *sq_tail_;
+	unsigned index = tail & sq_mask_;
+	sqes_[index] = sqe;
+	sq_array_[index] = index;
+	__atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+	++to_submit_;
+}
+
+bool Uring::Submit() {
+	while (to_submit_ > 0) {
+		int ret = UringEnter(ring_fd_, to_submit_, 0, 0);
+		if (ret >= 0) {
+			to_submit_ -= std::min(static_cast<unsigned>(ret), to_submit_);
+			continue;
+		}
+		if (errno == EINTR) {
+			continue;
+		}
+		// completions overflowing, the reaper frees them
+		if (errno == EAGAIN || errno == EBUSY) {
+			std::this_thread::yield();
+			continue;
+		}
+		AERROR << "io_uring enter failed, " << strerror(errno);
+		// drop what was not taken, nothing may complete into a stale stack
+		__atomic_store_n(sq_tail_, __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE),
+						 __ATOMIC_RELEASE);
+		to_submit_ = 0;
+		return false;
+	}
+	return true;
+}
+
+void Uring::Reap() {
+	// block all signals in this thread
+	sigset_t signal_set;
+	sigfillset(&signal_set);
+	pthread_sigmask(SIG_BLOCK, &signal_set, nullptr);
+
+	std::vector<uint64_t> notifies;
+	bool draining = false;
+	auto drain_deadline = std::chrono::steady_clock::now();
+	while (true) {
+		if (is_shutdown_.load() && !draining) {
+			draining = true;
+			drain_deadline = std::chrono::steady_clock::now() + kDrainTimeout;
+		}
+		if (draining) {
+			std::lock_guard<std::mutex> lck(inflight_mutex_);
+			if (inflight_.empty() || std::chrono::steady_clock::now() > drain_deadline) {
+				break;
+			}
+		}
+		// polls once draining, the cancelled operations may never complete
+		if (UringEnter(ring_fd_, 0, draining ? 0 : 1, IORING_ENTER_GETEVENTS) < 0 &&
+			errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+			AERROR << "io_uring wait failed, " << strerror(errno);
+			break;
+		}
+
+		unsigned head = *cq_head_;
+		unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+		for (; head != tail; ++head) {
+			auto& cqe = cqes_[head & cq_mask_];
+			// cancels and wakeups carry no completion
+			if (cqe.user_data == 0) {
+				continue;
+			}
+			auto completion = reinterpret_cast<Completion*>(cqe.user_data & ~kTimeoutTag);
+			if (cqe.user_data & kTimeoutTag) {
+				completion->timed_out = cqe.res == -ETIME;
+			} else {
+				completion->result = cqe.res;
+				// cancelled by Shutdown
+				if (cqe.res == -ECANCELED && is_shutdown_.load()) {
+					completion->result = -ESHUTDOWN;
+				}
+			}
+			uint64_t crid = completion->crid;
+			if (Complete(completion)) {
+				notifies.emplace_back(crid);
+			}
+		}
+		bool idle = head == *cq_head_;
+		__atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+		if (!notifies.empty()) {
+			scheduler::Instance()->NotifyTasks(notifies);
+			notifies.clear();
+		}
+		if (draining && idle) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	// nothing reaps after this thread, what the kernel did not give back
+	// fails rather than parking its croutine for good
+	{
+		std::lock_guard<std::mutex> lck(inflight_mutex_);
+		for (auto completion : inflight_) {
+			completion->result = -ESHUTDOWN;
+			notifies.emplace_back(completion->crid);
+			completion->done.store(true, std::memory_order_release);
+		}
+		inflight_.clear();
+	}
+	if (!notifies.empty()) {
+		scheduler::Instance()->NotifyTasks(notifies);
+	}
+}
+
+bool Uring::Complete(Completion* completion) {
+	if (--completion->pending > 0) {
+		return false;
+	}
+	{
+		std::lock_guard<std::mutex> lck(inflight_mutex_);
+		inflight_.erase(completion);
+	}
+	// the croutine may return as soon as done is set
+	completion->done.store(true, std::memory_order_release);
+	return true;
+}
+
+void Uring::CancelInflight() {
+	std::vector<Completion*> completions;
+	{
+		std::lock_guard<std::mutex> lck(inflight_mutex_);
+		completions.assign(inflight_.begin(), inflight_.end());
+	}
+	struct io_uring_sqe sqe;
+	std::memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_ASYNC_CANCEL;
+	sqe.fd = -1;
+	for (auto completion : completions) {
+		sqe.addr = reinterpret_cast<uint64_t>(completion);
+		if (!Reserve(1)) {
+			return;
+		}
+		Push(sqe);
+	}
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_URING_H_
+#define CYBER_IO_URING_H_
+
+#include <linux/io_uring.h>
+// from linux/fs.h, clashes with ShmConf::BLOCK_SIZE of the includers
+#undef BLOCK_SIZE
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+// io_uring backend of Session. A croutine queues its operation, yields with
+// IO_WAIT, and is woken by the reaper thread with the result of the
+// operation, so no readiness round trip through epoll and no retried syscall
+// is needed. Chosen by io_conf.backend; enabled() is false when the kernel
+// lacks io_uring or one of the ops, Session then keeps using the Poller.
+//
+// The calls return what the syscall would, -1 with errno set on failure.
+// An operation whose timeout_ms > 0 expired fails with EAGAIN, a connect
+// with ETIMEDOUT, one cancelled by Cancel with ECANCELED and one still
+// pending at Shutdown with ESHUTDOWN. They must be called from a croutine.
+class Uring {
+public:
+	virtual ~Uring();
+
+	void Shutdown();
+
+	bool enabled() const { return enabled_; }
+
+	int Accept(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags,
+			   int timeout_ms);
+	int Connect(int fd, const struct sockaddr* addr, socklen_t addrlen,
+				int timeout_ms);
+	ssize_t Recv(int fd, void* buf, size_t len, int flags, int timeout_ms);
+	ssize_t Send(int fd, const void* buf, size_t len, int flags, int timeout_ms);
+
+	// cancels every operation pending on fd, to be called before closing it
+	void Cancel(int fd);
+
+private:
+	struct Completion;
+
+	bool Init(uint32_t entries);
+	bool Probe();
+	void Release();
+	// -errno on failure, timeout_errno once timeout_ms > 0 expired
+	int Execute(struct io_uring_sqe* sqe, int timeout_ms, int timeout_errno);
+	// the queue is only touched with sq_mutex_ held
+	bool Reserve(unsigned count);
+	void Push(const struct io_uring_sqe& sqe);
+	bool Submit();
+	void Reap();
+	// with sq_mutex_ held
+	void CancelInflight();
+	bool Complete(Completion* completion);
+
+	int ring_fd_ = -1;
+	void* sq_ring_ = nullptr;
+	void* cq_ring_ = nullptr;
+	size_t sq_ring_size_ = 0;
+	size_t cq_ring_size_ = 0;
+	struct io_uring_sqe* sqes_ = nullptr;
+	size_t sqes_size_ = 0;
+
+	unsigned* sq_head_ = nullptr;
+	unsigned* sq_tail_ = nullptr;
+	unsigned* sq_array_ = nullptr;
+	unsigned sq_mask_ = 0;
+	unsigned sq_entries_ = 0;
+	unsigned to_submit_ = 0;
+
+	unsigned* cq_head_ = nullptr;
+	unsigned* cq_tail_ = nullptr;
+	unsigned cq_mask_ = 0;
+	struct io_uring_cqe* cqes_ = nullptr;
+
+	// croutines on every processor submit through the one queue
+	std::mutex sq_mutex_;
+	std::thread reaper_;
+	// operations submitted and not completed yet, for Shutdown
+	std::mutex inflight_mutex_;
+	std::unordered_set<Completion*> inflight_;
+	std::atomic<bool> is_shutdown_ = {true};
+	bool enabled_ = false;
+
+	DECLARE_SINGLETON(Uring)
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_URING_H_
@@ -17,34 +17,88 @@
 #include "cyber/logger/async_logger.h"
 
 #include <stdlib.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <thread>
-#include <unordered_map>
+#include <utility>
 
 #include "cyber/base/macros.h"
+#include "cyber/binary.h"
+#include "cyber/common/log.h"
+#include "cyber/logger/binary_log.h"
 #include "cyber/logger/log_file_object.h"
+#include "cyber/logger/log_module.h"
 #include "cyber/logger/logger_util.h"
 
 namespace apollo {
 namespace cyber {
 namespace logger {
 
-static std::unordered_map<std::string, LogFileObject*> moduleLoggerMap;
-static std::unordered_map<char, int> log_level_map = {
-    {'F', 3}, {'E', 2}, {'W', 1}, {'I', 0}
+const uint32_t AsyncLogger::kDefaultRingSize;
+const uint32_t AsyncLogger::kMaxWriteIntervalMs;
+const uint32_t AsyncLogger::kFullRetries;
+
+struct AsyncLogger::EntryHeader {
+	// seconds for text, nanoseconds for binary messages
+	int64_t timestamp;
+	// 0 for text messages
+	uint32_t format_id;
+	// 0 when the module has to be parsed from the text
+	uint32_t module_id;
+	int32_t level;
+	int32_t tid;
+	bool force_flush;
+};
+
+struct AsyncLogger::ThreadRing {
+	explicit ThreadRing(uint32_t size) : ring(size) {}
+	LogRing ring;
+	// set when the owning thread exits, the ring goes once drained
+	std::atomic<bool> closed = {false};
 };
 
-AsyncLogger::AsyncLogger(google::base::Logger* wrapped) : wrapped_(wrapped) {
-	active_buf_.reset(new std::deque<Msg>());
-	flushing_buf_.reset(new std::deque<Msg>());
+namespace {
+
+std::atomic<uint64_t> next_logger_id = {1};
+
+int32_t CurrentTid() {
+	static thread_local int32_t tid = static_cast<int32_t>(syscall(SYS_gettid));
+	return tid;
+}
+
+template <typename T>
+void WriteValue(FILE* file, const T& value) {
+	fwrite(&value, sizeof(value), 1, file);
+}
+
+void WriteString(FILE* file, const std::string& value) {
+	WriteValue(file, static_cast<uint32_t>(value.size()));
+	fwrite(value.data(), 1, value.size(), file);
+}
+
+}  // namespace
+
+AsyncLogger::AsyncLogger(google::base::Logger* wrapped, uint32_t ring_size, uint32_t full_retries)
+		: wrapped_(wrapped), ring_size_(ring_size), full_retries_(full_retries),
+		id_(next_logger_id.fetch_add(1)) {
+	orphan_ring_ = std::make_shared<ThreadRing>(ring_size_);
+	rings_.push_back(orphan_ring_);
 }
 
 AsyncLogger::~AsyncLogger() {
-	for (auto& logger : moduleLoggerMap) {
-		if(logger.second != nullptr) //lubin if log file was not created,and do not delete to cause segment fault
-			delete logger.second;
+	if (state_.load(std::memory_order_acquire) == RUNNING) {
+		Stop();
+	}
+	SetBinaryMode(false);
+	if (binary_file_ != nullptr) {
+		fclose(binary_file_);
 	}
-	moduleLoggerMap.clear();
 }
 
 void AsyncLogger::Start() {
@@ -55,78 +109,412 @@ void AsyncLogger::Start() {
 
 void AsyncLogger::Stop() {
 	CHECK_EQ(state_.load(std::memory_order_acquire), RUNNING);
-	state_.store(STOPPED, std::memory_order_release);
+	SetBinaryMode(false);
+	{
+		std::lock_guard<std::mutex> lock(wake_mutex_);
+		state_.store(STOPPED, std::memory_order_release);
+	}
+	wake_cv_.notify_one();
 	if (log_thread_.joinable()) {
 		log_thread_.join();
 	}
+	flush_cv_.notify_all();
+}
 
-	FlushBuffer(active_buf_);
-	CHECK(active_buf_->empty());
-	CHECK(flushing_buf_->empty());
+void AsyncLogger::SetBinaryMode(bool enable) {
+	binary_mode_.store(enable);
+	SetBinaryLogSink(enable ? this : nullptr);
+}
+
+AsyncLogger::ThreadRing* AsyncLogger::GetThreadRing() {
+	static thread_local bool destroyed = false;
+	// the rings of this thread, one per logger it wrote to
+	struct Cache {
+		std::vector<std::pair<uint64_t, std::shared_ptr<ThreadRing>>> rings;
+		~Cache() {
+			for (auto& ring : rings) {
+				ring.second->closed.store(true, std::memory_order_release);
+			}
+			destroyed = true;
+		}
+	};
+	if (cyber_unlikely(destroyed)) {
+		return nullptr;
+	}
+	static thread_local Cache cache;
+	for (auto& ring : cache.rings) {
+		if (ring.first == id_) {
+			return ring.second.get();
+		}
+	}
+	auto ring = std::make_shared<ThreadRing>(ring_size_);
+	cache.rings.emplace_back(id_, ring);
+	std::lock_guard<std::mutex> lock(rings_mutex_);
+	rings_.push_back(ring);
+	rings_version_.fetch_add(1);
+	return ring.get();
 }
 
 void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message, int message_len) {
-	(void)force_flush;
 	if (cyber_unlikely(state_.load(std::memory_order_acquire) != RUNNING)) {
-		// std::cout << "Async Logger not running!" << std::endl;
 		return;
 	}
-	auto msg_str = std::string(message, message_len);
-	while (flag_.test_and_set(std::memory_order_acquire)) {
-		cpu_relax();
+	EntryHeader header;
+	header.timestamp = timestamp;
+	header.format_id = 0;
+	switch (message[0]) {
+		case 'W':
+			header.level = google::WARNING;
+			break;
+		case 'E':
+			header.level = google::ERROR;
+			break;
+		case 'F':
+			header.level = google::FATAL;
+			break;
+		default:
+			header.level = google::INFO;
+			break;
+	}
+	header.tid = 0;
+	header.force_flush = force_flush || header.level > google::INFO;
+	header.module_id = 0;
+	uint32_t size = static_cast<uint32_t>(message_len);
+	const char* tail = nullptr;
+	uint32_t tail_size = 0;
+	// the [module] prefix is left out instead of being parsed by the writer
+	LogModuleMark mark;
+	if (TakeLogModuleMark(&mark) && mark.offset + mark.length <= size &&
+			message[mark.offset] == '[') {
+		header.module_id = mark.id;
+		tail = message + mark.offset + mark.length;
+		tail_size = size - mark.offset - mark.length;
+		size = mark.offset;
 	}
-	active_buf_->emplace_back(timestamp, std::move(msg_str), log_level_map[message[0]]);
-	flag_.clear(std::memory_order_release);
+	Append(header, message, size, tail, tail_size, header.force_flush);
+}
+
+void AsyncLogger::WriteBinary(uint32_t format_id, int severity, const char* args, uint32_t size) {
+	if (cyber_unlikely(state_.load(std::memory_order_acquire) != RUNNING)) {
+		return;
+	}
+	EntryHeader header;
+	header.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+	header.format_id = format_id;
+	header.level = severity;
+	header.tid = CurrentTid();
+	header.force_flush = severity > google::INFO;
+	header.module_id = 0;
+	Append(header, args, size, nullptr, 0, header.force_flush);
+}
+
+void AsyncLogger::Append(const EntryHeader& header, const char* data, uint32_t size,
+		const char* tail, uint32_t tail_size, bool urgent) {
+	ThreadRing* thread_ring = GetThreadRing();
+	std::unique_lock<std::mutex> orphan_lock(orphan_mutex_, std::defer_lock);
+	if (cyber_unlikely(thread_ring == nullptr)) {
+		orphan_lock.lock();
+		thread_ring = orphan_ring_.get();
+	}
+	LogRing& ring = thread_ring->ring;
+	// an oversized message is cut rather than lost
+	uint32_t max_size = ring.MaxRecordSize() - static_cast<uint32_t>(sizeof(header));
+	size = std::min(size, max_size);
+	tail_size = std::min(tail_size, max_size - size);
+	uint32_t entry_size = static_cast<uint32_t>(sizeof(header)) + size + tail_size;
+	char* entry = ring.Reserve(entry_size);
+	// give the logger thread a few chances to catch up before dropping
+	for (uint32_t i = 0; entry == nullptr && i < full_retries_; ++i) {
+		Wake();
+		std::this_thread::yield();
+		entry = ring.Reserve(entry_size);
+	}
+	if (cyber_unlikely(entry == nullptr)) {
+		dropped_.fetch_add(1, std::memory_order_relaxed);
+		AddLogModuleDropped(header.module_id);
+		Wake();
+		return;
+	}
+	std::memcpy(entry, &header, sizeof(header));
+	std::memcpy(entry + sizeof(header), data, size);
+	if (tail_size > 0) {
+		std::memcpy(entry + sizeof(header) + size, tail, tail_size);
+	}
+	ring.Commit();
+	if (urgent || ring.Used() >= ring.Capacity() / 4) {
+		Wake();
+	}
+}
+
+void AsyncLogger::Wake() {
+	if (wake_pending_.exchange(true)) {
+		return;
+	}
+	// pairs with the store of writer_sleeping_ before the pending check
+	if (writer_sleeping_.load()) {
+		std::lock_guard<std::mutex> lock(wake_mutex_);
+		wake_cv_.notify_one();
+	}
+}
+
+void AsyncLogger::WaitForWork() {
+	std::unique_lock<std::mutex> lock(wake_mutex_);
+	writer_sleeping_.store(true);
+	wake_cv_.wait_for(lock, std::chrono::milliseconds(kMaxWriteIntervalMs), [this]() {
+		return wake_pending_.load() || state_.load() != RUNNING;
+	});
+	writer_sleeping_.store(false);
+	wake_pending_.store(false);
 }
 
 void AsyncLogger::Flush() {
-	for (auto& module_logger : moduleLoggerMap) {
-		module_logger.second->Flush();
+	if (state_.load(std::memory_order_acquire) != RUNNING) {
+		return;
 	}
+	if (std::this_thread::get_id() == log_thread_.get_id()) {
+		FlushFiles();
+		return;
+	}
+	uint64_t target = flush_requested_.fetch_add(1) + 1;
+	Wake();
+	std::unique_lock<std::mutex> lock(flush_mutex_);
+	flush_cv_.wait_for(lock, std::chrono::seconds(1), [this, target]() {
+		return flush_done_ >= target || state_.load() != RUNNING;
+	});
 }
 
 uint32_t AsyncLogger::LogSize() { return wrapped_->LogSize(); }
 
 void AsyncLogger::RunThread() {
-	while (state_ == RUNNING) {
-		while (flag_.test_and_set(std::memory_order_acquire)) {
-			cpu_relax();
-		}
-		active_buf_.swap(flushing_buf_);
-		flag_.clear(std::memory_order_release);
-		FlushBuffer(flushing_buf_);
-		if (active_buf_->size() < 800) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	while (state_.load(std::memory_order_acquire) == RUNNING) {
+		uint64_t requested = flush_requested_.load();
+		WriteRings();
+		FlushFiles();
+		if (requested > 0) {
+			std::lock_guard<std::mutex> lock(flush_mutex_);
+			flush_done_ = requested;
 		}
+		flush_cv_.notify_all();
+		WaitForWork();
 	}
+	WriteRings();
+	FlushFiles();
 }
 
-void AsyncLogger::FlushBuffer(const std::unique_ptr<std::deque<Msg>>& buffer) {
-	std::string module_name = "";
-	while (!buffer->empty()) {
-		auto& msg = buffer->front();
-		FindModuleName(&(msg.message), &module_name);
-
-		LogFileObject* fileobject = nullptr;
-		if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
-			fileobject = moduleLoggerMap[module_name];
-		} else {
-			std::string file_name = module_name + ".log.INFO.";
-			if (!FLAGS_log_dir.empty()) {
-				file_name = FLAGS_log_dir + "/" + file_name;
+void AsyncLogger::WriteRings() {
+	uint64_t version = rings_version_.load();
+	if (version != writer_rings_version_) {
+		std::lock_guard<std::mutex> lock(rings_mutex_);
+		writer_rings_ = rings_;
+		writer_rings_version_ = version;
+	}
+	bool has_closed = false;
+	for (auto& thread_ring : writer_rings_) {
+		// whatever a closed ring holds was committed before it was closed
+		bool closed = thread_ring->closed.load(std::memory_order_acquire);
+		LogRing& ring = thread_ring->ring;
+		// bounded so that a busy thread can not starve the others
+		uint64_t budget = ring.Capacity();
+		uint32_t size = 0;
+		const char* record = nullptr;
+		while (budget > 0 && (record = ring.Front(&size)) != nullptr) {
+			EntryHeader header;
+			std::memcpy(&header, record, sizeof(header));
+			const char* data = record + sizeof(header);
+			uint32_t data_size = size - static_cast<uint32_t>(sizeof(header));
+			if (header.format_id == 0) {
+				WriteText(header, data, data_size);
+			} else {
+				WriteBinaryEntry(header, data, data_size);
 			}
-			fileobject = new LogFileObject(google::INFO, file_name.c_str());
-			fileobject->SetSymlinkBasename(module_name.c_str());
-			moduleLoggerMap[module_name] = fileobject;
+			ring.PopFront();
+			budget -= std::min<uint64_t>(budget, size);
 		}
+		has_closed = has_closed || (closed && record == nullptr);
+	}
+	if (has_closed) {
+		std::lock_guard<std::mutex> lock(rings_mutex_);
+		auto drained = [](const std::shared_ptr<ThreadRing>& thread_ring) {
+			return thread_ring->closed.load() && thread_ring->ring.Used() == 0;
+		};
+		rings_.erase(std::remove_if(rings_.begin(), rings_.end(), drained), rings_.end());
+		writer_rings_ = rings_;
+		writer_rings_version_ = rings_version_.fetch_add(1) + 1;
+	}
+	if (cyber_unlikely(dropped_.load(std::memory_order_relaxed) != reported_dropped_)) {
+		WriteDropped();
+	}
+	if (cyber_unlikely(GetLogSuppressedNumber() != reported_suppressed_)) {
+		WriteSuppressed();
+	}
+}
+
+void AsyncLogger::WriteText(const EntryHeader& header, const char* data, uint32_t size) {
+	if (header.module_id != 0) {
+		LogFileObject* fileobject = GetModuleLogger(header.module_id);
 		if (fileobject) {
-			const bool force_flush = msg.level > 0;
-			fileobject->Write(force_flush, msg.ts, msg.message.data(),
-			static_cast<int>(msg.message.size()));
+			fileobject->Write(header.force_flush, static_cast<time_t>(header.timestamp), data,
+					static_cast<int>(size));
+			return;
 		}
-		buffer->pop_front();
 	}
-	Flush();
+	message_.assign(data, size);
+	WriteMessage(static_cast<time_t>(header.timestamp), header.force_flush);
+}
+
+void AsyncLogger::WriteMessage(time_t timestamp, bool force_flush) {
+	module_name_.clear();
+	FindModuleName(&message_, &module_name_);
+	LogFileObject* fileobject = GetModuleLogger(module_name_);
+	if (fileobject) {
+		fileobject->Write(force_flush, timestamp, message_.data(), static_cast<int>(message_.size()));
+	}
+}
+
+LogFileObject* AsyncLogger::GetModuleLogger(uint32_t module_id) {
+	if (module_id < module_files_.size() && module_files_[module_id] != nullptr) {
+		return module_files_[module_id];
+	}
+	const char* module_name = GetLogModuleName(module_id);
+	if (module_name == nullptr) {
+		return nullptr;
+	}
+	if (module_id >= module_files_.size()) {
+		module_files_.resize(module_id + 1, nullptr);
+	}
+	module_files_[module_id] = GetModuleLogger(std::string(module_name));
+	return module_files_[module_id];
+}
+
+LogFileObject* AsyncLogger::GetModuleLogger(const std::string& module_name) {
+	auto search = module_loggers_.find(module_name);
+	if (search != module_loggers_.end()) {
+		return search->second.get();
+	}
+	std::string file_name = module_name + ".log.INFO.";
+	if (!FLAGS_log_dir.empty()) {
+		file_name = FLAGS_log_dir + "/" + file_name;
+	}
+	LogFileObject* fileobject = new LogFileObject(google::INFO, file_name.c_str());
+	fileobject->SetSymlinkBasename(module_name.c_str());
+	module_loggers_[module_name].reset(fileobject);
+	return fileobject;
+}
+
+bool AsyncLogger::OpenBinaryFile() {
+	if (binary_file_ != nullptr) {
+		return true;
+	}
+	if (binary_file_failed_) {
+		return false;
+	}
+	time_t now = time(nullptr);
+	struct tm tm_time;
+	localtime_r(&now, &tm_time);
+	char suffix[64];
+	snprintf(suffix, sizeof(suffix), "%04d%02d%02d-%02d%02d%02d.%d",
+			1900 + tm_time.tm_year, 1 + tm_time.tm_mon, tm_time.tm_mday,
+			tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec, static_cast<int>(getpid()));
+	std::string file_name = binary::GetName() + ".log.BIN." + suffix;
+	if (!FLAGS_log_dir.empty()) {
+		file_name = FLAGS_log_dir + "/" + file_name;
+	}
+	binary_file_ = fopen(file_name.c_str(), "wb");
+	if (binary_file_ == nullptr) {
+		binary_file_failed_ = true;
+		AERROR << "open binary log file " << file_name << " failed, binary messages are dropped.";
+		return false;
+	}
+	fwrite(kBinaryLogMagic, 1, sizeof(kBinaryLogMagic) - 1, binary_file_);
+	WriteValue(binary_file_, kBinaryLogVersion);
+	return true;
+}
+
+void AsyncLogger::WriteBinaryEntry(const EntryHeader& header, const char* data, uint32_t size) {
+	if (!OpenBinaryFile()) {
+		return;
+	}
+	if (header.format_id >= written_formats_.size()) {
+		written_formats_.resize(header.format_id + 1, false);
+	}
+	if (!written_formats_[header.format_id]) {
+		const LogFormat* format = GetLogFormat(header.format_id);
+		if (format == nullptr) {
+			return;
+		}
+		WriteValue(binary_file_, static_cast<uint8_t>(BINARY_RECORD_FORMAT));
+		WriteValue(binary_file_, format->id);
+		WriteValue(binary_file_, format->severity);
+		WriteValue(binary_file_, format->line);
+		WriteString(binary_file_, format->module);
+		WriteString(binary_file_, format->file);
+		WriteString(binary_file_, format->format);
+		written_formats_[header.format_id] = true;
+	}
+	WriteValue(binary_file_, static_cast<uint8_t>(BINARY_RECORD_MESSAGE));
+	WriteValue(binary_file_, header.format_id);
+	WriteValue(binary_file_, header.timestamp);
+	WriteValue(binary_file_, header.tid);
+	WriteValue(binary_file_, size);
+	fwrite(data, 1, size, binary_file_);
+}
+
+void AsyncLogger::StartNotice(time_t* timestamp) {
+	struct timeval now;
+	gettimeofday(&now, nullptr);
+	struct tm tm_time;
+	localtime_r(&now.tv_sec, &tm_time);
+	char prefix[64];
+	snprintf(prefix, sizeof(prefix), "W%02d%02d %02d:%02d:%02d.%06ld %5d async_logger.cc:%d] ",
+			1 + tm_time.tm_mon, tm_time.tm_mday, tm_time.tm_hour, tm_time.tm_min,
+			tm_time.tm_sec, static_cast<long>(now.tv_usec), CurrentTid(), __LINE__);
+	message_ = prefix;
+	*timestamp = now.tv_sec;
+}
+
+void AsyncLogger::WriteDropped() {
+	uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+	uint64_t count = dropped - reported_dropped_;
+	reported_dropped_ = dropped;
+
+	time_t timestamp = 0;
+	StartNotice(&timestamp);
+	message_.append(LEFT_BRACKET).append(binary::GetName()).append(RIGHT_BRACKET);
+	message_.append(std::to_string(count)).append(" log messages dropped, the log ring is full\n");
+	WriteMessage(timestamp, true);
+
+	if (binary_file_ != nullptr) {
+		WriteValue(binary_file_, static_cast<uint8_t>(BINARY_RECORD_DROPPED));
+		WriteValue(binary_file_, count);
+	}
+}
+
+void AsyncLogger::WriteSuppressed() {
+	reported_suppressed_ = GetLogSuppressedNumber();
+	const char* module_name = nullptr;
+	for (uint32_t id = 1; (module_name = GetLogModuleName(id)) != nullptr; ++id) {
+		uint32_t rate_limit = 0;
+		uint64_t count = TakeLogModuleSuppressed(id, &rate_limit);
+		if (count == 0) {
+			continue;
+		}
+		time_t timestamp = 0;
+		StartNotice(&timestamp);
+		message_.append(LEFT_BRACKET).append(module_name).append(RIGHT_BRACKET);
+		message_.append(std::to_string(count)).append(" log lines suppressed, the limit is ")
+				.append(std::to_string(rate_limit)).append(" lines per second per call site\n");
+		WriteMessage(timestamp, false);
+	}
+}
+
+void AsyncLogger::FlushFiles() {
+	for (auto& module_logger : module_loggers_) {
+		module_logger.second->Flush();
+	}
+	if (binary_file_ != nullptr) {
+		fflush(binary_file_);
+	}
 }
 
 }  // namespace logger
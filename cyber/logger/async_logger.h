@@ -20,56 +20,69 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <cstdio>
 #include <ctime>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
-#include <utility>
+#include <unordered_map>
 #include <vector>
 
 #include "cyber/common/macros.h"
+#include "cyber/logger/log_ring.h"
 #include "glog/logging.h"
 
 namespace apollo {
 namespace cyber {
 namespace logger {
 
+class LogFileObject;
+
 /**
  * @class AsyncLogger
  * @brief .
  * Wrapper for a glog Logger which asynchronously writes log messages.
  * This class starts a new thread responsible for forwarding the messages
- * to the logger, and performs double buffering. Writers append to the
- * current buffer and then wake up the logger thread. The logger swaps in
- * a new buffer and writes any accumulated messages to the wrapped
- * Logger.
- *
- * This double-buffering design dramatically improves performance, especially
- * for logging messages which require flushing the underlying file (i.e WARNING
- * and above for default). The flush can take a couple of milliseconds, and in
- * some cases can even block for hundreds of milliseconds or more. With the
- * double-buffered approach, threads can proceed with useful work while the IO
- * thread blocks.
+ * to the per module log files. Every application thread appends its messages
+ * to a ring buffer of its own, allocated once when the thread logs for the
+ * first time, so that writing a message is a copy without locks or
+ * allocations. The logger thread sleeps until a ring fills up to a watermark,
+ * a message of WARNING or above arrives, or at most kMaxWriteIntervalMs.
+ * Lines of ALOG_MODULE carry the interned id of their module and go to its
+ * file without parsing, other lines are routed by their [module] prefix.
  *
  * The semantics provided by this wrapper are slightly weaker than the default
  * glog semantics. By default, glog will immediately (synchronously) flush
- * WARNING
- * and above to the underlying file, whereas here we are deferring that flush to
- * a separate thread. This means that a crash just after a 'LOG_WARN' would
+ * WARNING and above to the underlying file, whereas here we are deferring that
+ * flush to a separate thread. This means that a crash just after a 'LOG_WARN'
  * may be missing the message in the logs, but the perf benefit is probably
- * worth it. We do take care that a glog FATAL message flushes all buffered log
- * messages before exiting.
+ * worth it. Messages of different threads are written ring by ring, so they
+ * are only ordered within a thread.
+ *
+ * @warning A message is dropped instead of blocking the caller when the ring
+ * of its thread stays full for a few yields, the logger thread notes
+ * the number of lost messages in the log. This prevents runaway memory usage.
  *
- * @warning The logger limits the total amount of buffer space, so if the
- * underlying log blocks for too long, eventually the threads generating the log
- * messages will block as well. This prevents runaway memory usage.
+ * In binary mode the AINFO_F family of macros bypasses glog altogether: the
+ * id of the format string and the raw arguments are queued and written to
+ * <log_dir>/<binary>.log.BIN.<time>.<pid>, see cyber_log_decode.
  */
 class AsyncLogger : public google::base::Logger {
  public:
-  explicit AsyncLogger(google::base::Logger* wrapped);
+  static const uint32_t kDefaultRingSize = 64 * 1024;
+  static const uint32_t kMaxWriteIntervalMs = 100;
+  // yields of a writer facing a full ring before its message is dropped
+  static const uint32_t kFullRetries = 8;
+
+  /**
+   * @param ring_size bytes buffered per logging thread
+   * @param full_retries yields before a message meeting a full ring is dropped
+   */
+  explicit AsyncLogger(google::base::Logger* wrapped,
+                       uint32_t ring_size = kDefaultRingSize,
+                       uint32_t full_retries = kFullRetries);
 
   ~AsyncLogger();
 
@@ -102,7 +115,19 @@ class AsyncLogger : public google::base::Logger {
              int message_len) override;
 
   /**
-   * @brief Flush any buffered messages.
+   * @brief Queue a binary message, see binary_log.h.
+   *
+   * @param format_id the id returned by RegisterLogFormat
+   * @param severity the severity of the call site
+   * @param args the encoded arguments
+   * @param size the size of args
+   */
+  void WriteBinary(uint32_t format_id, int severity, const char* args,
+                   uint32_t size);
+
+  /**
+   * @brief Write out everything buffered so far and flush the files.
+   * Returns once the logger thread is done or after a second at most.
    */
   void Flush() override;
 
@@ -122,69 +147,92 @@ class AsyncLogger : public google::base::Logger {
    */
   std::thread* LogThread() { return &log_thread_; }
 
+  /**
+   * @brief Route AINFO_F and friends to the binary log file instead of
+   * formatting them in the calling thread.
+   */
+  void SetBinaryMode(bool enable);
+
+  /**
+   * @brief get the number of messages lost because a ring was full
+   */
+  uint64_t GetDroppedNumber() const { return dropped_.load(); }
+
  private:
-  // A buffered message.
-  //
-  // TODO(todd): using std::string for buffered messages is convenient but not
-  // as efficient as it could be. It's better to make the buffers just be
-  // Arenas and allocate both the message data and Msg struct from them, forming
-  // a linked list.
-struct Msg {
-	time_t ts;
-	std::string message;
-	int32_t level;
-	Msg() : ts(0), message(), level(google::INFO) {}
-	Msg(time_t ts, std::string&& message, int32_t level)
-		: ts(ts), message(std::move(message)), level(level) {}
-	Msg(const Msg& rsh) {
-		ts = rsh.ts;
-		message = rsh.message;
-		level = rsh.level;
-	}
-	Msg(Msg&& rsh) {
-		ts = rsh.ts;
-		message = rsh.message;
-		level = rsh.level;
-	}
-	Msg& operator=(Msg&& rsh) {
-		ts = rsh.ts;
-		message = std::move(rsh.message);
-		level = rsh.level;
-		return *this;
-	}
-	Msg& operator=(const Msg& rsh) {
-		ts = rsh.ts;
-		message = rsh.message;
-		level = rsh.level;
-		return *this;
-	}
-};
+  struct ThreadRing;
+  struct EntryHeader;
+
+  ThreadRing* GetThreadRing();
+  // |tail| follows |data| in the same entry
+  void Append(const EntryHeader& header, const char* data, uint32_t size,
+              const char* tail, uint32_t tail_size, bool urgent);
+  void Wake();
+  void WaitForWork();
 
   void RunThread();
-  void FlushBuffer(const std::unique_ptr<std::deque<Msg>>& msg);
+  void WriteRings();
+  void WriteText(const EntryHeader& header, const char* data, uint32_t size);
+  void WriteBinaryEntry(const EntryHeader& header, const char* data,
+                        uint32_t size);
+  // writes message_ to the file of its module
+  void WriteMessage(time_t timestamp, bool force_flush);
+  // starts message_ with a glog style WARNING prefix
+  void StartNotice(time_t* timestamp);
+  void WriteDropped();
+  void WriteSuppressed();
+  LogFileObject* GetModuleLogger(uint32_t module_id);
+  LogFileObject* GetModuleLogger(const std::string& module_name);
+  bool OpenBinaryFile();
+  void FlushFiles();
 
   google::base::Logger* const wrapped_;
+  const uint32_t ring_size_;
+  const uint32_t full_retries_;
+  // tells the rings of this logger apart in the thread local cache
+  const uint64_t id_;
   std::thread log_thread_;
 
-  // Count of how many times the writer thread has flushed the buffers.
-  // 64 bits should be enough to never worry about overflow.
-  std::atomic<uint64_t> flush_count_ = {0};
+  std::mutex rings_mutex_;
+  std::vector<std::shared_ptr<ThreadRing>> rings_;
+  std::atomic<uint64_t> rings_version_ = {0};
+  // shared by threads whose thread local ring is already destroyed
+  std::mutex orphan_mutex_;
+  std::shared_ptr<ThreadRing> orphan_ring_;
 
-  // Count of how many times the writer thread has dropped the log messages.
-  // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+  std::atomic<bool> wake_pending_ = {false};
+  std::atomic<bool> writer_sleeping_ = {false};
 
-  // The buffer to which application threads append new log messages.
-  std::unique_ptr<std::deque<Msg>> active_buf_;
+  std::mutex flush_mutex_;
+  std::condition_variable flush_cv_;
+  std::atomic<uint64_t> flush_requested_ = {0};
+  uint64_t flush_done_ = 0;
 
-  // The buffer currently being flushed by the logger thread, cleared
-  // after a successful flush.
-  std::unique_ptr<std::deque<Msg>> flushing_buf_;
+  // Count of how many messages have been dropped.
+  // 64 bits should be enough to never worry about overflow.
+  std::atomic<uint64_t> dropped_ = {0};
+  uint64_t reported_dropped_ = 0;
+  uint64_t reported_suppressed_ = 0;
+
+  // the following are only touched by the logger thread
+  std::vector<std::shared_ptr<ThreadRing>> writer_rings_;
+  uint64_t writer_rings_version_ = 0;
+  std::unordered_map<std::string, std::unique_ptr<LogFileObject>>
+      module_loggers_;
+  // index is the interned module id, see log_module.h
+  std::vector<LogFileObject*> module_files_;
+  std::string message_;
+  std::string module_name_;
+  FILE* binary_file_ = nullptr;
+  bool binary_file_failed_ = false;
+  std::vector<bool> written_formats_;
+
+  std::atomic<bool> binary_mode_ = {false};
 
   // Trigger for the logger thread to stop.
   enum State { INITTED, RUNNING, STOPPED };
   std::atomic<State> state_ = {INITTED};
-  std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
 
   DISALLOW_COPY_AND_ASSIGN(AsyncLogger);
 };
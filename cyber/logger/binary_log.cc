@@ -0,0 +1,267 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/binary_log.h"
+
+#include <time.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "glog/logging.h"
+
+#include "cyber/common/log.h"
+#include "cyber/logger/async_logger.h"
+#include "cyber/logger/log_module.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+namespace {
+
+std::mutex formats_mutex;
+// index is the id
+std::vector<std::unique_ptr<LogFormat>> formats(1);
+std::atomic<AsyncLogger*> binary_sink = {nullptr};
+
+const char* const kSeverityChars = "IWEF";
+
+template <typename T>
+bool Read(const char** args, const char* end, T* value) {
+  if (*args + sizeof(T) > end) {
+    return false;
+  }
+  std::memcpy(value, *args, sizeof(T));
+  *args += sizeof(T);
+  return true;
+}
+
+bool ReadString(std::istream* in, std::string* value) {
+  uint32_t length = 0;
+  if (!in->read(reinterpret_cast<char*>(&length), sizeof(length))) {
+    return false;
+  }
+  value->resize(length);
+  return length == 0 || static_cast<bool>(in->read(&(*value)[0], length));
+}
+
+template <typename T>
+bool ReadValue(std::istream* in, T* value) {
+  return static_cast<bool>(in->read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+const char* Basename(const std::string& path) {
+  auto pos = path.rfind('/');
+  return pos == std::string::npos ? path.c_str() : path.c_str() + pos + 1;
+}
+
+}  // namespace
+
+uint32_t RegisterLogFormat(const char* module, const char* file, int line,
+                           int severity, const char* format) {
+  std::unique_ptr<LogFormat> log_format(new LogFormat());
+  log_format->module = module;
+  log_format->module_id = InternLogModule(module);
+  log_format->file = file;
+  log_format->line = line;
+  log_format->severity = severity;
+  log_format->format = format;
+  std::lock_guard<std::mutex> lock(formats_mutex);
+  log_format->id = static_cast<uint32_t>(formats.size());
+  formats.emplace_back(std::move(log_format));
+  return formats.back()->id;
+}
+
+const LogFormat* GetLogFormat(uint32_t id) {
+  std::lock_guard<std::mutex> lock(formats_mutex);
+  if (id == 0 || id >= formats.size()) {
+    return nullptr;
+  }
+  return formats[id].get();
+}
+
+std::string FormatLogArgs(const std::string& format, const char* args,
+                          uint32_t size) {
+  const char* end = args + size;
+  std::string result;
+  char buffer[64];
+  size_t i = 0;
+  while (i < format.size()) {
+    char c = format[i++];
+    if (c != '%') {
+      result.push_back(c);
+      continue;
+    }
+    if (i < format.size() && format[i] == '%') {
+      result.push_back('%');
+      ++i;
+      continue;
+    }
+    // flags, width and precision are kept, length modifiers dropped
+    std::string spec = "%";
+    while (i < format.size() && std::strchr("-+ #0123456789.", format[i])) {
+      spec.push_back(format[i++]);
+    }
+    while (i < format.size() && std::strchr("hlLqjzt", format[i])) {
+      ++i;
+    }
+    if (i >= format.size()) {
+      break;
+    }
+    char conversion = format[i++];
+    uint8_t type = 0;
+    if (!Read(&args, end, &type)) {
+      result.append("<missing>");
+      continue;
+    }
+    if (type == BINARY_ARG_STRING) {
+      uint32_t length = 0;
+      if (!Read(&args, end, &length) || args + length > end) {
+        break;
+      }
+      result.append(args, length);
+      args += length;
+      continue;
+    }
+    uint64_t raw = 0;
+    if (!Read(&args, end, &raw)) {
+      break;
+    }
+    if (type == BINARY_ARG_DOUBLE) {
+      double value = 0.0;
+      std::memcpy(&value, &raw, sizeof(value));
+      if (!std::strchr("fFeEgGaA", conversion)) {
+        conversion = 'g';
+      }
+      snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), value);
+    } else if (conversion == 'c') {
+      snprintf(buffer, sizeof(buffer), (spec + 'c').c_str(),
+               static_cast<int>(raw));
+    } else if (conversion == 'p') {
+      snprintf(buffer, sizeof(buffer), "0x%llx",
+               static_cast<unsigned long long>(raw));
+    } else if (std::strchr("fFeEgGaA", conversion)) {
+      snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+               type == BINARY_ARG_INT
+                   ? static_cast<double>(static_cast<int64_t>(raw))
+                   : static_cast<double>(raw));
+    } else if (std::strchr("uxXo", conversion) || type == BINARY_ARG_UINT) {
+      if (!std::strchr("uxXo", conversion)) {
+        conversion = 'u';
+      }
+      snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(),
+               static_cast<unsigned long long>(raw));
+    } else {
+      snprintf(buffer, sizeof(buffer), (spec + "lld").c_str(),
+               static_cast<long long>(raw));
+    }
+    result.append(buffer);
+  }
+  return result;
+}
+
+void SetBinaryLogSink(AsyncLogger* sink) { binary_sink.store(sink); }
+
+void LogEncoded(uint32_t id, int severity, const char* args, uint32_t size) {
+  AsyncLogger* sink = binary_sink.load(std::memory_order_acquire);
+  if (sink != nullptr) {
+    sink->WriteBinary(id, severity, args, size);
+    return;
+  }
+  const LogFormat* format = GetLogFormat(id);
+  if (format == nullptr) {
+    return;
+  }
+  ModuleLogMessage(format->file.c_str(), format->line, severity,
+                   format->module_id, format->module.c_str())
+          .stream()
+      << FormatLogArgs(format->format, args, size);
+}
+
+bool DecodeBinaryLog(const std::string& path, std::ostream* out) {
+  std::ifstream in(path, std::ios::binary);
+  char magic[sizeof(kBinaryLogMagic) - 1];
+  uint32_t version = 0;
+  if (!in.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kBinaryLogMagic, sizeof(magic)) != 0 ||
+      !ReadValue(&in, &version) || version != kBinaryLogVersion) {
+    AERROR << path << " is not a binary log.";
+    return false;
+  }
+  std::unordered_map<uint32_t, LogFormat> formats;
+  std::string args;
+  uint8_t type = 0;
+  while (ReadValue(&in, &type)) {
+    if (type == BINARY_RECORD_FORMAT) {
+      LogFormat format;
+      if (!ReadValue(&in, &format.id) || !ReadValue(&in, &format.severity) ||
+          !ReadValue(&in, &format.line) || !ReadString(&in, &format.module) ||
+          !ReadString(&in, &format.file) || !ReadString(&in, &format.format)) {
+        break;
+      }
+      formats[format.id] = format;
+    } else if (type == BINARY_RECORD_MESSAGE) {
+      uint32_t id = 0;
+      int64_t timestamp_ns = 0;
+      int32_t tid = 0;
+      if (!ReadValue(&in, &id) || !ReadValue(&in, &timestamp_ns) ||
+          !ReadValue(&in, &tid) || !ReadString(&in, &args)) {
+        break;
+      }
+      auto search = formats.find(id);
+      if (search == formats.end()) {
+        *out << "<unknown format " << id << ">" << std::endl;
+        continue;
+      }
+      const auto& format = search->second;
+      time_t seconds = static_cast<time_t>(timestamp_ns / 1000000000);
+      struct tm tm_time;
+      localtime_r(&seconds, &tm_time);
+      char prefix[64];
+      snprintf(prefix, sizeof(prefix), "%c%02d%02d %02d:%02d:%02d.%06d %5d ",
+               kSeverityChars[format.severity & 3], 1 + tm_time.tm_mon,
+               tm_time.tm_mday, tm_time.tm_hour, tm_time.tm_min,
+               tm_time.tm_sec,
+               static_cast<int>(timestamp_ns % 1000000000 / 1000), tid);
+      *out << prefix << Basename(format.file) << ":" << format.line << "] "
+           << LEFT_BRACKET << format.module << RIGHT_BRACKET
+           << FormatLogArgs(format.format, args.data(),
+                            static_cast<uint32_t>(args.size()))
+           << std::endl;
+    } else if (type == BINARY_RECORD_DROPPED) {
+      uint64_t count = 0;
+      if (!ReadValue(&in, &count)) {
+        break;
+      }
+      *out << "<" << count << " log messages dropped>" << std::endl;
+    } else {
+      AERROR << "unknown record type " << static_cast<int>(type) << " in "
+             << path;
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief printf style logging that defers formatting: a call site registers
+ * its format string once and every message carries only the format id and
+ * the raw arguments. With a binary sink installed they are written as is and
+ * decoded offline by cyber_log_decode, otherwise they are formatted on the
+ * spot and go through glog like AINFO.
+ */
+
+#ifndef CYBER_LOGGER_BINARY_LOG_H_
+#define CYBER_LOGGER_BINARY_LOG_H_
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+class AsyncLogger;
+
+// encoded arguments of one message are truncated beyond this
+static const uint32_t kMaxBinaryArgsSize = 512;
+
+// binary log file layout: kBinaryLogMagic, then records starting with a
+// BinaryRecordType byte
+static const char kBinaryLogMagic[] = "CYBERLOG";
+static const uint32_t kBinaryLogVersion = 1;
+
+enum BinaryRecordType : uint8_t {
+  // id, severity, line, module, file, format
+  BINARY_RECORD_FORMAT = 1,
+  // id, timestamp ns, thread id, argument size, arguments
+  BINARY_RECORD_MESSAGE = 2,
+  // number of messages lost since the last such record
+  BINARY_RECORD_DROPPED = 3,
+};
+
+enum BinaryArgType : uint8_t {
+  BINARY_ARG_INT = 1,
+  BINARY_ARG_UINT = 2,
+  BINARY_ARG_DOUBLE = 3,
+  BINARY_ARG_STRING = 4,
+};
+
+struct LogFormat {
+  uint32_t id = 0;
+  // interned, see log_module.h
+  uint32_t module_id = 0;
+  int severity = 0;
+  int line = 0;
+  std::string module;
+  std::string file;
+  std::string format;
+};
+
+/**
+ * @brief Register a call site once, ids start at 1.
+ */
+uint32_t RegisterLogFormat(const char* module, const char* file, int line,
+                           int severity, const char* format);
+
+/**
+ * @brief Registered formats live as long as the process, nullptr if unknown.
+ */
+const LogFormat* GetLogFormat(uint32_t id);
+
+/**
+ * @brief Expand printf conversions of |format| with encoded arguments.
+ * Length modifiers are ignored, the stored type decides.
+ */
+std::string FormatLogArgs(const std::string& format, const char* args,
+                          uint32_t size);
+
+/**
+ * @brief Where binary messages go, nullptr to format them in place.
+ */
+void SetBinaryLogSink(AsyncLogger* sink);
+
+/**
+ * @brief Print a binary log file as text lines in glog layout.
+ *
+ * @return False for a file that is not a binary log.
+ */
+bool DecodeBinaryLog(const std::string& path, std::ostream* out);
+
+void LogEncoded(uint32_t id, int severity, const char* args, uint32_t size);
+
+class BinaryArgEncoder {
+ public:
+  explicit BinaryArgEncoder(char* buffer) : buffer_(buffer) {}
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value &&
+                          std::is_signed<T>::value>::type
+  Add(T value) {
+    Put(BINARY_ARG_INT, static_cast<int64_t>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value &&
+                          !std::is_signed<T>::value>::type
+  Add(T value) {
+    Put(BINARY_ARG_UINT, static_cast<uint64_t>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_enum<T>::value>::type Add(T value) {
+    Put(BINARY_ARG_INT, static_cast<int64_t>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_floating_point<T>::value>::type Add(
+      T value) {
+    Put(BINARY_ARG_DOUBLE, static_cast<double>(value));
+  }
+
+  void Add(const char* value) {
+    AddString(value, value == nullptr ? 0 : std::strlen(value));
+  }
+  void Add(const std::string& value) {
+    AddString(value.data(), value.size());
+  }
+
+  template <typename T>
+  void Add(const T* value) {
+    Put(BINARY_ARG_UINT, reinterpret_cast<uint64_t>(value));
+  }
+
+  uint32_t size() const { return size_; }
+
+ private:
+  template <typename T>
+  void Put(uint8_t type, T value) {
+    if (size_ + 1 + sizeof(value) > kMaxBinaryArgsSize) {
+      return;
+    }
+    buffer_[size_++] = static_cast<char>(type);
+    std::memcpy(buffer_ + size_, &value, sizeof(value));
+    size_ += static_cast<uint32_t>(sizeof(value));
+  }
+
+  void AddString(const char* value, size_t length) {
+    if (size_ + 1 + sizeof(uint32_t) > kMaxBinaryArgsSize) {
+      return;
+    }
+    uint32_t room = kMaxBinaryArgsSize - size_ - 1 - sizeof(uint32_t);
+    uint32_t len = static_cast<uint32_t>(length < room ? length : room);
+    buffer_[size_++] = static_cast<char>(BINARY_ARG_STRING);
+    std::memcpy(buffer_ + size_, &len, sizeof(len));
+    size_ += static_cast<uint32_t>(sizeof(len));
+    std::memcpy(buffer_ + size_, value, len);
+    size_ += len;
+  }
+
+  char* buffer_;
+  uint32_t size_ = 0;
+};
+
+template <typename... Args>
+void LogWithFormat(uint32_t id, int severity, const Args&... args) {
+  char buffer[kMaxBinaryArgsSize];
+  BinaryArgEncoder encoder(buffer);
+  int expand[] = {0, (encoder.Add(args), 0)...};
+  (void)expand;
+  LogEncoded(id, severity, buffer, encoder.size());
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_LOGGER_BINARY_LOG_H_
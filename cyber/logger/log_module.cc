@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/log_module.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+namespace {
+
+struct ModuleEntry {
+  std::string name;
+  // -1 for the default limit
+  std::atomic<int64_t> rate_limit = {-1};
+  std::atomic<uint64_t> suppressed = {0};
+  std::atomic<uint64_t> dropped = {0};
+  uint64_t reported_suppressed = 0;
+};
+
+std::mutex modules_mutex;
+std::unordered_map<std::string, uint32_t> module_ids;
+// index is the id, entries are never freed
+std::atomic<ModuleEntry*> modules[kMaxLogModules];
+std::atomic<uint32_t> default_rate_limit = {0};
+std::atomic<uint64_t> suppressed_number = {0};
+
+struct PendingSite {
+  uint32_t id;
+  const char* module;
+};
+thread_local PendingSite pending_site = {0, ""};
+thread_local LogModuleMark current_mark;
+
+ModuleEntry* GetEntry(uint32_t id) {
+  if (id == 0 || id >= kMaxLogModules) {
+    return nullptr;
+  }
+  return modules[id].load(std::memory_order_acquire);
+}
+
+uint64_t CurrentSecond() {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+             .count();
+}
+
+}  // namespace
+
+uint32_t InternLogModule(const char* name) {
+  std::lock_guard<std::mutex> lock(modules_mutex);
+  auto search = module_ids.find(name);
+  if (search != module_ids.end()) {
+    return search->second;
+  }
+  uint32_t id = static_cast<uint32_t>(module_ids.size()) + 1;
+  if (id >= kMaxLogModules) {
+    return 0;
+  }
+  ModuleEntry* entry = new ModuleEntry();
+  entry->name = name;
+  modules[id].store(entry, std::memory_order_release);
+  module_ids[entry->name] = id;
+  return id;
+}
+
+const char* GetLogModuleName(uint32_t id) {
+  ModuleEntry* entry = GetEntry(id);
+  return entry == nullptr ? nullptr : entry->name.c_str();
+}
+
+void SetLogRateLimit(const std::string& module, uint32_t lines_per_second) {
+  ModuleEntry* entry = GetEntry(InternLogModule(module.c_str()));
+  if (entry != nullptr) {
+    entry->rate_limit.store(lines_per_second);
+  }
+}
+
+void SetDefaultLogRateLimit(uint32_t lines_per_second) {
+  default_rate_limit.store(lines_per_second);
+}
+
+bool GetLogModuleStats(const std::string& module, LogModuleStats* stats) {
+  uint32_t id = 0;
+  {
+    std::lock_guard<std::mutex> lock(modules_mutex);
+    auto search = module_ids.find(module);
+    if (search == module_ids.end()) {
+      return false;
+    }
+    id = search->second;
+  }
+  ModuleEntry* entry = GetEntry(id);
+  stats->suppressed = entry->suppressed.load();
+  stats->dropped = entry->dropped.load();
+  return true;
+}
+
+void AddLogModuleDropped(uint32_t id) {
+  ModuleEntry* entry = GetEntry(id);
+  if (entry != nullptr) {
+    entry->dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+uint64_t GetLogSuppressedNumber() { return suppressed_number.load(); }
+
+uint64_t TakeLogModuleSuppressed(uint32_t id, uint32_t* rate_limit) {
+  ModuleEntry* entry = GetEntry(id);
+  if (entry == nullptr) {
+    return 0;
+  }
+  int64_t limit = entry->rate_limit.load();
+  *rate_limit =
+      static_cast<uint32_t>(limit < 0 ? default_rate_limit.load() : limit);
+  uint64_t suppressed = entry->suppressed.load();
+  uint64_t count = suppressed - entry->reported_suppressed;
+  entry->reported_suppressed = suppressed;
+  return count;
+}
+
+bool LogSite::Enter(LogSite* site, int severity, const char* module) {
+  // read like a seqlock: a site racing on two modules must not pair the
+  // address of one with the id of the other
+  const char* cached = site->module_.load(std::memory_order_acquire);
+  uint32_t id = site->module_id_.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (cached != module ||
+      site->module_.load(std::memory_order_relaxed) != module) {
+    id = InternLogModule(module);
+    site->module_.store(nullptr, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    site->module_id_.store(id, std::memory_order_relaxed);
+    site->module_.store(module, std::memory_order_release);
+  }
+  return site->Admit(severity, id, module);
+}
+
+bool LogSite::Enter(LogSite* site, int severity, const std::string& module) {
+  uint32_t id = site->module_id_.load(std::memory_order_relaxed);
+  ModuleEntry* entry = GetEntry(id);
+  if (entry == nullptr || entry->name != module) {
+    id = InternLogModule(module.c_str());
+    site->module_id_.store(id, std::memory_order_relaxed);
+  }
+  return site->Admit(severity, id, module.c_str());
+}
+
+bool LogSite::Admit(int severity, uint32_t id, const char* module) {
+  ModuleEntry* entry = GetEntry(id);
+  pending_site.id = id;
+  pending_site.module = module;
+  if (entry == nullptr || severity >= google::FATAL) {
+    return true;
+  }
+  int64_t limit = entry->rate_limit.load(std::memory_order_relaxed);
+  if (limit < 0) {
+    limit = default_rate_limit.load(std::memory_order_relaxed);
+  }
+  if (limit == 0) {
+    return true;
+  }
+  uint64_t second = (CurrentSecond() + 1) << 32;
+  uint64_t window = window_.load(std::memory_order_relaxed);
+  while (true) {
+    if ((window & ~0xFFFFFFFFUL) != second) {
+      if (window_.compare_exchange_weak(window, second | 1)) {
+        return true;
+      }
+      continue;
+    }
+    if (static_cast<int64_t>(window & 0xFFFFFFFFUL) >= limit) {
+      entry->suppressed.fetch_add(1, std::memory_order_relaxed);
+      suppressed_number.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    if (window_.compare_exchange_weak(window, window + 1)) {
+      return true;
+    }
+  }
+}
+
+ModuleLogMessage::ModuleLogMessage(const char* file, int line,
+                                   google::LogSeverity severity)
+    : google::LogMessage(file, line, severity) {
+  Init(pending_site.id, pending_site.module);
+}
+
+ModuleLogMessage::ModuleLogMessage(const char* file, int line,
+                                   google::LogSeverity severity,
+                                   uint32_t module_id, const char* module)
+    : google::LogMessage(file, line, severity) {
+  Init(module_id, module);
+}
+
+void ModuleLogMessage::Init(uint32_t module_id, const char* module) {
+  auto& log_stream = static_cast<google::LogMessage::LogStream&>(stream());
+  module_id_ = module_id;
+  offset_ = static_cast<uint32_t>(log_stream.pcount());
+  log_stream << '[' << module << ']';
+  length_ = static_cast<uint32_t>(log_stream.pcount()) - offset_;
+}
+
+ModuleLogMessage::~ModuleLogMessage() {
+  // sent here rather than by ~LogMessage so that the mark is cleared after
+  current_mark.id = module_id_;
+  current_mark.offset = offset_;
+  current_mark.length = length_;
+  Flush();
+  current_mark.id = 0;
+}
+
+bool TakeLogModuleMark(LogModuleMark* mark) {
+  if (current_mark.id == 0) {
+    return false;
+  }
+  *mark = current_mark;
+  current_mark.id = 0;
+  return true;
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Module identity of log lines: the module of an ALOG_MODULE call site
+ * is interned once into an integer id that travels with the message, so that
+ * the logger routes it to the module file without parsing the line. Call
+ * sites can be rate limited per module.
+ */
+
+#ifndef CYBER_LOGGER_LOG_MODULE_H_
+#define CYBER_LOGGER_LOG_MODULE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "glog/logging.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+// modules beyond this are not interned and fall back to parsing
+static const uint32_t kMaxLogModules = 1024;
+
+struct LogModuleStats {
+  // lines not logged because of the rate limit
+  uint64_t suppressed = 0;
+  // lines lost because the log ring was full
+  uint64_t dropped = 0;
+};
+
+/**
+ * @brief Intern a module name, ids start at 1.
+ *
+ * @return 0 when kMaxLogModules modules exist already.
+ */
+uint32_t InternLogModule(const char* name);
+
+/**
+ * @brief nullptr for an unknown id.
+ */
+const char* GetLogModuleName(uint32_t id);
+
+/**
+ * @brief Log at most |lines_per_second| lines per call site of |module|,
+ * 0 for no limit. FATAL is never limited.
+ */
+void SetLogRateLimit(const std::string& module, uint32_t lines_per_second);
+
+/**
+ * @brief The limit of modules without one of their own.
+ */
+void SetDefaultLogRateLimit(uint32_t lines_per_second);
+
+bool GetLogModuleStats(const std::string& module, LogModuleStats* stats);
+
+void AddLogModuleDropped(uint32_t id);
+
+/**
+ * @brief Suppressed lines of all modules, only ever grows.
+ */
+uint64_t GetLogSuppressedNumber();
+
+/**
+ * @brief Suppressed lines of |id| since the last call, for the logger thread.
+ *
+ * @param rate_limit the limit in effect
+ */
+uint64_t TakeLogModuleSuppressed(uint32_t id, uint32_t* rate_limit);
+
+/**
+ * @class LogSite
+ * @brief State of one ALOG_MODULE call site: its module id and the lines
+ * logged in the current second.
+ */
+class LogSite {
+ public:
+  /**
+   * @brief Resolve the module of this site for the following
+   * ModuleLogMessage of the calling thread.
+   *
+   * The id is cached by the address of |module|, which has to keep its
+   * contents for the life of the site, e.g. a literal.
+   *
+   * @return false when the line is over the rate limit of the module
+   */
+  static bool Enter(LogSite* site, int severity, const char* module);
+  /**
+   * @brief As above for a computed module, compared by contents.
+   */
+  static bool Enter(LogSite* site, int severity, const std::string& module);
+
+ private:
+  bool Admit(int severity, uint32_t id, const char* module);
+
+  // nullptr while module_id_ is being changed
+  std::atomic<const char*> module_ = {nullptr};
+  std::atomic<uint32_t> module_id_ = {0};
+  // second of the window in the high half, lines in it in the low half
+  std::atomic<uint64_t> window_ = {0};
+};
+
+/**
+ * @class ModuleLogMessage
+ * @brief A glog message starting with [module]. While it is sent the module
+ * id and the position of the prefix are available to the logger of the same
+ * thread through TakeLogModuleMark.
+ */
+class ModuleLogMessage : public google::LogMessage {
+ public:
+  // the module of the last LogSite::Enter of this thread
+  ModuleLogMessage(const char* file, int line, google::LogSeverity severity);
+  ModuleLogMessage(const char* file, int line, google::LogSeverity severity,
+                   uint32_t module_id, const char* module);
+  ~ModuleLogMessage();
+
+ private:
+  void Init(uint32_t module_id, const char* module);
+
+  uint32_t module_id_ = 0;
+  uint32_t offset_ = 0;
+  uint32_t length_ = 0;
+};
+
+struct LogModuleMark {
+  uint32_t id = 0;
+  // the [module] prefix within the message
+  uint32_t offset = 0;
+  uint32_t length = 0;
+};
+
+/**
+ * @brief The module of the message being sent by this thread, if any.
+ */
+bool TakeLogModuleMark(LogModuleMark* mark);
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_LOGGER_LOG_MODULE_H_
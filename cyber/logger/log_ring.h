@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_LOGGER_LOG_RING_H_
+#define CYBER_LOGGER_LOG_RING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+// Byte ring of variable sized records for one producer and one consumer
+// thread. The memory is allocated once, a record that does not fit is
+// rejected instead of waiting or allocating.
+class LogRing {
+ public:
+  // |capacity| is rounded up to a power of two
+  explicit LogRing(uint32_t capacity) {
+    capacity_ = 64;
+    while (capacity_ < capacity) {
+      capacity_ <<= 1;
+    }
+    buffer_.reset(new char[capacity_]);
+  }
+
+  // Producer side: room for a record of |size| bytes, nullptr when full.
+  // Nothing is visible to the consumer before Commit().
+  char* Reserve(uint32_t size) {
+    uint64_t need = Align(sizeof(uint32_t) + size);
+    if (need > capacity_ / 2) {
+      return nullptr;
+    }
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t pos = tail & (capacity_ - 1);
+    // a record never wraps, the rest of the buffer is skipped instead
+    uint64_t skip = pos + need > capacity_ ? capacity_ - pos : 0;
+    if (tail + skip + need - cached_head_ > capacity_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail + skip + need - cached_head_ > capacity_) {
+        return nullptr;
+      }
+    }
+    if (skip > 0) {
+      SetLength(pos, kSkipMarker);
+      tail += skip;
+      pos = 0;
+    }
+    SetLength(pos, size);
+    reserved_tail_ = tail + need;
+    return &buffer_[pos + sizeof(uint32_t)];
+  }
+
+  void Commit() { tail_.store(reserved_tail_, std::memory_order_release); }
+
+  // Consumer side: the oldest record, nullptr when empty.
+  const char* Front(uint32_t* size) {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    while (true) {
+      if (head == cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+          return nullptr;
+        }
+      }
+      uint64_t pos = head & (capacity_ - 1);
+      uint32_t length = GetLength(pos);
+      if (length == kSkipMarker) {
+        head += capacity_ - pos;
+        head_.store(head, std::memory_order_release);
+        continue;
+      }
+      *size = length;
+      return &buffer_[pos + sizeof(uint32_t)];
+    }
+  }
+
+  void PopFront() {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint32_t length = GetLength(head & (capacity_ - 1));
+    head_.store(head + Align(sizeof(uint32_t) + length),
+                std::memory_order_release);
+  }
+
+  uint64_t Used() const {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+
+  uint64_t Capacity() const { return capacity_; }
+
+  // largest |size| Reserve() can ever satisfy
+  uint32_t MaxRecordSize() const {
+    return static_cast<uint32_t>(capacity_ / 2 - sizeof(uint32_t));
+  }
+
+ private:
+  static const uint32_t kSkipMarker = 0xFFFFFFFF;
+
+  static uint64_t Align(uint64_t size) { return (size + 7) & ~7UL; }
+
+  void SetLength(uint64_t pos, uint32_t length) {
+    std::memcpy(&buffer_[pos], &length, sizeof(length));
+  }
+
+  uint32_t GetLength(uint64_t pos) const {
+    uint32_t length = 0;
+    std::memcpy(&length, &buffer_[pos], sizeof(length));
+    return length;
+  }
+
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> head_ = {0};
+  // consumer side copy of tail_
+  uint64_t cached_tail_ = 0;
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> tail_ = {0};
+  // producer side copy of head_ and the end of the reserved record
+  uint64_t cached_head_ = 0;
+  uint64_t reserved_tail_ = 0;
+  alignas(CACHELINE_SIZE) uint64_t capacity_ = 0;
+  std::unique_ptr<char[]> buffer_;
+};
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_LOGGER_LOG_RING_H_
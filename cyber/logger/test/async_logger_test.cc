@@ -16,9 +16,19 @@
 
 #include "cyber/logger/async_logger.h"
 
+#include <dirent.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include "cyber/binary.h"
+#include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -53,6 +63,73 @@ TEST(AsyncLoggerTest, WriteAndFlush) {
   logger.Stop();
 }
 
+// lines containing |text| in all files of |dir|
+uint64_t CountLines(const std::string& dir, const std::string& text) {
+  uint64_t count = 0;
+  DIR* directory = opendir(dir.c_str());
+  if (directory == nullptr) {
+    return 0;
+  }
+  struct dirent* entry = nullptr;
+  while ((entry = readdir(directory)) != nullptr) {
+    if (entry->d_type != DT_REG) {
+      continue;
+    }
+    std::ifstream file(dir + "/" + entry->d_name);
+    std::string line;
+    while (std::getline(file, line)) {
+      if (line.find(text) != std::string::npos) {
+        ++count;
+      }
+    }
+  }
+  closedir(directory);
+  return count;
+}
+
+TEST(AsyncLoggerTest, BurstDropsAreCounted) {
+  char dir[] = "/tmp/async_logger_test_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(dir));
+  FLAGS_log_dir = dir;
+  // the module of the drop notice
+  binary::SetName("async_logger_test");
+  const int kThreads = 4;
+  const int kMessages = 5000;
+  {
+    // a ring of 1k holds a handful of messages only, and nobody waits
+    AsyncLogger logger(google::base::GetLogger(google::INFO), 1024, 0);
+    logger.Start();
+    std::string message = "I0909 99:99:99.999999 99999 logger_test.cc:999] ";
+    message.append(LEFT_BRACKET);
+    message.append("AsyncLoggerBurst");
+    message.append(RIGHT_BRACKET);
+    message.append("burst message\n");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&logger, &message]() {
+        for (int j = 0; j < kMessages; ++j) {
+          logger.Write(false, time(nullptr), message.c_str(),
+                       static_cast<int>(message.length()));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    logger.Flush();
+    logger.Stop();
+
+    uint64_t dropped = logger.GetDroppedNumber();
+    EXPECT_GT(dropped, 0);
+    EXPECT_EQ(kThreads * kMessages,
+              CountLines(dir, "burst message") + dropped);
+    EXPECT_GT(CountLines(dir, "log messages dropped"), 0);
+  }
+  FLAGS_log_dir = "";
+  common::RemoveAllFiles(dir);
+  rmdir(dir);
+}
+
 TEST(AsyncLoggerTest, SetLoggerToGlog) {
   google::InitGoogleLogging("AsyncLoggerTest2");
   google::SetLogDestination(google::ERROR, "");
@@ -64,9 +141,25 @@ TEST(AsyncLoggerTest, SetLoggerToGlog) {
   ALOG_MODULE("AsyncLoggerTest2", INFO) << "test set async logger to glog";
   ALOG_MODULE("AsyncLoggerTest2", WARN) << "test set async logger to glog";
   ALOG_MODULE("AsyncLoggerTest2", ERROR) << "test set async logger to glog";
+
+  // lines with and without a module id end up alike in their module file
+  char dir[] = "/tmp/async_logger_test_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(dir));
+  FLAGS_log_dir = dir;
+  ALOG_MODULE("AsyncLoggerRoute", INFO) << "routed by id";
+  LOG(INFO) << LEFT_BRACKET << "AsyncLoggerRoute" << RIGHT_BRACKET
+            << "routed by prefix";
+  logger->Flush();
+  FLAGS_log_dir = "";
+  EXPECT_EQ(2, CountLines(dir, "async_logger_test.cc:"));
+  EXPECT_EQ(1, CountLines(dir, "] routed by id"));
+  EXPECT_EQ(1, CountLines(dir, "] routed by prefix"));
+  EXPECT_EQ(0, CountLines(dir, "[AsyncLoggerRoute]"));
   logger->Stop();
   logger = nullptr;
   google::ShutdownGoogleLogging();
+  common::RemoveAllFiles(dir);
+  rmdir(dir);
 }
 
 }  // namespace logger
@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/binary_log.h"
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/logger/async_logger.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+template <typename... Args>
+std::string Format(const std::string& format, const Args&... args) {
+  char buffer[kMaxBinaryArgsSize];
+  BinaryArgEncoder encoder(buffer);
+  int expand[] = {0, (encoder.Add(args), 0)...};
+  (void)expand;
+  return FormatLogArgs(format, buffer, encoder.size());
+}
+
+TEST(BinaryLogTest, FormatArgs) {
+  EXPECT_EQ("no args 100%", Format("no args 100%%"));
+  EXPECT_EQ("-5 7 1.50 abc def x", Format("%d %u %.2f %s %s %c", -5, 7u, 1.5,
+                                           "abc", std::string("def"), 'x'));
+  EXPECT_EQ("   42|2a|-1|18446744073709551615",
+            Format("%5ld|%x|%lld|%llu", 42L, 42, -1LL, uint64_t(-1)));
+  EXPECT_EQ("2.5e+00 3", Format("%.1e %d", 2.5f, 3.0));
+  // missing arguments are marked instead of reading past the end
+  EXPECT_EQ("1 <missing>", Format("%d %d", 1));
+}
+
+TEST(BinaryLogTest, Truncate) {
+  std::string large(1024, 'a');
+  char buffer[kMaxBinaryArgsSize];
+  BinaryArgEncoder encoder(buffer);
+  encoder.Add(large);
+  encoder.Add(1);
+  EXPECT_EQ(kMaxBinaryArgsSize, encoder.size());
+  std::string text = FormatLogArgs("%s %d", buffer, encoder.size());
+  EXPECT_EQ(kMaxBinaryArgsSize - 5, text.find(" <missing>"));
+}
+
+TEST(BinaryLogTest, Register) {
+  uint32_t id = RegisterLogFormat("BinaryLogTest", __FILE__, __LINE__,
+                                  google::WARNING, "format %d");
+  EXPECT_GT(id, 0);
+  const LogFormat* format = GetLogFormat(id);
+  ASSERT_NE(nullptr, format);
+  EXPECT_EQ(id, format->id);
+  EXPECT_EQ("BinaryLogTest", format->module);
+  EXPECT_EQ(google::WARNING, format->severity);
+  EXPECT_EQ("format %d", format->format);
+  EXPECT_EQ(nullptr, GetLogFormat(0));
+  EXPECT_EQ(nullptr, GetLogFormat(id + 1000));
+}
+
+TEST(BinaryLogTest, WriteAndDecode) {
+  char dir[] = "/tmp/binary_log_test_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(dir));
+  FLAGS_log_dir = dir;
+  {
+    AsyncLogger logger(google::base::GetLogger(google::INFO));
+    logger.Start();
+    logger.SetBinaryMode(true);
+    for (int i = 0; i < 10; ++i) {
+      ALOG_FORMAT_MODULE("BinaryLogTest", google::INFO, "value %d of %s", i,
+                         "test");
+    }
+    ALOG_FORMAT_MODULE("BinaryLogTest", google::WARNING, "pi is %.3f",
+                       3.14159);
+    logger.Flush();
+    logger.Stop();
+  }
+  FLAGS_log_dir = "";
+
+  std::string path;
+  DIR* directory = opendir(dir);
+  ASSERT_NE(nullptr, directory);
+  struct dirent* entry = nullptr;
+  while ((entry = readdir(directory)) != nullptr) {
+    if (std::string(entry->d_name).find(".log.BIN.") != std::string::npos) {
+      path = std::string(dir) + "/" + entry->d_name;
+    }
+  }
+  closedir(directory);
+  ASSERT_FALSE(path.empty());
+
+  std::ostringstream out;
+  ASSERT_TRUE(DecodeBinaryLog(path, &out));
+  std::istringstream lines(out.str());
+  std::string line;
+  int count = 0;
+  while (std::getline(lines, line)) {
+    if (count < 10) {
+      EXPECT_EQ('I', line[0]);
+      EXPECT_NE(std::string::npos,
+                line.find("binary_log_test.cc:"));
+      EXPECT_NE(std::string::npos,
+                line.find("] [BinaryLogTest]value " + std::to_string(count) +
+                          " of test"));
+    } else {
+      EXPECT_EQ('W', line[0]);
+      EXPECT_NE(std::string::npos, line.find("[BinaryLogTest]pi is 3.142"));
+    }
+    ++count;
+  }
+  EXPECT_EQ(11, count);
+
+  EXPECT_FALSE(DecodeBinaryLog(std::string(dir) + "/none", &out));
+  common::RemoveAllFiles(dir);
+  rmdir(dir);
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/logger/log_module.h"
+
+#include <string>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+int Touch(int* count) { return ++*count; }
+
+TEST(LogModuleTest, Intern) {
+  uint32_t id = InternLogModule("LogModuleTest");
+  EXPECT_GT(id, 0);
+  EXPECT_EQ(id, InternLogModule("LogModuleTest"));
+  EXPECT_EQ(id, InternLogModule(std::string("LogModuleTest").c_str()));
+  EXPECT_NE(id, InternLogModule("LogModuleTest2"));
+  EXPECT_STREQ("LogModuleTest", GetLogModuleName(id));
+  EXPECT_EQ(nullptr, GetLogModuleName(0));
+  EXPECT_EQ(nullptr, GetLogModuleName(kMaxLogModules));
+}
+
+TEST(LogModuleTest, Mark) {
+  LogModuleMark mark;
+  EXPECT_FALSE(TakeLogModuleMark(&mark));
+  {
+    // the mark only exists while the message is sent
+    ModuleLogMessage message(__FILE__, __LINE__, google::INFO,
+                             InternLogModule("LogModuleTest"),
+                             "LogModuleTest");
+    message.stream() << "mark";
+  }
+  EXPECT_FALSE(TakeLogModuleMark(&mark));
+}
+
+TEST(LogModuleTest, RateLimit) {
+  SetLogRateLimit("LogModuleRate", 5);
+  int evaluated = 0;
+  for (int i = 0; i < 100; ++i) {
+    ALOG_MODULE("LogModuleRate", INFO) << "rate limited " << Touch(&evaluated);
+  }
+  // the loop may cross a second boundary
+  EXPECT_GE(evaluated, 5);
+  EXPECT_LE(evaluated, 10);
+  LogModuleStats stats;
+  ASSERT_TRUE(GetLogModuleStats("LogModuleRate", &stats));
+  EXPECT_EQ(100 - evaluated, stats.suppressed);
+  EXPECT_EQ(0, stats.dropped);
+  uint32_t rate_limit = 0;
+  EXPECT_EQ(stats.suppressed,
+            TakeLogModuleSuppressed(InternLogModule("LogModuleRate"),
+                                    &rate_limit));
+  EXPECT_EQ(5, rate_limit);
+
+  // other modules and call sites are not affected
+  int other = 0;
+  for (int i = 0; i < 100; ++i) {
+    ALOG_MODULE("LogModuleOther", INFO) << "not limited " << Touch(&other);
+  }
+  EXPECT_EQ(100, other);
+
+  SetLogRateLimit("LogModuleRate", 0);
+  evaluated = 0;
+  for (int i = 0; i < 100; ++i) {
+    ALOG_MODULE("LogModuleRate", INFO) << "unlimited " << Touch(&evaluated);
+  }
+  EXPECT_EQ(100, evaluated);
+  EXPECT_FALSE(GetLogModuleStats("LogModuleNone", &stats));
+}
+
+TEST(LogModuleTest, DefaultRateLimit) {
+  SetDefaultLogRateLimit(3);
+  SetLogRateLimit("LogModuleOwn", 0);
+  int limited = 0;
+  int own = 0;
+  for (int i = 0; i < 50; ++i) {
+    AINFO_IF(true) << "default limit " << Touch(&limited);
+    ALOG_MODULE("LogModuleOwn", WARN) << "own limit " << Touch(&own);
+  }
+  SetDefaultLogRateLimit(0);
+  EXPECT_LE(limited, 6);
+  EXPECT_EQ(50, own);
+}
+
+TEST(LogModuleTest, SiteModuleChanges) {
+  // a module of the site over its limit would make Enter fail
+  SetLogRateLimit("LogModuleSiteA", 1);
+  LogSite site;
+  EXPECT_TRUE(LogSite::Enter(&site, google::INFO, "LogModuleSiteA"));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(LogSite::Enter(&site, google::INFO, "LogModuleSiteB"));
+  }
+
+  // the same address with other contents
+  std::string module = "LogModuleSiteA";
+  LogSite computed_site;
+  EXPECT_TRUE(LogSite::Enter(&computed_site, google::INFO, module));
+  module = "LogModuleSiteB";
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(LogSite::Enter(&computed_site, google::INFO, module));
+  }
+  SetLogRateLimit("LogModuleSiteA", 0);
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
@@ -126,10 +126,12 @@ public:
 	* @tparam Response Message Type of the Response
 	* @param service_name specific service name to a serve
 	* @param service_callback invoked when a service is called
+	* @param config executor and admission control of the handlers
 	* @return std::shared_ptr<Service<Request, Response>> result `Service`
 	*/
 	template <typename Request, typename Response>
-	auto CreateService(const std::string& service_name, const typename Service<Request, Response>::ServiceCallback& service_callback)
+	auto CreateService(const std::string& service_name, const typename Service<Request, Response>::ServiceCallback& service_callback,
+		const ServiceConfig& config = ServiceConfig())
 		-> std::shared_ptr<Service<Request, Response>>;
 
 	/**
@@ -165,6 +167,15 @@ public:
 	auto GetReader(const std::string& channel_name)
 		-> std::shared_ptr<Reader<MessageT>>;
 
+	/**
+	* @brief Forget the Reader that subscribes `channel_name`, it shuts down
+	* once its last owner releases it
+	*
+	* @param channel_name channel name
+	* @return true if there was such a Reader
+	*/
+	bool DeleteReader(const std::string& channel_name);
+
 private:
 	explicit Node(const std::string& node_name, const std::string& name_space = "");
 
@@ -249,10 +260,11 @@ auto Node::CreateReader(const std::string& channel_name, const CallbackFunc<Mess
 }
 
 template <typename Request, typename Response>
-auto Node::CreateService(const std::string& service_name, const typename Service<Request, Response>::ServiceCallback& service_callback) 
+auto Node::CreateService(const std::string& service_name, const typename Service<Request, Response>::ServiceCallback& service_callback,
+	const ServiceConfig& config)
 	-> std::shared_ptr<Service<Request, Response>> 
 {
-	return node_service_impl_->template CreateService<Request, Response>(service_name, service_callback);
+	return node_service_impl_->template CreateService<Request, Response>(service_name, service_callback, config);
 }
 
 template <typename Request, typename Response>
@@ -48,6 +48,7 @@ class NodeServiceImpl {
   explicit NodeServiceImpl(const std::string& node_name)
       : node_name_(node_name) {
     attr_.set_host_name(common::GlobalData::Instance()->HostName());
+    attr_.set_host_ip(common::GlobalData::Instance()->HostIp());
     attr_.set_process_id(common::GlobalData::Instance()->ProcessId());
     attr_.set_node_name(node_name);
     auto node_id = common::GlobalData::RegisterNode(node_name);
@@ -69,7 +70,8 @@ class NodeServiceImpl {
   template <typename Request, typename Response>
   auto CreateService(const std::string& service_name,
                      const typename Service<Request, Response>::ServiceCallback&
-                         service_callback) ->
+                         service_callback,
+                     const ServiceConfig& config = ServiceConfig()) ->
       typename std::shared_ptr<Service<Request, Response>>;
 
   template <typename Request, typename Response>
@@ -86,10 +88,11 @@ template <typename Request, typename Response>
 auto NodeServiceImpl::CreateService(
     const std::string& service_name,
     const typename Service<Request, Response>::ServiceCallback&
-        service_callback) ->
+        service_callback,
+    const ServiceConfig& config) ->
     typename std::shared_ptr<Service<Request, Response>> {
   auto service_ptr = std::make_shared<Service<Request, Response>>(
-      node_name_, service_name, service_callback);
+      node_name_, service_name, service_callback, config);
   RETURN_VAL_IF(!service_ptr->Init(), nullptr);
 
   service_list_.emplace_back(service_ptr);
@@ -256,7 +256,12 @@ bool Reader<MessageT>::Init() {
 	
 	std::function<void(const std::shared_ptr<MessageT>&)> func;
 	if (reader_func_ != nullptr) {
-		func = [this](const std::shared_ptr<MessageT>& msg) {
+		uint64_t channel_id = role_attr_.channel_id();
+		bool traced = event::LatencyTracer::Instance()->enabled();
+		func = [this, channel_id, traced](const std::shared_ptr<MessageT>& msg) {
+			if (traced) {
+				event::LatencyTracer::Instance()->OnCallback(channel_id, msg.get());
+			}
 			this->Enqueue(msg);
 			this->reader_func_(msg);
 		};
@@ -25,6 +25,7 @@
 
 #include "cyber/common/macros.h"
 #include "cyber/common/util.h"
+#include "cyber/event/latency_tracer.h"
 #include "cyber/event/perf_event_cache.h"
 #include "cyber/transport/transport.h"
 
@@ -209,8 +210,22 @@ auto ReceiverManager<MessageT>::GetReceiver(const proto::RoleAttributes& role_at
 			(void)msg_info;
 			(void)reader_attr;
 			PerfEventCache::Instance()->AddTransportEvent(TransPerf::DISPATCH, reader_attr.channel_id(), msg_info.seq_num());
+			uint64_t dispatch_begin = msg_info.send_time() != 0 && event::LatencyTracer::Instance()->enabled()
+										? event::LatencyTracer::Now() : 0;
+			if (dispatch_begin != 0) {
+				// a reader croutine may start before Dispatch returns
+				event::LatencyTracer::Instance()->OnDispatched(reader_attr.channel_id(), msg.get(),
+															msg_info.send_time(), dispatch_begin);
+			}
 			data::DataDispatcher<MessageT>::Instance()->Dispatch(reader_attr.channel_id(), msg);
 			PerfEventCache::Instance()->AddTransportEvent(TransPerf::NOTIFY, reader_attr.channel_id(), msg_info.seq_num());
+			if (dispatch_begin != 0) {
+				uint64_t dispatch_end = event::LatencyTracer::Now();
+				event::LatencyTracer::Instance()->Record(reader_attr.channel_id(), event::LatencyHop::DISPATCH,
+														dispatch_begin, dispatch_end);
+				event::LatencyTracer::Instance()->OnDispatched(reader_attr.channel_id(), msg.get(),
+															msg_info.send_time(), dispatch_end);
+			}
 		});
 	}
 	return receiver_map_[channel_name];
@@ -24,7 +24,7 @@ namespace cyber {
 
 ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
                                  const std::string& service_node_name)
-    : node_(node) {
+    : node_(node), service_node_name_(service_node_name) {
   get_parameter_client_ = node_->CreateClient<ParamName, Param>(
       FixParameterServiceName(service_node_name, GET_PARAMETER_SERVICE_NAME));
 
@@ -33,10 +33,27 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
   list_parameters_client_ = node_->CreateClient<NodeName, Params>(
       FixParameterServiceName(service_node_name, LIST_PARAMETERS_SERVICE_NAME));
+
+  get_parameters_client_ = node_->CreateClient<ParamNames, Params>(
+      FixParameterServiceName(service_node_name, GET_PARAMETERS_SERVICE_NAME));
+
+  set_parameters_client_ = node_->CreateClient<Params, BoolResult>(
+      FixParameterServiceName(service_node_name, SET_PARAMETERS_SERVICE_NAME));
+}
+
+ParameterClient::~ParameterClient() {
+  if (events_reader_ != nullptr) {
+    node_->DeleteReader(FixParameterServiceName(
+        service_node_name_, PARAMETER_EVENTS_CHANNEL_NAME));
+    events_reader_->Shutdown();
+  }
 }
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  if (GetCached(param_name, parameter)) {
+    return true;
+  }
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
@@ -78,5 +95,128 @@ bool ParameterClient::ListParameters(std::vector<Parameter>* parameters) {
   return true;
 }
 
+bool ParameterClient::GetParameters(
+    const std::vector<std::string>& param_names,
+    std::vector<Parameter>* parameters) {
+  auto request = std::make_shared<ParamNames>();
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    for (auto& param_name : param_names) {
+      auto ite = cached_ ? cache_.find(param_name) : cache_.end();
+      if (ite != cache_.end()) {
+        Parameter parameter;
+        parameter.FromProtoParam(ite->second);
+        parameters->emplace_back(parameter);
+      } else {
+        request->add_value(param_name);
+      }
+    }
+  }
+  if (request->value_size() == 0) {
+    return true;
+  }
+  auto response = get_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << get_parameters_client_->ServiceName() << " failed";
+    return false;
+  }
+  for (auto& param : response->param()) {
+    Parameter parameter;
+    parameter.FromProtoParam(param);
+    parameters->emplace_back(parameter);
+  }
+  return true;
+}
+
+bool ParameterClient::SetParameters(const std::vector<Parameter>& parameters) {
+  auto request = std::make_shared<Params>();
+  for (auto& parameter : parameters) {
+    *request->add_param() = parameter.ToProtoParam();
+  }
+  auto response = set_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << set_parameters_client_->ServiceName() << " failed";
+    return false;
+  }
+  return response->value();
+}
+
+bool ParameterClient::Watch(const WatchCallback& callback) {
+  if (events_reader_ != nullptr) {
+    AERROR << "Already watching " << service_node_name_;
+    return false;
+  }
+  watch_callback_ = callback;
+  // subscribe first, the changes racing the list carry newer versions
+  events_reader_ = node_->CreateReader<Params>(
+      FixParameterServiceName(service_node_name_,
+                              PARAMETER_EVENTS_CHANNEL_NAME),
+      [this](const std::shared_ptr<Params>& params) { OnChange(params); });
+  if (events_reader_ == nullptr) {
+    AERROR << "Subscribe changes of " << service_node_name_ << " failed";
+    return false;
+  }
+
+  auto request = std::make_shared<NodeName>();
+  request->set_value(node_->Name());
+  auto response = list_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << list_parameters_client_->ServiceName() << " failed";
+    node_->DeleteReader(events_reader_->GetChannelName());
+    events_reader_->Shutdown();
+    events_reader_ = nullptr;
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    cache_.clear();
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  for (auto& param : response->param()) {
+    Merge(param);
+  }
+  cached_ = true;
+  return true;
+}
+
+bool ParameterClient::Merge(const Param& param) {
+  auto& cached = cache_[param.name()];
+  if (cached.version() >= param.version() && cached.has_name()) {
+    return false;
+  }
+  cached.CopyFrom(param);
+  return true;
+}
+
+void ParameterClient::OnChange(const std::shared_ptr<Params>& params) {
+  std::vector<Parameter> changed;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    for (auto& param : params->param()) {
+      if (Merge(param) && watch_callback_ != nullptr) {
+        Parameter parameter;
+        parameter.FromProtoParam(param);
+        changed.emplace_back(parameter);
+      }
+    }
+  }
+  for (auto& parameter : changed) {
+    watch_callback_(parameter);
+  }
+}
+
+bool ParameterClient::GetCached(const std::string& param_name,
+                                Parameter* parameter) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (!cached_) {
+    return false;
+  }
+  // a miss may be a change still on its way, ask the server then
+  auto ite = cache_.find(param_name);
+  if (ite == cache_.end()) {
+    return false;
+  }
+  parameter->FromProtoParam(ite->second);
+  return true;
+}
+
 }  // namespace cyber
 }  // namespace apollo
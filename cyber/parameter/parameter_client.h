@@ -17,12 +17,16 @@
 #ifndef CYBER_PARAMETER_PARAMETER_CLIENT_H_
 #define CYBER_PARAMETER_PARAMETER_CLIENT_H_
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "cyber/proto/parameter.pb.h"
 
+#include "cyber/node/reader.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/service/client.h"
 
@@ -35,17 +39,24 @@ class Node;
  * @class ParameterClient
  * @brief Parameter Client is used to set/get/list parameter(s)
  * by sending a request to ParameterServer
+ *
+ * After Watch() it keeps a copy of the parameters of the server, updated by
+ * the changes the server publishes, and gets parameters from that copy.
  */
 class ParameterClient {
  public:
   using Param = apollo::cyber::proto::Param;
   using NodeName = apollo::cyber::proto::NodeName;
   using ParamName = apollo::cyber::proto::ParamName;
+  using ParamNames = apollo::cyber::proto::ParamNames;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
   using GetParameterClient = Client<ParamName, Param>;
   using SetParameterClient = Client<Param, BoolResult>;
   using ListParametersClient = Client<NodeName, Params>;
+  using GetParametersClient = Client<ParamNames, Params>;
+  using SetParametersClient = Client<Params, BoolResult>;
+  using WatchCallback = std::function<void(const Parameter&)>;
   /**
    * @brief Construct a new ParameterClient object
    *
@@ -55,6 +66,8 @@ class ParameterClient {
   ParameterClient(const std::shared_ptr<Node>& node,
                   const std::string& service_node_name);
 
+  ~ParameterClient();
+
   /**
    * @brief Get the Parameter object
    *
@@ -85,11 +98,55 @@ class ParameterClient {
    */
   bool ListParameters(std::vector<Parameter>* parameters);
 
+  /**
+   * @brief Get parameters in one request
+   *
+   * @param param_names names of the parameters
+   * @param parameters pointer of vector to store the parameters found
+   * @return true
+   * @return false call service fail or timeout
+   */
+  bool GetParameters(const std::vector<std::string>& param_names,
+                     std::vector<Parameter>* parameters);
+
+  /**
+   * @brief Set parameters in one request
+   *
+   * @param parameters parameters to be set
+   * @return true set parameters succues
+   * @return false call service fail or timeout
+   */
+  bool SetParameters(const std::vector<Parameter>& parameters);
+
+  /**
+   * @brief Copy all the parameters of the server and follow its changes
+   *
+   * @param callback invoked with every changed parameter, may be nullptr
+   * @return true
+   * @return false subscribe or list fail, nothing is cached
+   */
+  bool Watch(const WatchCallback& callback = nullptr);
+
  private:
+  // keeps the newer of the cached and the given version, false if the
+  // cached one is newer, cache_mutex_ held
+  bool Merge(const Param& param);
+  void OnChange(const std::shared_ptr<Params>& params);
+  bool GetCached(const std::string& param_name, Parameter* parameter);
+
   std::shared_ptr<Node> node_;
+  std::string service_node_name_;
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::shared_ptr<GetParametersClient> get_parameters_client_;
+  std::shared_ptr<SetParametersClient> set_parameters_client_;
+
+  std::shared_ptr<Reader<Params>> events_reader_;
+  WatchCallback watch_callback_;
+  std::mutex cache_mutex_;
+  bool cached_ = false;
+  std::unordered_map<std::string, Param> cache_;
 };
 
 }  // namespace cyber
@@ -25,60 +25,128 @@ namespace cyber {
 ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
     : node_(node) {
   auto name = node_->Name();
+  events_writer_ = node_->CreateWriter<Params>(
+      FixParameterServiceName(name, PARAMETER_EVENTS_CHANNEL_NAME));
+
+  // lookups touch one shard each, let them run side by side
+  ServiceConfig read_config;
+  read_config.executor = ServiceExecutor::THREAD_POOL;
   get_parameter_service_ = node_->CreateService<ParamName, Param>(
       FixParameterServiceName(name, GET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<ParamName>& request,
              std::shared_ptr<Param>& response) {
-        std::lock_guard<std::mutex> lock(param_map_mutex_);
-        if (param_map_.find(request->value()) != param_map_.end()) {
-          response->CopyFrom(param_map_[request->value()]);
-        } else {
+        if (!Lookup(request->value(), response.get())) {
           AINFO << "GetParameterService: [" << request->value() << "] not set";
         }
-      });
+      },
+      read_config);
 
   set_parameter_service_ = node_->CreateService<Param, BoolResult>(
       FixParameterServiceName(name, SET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<Param>& request,
              std::shared_ptr<BoolResult>& response) {
-        std::lock_guard<std::mutex> lock(param_map_mutex_);
-        param_map_[request->name()] = *request;
+        Params params;
+        params.add_param()->CopyFrom(*request);
+        Store(&params);
         response->set_value(true);
       });
 
   list_parameters_service_ = node_->CreateService<NodeName, Params>(
       FixParameterServiceName(name, LIST_PARAMETERS_SERVICE_NAME),
       [this](const std::shared_ptr<NodeName>& request,
+             std::shared_ptr<Params>& response) { List(response.get()); },
+      read_config);
+
+  get_parameters_service_ = node_->CreateService<ParamNames, Params>(
+      FixParameterServiceName(name, GET_PARAMETERS_SERVICE_NAME),
+      [this](const std::shared_ptr<ParamNames>& request,
              std::shared_ptr<Params>& response) {
-        std::lock_guard<std::mutex> lock(param_map_mutex_);
-        for (auto& item : param_map_) {
-          auto param = response->add_param();
-          param->CopyFrom(item.second);
+        Param param;
+        for (auto& param_name : request->value()) {
+          if (Lookup(param_name, &param)) {
+            response->add_param()->Swap(&param);
+          }
         }
+      },
+      read_config);
+
+  set_parameters_service_ = node_->CreateService<Params, BoolResult>(
+      FixParameterServiceName(name, SET_PARAMETERS_SERVICE_NAME),
+      [this](const std::shared_ptr<Params>& request,
+             std::shared_ptr<BoolResult>& response) {
+        Params params(*request);
+        Store(&params);
+        response->set_value(true);
       });
 }
 
+ParameterServer::Shard& ParameterServer::ShardOf(const std::string& name) {
+  return shards_[std::hash<std::string>()(name) % kShardNum];
+}
+
+void ParameterServer::Store(Params* params) {
+  for (auto& param : *params->mutable_param()) {
+    auto& shard = ShardOf(param.name());
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    // under the shard lock, the versions of one parameter only grow
+    param.set_version(++version_);
+    shard.params[param.name()] = param;
+  }
+  if (events_writer_ != nullptr && params->param_size() > 0) {
+    events_writer_->Write(*params);
+  }
+}
+
+bool ParameterServer::Lookup(const std::string& name, Param* param) {
+  auto& shard = ShardOf(name);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto ite = shard.params.find(name);
+  if (ite == shard.params.end()) {
+    return false;
+  }
+  param->CopyFrom(ite->second);
+  return true;
+}
+
+void ParameterServer::List(Params* params) {
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto& item : shard.params) {
+      params->add_param()->CopyFrom(item.second);
+    }
+  }
+}
+
 void ParameterServer::SetParameter(const Parameter& parameter) {
-  std::lock_guard<std::mutex> lock(param_map_mutex_);
-  param_map_[parameter.Name()] = parameter.ToProtoParam();
+  Params params;
+  *params.add_param() = parameter.ToProtoParam();
+  Store(&params);
+}
+
+void ParameterServer::SetParameters(const std::vector<Parameter>& parameters) {
+  Params params;
+  for (auto& parameter : parameters) {
+    *params.add_param() = parameter.ToProtoParam();
+  }
+  Store(&params);
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
                                    Parameter* parameter) {
-  std::lock_guard<std::mutex> lock(param_map_mutex_);
-  auto ite = param_map_.find(parameter_name);
-  if (ite == param_map_.end()) {
+  Param param;
+  if (!Lookup(parameter_name, &param)) {
     return false;
   }
-  parameter->FromProtoParam(ite->second);
+  parameter->FromProtoParam(param);
   return true;
 }
 
 void ParameterServer::ListParameters(std::vector<Parameter>* parameters) {
-  std::lock_guard<std::mutex> lock(param_map_mutex_);
-  for (auto& item : param_map_) {
+  Params params;
+  List(&params);
+  for (auto& param : params.param()) {
     Parameter parameter;
-    parameter.FromProtoParam(item.second);
+    parameter.FromProtoParam(param);
     parameters->emplace_back(parameter);
   }
 }
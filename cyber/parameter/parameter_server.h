@@ -17,13 +17,17 @@
 #ifndef CYBER_PARAMETER_PARAMETER_SERVER_H_
 #define CYBER_PARAMETER_PARAMETER_SERVER_H_
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "cyber/proto/parameter.pb.h"
 
+#include "cyber/node/writer.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/service/service.h"
 
@@ -39,6 +43,10 @@ class Node;
  * Routing, sensor internal/external references are set by Parameter Service
  * ParameterServer can set a parameter, and then you can get/list
  * paramter(s) by start a ParameterClient to send responding request
+ *
+ * Parameters are spread over mutex guarded shards by name, each carries the
+ * version of its last change. Every change is published on the
+ * `parameter_events` channel, so clients may keep a local copy.
  * @warning You should only have one ParameterServer works
  */
 class ParameterServer {
@@ -46,6 +54,7 @@ class ParameterServer {
   using Param = apollo::cyber::proto::Param;
   using NodeName = apollo::cyber::proto::NodeName;
   using ParamName = apollo::cyber::proto::ParamName;
+  using ParamNames = apollo::cyber::proto::ParamNames;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
   /**
@@ -62,6 +71,13 @@ class ParameterServer {
    */
   void SetParameter(const Parameter& parmeter);
 
+  /**
+   * @brief Set parameters at once, published as one change
+   *
+   * @param parameters parameters to be set
+   */
+  void SetParameters(const std::vector<Parameter>& parameters);
+
   /**
    * @brief Get the Parameter object
    *
@@ -80,13 +96,28 @@ class ParameterServer {
   void ListParameters(std::vector<Parameter>* parameters);
 
  private:
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<std::string, Param> params;
+  };
+
+  Shard& ShardOf(const std::string& name);
+  // stores the params under new versions and publishes them
+  void Store(Params* params);
+  bool Lookup(const std::string& name, Param* param);
+  void List(Params* params);
+
   std::shared_ptr<Node> node_;
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  std::shared_ptr<Service<ParamNames, Params>> get_parameters_service_;
+  std::shared_ptr<Service<Params, BoolResult>> set_parameters_service_;
+  std::shared_ptr<Writer<Params>> events_writer_;
 
-  std::mutex param_map_mutex_;
-  std::unordered_map<std::string, Param> param_map_;
+  static constexpr size_t kShardNum = 16;
+  std::array<Shard, kShardNum> shards_;
+  std::atomic<uint64_t> version_ = {0};
 };
 
 }  // namespace cyber
@@ -16,7 +16,9 @@
 
 #include "cyber/parameter/parameter_client.h"
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -88,5 +90,61 @@ TEST_F(ParameterClientTest, list_parameter) {
   EXPECT_FALSE(pc_->ListParameters(&parameters));
 }
 
+TEST_F(ParameterClientTest, batch) {
+  std::vector<Parameter> parameters;
+  parameters.emplace_back("int", 1);
+  parameters.emplace_back("double", 2.0);
+  EXPECT_TRUE(pc_->SetParameters(parameters));
+  parameters.clear();
+  EXPECT_TRUE(pc_->GetParameters({"int", "double", "string"}, &parameters));
+  ASSERT_EQ(2, parameters.size());
+  EXPECT_EQ("int", parameters[0].Name());
+  EXPECT_EQ(1, parameters[0].AsInt64());
+  EXPECT_EQ("double", parameters[1].Name());
+  EXPECT_EQ(2.0, parameters[1].AsDouble());
+}
+
+TEST_F(ParameterClientTest, watch) {
+  ps_->SetParameter(Parameter("int", 1));
+  std::atomic<int> changes = {0};
+  std::atomic<int64_t> last = {0};
+  EXPECT_TRUE(pc_->Watch([&](const Parameter& parameter) {
+    if (parameter.Name() == "int") {
+      last = parameter.AsInt64();
+    }
+    ++changes;
+  }));
+  EXPECT_FALSE(pc_->Watch());
+
+  // answered from the copy, even with the server gone
+  Parameter parameter;
+  auto server = std::move(ps_);
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(1, parameter.AsInt64());
+
+  std::vector<Parameter> parameters;
+  parameters.emplace_back("int", 2);
+  parameters.emplace_back("string", "value");
+  server->SetParameters(parameters);
+  for (int i = 0; i < 100 && changes.load() < 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(2, changes.load());
+  EXPECT_EQ(2, last.load());
+  server.reset();
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(2, parameter.AsInt64());
+  parameters.clear();
+  EXPECT_TRUE(pc_->GetParameters({"int", "string"}, &parameters));
+  ASSERT_EQ(2, parameters.size());
+  EXPECT_EQ("value", parameters[1].AsString());
+
+  // a client of the same node may watch again once this one is gone
+  pc_.reset();
+  pc_.reset(new ParameterClient(node_, "parameter_server"));
+  ps_.reset(new ParameterServer(node_));
+  EXPECT_TRUE(pc_->Watch());
+}
+
 }  // namespace cyber
 }  // namespace apollo
@@ -68,5 +68,19 @@ TEST_F(ParameterServerTest, list_parameter) {
   EXPECT_EQ(1, parameters[0].AsInt64());
 }
 
+TEST_F(ParameterServerTest, set_parameters) {
+  std::vector<Parameter> parameters;
+  parameters.emplace_back("int", 1);
+  parameters.emplace_back("string", "value");
+  ps_->SetParameters(parameters);
+  parameters.clear();
+  ps_->ListParameters(&parameters);
+  EXPECT_EQ(2, parameters.size());
+  Parameter parameter;
+  EXPECT_TRUE(ps_->GetParameter("string", &parameter));
+  EXPECT_EQ("value", parameter.AsString());
+  EXPECT_FALSE(ps_->GetParameter("double", &parameter));
+}
+
 }  // namespace cyber
 }  // namespace apollo
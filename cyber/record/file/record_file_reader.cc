@@ -16,6 +16,10 @@
 
 #include "cyber/record/file/record_file_reader.h"
 
+#include <sys/stat.h>
+
+#include <unordered_map>
+
 #include "cyber/common/file.h"
 
 namespace apollo {
@@ -82,6 +86,11 @@ bool RecordFileReader::ReadHeader() {
 
 bool RecordFileReader::ReadIndex() {
 	if (!header_.is_complete()) {
+		if (header_.checkpoint_position() > 0 && ReadCheckpoint()) {
+			AINFO << "Record file is not complete, index is rebuilt from checkpoint"
+				<< ", chunk number: " << header_.chunk_number();
+			return true;
+		}
 		AERROR << "Record file is not complete.";
 		return false;
 	}
@@ -104,10 +113,254 @@ bool RecordFileReader::ReadIndex() {
 		AERROR << "Read index section fail.";
 		return false;
 	}
+	chunk_body_positions_.clear();
+	for (int i = 0; i < index_.indexes_size(); ++i) {
+		if (index_.indexes(i).type() == SectionType::SECTION_CHUNK_BODY) {
+			chunk_body_positions_.push_back(index_.indexes(i).position());
+		}
+	}
+	Reset();
+	return true;
+}
+
+bool RecordFileReader::ReadCheckpoint(uint64_t position,
+	proto::IndexCheckpoint* checkpoint) {
+	if (!SetPosition(position)) {
+		AERROR << "Skip bytes for reaching the checkpoint section failed.";
+		return false;
+	}
+	Section section;
+	if (!ReadSection(&section)) {
+		AERROR << "Read checkpoint section fail, maybe file is broken.";
+		return false;
+	}
+	if (section.type != SectionType::SECTION_INDEX_CHECKPOINT) {
+		AERROR << "Check section type failed"
+			<< ", expect: " << SectionType::SECTION_INDEX_CHECKPOINT
+			<< ", actual: " << section.type;
+		return false;
+	}
+	if (!ReadSection<proto::IndexCheckpoint>(section.size, checkpoint)) {
+		AERROR << "Read checkpoint section fail.";
+		return false;
+	}
+	return true;
+}
+
+bool RecordFileReader::ReadCheckpoint() {
+	uint64_t checkpoint_position = header_.checkpoint_position();
+	proto::IndexCheckpoint last;
+	if (!ReadCheckpoint(checkpoint_position, &last)) {
+		return false;
+	}
+	uint64_t valid_end_position = CurrentPosition();
+
+	// each checkpoint only holds the sections added since the one before,
+	// walk back to the first and replay them in file order
+	std::vector<proto::IndexCheckpoint> chain;
+	chain.push_back(last);
+	uint64_t position = checkpoint_position;
+	while (chain.back().previous_position() > 0) {
+		if (chain.back().previous_position() >= position) {
+			AERROR << "Checkpoint chain does not go backwards, file is broken.";
+			return false;
+		}
+		position = chain.back().previous_position();
+		chain.emplace_back();
+		if (!ReadCheckpoint(position, &chain.back())) {
+			return false;
+		}
+	}
+
+	header_ = last.header();
+	header_.set_checkpoint_position(checkpoint_position);
+	index_.Clear();
+	// channel caches carry counts, the latest ones are right
+	for (const auto& row : last.index().indexes()) {
+		if (row.type() == SectionType::SECTION_CHANNEL) {
+			*index_.add_indexes() = row;
+		}
+	}
+	for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+		for (const auto& row : it->index().indexes()) {
+			if (row.type() != SectionType::SECTION_CHANNEL) {
+				*index_.add_indexes() = row;
+			}
+		}
+	}
+	auto single_index = index_.add_indexes();
+	single_index->set_type(SectionType::SECTION_INDEX_CHECKPOINT);
+	single_index->set_position(checkpoint_position);
+	if (!SetPosition(valid_end_position)) {
+		AERROR << "Jump back to position #" << valid_end_position << " failed";
+		return false;
+	}
+	valid_end_position_ = valid_end_position;
+	ScanTail();
+	header_.set_size(valid_end_position_);
+
+	chunk_body_positions_.clear();
+	for (int i = 0; i < index_.indexes_size(); ++i) {
+		if (index_.indexes(i).type() == SectionType::SECTION_CHUNK_BODY) {
+			chunk_body_positions_.push_back(index_.indexes(i).position());
+		}
+	}
+	Reset();
+	return true;
+}
+
+void RecordFileReader::ScanTail() {
+	struct stat file_stat;
+	if (fstat(fd_, &file_stat) < 0) {
+		AERROR << "Stat file failed, file: " << path_ << ", errno: " << errno;
+		return;
+	}
+	std::unordered_map<std::string, proto::ChannelCache*> channel_caches;
+	for (int i = 0; i < index_.indexes_size(); ++i) {
+		auto single_index = index_.mutable_indexes(i);
+		if (single_index->type() == SectionType::SECTION_CHANNEL) {
+			channel_caches[single_index->channel_cache().name()] =
+				single_index->mutable_channel_cache();
+		}
+	}
+
+	bool has_chunk_header = false;
+	uint64_t chunk_header_pos = 0;
+	proto::ChunkHeader chunk_header;
+	while (true) {
+		int64_t pos = CurrentPosition();
+		Section section;
+		if (!ReadSection(&section)) {
+			break;
+		}
+		// anything running past the end of the file was cut by the crash
+		if (section.size < 0 ||
+			pos + static_cast<int64_t>(sizeof(section)) + section.size > file_stat.st_size) {
+			break;
+		}
+		if (section.type == SectionType::SECTION_CHANNEL) {
+			proto::Channel channel;
+			if (!ReadSection<proto::Channel>(section.size, &channel)) {
+				break;
+			}
+			if (channel_caches.find(channel.name()) == channel_caches.end()) {
+				auto single_index = index_.add_indexes();
+				single_index->set_type(SectionType::SECTION_CHANNEL);
+				single_index->set_position(pos);
+				auto channel_cache = single_index->mutable_channel_cache();
+				channel_cache->set_name(channel.name());
+				channel_cache->set_message_number(0);
+				channel_cache->set_message_type(channel.message_type());
+				channel_cache->set_proto_desc(channel.proto_desc());
+				channel_caches[channel.name()] = channel_cache;
+				header_.set_channel_number(header_.channel_number() + 1);
+			}
+		} else if (section.type == SectionType::SECTION_CHUNK_HEADER) {
+			if (!ReadSection<proto::ChunkHeader>(section.size, &chunk_header)) {
+				break;
+			}
+			has_chunk_header = true;
+			chunk_header_pos = pos;
+			// a chunk only counts once its body is complete as well
+			continue;
+		} else if (section.type == SectionType::SECTION_CHUNK_BODY) {
+			proto::ChunkBody chunk_body;
+			if (!has_chunk_header ||
+				!ReadSection<proto::ChunkBody>(section.size, &chunk_body)) {
+				break;
+			}
+			has_chunk_header = false;
+			auto single_index = index_.add_indexes();
+			single_index->set_type(SectionType::SECTION_CHUNK_HEADER);
+			single_index->set_position(chunk_header_pos);
+			auto chunk_header_cache = single_index->mutable_chunk_header_cache();
+			chunk_header_cache->set_begin_time(chunk_header.begin_time());
+			chunk_header_cache->set_end_time(chunk_header.end_time());
+			chunk_header_cache->set_message_number(chunk_header.message_number());
+			chunk_header_cache->set_raw_size(chunk_header.raw_size());
+			single_index = index_.add_indexes();
+			single_index->set_type(SectionType::SECTION_CHUNK_BODY);
+			single_index->set_position(pos);
+			single_index->mutable_chunk_body_cache()->set_message_number(chunk_body.messages_size());
+
+			header_.set_chunk_number(header_.chunk_number() + 1);
+			if (header_.begin_time() == 0) {
+				header_.set_begin_time(chunk_header.begin_time());
+			}
+			header_.set_end_time(chunk_header.end_time());
+			header_.set_message_number(header_.message_number() + chunk_header.message_number());
+			for (int i = 0; i < chunk_body.messages_size(); ++i) {
+				auto search = channel_caches.find(chunk_body.messages(i).channel_name());
+				if (search != channel_caches.end()) {
+					search->second->set_message_number(search->second->message_number() + 1);
+				}
+			}
+		} else if (section.type == SectionType::SECTION_INDEX_CHECKPOINT) {
+			// written after the checkpoint the header points to
+			if (!SkipSection(section.size)) {
+				break;
+			}
+			auto single_index = index_.add_indexes();
+			single_index->set_type(SectionType::SECTION_INDEX_CHECKPOINT);
+			single_index->set_position(pos);
+		} else {
+			break;
+		}
+		valid_end_position_ = CurrentPosition();
+	}
+	end_of_file_ = false;
+}
+
+bool RecordFileReader::ReadTimeIndex() {
+	if (header_.time_index_position() == 0) {
+		AERROR << "Record file has no time index, file: " << path_;
+		return false;
+	}
+	if (!SetPosition(header_.time_index_position())) {
+		AERROR << "Skip bytes for reaching the time index section failed.";
+		return false;
+	}
+	Section section;
+	if (!ReadSection(&section)) {
+		AERROR << "Read time index section fail, maybe file is broken.";
+		return false;
+	}
+	if (section.type != SectionType::SECTION_TIME_INDEX) {
+		AERROR << "Check section type failed"
+			<< ", expect: " << SectionType::SECTION_TIME_INDEX
+			<< ", actual: " << section.type;
+		return false;
+	}
+	if (!ReadSection<proto::TimeIndex>(section.size, &time_index_)) {
+		AERROR << "Read time index section fail.";
+		return false;
+	}
 	Reset();
 	return true;
 }
 
+bool RecordFileReader::ReadIndexedMessage(uint32_t chunk, uint64_t offset,
+	uint32_t size, proto::SingleMessage* message) {
+	if (chunk >= chunk_body_positions_.size()) {
+		AERROR << "Chunk ordinal out of range: " << chunk
+			<< ", chunk number: " << chunk_body_positions_.size();
+		return false;
+	}
+	std::string buffer(size, '\0');
+	off_t position = static_cast<off_t>(chunk_body_positions_[chunk] + sizeof(struct Section) + offset);
+	ssize_t count = pread(fd_, &buffer[0], size, position);
+	if (count != static_cast<ssize_t>(size)) {
+		AERROR << "Read fd failed, fd_: " << fd_ << ", position: " << position
+			<< ", expect count: " << size << ", actual count: " << count;
+		return false;
+	}
+	if (!message->ParseFromString(buffer)) {
+		AERROR << "Parse indexed message failed, position: " << position;
+		return false;
+	}
+	return true;
+}
+
 bool RecordFileReader::ReadSection(Section* section) {
 	ssize_t count = read(fd_, section, sizeof(struct Section));
 	if (count < 0) {
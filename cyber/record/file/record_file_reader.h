@@ -22,6 +22,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <limits>
 #include "google/protobuf/io/coded_stream.h"
@@ -53,12 +54,29 @@ public:
 	bool SkipSection(int64_t size);
 	template <typename T>
 	bool ReadSection(int64_t size, T* message);
+	// for a file that was never closed the index is rebuilt from the last
+	// checkpoint plus a scan of the sections written after it
 	bool ReadIndex();
+	// end of the last complete section found by the checkpoint tail scan
+	uint64_t valid_end_position() const { return valid_end_position_; }
+	// needs ReadIndex() first to resolve chunk ordinals to file positions
+	bool ReadTimeIndex();
+	const proto::TimeIndex& GetTimeIndex() const { return time_index_; }
+	// positioned read of one message located by the time index, the
+	// sequential read position is left untouched
+	bool ReadIndexedMessage(uint32_t chunk, uint64_t offset, uint32_t size,
+		proto::SingleMessage* message);
 	bool EndOfFile() { return end_of_file_; }
 
 private:
 	bool ReadHeader();
+	bool ReadCheckpoint();
+	bool ReadCheckpoint(uint64_t position, proto::IndexCheckpoint* checkpoint);
+	void ScanTail();
 	bool end_of_file_ = false;
+	uint64_t valid_end_position_ = 0;
+	proto::TimeIndex time_index_;
+	std::vector<uint64_t> chunk_body_positions_;
 };
 
 template <typename T>
@@ -32,8 +32,10 @@ using apollo::cyber::proto::ChunkBodyCache;
 using apollo::cyber::proto::ChunkHeader;
 using apollo::cyber::proto::ChunkHeaderCache;
 using apollo::cyber::proto::Header;
+using apollo::cyber::proto::IndexCheckpoint;
 using apollo::cyber::proto::SectionType;
 using apollo::cyber::proto::SingleIndex;
+using apollo::cyber::proto::TimeIndex;
 
 RecordFileWriter::RecordFileWriter() : is_writing_(false) {}
 
@@ -104,6 +106,10 @@ void RecordFileWriter::Close() {
 			AERROR << "Write index section failed, file: " << path_;
 		}
 
+		if (header_.time_index() && !WriteTimeIndex()) {
+			AERROR << "Write time index section failed, file: " << path_;
+		}
+
 		header_.set_is_complete(true);
 		if (!WriteHeader(header_)) {
 			AERROR << "Overwrite header section failed, file: " << path_;
@@ -137,6 +143,10 @@ bool RecordFileWriter::WriteIndex() {
 				channel_cache->set_message_number(
 				channel_message_number_map_[channel_cache->name()]);
 			}
+			auto search = dropped_number_map_.find(channel_cache->name());
+			if (search != dropped_number_map_.end()) {
+				channel_cache->set_dropped_number(search->second);
+			}
 		}
 	}
 	header_.set_index_position(CurrentPosition());
@@ -147,6 +157,39 @@ bool RecordFileWriter::WriteIndex() {
 	return true;
 }
 
+bool RecordFileWriter::WriteTimeIndex() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	TimeIndex time_index;
+	for (auto& item : time_index_map_) {
+		time_index.add_channels()->Swap(&item.second);
+	}
+	time_index_map_.clear();
+	// the time index trails the index section, readers that do not know it
+	// stop at the index section as before
+	header_.set_time_index_position(CurrentPosition());
+	if (!WriteSection<TimeIndex>(time_index)) {
+		AERROR << "Write section fail";
+		header_.set_time_index_position(0);
+		return false;
+	}
+	return true;
+}
+
+void RecordFileWriter::AddTimeIndex(const Chunk::LocationMap& locations, uint32_t chunk_ordinal) {
+	for (auto& item : locations) {
+		auto& channel_index = time_index_map_[item.first];
+		if (!channel_index.has_name()) {
+			channel_index.set_name(item.first);
+		}
+		for (auto& location : item.second) {
+			channel_index.add_time(location.time);
+			channel_index.add_chunk(chunk_ordinal);
+			channel_index.add_offset(location.offset);
+			channel_index.add_size(location.size);
+		}
+	}
+}
+
 bool RecordFileWriter::WriteChannel(const Channel& channel) {
 	std::lock_guard<std::mutex> lock(mutex_);
 	uint64_t pos = CurrentPosition();
@@ -202,11 +245,98 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header, const ChunkBo
 	ChunkBodyCache* chunk_body_cache = new ChunkBodyCache();
 	chunk_body_cache->set_message_number(chunk_body.messages_size());
 	single_index->set_allocated_chunk_body_cache(chunk_body_cache);
+
+	if (header_.checkpoint_chunk_number() == 0 && header_.checkpoint_interval() == 0) {
+		return true;
+	}
+	for (int i = 0; i < chunk_body.messages_size(); ++i) {
+		++flushed_message_number_map_[chunk_body.messages(i).channel_name()];
+	}
+	++chunks_since_checkpoint_;
+	if (NeedCheckpoint() && !WriteCheckpoint()) {
+		AERROR << "Write index checkpoint fail";
+	}
 	return true;
 }
 
+bool RecordFileWriter::NeedCheckpoint() {
+	if (header_.checkpoint_chunk_number() > 0 &&
+		chunks_since_checkpoint_ >= header_.checkpoint_chunk_number()) {
+		return true;
+	}
+	if (header_.checkpoint_interval() > 0) {
+		uint64_t now = Time::MonoTime().ToNanosecond();
+		if (last_checkpoint_time_ns_ == 0) {
+			last_checkpoint_time_ns_ = now;
+		}
+		return now - last_checkpoint_time_ns_ >= header_.checkpoint_interval();
+	}
+	return false;
+}
+
+bool RecordFileWriter::WriteCheckpoint() {
+	// called with mutex_ held, right after a complete chunk
+	// only what changed since the previous checkpoint, so checkpoints do not
+	// grow with the file: the channels with their current counts, which are
+	// few, and the sections appended meanwhile
+	IndexCheckpoint checkpoint;
+	checkpoint.set_previous_position(header_.checkpoint_position());
+	for (int i = 0; i < index_.indexes_size(); ++i) {
+		const SingleIndex& row = index_.indexes(i);
+		if (row.type() == SectionType::SECTION_CHANNEL) {
+			*checkpoint.mutable_index()->add_indexes() = row;
+		}
+	}
+	for (int i = checkpointed_index_size_; i < index_.indexes_size(); ++i) {
+		const SingleIndex& row = index_.indexes(i);
+		if (row.type() != SectionType::SECTION_CHANNEL) {
+			*checkpoint.mutable_index()->add_indexes() = row;
+		}
+	}
+	for (int i = 0; i < checkpoint.index().indexes_size(); ++i) {
+		SingleIndex* single_index = checkpoint.mutable_index()->mutable_indexes(i);
+		if (single_index->type() != SectionType::SECTION_CHANNEL) {
+			continue;
+		}
+		ChannelCache* channel_cache = single_index->mutable_channel_cache();
+		auto search = flushed_message_number_map_.find(channel_cache->name());
+		if (search != flushed_message_number_map_.end()) {
+			channel_cache->set_message_number(search->second);
+		}
+		auto dropped = dropped_number_map_.find(channel_cache->name());
+		if (dropped != dropped_number_map_.end()) {
+			channel_cache->set_dropped_number(dropped->second);
+		}
+	}
+	uint64_t pos = CurrentPosition();
+	*checkpoint.mutable_header() = header_;
+	if (!WriteSection<IndexCheckpoint>(checkpoint)) {
+		return false;
+	}
+	int64_t end = CurrentPosition();
+	// keep the index covering every section, readers skip checkpoints; this
+	// entry goes into the next checkpoint
+	checkpointed_index_size_ = index_.indexes_size();
+	SingleIndex* single_index = index_.add_indexes();
+	single_index->set_type(SectionType::SECTION_INDEX_CHECKPOINT);
+	single_index->set_position(pos);
+	chunks_since_checkpoint_ = 0;
+	last_checkpoint_time_ns_ = Time::MonoTime().ToNanosecond();
+
+	// publish the checkpoint through the header in place, then carry on
+	// appending at the end of the file
+	header_.set_checkpoint_position(pos);
+	bool ret = WriteSection<Header>(header_);
+	if (!SetPosition(end)) {
+		AERROR << "Jump back to position #" << end << " failed";
+		return false;
+	}
+	header_.set_size(end);
+	return ret;
+}
+
 bool RecordFileWriter::WriteMessage(const proto::SingleMessage& message) {
-	chunk_active_->add(message);
+	chunk_active_->add(message, header_.time_index());
 	auto it = channel_message_number_map_.find(message.channel_name());
 	if (it != channel_message_number_map_.end()) {
 		it->second++;
@@ -243,13 +373,69 @@ void RecordFileWriter::Flush() {
 		if (chunk_flush_->empty()) {
 			continue;
 		}
+		uint32_t chunk_ordinal = static_cast<uint32_t>(header_.chunk_number());
 		if (!WriteChunk(chunk_flush_->header_, *(chunk_flush_->body_.get()))) {
 			AERROR << "Write chunk fail.";
+		} else if (header_.time_index()) {
+			AddTimeIndex(chunk_flush_->locations_, chunk_ordinal);
 		}
 		chunk_flush_->clear();
 	}
 }
 
+bool RecordFileWriter::Finalize(const std::string& path, const Header& header,
+	const proto::Index& index, uint64_t position) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (is_writing_) {
+		AERROR << "Writer is busy with file: " << path_;
+		return false;
+	}
+	path_ = path;
+	fd_ = open(path_.data(), O_WRONLY);
+	if (fd_ < 0) {
+		AERROR << "Open file failed, file: " << path_ << ", fd: " << fd_
+			<< ", errno: " << errno;
+		return false;
+	}
+	header_ = header;
+	index_ = index;
+	bool ret = WriteTrailer(position);
+	if (close(fd_) < 0) {
+		AERROR << "Close file failed, file: " << path_ << ", fd: " << fd_
+			<< ", errno: " << errno;
+	}
+	fd_ = -1;
+	return ret;
+}
+
+bool RecordFileWriter::WriteTrailer(uint64_t position) {
+	if (ftruncate(fd_, static_cast<off_t>(position)) < 0) {
+		AERROR << "Truncate file failed, file: " << path_ << ", errno: " << errno;
+		return false;
+	}
+	if (!SetPosition(position)) {
+		AERROR << "Jump to position #" << position << " failed";
+		return false;
+	}
+	header_.set_index_position(position);
+	if (!WriteSection<proto::Index>(index_)) {
+		AERROR << "Write index section fail";
+		return false;
+	}
+	header_.set_is_complete(true);
+	if (!WriteSection<Header>(header_)) {
+		AERROR << "Write header section fail";
+		return false;
+	}
+	return true;
+}
+
+void RecordFileWriter::AddDroppedNumber(const std::string& channel_name, uint64_t count) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	dropped_number_map_[channel_name] += count;
+	header_.set_dropped_number(header_.dropped_number() + count);
+}
+
 uint64_t RecordFileWriter::GetMessageNumber(const std::string& channel_name) const {
 	auto search = channel_message_number_map_.find(channel_name);
 	if (search != channel_message_number_map_.end()) {
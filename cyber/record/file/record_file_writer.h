@@ -25,8 +25,10 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <atomic>
 
+#include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 #include "google/protobuf/message.h"
 #include "google/protobuf/text_format.h"
@@ -43,18 +45,36 @@ namespace record {
 struct Chunk {
 	Chunk() { clear(); }
 
+	// location of one message inside the chunk body, used by the time index
+	struct MessageLocation {
+		uint64_t time;
+		uint64_t offset;
+		uint32_t size;
+	};
+	using LocationMap = std::unordered_map<std::string, std::vector<MessageLocation>>;
+
 	inline void clear() {
 		body_.reset(new proto::ChunkBody());
 		header_.set_begin_time(0);
 		header_.set_end_time(0);
 		header_.set_message_number(0);
 		header_.set_raw_size(0);
+		body_size_ = 0;
+		locations_.clear();
 	}
 
-	inline void add(const proto::SingleMessage& message) {
+	inline void add(const proto::SingleMessage& message, bool with_location = false) {
 		std::lock_guard<std::mutex> lock(mutex_);
 		proto::SingleMessage* p_message = body_->add_messages();
 		*p_message = message;
+		if (with_location) {
+			// every element of ChunkBody.messages is serialized as
+			// tag(1 byte) + varint(size) + bytes, in insertion order
+			uint32_t size = static_cast<uint32_t>(message.ByteSizeLong());
+			body_size_ += 1 + google::protobuf::io::CodedOutputStream::VarintSize32(size);
+			locations_[message.channel_name()].push_back({message.time(), body_size_, size});
+			body_size_ += size;
+		}
 		if (header_.begin_time() == 0) {
 			header_.set_begin_time(message.time());
 		}
@@ -73,6 +93,8 @@ struct Chunk {
 	std::mutex mutex_;
 	proto::ChunkHeader header_;
 	std::unique_ptr<proto::ChunkBody> body_ = nullptr;
+	uint64_t body_size_ = 0;
+	LocationMap locations_;
 };
 
 class RecordFileWriter : public RecordFileBase {
@@ -85,6 +107,12 @@ public:
 	bool WriteChannel(const proto::Channel& channel);
 	bool WriteMessage(const proto::SingleMessage& message);
 	uint64_t GetMessageNumber(const std::string& channel_name) const;
+	// messages lost before reaching the writer, kept in the channel index
+	void AddDroppedNumber(const std::string& channel_name, uint64_t count);
+	// Finish a record file that was never closed: drop everything after
+	// |position|, then append the index and the complete header like Close().
+	bool Finalize(const std::string& path, const proto::Header& header,
+		const proto::Index& index, uint64_t position);
 
 private:
 	bool WriteChunk(const proto::ChunkHeader& chunk_header,
@@ -92,6 +120,11 @@ private:
 	template <typename T>
 	bool WriteSection(const T& message);
 	bool WriteIndex();
+	bool WriteTimeIndex();
+	bool NeedCheckpoint();
+	bool WriteCheckpoint();
+	bool WriteTrailer(uint64_t position);
+	void AddTimeIndex(const Chunk::LocationMap& locations, uint32_t chunk_ordinal);
 	void Flush();
 	std::atomic_bool is_writing_;
 	std::unique_ptr<Chunk> chunk_active_ = nullptr;
@@ -100,6 +133,14 @@ private:
 	std::mutex flush_mutex_;
 	std::condition_variable flush_cv_;
 	std::unordered_map<std::string, uint64_t> channel_message_number_map_;
+	std::unordered_map<std::string, proto::ChannelTimeIndex> time_index_map_;
+	// only touched by the flush thread, counts messages already on disk
+	std::unordered_map<std::string, uint64_t> flushed_message_number_map_;
+	std::unordered_map<std::string, uint64_t> dropped_number_map_;
+	uint64_t chunks_since_checkpoint_ = 0;
+	uint64_t last_checkpoint_time_ns_ = 0;
+	// first entry of index_ not covered by a checkpoint yet
+	int checkpointed_index_size_ = 0;
 };
 
 template <typename T>
@@ -119,6 +160,10 @@ bool RecordFileWriter::WriteSection(const T& message) {
 		}
 	} else if (std::is_same<T, proto::Index>::value) {
 		type = proto::SectionType::SECTION_INDEX;
+	} else if (std::is_same<T, proto::TimeIndex>::value) {
+		type = proto::SectionType::SECTION_TIME_INDEX;
+	} else if (std::is_same<T, proto::IndexCheckpoint>::value) {
+		type = proto::SectionType::SECTION_INDEX_CHECKPOINT;
 	} else {
 		AERROR << "Do not support this template typename.";
 		return false;
@@ -14,9 +14,13 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <signal.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #include <atomic>
+#include <chrono>
 #include <string>
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "cyber/record/file/record_file_base.h"
@@ -41,6 +45,7 @@ constexpr char kMsgType[] = "apollo.cyber.proto.Test";
 constexpr char kStr10B[] = "1234567890";
 constexpr char kTestFile1[] = "record_file_test_1.record";
 constexpr char kTestFile2[] = "record_file_test_2.record";
+constexpr char kTestFile3[] = "record_file_test_3.record";
 
 TEST(ChunkTest, TestAll) {
   Chunk ck;
@@ -306,6 +311,102 @@ TEST(RecordFileTest, TestIndex) {
   }
 }
 
+TEST(RecordFileTest, TestCheckpointAfterKill) {
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // writer process, never closes the file
+    RecordFileWriter rfw;
+    if (!rfw.Open(kTestFile3)) {
+      _exit(1);
+    }
+    Header header = HeaderBuilder::GetHeaderWithChunkParams(0, 100);
+    header.set_segment_interval(0);
+    header.set_segment_raw_size(0);
+    header.set_checkpoint_chunk_number(1);
+    rfw.WriteHeader(header);
+    Channel chan1;
+    chan1.set_name(kChan1);
+    chan1.set_message_type(kMsgType);
+    chan1.set_proto_desc(kStr10B);
+    rfw.WriteChannel(chan1);
+    for (uint64_t i = 1;; ++i) {
+      SingleMessage msg;
+      msg.set_channel_name(kChan1);
+      msg.set_content(kStr10B);
+      msg.set_time(i);
+      rfw.WriteMessage(msg);
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  kill(pid, SIGKILL);
+  int status = 0;
+  waitpid(pid, &status, 0);
+
+  Header header;
+  proto::Index index;
+  uint64_t valid_end = 0;
+  {
+    RecordFileReader reader;
+    ASSERT_TRUE(reader.Open(kTestFile3));
+    ASSERT_FALSE(reader.GetHeader().is_complete());
+    ASSERT_GT(reader.GetHeader().checkpoint_position(), 0);
+    ASSERT_TRUE(reader.ReadIndex());
+    header = reader.GetHeader();
+    index = reader.GetIndex();
+    valid_end = reader.valid_end_position();
+    ASSERT_GT(header.chunk_number(), 0);
+    ASSERT_GT(header.message_number(), 0);
+    ASSERT_EQ(1, header.channel_number());
+
+    // every indexed chunk body must be readable
+    uint64_t message_number = 0;
+    for (const auto& row : index.indexes()) {
+      if (row.type() != SectionType::SECTION_CHUNK_BODY) {
+        continue;
+      }
+      Section section;
+      ASSERT_TRUE(reader.SetPosition(row.position()));
+      ASSERT_TRUE(reader.ReadSection(&section));
+      ChunkBody body;
+      ASSERT_TRUE(reader.ReadSection(section.size, &body));
+      message_number += body.messages_size();
+    }
+    ASSERT_EQ(header.message_number(), message_number);
+
+    // a checkpoint per chunk holds the channel, that chunk's header and
+    // body and the previous checkpoint, however long the file is
+    int checkpoints = 0;
+    for (const auto& row : index.indexes()) {
+      if (row.type() != SectionType::SECTION_INDEX_CHECKPOINT) {
+        continue;
+      }
+      Section section;
+      ASSERT_TRUE(reader.SetPosition(row.position()));
+      ASSERT_TRUE(reader.ReadSection(&section));
+      proto::IndexCheckpoint checkpoint;
+      ASSERT_TRUE(reader.ReadSection(section.size, &checkpoint));
+      EXPECT_LE(checkpoint.index().indexes_size(), 4);
+      EXPECT_EQ(checkpoints == 0, checkpoint.previous_position() == 0);
+      ++checkpoints;
+    }
+    ASSERT_GT(checkpoints, 1);
+  }
+
+  RecordFileWriter rfw;
+  ASSERT_TRUE(rfw.Finalize(kTestFile3, header, index, valid_end));
+  {
+    RecordFileReader reader;
+    ASSERT_TRUE(reader.Open(kTestFile3));
+    ASSERT_TRUE(reader.GetHeader().is_complete());
+    ASSERT_EQ(header.message_number(), reader.GetHeader().message_number());
+    ASSERT_TRUE(reader.ReadIndex());
+    ASSERT_EQ(index.indexes_size(), reader.GetIndex().indexes_size());
+  }
+  ASSERT_FALSE(remove(kTestFile3));
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
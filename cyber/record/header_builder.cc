@@ -37,6 +37,8 @@ proto::Header HeaderBuilder::GetHeader() {
   header.set_message_number(0);
   header.set_size(0);
   header.set_is_complete(false);
+  header.set_checkpoint_chunk_number(CHECKPOINT_CHUNK_NUMBER_);
+  header.set_checkpoint_interval(CHECKPOINT_INTERVAL_);
   header.set_chunk_raw_size(CHUNK_RAW_SIZE_);
   header.set_segment_raw_size(SEGMENT_RAW_SIZE_);
   return header;
@@ -58,6 +60,8 @@ proto::Header HeaderBuilder::GetHeaderWithSegmentParams(
   header.set_message_number(0);
   header.set_size(0);
   header.set_is_complete(false);
+  header.set_checkpoint_chunk_number(CHECKPOINT_CHUNK_NUMBER_);
+  header.set_checkpoint_interval(CHECKPOINT_INTERVAL_);
   header.set_segment_raw_size(segment_raw_size);
   header.set_segment_interval(segment_interval);
   return header;
@@ -79,6 +83,8 @@ proto::Header HeaderBuilder::GetHeaderWithChunkParams(
   header.set_message_number(0);
   header.set_size(0);
   header.set_is_complete(false);
+  header.set_checkpoint_chunk_number(CHECKPOINT_CHUNK_NUMBER_);
+  header.set_checkpoint_interval(CHECKPOINT_INTERVAL_);
   header.set_chunk_interval(chunk_interval);
   header.set_chunk_raw_size(chunk_raw_size);
   return header;
@@ -68,6 +68,9 @@ class HeaderBuilder {
   static const uint64_t SEGMENT_INTERVAL_ = 60 * 1000 * 1000 * 1000ULL;  // 60s
   static const uint64_t CHUNK_RAW_SIZE_ = 200 * 1024 * 1024ULL;     // 200MB
   static const uint64_t SEGMENT_RAW_SIZE_ = 2048 * 1024 * 1024ULL;  // 2GB
+  // off: readers older than the checkpoint sections stop at them
+  static const uint64_t CHECKPOINT_CHUNK_NUMBER_ = 0;
+  static const uint64_t CHECKPOINT_INTERVAL_ = 0;
 };
 
 }  // namespace record
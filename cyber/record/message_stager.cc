@@ -0,0 +1,259 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/record/message_stager.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+using apollo::cyber::message::RawMessage;
+
+constexpr uint32_t MessageStager::kMaxBypass;
+
+bool ParseStagingPolicy(const std::string& name, StagingPolicy* policy) {
+  if (name == "block") {
+    *policy = StagingPolicy::BLOCK;
+  } else if (name == "drop-newest") {
+    *policy = StagingPolicy::DROP_NEWEST;
+  } else if (name == "drop-oldest") {
+    *policy = StagingPolicy::DROP_OLDEST;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+MessageStager::MessageStager(const WriteFunc& write_func, uint32_t queue_size,
+                             StagingPolicy policy)
+    : write_func_(write_func), queue_size_(queue_size), policy_(policy) {
+  if (queue_size_ == 0) {
+    AWARN << "staging queue size can not be 0, use 1 instead.";
+    queue_size_ = 1;
+  }
+}
+
+MessageStager::~MessageStager() { Stop(); }
+
+void MessageStager::SetDropCallback(const DropFunc& drop_func) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  drop_func_ = drop_func;
+}
+
+void MessageStager::AddChannel(const std::string& channel_name, int priority) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  GetQueue(channel_name, priority)->priority = priority;
+  std::stable_sort(queues_.begin(), queues_.end(),
+                   [](const std::unique_ptr<ChannelQueue>& lhs,
+                      const std::unique_ptr<ChannelQueue>& rhs) {
+                     return lhs->priority > rhs->priority;
+                   });
+}
+
+MessageStager::ChannelQueue* MessageStager::GetQueue(
+    const std::string& channel_name, int priority) {
+  auto search = queue_map_.find(channel_name);
+  if (search != queue_map_.end()) {
+    return search->second;
+  }
+  std::unique_ptr<ChannelQueue> queue(new ChannelQueue());
+  queue->name = channel_name;
+  queue->priority = priority;
+  ChannelQueue* ptr = queue.get();
+  // keep the order without a full sort, equal priorities stay in arrival order
+  auto pos = std::find_if(queues_.begin(), queues_.end(),
+                          [priority](const std::unique_ptr<ChannelQueue>& q) {
+                            return q->priority < priority;
+                          });
+  queues_.insert(pos, std::move(queue));
+  queue_map_[channel_name] = ptr;
+  return ptr;
+}
+
+void MessageStager::Start() {
+  if (is_running_.exchange(true)) {
+    return;
+  }
+  thread_ = std::thread(&MessageStager::ThreadFunc, this);
+}
+
+void MessageStager::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_running_.exchange(false)) {
+      return;
+    }
+  }
+  not_empty_cv_.notify_all();
+  not_full_cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool MessageStager::Stage(const std::string& channel_name,
+                          const std::shared_ptr<RawMessage>& message,
+                          uint64_t time) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  ChannelQueue* queue = GetQueue(channel_name, 0);
+  if (queue->messages.size() >= queue_size_) {
+    StagingPolicy policy = policy_;
+    if (policy == StagingPolicy::BLOCK) {
+      not_full_cv_.wait(lock, [this, queue]() {
+        return !is_running_.load() || queue->messages.size() < queue_size_;
+      });
+      // nobody is left to make room once stopped
+      if (queue->messages.size() >= queue_size_) {
+        policy = StagingPolicy::DROP_NEWEST;
+      }
+    }
+    if (policy == StagingPolicy::DROP_NEWEST) {
+      ++queue->dropped;
+      ++dropped_number_;
+      return false;
+    }
+    if (policy == StagingPolicy::DROP_OLDEST) {
+      queue->messages.pop_front();
+      --staged_number_;
+      ++queue->dropped;
+      ++dropped_number_;
+    }
+  }
+  queue->messages.push_back({message, time});
+  ++staged_number_;
+  lock.unlock();
+  not_empty_cv_.notify_one();
+  return true;
+}
+
+MessageStager::ChannelQueue* MessageStager::NextQueue() {
+  // a queue kept waiting too long goes first, highest priority among those
+  for (const auto& queue : queues_) {
+    if (queue->bypassed >= kMaxBypass && !queue->messages.empty()) {
+      return queue.get();
+    }
+  }
+  // among the highest non-empty priority take the oldest message
+  ChannelQueue* next = nullptr;
+  for (const auto& queue : queues_) {
+    if (next != nullptr && queue->priority < next->priority) {
+      break;
+    }
+    if (queue->messages.empty()) {
+      continue;
+    }
+    if (next == nullptr ||
+        queue->messages.front().time < next->messages.front().time) {
+      next = queue.get();
+    }
+  }
+  return next;
+}
+
+void MessageStager::ReportDrops() {
+  std::vector<std::pair<std::string, uint64_t>> drops;
+  DropFunc drop_func;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!drop_func_) {
+      return;
+    }
+    drop_func = drop_func_;
+    for (const auto& queue : queues_) {
+      if (queue->dropped > queue->reported) {
+        drops.emplace_back(queue->name, queue->dropped - queue->reported);
+        queue->reported = queue->dropped;
+      }
+    }
+  }
+  for (const auto& drop : drops) {
+    drop_func(drop.first, drop.second);
+  }
+}
+
+void MessageStager::ThreadFunc() {
+  uint64_t reported_dropped = 0;
+  while (true) {
+    StagedMessage staged;
+    std::string channel_name;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_cv_.wait(lock, [this]() {
+        return staged_number_ > 0 || !is_running_.load();
+      });
+      if (staged_number_ == 0) {
+        break;
+      }
+      ChannelQueue* queue = NextQueue();
+      for (const auto& other : queues_) {
+        if (other->priority < queue->priority && !other->messages.empty()) {
+          ++other->bypassed;
+        }
+      }
+      queue->bypassed = 0;
+      staged = std::move(queue->messages.front());
+      queue->messages.pop_front();
+      --staged_number_;
+      channel_name = queue->name;
+    }
+    not_full_cv_.notify_all();
+
+    if (dropped_number_.load() != reported_dropped) {
+      reported_dropped = dropped_number_.load();
+      ReportDrops();
+    }
+    if (!write_func_(channel_name, staged.message, staged.time)) {
+      AERROR << "write staged message fail, channel: " << channel_name;
+      continue;
+    }
+    ++written_number_;
+  }
+  ReportDrops();
+}
+
+uint64_t MessageStager::GetDroppedNumber(
+    const std::string& channel_name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto search = queue_map_.find(channel_name);
+  if (search != queue_map_.end()) {
+    return search->second->dropped;
+  }
+  return 0;
+}
+
+uint64_t MessageStager::GetStagedNumber(
+    const std::string& channel_name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto search = queue_map_.find(channel_name);
+  if (search != queue_map_.end()) {
+    return search->second->messages.size();
+  }
+  return 0;
+}
+
+uint64_t MessageStager::GetStagedNumber() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return staged_number_;
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_RECORD_MESSAGE_STAGER_H_
+#define CYBER_RECORD_MESSAGE_STAGER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/message/raw_message.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+/**
+ * @brief What a full channel queue does with one more message.
+ */
+enum class StagingPolicy {
+  BLOCK,        // wait in the reader callback until the writer catches up
+  DROP_NEWEST,  // discard the incoming message
+  DROP_OLDEST,  // discard the oldest staged message of the channel
+};
+
+/**
+ * @brief Parse "block", "drop-newest" or "drop-oldest".
+ *
+ * @return True for success, false for an unknown name.
+ */
+bool ParseStagingPolicy(const std::string& name, StagingPolicy* policy);
+
+/**
+ * @brief Decouples reader callbacks from record serialization: every channel
+ * gets a bounded queue, one writer thread drains them highest priority first,
+ * and whatever the policy discards is counted per channel. A queue passed
+ * over kMaxBypass times in a row is written next, so lower priorities still
+ * get a share of the disk under sustained load.
+ */
+class MessageStager {
+ public:
+  using WriteFunc = std::function<bool(
+      const std::string& channel_name,
+      const std::shared_ptr<message::RawMessage>& message, uint64_t time)>;
+  using DropFunc =
+      std::function<void(const std::string& channel_name, uint64_t count)>;
+
+  /**
+   * @brief The constructor.
+   *
+   * @param write_func called on the writer thread for every staged message
+   * @param queue_size max staged messages per channel
+   * @param policy
+   */
+  MessageStager(const WriteFunc& write_func, uint32_t queue_size,
+                StagingPolicy policy);
+
+  /**
+   * @brief Destructor, stops the writer thread.
+   */
+  virtual ~MessageStager();
+
+  /**
+   * @brief Report new drops from the writer thread, so that the sink is only
+   * ever touched by one thread.
+   */
+  void SetDropCallback(const DropFunc& drop_func);
+
+  /**
+   * @brief Register a channel, higher priority is written first. Channels
+   * staged without registering get priority 0.
+   */
+  void AddChannel(const std::string& channel_name, int priority = 0);
+
+  void Start();
+
+  /**
+   * @brief Write out what is still staged, then stop the writer thread.
+   */
+  void Stop();
+
+  /**
+   * @brief Queue one message, called from reader callbacks.
+   *
+   * @return False when the message itself was dropped.
+   */
+  bool Stage(const std::string& channel_name,
+             const std::shared_ptr<message::RawMessage>& message,
+             uint64_t time);
+
+  uint64_t GetDroppedNumber(const std::string& channel_name) const;
+  uint64_t GetDroppedNumber() const { return dropped_number_.load(); }
+  uint64_t GetWrittenNumber() const { return written_number_.load(); }
+  uint64_t GetStagedNumber(const std::string& channel_name) const;
+  uint64_t GetStagedNumber() const;
+
+  static constexpr uint32_t kMaxBypass = 8;
+
+ private:
+  struct StagedMessage {
+    std::shared_ptr<message::RawMessage> message;
+    uint64_t time;
+  };
+
+  struct ChannelQueue {
+    std::string name;
+    int priority = 0;
+    std::deque<StagedMessage> messages;
+    uint64_t dropped = 0;
+    uint64_t reported = 0;
+    // writes of higher priorities since this queue was last served
+    uint32_t bypassed = 0;
+  };
+
+  ChannelQueue* GetQueue(const std::string& channel_name, int priority);
+  ChannelQueue* NextQueue();
+  void ReportDrops();
+  void ThreadFunc();
+
+  WriteFunc write_func_;
+  DropFunc drop_func_;
+  uint32_t queue_size_;
+  StagingPolicy policy_;
+  std::atomic<bool> is_running_ = {false};
+  std::atomic<uint64_t> dropped_number_ = {0};
+  std::atomic<uint64_t> written_number_ = {0};
+  uint64_t staged_number_ = 0;
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_cv_;
+  std::condition_variable not_full_cv_;
+  // sorted by priority, highest first
+  std::vector<std::unique_ptr<ChannelQueue>> queues_;
+  std::unordered_map<std::string, ChannelQueue*> queue_map_;
+  std::thread thread_;
+};
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_RECORD_MESSAGE_STAGER_H_
@@ -16,6 +16,7 @@
 
 #include "cyber/record/record_reader.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace apollo {
@@ -39,6 +40,8 @@ RecordReader::RecordReader(const std::string& file) {
 	is_valid_ = true;
 	header_ = file_reader_->GetHeader();
 	if (file_reader_->ReadIndex()) {
+		// an unclosed file gets its header rebuilt from the last checkpoint
+		header_ = file_reader_->GetHeader();
 		index_ = file_reader_->GetIndex();
 		for (int i = 0; i < index_.indexes_size(); ++i) {
 			auto single_idx = index_.mutable_indexes(i);
@@ -52,10 +55,49 @@ RecordReader::RecordReader(const std::string& file) {
 			auto channel_cache = single_idx->mutable_channel_cache();
 			channel_info_.insert(std::make_pair(channel_cache->name(), *channel_cache));
 		}
+		if (header_.time_index_position() > 0 && file_reader_->ReadTimeIndex()) {
+			auto& time_index = file_reader_->GetTimeIndex();
+			for (int i = 0; i < time_index.channels_size(); ++i) {
+				time_index_[time_index.channels(i).name()] = &time_index.channels(i);
+			}
+		}
 	}
 	file_reader_->Reset();
 }
 
+bool RecordReader::ReadChannelMessages(const std::string& channel_name,
+	std::vector<RecordMessage>* messages, uint64_t begin_time, uint64_t end_time) {
+	if (!is_valid_) {
+		return false;
+	}
+	auto search = time_index_.find(channel_name);
+	if (search == time_index_.end()) {
+		return false;
+	}
+	const proto::ChannelTimeIndex* channel_index = search->second;
+	std::vector<int> entries;
+	for (int i = 0; i < channel_index->time_size(); ++i) {
+		uint64_t time = channel_index->time(i);
+		if (time >= begin_time && time <= end_time) {
+			entries.push_back(i);
+		}
+	}
+	// chunks are not guaranteed to be flushed in time order
+	std::stable_sort(entries.begin(), entries.end(), [channel_index](int a, int b) {
+		return channel_index->time(a) < channel_index->time(b);
+	});
+	proto::SingleMessage single_msg;
+	for (int i : entries) {
+		if (!file_reader_->ReadIndexedMessage(channel_index->chunk(i),
+			channel_index->offset(i), channel_index->size(i), &single_msg)) {
+			AERROR << "Failed to read indexed message, channel: " << channel_name;
+			return false;
+		}
+		messages->emplace_back(single_msg.channel_name(), single_msg.content(), single_msg.time());
+	}
+	return true;
+}
+
 void RecordReader::Reset() {
 	file_reader_->Reset();
 	reach_end_ = false;
@@ -121,6 +163,10 @@ bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
 				reach_end_ = true;
 				break;
 			}
+			case SectionType::SECTION_INDEX_CHECKPOINT: {
+				file_reader_->SkipSection(section.size);
+				break;
+			}
 			case SectionType::SECTION_CHANNEL: {
 				ADEBUG << "Read channel section of size: " << section.size;
 				Channel channel;
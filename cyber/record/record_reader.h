@@ -22,6 +22,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/proto/record.pb.h"
 
@@ -111,6 +112,28 @@ public:
 	*/
 	std::set<std::string> GetChannelList() const override;
 
+	/**
+	* @brief Whether the record file carries a per-channel time index.
+	*
+	* @return True for yes, false for no.
+	*/
+	bool HasTimeIndex() const { return !time_index_.empty(); }
+
+	/**
+	* @brief Read messages of one channel in a time range through the time
+	* index, only the matching messages are read from the file.
+	*
+	* @param channel_name
+	* @param messages
+	* @param begin_time
+	* @param end_time
+	*
+	* @return True for success, false for not.
+	*/
+	bool ReadChannelMessages(const std::string& channel_name,
+		std::vector<RecordMessage>* messages, uint64_t begin_time = 0,
+		uint64_t end_time = std::numeric_limits<uint64_t>::max());
+
 private:
 	bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
 
@@ -120,6 +143,7 @@ private:
 	proto::Index index_;
 	int message_index_ = 0;
 	ChannelInfoMap channel_info_;
+	std::unordered_map<std::string, const proto::ChannelTimeIndex*> time_index_;
 	FileReaderPtr file_reader_;
 };
 
@@ -20,6 +20,7 @@
 #include <limits>
 #include <utility>
 
+#include "cyber/base/magazine_pool.h"
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -159,7 +160,8 @@ bool RecordViewer::FillBuffer() {
       }
       auto& reader = readers_[i];
       while (true) {
-        auto record_msg = std::make_shared<RecordMessage>();
+        auto record_msg = std::allocate_shared<RecordMessage>(
+            base::PoolAllocator<RecordMessage>());
         if (!reader->ReadMessage(record_msg.get(), this_begin_time,
                                  this_end_time)) {
           break;
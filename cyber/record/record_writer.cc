@@ -169,6 +169,33 @@ bool RecordWriter::SetIntervalOfFileSegmentation(uint64_t time_sec) {
   return true;
 }
 
+bool RecordWriter::SetTimeIndex(bool enable) {
+  if (is_opened_) {
+    AWARN << "Please call this interface before opening file.";
+    return false;
+  }
+  header_.set_time_index(enable);
+  return true;
+}
+
+bool RecordWriter::SetCheckpointChunkNumber(uint64_t chunk_number) {
+  if (is_opened_) {
+    AWARN << "Please call this interface before opening file.";
+    return false;
+  }
+  header_.set_checkpoint_chunk_number(chunk_number);
+  return true;
+}
+
+void RecordWriter::AddDroppedNumber(const std::string& channel_name,
+                                    uint64_t count) {
+  std::lock_guard<std::mutex> lg(mutex_);
+  if (file_writer_ == nullptr) {
+    return;
+  }
+  file_writer_->AddDroppedNumber(channel_name, count);
+}
+
 bool RecordWriter::IsNewChannel(const std::string& channel_name) const {
   return channel_message_number_map_.find(channel_name) ==
          channel_message_number_map_.end();
@@ -126,6 +126,36 @@ class RecordWriter : public RecordBase {
    */
   bool SetIntervalOfFileSegmentation(uint64_t time_sec);
 
+  /**
+   * @brief Build a per-channel time index in the trailer of record files, so
+   * that readers can extract one channel by seeks only.
+   *
+   * @param enable
+   *
+   * @return True for success, false for fail.
+   */
+  bool SetTimeIndex(bool enable);
+
+  /**
+   * @brief Checkpoint the index every chunk_number chunks, so that a file
+   * which was never closed recovers without a full scan. Readers older than
+   * checkpoints stop at the first one, 0 (the default) turns them off.
+   *
+   * @param chunk_number
+   *
+   * @return True for success, false for fail.
+   */
+  bool SetCheckpointChunkNumber(uint64_t chunk_number);
+
+  /**
+   * @brief Account messages of a channel that were lost before reaching the
+   * writer, the counts end up in the index and header of the current file.
+   *
+   * @param channel_name
+   * @param count
+   */
+  void AddDroppedNumber(const std::string& channel_name, uint64_t count);
+
   /**
    * @brief Get message number by channel name.
    *
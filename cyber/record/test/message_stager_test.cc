@@ -0,0 +1,342 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/record/message_stager.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/record/file/record_file_reader.h"
+#include "cyber/record/record_writer.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+using apollo::cyber::message::RawMessage;
+
+constexpr char kChannelName1[] = "/test/channel1";
+constexpr char kChannelName2[] = "/test/channel2";
+constexpr char kMessageType1[] = "apollo.cyber.proto.Test";
+constexpr char kProtoDesc[] = "1234567890";
+constexpr char kTestFile[] = "message_stager_test.record";
+constexpr uint32_t kMessageNum = 200;
+constexpr uint32_t kMessageSize = 1024;
+
+// Output through a small pipe whose reader drains one message per
+// millisecond, so that writes block like on a saturated disk.
+class ThrottledPipe {
+ public:
+  ThrottledPipe() {
+    EXPECT_EQ(0, pipe(fds_));
+    fcntl(fds_[1], F_SETPIPE_SZ, 4096);
+    reader_ = std::thread([this]() {
+      std::string buffer(kMessageSize, '\0');
+      while (true) {
+        size_t got = 0;
+        while (got < kMessageSize) {
+          ssize_t n = read(fds_[0], &buffer[got], kMessageSize - got);
+          if (n <= 0) {
+            return;
+          }
+          got += n;
+        }
+        received_.push_back(std::stoul(buffer));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+  }
+
+  ~ThrottledPipe() { Close(); }
+
+  bool Write(const std::shared_ptr<RawMessage>& message) {
+    const std::string& content = message->message;
+    size_t done = 0;
+    while (done < content.size()) {
+      ssize_t n = write(fds_[1], content.data() + done, content.size() - done);
+      if (n <= 0) {
+        return false;
+      }
+      done += n;
+    }
+    return true;
+  }
+
+  // all received sequence numbers, valid after Close()
+  const std::vector<uint64_t>& Close() {
+    if (fds_[1] >= 0) {
+      close(fds_[1]);
+      fds_[1] = -1;
+      reader_.join();
+      close(fds_[0]);
+    }
+    return received_;
+  }
+
+ private:
+  int fds_[2] = {-1, -1};
+  std::thread reader_;
+  std::vector<uint64_t> received_;
+};
+
+std::shared_ptr<RawMessage> MakeMessage(uint64_t seq) {
+  std::string content = std::to_string(seq);
+  content.resize(kMessageSize, ' ');
+  return std::make_shared<RawMessage>(content);
+}
+
+uint64_t StageAll(MessageStager* stager, std::atomic<uint64_t>* reported) {
+  stager->SetDropCallback([reported](const std::string&, uint64_t count) {
+    reported->fetch_add(count);
+  });
+  stager->Start();
+  uint64_t accepted = 0;
+  for (uint64_t i = 0; i < kMessageNum; ++i) {
+    if (stager->Stage(kChannelName1, MakeMessage(i), i)) {
+      ++accepted;
+    }
+  }
+  stager->Stop();
+  return accepted;
+}
+
+TEST(MessageStagerTest, ParsePolicy) {
+  StagingPolicy policy = StagingPolicy::BLOCK;
+  EXPECT_TRUE(ParseStagingPolicy("drop-newest", &policy));
+  EXPECT_EQ(StagingPolicy::DROP_NEWEST, policy);
+  EXPECT_TRUE(ParseStagingPolicy("drop-oldest", &policy));
+  EXPECT_EQ(StagingPolicy::DROP_OLDEST, policy);
+  EXPECT_TRUE(ParseStagingPolicy("block", &policy));
+  EXPECT_EQ(StagingPolicy::BLOCK, policy);
+  EXPECT_FALSE(ParseStagingPolicy("drop", &policy));
+}
+
+TEST(MessageStagerTest, BlockLosesNothing) {
+  ThrottledPipe pipe;
+  MessageStager stager(
+      [&pipe](const std::string&, const std::shared_ptr<RawMessage>& message,
+              uint64_t) { return pipe.Write(message); },
+      8, StagingPolicy::BLOCK);
+  std::atomic<uint64_t> reported = {0};
+  EXPECT_EQ(kMessageNum, StageAll(&stager, &reported));
+  const auto& received = pipe.Close();
+  EXPECT_EQ(0, stager.GetDroppedNumber());
+  EXPECT_EQ(0, reported.load());
+  ASSERT_EQ(kMessageNum, received.size());
+  for (uint64_t i = 0; i < kMessageNum; ++i) {
+    EXPECT_EQ(i, received[i]);
+  }
+}
+
+TEST(MessageStagerTest, DropNewest) {
+  ThrottledPipe pipe;
+  MessageStager stager(
+      [&pipe](const std::string&, const std::shared_ptr<RawMessage>& message,
+              uint64_t) { return pipe.Write(message); },
+      8, StagingPolicy::DROP_NEWEST);
+  std::atomic<uint64_t> reported = {0};
+  uint64_t accepted = StageAll(&stager, &reported);
+  const auto& received = pipe.Close();
+  EXPECT_GT(stager.GetDroppedNumber(), 0);
+  EXPECT_EQ(kMessageNum, accepted + stager.GetDroppedNumber());
+  EXPECT_EQ(stager.GetDroppedNumber(), stager.GetDroppedNumber(kChannelName1));
+  EXPECT_EQ(stager.GetDroppedNumber(), reported.load());
+  EXPECT_EQ(accepted, stager.GetWrittenNumber());
+  ASSERT_EQ(accepted, received.size());
+  // the head of the stream survives
+  EXPECT_EQ(0, received.front());
+  for (size_t i = 1; i < received.size(); ++i) {
+    EXPECT_LT(received[i - 1], received[i]);
+  }
+}
+
+TEST(MessageStagerTest, DropOldest) {
+  ThrottledPipe pipe;
+  MessageStager stager(
+      [&pipe](const std::string&, const std::shared_ptr<RawMessage>& message,
+              uint64_t) { return pipe.Write(message); },
+      8, StagingPolicy::DROP_OLDEST);
+  std::atomic<uint64_t> reported = {0};
+  EXPECT_EQ(kMessageNum, StageAll(&stager, &reported));
+  const auto& received = pipe.Close();
+  EXPECT_GT(stager.GetDroppedNumber(), 0);
+  EXPECT_EQ(stager.GetDroppedNumber(), reported.load());
+  ASSERT_EQ(kMessageNum, received.size() + stager.GetDroppedNumber());
+  // the tail of the stream survives
+  EXPECT_EQ(kMessageNum - 1, received.back());
+  for (size_t i = 1; i < received.size(); ++i) {
+    EXPECT_LT(received[i - 1], received[i]);
+  }
+}
+
+TEST(MessageStagerTest, Priority) {
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::vector<std::string> order;
+  MessageStager stager(
+      [&](const std::string& channel_name,
+          const std::shared_ptr<RawMessage>&, uint64_t) {
+        released.wait();
+        order.push_back(channel_name);
+        return true;
+      },
+      16, StagingPolicy::BLOCK);
+  stager.AddChannel(kChannelName2, 1);
+  stager.Start();
+  // the first message keeps the writer busy until everything is staged
+  stager.Stage(kChannelName1, MakeMessage(0), 0);
+  while (stager.GetStagedNumber() > 0) {
+    std::this_thread::yield();
+  }
+  for (uint64_t i = 1; i <= 4; ++i) {
+    stager.Stage(kChannelName1, MakeMessage(i), i);
+    stager.Stage(kChannelName2, MakeMessage(i), i);
+  }
+  release.set_value();
+  stager.Stop();
+  ASSERT_EQ(9, order.size());
+  EXPECT_EQ(kChannelName1, order[0]);
+  for (size_t i = 1; i <= 4; ++i) {
+    EXPECT_EQ(kChannelName2, order[i]);
+  }
+  for (size_t i = 5; i < order.size(); ++i) {
+    EXPECT_EQ(kChannelName1, order[i]);
+  }
+}
+
+TEST(MessageStagerTest, NoStarvation) {
+  std::vector<std::string> order;
+  MessageStager stager(
+      [&order](const std::string& channel_name,
+               const std::shared_ptr<RawMessage>&, uint64_t) {
+        order.push_back(channel_name);
+        return true;
+      },
+      64, StagingPolicy::BLOCK);
+  stager.AddChannel(kChannelName2, 1);
+  // everything is staged before the writer starts, the high priority
+  // channel alone would keep it busy for 40 writes
+  for (uint64_t i = 0; i < 40; ++i) {
+    stager.Stage(kChannelName2, MakeMessage(i), i);
+  }
+  for (uint64_t i = 0; i < 4; ++i) {
+    stager.Stage(kChannelName1, MakeMessage(i), i);
+  }
+  stager.Start();
+  stager.Stop();
+  ASSERT_EQ(44, order.size());
+  // the low priority channel is written once per kMaxBypass others
+  size_t run = 0;
+  for (const auto& channel_name : order) {
+    if (channel_name == kChannelName1) {
+      EXPECT_EQ(MessageStager::kMaxBypass, run);
+      run = 0;
+      continue;
+    }
+    ++run;
+  }
+}
+
+TEST(MessageStagerTest, DropOldestPerChannel) {
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::vector<uint64_t> low;
+  std::vector<uint64_t> high;
+  MessageStager stager(
+      [&](const std::string& channel_name,
+          const std::shared_ptr<RawMessage>& message, uint64_t) {
+        released.wait();
+        uint64_t seq = std::stoul(message->message);
+        if (channel_name == kChannelName1) {
+          low.push_back(seq);
+        } else {
+          high.push_back(seq);
+        }
+        return true;
+      },
+      4, StagingPolicy::DROP_OLDEST);
+  stager.AddChannel(kChannelName2, 1);
+  stager.Start();
+  // the first message keeps the writer busy until everything is staged
+  stager.Stage(kChannelName2, MakeMessage(100), 0);
+  while (stager.GetStagedNumber() > 0) {
+    std::this_thread::yield();
+  }
+  for (uint64_t i = 1; i <= 4; ++i) {
+    stager.Stage(kChannelName1, MakeMessage(i), i);
+  }
+  // a busy high priority channel stays bounded and leaves others alone
+  for (uint64_t i = 1; i <= 10; ++i) {
+    EXPECT_TRUE(stager.Stage(kChannelName2, MakeMessage(100 + i), i));
+    EXPECT_LE(stager.GetStagedNumber(kChannelName2), 4);
+  }
+  EXPECT_EQ(4, stager.GetStagedNumber(kChannelName1));
+  EXPECT_EQ(0, stager.GetDroppedNumber(kChannelName1));
+  EXPECT_EQ(6, stager.GetDroppedNumber(kChannelName2));
+  EXPECT_TRUE(stager.Stage(kChannelName1, MakeMessage(5), 5));
+  EXPECT_LE(stager.GetStagedNumber(kChannelName1), 4);
+  EXPECT_EQ(1, stager.GetDroppedNumber(kChannelName1));
+  release.set_value();
+  stager.Stop();
+  EXPECT_EQ(std::vector<uint64_t>({2, 3, 4, 5}), low);
+  EXPECT_EQ(std::vector<uint64_t>({100, 107, 108, 109, 110}), high);
+}
+
+TEST(MessageStagerTest, DroppedNumberInRecord) {
+  {
+    RecordWriter writer;
+    writer.SetSizeOfFileSegmentation(0);
+    writer.SetIntervalOfFileSegmentation(0);
+    ASSERT_TRUE(writer.Open(kTestFile));
+    writer.WriteChannel(kChannelName1, kMessageType1, kProtoDesc);
+    writer.WriteChannel(kChannelName2, kMessageType1, kProtoDesc);
+    writer.WriteMessage(kChannelName1, MakeMessage(0), 1);
+    writer.AddDroppedNumber(kChannelName1, 3);
+    writer.AddDroppedNumber(kChannelName1, 2);
+    writer.Close();
+  }
+
+  RecordFileReader reader;
+  ASSERT_TRUE(reader.Open(kTestFile));
+  ASSERT_TRUE(reader.ReadIndex());
+  EXPECT_EQ(5, reader.GetHeader().dropped_number());
+  const auto& index = reader.GetIndex();
+  int channels = 0;
+  for (int i = 0; i < index.indexes_size(); ++i) {
+    const auto& single_index = index.indexes(i);
+    if (single_index.type() != proto::SectionType::SECTION_CHANNEL) {
+      continue;
+    }
+    ++channels;
+    const auto& cache = single_index.channel_cache();
+    EXPECT_EQ(cache.name() == kChannelName1 ? 5 : 0, cache.dropped_number());
+  }
+  EXPECT_EQ(2, channels);
+  ASSERT_FALSE(remove(kTestFile));
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
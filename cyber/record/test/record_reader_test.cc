@@ -17,6 +17,7 @@
 #include "cyber/record/record_reader.h"
 
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -29,6 +30,7 @@ namespace record {
 using apollo::cyber::message::RawMessage;
 
 constexpr char kChannelName1[] = "/test/channel1";
+constexpr char kChannelName2[] = "/test/channel2";
 constexpr char kMessageType1[] = "apollo.cyber.proto.Test";
 constexpr char kProtoDesc[] = "1234567890";
 constexpr char kStr10B[] = "1234567890";
@@ -122,6 +124,69 @@ TEST(RecordTest, TestReaderOrder) {
   ASSERT_FALSE(remove(kTestFile));
 }
 
+TEST(RecordTest, TestTimeIndex) {
+  // tiny chunks so that the indexed messages spread over several chunks
+  RecordWriter writer(HeaderBuilder::GetHeaderWithChunkParams(0, 8));
+  writer.SetSizeOfFileSegmentation(0);
+  writer.SetIntervalOfFileSegmentation(0);
+  writer.SetTimeIndex(true);
+  writer.Open(kTestFile);
+  writer.WriteChannel(kChannelName1, kMessageType1, kProtoDesc);
+  writer.WriteChannel(kChannelName2, kMessageType1, kProtoDesc);
+  for (uint32_t i = 0; i < kMessageNum; ++i) {
+    auto msg = std::make_shared<RawMessage>(std::to_string(i));
+    writer.WriteMessage(i % 2 ? kChannelName2 : kChannelName1, msg, i);
+  }
+  writer.Close();
+
+  RecordReader reader(kTestFile);
+  ASSERT_TRUE(reader.HasTimeIndex());
+  ASSERT_GT(reader.GetHeader().chunk_number(), 1);
+
+  std::vector<RecordMessage> messages;
+  ASSERT_TRUE(reader.ReadChannelMessages(kChannelName2, &messages));
+  ASSERT_EQ(kMessageNum / 2, messages.size());
+  for (uint32_t i = 0; i < messages.size(); ++i) {
+    ASSERT_EQ(kChannelName2, messages[i].channel_name);
+    ASSERT_EQ(std::to_string(i * 2 + 1), messages[i].content);
+    ASSERT_EQ(i * 2 + 1, messages[i].time);
+  }
+
+  // time range
+  messages.clear();
+  ASSERT_TRUE(reader.ReadChannelMessages(kChannelName1, &messages, 4, 9));
+  ASSERT_EQ(3, messages.size());
+  ASSERT_EQ(4, messages.front().time);
+  ASSERT_EQ(8, messages.back().time);
+
+  // the sequential path is not affected by indexed reads
+  RecordMessage message;
+  for (uint32_t i = 0; i < kMessageNum; ++i) {
+    ASSERT_TRUE(reader.ReadMessage(&message));
+  }
+  ASSERT_FALSE(reader.ReadMessage(&message));
+
+  messages.clear();
+  ASSERT_FALSE(reader.ReadChannelMessages("/not/exist", &messages));
+  ASSERT_FALSE(remove(kTestFile));
+}
+
+TEST(RecordTest, TestNoTimeIndex) {
+  RecordWriter writer;
+  writer.SetSizeOfFileSegmentation(0);
+  writer.SetIntervalOfFileSegmentation(0);
+  writer.Open(kTestFile);
+  writer.WriteChannel(kChannelName1, kMessageType1, kProtoDesc);
+  writer.WriteMessage(kChannelName1, std::make_shared<RawMessage>("0"), 0);
+  writer.Close();
+
+  RecordReader reader(kTestFile);
+  ASSERT_FALSE(reader.HasTimeIndex());
+  std::vector<RecordMessage> messages;
+  ASSERT_FALSE(reader.ReadChannelMessages(kChannelName1, &messages));
+  ASSERT_FALSE(remove(kTestFile));
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -97,6 +97,17 @@ void ClassicContext::Notify(const std::string& group_name) {
 	cv_wq_[group_name].Cv().notify_one(); //lubin - notify one processor (thread) at random to get task
 }
 
+void ClassicContext::Notify(const std::string& group_name, uint32_t count) {
+	if (count == 1) {
+		Notify(group_name);
+		return;
+	}
+	(&mtx_wq_[group_name])->Mutex().lock();
+	notify_grp_[group_name] += count;
+	(&mtx_wq_[group_name])->Mutex().unlock();
+	cv_wq_[group_name].Cv().notify_all();
+}
+
 bool ClassicContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
 	auto grp = cr->group_name();
 	auto prio = cr->priority();
@@ -59,6 +59,7 @@ public:
 	void Shutdown() override;
 
 	static void Notify(const std::string &group_name);
+	static void Notify(const std::string &group_name, uint32_t count);
 	static bool RemoveCRoutine(const std::shared_ptr<CRoutine> &cr);
 	//lubin - all static var to share in different Croutines
 	alignas(CACHELINE_SIZE) static CR_GROUP cr_group_;
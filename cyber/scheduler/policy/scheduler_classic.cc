@@ -177,6 +177,32 @@ bool SchedulerClassic::NotifyProcessor(uint64_t crid) {
 	return false;
 }
 
+void SchedulerClassic::NotifyProcessors(const std::vector<uint64_t>& crids) {
+	if (cyber_unlikely(stop_)) {
+		return;
+	}
+
+	std::unordered_map<std::string, uint32_t> group_counts;
+	{
+	ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+	for (auto crid : crids) {
+		auto search = id_cr_.find(crid);
+		if (search == id_cr_.end()) {
+			continue;
+		}
+		auto& cr = search->second;
+		if (cr->state() == RoutineState::DATA_WAIT || cr->state() == RoutineState::IO_WAIT) {
+			cr->SetUpdateFlag();
+		}
+		++group_counts[cr->group_name()];
+	}
+	}
+
+	for (const auto& group : group_counts) {
+		ClassicContext::Notify(group.first, group.second);
+	}
+}
+
 bool SchedulerClassic::RemoveTask(const std::string& name) {
 	if (cyber_unlikely(stop_)) {
 		return true;
@@ -46,6 +46,7 @@ class SchedulerClassic : public Scheduler {
 
   void CreateProcessor();
   bool NotifyProcessor(uint64_t crid) override;
+  void NotifyProcessors(const std::vector<uint64_t>& crids) override;
 
   std::unordered_map<std::string, ClassicTask> cr_confs_;
 
@@ -33,6 +33,8 @@ namespace scheduler {
 
 using apollo::cyber::common::GlobalData;
 
+std::atomic<bool> Processor::busy_time_enabled_ = {false};
+
 Processor::Processor() { running_.store(true); }
 
 Processor::~Processor() { Stop(); }
@@ -46,10 +48,15 @@ void Processor::Run() {
 		if (cyber_likely(context_ != nullptr)) {
 			auto croutine = context_->NextRoutine(); //lubin - to get next task 
 			if (croutine) {
-				snap_shot_->execute_start_time.store(cyber::Time::Now().ToNanosecond());
-				snap_shot_->routine_name = croutine->name();
+				auto start = cyber::Time::Now().ToNanosecond();
+				snap_shot_->Begin(croutine->id(), start);
 				croutine->Resume();
 				croutine->Release();
+				if (busy_time_enabled_.load(std::memory_order_relaxed)) {
+					snap_shot_->busy_ns.fetch_add(cyber::Time::Now().ToNanosecond() - start,
+							std::memory_order_relaxed);
+				}
+				snap_shot_->execute_start_time.store(0);
 			} else {
 				//lubin - if no croutine wait here to be notified by task
 				snap_shot_->execute_start_time.store(0);
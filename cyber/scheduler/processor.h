@@ -27,6 +27,7 @@
 
 #include "cyber/proto/scheduler_conf.pb.h"
 
+#include "cyber/base/macros.h"
 #include "cyber/croutine/croutine.h"
 #include "cyber/scheduler/processor_context.h"
 
@@ -37,9 +38,41 @@ namespace scheduler {
 using croutine::CRoutine;
 
 struct Snapshot {
+  // written by the processor only, seqlock style so that readers never pair
+  // the id of one croutine with the start time of another
+  void Begin(uint64_t id, uint64_t start) {
+    uint64_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    routine_id.store(id, std::memory_order_relaxed);
+    execute_start_time.store(start, std::memory_order_relaxed);
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // false while the processor is idle
+  bool Running(uint64_t* id, uint64_t* start) const {
+    while (true) {
+      uint64_t seq = sequence.load(std::memory_order_acquire);
+      if (seq & 1) {
+        cpu_relax();
+        continue;
+      }
+      *id = routine_id.load(std::memory_order_relaxed);
+      *start = execute_start_time.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence.load(std::memory_order_relaxed) == seq) {
+        return *start != 0;
+      }
+    }
+  }
+
+  std::atomic<uint64_t> sequence = {0};
   std::atomic<uint64_t> execute_start_time = {0};
   std::atomic<pid_t> processor_id = {0};
-  std::string routine_name;
+  // id of the croutine being resumed, its name is kept by GlobalData
+  std::atomic<uint64_t> routine_id = {0};
+  // total time spent resuming croutines, only kept while SysMo samples it
+  std::atomic<uint64_t> busy_ns = {0};
 };
 
 class Processor {
@@ -55,6 +88,9 @@ class Processor {
 
   std::shared_ptr<Snapshot> ProcSnapshot() { return snap_shot_; }
 
+  // busy_ns costs a clock read per croutine run, SysMo turns it on
+  static void EnableBusyTime(bool enable) { busy_time_enabled_ = enable; }
+
  private:
   std::shared_ptr<ProcessorContext> context_;
 
@@ -67,6 +103,8 @@ class Processor {
   std::atomic<bool> running_{false};
 
   std::shared_ptr<Snapshot> snap_shot_ = std::make_shared<Snapshot>();
+
+  static std::atomic<bool> busy_time_enabled_;
 };
 
 }  // namespace scheduler
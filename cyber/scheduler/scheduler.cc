@@ -73,6 +73,19 @@ bool Scheduler::NotifyTask(uint64_t crid) {
 	return NotifyProcessor(crid);
 }
 
+void Scheduler::NotifyTasks(const std::vector<uint64_t>& crids) {
+	if (cyber_unlikely(stop_.load()) || crids.empty()) {
+		return;
+	}
+	NotifyProcessors(crids);
+}
+
+void Scheduler::NotifyProcessors(const std::vector<uint64_t>& crids) {
+	for (auto crid : crids) {
+		NotifyProcessor(crid);
+	}
+}
+
 void Scheduler::ProcessLevelResourceControl() {
 	std::vector<int> cpus;
 	ParseCpuset(process_level_cpuset_, &cpus);
@@ -101,11 +114,13 @@ void Scheduler::CheckSchedStatus() {
 	auto now = Time::Now().ToNanosecond();
 	for (auto processor : processors_) {
 		auto snap = processor->ProcSnapshot();
-		if (snap->execute_start_time.load()) {
-		auto execute_time = (now - snap->execute_start_time.load()) / 1000000;
+		uint64_t routine_id = 0;
+		uint64_t start = 0;
+		if (snap->Running(&routine_id, &start)) {
+		auto execute_time = (now - start) / 1000000;
 		snap_info.append(std::to_string(snap->processor_id.load()))
 			.append(":")
-			.append(snap->routine_name)
+			.append(GlobalData::GetTaskNameById(routine_id))
 			.append(":")
 			.append(std::to_string(execute_time));
 		} else {
@@ -119,6 +134,17 @@ void Scheduler::CheckSchedStatus() {
 	snap_info.clear();
 }
 
+std::vector<std::shared_ptr<Snapshot>> Scheduler::ProcSnapshots() {
+	std::vector<std::shared_ptr<Snapshot>> snapshots;
+	if (stop_.load()) {
+		return snapshots;
+	}
+	for (auto& processor : processors_) {
+		snapshots.emplace_back(processor->ProcSnapshot());
+	}
+	return snapshots;
+}
+
 void Scheduler::Shutdown() {
   if (cyber_unlikely(stop_.exchange(true))) {
     return;
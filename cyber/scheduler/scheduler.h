@@ -54,6 +54,7 @@ using apollo::cyber::proto::InnerThread;
 
 class Processor;
 class ProcessorContext;
+struct Snapshot;
 
 class Scheduler {
 public:
@@ -63,6 +64,8 @@ public:
 	bool CreateTask(const RoutineFactory& factory, const std::string& name);
 	bool CreateTask(std::function<void()>&& func, const std::string& name, std::shared_ptr<DataVisitorBase> visitor = nullptr);
 	bool NotifyTask(uint64_t crid);
+	// wakes a batch of croutines, processors are notified once per batch
+	void NotifyTasks(const std::vector<uint64_t>& crids);
 
 	void Shutdown();
 	uint32_t TaskPoolSize() { return task_pool_size_; }
@@ -74,9 +77,12 @@ public:
 
 	virtual bool DispatchTask(const std::shared_ptr<CRoutine>&) = 0;
 	virtual bool NotifyProcessor(uint64_t crid) = 0;
+	virtual void NotifyProcessors(const std::vector<uint64_t>& crids);
 	virtual bool RemoveCRoutine(uint64_t crid) = 0;
 
 	void CheckSchedStatus();
+	// running state of every processor, sampled by SysMo
+	std::vector<std::shared_ptr<Snapshot>> ProcSnapshots();
 
 	void SetInnerThreadConfs(const std::unordered_map<std::string, InnerThread>& confs) {
 		inner_thr_confs_ = confs;
@@ -17,19 +17,28 @@
 #ifndef CYBER_SERVICE_CLIENT_H_
 #define CYBER_SERVICE_CLIENT_H_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <future>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
-#include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/common/types.h"
+#include "cyber/croutine/croutine.h"
 #include "cyber/node/node_channel_impl.h"
+#include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/service/client_base.h"
+#include "cyber/service/service_transport.h"
+#include "cyber/service_discovery/topology_manager.h"
+#include "cyber/time/time.h"
+#include "cyber/timer/timer.h"
 
 namespace apollo {
 namespace cyber {
@@ -41,6 +50,14 @@ namespace cyber {
  * @tparam Request the `Service` request type
  * @tparam Response the `Service` response type
  *
+ * Requests go out on the transport matching the relation to the discovered
+ * Service: a direct call in the same process, shared memory on the same host
+ * and RTPS otherwise, or until the Service is discovered.
+ *
+ * A request may carry a deadline, in Time::Now() nanoseconds, that travels
+ * to the Service so it can drop the request once nobody waits for it; the
+ * Client completes calls past their deadline with a null response.
+ *
  * @warning One Client can only request one Service
  */
 template <typename Request, typename Response>
@@ -52,6 +69,8 @@ public:
 	using SharedPromise = std::shared_ptr<Promise>;
 	using SharedFuture = std::shared_future<SharedResponse>;
 	using CallbackType = std::function<void(SharedFuture)>;
+	// gets nullptr when the deadline passed or the Service rejected the call
+	using ResponseCallback = std::function<void(const SharedResponse&)>;
 
 	/**
 	 * @brief Construct a new Client object
@@ -71,7 +90,23 @@ public:
 	 */
 	Client() = delete;
 
-	virtual ~Client() {}
+	virtual ~Client() {
+		if (reap_timer_ != nullptr) {
+			reap_timer_->Stop();
+		}
+		// nobody answers the calls still pending
+		std::unordered_map<uint64_t, PendingCall> pending;
+		{
+			std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+			pending.swap(pending_requests_);
+		}
+		for (auto& call : pending) {
+			Complete(&call.second, nullptr);
+		}
+		if (IsInit()) {
+			service_discovery::TopologyManager::Instance()->service_manager()->RemoveChangeListener(server_change_conn_);
+		}
+	}
 
 	/**
 	 * @brief Init the Client
@@ -123,6 +158,27 @@ public:
 	 */
 	SharedFuture AsyncSendRequest(SharedRequest request, CallbackType&& cb);
 
+	/**
+	 * @brief Request the Service without waiting, `callback` runs with the
+	 * response on the thread receiving it, or with nullptr once `deadline_ns`
+	 * passed or the Service rejected the request
+	 *
+	 * @param request Request shared ptr
+	 * @param callback invoked exactly once
+	 * @param deadline_ns Time::Now() nanoseconds, 0 waits as long as it takes
+	 * @return false if the Client is not initialized, `callback` never runs
+	 */
+	bool Call(SharedRequest request, ResponseCallback&& callback,
+			uint64_t deadline_ns);
+
+	/**
+	 * @brief Request the Service and wait for the response until `deadline_ns`.
+	 * A croutine yields meanwhile instead of blocking its processor.
+	 *
+	 * @return SharedResponse nullptr after the deadline or a rejection
+	 */
+	SharedResponse Call(SharedRequest request, uint64_t deadline_ns);
+
 	/**
 	 * @brief Is the Service is ready?
 	 */
@@ -148,11 +204,33 @@ public:
 					std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
 		}
 
+	/**
+	 * @brief The transport requests go out on, RTPS until the Service is
+	 * discovered, then the one of its relation to this process
+	 */
+	proto::OptionalMode RequestMode();
+
 private:
+	struct PendingCall {
+		// AsyncSendRequest completes a promise, Call runs response_callback
+		SharedPromise promise;
+		CallbackType callback;
+		SharedFuture future;
+		ResponseCallback response_callback;
+		uint64_t deadline_ns = 0;
+	};
+
 	void HandleResponse(const std::shared_ptr<Response>& response,
 			const transport::MessageInfo& request_info);
 
-	bool IsInit(void) const { return response_receiver_ != nullptr; }
+	void Send(SharedRequest request, PendingCall&& call);
+
+	static void Complete(PendingCall* call, const SharedResponse& response);
+
+	// completes the calls past their deadline with nullptr
+	void ReapExpired();
+
+	bool IsInit(void) const { return !response_receivers_.empty(); }
 
 	std::string node_name_;
 
@@ -160,18 +238,26 @@ private:
 			const transport::MessageInfo&)>
 		response_callback_;
 
-	std::unordered_map<uint64_t,
-		std::tuple<SharedPromise, CallbackType, SharedFuture>>
-			pending_requests_;
+	std::unordered_map<uint64_t, PendingCall> pending_requests_;
+	// sequence numbers of pending_requests_ by deadline
+	std::multimap<uint64_t, uint64_t> deadlines_;
 	std::mutex pending_requests_mutex_;
-
-	std::shared_ptr<transport::Transmitter<Request>> request_transmitter_;
-	std::shared_ptr<transport::Receiver<Response>> response_receiver_;
+	std::unique_ptr<Timer> reap_timer_;
+
+	std::unordered_map<proto::OptionalMode,
+		std::shared_ptr<transport::Transmitter<Request>>, std::hash<int>>
+			request_transmitters_;
+	std::vector<std::shared_ptr<transport::Receiver<Response>>> response_receivers_;
+	// transport reaching the Service, -1 until it is discovered
+	std::atomic<int> request_mode_ = {-1};
+	service_discovery::Manager::ChangeConnection server_change_conn_;
 	std::string request_channel_;
 	std::string response_channel_;
 
 	transport::Identity writer_id_;
 	uint64_t sequence_number_;
+
+	static constexpr uint32_t kReapPeriodMs = 10;
 };
 
 template <typename Request, typename Response>
@@ -181,19 +267,28 @@ template <typename Request, typename Response>
 bool Client<Request, Response>::Init() {
 	proto::RoleAttributes role;
 	role.set_node_name(node_name_);
+	// the shared memory transport only reads what its own host wrote
+	role.set_host_name(common::GlobalData::Instance()->HostName());
+	role.set_host_ip(common::GlobalData::Instance()->HostIp());
+	role.set_process_id(common::GlobalData::Instance()->ProcessId());
 	role.set_channel_name(request_channel_);
 	auto channel_id = common::GlobalData::RegisterChannel(request_channel_);
 	role.set_channel_id(channel_id);
 	role.mutable_qos_profile()->CopyFrom(
 			transport::QosProfileConf::QOS_PROFILE_SERVICES_DEFAULT);
 	auto transport = transport::Transport::Instance();
-	request_transmitter_ =
-		transport->CreateTransmitter<Request>(role, proto::OptionalMode::RTPS);
-	if (request_transmitter_ == nullptr) {
-		AERROR << "Create request pub failed.";
-		return false;
+	auto modes = ServiceModes();
+	for (auto mode : modes) {
+		auto transmitter = transport->CreateTransmitter<Request>(role, mode);
+		if (transmitter == nullptr) {
+			AERROR << "Create request pub failed.";
+			request_transmitters_.clear();
+			return false;
+		}
+		request_transmitters_[mode] = transmitter;
 	}
-	writer_id_ = request_transmitter_->id();
+	// one id for all transports, responses are matched against it
+	writer_id_ = request_transmitters_[proto::OptionalMode::RTPS]->id();
 
 	response_callback_ =
 		std::bind(&Client<Request, Response>::HandleResponse, this,
@@ -202,24 +297,55 @@ bool Client<Request, Response>::Init() {
 	role.set_channel_name(response_channel_);
 	channel_id = common::GlobalData::RegisterChannel(response_channel_);
 	role.set_channel_id(channel_id);
-	response_receiver_ = transport->CreateReceiver<Response>(
-			role,
-			[=](const std::shared_ptr<Response>& response,
-				const transport::MessageInfo& message_info,
-				const proto::RoleAttributes& reader_attr) {
-			(void)message_info;
-			(void)reader_attr;
-			response_callback_(response, message_info);
-			},
-			proto::OptionalMode::RTPS);
-	if (response_receiver_ == nullptr) {
-		AERROR << "Create response sub failed.";
-		request_transmitter_.reset();
-		return false;
+	for (auto mode : modes) {
+		auto receiver = transport->CreateReceiver<Response>(
+				role,
+				[=](const std::shared_ptr<Response>& response,
+					const transport::MessageInfo& message_info,
+					const proto::RoleAttributes& reader_attr) {
+				(void)reader_attr;
+				response_callback_(response, message_info);
+				},
+				mode);
+		if (receiver == nullptr) {
+			AERROR << "Create response sub failed.";
+			response_receivers_.clear();
+			request_transmitters_.clear();
+			return false;
+		}
+		response_receivers_.emplace_back(receiver);
 	}
+
+	// a Service coming or going may change the transport reaching it
+	server_change_conn_ = service_discovery::TopologyManager::Instance()->service_manager()->AddChangeListener(
+			[this](const proto::ChangeMsg& msg) {
+			if (msg.role_type() == proto::RoleType::ROLE_SERVER &&
+				msg.role_attr().service_name() == service_name_) {
+				request_mode_.store(-1);
+			}
+			});
 	return true;
 }
 
+template <typename Request, typename Response>
+proto::OptionalMode Client<Request, Response>::RequestMode() {
+	int mode = request_mode_.load();
+	if (mode >= 0) {
+		return static_cast<proto::OptionalMode>(mode);
+	}
+
+	std::vector<proto::RoleAttributes> servers;
+	service_discovery::TopologyManager::Instance()->service_manager()->GetServers(&servers);
+	for (auto& server : servers) {
+		if (server.service_name() == service_name_) {
+			auto found = ServiceModeOf(server);
+			request_mode_.store(found);
+			return found;
+		}
+	}
+	return proto::OptionalMode::RTPS;
+}
+
 template <typename Request, typename Response>
 typename Client<Request, Response>::SharedResponse
 Client<Request, Response>::SendRequest(SharedRequest request,
@@ -227,16 +353,8 @@ Client<Request, Response>::SendRequest(SharedRequest request,
 	if (!IsInit()) {
 		return nullptr;
 	}
-	auto future = AsyncSendRequest(request);
-	if (!future.valid()) {
-		return nullptr;
-	}
-	auto status = future.wait_for(timeout_s);
-	if (status == std::future_status::ready) {
-		return future.get();
-	} else {
-		return nullptr;
-	}
+	return Call(request, Time::Now().ToNanosecond() +
+			std::chrono::duration_cast<std::chrono::nanoseconds>(timeout_s).count());
 }
 
 template <typename Request, typename Response>
@@ -268,20 +386,190 @@ typename Client<Request, Response>::SharedFuture
 Client<Request, Response>::AsyncSendRequest(SharedRequest request,
 		CallbackType&& cb) {
 	if (IsInit()) {
-		std::lock_guard<std::mutex> lock(pending_requests_mutex_);
-		sequence_number_++;
-		transport::MessageInfo info(writer_id_, sequence_number_, writer_id_);
-		request_transmitter_->Transmit(request, info);
-		SharedPromise call_promise = std::make_shared<Promise>();
-		SharedFuture f(call_promise->get_future());
-		pending_requests_[info.seq_num()] =
-			std::make_tuple(call_promise, std::forward<CallbackType>(cb), f);
+		PendingCall call;
+		call.promise = std::make_shared<Promise>();
+		call.callback = std::forward<CallbackType>(cb);
+		call.future = call.promise->get_future();
+		SharedFuture f = call.future;
+		Send(request, std::move(call));
 		return f;
 	} else {
 		return std::shared_future<std::shared_ptr<Response>>();
 	}
 }
 
+template <typename Request, typename Response>
+bool Client<Request, Response>::Call(SharedRequest request,
+		ResponseCallback&& callback, uint64_t deadline_ns) {
+	if (!IsInit()) {
+		return false;
+	}
+	PendingCall call;
+	call.response_callback = std::move(callback);
+	call.deadline_ns = deadline_ns;
+	Send(request, std::move(call));
+	return true;
+}
+
+template <typename Request, typename Response>
+typename Client<Request, Response>::SharedResponse
+Client<Request, Response>::Call(SharedRequest request, uint64_t deadline_ns) {
+	struct Waiter {
+		std::atomic<bool> done = {false};
+		SharedResponse response;
+		uint64_t crid = 0;
+		std::mutex mutex;
+		std::condition_variable cv;
+	};
+	auto waiter = std::make_shared<Waiter>();
+	auto routine = croutine::CRoutine::GetCurrentRoutine();
+	if (routine != nullptr) {
+		waiter->crid = routine->id();
+		// IO_WAIT before sending, the response may arrive ahead of the yield
+		routine->set_state(croutine::RoutineState::IO_WAIT);
+	}
+	bool sent = Call(request,
+			[waiter, deadline_ns](const SharedResponse& response) {
+			waiter->response = response;
+			if (waiter->crid != 0) {
+				// the croutine may only be woken by this very response, the
+				// reaper would have dropped it once the deadline passed
+				if (deadline_ns != 0 && Time::Now().ToNanosecond() > deadline_ns) {
+					waiter->response = nullptr;
+				}
+				waiter->done.store(true, std::memory_order_release);
+				scheduler::Instance()->NotifyTask(waiter->crid);
+				return;
+			}
+			std::lock_guard<std::mutex> lock(waiter->mutex);
+			waiter->done.store(true, std::memory_order_release);
+			waiter->cv.notify_one();
+			},
+			deadline_ns);
+	if (!sent) {
+		if (routine != nullptr) {
+			routine->set_state(croutine::RoutineState::READY);
+		}
+		return nullptr;
+	}
+
+	// do not count on the reaper alone, its timer does not run in simulation
+	uint64_t wait_ns = 0;
+	if (deadline_ns != 0) {
+		uint64_t now = Time::Now().ToNanosecond();
+		wait_ns = deadline_ns > now ? deadline_ns - now : 0;
+	}
+
+	if (routine != nullptr) {
+		auto wake_time = std::chrono::steady_clock::now() + std::chrono::nanoseconds(wait_ns);
+		if (deadline_ns == 0) {
+			croutine::CRoutine::Yield();
+		} else {
+			routine->IoWaitUntil(wake_time);
+		}
+		while (!waiter->done.load(std::memory_order_acquire)) {
+			if (deadline_ns != 0 && std::chrono::steady_clock::now() >= wake_time) {
+				ReapExpired();
+				break;
+			}
+			routine->set_state(croutine::RoutineState::IO_WAIT);
+			if (waiter->done.load(std::memory_order_acquire)) {
+				routine->set_state(croutine::RoutineState::READY);
+				break;
+			}
+			if (deadline_ns == 0) {
+				croutine::CRoutine::Yield();
+			} else {
+				routine->IoWaitUntil(wake_time);
+			}
+		}
+		if (!waiter->done.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+		return waiter->response;
+	}
+
+	auto done = [&waiter] { return waiter->done.load(std::memory_order_acquire); };
+	std::unique_lock<std::mutex> lock(waiter->mutex);
+	if (deadline_ns == 0) {
+		waiter->cv.wait(lock, done);
+		return waiter->response;
+	}
+	if (!waiter->cv.wait_for(lock, std::chrono::nanoseconds(wait_ns), done)) {
+		lock.unlock();
+		ReapExpired();
+		return nullptr;
+	}
+	return waiter->response;
+}
+
+template <typename Request, typename Response>
+void Client<Request, Response>::Send(SharedRequest request, PendingCall&& call) {
+	auto mode = RequestMode();
+	// callers on any thread read the map concurrently, never insert here
+	auto iter = request_transmitters_.find(mode);
+	if (iter == request_transmitters_.end()) {
+		AERROR << "no request transmitter for mode " << mode << " on "
+				<< request_channel_;
+		Complete(&call, nullptr);
+		return;
+	}
+	transport::MessageInfo info;
+	{
+		std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+		sequence_number_++;
+		info = transport::MessageInfo(writer_id_, sequence_number_, writer_id_);
+		info.set_deadline(call.deadline_ns);
+		if (call.deadline_ns != 0) {
+			deadlines_.emplace(call.deadline_ns, sequence_number_);
+			if (reap_timer_ == nullptr) {
+				TimerOption option(kReapPeriodMs, [this]() { this->ReapExpired(); },
+						false);
+				// one wheel entry for the reapers of all Clients
+				option.coalesce = true;
+				reap_timer_.reset(new Timer(option));
+				reap_timer_->Start();
+			}
+		}
+		pending_requests_.emplace(sequence_number_, std::move(call));
+	}
+	// a Service in this process may answer, or reject, inside Transmit
+	iter->second->Transmit(request, info);
+}
+
+template <typename Request, typename Response>
+void Client<Request, Response>::Complete(PendingCall* call,
+		const SharedResponse& response) {
+	if (call->promise != nullptr) {
+		call->promise->set_value(response);
+		call->callback(call->future);
+	} else {
+		call->response_callback(response);
+	}
+}
+
+template <typename Request, typename Response>
+void Client<Request, Response>::ReapExpired() {
+	std::vector<PendingCall> expired;
+	{
+		uint64_t now = Time::Now().ToNanosecond();
+		std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+		while (!deadlines_.empty() && deadlines_.begin()->first <= now) {
+			auto iter = pending_requests_.find(deadlines_.begin()->second);
+			// answered ones leave their deadline behind
+			if (iter != pending_requests_.end() &&
+				iter->second.deadline_ns == deadlines_.begin()->first) {
+				expired.emplace_back(std::move(iter->second));
+				pending_requests_.erase(iter);
+			}
+			deadlines_.erase(deadlines_.begin());
+		}
+	}
+	for (auto& call : expired) {
+		Complete(&call, nullptr);
+	}
+}
+
 template <typename Request, typename Response>
 bool Client<Request, Response>::ServiceIsReady() const {
 	return true;
@@ -292,21 +580,25 @@ void Client<Request, Response>::HandleResponse(
 		const std::shared_ptr<Response>& response,
 		const transport::MessageInfo& request_header) {
 	ADEBUG << "client recv response.";
-	std::lock_guard<std::mutex> lock(pending_requests_mutex_);
 	if (request_header.spare_id() != writer_id_) {
 		return;
 	}
 	uint64_t sequence_number = request_header.seq_num();
-	if (this->pending_requests_.count(sequence_number) == 0) {
-		return;
+	// a rejected request completes with a null response
+	bool rejected = (sequence_number & SRV_REJECTED_SEQ_FLAG) != 0;
+	sequence_number &= ~SRV_REJECTED_SEQ_FLAG;
+	PendingCall call;
+	{
+		std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+		auto iter = pending_requests_.find(sequence_number);
+		if (iter == pending_requests_.end()) {
+			return;
+		}
+		call = std::move(iter->second);
+		pending_requests_.erase(iter);
 	}
-	auto tuple = this->pending_requests_[sequence_number];
-	auto call_promise = std::get<0>(tuple);
-	auto callback = std::get<1>(tuple);
-	auto future = std::get<2>(tuple);
-	this->pending_requests_.erase(sequence_number);
-	call_promise->set_value(response);
-	callback(future);
+	// outside the lock, the callback may call again
+	Complete(&call, rejected ? nullptr : response);
 }
 
 }  // namespace cyber
@@ -17,24 +17,84 @@
 #ifndef CYBER_SERVICE_SERVICE_H_
 #define CYBER_SERVICE_SERVICE_H_
 
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
 #include <list>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/types.h"
 #include "cyber/node/node_channel_impl.h"
 #include "cyber/scheduler/scheduler.h"
 #include "cyber/service/service_base.h"
+#include "cyber/service/service_transport.h"
+#include "cyber/task/task.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 
+/**
+ * @brief Where the handlers of a Service run
+ */
+enum class ServiceExecutor {
+  DEDICATED_THREAD,  ///< one thread of the Service, a request at a time
+  THREAD_POOL,       ///< `threads` threads of the Service
+  TASK_POOL,         ///< croutines of the cyber task pool
+};
+
+/**
+ * @brief How a Service takes in and runs requests
+ */
+struct ServiceConfig {
+  ServiceExecutor executor = ServiceExecutor::DEDICATED_THREAD;
+  // workers of THREAD_POOL
+  uint32_t threads = 4;
+  // handlers running at once, 0 leaves it to the executor
+  uint32_t max_in_flight = 0;
+  // requests of one client are handled one after another, in arrival order
+  bool per_client_fifo = false;
+  // a request arriving while this many wait is rejected right away, its
+  // client gets a null response; 0 is unbounded
+  uint32_t max_queue_depth = 0;
+};
+
+/**
+ * @brief Counters of a Service, times in nanoseconds
+ */
+struct ServiceStats {
+  uint64_t handled = 0;
+  uint64_t rejected = 0;
+  // dropped because their deadline passed before a handler took them
+  uint64_t expired = 0;
+  // waiting and being handled right now
+  uint64_t queued = 0;
+  uint64_t in_flight = 0;
+  // from arrival until the handler starts
+  uint64_t queue_ns = 0;
+  uint64_t max_queue_ns = 0;
+  // inside the handler
+  uint64_t handle_ns = 0;
+  uint64_t max_handle_ns = 0;
+};
+
 /**
  * @class Service
  * @brief Service handles `Request` from the Client, and send a `Response` to
  * it.
  *
+ * Requests are taken on every transport of the communication mode, and each
+ * response goes back on the transport its request came in on, so a caller in
+ * the same process is answered through a direct call and one on the same
+ * host through shared memory. `ServiceConfig` decides how many handlers run
+ * at once and where.
+ *
  * @tparam Request the request type
  * @tparam Response the response type
  */
@@ -49,14 +109,17 @@ class Service : public ServiceBase {
    * @param node_name used to fill RoleAttribute when join the topology
    * @param service_name the service name we provide
    * @param service_callback reference of `ServiceCallback` object
+   * @param config executor and admission control of the handlers
    */
   Service(const std::string& node_name, const std::string& service_name,
-          const ServiceCallback& service_callback)
+          const ServiceCallback& service_callback,
+          const ServiceConfig& config = ServiceConfig())
       : ServiceBase(service_name),
         node_name_(node_name),
         service_callback_(service_callback),
         request_channel_(service_name + SRV_CHANNEL_REQ_SUFFIX),
-        response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX) {}
+        response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX),
+        config_(config) {}
 
   /**
    * @brief Construct a new Service object
@@ -64,14 +127,17 @@ class Service : public ServiceBase {
    * @param node_name used to fill RoleAttribute when join the topology
    * @param service_name the service name we provide
    * @param service_callback rvalue reference of `ServiceCallback` object
+   * @param config executor and admission control of the handlers
    */
   Service(const std::string& node_name, const std::string& service_name,
-          ServiceCallback&& service_callback)
+          ServiceCallback&& service_callback,
+          const ServiceConfig& config = ServiceConfig())
       : ServiceBase(service_name),
         node_name_(node_name),
         service_callback_(service_callback),
         request_channel_(service_name + SRV_CHANNEL_REQ_SUFFIX),
-        response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX) {}
+        response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX),
+        config_(config) {}
 
   /**
    * @brief Forbid default constructing
@@ -90,70 +156,234 @@ class Service : public ServiceBase {
    */
   void destroy();
 
+  /**
+   * @brief Request counters and the time spent queued vs. handled
+   */
+  ServiceStats GetStats();
+
  private:
+  using ResponseTransmitterPtr =
+      std::shared_ptr<transport::Transmitter<Response>>;
+
+  struct PendingRequest {
+    std::shared_ptr<Request> request;
+    transport::MessageInfo message_info;
+    proto::OptionalMode mode;
+    uint64_t arrive_ns;
+  };
+
   void HandleRequest(const std::shared_ptr<Request>& request,
-                     const transport::MessageInfo& message_info);
+                     const transport::MessageInfo& message_info,
+                     proto::OptionalMode mode);
 
   void SendResponse(const transport::MessageInfo& message_info,
-                    const std::shared_ptr<Response>& response);
+                    const std::shared_ptr<Response>& response,
+                    const ResponseTransmitterPtr& transmitter);
 
-  bool IsInit(void) const { return request_receiver_ != nullptr; }
+  void Reject(const transport::MessageInfo& message_info,
+              proto::OptionalMode mode);
+
+  ResponseTransmitterPtr ResponseTransmitter(proto::OptionalMode mode) const;
+
+  bool IsInit(void) const { return !request_receivers_.empty(); }
 
   std::string node_name_;
   ServiceCallback service_callback_;
 
-  std::function<void(const std::shared_ptr<Request>&,
-                     const transport::MessageInfo&)>
-      request_callback_;
-  std::shared_ptr<transport::Transmitter<Response>> response_transmitter_;
-  std::shared_ptr<transport::Receiver<Request>> request_receiver_;
+  std::unordered_map<proto::OptionalMode, ResponseTransmitterPtr,
+                     std::hash<int>>
+      response_transmitters_;
+  std::vector<std::shared_ptr<transport::Receiver<Request>>>
+      request_receivers_;
   std::string request_channel_;
   std::string response_channel_;
-  std::mutex service_handle_request_mutex_;
 
   volatile bool inited_ = false;
-  void Enqueue(std::function<void()>&& task);
+  void Enqueue(const std::shared_ptr<Request>& request,
+               const transport::MessageInfo& message_info,
+               proto::OptionalMode mode);
+  // takes the oldest request allowed to run now, queue_mutex_ held
+  bool PopRunnable(PendingRequest* next);
+  void Run(const PendingRequest& pending);
+  // hands runnable requests to the task pool
+  void Dispatch();
   void Process();
-  std::thread thread_;
+
+  ServiceConfig config_;
+  uint32_t max_in_flight_ = 1;
+  std::vector<std::thread> threads_;
   std::mutex queue_mutex_;
   std::condition_variable condition_;
-  std::list<std::function<void()>> tasks_;
+  std::condition_variable idle_condition_;
+  std::list<PendingRequest> pending_;
+  // clients with a handler running, for per_client_fifo
+  std::unordered_set<uint64_t> busy_clients_;
+  ServiceStats stats_;
 };
 
 template <typename Request, typename Response>
 void Service<Request, Response>::destroy() {
-  inited_ = false;
   {
-    std::lock_guard<std::mutex> lg(queue_mutex_);
-    this->tasks_.clear();
+    std::unique_lock<std::mutex> ul(queue_mutex_);
+    inited_ = false;
+    pending_.clear();
+    condition_.notify_all();
+    // handlers on the task pool still use this Service, they never run once
+    // cyber is shut down
+    while (stats_.in_flight > 0 && !cyber::IsShutdown()) {
+      idle_condition_.wait_for(ul, std::chrono::milliseconds(100));
+    }
   }
-  condition_.notify_all();
-  if (thread_.joinable()) {
-    thread_.join();
+  for (auto& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
   }
+  threads_.clear();
 }
 
 template <typename Request, typename Response>
-inline void Service<Request, Response>::Enqueue(std::function<void()>&& task) {
+ServiceStats Service<Request, Response>::GetStats() {
   std::lock_guard<std::mutex> lg(queue_mutex_);
-  tasks_.emplace_back(std::move(task));
-  condition_.notify_one();
+  ServiceStats stats = stats_;
+  stats.queued = pending_.size();
+  return stats;
 }
 
 template <typename Request, typename Response>
-void Service<Request, Response>::Process() {
-  while (!cyber::IsShutdown()) {
-    std::unique_lock<std::mutex> ul(queue_mutex_);
-    condition_.wait(ul, [this]() { return !inited_ || !this->tasks_.empty(); });
+void Service<Request, Response>::Enqueue(
+    const std::shared_ptr<Request>& request,
+    const transport::MessageInfo& message_info, proto::OptionalMode mode) {
+  uint64_t now = Time::Now().ToNanosecond();
+  bool queued = false;
+  {
+    std::lock_guard<std::mutex> lg(queue_mutex_);
     if (!inited_) {
-      break;
+      return;
+    }
+    // the client gave up already
+    if (message_info.deadline() != 0 && message_info.deadline() <= now) {
+      ++stats_.expired;
+      return;
+    }
+    if (config_.max_queue_depth != 0 &&
+        pending_.size() >= config_.max_queue_depth) {
+      ++stats_.rejected;
+    } else {
+      pending_.push_back({request, message_info, mode,
+                          Time::MonoTime().ToNanosecond()});
+      if (config_.executor != ServiceExecutor::TASK_POOL) {
+        condition_.notify_one();
+        return;
+      }
+      queued = true;
+    }
+  }
+  if (queued) {
+    Dispatch();
+  } else {
+    Reject(message_info, mode);
+  }
+}
+
+template <typename Request, typename Response>
+bool Service<Request, Response>::PopRunnable(PendingRequest* next) {
+  if (stats_.in_flight >= max_in_flight_) {
+    return false;
+  }
+  for (auto iter = pending_.begin(); iter != pending_.end(); ++iter) {
+    // a later request of a busy client stays behind the earlier ones
+    if (config_.per_client_fifo &&
+        !busy_clients_.insert(iter->message_info.spare_id().HashValue())
+             .second) {
+      continue;
+    }
+    *next = std::move(*iter);
+    pending_.erase(iter);
+    ++stats_.in_flight;
+    return true;
+  }
+  return false;
+}
+
+template <typename Request, typename Response>
+void Service<Request, Response>::Run(const PendingRequest& pending) {
+  uint64_t deadline = pending.message_info.deadline();
+  bool expired = deadline != 0 && deadline <= Time::Now().ToNanosecond();
+  uint64_t start_ns = Time::MonoTime().ToNanosecond();
+  if (!expired) {
+    HandleRequest(pending.request, pending.message_info, pending.mode);
+  }
+  uint64_t end_ns = Time::MonoTime().ToNanosecond();
+  {
+    std::lock_guard<std::mutex> lg(queue_mutex_);
+    --stats_.in_flight;
+    if (config_.per_client_fifo) {
+      busy_clients_.erase(pending.message_info.spare_id().HashValue());
+    }
+    if (expired) {
+      ++stats_.expired;
+    } else {
+      ++stats_.handled;
+      uint64_t queue_ns = start_ns - pending.arrive_ns;
+      stats_.queue_ns += queue_ns;
+      stats_.max_queue_ns = std::max(stats_.max_queue_ns, queue_ns);
+      uint64_t handle_ns = end_ns - start_ns;
+      stats_.handle_ns += handle_ns;
+      stats_.max_handle_ns = std::max(stats_.max_handle_ns, handle_ns);
+    }
+    if (!inited_) {
+      idle_condition_.notify_all();
+      return;
+    }
+  }
+  if (config_.executor == ServiceExecutor::TASK_POOL) {
+    Dispatch();
+  }
+}
+
+template <typename Request, typename Response>
+void Service<Request, Response>::Dispatch() {
+  std::vector<PendingRequest> runnable;
+  {
+    std::lock_guard<std::mutex> lg(queue_mutex_);
+    PendingRequest next;
+    while (PopRunnable(&next)) {
+      runnable.emplace_back(std::move(next));
+    }
+  }
+  for (auto& pending : runnable) {
+    if (cyber::Post([this, pending]() { this->Run(pending); })) {
+      continue;
+    }
+    // the task pool is full or stopped
+    {
+      std::lock_guard<std::mutex> lg(queue_mutex_);
+      --stats_.in_flight;
+      ++stats_.rejected;
+      if (config_.per_client_fifo) {
+        busy_clients_.erase(pending.message_info.spare_id().HashValue());
+      }
+      idle_condition_.notify_all();
     }
-    if (!tasks_.empty()) {
-      auto task = tasks_.front();
-      tasks_.pop_front();
-      ul.unlock();
-      task();
+    Reject(pending.message_info, pending.mode);
+  }
+}
+
+template <typename Request, typename Response>
+void Service<Request, Response>::Process() {
+  while (!cyber::IsShutdown()) {
+    PendingRequest next;
+    {
+      std::unique_lock<std::mutex> ul(queue_mutex_);
+      condition_.wait(ul, [this, &next]() {
+        return !inited_ || this->PopRunnable(&next);
+      });
+      if (!inited_) {
+        break;
+      }
     }
+    Run(next);
   }
 }
 
@@ -164,44 +394,70 @@ bool Service<Request, Response>::Init() {
   }
   proto::RoleAttributes role;
   role.set_node_name(node_name_);
+  // the shared memory transport only reads what its own host wrote
+  role.set_host_name(common::GlobalData::Instance()->HostName());
+  role.set_host_ip(common::GlobalData::Instance()->HostIp());
+  role.set_process_id(common::GlobalData::Instance()->ProcessId());
   role.set_channel_name(response_channel_);
   auto channel_id = common::GlobalData::RegisterChannel(response_channel_);
   role.set_channel_id(channel_id);
   role.mutable_qos_profile()->CopyFrom(
       transport::QosProfileConf::QOS_PROFILE_SERVICES_DEFAULT);
   auto transport = transport::Transport::Instance();
-  response_transmitter_ =
-      transport->CreateTransmitter<Response>(role, proto::OptionalMode::RTPS);
-  if (response_transmitter_ == nullptr) {
-    AERROR << " Create response pub failed.";
-    return false;
+  auto modes = ServiceModes();
+  for (auto mode : modes) {
+    auto transmitter = transport->CreateTransmitter<Response>(role, mode);
+    if (transmitter == nullptr) {
+      AERROR << " Create response pub failed.";
+      response_transmitters_.clear();
+      return false;
+    }
+    response_transmitters_[mode] = transmitter;
   }
 
-  request_callback_ =
-      std::bind(&Service<Request, Response>::HandleRequest, this,
-                std::placeholders::_1, std::placeholders::_2);
-
   role.set_channel_name(request_channel_);
   channel_id = common::GlobalData::RegisterChannel(request_channel_);
   role.set_channel_id(channel_id);
-  request_receiver_ = transport->CreateReceiver<Request>(
-      role,
-      [=](const std::shared_ptr<Request>& request,
-          const transport::MessageInfo& message_info,
-          const proto::RoleAttributes& reader_attr) {
-        (void)reader_attr;
-        auto task = [this, request, message_info]() {
-          this->HandleRequest(request, message_info);
-        };
-        Enqueue(std::move(task));
-      },
-      proto::OptionalMode::RTPS);
+  for (auto mode : modes) {
+    auto receiver = transport->CreateReceiver<Request>(
+        role,
+        [this, mode](const std::shared_ptr<Request>& request,
+                     const transport::MessageInfo& message_info,
+                     const proto::RoleAttributes& reader_attr) {
+          (void)reader_attr;
+          this->Enqueue(request, message_info, mode);
+        },
+        mode);
+    if (receiver == nullptr) {
+      AERROR << " Create request sub failed." << request_channel_;
+      request_receivers_.clear();
+      response_transmitters_.clear();
+      return false;
+    }
+    request_receivers_.emplace_back(receiver);
+  }
+
+  uint32_t threads = 0;
+  switch (config_.executor) {
+    case ServiceExecutor::THREAD_POOL:
+      threads = std::max(config_.threads, 1u);
+      max_in_flight_ = config_.max_in_flight > 0
+                           ? std::min(config_.max_in_flight, threads)
+                           : threads;
+      break;
+    case ServiceExecutor::TASK_POOL:
+      max_in_flight_ = config_.max_in_flight > 0
+                           ? config_.max_in_flight
+                           : std::numeric_limits<uint32_t>::max();
+      break;
+    default:
+      threads = 1;
+      max_in_flight_ = 1;
+      break;
+  }
   inited_ = true;
-  thread_ = std::thread(&Service<Request, Response>::Process, this);
-  if (request_receiver_ == nullptr) {
-    AERROR << " Create request sub failed." << request_channel_;
-    response_transmitter_.reset();
-    return false;
+  for (uint32_t i = 0; i < threads; ++i) {
+    threads_.emplace_back(&Service<Request, Response>::Process, this);
   }
   return true;
 }
@@ -209,31 +465,63 @@ bool Service<Request, Response>::Init() {
 template <typename Request, typename Response>
 void Service<Request, Response>::HandleRequest(
     const std::shared_ptr<Request>& request,
-    const transport::MessageInfo& message_info) {
+    const transport::MessageInfo& message_info, proto::OptionalMode mode) {
   if (!IsInit()) {
     // LOG_DEBUG << "not inited error.";
     return;
   }
   ADEBUG << "handling request:" << request_channel_;
-  std::lock_guard<std::mutex> lk(service_handle_request_mutex_);
   auto response = std::make_shared<Response>();
   service_callback_(request, response);
+  // answer on the transport the request came in on
+  auto transmitter = ResponseTransmitter(mode);
+  if (transmitter == nullptr) {
+    return;
+  }
   transport::MessageInfo msg_info(message_info);
-  msg_info.set_sender_id(response_transmitter_->id());
-  SendResponse(msg_info, response);
+  msg_info.set_sender_id(transmitter->id());
+  SendResponse(msg_info, response, transmitter);
 }
 
 template <typename Request, typename Response>
 void Service<Request, Response>::SendResponse(
     const transport::MessageInfo& message_info,
-    const std::shared_ptr<Response>& response) {
+    const std::shared_ptr<Response>& response,
+    const ResponseTransmitterPtr& transmitter) {
   if (!IsInit()) {
     // LOG_DEBUG << "not inited error.";
     return;
   }
   // publish return value ?
   // LOG_DEBUG << "send response id:" << message_id.sequence_number;
-  response_transmitter_->Transmit(response, message_info);
+  transmitter->Transmit(response, message_info);
+}
+
+template <typename Request, typename Response>
+typename Service<Request, Response>::ResponseTransmitterPtr
+Service<Request, Response>::ResponseTransmitter(
+    proto::OptionalMode mode) const {
+  // requests of all transports read the map concurrently, never insert here
+  auto iter = response_transmitters_.find(mode);
+  if (iter == response_transmitters_.end()) {
+    AERROR << "no response transmitter for mode " << mode << " on "
+           << response_channel_;
+    return nullptr;
+  }
+  return iter->second;
+}
+
+template <typename Request, typename Response>
+void Service<Request, Response>::Reject(
+    const transport::MessageInfo& message_info, proto::OptionalMode mode) {
+  auto transmitter = ResponseTransmitter(mode);
+  if (transmitter == nullptr) {
+    return;
+  }
+  transport::MessageInfo msg_info(message_info);
+  msg_info.set_sender_id(transmitter->id());
+  msg_info.set_seq_num(message_info.seq_num() | SRV_REJECTED_SEQ_FLAG);
+  SendResponse(msg_info, std::make_shared<Response>(), transmitter);
 }
 
 }  // namespace cyber
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SERVICE_SERVICE_TRANSPORT_H_
+#define CYBER_SERVICE_SERVICE_TRANSPORT_H_
+
+#include <set>
+
+#include "cyber/common/global_data.h"
+#include "cyber/proto/role_attributes.pb.h"
+#include "cyber/proto/transport_conf.pb.h"
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @brief The transport for each relation of Client and Service, taken from
+ * transport_conf.communication_mode like the hybrid transmitter does.
+ */
+inline proto::CommunicationMode ServiceCommunicationMode() {
+  proto::CommunicationMode mode;
+  auto& global_conf = common::GlobalData::Instance()->Config();
+  if (global_conf.has_transport_conf() &&
+      global_conf.transport_conf().has_communication_mode()) {
+    mode.CopyFrom(global_conf.transport_conf().communication_mode());
+  }
+  return mode;
+}
+
+/**
+ * @brief Every transport a Service takes requests on and a Client takes
+ * responses on. RTPS is always among them, it reaches peers not discovered
+ * yet.
+ */
+inline std::set<proto::OptionalMode> ServiceModes() {
+  auto mode = ServiceCommunicationMode();
+  return {mode.same_proc(), mode.diff_proc(), mode.diff_host(),
+          proto::OptionalMode::RTPS};
+}
+
+/**
+ * @brief The transport reaching a peer, by the host_ip and process_id in its
+ * service role attributes
+ */
+inline proto::OptionalMode ServiceModeOf(const proto::RoleAttributes& peer) {
+  auto mode = ServiceCommunicationMode();
+  auto global_data = common::GlobalData::Instance();
+  if (peer.host_ip() != global_data->HostIp()) {
+    return mode.diff_host();
+  }
+  if (peer.process_id() != global_data->ProcessId()) {
+    return mode.diff_proc();
+  }
+  return mode.same_proc();
+}
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_SERVICE_TRANSPORT_H_
@@ -0,0 +1,459 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service/service.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/proto/unit_test.pb.h"
+
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/service/service_transport.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+
+using apollo::cyber::proto::Chatter;
+
+namespace {
+
+std::shared_ptr<Chatter> MakeRequest(uint64_t seq) {
+  auto request = std::make_shared<Chatter>();
+  request->set_seq(seq);
+  request->set_timestamp(0);
+  return request;
+}
+
+// handlers are counted once their response is out
+ServiceStats WaitForHandled(Service<Chatter, Chatter>* server,
+                            uint64_t handled) {
+  for (int i = 0; i < 100 && server->GetStats().handled < handled; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return server->GetStats();
+}
+
+}  // namespace
+
+TEST(ServiceTest, thread_pool) {
+  auto node = CreateNode("service_test_thread_pool");
+  std::atomic<int> running = {0};
+  std::atomic<int> max_running = {0};
+  ServiceConfig config;
+  config.executor = ServiceExecutor::THREAD_POOL;
+  config.threads = 4;
+  auto server = node->CreateService<Chatter, Chatter>(
+      "service_test_thread_pool",
+      [&](const std::shared_ptr<Chatter>& request,
+          std::shared_ptr<Chatter>& response) {
+        int now = ++running;
+        int max = max_running.load();
+        while (now > max && !max_running.compare_exchange_weak(max, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        --running;
+        response->set_seq(request->seq());
+      },
+      config);
+  ASSERT_NE(server, nullptr);
+  auto client =
+      node->CreateClient<Chatter, Chatter>("service_test_thread_pool");
+
+  std::vector<Client<Chatter, Chatter>::SharedFuture> futures;
+  for (uint64_t i = 0; i < 8; ++i) {
+    futures.emplace_back(client->AsyncSendRequest(MakeRequest(i)));
+  }
+  for (uint64_t i = 0; i < futures.size(); ++i) {
+    ASSERT_EQ(futures[i].wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    ASSERT_NE(futures[i].get(), nullptr);
+    EXPECT_EQ(futures[i].get()->seq(), i);
+  }
+  EXPECT_GT(max_running.load(), 1);
+  EXPECT_LE(max_running.load(), 4);
+
+  auto stats = WaitForHandled(server.get(), 8);
+  EXPECT_EQ(stats.handled, 8);
+  EXPECT_EQ(stats.rejected, 0);
+  EXPECT_EQ(stats.queued, 0);
+  EXPECT_GE(stats.max_handle_ns, 100000000);
+  // the last requests waited for a free thread
+  EXPECT_GT(stats.max_queue_ns, 50000000);
+}
+
+TEST(ServiceTest, per_client_fifo) {
+  auto node = CreateNode("service_test_fifo");
+  std::mutex mutex;
+  std::vector<uint64_t> order;
+  std::atomic<int> running = {0};
+  std::atomic<bool> overlapped = {false};
+  ServiceConfig config;
+  config.executor = ServiceExecutor::THREAD_POOL;
+  config.threads = 4;
+  config.per_client_fifo = true;
+  auto server = node->CreateService<Chatter, Chatter>(
+      "service_test_fifo",
+      [&](const std::shared_ptr<Chatter>& request,
+          std::shared_ptr<Chatter>& response) {
+        if (++running > 1) {
+          overlapped = true;
+        }
+        {
+          std::lock_guard<std::mutex> lg(mutex);
+          order.push_back(request->seq());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        --running;
+        response->set_seq(request->seq());
+      },
+      config);
+  ASSERT_NE(server, nullptr);
+  auto client = node->CreateClient<Chatter, Chatter>("service_test_fifo");
+
+  std::vector<Client<Chatter, Chatter>::SharedFuture> futures;
+  for (uint64_t i = 0; i < 16; ++i) {
+    futures.emplace_back(client->AsyncSendRequest(MakeRequest(i)));
+  }
+  for (auto& future : futures) {
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+  }
+  EXPECT_FALSE(overlapped.load());
+  ASSERT_EQ(order.size(), 16);
+  EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+// overflowing requests get an empty response whatever runs the handlers
+void ExpectRejectWhenQueueIsFull(ServiceExecutor executor,
+                                 const std::string& name) {
+  auto node = CreateNode(name);
+  ServiceConfig config;
+  config.executor = executor;
+  config.max_queue_depth = 1;
+  config.max_in_flight = 1;
+  auto server = node->CreateService<Chatter, Chatter>(
+      name,
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        response->set_seq(request->seq());
+      },
+      config);
+  ASSERT_NE(server, nullptr);
+  auto client = node->CreateClient<Chatter, Chatter>(name);
+
+  std::vector<Client<Chatter, Chatter>::SharedFuture> futures;
+  for (uint64_t i = 0; i < 6; ++i) {
+    futures.emplace_back(client->AsyncSendRequest(MakeRequest(i)));
+  }
+  // one request runs and one waits, the others are turned away at once
+  uint64_t rejected = 0;
+  for (auto& future : futures) {
+    if (future.wait_for(std::chrono::milliseconds(0)) ==
+        std::future_status::ready) {
+      EXPECT_EQ(future.get(), nullptr);
+      ++rejected;
+    }
+  }
+  EXPECT_GE(rejected, 4);
+  uint64_t answered = 0;
+  for (auto& future : futures) {
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    if (future.get() != nullptr) {
+      ++answered;
+    }
+  }
+  EXPECT_EQ(answered + rejected, futures.size());
+  auto stats = WaitForHandled(server.get(), answered);
+  EXPECT_EQ(stats.rejected, rejected);
+  EXPECT_EQ(stats.handled, answered);
+}
+
+TEST(ServiceTest, reject_when_queue_is_full) {
+  ExpectRejectWhenQueueIsFull(ServiceExecutor::DEDICATED_THREAD,
+                              "service_test_reject");
+}
+
+TEST(ServiceTest, task_pool_reject_when_queue_is_full) {
+  ExpectRejectWhenQueueIsFull(ServiceExecutor::TASK_POOL,
+                              "service_test_task_pool_reject");
+}
+
+TEST(ServiceTest, task_pool) {
+  auto node = CreateNode("service_test_task_pool");
+  ServiceConfig config;
+  config.executor = ServiceExecutor::TASK_POOL;
+  config.max_in_flight = 2;
+  auto server = node->CreateService<Chatter, Chatter>(
+      "service_test_task_pool",
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        response->set_seq(request->seq() * 2);
+      },
+      config);
+  ASSERT_NE(server, nullptr);
+  auto client =
+      node->CreateClient<Chatter, Chatter>("service_test_task_pool");
+
+  std::vector<Client<Chatter, Chatter>::SharedFuture> futures;
+  for (uint64_t i = 0; i < 32; ++i) {
+    futures.emplace_back(client->AsyncSendRequest(MakeRequest(i)));
+  }
+  for (uint64_t i = 0; i < futures.size(); ++i) {
+    ASSERT_EQ(futures[i].wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    ASSERT_NE(futures[i].get(), nullptr);
+    EXPECT_EQ(futures[i].get()->seq(), i * 2);
+  }
+  auto stats = WaitForHandled(server.get(), 32);
+  EXPECT_EQ(stats.handled, 32);
+  EXPECT_EQ(stats.in_flight, 0);
+}
+
+TEST(ClientTest, call_10k_outstanding) {
+  auto node = CreateNode("client_test_call");
+  auto server = node->CreateService<Chatter, Chatter>(
+      "client_test_call",
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        response->set_seq(request->seq() + 1);
+      });
+  ASSERT_NE(server, nullptr);
+  auto client = node->CreateClient<Chatter, Chatter>("client_test_call");
+
+  const uint64_t kCalls = 10000;
+  std::atomic<uint64_t> answered = {0};
+  std::atomic<uint64_t> wrong = {0};
+  uint64_t deadline = Time::Now().ToNanosecond() + 10000000000ULL;
+  for (uint64_t i = 0; i < kCalls; ++i) {
+    ASSERT_TRUE(client->Call(
+        MakeRequest(i),
+        [i, &answered, &wrong](const std::shared_ptr<Chatter>& response) {
+          if (response == nullptr || response->seq() != i + 1) {
+            ++wrong;
+          }
+          ++answered;
+        },
+        deadline));
+  }
+  for (int i = 0; i < 1000 && answered.load() < kCalls; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(answered.load(), kCalls);
+  EXPECT_EQ(wrong.load(), 0);
+}
+
+TEST(ClientTest, call_10k_past_deadline) {
+  auto node = CreateNode("client_test_deadline");
+  std::atomic<bool> release = {false};
+  auto server = node->CreateService<Chatter, Chatter>(
+      "client_test_deadline",
+      [&release](const std::shared_ptr<Chatter>& request,
+                 std::shared_ptr<Chatter>& response) {
+        while (!release.load()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        response->set_seq(request->seq());
+      });
+  ASSERT_NE(server, nullptr);
+  auto client = node->CreateClient<Chatter, Chatter>("client_test_deadline");
+
+  // the first call holds the only handler, the others wait behind it
+  const uint64_t kCalls = 10000;
+  std::atomic<uint64_t> timed_out = {0};
+  uint64_t deadline = Time::Now().ToNanosecond() + 200000000;
+  for (uint64_t i = 0; i < kCalls; ++i) {
+    ASSERT_TRUE(client->Call(
+        MakeRequest(i),
+        [&timed_out](const std::shared_ptr<Chatter>& response) {
+          if (response == nullptr) {
+            ++timed_out;
+          }
+        },
+        deadline));
+  }
+  for (int i = 0; i < 500 && timed_out.load() < kCalls; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(timed_out.load(), kCalls);
+
+  // the Service drops what nobody waits for anymore
+  release = true;
+  ServiceStats stats;
+  for (int i = 0; i < 500; ++i) {
+    stats = server->GetStats();
+    if (stats.handled + stats.expired == kCalls) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(stats.handled, 1);
+  EXPECT_EQ(stats.expired, kCalls - 1);
+
+  // expired on arrival
+  std::atomic<bool> called = {false};
+  EXPECT_TRUE(client->Call(
+      MakeRequest(0),
+      [&called](const std::shared_ptr<Chatter>& response) {
+        EXPECT_EQ(response, nullptr);
+        called = true;
+      },
+      Time::Now().ToNanosecond() - 1));
+  for (int i = 0; i < 100 && !called.load(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(called.load());
+  EXPECT_EQ(server->GetStats().expired, kCalls);
+}
+
+TEST(ClientTest, call_and_wait) {
+  auto node = CreateNode("client_test_wait");
+  auto server = node->CreateService<Chatter, Chatter>(
+      "client_test_wait",
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        if (request->seq() == 0) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        }
+        response->set_seq(request->seq());
+      });
+  ASSERT_NE(server, nullptr);
+  auto client = node->CreateClient<Chatter, Chatter>("client_test_wait");
+
+  // a thread blocks, a croutine yields
+  auto response =
+      client->Call(MakeRequest(7), Time::Now().ToNanosecond() + 1000000000);
+  ASSERT_NE(response, nullptr);
+  EXPECT_EQ(response->seq(), 7);
+  auto future = cyber::Async([&client]() {
+    return client->Call(MakeRequest(8),
+                        Time::Now().ToNanosecond() + 1000000000);
+  });
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(2)),
+            std::future_status::ready);
+  response = future.get();
+  ASSERT_NE(response, nullptr);
+  EXPECT_EQ(response->seq(), 8);
+
+  uint64_t start = Time::MonoTime().ToNanosecond();
+  EXPECT_EQ(client->Call(MakeRequest(0),
+                         Time::Now().ToNanosecond() + 50000000),
+            nullptr);
+  EXPECT_LT(Time::MonoTime().ToNanosecond() - start, 250000000);
+  future = cyber::Async([&client]() {
+    return client->Call(MakeRequest(0), Time::Now().ToNanosecond() + 50000000);
+  });
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(2)),
+            std::future_status::ready);
+  EXPECT_EQ(future.get(), nullptr);
+}
+
+TEST(ClientTest, call_deadline_in_simulation) {
+  auto node = CreateNode("client_test_simulation");
+  auto server = node->CreateService<Chatter, Chatter>(
+      "client_test_simulation",
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        response->set_seq(request->seq());
+      });
+  ASSERT_NE(server, nullptr);
+  auto client =
+      node->CreateClient<Chatter, Chatter>("client_test_simulation");
+
+  // Async only runs on a croutine in reality, the reaper's timer does not
+  // start in simulation
+  auto future = cyber::Async([&client]() {
+    common::GlobalData::Instance()->EnableSimulationMode();
+    auto response =
+        client->Call(MakeRequest(0), Time::Now().ToNanosecond() + 50000000);
+    common::GlobalData::Instance()->DisableSimulationMode();
+    return response;
+  });
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(2)),
+            std::future_status::ready);
+  EXPECT_EQ(future.get(), nullptr);
+}
+
+TEST(ServiceTransportTest, mode_of_peer) {
+  auto mode = ServiceCommunicationMode();
+  auto global_data = common::GlobalData::Instance();
+  proto::RoleAttributes peer;
+  peer.set_host_ip(global_data->HostIp());
+  peer.set_process_id(global_data->ProcessId());
+  EXPECT_EQ(ServiceModeOf(peer), mode.same_proc());
+
+  peer.set_process_id(global_data->ProcessId() + 1);
+  EXPECT_EQ(ServiceModeOf(peer), mode.diff_proc());
+
+  // the host decides before the process id
+  peer.set_host_ip("192.0.2.1");
+  EXPECT_EQ(ServiceModeOf(peer), mode.diff_host());
+  peer.set_process_id(global_data->ProcessId());
+  EXPECT_EQ(ServiceModeOf(peer), mode.diff_host());
+
+  auto modes = ServiceModes();
+  EXPECT_EQ(modes.count(mode.same_proc()), 1);
+  EXPECT_EQ(modes.count(mode.diff_proc()), 1);
+  EXPECT_EQ(modes.count(mode.diff_host()), 1);
+  EXPECT_EQ(modes.count(proto::OptionalMode::RTPS), 1);
+}
+
+TEST(ClientTest, request_mode) {
+  auto node = CreateNode("client_test_request_mode");
+  auto client =
+      node->CreateClient<Chatter, Chatter>("client_test_request_mode");
+  // nothing discovered yet
+  EXPECT_EQ(client->RequestMode(), proto::OptionalMode::RTPS);
+
+  auto server = node->CreateService<Chatter, Chatter>(
+      "client_test_request_mode",
+      [](const std::shared_ptr<Chatter>& request,
+         std::shared_ptr<Chatter>& response) {
+        response->set_seq(request->seq());
+      });
+  ASSERT_NE(server, nullptr);
+  ASSERT_TRUE(client->WaitForService(std::chrono::seconds(2)));
+  auto same_proc = ServiceCommunicationMode().same_proc();
+  for (int i = 0; i < 100 && client->RequestMode() != same_proc; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(client->RequestMode(), same_proc);
+  auto response =
+      client->Call(MakeRequest(3), Time::Now().ToNanosecond() + 1000000000);
+  ASSERT_NE(response, nullptr);
+  EXPECT_EQ(response->seq(), 3);
+}
+
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  return RUN_ALL_TESTS();
+}
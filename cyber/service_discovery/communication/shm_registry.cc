@@ -0,0 +1,371 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service_discovery/communication/shm_registry.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <unordered_set>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+namespace {
+constexpr int kMaxProcesses = 128;
+constexpr size_t kHostNameSize = 64;
+constexpr size_t kMinSegmentSize = 64 * 1024;
+}  // namespace
+
+struct ShmRegistry::Slot {
+	std::atomic<int32_t> process_id;
+	std::atomic<uint32_t> doorbell;
+	// odd while the entry is replaced or the slot is free, 0 before any entry
+	std::atomic<uint64_t> version;
+	std::atomic<uint64_t> segment;
+	std::atomic<uint64_t> size;
+	char host_name[kHostNameSize];
+};
+
+struct ShmRegistry::Table {
+	Slot slots[kMaxProcesses];
+};
+
+ShmRegistry::ShmRegistry(const std::string& name, const std::string& host_name, int process_id)
+	: name_(name),
+	host_name_(host_name.substr(0, kHostNameSize - 1)),
+	process_id_(process_id),
+	table_(nullptr),
+	slot_(-1),
+	segment_(0),
+	addr_(nullptr),
+	capacity_(0) {}
+
+ShmRegistry::~ShmRegistry() { Shutdown(); }
+
+bool ShmRegistry::Init() {
+	if (table_ != nullptr) {
+		return true;
+	}
+
+	std::string table_name = "/" + name_;
+	int fd = shm_open(table_name.c_str(), O_RDWR | O_CREAT, 0644);
+	if (fd < 0) {
+		AERROR << "open shm registry " << name_ << " failed: " << strerror(errno);
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0 ||
+		(static_cast<size_t>(st.st_size) < sizeof(Table) && ftruncate(fd, sizeof(Table)) < 0)) {
+		AERROR << "size shm registry " << name_ << " failed: " << strerror(errno);
+		close(fd);
+		return false;
+	}
+
+	void* addr = mmap(nullptr, sizeof(Table), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED) {
+		AERROR << "attach shm registry " << name_ << " failed: " << strerror(errno);
+		return false;
+	}
+	table_ = static_cast<Table*>(addr);
+
+	// a slot left behind by an earlier process with our pid is ours again
+	for (int i = 0; i < kMaxProcesses && slot_ < 0; ++i) {
+		if (table_->slots[i].process_id.load() == process_id_) {
+			slot_ = i;
+		}
+	}
+	for (int i = 0; i < kMaxProcesses && slot_ < 0; ++i) {
+		int32_t expected = 0;
+		if (table_->slots[i].process_id.compare_exchange_strong(expected, process_id_)) {
+			slot_ = i;
+		}
+	}
+	if (slot_ < 0) {
+		AERROR << "shm registry " << name_ << " is full.";
+		munmap(table_, sizeof(Table));
+		table_ = nullptr;
+		return false;
+	}
+
+	auto& slot = table_->slots[slot_];
+	slot.version.fetch_or(1);
+	std::strncpy(slot.host_name, host_name_.c_str(), kHostNameSize - 1);
+	slot.host_name[kHostNameSize - 1] = '\0';
+	segment_ = slot.segment.load();
+	return true;
+}
+
+void ShmRegistry::Shutdown() {
+	if (table_ == nullptr) {
+		return;
+	}
+
+	auto& slot = table_->slots[slot_];
+	slot.version.fetch_or(1);
+	if (addr_ != nullptr) {
+		munmap(addr_, capacity_);
+		shm_unlink(SegmentName(process_id_, segment_).c_str());
+		addr_ = nullptr;
+		capacity_ = 0;
+	}
+	slot.process_id.store(0);
+	for (int i = 0; i < kMaxProcesses; ++i) {
+		if (i != slot_ && table_->slots[i].process_id.load() != 0) {
+			Ring(i);
+		}
+	}
+
+	for (auto& peer : peers_) {
+		Unmap(&peer.second);
+	}
+	peers_.clear();
+	munmap(table_, sizeof(Table));
+	table_ = nullptr;
+	slot_ = -1;
+}
+
+bool ShmRegistry::Write(const std::string& data) {
+	if (table_ == nullptr) {
+		return false;
+	}
+
+	auto& slot = table_->slots[slot_];
+	uint64_t version = slot.version.load(std::memory_order_relaxed) | 1;
+	slot.version.store(version, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	bool result = (addr_ != nullptr && data.size() <= capacity_) || Grow(data.size());
+	if (result) {
+		std::memcpy(addr_, data.data(), data.size());
+		slot.size.store(data.size(), std::memory_order_relaxed);
+	}
+	slot.version.store(version + 1, std::memory_order_release);
+
+	for (int i = 0; i < kMaxProcesses; ++i) {
+		if (i != slot_ && table_->slots[i].process_id.load() != 0) {
+			Ring(i);
+		}
+	}
+	return result;
+}
+
+void ShmRegistry::Poll(bool check_liveness, std::vector<Entry>* changed, std::vector<int>* gone) {
+	if (table_ == nullptr) {
+		return;
+	}
+
+	std::unordered_set<int> alive;
+	for (int i = 0; i < kMaxProcesses; ++i) {
+		auto& slot = table_->slots[i];
+		int process_id = slot.process_id.load(std::memory_order_acquire);
+		if (i == slot_ || process_id == 0 || process_id == process_id_ || IsForeign(slot)) {
+			continue;
+		}
+
+		auto& peer = peers_[process_id];
+		if (peer.slot != i) {
+			Unmap(&peer);
+			peer = Peer();
+			peer.slot = i;
+		}
+		if (check_liveness && kill(process_id, 0) < 0 && errno == ESRCH) {
+			Evict(i, process_id);
+			continue;
+		}
+		alive.insert(process_id);
+
+		if (slot.version.load(std::memory_order_acquire) == peer.version) {
+			continue;
+		}
+		std::string data;
+		if (Read(process_id, &slot, &peer, &data)) {
+			changed->push_back({process_id, std::move(data)});
+		}
+	}
+
+	for (auto it = peers_.begin(); it != peers_.end();) {
+		if (alive.count(it->first) != 0) {
+			++it;
+			continue;
+		}
+		if (it->second.version != 0) {
+			gone->push_back(it->first);
+		}
+		Unmap(&it->second);
+		it = peers_.erase(it);
+	}
+}
+
+uint32_t ShmRegistry::Ticket() const {
+	if (table_ == nullptr) {
+		return 0;
+	}
+	return table_->slots[slot_].doorbell.load();
+}
+
+void ShmRegistry::Wait(uint32_t ticket, int timeout_ms) {
+	if (table_ == nullptr) {
+		return;
+	}
+	struct timespec timeout;
+	timeout.tv_sec = timeout_ms / 1000;
+	timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+	auto doorbell = reinterpret_cast<uint32_t*>(&table_->slots[slot_].doorbell);
+	syscall(SYS_futex, doorbell, FUTEX_WAIT, ticket, &timeout, nullptr, 0);
+}
+
+void ShmRegistry::Wake() {
+	if (table_ == nullptr) {
+		return;
+	}
+	Ring(slot_);
+}
+
+std::string ShmRegistry::SegmentName(int process_id, uint64_t segment) const {
+	return "/" + name_ + "." + std::to_string(process_id) + "." + std::to_string(segment);
+}
+
+bool ShmRegistry::Grow(size_t size) {
+	size_t capacity = kMinSegmentSize;
+	while (capacity < size) {
+		capacity <<= 1;
+	}
+
+	uint64_t segment = segment_ + 1;
+	std::string name = SegmentName(process_id_, segment);
+	int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		AERROR << "create shm registry entry " << name << " failed: " << strerror(errno);
+		return false;
+	}
+	if (ftruncate(fd, capacity) < 0) {
+		AERROR << "ftruncate failed: " << strerror(errno);
+		close(fd);
+		shm_unlink(name.c_str());
+		return false;
+	}
+	void* addr = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED) {
+		AERROR << "attach shm registry entry " << name << " failed: " << strerror(errno);
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	// readers still holding the previous segment keep their mapping
+	if (addr_ != nullptr) {
+		munmap(addr_, capacity_);
+	}
+	shm_unlink(SegmentName(process_id_, segment_).c_str());
+	addr_ = addr;
+	capacity_ = capacity;
+	segment_ = segment;
+	table_->slots[slot_].segment.store(segment, std::memory_order_relaxed);
+	return true;
+}
+
+bool ShmRegistry::IsForeign(const Slot& slot) const {
+	char host_name[kHostNameSize];
+	std::memcpy(host_name, slot.host_name, kHostNameSize);
+	host_name[kHostNameSize - 1] = '\0';
+	return host_name_ != host_name;
+}
+
+bool ShmRegistry::Read(int process_id, Slot* slot, Peer* peer, std::string* data) {
+	uint64_t version = slot->version.load(std::memory_order_acquire);
+	if (version == 0 || (version & 1) != 0) {
+		return false;
+	}
+
+	uint64_t segment = slot->segment.load(std::memory_order_relaxed);
+	uint64_t size = slot->size.load(std::memory_order_relaxed);
+	if (peer->addr == nullptr || peer->segment != segment) {
+		Unmap(peer);
+		int fd = shm_open(SegmentName(process_id, segment).c_str(), O_RDONLY, 0);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat st;
+		if (fstat(fd, &st) < 0 || st.st_size == 0) {
+			close(fd);
+			return false;
+		}
+		void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (addr == MAP_FAILED) {
+			return false;
+		}
+		peer->addr = addr;
+		peer->size = st.st_size;
+		peer->segment = segment;
+	}
+	if (size > peer->size) {
+		return false;
+	}
+	data->assign(static_cast<const char*>(peer->addr), size);
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (slot->version.load(std::memory_order_relaxed) != version) {
+		return false;
+	}
+	peer->version = version;
+	return true;
+}
+
+void ShmRegistry::Unmap(Peer* peer) {
+	if (peer->addr != nullptr) {
+		munmap(peer->addr, peer->size);
+		peer->addr = nullptr;
+		peer->size = 0;
+	}
+}
+
+void ShmRegistry::Evict(int index, int process_id) {
+	auto& slot = table_->slots[index];
+	slot.version.fetch_or(1);
+	int32_t expected = process_id;
+	if (!slot.process_id.compare_exchange_strong(expected, 0)) {
+		return;
+	}
+	shm_unlink(SegmentName(process_id, slot.segment.load()).c_str());
+	AINFO << "process " << process_id << " died, removed from shm registry " << name_;
+}
+
+void ShmRegistry::Ring(int index) {
+	auto& doorbell = table_->slots[index].doorbell;
+	doorbell.fetch_add(1);
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&doorbell), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
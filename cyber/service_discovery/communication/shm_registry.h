@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SERVICE_DISCOVERY_COMMUNICATION_SHM_REGISTRY_H_
+#define CYBER_SERVICE_DISCOVERY_COMMUNICATION_SHM_REGISTRY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+/**
+ * @class ShmRegistry
+ * @brief Table in shared memory through which the processes of one host
+ * exchange their topology without going through rtps.
+ *
+ * Each process claims a slot holding its pid and the version of its entry,
+ * the entry itself lives in a segment of its own which is replaced when it
+ * outgrows it. Writers ring the doorbell of every other slot, readers sleep
+ * on their own one. Slots of dead processes are reclaimed by whoever notices.
+ */
+class ShmRegistry {
+public:
+	struct Entry {
+		int process_id;
+		std::string data;
+	};
+
+	/**
+	* @brief Construct a new ShmRegistry object
+	*
+	* @param name of the shared memory table, processes using the same name see
+	* each other
+	* @param host_name written into our slot, slots of other hosts are ignored
+	* @param process_id the pid our slot is claimed for
+	*/
+	ShmRegistry(const std::string& name, const std::string& host_name, int process_id);
+	virtual ~ShmRegistry();
+
+	/**
+	* @brief Open or create the table and claim a slot in it
+	*
+	* @return false if shared memory is unusable or the table is full
+	*/
+	bool Init();
+
+	/**
+	* @brief Release our slot and remove our entry
+	*/
+	void Shutdown();
+
+	/**
+	* @brief Replace our entry and wake up the other processes
+	*/
+	bool Write(const std::string& data);
+
+	/**
+	* @brief Collect the entries of the other processes that changed since the
+	* previous call, and the processes that left since then
+	*
+	* @param check_liveness also drop processes that died without leaving
+	*/
+	void Poll(bool check_liveness, std::vector<Entry>* changed, std::vector<int>* gone);
+
+	/**
+	* @brief Value of our doorbell, to be taken before Poll and passed to Wait
+	*/
+	uint32_t Ticket() const;
+
+	/**
+	* @brief Sleep until the doorbell moves past ticket or timeout_ms elapses
+	*/
+	void Wait(uint32_t ticket, int timeout_ms);
+
+	/**
+	* @brief Ring our own doorbell
+	*/
+	void Wake();
+
+private:
+	struct Slot;
+	struct Table;
+	struct Peer {
+		int slot = -1;
+		uint64_t version = 0;
+		uint64_t segment = 0;
+		void* addr = nullptr;
+		size_t size = 0;
+	};
+
+	std::string SegmentName(int process_id, uint64_t segment) const;
+	bool Grow(size_t size);
+	bool IsForeign(const Slot& slot) const;
+	bool Read(int process_id, Slot* slot, Peer* peer, std::string* data);
+	void Unmap(Peer* peer);
+	void Evict(int index, int process_id);
+	void Ring(int index);
+
+	std::string name_;
+	std::string host_name_;
+	int process_id_;
+	Table* table_;
+	int slot_;
+	uint64_t segment_;
+	void* addr_;
+	size_t capacity_;
+	std::unordered_map<int, Peer> peers_;
+};
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_DISCOVERY_COMMUNICATION_SHM_REGISTRY_H_
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service_discovery/communication/shm_registry.h"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+class ShmRegistryTest : public ::testing::Test {
+ protected:
+  ShmRegistryTest() : name_("cyber_sd_test." + std::to_string(getpid())) {}
+  virtual ~ShmRegistryTest() { shm_unlink(("/" + name_).c_str()); }
+
+  std::string name_;
+};
+
+TEST_F(ShmRegistryTest, write_and_poll) {
+  ShmRegistry self(name_, "host", getpid());
+  ShmRegistry peer(name_, "host", getppid());
+  ShmRegistry other_host(name_, "other_host", getppid() + 1);
+  EXPECT_TRUE(self.Init());
+  EXPECT_TRUE(peer.Init());
+  EXPECT_TRUE(other_host.Init());
+
+  std::vector<ShmRegistry::Entry> changed;
+  std::vector<int> gone;
+  self.Poll(true, &changed, &gone);
+  EXPECT_TRUE(changed.empty());
+
+  EXPECT_TRUE(peer.Write("snapshot"));
+  EXPECT_TRUE(other_host.Write("snapshot"));
+  self.Poll(true, &changed, &gone);
+  ASSERT_EQ(changed.size(), 1);
+  EXPECT_EQ(changed[0].process_id, getppid());
+  EXPECT_EQ(changed[0].data, "snapshot");
+
+  changed.clear();
+  self.Poll(true, &changed, &gone);
+  EXPECT_TRUE(changed.empty());
+
+  // outgrows the segment
+  std::string big(1 << 20, 'x');
+  EXPECT_TRUE(peer.Write(big));
+  self.Poll(true, &changed, &gone);
+  ASSERT_EQ(changed.size(), 1);
+  EXPECT_EQ(changed[0].data, big);
+  EXPECT_TRUE(gone.empty());
+
+  peer.Shutdown();
+  changed.clear();
+  self.Poll(true, &changed, &gone);
+  EXPECT_TRUE(changed.empty());
+  ASSERT_EQ(gone.size(), 1);
+  EXPECT_EQ(gone[0], getppid());
+}
+
+TEST_F(ShmRegistryTest, dead_process) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    _exit(0);
+  }
+  waitpid(pid, nullptr, 0);
+
+  ShmRegistry self(name_, "host", getpid());
+  ShmRegistry dead(name_, "host", pid);
+  EXPECT_TRUE(self.Init());
+  EXPECT_TRUE(dead.Init());
+  EXPECT_TRUE(dead.Write("snapshot"));
+
+  std::vector<ShmRegistry::Entry> changed;
+  std::vector<int> gone;
+  self.Poll(false, &changed, &gone);
+  EXPECT_EQ(changed.size(), 1);
+  EXPECT_TRUE(gone.empty());
+
+  changed.clear();
+  self.Poll(true, &changed, &gone);
+  EXPECT_TRUE(changed.empty());
+  ASSERT_EQ(gone.size(), 1);
+  EXPECT_EQ(gone[0], pid);
+}
+
+TEST_F(ShmRegistryTest, wait) {
+  ShmRegistry self(name_, "host", getpid());
+  ShmRegistry peer(name_, "host", getppid());
+  EXPECT_TRUE(self.Init());
+  EXPECT_TRUE(peer.Init());
+
+  auto start = std::chrono::steady_clock::now();
+  self.Wait(self.Ticket(), 50);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(40));
+
+  uint32_t ticket = self.Ticket();
+  EXPECT_TRUE(peer.Write("snapshot"));
+  start = std::chrono::steady_clock::now();
+  self.Wait(ticket, 5000);
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(1000));
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
@@ -16,7 +16,7 @@
 
 #include "cyber/service_discovery/container/graph.h"
 
-#include <queue>
+#include <algorithm>
 
 namespace apollo {
 namespace cyber {
@@ -90,7 +90,7 @@ bool Edge::IsValid() const {
 
 std::string Edge::GetKey() const { return value_ + "_" + dst_.GetKey(); }
 
-Graph::Graph() {}
+Graph::Graph() : num_of_edge_(0) {}
 
 Graph::~Graph() {
   edges_.clear();
@@ -102,16 +102,27 @@ void Graph::Insert(const Edge& e) {
     return;
   }
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto& e_v = e.value();
-  if (edges_.find(e_v) == edges_.end()) {
-    edges_[e_v] = RelatedVertices();
-  }
+  uint32_t e_id = InternEdge(e.value());
 
   if (!e.src().IsDummy()) {
-    InsertOutgoingEdge(e);
+    uint32_t src = InternVertice(e.src().GetKey());
+    auto& src_v_set = edges_[e_id].src;
+    if (std::find(src_v_set.begin(), src_v_set.end(), src) == src_v_set.end()) {
+      src_v_set.push_back(src);
+      for (auto dst : edges_[e_id].dst) {
+        InsertCompleteEdge(src, dst);
+      }
+    }
   }
   if (!e.dst().IsDummy()) {
-    InsertIncomingEdge(e);
+    uint32_t dst = InternVertice(e.dst().GetKey());
+    auto& dst_v_set = edges_[e_id].dst;
+    if (std::find(dst_v_set.begin(), dst_v_set.end(), dst) == dst_v_set.end()) {
+      dst_v_set.push_back(dst);
+      for (auto src : edges_[e_id].src) {
+        InsertCompleteEdge(src, dst);
+      }
+    }
   }
 }
 
@@ -120,26 +131,43 @@ void Graph::Delete(const Edge& e) {
     return;
   }
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto& e_v = e.value();
-  if (edges_.find(e_v) == edges_.end()) {
+  auto e_it = edge_ids_.find(e.value());
+  if (e_it == edge_ids_.end()) {
     return;
   }
+  auto& related = edges_[e_it->second];
 
   if (!e.src().IsDummy()) {
-    DeleteOutgoingEdge(e);
+    auto v_it = vertice_ids_.find(e.src().GetKey());
+    if (v_it != vertice_ids_.end()) {
+      uint32_t src = v_it->second;
+      auto it = std::find(related.src.begin(), related.src.end(), src);
+      if (it != related.src.end()) {
+        related.src.erase(it);
+        for (auto dst : related.dst) {
+          DeleteCompleteEdge(src, dst);
+        }
+      }
+    }
   }
   if (!e.dst().IsDummy()) {
-    DeleteIncomingEdge(e);
+    auto v_it = vertice_ids_.find(e.dst().GetKey());
+    if (v_it != vertice_ids_.end()) {
+      uint32_t dst = v_it->second;
+      auto it = std::find(related.dst.begin(), related.dst.end(), dst);
+      if (it != related.dst.end()) {
+        related.dst.erase(it);
+        for (auto src : related.src) {
+          DeleteCompleteEdge(src, dst);
+        }
+      }
+    }
   }
 }
 
 uint32_t Graph::GetNumOfEdge() {
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  uint32_t num = 0;
-  for (auto& item : list_) {
-    num += static_cast<int>(item.second.size());
-  }
-  return num;
+  return num_of_edge_;
 }
 
 FlowDirection Graph::GetDirectionOf(const Vertice& lhs, const Vertice& rhs) {
@@ -147,135 +175,85 @@ FlowDirection Graph::GetDirectionOf(const Vertice& lhs, const Vertice& rhs) {
     return UNREACHABLE;
   }
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (list_.count(lhs.GetKey()) == 0 || list_.count(rhs.GetKey()) == 0) {
+  auto lhs_it = vertice_ids_.find(lhs.GetKey());
+  auto rhs_it = vertice_ids_.find(rhs.GetKey());
+  if (lhs_it == vertice_ids_.end() || rhs_it == vertice_ids_.end() ||
+      !list_[lhs_it->second].linked || !list_[rhs_it->second].linked) {
     return UNREACHABLE;
   }
-  if (LevelTraverse(lhs, rhs)) {
+  if (LevelTraverse(lhs_it->second, rhs_it->second)) {
     return UPSTREAM;
   }
-  if (LevelTraverse(rhs, lhs)) {
+  if (LevelTraverse(rhs_it->second, lhs_it->second)) {
     return DOWNSTREAM;
   }
   return UNREACHABLE;
 }
 
-void Graph::InsertOutgoingEdge(const Edge& e) {
-  auto& e_v = e.value();
-  auto& src_v_set = edges_[e_v].src;
-  auto& src_v = e.src();
-  auto& v_k = src_v.GetKey();
-  if (src_v_set.find(v_k) != src_v_set.end()) {
-    return;
-  }
-  src_v_set[v_k] = src_v;
-
-  auto& dst_v_set = edges_[e_v].dst;
-  Edge insert_e;
-  insert_e.set_src(src_v);
-  insert_e.set_value(e.value());
-  for (auto& item : dst_v_set) {
-    insert_e.set_dst(item.second);
-    InsertCompleteEdge(insert_e);
+uint32_t Graph::InternVertice(const std::string& key) {
+  auto result = vertice_ids_.emplace(key, static_cast<uint32_t>(list_.size()));
+  if (result.second) {
+    list_.emplace_back();
   }
+  return result.first->second;
 }
 
-void Graph::InsertIncomingEdge(const Edge& e) {
-  auto& e_v = e.value();
-  auto& dst_v_set = edges_[e_v].dst;
-  auto& dst_v = e.dst();
-  auto& v_k = dst_v.GetKey();
-  if (dst_v_set.find(v_k) != dst_v_set.end()) {
-    return;
-  }
-  dst_v_set[v_k] = dst_v;
-
-  auto& src_v_set = edges_[e_v].src;
-  Edge insert_e;
-  insert_e.set_dst(dst_v);
-  insert_e.set_value(e.value());
-  for (auto& item : src_v_set) {
-    insert_e.set_src(item.second);
-    InsertCompleteEdge(insert_e);
+uint32_t Graph::InternEdge(const std::string& value) {
+  auto result = edge_ids_.emplace(value, static_cast<uint32_t>(edges_.size()));
+  if (result.second) {
+    edges_.emplace_back();
   }
+  return result.first->second;
 }
 
-void Graph::InsertCompleteEdge(const Edge& e) {
-  auto& src_v_k = e.src().GetKey();
-  if (list_.find(src_v_k) == list_.end()) {
-    list_[src_v_k] = VerticeSet();
-  }
-  auto& dst_v_k = e.dst().GetKey();
-  if (list_.find(dst_v_k) == list_.end()) {
-    list_[dst_v_k] = VerticeSet();
+void Graph::InsertCompleteEdge(uint32_t src, uint32_t dst) {
+  list_[src].linked = true;
+  list_[dst].linked = true;
+  ++num_of_edge_;
+  auto& adjacent = list_[src].dst;
+  for (auto& item : adjacent) {
+    if (item.first == dst) {
+      ++item.second;
+      return;
+    }
   }
-  list_[src_v_k][e.GetKey()] = e.dst();
+  adjacent.emplace_back(dst, 1);
 }
 
-void Graph::DeleteOutgoingEdge(const Edge& e) {
-  auto& e_v = e.value();
-  auto& src_v_set = edges_[e_v].src;
-  auto& src_v = e.src();
-  auto& v_k = src_v.GetKey();
-  if (src_v_set.find(v_k) == src_v_set.end()) {
-    return;
-  }
-  src_v_set.erase(v_k);
-
-  auto& dst_v_set = edges_[e_v].dst;
-  Edge delete_e;
-  delete_e.set_src(src_v);
-  delete_e.set_value(e.value());
-  for (auto& item : dst_v_set) {
-    delete_e.set_dst(item.second);
-    DeleteCompleteEdge(delete_e);
+void Graph::DeleteCompleteEdge(uint32_t src, uint32_t dst) {
+  auto& adjacent = list_[src].dst;
+  for (auto it = adjacent.begin(); it != adjacent.end(); ++it) {
+    if (it->first == dst) {
+      --num_of_edge_;
+      if (--it->second == 0) {
+        *it = adjacent.back();
+        adjacent.pop_back();
+      }
+      return;
+    }
   }
 }
 
-void Graph::DeleteIncomingEdge(const Edge& e) {
-  auto& e_v = e.value();
-  auto& dst_v_set = edges_[e_v].dst;
-  auto& dst_v = e.dst();
-  auto& v_k = dst_v.GetKey();
-  if (dst_v_set.find(v_k) == dst_v_set.end()) {
-    return;
-  }
-  dst_v_set.erase(v_k);
-
-  auto& src_v_set = edges_[e_v].src;
-  Edge delete_e;
-  delete_e.set_dst(dst_v);
-  delete_e.set_value(e.value());
-  for (auto& item : src_v_set) {
-    delete_e.set_src(item.second);
-    DeleteCompleteEdge(delete_e);
+bool Graph::LevelTraverse(uint32_t start, uint32_t end) {
+  if (start == end) {
+    return true;
   }
-}
-
-void Graph::DeleteCompleteEdge(const Edge& e) {
-  auto& src_v_k = e.src().GetKey();
-  list_[src_v_k].erase(e.GetKey());
-}
-
-bool Graph::LevelTraverse(const Vertice& start, const Vertice& end) {
-  std::unordered_map<std::string, bool> visited;
-  visited[end.GetKey()] = false;
-  std::queue<Vertice> unvisited;
-  unvisited.emplace(start);
-  while (!unvisited.empty()) {
-    auto curr = unvisited.front();
-    unvisited.pop();
-    if (visited[curr.GetKey()]) {
-      continue;
-    }
-    visited[curr.GetKey()] = true;
-    if (curr == end) {
-      break;
-    }
-    for (auto& item : list_[curr.GetKey()]) {
-      unvisited.push(item.second);
+  std::vector<bool> visited(list_.size(), false);
+  std::vector<uint32_t> unvisited;
+  unvisited.push_back(start);
+  visited[start] = true;
+  for (size_t i = 0; i < unvisited.size(); ++i) {
+    for (auto& item : list_[unvisited[i]].dst) {
+      if (item.first == end) {
+        return true;
+      }
+      if (!visited[item.first]) {
+        visited[item.first] = true;
+        unvisited.push_back(item.first);
+      }
     }
   }
-  return visited[end.GetKey()];
+  return false;
 }
 
 }  // namespace service_discovery
@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
 
@@ -90,11 +92,10 @@ public:
   std::string value_;
 };
 
+// Vertices and edge values are interned to dense ids, the adjacency of a
+// vertice is a vector of the vertices it reaches.
 class Graph {
  public:
-  using VerticeSet = std::unordered_map<std::string, Vertice>;
-  using AdjacencyList = std::unordered_map<std::string, VerticeSet>;
-
   Graph();
   virtual ~Graph();
 
@@ -105,24 +106,32 @@ class Graph {
   FlowDirection GetDirectionOf(const Vertice& lhs, const Vertice& rhs);
 
  private:
+  using IdMap = std::unordered_map<std::string, uint32_t>;
+
+  // the vertices writing to and reading from one edge value
   struct RelatedVertices {
-    RelatedVertices() {}
+    std::vector<uint32_t> src;
+    std::vector<uint32_t> dst;
+  };
 
-    VerticeSet src;
-    VerticeSet dst;
+  struct Adjacency {
+    // set once a complete edge starts or ends here
+    bool linked = false;
+    // reached vertices with the number of edge values leading to each
+    std::vector<std::pair<uint32_t, uint32_t>> dst;
   };
-  using EdgeInfo = std::unordered_map<std::string, RelatedVertices>;
-
-  void InsertOutgoingEdge(const Edge& e);
-  void InsertIncomingEdge(const Edge& e);
-  void InsertCompleteEdge(const Edge& e);
-  void DeleteOutgoingEdge(const Edge& e);
-  void DeleteIncomingEdge(const Edge& e);
-  void DeleteCompleteEdge(const Edge& e);
-  bool LevelTraverse(const Vertice& start, const Vertice& end);
-
-  EdgeInfo edges_;
-  AdjacencyList list_;
+
+  uint32_t InternVertice(const std::string& key);
+  uint32_t InternEdge(const std::string& value);
+  void InsertCompleteEdge(uint32_t src, uint32_t dst);
+  void DeleteCompleteEdge(uint32_t src, uint32_t dst);
+  bool LevelTraverse(uint32_t start, uint32_t end);
+
+  IdMap vertice_ids_;
+  IdMap edge_ids_;
+  std::vector<RelatedVertices> edges_;
+  std::vector<Adjacency> list_;
+  uint32_t num_of_edge_;
   base::AtomicRWLock rw_lock_;
 };
 
@@ -40,12 +40,16 @@ bool MultiValueWarehouse::Add(uint64_t key, const RolePtr& role,
   }
   std::pair<uint64_t, RolePtr> role_pair(key, role);
   roles_.insert(role_pair);
+  index_.Insert(key, role);
+  version_.fetch_add(1, std::memory_order_release);
   return true;
 }
 
 void MultiValueWarehouse::Clear() {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
   roles_.clear();
+  index_.Clear();
+  version_.fetch_add(1, std::memory_order_release);
 }
 
 std::size_t MultiValueWarehouse::Size() {
@@ -55,7 +59,10 @@ std::size_t MultiValueWarehouse::Size() {
 
 void MultiValueWarehouse::Remove(uint64_t key) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  roles_.erase(key);
+  auto range = roles_.equal_range(key);
+  for (auto it = range.first; it != range.second;) {
+    it = Erase(it);
+  }
 }
 
 void MultiValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
@@ -63,7 +70,7 @@ void MultiValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
   auto range = roles_.equal_range(key);
   for (auto it = range.first; it != range.second;) {
     if (it->second->Match(role->attributes())) {
-      it = roles_.erase(it);
+      it = Erase(it);
     } else {
       ++it;
     }
@@ -72,12 +79,33 @@ void MultiValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
 
 void MultiValueWarehouse::Remove(const RoleAttributes& target_attr) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto it = roles_.begin(); it != roles_.end();) {
-    auto curr_role = it->second;
-    if (curr_role->Match(target_attr)) {
-      it = roles_.erase(it);
-    } else {
-      ++it;
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto it = roles_.begin(); it != roles_.end();) {
+      auto curr_role = it->second;
+      if (curr_role->Match(target_attr)) {
+        it = Erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return;
+  }
+
+  // erasing shrinks the candidates, so they are copied first
+  RoleIndex::Entries matched;
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched.emplace_back(entry);
+    }
+  }
+  for (auto& entry : matched) {
+    auto range = roles_.equal_range(entry.key);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == entry.role) {
+        Erase(it);
+        break;
+      }
     }
   }
 }
@@ -146,9 +174,19 @@ bool MultiValueWarehouse::Search(const RoleAttributes& target_attr,
                                  RolePtr* first_matched_role) {
   RETURN_VAL_IF_NULL(first_matched_role, false);
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      *first_matched_role = item.second;
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        *first_matched_role = item.second;
+        return true;
+      }
+    }
+    return false;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      *first_matched_role = entry.role;
       return true;
     }
   }
@@ -171,9 +209,19 @@ bool MultiValueWarehouse::Search(const RoleAttributes& target_attr,
   RETURN_VAL_IF_NULL(matched_roles, false);
   bool find = false;
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles->emplace_back(item.second);
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        matched_roles->emplace_back(item.second);
+        find = true;
+      }
+    }
+    return find;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched_roles->emplace_back(entry.role);
       find = true;
     }
   }
@@ -186,9 +234,19 @@ bool MultiValueWarehouse::Search(
   RETURN_VAL_IF_NULL(matched_roles_attr, false);
   bool find = false;
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles_attr->emplace_back(item.second->attributes());
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        matched_roles_attr->emplace_back(item.second->attributes());
+        find = true;
+      }
+    }
+    return find;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched_roles_attr->emplace_back(entry.role->attributes());
       find = true;
     }
   }
@@ -197,18 +255,44 @@ bool MultiValueWarehouse::Search(
 
 void MultiValueWarehouse::GetAllRoles(std::vector<RolePtr>* roles) {
   RETURN_IF_NULL(roles);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles->emplace_back(item.second);
-  }
+  auto snapshot = GetSnapshot();
+  roles->insert(roles->end(), snapshot->roles.begin(), snapshot->roles.end());
 }
 
 void MultiValueWarehouse::GetAllRoles(std::vector<RoleAttributes>* roles_attr) {
   RETURN_IF_NULL(roles_attr);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles_attr->emplace_back(item.second->attributes());
+  auto snapshot = GetSnapshot();
+  for (auto& role : snapshot->roles) {
+    roles_attr->emplace_back(role->attributes());
+  }
+}
+
+RoleSnapshotPtr MultiValueWarehouse::GetSnapshot() {
+  auto snapshot = std::atomic_load(&snapshot_);
+  if (snapshot != nullptr &&
+      snapshot->version == version_.load(std::memory_order_acquire)) {
+    return snapshot;
   }
+
+  auto fresh = std::make_shared<RoleSnapshot>();
+  {
+    ReadLockGuard<AtomicRWLock> lock(rw_lock_);
+    fresh->version = version_.load(std::memory_order_relaxed);
+    fresh->roles.reserve(roles_.size());
+    for (auto& item : roles_) {
+      fresh->roles.emplace_back(item.second);
+    }
+  }
+  snapshot = fresh;
+  std::atomic_store(&snapshot_, snapshot);
+  return snapshot;
+}
+
+MultiValueWarehouse::RoleMap::iterator MultiValueWarehouse::Erase(
+    RoleMap::iterator it) {
+  index_.Erase(it->first, it->second);
+  version_.fetch_add(1, std::memory_order_release);
+  return roles_.erase(it);
 }
 
 }  // namespace service_discovery
@@ -17,11 +17,13 @@
 #ifndef CYBER_SERVICE_DISCOVERY_CONTAINER_MULTI_VALUE_WAREHOUSE_H_
 #define CYBER_SERVICE_DISCOVERY_CONTAINER_MULTI_VALUE_WAREHOUSE_H_
 
+#include <atomic>
 #include <cstdint>
 #include <unordered_map>
 #include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
+#include "cyber/service_discovery/container/role_index.h"
 #include "cyber/service_discovery/container/warehouse_base.h"
 
 namespace apollo {
@@ -32,7 +34,7 @@ class MultiValueWarehouse : public WarehouseBase {
  public:
   using RoleMap = std::unordered_multimap<uint64_t, RolePtr>;
 
-  MultiValueWarehouse() {}
+  MultiValueWarehouse() : version_(0) {}
   virtual ~MultiValueWarehouse() {}
 
   bool Add(uint64_t key, const RolePtr& role,
@@ -66,8 +68,16 @@ class MultiValueWarehouse : public WarehouseBase {
   void GetAllRoles(std::vector<RolePtr>* roles) override;
   void GetAllRoles(std::vector<proto::RoleAttributes>* roles_attr) override;
 
+  RoleSnapshotPtr GetSnapshot() override;
+
  private:
+  RoleMap::iterator Erase(RoleMap::iterator it);
+
   RoleMap roles_;
+  RoleIndex index_;
+  // bumped under the write lock by every change
+  std::atomic<uint64_t> version_;
+  RoleSnapshotPtr snapshot_;
   base::AtomicRWLock rw_lock_;
 };
 
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/service_discovery/container/role_index.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+using proto::RoleAttributes;
+
+namespace {
+const RoleIndex::Entries kNoEntries;
+
+bool ChecksChannel(const RolePtr& role) {
+  return dynamic_cast<const RoleWriter*>(role.get()) != nullptr;
+}
+}  // namespace
+
+void RoleIndex::Insert(uint64_t key, const RolePtr& role) {
+  EntryId id{key, role.get()};
+  if (positions_.count(id) != 0) {
+    return;
+  }
+  auto& attr = role->attributes();
+  Position pos;
+  pos.in_node = Insert(&by_node_, attr.node_id(), key, role);
+  pos.in_channel = Insert(&by_channel_, attr.channel_id(), key, role);
+  pos.in_process = Insert(&by_process_, ProcessKey(attr), key, role);
+  positions_.emplace(id, pos);
+  if (!ChecksChannel(role)) {
+    ++channel_blind_;
+  }
+}
+
+void RoleIndex::Erase(uint64_t key, const RolePtr& role) {
+  auto search = positions_.find(EntryId{key, role.get()});
+  if (search == positions_.end()) {
+    return;
+  }
+  Position pos = search->second;
+  positions_.erase(search);
+  auto& attr = role->attributes();
+  Erase(&by_node_, attr.node_id(), pos.in_node, &Position::in_node);
+  Erase(&by_channel_, attr.channel_id(), pos.in_channel, &Position::in_channel);
+  Erase(&by_process_, ProcessKey(attr), pos.in_process, &Position::in_process);
+  if (!ChecksChannel(role)) {
+    --channel_blind_;
+  }
+}
+
+void RoleIndex::Clear() {
+  by_node_.clear();
+  by_channel_.clear();
+  by_process_.clear();
+  positions_.clear();
+  channel_blind_ = 0;
+}
+
+const RoleIndex::Entries* RoleIndex::Candidates(
+    const RoleAttributes& target_attr) const {
+  // every role compares node, host and process, only writers and readers
+  // compare the channel
+  if (target_attr.has_node_id()) {
+    return Find(by_node_, target_attr.node_id());
+  }
+  if (target_attr.has_channel_id() && channel_blind_ == 0) {
+    return Find(by_channel_, target_attr.channel_id());
+  }
+  if (target_attr.has_host_name() && target_attr.has_process_id()) {
+    return Find(by_process_, ProcessKey(target_attr));
+  }
+  return nullptr;
+}
+
+uint64_t RoleIndex::ProcessKey(const RoleAttributes& attr) {
+  return std::hash<std::string>()(attr.host_name()) * 31 +
+         static_cast<uint32_t>(attr.process_id());
+}
+
+std::size_t RoleIndex::Insert(IndexMap* index, uint64_t index_key,
+                              uint64_t key, const RolePtr& role) {
+  auto& entries = (*index)[index_key];
+  entries.push_back({key, role});
+  return entries.size() - 1;
+}
+
+void RoleIndex::Erase(IndexMap* index, uint64_t index_key, std::size_t pos,
+                      std::size_t Position::*field) {
+  auto search = index->find(index_key);
+  if (search == index->end()) {
+    return;
+  }
+  auto& entries = search->second;
+  if (pos + 1 != entries.size()) {
+    // the last entry fills the hole
+    entries[pos] = std::move(entries.back());
+    auto& moved = entries[pos];
+    positions_[EntryId{moved.key, moved.role.get()}].*field = pos;
+  }
+  entries.pop_back();
+  if (entries.empty()) {
+    index->erase(search);
+  }
+}
+
+const RoleIndex::Entries* RoleIndex::Find(const IndexMap& index,
+                                          uint64_t index_key) {
+  auto search = index.find(index_key);
+  if (search == index.end()) {
+    return &kNoEntries;
+  }
+  return &search->second;
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
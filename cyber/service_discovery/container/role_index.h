@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SERVICE_DISCOVERY_CONTAINER_ROLE_INDEX_H_
+#define CYBER_SERVICE_DISCOVERY_CONTAINER_ROLE_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/service_discovery/role/role.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+/**
+ * @class RoleIndex
+ * @brief Secondary indexes of a warehouse, by node, by channel and by
+ * process. Not thread safe, guarded by the warehouse lock.
+ */
+class RoleIndex {
+ public:
+  struct Entry {
+    uint64_t key;
+    RolePtr role;
+  };
+  using Entries = std::vector<Entry>;
+
+  RoleIndex() : channel_blind_(0) {}
+
+  // a role is indexed once per key
+  void Insert(uint64_t key, const RolePtr& role);
+  void Erase(uint64_t key, const RolePtr& role);
+  void Clear();
+
+  /**
+   * @brief The entries whose role may match target_attr, a superset of the
+   * matching ones
+   *
+   * @return nullptr if target_attr names no indexed field, so every role has
+   * to be checked
+   */
+  const Entries* Candidates(const proto::RoleAttributes& target_attr) const;
+
+ private:
+  using IndexMap = std::unordered_map<uint64_t, Entries>;
+
+  // where an entry sits in each of the indexes, so erasing it does not scan
+  struct Position {
+    std::size_t in_node;
+    std::size_t in_channel;
+    std::size_t in_process;
+  };
+  struct EntryId {
+    uint64_t key;
+    const RoleBase* role;
+    bool operator==(const EntryId& other) const {
+      return key == other.key && role == other.role;
+    }
+  };
+  struct EntryIdHash {
+    std::size_t operator()(const EntryId& id) const {
+      return std::hash<uint64_t>()(id.key) ^
+             std::hash<const RoleBase*>()(id.role);
+    }
+  };
+  using PositionMap = std::unordered_map<EntryId, Position, EntryIdHash>;
+
+  static uint64_t ProcessKey(const proto::RoleAttributes& attr);
+  static std::size_t Insert(IndexMap* index, uint64_t index_key, uint64_t key,
+                            const RolePtr& role);
+  void Erase(IndexMap* index, uint64_t index_key, std::size_t pos,
+             std::size_t Position::*field);
+  static const Entries* Find(const IndexMap& index, uint64_t index_key);
+
+  IndexMap by_node_;
+  IndexMap by_channel_;
+  IndexMap by_process_;
+  PositionMap positions_;
+  // roles whose Match ignores the channel, they spoil the channel index
+  std::size_t channel_blind_;
+};
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_DISCOVERY_CONTAINER_ROLE_INDEX_H_
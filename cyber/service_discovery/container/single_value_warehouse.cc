@@ -30,18 +30,26 @@ using proto::RoleAttributes;
 bool SingleValueWarehouse::Add(uint64_t key, const RolePtr& role,
                                bool ignore_if_exist) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (!ignore_if_exist) {
-    if (roles_.find(key) != roles_.end()) {
+  auto search = roles_.find(key);
+  if (search != roles_.end()) {
+    if (!ignore_if_exist) {
       return false;
     }
+    index_.Erase(key, search->second);
+    search->second = role;
+  } else {
+    roles_[key] = role;
   }
-  roles_[key] = role;
+  index_.Insert(key, role);
+  version_.fetch_add(1, std::memory_order_release);
   return true;
 }
 
 void SingleValueWarehouse::Clear() {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
   roles_.clear();
+  index_.Clear();
+  version_.fetch_add(1, std::memory_order_release);
 }
 
 std::size_t SingleValueWarehouse::Size() {
@@ -51,7 +59,10 @@ std::size_t SingleValueWarehouse::Size() {
 
 void SingleValueWarehouse::Remove(uint64_t key) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  roles_.erase(key);
+  auto search = roles_.find(key);
+  if (search != roles_.end()) {
+    Erase(search);
+  }
 }
 
 void SingleValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
@@ -63,17 +74,35 @@ void SingleValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
   if (!search->second->Match(role->attributes())) {
     return;
   }
-  roles_.erase(search);
+  Erase(search);
 }
 
 void SingleValueWarehouse::Remove(const RoleAttributes& target_attr) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto it = roles_.begin(); it != roles_.end();) {
-    auto curr_role = it->second;
-    if (curr_role->Match(target_attr)) {
-      it = roles_.erase(it);
-    } else {
-      ++it;
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto it = roles_.begin(); it != roles_.end();) {
+      auto curr_role = it->second;
+      if (curr_role->Match(target_attr)) {
+        it = Erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return;
+  }
+
+  // erasing shrinks the candidates, so they are copied first
+  RoleIndex::Entries matched;
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched.emplace_back(entry);
+    }
+  }
+  for (auto& entry : matched) {
+    auto search = roles_.find(entry.key);
+    if (search != roles_.end() && search->second == entry.role) {
+      Erase(search);
     }
   }
 }
@@ -136,9 +165,19 @@ bool SingleValueWarehouse::Search(const RoleAttributes& target_attr,
                                   RolePtr* first_matched_role) {
   RETURN_VAL_IF_NULL(first_matched_role, false);
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      *first_matched_role = item.second;
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        *first_matched_role = item.second;
+        return true;
+      }
+    }
+    return false;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      *first_matched_role = entry.role;
       return true;
     }
   }
@@ -161,9 +200,19 @@ bool SingleValueWarehouse::Search(const RoleAttributes& target_attr,
   RETURN_VAL_IF_NULL(matched_roles, false);
   bool find = false;
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles->emplace_back(item.second);
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        matched_roles->emplace_back(item.second);
+        find = true;
+      }
+    }
+    return find;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched_roles->emplace_back(entry.role);
       find = true;
     }
   }
@@ -176,9 +225,19 @@ bool SingleValueWarehouse::Search(
   RETURN_VAL_IF_NULL(matched_roles_attr, false);
   bool find = false;
   ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles_attr->emplace_back(item.second->attributes());
+  auto candidates = index_.Candidates(target_attr);
+  if (candidates == nullptr) {
+    for (auto& item : roles_) {
+      if (item.second->Match(target_attr)) {
+        matched_roles_attr->emplace_back(item.second->attributes());
+        find = true;
+      }
+    }
+    return find;
+  }
+  for (auto& entry : *candidates) {
+    if (entry.role->Match(target_attr)) {
+      matched_roles_attr->emplace_back(entry.role->attributes());
       find = true;
     }
   }
@@ -187,21 +246,47 @@ bool SingleValueWarehouse::Search(
 
 void SingleValueWarehouse::GetAllRoles(std::vector<RolePtr>* roles) {
   RETURN_IF_NULL(roles);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles->emplace_back(item.second);
-  }
+  auto snapshot = GetSnapshot();
+  roles->insert(roles->end(), snapshot->roles.begin(), snapshot->roles.end());
 }
 
 void SingleValueWarehouse::GetAllRoles(
     std::vector<RoleAttributes>* roles_attr) {
   RETURN_IF_NULL(roles_attr);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles_attr->emplace_back(item.second->attributes());
+  auto snapshot = GetSnapshot();
+  for (auto& role : snapshot->roles) {
+    roles_attr->emplace_back(role->attributes());
   }
 }
 
+RoleSnapshotPtr SingleValueWarehouse::GetSnapshot() {
+  auto snapshot = std::atomic_load(&snapshot_);
+  if (snapshot != nullptr &&
+      snapshot->version == version_.load(std::memory_order_acquire)) {
+    return snapshot;
+  }
+
+  auto fresh = std::make_shared<RoleSnapshot>();
+  {
+    ReadLockGuard<AtomicRWLock> lock(rw_lock_);
+    fresh->version = version_.load(std::memory_order_relaxed);
+    fresh->roles.reserve(roles_.size());
+    for (auto& item : roles_) {
+      fresh->roles.emplace_back(item.second);
+    }
+  }
+  snapshot = fresh;
+  std::atomic_store(&snapshot_, snapshot);
+  return snapshot;
+}
+
+SingleValueWarehouse::RoleMap::iterator SingleValueWarehouse::Erase(
+    RoleMap::iterator it) {
+  index_.Erase(it->first, it->second);
+  version_.fetch_add(1, std::memory_order_release);
+  return roles_.erase(it);
+}
+
 }  // namespace service_discovery
 }  // namespace cyber
 }  // namespace apollo
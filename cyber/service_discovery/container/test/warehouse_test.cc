@@ -274,6 +274,57 @@ TEST_F(WarehouseTest, get_all_roles) {
   EXPECT_EQ(role_attr_vec.size(), 2 * key_num_);
 }
 
+TEST_F(WarehouseTest, snapshot) {
+  auto snapshot = multi_.GetSnapshot();
+  EXPECT_EQ(snapshot->roles.size(), 2 * key_num_);
+  EXPECT_EQ(multi_.GetSnapshot(), snapshot);
+
+  multi_.Remove(0);
+  auto changed = multi_.GetSnapshot();
+  EXPECT_NE(changed, snapshot);
+  EXPECT_EQ(changed->roles.size(), 2 * key_num_ - 2);
+  EXPECT_EQ(snapshot->roles.size(), 2 * key_num_);
+
+  snapshot = single_.GetSnapshot();
+  auto role = std::make_shared<RoleBase>();
+  single_.Add(key_num_, role);
+  EXPECT_EQ(single_.GetSnapshot()->roles.size(), key_num_ + 1);
+}
+
+TEST_F(WarehouseTest, search_by_index) {
+  // node_id is indexed, channel_id only while every role is a writer
+  RoleAttributes attr;
+  attr.set_node_id(7);
+  std::vector<RolePtr> role_vec;
+  EXPECT_TRUE(multi_.Search(attr, &role_vec));
+  EXPECT_EQ(role_vec.size(), 2);
+
+  attr.Clear();
+  attr.set_channel_id(8);
+  attr.set_id(17);
+  role_vec.clear();
+  EXPECT_TRUE(multi_.Search(attr, &role_vec));
+  EXPECT_EQ(role_vec.size(), 1);
+
+  attr.Clear();
+  attr.set_host_name("caros");
+  attr.set_process_id(12345);
+  role_vec.clear();
+  EXPECT_TRUE(single_.Search(attr, &role_vec));
+  EXPECT_EQ(role_vec.size(), key_num_);
+
+  // replaced and removed roles leave the index
+  attr.Clear();
+  attr.set_node_id(3);
+  auto role = std::make_shared<RoleBase>();
+  single_.Add(3, role);
+  EXPECT_FALSE(single_.Search(attr));
+  multi_.Remove(attr);
+  EXPECT_FALSE(multi_.Search(attr));
+  EXPECT_EQ(multi_.Size(), 2 * key_num_ - 2);
+  EXPECT_FALSE(multi_.Search(3));
+}
+
 }  // namespace service_discovery
 }  // namespace cyber
 }  // namespace apollo
@@ -18,6 +18,7 @@
 #define CYBER_SERVICE_DISCOVERY_CONTAINER_WAREHOUSE_BASE_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "cyber/service_discovery/role/role.h"
@@ -26,6 +27,16 @@ namespace apollo {
 namespace cyber {
 namespace service_discovery {
 
+/**
+ * @brief Immutable copy of the roles of a warehouse, shared by its readers
+ * until the next change
+ */
+struct RoleSnapshot {
+  uint64_t version = 0;
+  std::vector<RolePtr> roles;
+};
+using RoleSnapshotPtr = std::shared_ptr<const RoleSnapshot>;
+
 class WarehouseBase {
  public:
   WarehouseBase() {}
@@ -61,6 +72,12 @@ class WarehouseBase {
 
   virtual void GetAllRoles(std::vector<RolePtr>* roles) = 0;
   virtual void GetAllRoles(std::vector<proto::RoleAttributes>* roles_attr) = 0;
+
+  /**
+   * @brief All the roles, without taking the lock as long as nothing changed
+   * since the previous call
+   */
+  virtual RoleSnapshotPtr GetSnapshot() = 0;
 };
 
 }  // namespace service_discovery
@@ -46,14 +46,15 @@ ChannelManager::~ChannelManager() {}
 void ChannelManager::GetChannelNames(std::vector<std::string>* channels) {
 	RETURN_IF_NULL(channels);
 
-	std::unordered_set<std::string> local_channels;
-	std::vector<RolePtr> roles;
-	channel_writers_.GetAllRoles(&roles);
-	channel_readers_.GetAllRoles(&roles);
-	for (auto& role : roles) {
-		local_channels.emplace(role->attributes().channel_name());
+	std::unordered_set<uint64_t> local_channels;
+	for (auto& snapshot : {channel_writers_.GetSnapshot(), channel_readers_.GetSnapshot()}) {
+		local_channels.reserve(local_channels.size() + snapshot->roles.size());
+		for (auto& role : snapshot->roles) {
+			if (local_channels.insert(role->attributes().channel_id()).second) {
+				channels->emplace_back(role->attributes().channel_name());
+			}
+		}
 	}
-	std::move(local_channels.begin(), local_channels.end(), std::back_inserter(*channels));
 }
 
 void ChannelManager::GetProtoDesc(const std::string& channel_name, std::string* proto_desc) {
@@ -96,8 +97,9 @@ void ChannelManager::GetWriters(RoleAttrVec* writers) {
 
 void ChannelManager::GetWritersOfNode(const std::string& node_name, RoleAttrVec* writers) {
 	RETURN_IF_NULL(writers);
-	uint64_t key = common::GlobalData::RegisterNode(node_name);
-	node_writers_.Search(key, writers);
+	RoleAttributes attr;
+	attr.set_node_id(common::GlobalData::RegisterNode(node_name));
+	channel_writers_.Search(attr, writers);
 }
 
 void ChannelManager::GetWritersOfChannel(const std::string& channel_name, RoleAttrVec* writers) {
@@ -118,8 +120,9 @@ void ChannelManager::GetReaders(RoleAttrVec* readers) {
 
 void ChannelManager::GetReadersOfNode(const std::string& node_name, RoleAttrVec* readers) {
 	RETURN_IF_NULL(readers);
-	uint64_t key = common::GlobalData::RegisterNode(node_name);
-	node_readers_.Search(key, readers);
+	RoleAttributes attr;
+	attr.set_node_id(common::GlobalData::RegisterNode(node_name));
+	channel_readers_.Search(attr, readers);
 }
 
 void ChannelManager::GetReadersOfChannel(const std::string& channel_name, RoleAttrVec* readers) {
@@ -267,12 +270,10 @@ void ChannelManager::DisposeJoin(const ChangeMsg& msg) {
 			message::ProtobufFactory::Instance()->RegisterMessage(msg.role_attr().proto_desc());
 		}
 		auto role = std::make_shared<RoleWriter>(msg.role_attr(), msg.timestamp());
-		node_writers_.Add(role->attributes().node_id(), role);
 		channel_writers_.Add(role->attributes().channel_id(), role);
 		e.set_src(v);
 	} else {
 		auto role = std::make_shared<RoleReader>(msg.role_attr(), msg.timestamp());
-		node_readers_.Add(role->attributes().node_id(), role);
 		channel_readers_.Add(role->attributes().channel_id(), role);
 		e.set_dst(v);
 	}
@@ -285,12 +286,10 @@ void ChannelManager::DisposeLeave(const ChangeMsg& msg) {
 	e.set_value(msg.role_attr().channel_name());
 	if (msg.role_type() == RoleType::ROLE_WRITER) {
 		auto role = std::make_shared<RoleWriter>(msg.role_attr());
-		node_writers_.Remove(role->attributes().node_id(), role);
 		channel_writers_.Remove(role->attributes().channel_id(), role);
 		e.set_src(v);
 	} else {
 		auto role = std::make_shared<RoleReader>(msg.role_attr());
-		node_readers_.Remove(role->attributes().node_id(), role);
 		channel_readers_.Remove(role->attributes().channel_id(), role);
 		e.set_dst(v);
 	}
@@ -199,11 +199,7 @@ private:
 	ExemptedMessageTypes exempted_msg_types_;
 
 	Graph node_graph_;
-	// key: node_id
-	WriterWarehouse node_writers_;
-	ReaderWarehouse node_readers_;
-
-	// key: channel_id
+	// key: channel_id, searched by node_id through their index
 	WriterWarehouse channel_writers_;
 	ReaderWarehouse channel_readers_;
 };
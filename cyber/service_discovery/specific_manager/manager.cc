@@ -16,6 +16,9 @@
 
 #include "cyber/service_discovery/specific_manager/manager.h"
 
+#include <algorithm>
+
+#include "cyber/common/environment.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/message/message_traits.h"
@@ -32,6 +35,22 @@ namespace service_discovery {
 using transport::AttributesFiller;
 using transport::QosProfileConf;
 
+namespace {
+constexpr uint64_t kLivenessPeriodNs = 1000000000ULL;
+constexpr size_t kMaxPendingChanges = 4096;
+
+std::string RoleKey(const ChangeMsg& msg) {
+	auto& attr = msg.role_attr();
+	return std::to_string(msg.role_type()) + ":" + std::to_string(attr.node_id()) + ":" +
+		std::to_string(attr.channel_id()) + ":" + std::to_string(attr.id()) + ":" +
+		std::to_string(attr.service_id());
+}
+
+std::string OriginKey(const std::string& host_name, int process_id) {
+	return host_name + "+" + std::to_string(process_id);
+}
+}  // namespace
+
 Manager::Manager()
 	: is_shutdown_(false),
 	is_discovery_started_(false),
@@ -40,7 +59,16 @@ Manager::Manager()
 	channel_name_(""),
 	publisher_(nullptr),
 	subscriber_(nullptr),
-	listener_(nullptr) {
+	listener_(nullptr),
+	snapshot_publisher_(nullptr),
+	snapshot_subscriber_(nullptr),
+	snapshot_listener_(nullptr),
+	snapshot_dirty_(false),
+	registry_dirty_(false),
+	snapshot_interval_ns_(100000000ULL),
+	registry_interval_ns_(5000000ULL),
+	sync_running_(false),
+	sync_ticket_(0) {
 	host_name_ = common::GlobalData::Instance()->HostName();
 	process_id_ = common::GlobalData::Instance()->ProcessId();
 }
@@ -60,6 +88,7 @@ bool Manager::StartDiscovery(RtpsParticipant* participant) {
 		StopDiscovery();
 		return false;
 	}
+	StartSync();
 	return true;
 }
 
@@ -68,23 +97,37 @@ void Manager::StopDiscovery() {
 		return;
 	}
 
+	StopSync();
+
 	{
 	std::lock_guard<std::mutex> lg(lock_);
 	if (publisher_ != nullptr) {
 		eprosima::fastrtps::Domain::removePublisher(publisher_);
 		publisher_ = nullptr;
 	}
+	if (snapshot_publisher_ != nullptr) {
+		eprosima::fastrtps::Domain::removePublisher(snapshot_publisher_);
+		snapshot_publisher_ = nullptr;
+	}
 	}
 
 	if (subscriber_ != nullptr) {
 		eprosima::fastrtps::Domain::removeSubscriber(subscriber_);
 		subscriber_ = nullptr;
 	}
+	if (snapshot_subscriber_ != nullptr) {
+		eprosima::fastrtps::Domain::removeSubscriber(snapshot_subscriber_);
+		snapshot_subscriber_ = nullptr;
+	}
 
 	if (listener_ != nullptr) {
 		delete listener_;
 		listener_ = nullptr;
 	}
+	if (snapshot_listener_ != nullptr) {
+		delete snapshot_listener_;
+		snapshot_listener_ = nullptr;
+	}
 }
 
 void Manager::Shutdown() {
@@ -107,6 +150,7 @@ bool Manager::Join(const RoleAttributes& attr, RoleType role, bool need_publish)
 	Convert(attr, role, OperateType::OPT_JOIN, &msg);
 	Dispose(msg);
 	if (need_publish) {
+		Record(&msg);
 		return Publish(msg);
 	}
 	return true;
@@ -123,6 +167,7 @@ bool Manager::Leave(const RoleAttributes& attr, RoleType role) {
 	Convert(attr, role, OperateType::OPT_LEAVE, &msg);
 	Dispose(msg);
 	if (NeedPublish(msg)) {
+		Record(&msg);
 		return Publish(msg);
 	}
 	return true;
@@ -137,11 +182,30 @@ void Manager::RemoveChangeListener(const ChangeConnection& conn) {
 	local_conn.Disconnect();
 }
 
+void Manager::OnProcessLeave(const std::string& host_name, int process_id) {
+	{
+		std::lock_guard<std::mutex> lg(origins_mutex_);
+		auto it = origins_.find(OriginKey(host_name, process_id));
+		if (it != origins_.end()) {
+			if (it->second.local) {
+				return;
+			}
+			origins_.erase(it);
+		}
+	}
+	OnTopoModuleLeave(host_name, process_id);
+}
+
 bool Manager::CreatePublisher(RtpsParticipant* participant) {
 	RtpsPublisherAttr pub_attr;
 	RETURN_VAL_IF(!AttributesFiller::FillInPubAttr(channel_name_, QosProfileConf::QOS_PROFILE_TOPO_CHANGE, &pub_attr), false);
 	publisher_ = eprosima::fastrtps::Domain::createPublisher(participant, pub_attr);
-	return publisher_ != nullptr;
+	RETURN_VAL_IF(publisher_ == nullptr, false);
+
+	RtpsPublisherAttr snapshot_attr;
+	RETURN_VAL_IF(!AttributesFiller::FillInPubAttr(channel_name_ + "_snapshot", QosProfileConf::QOS_PROFILE_TOPO_SNAPSHOT, &snapshot_attr), false);
+	snapshot_publisher_ = eprosima::fastrtps::Domain::createPublisher(participant, snapshot_attr);
+	return snapshot_publisher_ != nullptr;
 }
 
 bool Manager::CreateSubscriber(RtpsParticipant* participant) {
@@ -150,7 +214,14 @@ bool Manager::CreateSubscriber(RtpsParticipant* participant) {
 	listener_ = new SubscriberListener(std::bind(&Manager::OnRemoteChange, this, std::placeholders::_1));
 
 	subscriber_ = eprosima::fastrtps::Domain::createSubscriber(participant, sub_attr, listener_);
-	return subscriber_ != nullptr;
+	RETURN_VAL_IF(subscriber_ == nullptr, false);
+
+	RtpsSubscriberAttr snapshot_attr;
+	RETURN_VAL_IF(!AttributesFiller::FillInSubAttr(channel_name_ + "_snapshot", QosProfileConf::QOS_PROFILE_TOPO_SNAPSHOT, &snapshot_attr), false);
+	snapshot_listener_ = new SubscriberListener(std::bind(&Manager::OnRemoteSnapshot, this, std::placeholders::_1));
+
+	snapshot_subscriber_ = eprosima::fastrtps::Domain::createSubscriber(participant, snapshot_attr, snapshot_listener_);
+	return snapshot_subscriber_ != nullptr;
 }
 
 bool Manager::NeedPublish(const ChangeMsg& msg) const {
@@ -191,8 +262,47 @@ void Manager::OnRemoteChange(const std::string& msg_str) {
 	if (IsFromSameProcess(msg)) {
 		return;
 	}
-	RETURN_IF(!Check(msg.role_attr()));
-	Dispose(msg);
+	if (!msg.has_seq()) {
+		RETURN_IF(!Check(msg.role_attr()));
+		Dispose(msg);
+		return;
+	}
+
+	std::vector<ChangeMsg> changes;
+	{
+		std::lock_guard<std::mutex> lg(origins_mutex_);
+		auto& origin = origins_[OriginKey(msg.role_attr().host_name(), msg.role_attr().process_id())];
+		// processes on this host are followed through the registry
+		if (origin.local) {
+			return;
+		}
+		ApplyChange(msg, &origin, &changes);
+	}
+	DisposeAll(changes);
+}
+
+void Manager::OnRemoteSnapshot(const std::string& snapshot_str) {
+	if (is_shutdown_.load()) {
+		ADEBUG << "the manager has been shut down.";
+		return;
+	}
+
+	TopologySnapshot snapshot;
+	RETURN_IF(!snapshot.ParseFromString(snapshot_str));
+	if (snapshot.process_id() == process_id_ && snapshot.host_name() == host_name_) {
+		return;
+	}
+
+	std::vector<ChangeMsg> changes;
+	{
+		std::lock_guard<std::mutex> lg(origins_mutex_);
+		auto& origin = origins_[OriginKey(snapshot.host_name(), snapshot.process_id())];
+		if (origin.local) {
+			return;
+		}
+		ApplySnapshot(snapshot, &origin, &changes);
+	}
+	DisposeAll(changes);
 }
 
 bool Manager::Publish(const ChangeMsg& msg) {
@@ -222,6 +332,285 @@ bool Manager::IsFromSameProcess(const ChangeMsg& msg) {
 	return true;
 }
 
+void Manager::Record(ChangeMsg* msg) {
+	// roles joined on behalf of another process are not ours to number
+	if (!IsFromSameProcess(*msg)) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lg(origins_mutex_);
+		msg->set_seq(++self_.seq);
+		if (msg->operate_type() == OperateType::OPT_JOIN) {
+			self_.roles[RoleKey(*msg)] = *msg;
+		} else {
+			self_.roles.erase(RoleKey(*msg));
+		}
+	}
+
+	bool wake = !snapshot_dirty_.exchange(true);
+	if (!registry_dirty_.exchange(true)) {
+		wake = true;
+	}
+	if (wake) {
+		WakeSync();
+	}
+}
+
+void Manager::ApplyChange(const ChangeMsg& msg, Origin* origin, std::vector<ChangeMsg>* changes) {
+	if (msg.seq() <= origin->seq) {
+		return;
+	}
+	// behind a gap the change waits until a snapshot covers the missing ones
+	if (msg.seq() > origin->seq + 1 && origin->pending.size() >= kMaxPendingChanges) {
+		return;
+	}
+	origin->pending.emplace(msg.seq(), msg);
+	ApplyPending(origin, changes);
+}
+
+void Manager::ApplySnapshot(const TopologySnapshot& snapshot, Origin* origin, std::vector<ChangeMsg>* changes) {
+	if (snapshot.seq() <= origin->seq) {
+		return;
+	}
+
+	std::map<std::string, ChangeMsg> roles;
+	for (auto& change : snapshot.changes()) {
+		roles.emplace(RoleKey(change), change);
+	}
+
+	// leaves first, a role may have left and joined again since
+	uint64_t now = cyber::Time::Now().ToNanosecond();
+	for (auto& role : origin->roles) {
+		if (roles.find(role.first) == roles.end()) {
+			ChangeMsg msg(role.second);
+			msg.set_timestamp(now);
+			msg.set_operate_type(OperateType::OPT_LEAVE);
+			msg.set_seq(snapshot.seq());
+			changes->push_back(msg);
+		}
+	}
+	for (auto& role : roles) {
+		if (origin->roles.find(role.first) == origin->roles.end()) {
+			changes->push_back(role.second);
+		}
+	}
+
+	origin->roles.swap(roles);
+	origin->seq = snapshot.seq();
+	ApplyPending(origin, changes);
+}
+
+void Manager::ApplyPending(Origin* origin, std::vector<ChangeMsg>* changes) {
+	while (!origin->pending.empty()) {
+		auto it = origin->pending.begin();
+		if (it->first > origin->seq + 1) {
+			break;
+		}
+		if (it->first == origin->seq + 1) {
+			auto& msg = it->second;
+			if (msg.operate_type() == OperateType::OPT_JOIN) {
+				origin->roles[RoleKey(msg)] = msg;
+			} else {
+				origin->roles.erase(RoleKey(msg));
+			}
+			origin->seq = msg.seq();
+			changes->push_back(msg);
+		}
+		origin->pending.erase(it);
+	}
+}
+
+void Manager::DisposeAll(const std::vector<ChangeMsg>& changes) {
+	for (auto& msg : changes) {
+		if (Check(msg.role_attr())) {
+			Dispose(msg);
+		}
+	}
+}
+
+void Manager::TakeSnapshot(TopologySnapshot* snapshot) {
+	snapshot->set_host_name(host_name_);
+	snapshot->set_process_id(process_id_);
+	std::lock_guard<std::mutex> lg(origins_mutex_);
+	snapshot->set_seq(self_.seq);
+	for (auto& role : self_.roles) {
+		snapshot->add_changes()->CopyFrom(role.second);
+	}
+}
+
+bool Manager::PublishSnapshot() {
+	TopologySnapshot snapshot;
+	TakeSnapshot(&snapshot);
+
+	apollo::cyber::transport::UnderlayMessage m;
+	RETURN_VAL_IF(!snapshot.SerializeToString(&m.data()), false);
+	std::lock_guard<std::mutex> lg(lock_);
+	if (snapshot_publisher_ != nullptr) {
+		return snapshot_publisher_->write(reinterpret_cast<void*>(&m));
+	}
+	return true;
+}
+
+void Manager::WriteRegistry() {
+	TopologySnapshot snapshot;
+	TakeSnapshot(&snapshot);
+
+	std::string data;
+	RETURN_IF(!snapshot.SerializeToString(&data));
+	if (!registry_->Write(data)) {
+		AERROR << "write " << channel_name_ << " snapshot to shm registry failed.";
+	}
+}
+
+void Manager::PollRegistry(bool check_liveness) {
+	std::vector<ShmRegistry::Entry> entries;
+	std::vector<int> gone;
+	registry_->Poll(check_liveness, &entries, &gone);
+
+	for (auto& entry : entries) {
+		TopologySnapshot snapshot;
+		if (!snapshot.ParseFromString(entry.data)) {
+			continue;
+		}
+		std::vector<ChangeMsg> changes;
+		{
+			std::lock_guard<std::mutex> lg(origins_mutex_);
+			auto& origin = origins_[OriginKey(host_name_, entry.process_id)];
+			origin.local = true;
+			// a pid taken over by a new process numbers its changes from 1 again
+			if (snapshot.seq() < origin.seq) {
+				origin.seq = 0;
+				origin.pending.clear();
+			}
+			ApplySnapshot(snapshot, &origin, &changes);
+		}
+		DisposeAll(changes);
+	}
+
+	for (int process_id : gone) {
+		{
+			std::lock_guard<std::mutex> lg(origins_mutex_);
+			origins_.erase(OriginKey(host_name_, process_id));
+		}
+		OnTopoModuleLeave(host_name_, process_id);
+	}
+}
+
+void Manager::StartSync() {
+	bool use_registry = true;
+	auto& global_conf = common::GlobalData::Instance()->Config();
+	if (global_conf.has_discovery_conf()) {
+		auto& discovery_conf = global_conf.discovery_conf();
+		use_registry = discovery_conf.shm_registry();
+		snapshot_interval_ns_ = discovery_conf.snapshot_interval_ms() * 1000000ULL;
+		registry_interval_ns_ = discovery_conf.registry_interval_ms() * 1000000ULL;
+	}
+
+	if (use_registry) {
+		std::string domain_id = common::GetEnv("CYBER_DOMAIN_ID", "80");
+		std::unique_ptr<ShmRegistry> registry(new ShmRegistry("cyber_sd." + domain_id + "." + channel_name_, host_name_, process_id_));
+		if (registry->Init()) {
+			std::lock_guard<std::mutex> lg(sync_mutex_);
+			registry_ = std::move(registry);
+		} else {
+			AWARN << "shm registry unavailable, " << channel_name_ << " discovers local processes through rtps.";
+		}
+	}
+
+	// whatever joined before discovery started
+	snapshot_dirty_.store(true);
+	registry_dirty_.store(true);
+	sync_running_.store(true);
+	sync_thread_ = std::thread(&Manager::Sync, this);
+}
+
+void Manager::StopSync() {
+	if (!sync_running_.exchange(false)) {
+		return;
+	}
+	WakeSync();
+	if (sync_thread_.joinable()) {
+		sync_thread_.join();
+	}
+	std::lock_guard<std::mutex> lg(sync_mutex_);
+	if (registry_ != nullptr) {
+		registry_->Shutdown();
+		registry_.reset();
+	}
+}
+
+void Manager::Sync() {
+	uint64_t last_snapshot_ns = 0;
+	uint64_t last_registry_ns = 0;
+	uint64_t next_liveness_ns = 0;
+	while (sync_running_.load()) {
+		uint32_t ticket = SyncTicket();
+		uint64_t now = cyber::Time::MonoTime().ToNanosecond();
+		uint64_t wakeup_ns = now + kLivenessPeriodNs;
+
+		if (registry_ != nullptr) {
+			bool check_liveness = now >= next_liveness_ns;
+			if (check_liveness) {
+				next_liveness_ns = now + kLivenessPeriodNs;
+			}
+			PollRegistry(check_liveness);
+
+			if (registry_dirty_.load()) {
+				if (now >= last_registry_ns + registry_interval_ns_) {
+					registry_dirty_.store(false);
+					last_registry_ns = now;
+					WriteRegistry();
+				} else {
+					wakeup_ns = std::min(wakeup_ns, last_registry_ns + registry_interval_ns_);
+				}
+			}
+		}
+
+		if (snapshot_dirty_.load()) {
+			if (now >= last_snapshot_ns + snapshot_interval_ns_) {
+				snapshot_dirty_.store(false);
+				last_snapshot_ns = now;
+				PublishSnapshot();
+			} else {
+				wakeup_ns = std::min(wakeup_ns, last_snapshot_ns + snapshot_interval_ns_);
+			}
+		}
+
+		now = cyber::Time::MonoTime().ToNanosecond();
+		if (wakeup_ns > now) {
+			WaitSync(ticket, static_cast<int>((wakeup_ns - now + 999999) / 1000000));
+		}
+	}
+}
+
+uint32_t Manager::SyncTicket() {
+	if (registry_ != nullptr) {
+		return registry_->Ticket();
+	}
+	std::lock_guard<std::mutex> lg(sync_mutex_);
+	return sync_ticket_;
+}
+
+void Manager::WaitSync(uint32_t ticket, int timeout_ms) {
+	if (registry_ != nullptr) {
+		registry_->Wait(ticket, timeout_ms);
+		return;
+	}
+	std::unique_lock<std::mutex> lk(sync_mutex_);
+	sync_cv_.wait_for(lk, std::chrono::milliseconds(timeout_ms), [this, ticket] { return sync_ticket_ != ticket; });
+}
+
+void Manager::WakeSync() {
+	std::lock_guard<std::mutex> lg(sync_mutex_);
+	if (registry_ != nullptr) {
+		registry_->Wake();
+		return;
+	}
+	++sync_ticket_;
+	sync_cv_.notify_one();
+}
+
 }  // namespace service_discovery
 }  // namespace cyber
 }  // namespace apollo
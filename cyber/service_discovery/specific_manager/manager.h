@@ -18,9 +18,16 @@
 #define CYBER_SERVICE_DISCOVERY_SPECIFIC_MANAGER_MANAGER_H_
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "fastrtps/Domain.h"
 #include "fastrtps/attributes/PublisherAttributes.h"
@@ -31,6 +38,7 @@
 
 #include "cyber/base/signal.h"
 #include "cyber/proto/topology_change.pb.h"
+#include "cyber/service_discovery/communication/shm_registry.h"
 #include "cyber/service_discovery/communication/subscriber_listener.h"
 
 namespace apollo {
@@ -42,11 +50,20 @@ using proto::ChangeType;
 using proto::OperateType;
 using proto::RoleAttributes;
 using proto::RoleType;
+using proto::TopologySnapshot;
 
 /**
  * @class Manager
  * @brief Base class for management of Topology elements.
  * Manager can Join/Leave the Topology, and Listen the topology change
+ *
+ * Every change a process publishes carries a sequence number. Besides the
+ * changes, each process broadcasts a snapshot of the roles it joined whenever
+ * they changed, at most once per snapshot_interval_ms, and the last one is
+ * kept for late joiners. A receiver applies changes in order, holds back
+ * those behind a gap and resyncs from the next snapshot. Processes on the
+ * same host exchange their snapshots through a ShmRegistry instead, so rtps
+ * is only used between hosts.
  */
 class Manager {
 public:
@@ -133,7 +150,25 @@ public:
 	*/
 	virtual void OnTopoModuleLeave(const std::string& host_name, int process_id) = 0;
 
+	/**
+	* @brief Called when a process' rtps participant leaves. Ignored for the
+	* processes followed through the shm registry, which tells when they leave.
+	*
+	* @param host_name is the process's host's name
+	* @param process_id is the process' id
+	*/
+	void OnProcessLeave(const std::string& host_name, int process_id);
+
 protected:
+	// what we know about the roles joined by one process
+	struct Origin {
+		uint64_t seq = 0;
+		bool local = false;
+		std::map<std::string, ChangeMsg> roles;
+		// changes received ahead of a gap, by seq
+		std::map<uint64_t, ChangeMsg> pending;
+	};
+
 	bool CreatePublisher(RtpsParticipant* participant);
 	bool CreateSubscriber(RtpsParticipant* participant);
 
@@ -146,8 +181,26 @@ protected:
 	void Notify(const ChangeMsg& msg);
 	bool Publish(const ChangeMsg& msg);
 	void OnRemoteChange(const std::string& msg_str);
+	void OnRemoteSnapshot(const std::string& snapshot_str);
 	bool IsFromSameProcess(const ChangeMsg& msg);
 
+	void Record(ChangeMsg* msg);
+	void ApplyChange(const ChangeMsg& msg, Origin* origin, std::vector<ChangeMsg>* changes);
+	void ApplySnapshot(const TopologySnapshot& snapshot, Origin* origin, std::vector<ChangeMsg>* changes);
+	void ApplyPending(Origin* origin, std::vector<ChangeMsg>* changes);
+	void DisposeAll(const std::vector<ChangeMsg>& changes);
+	void TakeSnapshot(TopologySnapshot* snapshot);
+	bool PublishSnapshot();
+	void WriteRegistry();
+	void PollRegistry(bool check_liveness);
+
+	void StartSync();
+	void StopSync();
+	void Sync();
+	uint32_t SyncTicket();
+	void WaitSync(uint32_t ticket, int timeout_ms);
+	void WakeSync();
+
 	std::atomic<bool> is_shutdown_;
 	std::atomic<bool> is_discovery_started_;
 	int allowed_role_;
@@ -159,6 +212,25 @@ protected:
 	std::mutex lock_;
 	eprosima::fastrtps::Subscriber* subscriber_;
 	SubscriberListener* listener_;
+	eprosima::fastrtps::Publisher* snapshot_publisher_;
+	eprosima::fastrtps::Subscriber* snapshot_subscriber_;
+	SubscriberListener* snapshot_listener_;
+
+	// roles we joined, and those of the other processes by host_name+pid
+	std::mutex origins_mutex_;
+	Origin self_;
+	std::unordered_map<std::string, Origin> origins_;
+
+	std::unique_ptr<ShmRegistry> registry_;
+	std::atomic<bool> snapshot_dirty_;
+	std::atomic<bool> registry_dirty_;
+	uint64_t snapshot_interval_ns_;
+	uint64_t registry_interval_ns_;
+	std::atomic<bool> sync_running_;
+	std::thread sync_thread_;
+	std::mutex sync_mutex_;
+	std::condition_variable sync_cv_;
+	uint32_t sync_ticket_;
 
 	ChangeSignal signal_;
 };
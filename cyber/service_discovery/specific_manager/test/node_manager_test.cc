@@ -17,6 +17,7 @@
 #include "cyber/service_discovery/specific_manager/node_manager.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 #include "gtest/gtest.h"
 
@@ -127,6 +128,80 @@ TEST_F(NodeManagerTest, get_nodes) {
   EXPECT_EQ(attr_nodes.size(), 1);
 }
 
+class NodeManagerProbe : public NodeManager {
+ public:
+  using NodeManager::OnRemoteChange;
+  using NodeManager::OnRemoteSnapshot;
+};
+
+ChangeMsg NodeChange(const std::string& node_name, OperateType opt,
+                     uint64_t seq) {
+  ChangeMsg msg;
+  msg.set_timestamp(seq);
+  msg.set_change_type(ChangeType::CHANGE_NODE);
+  msg.set_operate_type(opt);
+  msg.set_role_type(RoleType::ROLE_NODE);
+  msg.set_seq(seq);
+  auto attr = msg.mutable_role_attr();
+  attr->set_host_name("caros");
+  attr->set_process_id(1024);
+  attr->set_node_name(node_name);
+  attr->set_node_id(common::GlobalData::RegisterNode(node_name));
+  return msg;
+}
+
+TEST(NodeManagerSyncTest, changes_and_snapshots) {
+  NodeManagerProbe manager;
+  auto change = [&manager](const std::string& node_name, OperateType opt,
+                           uint64_t seq) {
+    std::string str;
+    NodeChange(node_name, opt, seq).SerializeToString(&str);
+    manager.OnRemoteChange(str);
+  };
+  auto snapshot = [&manager](const std::vector<std::string>& node_names,
+                             uint64_t seq) {
+    TopologySnapshot snapshot;
+    snapshot.set_host_name("caros");
+    snapshot.set_process_id(1024);
+    snapshot.set_seq(seq);
+    for (auto& node_name : node_names) {
+      *snapshot.add_changes() = NodeChange(node_name, OperateType::OPT_JOIN, 1);
+    }
+    std::string str;
+    snapshot.SerializeToString(&str);
+    manager.OnRemoteSnapshot(str);
+  };
+
+  change("node_a", OperateType::OPT_JOIN, 1);
+  EXPECT_TRUE(manager.HasNode("node_a"));
+
+  // held back until the gap is filled
+  change("node_c", OperateType::OPT_JOIN, 3);
+  EXPECT_FALSE(manager.HasNode("node_c"));
+  change("node_a", OperateType::OPT_LEAVE, 2);
+  EXPECT_FALSE(manager.HasNode("node_a"));
+  EXPECT_TRUE(manager.HasNode("node_c"));
+
+  // change 4 is lost, the snapshot covers it
+  change("node_e", OperateType::OPT_JOIN, 5);
+  EXPECT_FALSE(manager.HasNode("node_e"));
+  snapshot({"node_c", "node_d"}, 4);
+  EXPECT_TRUE(manager.HasNode("node_c"));
+  EXPECT_TRUE(manager.HasNode("node_d"));
+  EXPECT_TRUE(manager.HasNode("node_e"));
+
+  snapshot({"node_d"}, 6);
+  EXPECT_FALSE(manager.HasNode("node_c"));
+  EXPECT_TRUE(manager.HasNode("node_d"));
+  EXPECT_FALSE(manager.HasNode("node_e"));
+
+  // stale
+  change("node_a", OperateType::OPT_JOIN, 6);
+  snapshot({"node_a"}, 5);
+  EXPECT_FALSE(manager.HasNode("node_a"));
+  EXPECT_TRUE(manager.HasNode("node_d"));
+}
+
 }  // namespace service_discovery
 }  // namespace cyber
 }  // namespace apollo
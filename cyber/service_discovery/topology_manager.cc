@@ -123,9 +123,9 @@ void TopologyManager::OnParticipantChange(const PartInfo& info) {
 	if (msg.operate_type() == OperateType::OPT_LEAVE) {
 		auto& host_name = msg.role_attr().host_name();
 		int process_id = msg.role_attr().process_id();
-		node_manager_->OnTopoModuleLeave(host_name, process_id);
-		channel_manager_->OnTopoModuleLeave(host_name, process_id);
-		service_manager_->OnTopoModuleLeave(host_name, process_id);
+		node_manager_->OnProcessLeave(host_name, process_id);
+		channel_manager_->OnProcessLeave(host_name, process_id);
+		service_manager_->OnProcessLeave(host_name, process_id);
 	}
 	change_signal_(msg);
 }
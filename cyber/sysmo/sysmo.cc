@@ -1,5 +1,5 @@
 /******************************************************************************
- * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,21 +16,120 @@
 
 #include "cyber/sysmo/sysmo.h"
 
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
 #include "cyber/common/environment.h"
+#include "cyber/common/file.h"
+#include "cyber/common/global_data.h"
+#include "cyber/cyber.h"
+#include "cyber/scheduler/processor.h"
 
 namespace apollo {
 namespace cyber {
 
+using apollo::cyber::common::GetContent;
 using apollo::cyber::common::GetEnv;
+using apollo::cyber::common::GlobalData;
+using apollo::cyber::message::RawMessage;
+
+namespace {
+
+constexpr uint64_t kNsPerMs = 1000000;
+
+uint64_t Permille(uint64_t part, uint64_t whole) {
+  if (whole == 0) {
+    return 0;
+  }
+  return std::min<uint64_t>(part * 1000 / whole, 1000);
+}
+
+// utime and stime of /proc/self/task/<tid>/stat, in ns
+bool ReadThreadStat(const std::string& dir, uint64_t* cpu_ns,
+                    std::string* name) {
+  std::string content;
+  if (!GetContent(dir + "/stat", &content)) {
+    return false;
+  }
+  // the name may hold spaces and parentheses, it ends at the last ')'
+  auto begin = content.find('(');
+  auto end = content.rfind(')');
+  if (begin == std::string::npos || end == std::string::npos || end < begin) {
+    return false;
+  }
+  *name = content.substr(begin + 1, end - begin - 1);
+
+  // fields after the name start from the third one, state
+  std::istringstream fields(content.substr(end + 1));
+  std::string field;
+  uint64_t utime = 0;
+  uint64_t stime = 0;
+  for (int i = 3; i <= 15 && fields >> field; ++i) {
+    if (i == 14) {
+      utime = std::strtoull(field.c_str(), nullptr, 10);
+    } else if (i == 15) {
+      stime = std::strtoull(field.c_str(), nullptr, 10);
+    }
+  }
+  static const uint64_t ticks = static_cast<uint64_t>(sysconf(_SC_CLK_TCK));
+  *cpu_ns = (utime + stime) * (1000000000 / ticks);
+  return true;
+}
+
+void ReadThreadSwitches(const std::string& dir, ThreadSample* sample) {
+  std::string content;
+  if (!GetContent(dir + "/status", &content)) {
+    return;
+  }
+  std::istringstream lines(content);
+  std::string line;
+  while (std::getline(lines, line)) {
+    auto colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    auto key = line.substr(0, colon);
+    if (key == "voluntary_ctxt_switches") {
+      sample->voluntary_switches =
+          std::strtoull(line.c_str() + colon + 1, nullptr, 10);
+    } else if (key == "nonvoluntary_ctxt_switches") {
+      sample->involuntary_switches =
+          std::strtoull(line.c_str() + colon + 1, nullptr, 10);
+    }
+  }
+}
+
+}  // namespace
 
 SysMo::SysMo() { Start(); }
 
 void SysMo::Start() {
+  auto& config = GlobalData::Instance()->Config();
+  if (config.has_sysmo_conf()) {
+    conf_.CopyFrom(config.sysmo_conf());
+  }
   auto sysmo_start = GetEnv("sysmo_start");
   if (sysmo_start != "" && std::stoi(sysmo_start)) {
-    start_ = true;
-    sysmo_ = std::thread(&SysMo::Checker, this);
+    conf_.set_enable(true);
+  }
+  if (!conf_.enable()) {
+    return;
+  }
+  if (conf_.check_interval_ms() == 0) {
+    conf_.set_check_interval_ms(1);
   }
+  if (conf_.publish_interval_ms() < conf_.check_interval_ms()) {
+    conf_.set_publish_interval_ms(conf_.check_interval_ms());
+  }
+
+  start_ = true;
+  scheduler::Processor::EnableBusyTime(true);
+  sysmo_ = std::thread(&SysMo::Checker, this);
 }
 
 void SysMo::Shutdown() {
@@ -42,15 +141,213 @@ void SysMo::Shutdown() {
   if (sysmo_.joinable()) {
     sysmo_.join();
   }
+  scheduler::Processor::EnableBusyTime(false);
+  writer_.reset();
+  node_.reset();
+}
+
+void SysMo::AddWatchdogCallback(const WatchdogCallback& callback) {
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  callbacks_.emplace_back(callback);
+}
+
+bool SysMo::GetSnapshot(SysMoSnapshot* snapshot) {
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  if (!has_snapshot_) {
+    return false;
+  }
+  *snapshot = snapshot_;
+  return true;
 }
 
 void SysMo::Checker() {
+  auto publish_interval_ns = conf_.publish_interval_ms() * kNsPerMs;
+  last_sample_time_ = Time::Now().ToNanosecond();
+  // the first call only records the counters the next one diffs against
+  SysMoSnapshot snapshot;
+  Sample(last_sample_time_, &snapshot);
+
   while (cyber_unlikely(!shut_down_.load())) {
-    scheduler::Instance()->CheckSchedStatus();
-    std::unique_lock<std::mutex> lk(lk_);
-    cv_.wait_for(lk, std::chrono::milliseconds(sysmo_interval_ms_));
+    {
+      std::unique_lock<std::mutex> lk(lk_);
+      cv_.wait_for(lk, std::chrono::milliseconds(conf_.check_interval_ms()));
+    }
+    if (shut_down_.load()) {
+      break;
+    }
+
+    auto now = Time::Now().ToNanosecond();
+    CheckProcessors(now);
+    if (now - last_sample_time_ < publish_interval_ns) {
+      continue;
+    }
+
+    Sample(now, &snapshot);
+    {
+      std::lock_guard<std::mutex> lock(snapshot_mutex_);
+      snapshot_ = snapshot;
+      has_snapshot_ = true;
+    }
+    Publish(snapshot);
   }
 }
 
+void SysMo::CheckProcessors(uint64_t now) {
+  auto threshold_ns = conf_.hung_threshold_ms() * kNsPerMs;
+  for (const auto& snap : scheduler::Instance()->ProcSnapshots()) {
+    pid_t tid = snap->processor_id.load();
+    uint64_t routine_id = 0;
+    uint64_t start = 0;
+    snap->Running(&routine_id, &start);
+    auto hung = hung_starts_.find(tid);
+
+    if (hung != hung_starts_.end() && hung->second != start) {
+      WatchdogEvent event;
+      event.type = WatchdogEventType::ROUTINE_RECOVERED;
+      event.processor_tid = tid;
+      event.running_ns = now - hung->second;
+      hung_starts_.erase(hung);
+      RaiseWatchdogEvent(event);
+    }
+
+    if (start != 0 && now > start && now - start > threshold_ns &&
+        hung_starts_.count(tid) == 0) {
+      WatchdogEvent event;
+      event.type = WatchdogEventType::HUNG_ROUTINE;
+      event.processor_tid = tid;
+      event.routine_id = routine_id;
+      event.routine_name = GlobalData::GetTaskNameById(event.routine_id);
+      event.running_ns = now - start;
+      hung_starts_[tid] = start;
+      RaiseWatchdogEvent(event);
+    }
+  }
+}
+
+void SysMo::RaiseWatchdogEvent(const WatchdogEvent& event) {
+  if (event.type == WatchdogEventType::HUNG_ROUTINE) {
+    AWARN << "croutine " << event.routine_name << " has run for "
+          << event.running_ns / kNsPerMs << " ms on processor "
+          << event.processor_tid;
+  } else {
+    AINFO << "processor " << event.processor_tid << " recovered after "
+          << event.running_ns / kNsPerMs << " ms";
+  }
+
+  std::vector<WatchdogCallback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callbacks = callbacks_;
+  }
+  for (const auto& callback : callbacks) {
+    callback(event);
+  }
+}
+
+void SysMo::Sample(uint64_t now, SysMoSnapshot* snapshot) {
+  uint64_t window_ns = now - last_sample_time_;
+  last_sample_time_ = now;
+
+  snapshot->stamp = now;
+  snapshot->window_ns = window_ns;
+  snapshot->pid = getpid();
+  snapshot->hung_routines = static_cast<uint32_t>(hung_starts_.size());
+  SampleProcessors(now, window_ns, snapshot);
+  SampleThreads(window_ns, snapshot);
+}
+
+void SysMo::SampleProcessors(uint64_t now, uint64_t window_ns,
+                             SysMoSnapshot* snapshot) {
+  snapshot->processors.clear();
+  for (const auto& snap : scheduler::Instance()->ProcSnapshots()) {
+    ProcessorSample sample;
+    sample.tid = snap->processor_id.load();
+    uint64_t routine_id = 0;
+    uint64_t start = 0;
+    uint64_t busy = snap->busy_ns.load();
+    if (snap->Running(&routine_id, &start) && now > start) {
+      sample.routine_id = routine_id;
+      sample.running_ns = now - start;
+      busy += sample.running_ns;
+    }
+    auto& last_busy = busy_ns_[sample.tid];
+    if (busy > last_busy) {
+      sample.utilization =
+          static_cast<uint32_t>(Permille(busy - last_busy, window_ns));
+    }
+    last_busy = busy;
+    snapshot->processors.emplace_back(sample);
+  }
+}
+
+void SysMo::SampleThreads(uint64_t window_ns, SysMoSnapshot* snapshot) {
+  snapshot->threads.clear();
+  DIR* dir = opendir("/proc/self/task");
+  if (dir == nullptr) {
+    return;
+  }
+
+  for (auto& times : thread_times_) {
+    times.second.alive = false;
+  }
+  struct dirent* entry = nullptr;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    std::string task_dir = std::string("/proc/self/task/") + entry->d_name;
+    ThreadSample sample;
+    sample.tid = std::atoi(entry->d_name);
+    uint64_t cpu_ns = 0;
+    std::string name;
+    if (!ReadThreadStat(task_dir, &cpu_ns, &name)) {
+      continue;
+    }
+    std::strncpy(sample.name, name.c_str(), sizeof(sample.name) - 1);
+    ReadThreadSwitches(task_dir, &sample);
+
+    auto& times = thread_times_[sample.tid];
+    if (cpu_ns > times.cpu_ns) {
+      sample.cpu_usage =
+          static_cast<uint32_t>(Permille(cpu_ns - times.cpu_ns, window_ns));
+    }
+    times.cpu_ns = cpu_ns;
+    times.alive = true;
+    snapshot->threads.emplace_back(sample);
+  }
+  closedir(dir);
+
+  for (auto iter = thread_times_.begin(); iter != thread_times_.end();) {
+    if (iter->second.alive) {
+      ++iter;
+    } else {
+      iter = thread_times_.erase(iter);
+    }
+  }
+}
+
+void SysMo::Publish(const SysMoSnapshot& snapshot) {
+  if (conf_.channel().empty() || !OK()) {
+    return;
+  }
+  if (writer_ == nullptr) {
+    node_ = CreateNode("sysmo" + std::to_string(getpid()));
+    if (node_ == nullptr) {
+      return;
+    }
+    writer_ = node_->CreateWriter<RawMessage>(conf_.channel());
+    if (writer_ == nullptr) {
+      AERROR << "create sysmo writer failed, channel: " << conf_.channel();
+      node_.reset();
+      conf_.set_channel("");
+      return;
+    }
+  }
+
+  auto message = std::make_shared<RawMessage>();
+  SerializeSysMoSnapshot(snapshot, &message->message);
+  writer_->Write(message);
+}
+
 }  // namespace cyber
 }  // namespace apollo
@@ -19,34 +19,85 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include "cyber/proto/sysmo_conf.pb.h"
+
+#include "cyber/message/raw_message.h"
 #include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/sysmo/sysmo_snapshot.h"
 
 namespace apollo {
 namespace cyber {
 
+class Node;
+template <typename MessageT>
+class Writer;
+
 using apollo::cyber::scheduler::Scheduler;
 
+// Samples the scheduler and the threads of the process. Croutines holding a
+// processor longer than the hung threshold raise watchdog events, and a
+// binary SysMoSnapshot is published on the configured channel.
 class SysMo {
  public:
+  using WatchdogCallback = std::function<void(const WatchdogEvent&)>;
+
   void Start();
   void Shutdown();
 
+  // callbacks run on the sampling thread
+  void AddWatchdogCallback(const WatchdogCallback& callback);
+  // the last sampled snapshot, false before the first publish period
+  bool GetSnapshot(SysMoSnapshot* snapshot);
+
  private:
+  struct ThreadTimes {
+    uint64_t cpu_ns = 0;
+    bool alive = false;
+  };
+
   void Checker();
+  void CheckProcessors(uint64_t now);
+  void RaiseWatchdogEvent(const WatchdogEvent& event);
+  void Sample(uint64_t now, SysMoSnapshot* snapshot);
+  void SampleProcessors(uint64_t now, uint64_t window_ns,
+                        SysMoSnapshot* snapshot);
+  void SampleThreads(uint64_t window_ns, SysMoSnapshot* snapshot);
+  void Publish(const SysMoSnapshot& snapshot);
 
   std::atomic<bool> shut_down_{false};
   bool start_ = false;
 
-  int sysmo_interval_ms_ = 100;
+  proto::SysMoConf conf_;
   std::condition_variable cv_;
   std::mutex lk_;
   std::thread sysmo_;
 
+  std::mutex callback_mutex_;
+  std::vector<WatchdogCallback> callbacks_;
+
+  std::mutex snapshot_mutex_;
+  bool has_snapshot_ = false;
+  SysMoSnapshot snapshot_;
+
+  // state below is only touched by the sampling thread
+  // execute start time of the croutine reported hung on each processor
+  std::unordered_map<pid_t, uint64_t> hung_starts_;
+  std::unordered_map<pid_t, uint64_t> busy_ns_;
+  std::unordered_map<pid_t, ThreadTimes> thread_times_;
+  uint64_t last_sample_time_ = 0;
+
+  std::unique_ptr<Node> node_;
+  std::shared_ptr<Writer<message::RawMessage>> writer_;
+
   DECLARE_SINGLETON(SysMo);
 };
 
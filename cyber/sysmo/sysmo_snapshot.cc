@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/sysmo/sysmo_snapshot.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace apollo {
+namespace cyber {
+
+namespace {
+
+constexpr char kMagic[4] = {'S', 'Y', 'M', 'O'};
+constexpr uint32_t kVersion = 1;
+
+struct SnapshotHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t stamp;
+  uint64_t window_ns;
+  int32_t pid;
+  uint32_t hung_routines;
+  uint32_t processor_num;
+  uint32_t thread_num;
+};
+
+static_assert(sizeof(SnapshotHeader) == 40, "unexpected header layout");
+static_assert(sizeof(ProcessorSample) == 24, "unexpected sample layout");
+static_assert(sizeof(ThreadSample) == 40, "unexpected sample layout");
+static_assert(std::is_trivially_copyable<ProcessorSample>::value &&
+                  std::is_trivially_copyable<ThreadSample>::value,
+              "samples are copied byte by byte");
+
+}  // namespace
+
+void SerializeSysMoSnapshot(const SysMoSnapshot& snapshot, std::string* data) {
+  SnapshotHeader header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.stamp = snapshot.stamp;
+  header.window_ns = snapshot.window_ns;
+  header.pid = snapshot.pid;
+  header.hung_routines = snapshot.hung_routines;
+  header.processor_num = static_cast<uint32_t>(snapshot.processors.size());
+  header.thread_num = static_cast<uint32_t>(snapshot.threads.size());
+
+  size_t processor_bytes = snapshot.processors.size() * sizeof(ProcessorSample);
+  size_t thread_bytes = snapshot.threads.size() * sizeof(ThreadSample);
+  data->resize(sizeof(header) + processor_bytes + thread_bytes);
+  char* ptr = &(*data)[0];
+  std::memcpy(ptr, &header, sizeof(header));
+  ptr += sizeof(header);
+  if (processor_bytes > 0) {
+    std::memcpy(ptr, snapshot.processors.data(), processor_bytes);
+    ptr += processor_bytes;
+  }
+  if (thread_bytes > 0) {
+    std::memcpy(ptr, snapshot.threads.data(), thread_bytes);
+  }
+}
+
+bool ParseSysMoSnapshot(const std::string& data, SysMoSnapshot* snapshot) {
+  SnapshotHeader header;
+  if (data.size() < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion) {
+    return false;
+  }
+  size_t processor_bytes = header.processor_num * sizeof(ProcessorSample);
+  size_t thread_bytes = header.thread_num * sizeof(ThreadSample);
+  if (data.size() != sizeof(header) + processor_bytes + thread_bytes) {
+    return false;
+  }
+
+  snapshot->stamp = header.stamp;
+  snapshot->window_ns = header.window_ns;
+  snapshot->pid = header.pid;
+  snapshot->hung_routines = header.hung_routines;
+  snapshot->processors.resize(header.processor_num);
+  snapshot->threads.resize(header.thread_num);
+  const char* ptr = data.data() + sizeof(header);
+  if (processor_bytes > 0) {
+    std::memcpy(&snapshot->processors[0], ptr, processor_bytes);
+    ptr += processor_bytes;
+  }
+  if (thread_bytes > 0) {
+    std::memcpy(&snapshot->threads[0], ptr, thread_bytes);
+  }
+  return true;
+}
+
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SYSMO_SYSMO_SNAPSHOT_H_
+#define CYBER_SYSMO_SYSMO_SNAPSHOT_H_
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+
+enum class WatchdogEventType : uint32_t {
+  // a croutine kept its processor longer than the hung threshold
+  HUNG_ROUTINE = 1,
+  // a croutine reported hung has yielded its processor again
+  ROUTINE_RECOVERED = 2,
+};
+
+struct WatchdogEvent {
+  WatchdogEventType type = WatchdogEventType::HUNG_ROUTINE;
+  pid_t processor_tid = 0;
+  uint64_t routine_id = 0;
+  std::string routine_name;
+  uint64_t running_ns = 0;
+};
+
+// The samples are copied as is into the published snapshot, keep them plain.
+struct ProcessorSample {
+  int32_t tid = 0;
+  // busy time over the publish window, in permille
+  uint32_t utilization = 0;
+  // croutine being resumed, 0 when idle
+  uint64_t routine_id = 0;
+  uint64_t running_ns = 0;
+};
+
+struct ThreadSample {
+  int32_t tid = 0;
+  // cpu time over the publish window, in permille of one core
+  uint32_t cpu_usage = 0;
+  uint64_t voluntary_switches = 0;
+  uint64_t involuntary_switches = 0;
+  char name[16] = {0};
+};
+
+struct SysMoSnapshot {
+  uint64_t stamp = 0;
+  uint64_t window_ns = 0;
+  int32_t pid = 0;
+  uint32_t hung_routines = 0;
+  std::vector<ProcessorSample> processors;
+  std::vector<ThreadSample> threads;
+};
+
+void SerializeSysMoSnapshot(const SysMoSnapshot& snapshot, std::string* data);
+bool ParseSysMoSnapshot(const std::string& data, SysMoSnapshot* snapshot);
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SYSMO_SYSMO_SNAPSHOT_H_
@@ -1,5 +1,5 @@
 /******************************************************************************
- * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,29 +16,153 @@
 
 #include "cyber/sysmo/sysmo.h"
 
-#include <cstdlib>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
-#include "cyber/common/environment.h"
+#include "cyber/common/test/test_work_root.h"
+#include "cyber/cyber.h"
 #include "cyber/scheduler/scheduler_factory.h"
 
 namespace apollo {
 namespace cyber {
 
-using apollo::cyber::common::GetEnv;
-
-TEST(SysMoTest, cases) {
-  auto sched = scheduler::Instance();
-  setenv("sysmo_start", "1", 1);
-  auto sysmo_start = GetEnv("sysmo_start");
-  EXPECT_EQ(sysmo_start, "1");
-  auto sysmo = SysMo::Instance();
-  std::this_thread::sleep_for(std::chrono::milliseconds(300));
-  sysmo->Shutdown();
-  sched->Shutdown();
+using apollo::cyber::message::RawMessage;
+
+TEST(SysMoTest, snapshot_codec) {
+  SysMoSnapshot snapshot;
+  snapshot.stamp = 123;
+  snapshot.window_ns = 456;
+  snapshot.pid = 789;
+  snapshot.hung_routines = 1;
+  ProcessorSample processor;
+  processor.tid = 10;
+  processor.utilization = 500;
+  processor.routine_id = 42;
+  processor.running_ns = 1000;
+  snapshot.processors.emplace_back(processor);
+  ThreadSample thread;
+  thread.tid = 11;
+  thread.cpu_usage = 250;
+  thread.voluntary_switches = 3;
+  thread.involuntary_switches = 4;
+  snprintf(thread.name, sizeof(thread.name), "worker");
+  snapshot.threads.emplace_back(thread);
+  snapshot.threads.emplace_back(thread);
+
+  std::string data;
+  SerializeSysMoSnapshot(snapshot, &data);
+  EXPECT_EQ(40 + 24 + 2 * 40, data.size());
+
+  SysMoSnapshot parsed;
+  ASSERT_TRUE(ParseSysMoSnapshot(data, &parsed));
+  EXPECT_EQ(123, parsed.stamp);
+  EXPECT_EQ(456, parsed.window_ns);
+  EXPECT_EQ(789, parsed.pid);
+  EXPECT_EQ(1, parsed.hung_routines);
+  ASSERT_EQ(1, parsed.processors.size());
+  EXPECT_EQ(500, parsed.processors[0].utilization);
+  EXPECT_EQ(42, parsed.processors[0].routine_id);
+  ASSERT_EQ(2, parsed.threads.size());
+  EXPECT_EQ(4, parsed.threads[1].involuntary_switches);
+  EXPECT_STREQ("worker", parsed.threads[1].name);
+
+  EXPECT_FALSE(ParseSysMoSnapshot(data.substr(0, data.size() - 1), &parsed));
+  data[0] = 'X';
+  EXPECT_FALSE(ParseSysMoSnapshot(data, &parsed));
+}
+
+TEST(SysMoTest, hung_routine) {
+  std::mutex mutex;
+  std::vector<WatchdogEvent> events;
+  SysMo::Instance()->AddWatchdogCallback([&](const WatchdogEvent& event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    events.emplace_back(event);
+  });
+
+  // blocks its processor thread instead of yielding
+  ASSERT_TRUE(scheduler::Instance()->CreateTask(
+      []() { std::this_thread::sleep_for(std::chrono::milliseconds(400)); },
+      "sysmo_test_hung"));
+
+  for (int i = 0; i < 100; ++i) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (events.size() >= 2) {
+        break;
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_EQ(2, events.size());
+  EXPECT_EQ(WatchdogEventType::HUNG_ROUTINE, events[0].type);
+  EXPECT_EQ("sysmo_test_hung", events[0].routine_name);
+  EXPECT_GT(events[0].running_ns, 100 * 1000000ULL);
+  EXPECT_EQ(WatchdogEventType::ROUTINE_RECOVERED, events[1].type);
+  EXPECT_EQ(events[0].processor_tid, events[1].processor_tid);
+}
+
+TEST(SysMoTest, publish) {
+  auto node = CreateNode("sysmo_test");
+  ASSERT_NE(nullptr, node);
+  std::mutex mutex;
+  std::string data;
+  auto reader = node->CreateReader<RawMessage>(
+      "/apollo/cyber/sysmo", [&](const std::shared_ptr<RawMessage>& msg) {
+        std::lock_guard<std::mutex> lock(mutex);
+        data = msg->message;
+      });
+  ASSERT_NE(nullptr, reader);
+
+  for (int i = 0; i < 100; ++i) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!data.empty()) {
+        break;
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  SysMoSnapshot snapshot;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_TRUE(ParseSysMoSnapshot(data, &snapshot));
+  }
+  EXPECT_EQ(getpid(), snapshot.pid);
+  EXPECT_GT(snapshot.window_ns, 0);
+  EXPECT_EQ(2, snapshot.processors.size());
+  ASSERT_FALSE(snapshot.threads.empty());
+  // the processors are threads of this process as well
+  for (const auto& processor : snapshot.processors) {
+    bool found = false;
+    for (const auto& thread : snapshot.threads) {
+      found = found || thread.tid == processor.tid;
+    }
+    EXPECT_TRUE(found);
+  }
+  EXPECT_TRUE(SysMo::Instance()->GetSnapshot(&snapshot));
 }
 
 }  // namespace cyber
 }  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::common::TestWorkRoot work_root("sysmo_test");
+  return work_root.RunAllTests(
+      argv[0],
+      "scheduler_conf { routine_num: 100 default_proc_num: 2 }\n"
+      "sysmo_conf { enable: true check_interval_ms: 20 "
+      "hung_threshold_ms: 100 publish_interval_ms: 100 }\n");
+}
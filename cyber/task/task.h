@@ -18,6 +18,7 @@
 #define CYBER_TASK_TASK_H_
 
 #include <future>
+#include <thread>
 #include <utility>
 
 #include "cyber/task/task_manager.h"
@@ -33,6 +34,33 @@ static auto Async(F&& f, Args&&... args)-> std::future<typename std::result_of<F
 		: std::async(std::launch::async, std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 }
 
+template <typename F, typename... Args>
+static auto AsyncWithPriority(TaskPriority priority, F&& f, Args&&... args)-> std::future<typename std::result_of<F(Args...)>::type> {
+	return GlobalData::Instance()->IsRealityMode() ? TaskManager::Instance()->EnqueueWithPriority(priority, std::forward<F>(f), std::forward<Args>(args)...)
+		: std::async(std::launch::async, std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+}
+
+/**
+ * @brief Run |f| on the task pool without a future, see TaskManager::Post().
+ */
+template <typename F>
+static bool Post(F&& f) {
+	if (GlobalData::Instance()->IsRealityMode()) {
+		return TaskManager::Instance()->Post(TaskPriority::NORMAL, std::forward<F>(f));
+	}
+	std::thread(std::forward<F>(f)).detach();
+	return true;
+}
+
+template <typename F>
+static bool PostWithPriority(TaskPriority priority, F&& f) {
+	if (GlobalData::Instance()->IsRealityMode()) {
+		return TaskManager::Instance()->Post(priority, std::forward<F>(f));
+	}
+	std::thread(std::forward<F>(f)).detach();
+	return true;
+}
+
 static inline void Yield() {
 	if (croutine::CRoutine::GetCurrentRoutine()) {
 		croutine::CRoutine::Yield();
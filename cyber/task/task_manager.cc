@@ -1,7 +1,7 @@
-/**************Scheduler::****************************************************************
+/******************************************************************************
  * Copyright 2018 The Apollo Authors. All Rights Reserved.
  *
- * Licensed under the Apache License, Vesched_infoon 2.0 (the "License");
+ * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
  *
@@ -16,10 +16,12 @@
 
 #include "cyber/task/task_manager.h"
 
+#include <algorithm>
+
 #include "cyber/common/global_data.h"
 #include "cyber/croutine/croutine.h"
-#include "cyber/croutine/routine_factory.h"
 #include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -27,36 +29,40 @@ namespace cyber {
 using apollo::cyber::common::GlobalData;
 static const char* const task_prefix = "/internal/task";
 
-TaskManager::TaskManager()
-	: task_queue_size_(1024),
-	task_queue_(new base::BoundedQueue<std::function<void()>>()) {
-	if (!task_queue_->Init(task_queue_size_, new base::BlockWaitStrategy())) {
-		AERROR << "Task queue init failed";
-			throw std::runtime_error("Task queue init failed");
+TaskManager::TaskManager() {
+	proto::TaskConf task_conf;
+	auto& global_conf = GlobalData::Instance()->Config();
+	if (global_conf.has_task_conf()) {
+		task_conf = global_conf.task_conf();
 	}
-	auto func = [this]() {
-		while (!stop_) {
-			std::function<void()> task;
-			if (!task_queue_->Dequeue(&task)) {
-				auto routine = croutine::CRoutine::GetCurrentRoutine();
-				routine->HangUp();
-				continue;
-			}
-			task();
-		}
-	};
-
-	num_threads_ = scheduler::Instance()->TaskPoolSize();
-	auto factory = croutine::CreateRoutineFactory(std::move(func));
-	tasks_.reserve(num_threads_);
-	for (uint32_t i = 0; i < num_threads_; i++) {
-		auto task_name = task_prefix + std::to_string(i);
-		tasks_.push_back(common::GlobalData::RegisterTaskName(task_name));
-		if (!scheduler::Instance()->CreateTask(factory, task_name)) 
-		{
-			AERROR << "CreateTask failed:" << task_name;
+	min_workers_ = task_conf.min_workers();
+	if (min_workers_ == 0) {
+		min_workers_ = std::max(scheduler::Instance()->TaskPoolSize(), 1U);
+	}
+	max_workers_ = std::max(task_conf.max_workers(), min_workers_);
+	idle_timeout_ns_ = task_conf.idle_timeout_ms() * 1000000UL;
+	task_queue_size_ = task_conf.queue_size();
+	unbounded_queue_ = task_conf.unbounded_queue();
+
+	for (auto& lane : lanes_) {
+		lane.reset(AlignedNew<Lane>());
+		if (!lane->queue.Init(task_queue_size_)) {
+			AERROR << "Task queue init failed";
+			throw std::runtime_error("Task queue init failed");
 		}
 	}
+
+	// slots are fixed up front, so workers can index them without a lock
+	workers_.reserve(max_workers_);
+	for (uint32_t i = 0; i < max_workers_; i++) {
+		workers_.emplace_back(new Worker());
+		workers_[i]->name = task_prefix + std::to_string(i);
+		workers_[i]->id = GlobalData::RegisterTaskName(workers_[i]->name);
+	}
+	std::lock_guard<std::mutex> lock(workers_mutex_);
+	for (uint32_t i = 0; i < min_workers_; i++) {
+		StartWorker(i);
+	}
 }
 
 TaskManager::~TaskManager() { Shutdown(); }
@@ -65,9 +71,177 @@ void TaskManager::Shutdown() {
 	if (stop_.exchange(true)) {
 		return;
 	}
-	for (uint32_t i = 0; i < num_threads_; i++) {
-		scheduler::Instance()->RemoveTask(task_prefix + std::to_string(i));
+	std::lock_guard<std::mutex> lock(workers_mutex_);
+	for (auto& worker : workers_) {
+		if (worker->created) {
+			scheduler::Instance()->RemoveTask(worker->name);
+			worker->created = false;
+		}
+	}
+}
+
+bool TaskManager::StartWorker(uint32_t index) {
+	auto& worker = *workers_[index];
+	if (worker.created) {
+		// reap the croutine of the retired worker
+		scheduler::Instance()->RemoveTask(worker.name);
+		worker.created = false;
+	}
+	worker.state = WORKER_BUSY;
+	++live_workers_;
+	if (!scheduler::Instance()->CreateTask([this, index]() { this->WorkerFunc(index); }, worker.name)) {
+		AERROR << "CreateTask failed:" << worker.name;
+		worker.state = WORKER_STOPPED;
+		--live_workers_;
+		return false;
+	}
+	worker.created = true;
+	return true;
+}
+
+bool TaskManager::Push(TaskPriority priority, TaskFunction&& task) {
+	auto& lane = *lanes_[static_cast<int>(priority)];
+	// counted before the task is visible, so that a concurrent Pop never
+	// takes the counters below zero
+	uint64_t size = ++lane.size;
+	++pending_;
+	// once spilled, keep spilling until the list drains to stay in order
+	if (lane.overflow_size.load() > 0 || !lane.queue.Enqueue(std::move(task))) {
+		if (!unbounded_queue_) {
+			--lane.size;
+			--pending_;
+			++lane.dropped;
+			AERROR_EVERY(100) << "task queue is full, " << lane.dropped.load() << " tasks dropped";
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(lane.overflow_mutex);
+		lane.overflow.emplace_back(std::move(task));
+		++lane.overflow_size;
+		++lane.overflowed;
+	}
+	++lane.enqueued;
+	uint64_t mark = lane.high_water_mark.load();
+	while (size > mark && !lane.high_water_mark.compare_exchange_weak(mark, size)) {
+	}
+
+	if (WakeIdleWorker()) {
+		return true;
+	}
+	// every worker is busy: grow if allowed, a busy worker picks the task up
+	// otherwise
+	last_saturated_ns_ = Time::MonoTime().ToNanosecond();
+	if (live_workers_.load() < max_workers_ && !stop_.load()) {
+		std::lock_guard<std::mutex> lock(workers_mutex_);
+		for (uint32_t i = 0; i < max_workers_ && live_workers_.load() < max_workers_; i++) {
+			if (workers_[i]->state.load() == WORKER_STOPPED) {
+				if (StartWorker(i)) {
+					AINFO << "task pool grows to " << live_workers_.load() << " workers";
+				}
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+bool TaskManager::WakeIdleWorker() {
+	bool woken = false;
+	bool nudge = live_workers_.load() > min_workers_ &&
+		Time::MonoTime().ToNanosecond() - last_saturated_ns_.load() > idle_timeout_ns_;
+	for (uint32_t i = 0; i < max_workers_; i++) {
+		auto& worker = *workers_[i];
+		int expected = WORKER_IDLE;
+		if (!woken && worker.state.compare_exchange_strong(expected, WORKER_BUSY)) {
+			scheduler::Instance()->NotifyTask(worker.id);
+			woken = true;
+			if (!nudge) {
+				break;
+			}
+			continue;
+		}
+		// extra workers are the last to be woken, let the idle ones check
+		// whether they are due to retire
+		if (nudge && i >= min_workers_ && worker.state.load() == WORKER_IDLE) {
+			scheduler::Instance()->NotifyTask(worker.id);
+		}
+	}
+	return woken;
+}
+
+bool TaskManager::Pop(TaskFunction* task) {
+	for (auto& lane : lanes_) {
+		bool popped = lane->queue.Dequeue(task);
+		if (!popped && lane->overflow_size.load() > 0) {
+			std::lock_guard<std::mutex> lock(lane->overflow_mutex);
+			if (!lane->overflow.empty()) {
+				*task = std::move(lane->overflow.front());
+				lane->overflow.pop_front();
+				--lane->overflow_size;
+				popped = true;
+			}
+		}
+		if (popped) {
+			--lane->size;
+			--pending_;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool TaskManager::Retire(uint32_t index, uint64_t idle_since_ns) {
+	uint64_t busy_ns = std::max(idle_since_ns, last_saturated_ns_.load());
+	if (Time::MonoTime().ToNanosecond() - busy_ns < idle_timeout_ns_) {
+		return false;
 	}
+	std::lock_guard<std::mutex> lock(workers_mutex_);
+	auto& worker = *workers_[index];
+	int expected = WORKER_IDLE;
+	// a producer may have claimed it meanwhile
+	if (!worker.state.compare_exchange_strong(expected, WORKER_STOPPED)) {
+		return false;
+	}
+	--live_workers_;
+	AINFO << "task worker " << worker.name << " retires, " << live_workers_.load() << " workers left";
+	return true;
+}
+
+void TaskManager::WorkerFunc(uint32_t index) {
+	auto& worker = *workers_[index];
+	uint64_t idle_since_ns = 0;
+	while (!stop_) {
+		TaskFunction task;
+		if (Pop(&task)) {
+			worker.state = WORKER_BUSY;
+			task();
+			task = nullptr;
+			idle_since_ns = 0;
+			continue;
+		}
+		if (idle_since_ns == 0) {
+			idle_since_ns = Time::MonoTime().ToNanosecond();
+		}
+		worker.state = WORKER_IDLE;
+		// a producer that saw us busy did not notify, look once more
+		if (pending_.load() > 0) {
+			continue;
+		}
+		if (index >= min_workers_ && Retire(index, idle_since_ns)) {
+			return;
+		}
+		croutine::CRoutine::GetCurrentRoutine()->HangUp();
+	}
+}
+
+TaskQueueStats TaskManager::GetQueueStats(TaskPriority priority) const {
+	const auto& lane = *lanes_[static_cast<int>(priority)];
+	TaskQueueStats stats;
+	stats.size = lane.size.load();
+	stats.high_water_mark = lane.high_water_mark.load();
+	stats.enqueued = lane.enqueued.load();
+	stats.overflowed = lane.overflowed.load();
+	stats.dropped = lane.dropped.load();
+	return stats;
 }
 
 }  // namespace cyber
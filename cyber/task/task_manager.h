@@ -18,19 +18,47 @@
 #define CYBER_TASK_TASK_MANAGER_H_
 
 #include <atomic>
+#include <deque>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "cyber/base/bounded_queue.h"
+#include "cyber/base/macros.h"
+#include "cyber/base/mpmc_queue.h"
+#include "cyber/base/unique_function.h"
 #include "cyber/scheduler/scheduler_factory.h"
 
 namespace apollo {
 namespace cyber {
 
+/**
+ * @brief Lanes of the task pool, a worker always drains the higher ones first.
+ */
+enum class TaskPriority {
+	HIGH = 0,    // latency critical, e.g. timer callbacks
+	NORMAL = 1,  // cyber::Async
+	LOW = 2,     // bulk work, e.g. history replay
+};
+
+static const uint32_t TASK_PRIORITY_NUM = 3;
+
+struct TaskQueueStats {
+	uint64_t size = 0;
+	uint64_t high_water_mark = 0;
+	uint64_t enqueued = 0;
+	// tasks that went to the unbounded spill list
+	uint64_t overflowed = 0;
+	// tasks lost on a full bounded queue
+	uint64_t dropped = 0;
+};
+
+// held in the queue slot itself, small closures do not allocate
+using TaskFunction = base::UniqueFunction<void()>;
+
 class TaskManager {
 public:
 	virtual ~TaskManager();
@@ -39,25 +67,88 @@ public:
 
 	template <typename F, typename... Args>
 	auto Enqueue(F&& func, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> 
+	{
+		return EnqueueWithPriority(TaskPriority::NORMAL, std::forward<F>(func), std::forward<Args>(args)...);
+	}
+
+	template <typename F, typename... Args>
+	auto EnqueueWithPriority(TaskPriority priority, F&& func, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> 
 	{
 		using return_type = typename std::result_of<F(Args...)>::type;
 		auto task = std::make_shared<std::packaged_task<return_type()>>(std::bind(std::forward<F>(func), std::forward<Args>(args)...));
 		if (!stop_.load()) {
-			task_queue_->Enqueue([task]() { (*task)(); });
-			for (auto& task : tasks_) {
-				scheduler::Instance()->NotifyTask(task);
-			}
+			Push(priority, [task]() { (*task)(); });
 		}
 		std::future<return_type> res(task->get_future());
 		return res;
 	}
 
+	/**
+	 * @brief Fire and forget, no future and no allocation for callables of
+	 * up to TaskFunction::kInlineSize bytes.
+	 *
+	 * @return False when the task was dropped on a full bounded queue.
+	 */
+	template <typename F>
+	bool Post(TaskPriority priority, F&& func) {
+		if (stop_.load()) {
+			return false;
+		}
+		return Push(priority, TaskFunction(std::forward<F>(func)));
+	}
+
+	TaskQueueStats GetQueueStats(TaskPriority priority) const;
+
+	/**
+	 * @brief Workers currently alive, between the min and max pool size.
+	 */
+	uint32_t WorkerNum() const { return live_workers_.load(); }
+
 private:
-	uint32_t num_threads_ = 0;
-	uint32_t task_queue_size_ = 1000;
+	enum WorkerState { WORKER_STOPPED = 0, WORKER_IDLE, WORKER_BUSY };
+
+	struct Worker {
+		std::string name;
+		uint64_t id = 0;
+		std::atomic<int> state = {WORKER_STOPPED};
+		// a retired croutine stays in the scheduler until its slot is reused
+		bool created = false;
+	};
+
+	struct Lane {
+		base::MpmcQueue<TaskFunction> queue;
+		// unbounded mode only, filled while the ring is full
+		std::mutex overflow_mutex;
+		std::deque<TaskFunction> overflow;
+		std::atomic<uint64_t> overflow_size = {0};
+		std::atomic<uint64_t> size = {0};
+		std::atomic<uint64_t> high_water_mark = {0};
+		std::atomic<uint64_t> enqueued = {0};
+		std::atomic<uint64_t> overflowed = {0};
+		std::atomic<uint64_t> dropped = {0};
+	};
+
+	bool Push(TaskPriority priority, TaskFunction&& task);
+	bool Pop(TaskFunction* task);
+	bool WakeIdleWorker();
+	bool StartWorker(uint32_t index);
+	bool Retire(uint32_t index, uint64_t idle_since_ns);
+	void WorkerFunc(uint32_t index);
+
+	uint32_t min_workers_ = 0;
+	uint32_t max_workers_ = 0;
+	uint64_t idle_timeout_ns_ = 0;
+	uint32_t task_queue_size_ = 1024;
+	bool unbounded_queue_ = false;
 	std::atomic<bool> stop_ = {false};
-	std::vector<uint64_t> tasks_;
-	std::shared_ptr<base::BoundedQueue<std::function<void()>>> task_queue_;
+	std::atomic<uint64_t> pending_ = {0};
+	std::atomic<uint32_t> live_workers_ = {0};
+	// last time all live workers were busy when a task arrived
+	std::atomic<uint64_t> last_saturated_ns_ = {0};
+	std::mutex workers_mutex_;
+	std::vector<std::unique_ptr<Worker>> workers_;
+	// the queue is cache line aligned, so allocated with AlignedNew
+	std::unique_ptr<Lane, AlignedDeleter<Lane>> lanes_[TASK_PRIORITY_NUM];
 	DECLARE_SINGLETON(TaskManager);
 };
 
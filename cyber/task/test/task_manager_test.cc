@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/task/task_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/test/test_work_root.h"
+#include "cyber/cyber.h"
+#include "cyber/task/task.h"
+
+namespace apollo {
+namespace cyber {
+
+// see main(): one processor, 2 to 4 workers, rings of 8 spilling over
+constexpr uint32_t kMinWorkers = 2;
+constexpr uint32_t kMaxWorkers = 4;
+constexpr uint32_t kQueueSize = 8;
+
+// occupy the only processor until the returned promise is set
+std::promise<void> BlockProcessor() {
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<bool> running = {false};
+  cyber::Async([released, &running] {
+    running = true;
+    released.wait();
+  });
+  while (!running) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return release;
+}
+
+template <typename T>
+void WaitAll(std::vector<std::future<T>>* futures) {
+  for (auto& future : *futures) {
+    ASSERT_EQ(std::future_status::ready,
+              future.wait_for(std::chrono::seconds(5)));
+  }
+}
+
+TEST(TaskManagerTest, Overflow) {
+  auto manager = TaskManager::Instance();
+  auto before = manager->GetQueueStats(TaskPriority::NORMAL);
+  auto release = BlockProcessor();
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; i++) {
+    futures.emplace_back(cyber::Async([i] { return i; }));
+  }
+  auto stats = manager->GetQueueStats(TaskPriority::NORMAL);
+  EXPECT_EQ(100, stats.size);
+  EXPECT_LE(100, stats.high_water_mark);
+  EXPECT_EQ(100 - kQueueSize, stats.overflowed - before.overflowed);
+  EXPECT_EQ(0, stats.dropped);
+  release.set_value();
+  WaitAll(&futures);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(i, futures[i].get());
+  }
+  stats = manager->GetQueueStats(TaskPriority::NORMAL);
+  EXPECT_EQ(0, stats.size);
+  EXPECT_EQ(101, stats.enqueued - before.enqueued);
+}
+
+TEST(TaskManagerTest, Priority) {
+  auto release = BlockProcessor();
+  std::mutex mutex;
+  std::vector<TaskPriority> order;
+  std::vector<std::future<void>> futures;
+  auto record = [&](TaskPriority priority) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(priority);
+  };
+  for (int i = 0; i < 5; i++) {
+    futures.emplace_back(
+        cyber::AsyncWithPriority(TaskPriority::LOW, record, TaskPriority::LOW));
+  }
+  for (int i = 0; i < 5; i++) {
+    futures.emplace_back(cyber::AsyncWithPriority(TaskPriority::HIGH, record,
+                                                  TaskPriority::HIGH));
+  }
+  release.set_value();
+  WaitAll(&futures);
+  ASSERT_EQ(10, order.size());
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(i < 5 ? TaskPriority::HIGH : TaskPriority::LOW, order[i]);
+  }
+}
+
+// extra workers retire once idle for the timeout, the next task lets them
+// notice
+uint32_t WaitForShrink() {
+  auto manager = TaskManager::Instance();
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  cyber::Async([] {}).wait();
+  for (int i = 0; i < 100 && manager->WorkerNum() > kMinWorkers; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return manager->WorkerNum();
+}
+
+TEST(TaskManagerTest, GrowAndShrink) {
+  auto manager = TaskManager::Instance();
+  EXPECT_EQ(kMinWorkers, WaitForShrink());
+  // tasks that yield their processor while waiting keep their worker busy
+  std::atomic<bool> released = {false};
+  std::vector<std::future<void>> futures;
+  for (uint32_t i = 0; i < kMaxWorkers + 2; i++) {
+    futures.emplace_back(cyber::Async([&released] {
+      while (!released) {
+        cyber::SleepFor(std::chrono::milliseconds(5));
+      }
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(kMaxWorkers, manager->WorkerNum());
+  released = true;
+  WaitAll(&futures);
+
+  EXPECT_EQ(kMinWorkers, WaitForShrink());
+
+  // and come back under load
+  released = false;
+  futures.clear();
+  for (uint32_t i = 0; i < kMaxWorkers; i++) {
+    futures.emplace_back(cyber::Async([&released] {
+      while (!released) {
+        cyber::SleepFor(std::chrono::milliseconds(5));
+      }
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(kMaxWorkers, manager->WorkerNum());
+  released = true;
+  WaitAll(&futures);
+}
+
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::common::TestWorkRoot work_root("task_manager_test");
+  return work_root.RunAllTests(
+      argv[0],
+      "scheduler_conf { routine_num: 100 default_proc_num: 1 }\n"
+      "task_conf { min_workers: 2 max_workers: 4 idle_timeout_ms: 200 "
+      "queue_size: 8 unbounded_queue: true }\n");
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/environment.h"
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/timer/timer.h"
+
+namespace apollo {
+namespace cyber {
+namespace timer {
+
+using cyber::Timer;
+
+// the wheel runs at 100us resolution, see main()
+constexpr uint64_t kResolutionNs = 100000;
+
+TEST(TimerJitterTest, jitter_1khz) {
+  // timer_jitter_relaxed=1 for machines too loaded to keep the tick
+  bool relaxed = !common::GetEnv("timer_jitter_relaxed").empty();
+  const int kTimerNum = 4;
+  std::vector<uint64_t> fire_times[kTimerNum];
+  std::shared_ptr<Timer> timers[kTimerNum];
+  for (int i = 0; i < kTimerNum; i++) {
+    fire_times[i].reserve(2000);
+    auto* times = &fire_times[i];
+    timers[i] = std::make_shared<Timer>(
+        1, [times] { times->push_back(Time::MonoTime().ToNanosecond()); },
+        false);
+    timers[i]->Start();
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  for (int i = 0; i < kTimerNum; i++) {
+    timers[i]->Stop();
+  }
+
+  std::vector<uint64_t> jitter_ns;
+  for (int i = 0; i < kTimerNum; i++) {
+    // phase locked to the first deadline, so one firing per ms
+    EXPECT_GT(fire_times[i].size(), relaxed ? 800 : 950);
+    EXPECT_LT(fire_times[i].size(), 1050);
+    for (size_t j = 1; j < fire_times[i].size(); j++) {
+      int64_t interval = fire_times[i][j] - fire_times[i][j - 1];
+      jitter_ns.push_back(std::abs(interval - 1000000));
+    }
+  }
+  ASSERT_FALSE(jitter_ns.empty());
+  std::sort(jitter_ns.begin(), jitter_ns.end());
+  uint64_t p50 = jitter_ns[jitter_ns.size() / 2];
+  uint64_t p99 = jitter_ns[jitter_ns.size() * 99 / 100];
+  AINFO << "1kHz timer jitter p50: " << p50 << "ns, p99: " << p99
+        << "ns, max: " << jitter_ns.back() << "ns";
+  // the tails depend on the machine's load and are only logged
+  EXPECT_LT(p50, (relaxed ? 10 : 3) * kResolutionNs);
+}
+
+}  // namespace timer
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  // a tick fine enough for 1kHz timers, fired on the timer croutine; the
+  // wheel reads them once, so they get a binary of their own
+  setenv("timer_resolution_us", "100", 1);
+  setenv("timer_fire_on_croutine", "1", 1);
+  apollo::cyber::Init(argv[0]);
+  return RUN_ALL_TESTS();
+}
@@ -18,7 +18,9 @@
 
 #include "cyber/timer/timer.h"
 
+#include <cstdlib>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -97,6 +99,57 @@ TEST(TimerTest, sim_mode) {
   }
 }
 
+TEST(TimerTest, coalesce) {
+  std::atomic<uint64_t> fire_times[2] = {{0}, {0}};
+  std::shared_ptr<Timer> timers[2];
+  TimerOption opt;
+  opt.period = 10;
+  opt.oneshot = true;
+  opt.coalesce = true;
+  // start both early in the same period so they round up to the same phase
+  while (Time::MonoTime().ToNanosecond() % 10000000 > 2000000) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  for (int i = 0; i < 2; i++) {
+    auto* time = &fire_times[i];
+    opt.callback = [time] { *time = Time::MonoTime().ToNanosecond(); };
+    timers[i] = std::make_shared<Timer>(opt);
+    timers[i]->Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  for (int i = 0; i < 2; i++) {
+    timers[i]->Stop();
+  }
+  ASSERT_NE(0, fire_times[0].load());
+  ASSERT_NE(0, fire_times[1].load());
+  // both aligned to the same multiple of the period and fired in one batch
+  int64_t diff = fire_times[1].load() - fire_times[0].load();
+  EXPECT_LT(std::abs(diff), 1000000);
+}
+
+TEST(TimerTest, group) {
+  std::string routine_name;
+  std::atomic<bool> fired = {false};
+  TimerOption opt;
+  opt.period = 5;
+  opt.oneshot = true;
+  opt.group = "isolated";
+  opt.callback = [&] {
+    auto routine = croutine::CRoutine::GetCurrentRoutine();
+    if (routine != nullptr) {
+      routine_name = routine->name();
+    }
+    fired = true;
+  };
+  Timer timer(opt);
+  timer.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  timer.Stop();
+  ASSERT_TRUE(fired.load());
+  EXPECT_EQ("/internal/timer/isolated", routine_name);
+}
+
 }  // namespace timer
 }  // namespace cyber
 }  // namespace apollo
@@ -16,9 +16,8 @@
 
 #include "cyber/timer/timer.h"
 
-#include <cmath>
-
 #include "cyber/common/global_data.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -54,21 +53,28 @@ bool Timer::InitTimerTask() {
     return false;
   }
 
-  if (timer_opt_.period >= TIMER_MAX_INTERVAL_MS) {
-    AERROR << "Max interval must less than " << TIMER_MAX_INTERVAL_MS;
-    return false;
-  }
-
   task_.reset(new TimerTask(timer_id_));
-  task_->interval_ms = timer_opt_.period;
-  task_->next_fire_duration_ms = task_->interval_ms;
+  task_->interval_ns = timer_opt_.period * 1000000UL;
+  uint64_t now = Time::MonoTime().ToNanosecond();
+  task_->next_fire_time_ns = now + task_->interval_ns;
+  if (timer_opt_.coalesce) {
+    // the same phase for every timer of this period
+    task_->coalesce = true;
+    task_->next_fire_time_ns =
+        (now / task_->interval_ns + 1) * task_->interval_ns;
+  }
+  if (!timer_opt_.group.empty()) {
+    task_->routine = timing_wheel_->GetFireRoutine(timer_opt_.group);
+  }
   if (timer_opt_.oneshot) {
     std::weak_ptr<TimerTask> task_weak_ptr = task_;
     task_->callback = [callback = this->timer_opt_.callback, task_weak_ptr]() {
       auto task = task_weak_ptr.lock();
       if (task) {
         std::lock_guard<std::mutex> lg(task->mutex);
-        callback();
+        if (!task->cancelled.load()) {
+          callback();
+        }
       }
     };
   } else {
@@ -79,46 +85,22 @@ bool Timer::InitTimerTask() {
         return;
       }
       std::lock_guard<std::mutex> lg(task->mutex);
+      if (task->cancelled.load()) {
+        return;
+      }
       auto start = Time::MonoTime().ToNanosecond();
       callback();
       auto end = Time::MonoTime().ToNanosecond();
-      uint64_t execute_time_ns = end - start;
-      uint64_t execute_time_ms =
-#if defined(__aarch64__)
-          ::llround(static_cast<double>(execute_time_ns) / 1e6);
-#else
-          std::llround(static_cast<double>(execute_time_ns) / 1e6);
-#endif
-      if (task->last_execute_time_ns == 0) {
-        task->last_execute_time_ns = start;
-      } else {
-        task->accumulated_error_ns +=
-            start - task->last_execute_time_ns - task->interval_ms * 1000000;
-      }
       ADEBUG << "start: " << start << "\t last: " << task->last_execute_time_ns
-             << "\t execut time:" << execute_time_ms
-             << "\t accumulated_error_ns: " << task->accumulated_error_ns;
+             << "\t execute time ns: " << end - start
+             << "\t lateness ns: " << start - task->next_fire_time_ns;
       task->last_execute_time_ns = start;
-      if (execute_time_ms >= task->interval_ms) {
-        task->next_fire_duration_ms = TIMER_RESOLUTION_MS;
-      } else {
-#if defined(__aarch64__)
-        int64_t accumulated_error_ms = ::llround(
-#else
-        int64_t accumulated_error_ms = std::llround(
-#endif
-            static_cast<double>(task->accumulated_error_ns) / 1e6);
-        if (static_cast<int64_t>(task->interval_ms - execute_time_ms -
-                                 TIMER_RESOLUTION_MS) >= accumulated_error_ms) {
-          task->next_fire_duration_ms =
-              task->interval_ms - execute_time_ms - accumulated_error_ms;
-        } else {
-          task->next_fire_duration_ms = TIMER_RESOLUTION_MS;
-        }
-        ADEBUG << "error ms: " << accumulated_error_ms
-               << "  execute time: " << execute_time_ms
-               << " next fire: " << task->next_fire_duration_ms
-               << " error ns: " << task->accumulated_error_ns;
+      // stay on the phase of the first deadline, an overrun fires once as
+      // soon as possible and skips the periods it missed
+      task->next_fire_time_ns += task->interval_ns;
+      if (task->next_fire_time_ns < end) {
+        uint64_t missed = (end - task->next_fire_time_ns) / task->interval_ns;
+        task->next_fire_time_ns += missed * task->interval_ns;
       }
       TimingWheel::Instance()->AddTask(task);
     };
@@ -146,6 +128,9 @@ void Timer::Stop() {
     auto tmp_task = task_;
     {
       std::lock_guard<std::mutex> lg(tmp_task->mutex);
+      // the wheel only holds a raw pointer, disarm before releasing
+      tmp_task->cancelled = true;
+      timing_wheel_->RemoveTask(tmp_task);
       task_.reset();
     }
   }
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
 
 #include "cyber/timer/timing_wheel.h"
 
@@ -48,8 +49,7 @@ struct TimerOption {
 
   /**
    * @brief The period of the timer, unit is ms
-   * max: 512 * 64
-   * min: 1
+   * min: 1, no upper bound
    */
   uint32_t period = 0;
 
@@ -61,6 +61,19 @@ struct TimerOption {
    * False: perform the callback every timed period
    */
   bool oneshot;
+
+  /**
+   * True: align the first deadline to a multiple of the period, so that all
+   * coalescing timers of the same period share one wheel entry and fire in
+   * the same batch
+   */
+  bool coalesce = false;
+
+  /**
+   * Non-empty: fire on the croutine "/internal/timer/<group>", which the
+   * scheduler conf can pin to its own group or processor by that name
+   */
+  std::string group;
 };
 
 /**
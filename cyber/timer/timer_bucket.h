@@ -17,28 +17,62 @@
 #ifndef CYBER_TIMER_TIMER_BUCKET_H_
 #define CYBER_TIMER_TIMER_BUCKET_H_
 
-#include <list>
-#include <memory>
-#include <mutex>
-
 #include "cyber/timer/timer_task.h"
 
 namespace apollo {
 namespace cyber {
 
+// Intrusive doubly linked list of timer tasks, so that a task unlinks itself
+// in O(1). Not thread safe, the owning wheel serializes access.
 class TimerBucket {
  public:
-  void AddTask(const std::shared_ptr<TimerTask>& task) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    task_list_.push_back(task);
+  void AddTask(TimerTask* task) {
+    task->bucket = this;
+    task->next = nullptr;
+    task->prev = tail_;
+    if (tail_ != nullptr) {
+      tail_->next = task;
+    } else {
+      head_ = task;
+    }
+    tail_ = task;
+  }
+
+  void RemoveTask(TimerTask* task) {
+    if (task->prev != nullptr) {
+      task->prev->next = task->next;
+    } else {
+      head_ = task->next;
+    }
+    if (task->next != nullptr) {
+      task->next->prev = task->prev;
+    } else {
+      tail_ = task->prev;
+    }
+    task->bucket = nullptr;
+    task->prev = nullptr;
+    task->next = nullptr;
   }
 
-  std::mutex& mutex() { return mutex_; }
-  std::list<std::weak_ptr<TimerTask>>& task_list() { return task_list_; }
+  TimerTask* PopFront() {
+    TimerTask* task = head_;
+    if (task != nullptr) {
+      RemoveTask(task);
+    }
+    return task;
+  }
+
+  bool Empty() const { return head_ == nullptr; }
 
  private:
-  std::mutex mutex_;
-  std::list<std::weak_ptr<TimerTask>> task_list_;
+  TimerTask* head_ = nullptr;
+  TimerTask* tail_ = nullptr;
+};
+
+// Wheel entry of coalesced timers, |members| fire together when it expires.
+struct CoalescedTask : public TimerTask {
+  CoalescedTask() : TimerTask(0) { is_anchor = true; }
+  TimerBucket members;
 };
 
 }  // namespace cyber
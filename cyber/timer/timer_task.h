@@ -17,24 +17,40 @@
 #ifndef CYBER_TIMER_TIMER_TASK_H_
 #define CYBER_TIMER_TIMER_TASK_H_
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 namespace apollo {
 namespace cyber {
 
 class TimerBucket;
+struct TimerFireRoutine;
 
-struct TimerTask {
+struct TimerTask : public std::enable_shared_from_this<TimerTask> {
   explicit TimerTask(uint64_t timer_id) : timer_id_(timer_id) {}
   uint64_t timer_id_ = 0;
   std::function<void()> callback;
-  uint64_t interval_ms = 0;
-  uint64_t remainder_interval_ms = 0;
-  uint64_t next_fire_duration_ms = 0;
-  int64_t accumulated_error_ns = 0;
+  uint64_t interval_ns = 0;
+  // absolute deadline on the monotonic clock
+  uint64_t next_fire_time_ns = 0;
   uint64_t last_execute_time_ns = 0;
+  // set under |mutex| by Timer::Stop(), a cancelled task is never re-armed
+  std::atomic<bool> cancelled = {false};
   std::mutex mutex;
+  // share a wheel entry with the timers of the same period and deadline
+  bool coalesce = false;
+  // where the callback runs, nullptr for the default dispatch
+  TimerFireRoutine* routine = nullptr;
+
+  // intrusive wheel links, guarded by the wheel lock
+  uint64_t expire_tick = 0;
+  TimerBucket* bucket = nullptr;
+  TimerTask* prev = nullptr;
+  TimerTask* next = nullptr;
+  // set on the wheel entry standing for a set of coalesced timers
+  bool is_anchor = false;
 };
 
 }  // namespace cyber
@@ -16,18 +16,69 @@
 
 #include "cyber/timer/timing_wheel.h"
 
-#include <cmath>
+#include <time.h>
 
+#include <algorithm>
+
+#include "cyber/common/environment.h"
+#include "cyber/common/global_data.h"
+#include "cyber/croutine/croutine.h"
 #include "cyber/task/task.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 
+using apollo::cyber::common::GetEnv;
+using apollo::cyber::common::GlobalData;
+static const char* const timer_routine_name = "/internal/timer";
+
+TimingWheel::TimingWheel() {
+	uint64_t resolution_us = proto::TimerConf().resolution_us();
+	auto& global_conf = GlobalData::Instance()->Config();
+	if (global_conf.has_timer_conf()) {
+		resolution_us = global_conf.timer_conf().resolution_us();
+		fire_on_croutine_ = global_conf.timer_conf().fire_on_croutine();
+	}
+	// environment overrides for tests and quick experiments
+	auto env_resolution = GetEnv("timer_resolution_us");
+	if (!env_resolution.empty()) {
+		resolution_us = std::stoul(env_resolution);
+	}
+	auto env_fire_on_croutine = GetEnv("timer_fire_on_croutine");
+	if (!env_fire_on_croutine.empty()) {
+		fire_on_croutine_ = std::stoi(env_fire_on_croutine) != 0;
+	}
+	if (resolution_us < TIMER_MIN_RESOLUTION_US) {
+		AWARN << "timer resolution " << resolution_us << "us is too fine, use "
+			<< TIMER_MIN_RESOLUTION_US << "us instead.";
+		resolution_us = TIMER_MIN_RESOLUTION_US;
+	}
+	resolution_ns_ = resolution_us * 1000UL;
+	if (fire_on_croutine_) {
+		default_routine_ = GetFireRoutine("");
+	}
+}
+
 void TimingWheel::Start() {
 	std::lock_guard<std::mutex> lock(running_mutex_);
 	if (!running_) {
 		ADEBUG << "TimeWheel start ok";
+		{
+			std::lock_guard<std::mutex> lg(mutex_);
+			if (start_time_ns_ == 0) {
+				start_time_ns_ = Time::MonoTime().ToNanosecond();
+			}
+		}
 		running_ = true;
+		{
+			std::lock_guard<std::mutex> lg(routines_mutex_);
+			for (auto& item : fire_routines_) {
+				if (!item.second->started && !StartFireRoutine(item.second.get())) {
+					AWARN << "create timer croutine " << item.first << " failed, fire its timers through cyber::Async.";
+				}
+			}
+		}
 		tick_thread_ = std::thread([this]() { this->TickFunc(); });
 		scheduler::Instance()->SetInnerThreadAttr("timer", &tick_thread_);
 	}
@@ -40,101 +91,209 @@ void TimingWheel::Shutdown() {
 		if (tick_thread_.joinable()) {
 			tick_thread_.join();
 		}
+		std::lock_guard<std::mutex> lg(routines_mutex_);
+		for (auto& item : fire_routines_) {
+			if (item.second->started.exchange(false)) {
+				scheduler::Instance()->RemoveTask(item.first);
+			}
+		}
+	}
+}
+
+TimerFireRoutine* TimingWheel::GetFireRoutine(const std::string& group) {
+	std::string name = timer_routine_name;
+	if (!group.empty()) {
+		name += "/" + group;
+	}
+	std::lock_guard<std::mutex> lock(routines_mutex_);
+	auto& routine = fire_routines_[name];
+	if (routine == nullptr) {
+		routine.reset(AlignedNew<TimerFireRoutine>());
+		routine->name = name;
+		routine->queue.Init(TIMER_FIRE_QUEUE_SIZE);
+	}
+	if (running_ && !routine->started && !StartFireRoutine(routine.get())) {
+		AWARN << "create timer croutine " << name << " failed, fire its timers through cyber::Async.";
 	}
+	return routine.get();
 }
 
-void TimingWheel::Tick() {
-	auto& bucket = work_wheel_[current_work_wheel_index_];
-	{
-		std::lock_guard<std::mutex> lock(bucket.mutex());
-		auto ite = bucket.task_list().begin();
-		while (ite != bucket.task_list().end()) {
-		auto task = ite->lock();
-		if (task) {
-			ADEBUG << "index: " << current_work_wheel_index_
-			<< " timer id: " << task->timer_id_;
-			auto* callback = reinterpret_cast<std::function<void()>*>(&(task->callback));
-			cyber::Async([this, callback] {
-						if (this->running_) {
-							(*callback)();
-						}
-					});
+bool TimingWheel::StartFireRoutine(TimerFireRoutine* routine) {
+	auto func = [this, routine]() {
+		while (running_ && routine->started) {
+			std::shared_ptr<TimerTask> task;
+			while (routine->queue.Dequeue(&task)) {
+				Fire(task);
+			}
+			croutine::CRoutine::GetCurrentRoutine()->HangUp();
 		}
-		ite = bucket.task_list().erase(ite);
+	};
+	// mark it first, the croutine may run before CreateTask returns
+	routine->id = GlobalData::RegisterTaskName(routine->name);
+	routine->started = true;
+	if (!scheduler::Instance()->CreateTask(std::move(func), routine->name)) {
+		routine->started = false;
+		return false;
+	}
+	return true;
+}
+
+void TimingWheel::Tick(std::vector<std::shared_ptr<TimerTask>>* expired) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	++current_tick_;
+	// a level cascades whenever all the levels below wrap around
+	for (uint64_t level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+		if ((current_tick_ & ((1UL << (TIMER_WHEEL_BITS * level)) - 1)) != 0) {
+			break;
 		}
+		Cascade(level);
+	}
+	auto& bucket = wheels_[0][current_tick_ & (TIMER_WHEEL_SIZE - 1)];
+	while (TimerTask* task = bucket.PopFront()) {
+		Expire(task, expired);
 	}
 }
 
-void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task) {
-	AddTask(task, current_work_wheel_index_);
+void TimingWheel::Expire(TimerTask* task, std::vector<std::shared_ptr<TimerTask>>* expired) {
+	if (!task->is_anchor) {
+		ADEBUG << "tick: " << current_tick_ << " timer id: " << task->timer_id_;
+		expired->emplace_back(task->shared_from_this());
+		return;
+	}
+	auto anchor = static_cast<CoalescedTask*>(task);
+	while (TimerTask* member = anchor->members.PopFront()) {
+		ADEBUG << "tick: " << current_tick_ << " coalesced timer id: " << member->timer_id_;
+		expired->emplace_back(member->shared_from_this());
+	}
+	// releases the anchor
+	coalesced_.erase(std::make_pair(anchor->interval_ns, anchor->expire_tick));
+}
+
+void TimingWheel::Place(TimerTask* task) {
+	static const uint64_t max_delta = (1UL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1;
+	uint64_t delta = std::min(task->expire_tick - current_tick_, max_delta);
+	uint64_t tick = current_tick_ + delta;
+	uint64_t level = 0;
+	while (level + 1 < TIMER_WHEEL_LEVELS && (delta >> (TIMER_WHEEL_BITS * (level + 1))) != 0) {
+		++level;
+	}
+	uint64_t slot = (tick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SIZE - 1);
+	wheels_[level][slot].AddTask(task);
 }
 
-void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task, const uint64_t current_work_wheel_index) {
+void TimingWheel::Cascade(uint64_t level) {
+	uint64_t slot = (current_tick_ >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SIZE - 1);
+	auto& bucket = wheels_[level][slot];
+	while (TimerTask* task = bucket.PopFront()) {
+		Place(task);
+	}
+}
+
+void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task) {
 	if (!running_) {
 		Start();
 	}
-	auto work_wheel_index = current_work_wheel_index +
-	static_cast<uint64_t>(std::ceil(static_cast<double>(task->next_fire_duration_ms) /TIMER_RESOLUTION_MS));
-	if (work_wheel_index >= WORK_WHEEL_SIZE) {
-		auto real_work_wheel_index = GetWorkWheelIndex(work_wheel_index);
-		task->remainder_interval_ms = real_work_wheel_index;
-		auto assistant_ticks = work_wheel_index / WORK_WHEEL_SIZE;
-		if (assistant_ticks == 1 && real_work_wheel_index < current_work_wheel_index_) 
-		{
-			work_wheel_[real_work_wheel_index].AddTask(task);
-			ADEBUG << "add task to work wheel. index :" << real_work_wheel_index;
-		} else {
-			auto assistant_wheel_index = 0;
-			{
-				std::lock_guard<std::mutex> lock(current_assistant_wheel_index_mutex_);
-				assistant_wheel_index = GetAssistantWheelIndex(current_assistant_wheel_index_ + assistant_ticks);
-				assistant_wheel_[assistant_wheel_index].AddTask(task);
-			}
-			ADEBUG << "add task to assistant wheel. index : " << assistant_wheel_index;
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (task->bucket != nullptr) {
+		task->bucket->RemoveTask(task.get());
+	}
+	uint64_t tick = 0;
+	if (task->next_fire_time_ns > start_time_ns_) {
+		tick = (task->next_fire_time_ns - start_time_ns_ + resolution_ns_ - 1) / resolution_ns_;
+	}
+	// the current tick has been handled already
+	task->expire_tick = std::max(tick, current_tick_ + 1);
+	if (task->coalesce) {
+		// timers due on the same tick with the same period share one entry
+		auto& anchor = coalesced_[std::make_pair(task->interval_ns, task->expire_tick)];
+		if (anchor == nullptr) {
+			anchor = std::make_shared<CoalescedTask>();
+			anchor->interval_ns = task->interval_ns;
+			anchor->expire_tick = task->expire_tick;
+			Place(anchor.get());
 		}
-	} else {
-		work_wheel_[work_wheel_index].AddTask(task);
-		ADEBUG << "add task [" << task->timer_id_ << "] to work wheel. index :" << work_wheel_index;
+		anchor->members.AddTask(task.get());
+		return;
+	}
+	Place(task.get());
+	ADEBUG << "add task [" << task->timer_id_ << "] expire tick: " << task->expire_tick;
+}
+
+void TimingWheel::RemoveTask(const std::shared_ptr<TimerTask>& task) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (task->bucket != nullptr) {
+		task->bucket->RemoveTask(task.get());
 	}
 }
 
-void TimingWheel::Cascade(const uint64_t assistant_wheel_index) {
-	auto& bucket = assistant_wheel_[assistant_wheel_index];
-	std::lock_guard<std::mutex> lock(bucket.mutex());
-	auto ite = bucket.task_list().begin();
-	while (ite != bucket.task_list().end()) {
-		auto task = ite->lock();
-		if (task) {
-			work_wheel_[task->remainder_interval_ms].AddTask(task);
+void TimingWheel::Fire(const std::shared_ptr<TimerTask>& task) {
+	if (running_ && !task->cancelled.load()) {
+		task->callback();
+	}
+}
+
+void TimingWheel::Dispatch(std::vector<std::shared_ptr<TimerTask>>* expired) {
+	// hand a whole tick over at once: the timer croutines are woken once each,
+	// everything else goes through one high priority task per group so a slow
+	// callback only holds back the timers of its own group
+	std::vector<TimerFireRoutine*> notify;
+	std::vector<std::pair<TimerFireRoutine*, std::vector<std::shared_ptr<TimerTask>>>> batches;
+	for (auto& task : *expired) {
+		TimerFireRoutine* routine = task->routine != nullptr ? task->routine : default_routine_;
+		if (routine != nullptr && routine->started && routine->queue.Enqueue(task)) {
+			if (std::find(notify.begin(), notify.end(), routine) == notify.end()) {
+				notify.push_back(routine);
+			}
+			continue;
+		}
+		auto it = std::find_if(batches.begin(), batches.end(),
+				[routine](const std::pair<TimerFireRoutine*, std::vector<std::shared_ptr<TimerTask>>>& batch) {
+					return batch.first == routine;
+				});
+		if (it == batches.end()) {
+			batches.emplace_back(routine, std::vector<std::shared_ptr<TimerTask>>());
+			it = batches.end() - 1;
+		}
+		it->second.emplace_back(std::move(task));
+	}
+	for (auto routine : notify) {
+		scheduler::Instance()->NotifyTask(routine->id);
+	}
+	for (auto& batch : batches) {
+		if (batch.second.size() == 1) {
+			cyber::PostWithPriority(TaskPriority::HIGH, [this, task = std::move(batch.second.front())] { this->Fire(task); });
+			continue;
 		}
-		ite = bucket.task_list().erase(ite);
+		cyber::PostWithPriority(TaskPriority::HIGH, [this, tasks = std::move(batch.second)]() {
+			for (const auto& task : tasks) {
+				this->Fire(task);
+			}
+		});
 	}
 }
 
 void TimingWheel::TickFunc() {
-  Rate rate(TIMER_RESOLUTION_MS * 1000000);  // ms to ns
-  while (running_) {
-    Tick();
-    // AINFO_EVERY(1000) << "Tick " << TickCount();
-    tick_count_++;
-    rate.Sleep();
-    {
-      std::lock_guard<std::mutex> lock(current_work_wheel_index_mutex_);
-      current_work_wheel_index_ =
-          GetWorkWheelIndex(current_work_wheel_index_ + 1);
-    }
-    if (current_work_wheel_index_ == 0) {
-      {
-        std::lock_guard<std::mutex> lock(current_assistant_wheel_index_mutex_);
-        current_assistant_wheel_index_ =
-            GetAssistantWheelIndex(current_assistant_wheel_index_ + 1);
-      }
-      Cascade(current_assistant_wheel_index_);
-    }
-  }
-}
+	std::vector<std::shared_ptr<TimerTask>> expired;
+	while (running_) {
+		// sleep to the absolute start of the next tick, so that the wheel
+		// does not drift with the wakeup latency
+		uint64_t wake_ns = start_time_ns_ + (current_tick_ + 1) * resolution_ns_;
+		struct timespec ts;
+		ts.tv_sec = static_cast<time_t>(wake_ns / 1000000000UL);
+		ts.tv_nsec = static_cast<long>(wake_ns % 1000000000UL);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr);
 
-TimingWheel::TimingWheel() {}
+		uint64_t now_tick = (Time::MonoTime().ToNanosecond() - start_time_ns_) / resolution_ns_;
+		while (running_ && current_tick_ < now_tick) {
+			Tick(&expired);
+			tick_count_++;
+			if (!expired.empty()) {
+				Dispatch(&expired);
+				expired.clear();
+			}
+		}
+	}
+}
 
 }  // namespace cyber
 }  // namespace apollo
@@ -17,15 +17,21 @@
 #ifndef CYBER_TIMER_TIMING_WHEEL_H_
 #define CYBER_TIMER_TIMING_WHEEL_H_
 
-#include <future>
-#include <list>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "cyber/base/macros.h"
+#include "cyber/base/spsc_queue.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/scheduler/scheduler_factory.h"
-#include "cyber/time/rate.h"
 #include "cyber/timer/timer_bucket.h"
 
 namespace apollo {
@@ -33,11 +39,22 @@ namespace cyber {
 
 struct TimerTask;
 
-static const uint64_t WORK_WHEEL_SIZE = 512;
-static const uint64_t ASSISTANT_WHEEL_SIZE = 64;
-static const uint64_t TIMER_RESOLUTION_MS = 2;
-static const uint64_t TIMER_MAX_INTERVAL_MS =
-    WORK_WHEEL_SIZE * ASSISTANT_WHEEL_SIZE * TIMER_RESOLUTION_MS;
+// Every level has TIMER_WHEEL_SIZE slots and covers TIMER_WHEEL_SIZE times the
+// span of the level below. Deadlines past the top level are parked in its
+// farthest slot and placed again when it cascades, so intervals are unbounded.
+static const uint64_t TIMER_WHEEL_BITS = 6;
+static const uint64_t TIMER_WHEEL_SIZE = 1UL << TIMER_WHEEL_BITS;
+static const uint64_t TIMER_WHEEL_LEVELS = 6;
+static const uint64_t TIMER_MIN_RESOLUTION_US = 100;
+static const uint64_t TIMER_FIRE_QUEUE_SIZE = 4096;
+
+// A croutine that runs timer callbacks fed by the tick thread.
+struct TimerFireRoutine {
+  std::string name;
+  uint64_t id = 0;
+  std::atomic<bool> started = {false};
+  base::SpscQueue<std::shared_ptr<TimerTask>> queue;
+};
 
 class TimingWheel {
  public:
@@ -51,37 +68,62 @@ class TimingWheel {
 
   void Shutdown();
 
-  void Tick();
-
+  /**
+   * @brief Arm |task| for task->next_fire_time_ns, the wheel only keeps a
+   * raw pointer so the owner must RemoveTask() before releasing it.
+   */
   void AddTask(const std::shared_ptr<TimerTask>& task);
 
-  void AddTask(const std::shared_ptr<TimerTask>& task,
-               const uint64_t current_work_wheel_index);
+  /**
+   * @brief Disarm |task| in O(1), no-op when it is not armed.
+   */
+  void RemoveTask(const std::shared_ptr<TimerTask>& task);
 
-  void Cascade(const uint64_t assistant_wheel_index);
+  /**
+   * @brief The croutine firing the timers of |group|, created on first use.
+   * Its name is "/internal/timer/<group>" so that the scheduler conf can
+   * place it.
+   */
+  TimerFireRoutine* GetFireRoutine(const std::string& group);
 
   void TickFunc();
 
   inline uint64_t TickCount() const { return tick_count_; }
 
- private:
-  inline uint64_t GetWorkWheelIndex(const uint64_t index) {
-    return index & (WORK_WHEEL_SIZE - 1);
-  }
-  inline uint64_t GetAssistantWheelIndex(const uint64_t index) {
-    return index & (ASSISTANT_WHEEL_SIZE - 1);
-  }
+  inline uint64_t ResolutionNs() const { return resolution_ns_; }
 
-  bool running_ = false;
-  uint64_t tick_count_ = 0;
+ private:
+  void Tick(std::vector<std::shared_ptr<TimerTask>>* expired);
+  void Place(TimerTask* task);
+  void Cascade(uint64_t level);
+  void Expire(TimerTask* task, std::vector<std::shared_ptr<TimerTask>>* expired);
+  void Dispatch(std::vector<std::shared_ptr<TimerTask>>* expired);
+  void Fire(const std::shared_ptr<TimerTask>& task);
+  bool StartFireRoutine(TimerFireRoutine* routine);
+
+  std::atomic<bool> running_ = {false};
+  std::atomic<uint64_t> tick_count_ = {0};
   std::mutex running_mutex_;
-  TimerBucket work_wheel_[WORK_WHEEL_SIZE];
-  TimerBucket assistant_wheel_[ASSISTANT_WHEEL_SIZE];
-  uint64_t current_work_wheel_index_ = 0;
-  std::mutex current_work_wheel_index_mutex_;
-  uint64_t current_assistant_wheel_index_ = 0;
-  std::mutex current_assistant_wheel_index_mutex_;
+  uint64_t resolution_ns_ = 0;
+  bool fire_on_croutine_ = false;
+  // wheel tick 0 on the monotonic clock
+  uint64_t start_time_ns_ = 0;
+  // guards the buckets, current_tick_ and the task links
+  std::mutex mutex_;
+  uint64_t current_tick_ = 0;
+  TimerBucket wheels_[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SIZE];
+  // keyed by period and expire tick
+  std::map<std::pair<uint64_t, uint64_t>, std::shared_ptr<CoalescedTask>>
+      coalesced_;
   std::thread tick_thread_;
+  // only ever added to, tasks keep raw pointers
+  std::mutex routines_mutex_;
+  // the queue is cache line aligned, so allocated with AlignedNew
+  std::unordered_map<std::string,
+                     std::unique_ptr<TimerFireRoutine,
+                                     AlignedDeleter<TimerFireRoutine>>>
+      fire_routines_;
+  TimerFireRoutine* default_routine_ = nullptr;
 
   DECLARE_SINGLETON(TimingWheel)
 };
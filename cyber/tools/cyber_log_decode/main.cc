@@ -0,0 +1,42 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "cyber/logger/binary_log.h"
+
+void DisplayUsage(const std::string& binary) {
+	std::cout << "usage: " << binary << " file [file...]\n"
+	<< "Print binary log files, written with cyber_binary_log=1, as text.\n"
+	<< std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::string binary = argv[0];
+	if (argc < 2 || std::string(argv[1]) == "-h") {
+		DisplayUsage(binary);
+		return -1;
+	}
+	int ret = 0;
+	for (int i = 1; i < argc; ++i) {
+		if (!apollo::cyber::logger::DecodeBinaryLog(argv[i], &std::cout)) {
+			std::cerr << "decode " << argv[i] << " failed." << std::endl;
+			ret = -1;
+		}
+	}
+	return ret;
+}
@@ -18,15 +18,41 @@
 
 #include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include "cyber/proto/role_attributes.pb.h"
 #include "cyber/proto/topology_change.pb.h"
 
 #include "cyber/message/message_traits.h"
+#include "cyber/record/record_message.h"
 #include "cyber/tools/cyber_monitor/general_channel_message.h"
 #include "cyber/tools/cyber_monitor/screen.h"
 
 constexpr int SecondColumnOffset = 4;
+constexpr int StatsColumnWidth = 12;
+
+namespace {
+
+std::string FormatBytes(double bytes) {
+  using apollo::cyber::record::kGB;
+  using apollo::cyber::record::kKB;
+  using apollo::cyber::record::kMB;
+  std::ostringstream out_str;
+  out_str << std::fixed << std::setprecision(1);
+  if (bytes >= kGB) {
+    out_str << bytes / kGB << "G";
+  } else if (bytes >= kMB) {
+    out_str << bytes / kMB << "M";
+  } else if (bytes >= kKB) {
+    out_str << bytes / kKB << "K";
+  } else {
+    out_str << std::setprecision(0) << bytes << "B";
+  }
+  return out_str.str();
+}
+
+}  // namespace
 
 CyberTopologyMessage::CyberTopologyMessage(const std::string& channel)
     : RenderableMessage(nullptr, 1),
@@ -58,9 +84,16 @@ RenderableMessage* CyberTopologyMessage::Child(int line_no) const {
   RenderableMessage* ret = nullptr;
   auto iter = FindChild(line_no);
   if (iter != all_channels_map_.cend() &&
-      !GeneralChannelMessage::IsErrorCode(iter->second) &&
-      iter->second->is_enabled()) {
-    ret = iter->second;
+      !GeneralChannelMessage::IsErrorCode(iter->second)) {
+    // channels are listed passively, a reader is only created to look inside
+    GeneralChannelMessage* child = iter->second;
+    if (!child->is_enabled() &&
+        !GeneralChannelMessage::IsErrorCode(child->OpenChannel(iter->first))) {
+      child->add_reader(child->NodeName());
+    }
+    if (child->is_enabled()) {
+      ret = child;
+    }
   }
   return ret;
 }
@@ -140,10 +173,8 @@ void CyberTopologyMessage::AddReaderWriter(const apollo::cyber::proto::RoleAttri
 		channel_msg = new GeneralChannelMessage(out_str.str(), this);
 
 		if (channel_msg != nullptr) {
-			if (!GeneralChannelMessage::IsErrorCode(channel_msg->OpenChannel(channel_name))) {
-				channel_msg->set_message_type(msgTypeName);
-				channel_msg->add_reader(channel_msg->NodeName());
-			}
+			channel_msg->set_channel_name(channel_name);
+			channel_msg->set_message_type(msgTypeName);
 		} else {
 			channel_msg = GeneralChannelMessage::CastErrorCode2Ptr(
 			GeneralChannelMessage::ErrorCode::NewSubClassFailed);
@@ -213,10 +244,15 @@ int CyberTopologyMessage::Render(const Screen* s, int key) {
       s->AddStr(col1_width_ + SecondColumnOffset, 0, Screen::WHITE_BLACK,
                 "TypeName");
       break;
-    case SecondColumnType::MessageFrameRatio:
-      s->AddStr(col1_width_ + SecondColumnOffset, 0, Screen::WHITE_BLACK,
-                "FrameRatio");
-      break;
+    case SecondColumnType::MessageFrameRatio: {
+      int x = col1_width_ + SecondColumnOffset;
+      s->AddStr(x, 0, Screen::WHITE_BLACK, "FrameRatio");
+      s->AddStr(x += StatsColumnWidth, 0, Screen::WHITE_BLACK, "Bandwidth");
+      s->AddStr(x += StatsColumnWidth, 0, Screen::WHITE_BLACK, "Drops/s");
+      s->AddStr(x += StatsColumnWidth, 0, Screen::WHITE_BLACK, "Dropped");
+      s->AddStr(x += StatsColumnWidth, 0, Screen::WHITE_BLACK, "ReaderLag");
+      s->AddStr(x += StatsColumnWidth, 0, Screen::WHITE_BLACK, "MaxSize");
+    } break;
   }
 
   auto iter = all_channels_map_.cbegin();
@@ -236,8 +272,9 @@ int CyberTopologyMessage::Render(const Screen* s, int key) {
     color = Screen::RED_BLACK;
 
     if (!GeneralChannelMessage::IsErrorCode(iter->second)) {
+      iter->second->UpdateStats();
       if (iter->second->has_message_come()) {
-        if (iter->second->is_enabled()) {
+        if (iter->second->is_enabled() || iter->second->has_stats()) {
           color = Screen::GREEN_BLACK;
         } else {
           color = Screen::YELLOW_BLACK;
@@ -255,11 +292,29 @@ int CyberTopologyMessage::Render(const Screen* s, int key) {
                     iter->second->message_type().c_str());
           break;
         case SecondColumnType::MessageFrameRatio: {
+          int x = col1_width_ + SecondColumnOffset;
           out_str.str("");
           out_str << std::fixed << std::setprecision(FrameRatio_Precision)
                   << iter->second->frame_ratio();
-          s->AddStr(col1_width_ + SecondColumnOffset, line,
-                    out_str.str().c_str());
+          s->AddStr(x, line, out_str.str().c_str());
+          // channels without a shared memory segment have no counters
+          if (!iter->second->has_stats()) {
+            break;
+          }
+          const auto& stats = iter->second->stats();
+          s->AddStr(x += StatsColumnWidth, line,
+                    (FormatBytes(iter->second->bandwidth()) + "/s").c_str());
+          out_str.str("");
+          out_str << std::fixed << std::setprecision(FrameRatio_Precision)
+                  << iter->second->drop_ratio();
+          s->AddStr(x += StatsColumnWidth, line, out_str.str().c_str());
+          s->AddStr(x += StatsColumnWidth, line,
+                    std::to_string(stats.overwritten).c_str());
+          s->AddStr(x += StatsColumnWidth, line,
+                    std::to_string(stats.reader_lag).c_str());
+          s->AddStr(x += StatsColumnWidth, line,
+                    FormatBytes(static_cast<double>(stats.max_msg_size))
+                        .c_str());
         } break;
       }
     } else {
@@ -21,7 +21,10 @@
 #include <string>
 #include <vector>
 
+#include "cyber/common/global_data.h"
+#include "cyber/event/latency_tracer.h"
 #include "cyber/record/record_message.h"
+#include "cyber/transport/shm/segment_factory.h"
 #include "cyber/tools/cyber_monitor/general_message.h"
 #include "cyber/tools/cyber_monitor/screen.h"
 
@@ -85,6 +88,9 @@ bool GeneralChannelMessage::IsErrorCode(void* ptr) {
 }
 
 double GeneralChannelMessage::frame_ratio(void) {
+  if (has_stats_) {
+    return frame_ratio_;
+  }
   if (!is_enabled() || !has_message_come()) {
     return 0.0;
   }
@@ -106,6 +112,40 @@ double GeneralChannelMessage::frame_ratio(void) {
   return frame_ratio_;
 }
 
+void GeneralChannelMessage::UpdateStats(void) {
+  auto time_now = apollo::cyber::Time::MonoTime();
+  if (has_stats_ &&
+      (time_now - stats_time_).ToNanosecond() < 1000000000) {
+    return;
+  }
+
+  apollo::cyber::transport::ChannelStats stats;
+  if (!apollo::cyber::transport::SegmentFactory::ReadStats(channel_id_,
+                                                            &stats)) {
+    has_stats_ = false;
+    return;
+  }
+
+  // counters restart from zero when the segment is recreated
+  if (has_stats_ && stats.messages >= stats_.messages) {
+    double seconds = (time_now - stats_time_).ToSecond();
+    frame_ratio_ = static_cast<double>(stats.messages - stats_.messages) / seconds;
+    bandwidth_ = static_cast<double>(stats.bytes - stats_.bytes) / seconds;
+    drop_ratio_ =
+        static_cast<double>(stats.overwritten - stats_.overwritten) / seconds;
+  } else {
+    frame_ratio_ = 0.0;
+    bandwidth_ = 0.0;
+    drop_ratio_ = 0.0;
+  }
+  if (stats.messages > 0) {
+    set_has_message_come(true);
+  }
+  stats_ = stats;
+  stats_time_ = time_now;
+  has_stats_ = true;
+}
+
 GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
     const std::string& channel_name) {
   if (channel_name.empty() || node_name_.empty()) {
@@ -115,6 +155,8 @@ GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
     return CastErrorCode2Ptr(ErrorCode::NoCloseChannel);
   }
 
+  set_channel_name(channel_name);
+
   channel_node_ = apollo::cyber::CreateNode(node_name_);
   if (channel_node_ == nullptr) {
     return CastErrorCode2Ptr(ErrorCode::CreateNodeFailed);
@@ -148,17 +190,23 @@ int GeneralChannelMessage::Render(const Screen* s, int key) {
       current_state_ = State::ShowInfo;
       break;
 
+    case 'l':
+    case 'L':
+      current_state_ = State::ShowLatency;
+      break;
+
     default: {
     }
   }
 
   clear();
+  UpdateStats();
 
   int line_no = 0;
 
   s->SetCurrentColor(Screen::WHITE_BLACK);
   s->AddStr(0, line_no++, "ChannelName: ");
-  s->AddStr(channel_reader_->GetChannelName().c_str());
+  s->AddStr(channel_name_.c_str());
 
   s->AddStr(0, line_no++, "MessageType: ");
   s->AddStr(message_type().c_str());
@@ -171,6 +219,9 @@ int GeneralChannelMessage::Render(const Screen* s, int key) {
       case State::ShowInfo:
         RenderInfo(s, key, &line_no);
         break;
+      case State::ShowLatency:
+        RenderLatency(s, &line_no);
+        break;
     }
   } else {
     s->AddStr(0, line_no++, "Channel has been closed");
@@ -223,6 +274,41 @@ void GeneralChannelMessage::RenderInfo(const Screen* s, int key, int* line_no) {
 	}
 }
 
+void GeneralChannelMessage::RenderLatency(const Screen* s, int* line_no) {
+	using apollo::cyber::event::LatencyHop;
+	using apollo::cyber::event::LatencyReport;
+	using apollo::cyber::event::LatencySnapshot;
+
+	const std::string& export_dir = apollo::cyber::common::GlobalData::Instance()
+										->Config().perf_conf().latency_conf().export_dir();
+	LatencyReport report;
+	apollo::cyber::event::LoadLatencyExports(export_dir, &report);
+	auto iter = report.find(GetChannelName());
+	if (iter == report.end()) {
+		s->AddStr(0, (*line_no)++, "No latency traced, enable perf_conf.latency_conf in the processes");
+		return;
+	}
+
+	std::ostringstream out_str;
+	out_str << std::left << std::setw(12) << "Hop" << std::right << std::setw(12) << "Count" << std::setw(12)
+			<< "Avg(us)" << std::setw(12) << "P50(us)" << std::setw(12) << "P99(us)" << std::setw(12) << "Max(us)";
+	s->AddStr(0, (*line_no)++, out_str.str().c_str());
+	for (int i = 0; i < static_cast<int>(LatencyHop::HOP_NUM); ++i) {
+		const LatencySnapshot& snapshot = iter->second.hops[i];
+		if (snapshot.count == 0) {
+			continue;
+		}
+		out_str.str("");
+		out_str << std::left << std::setw(12) << apollo::cyber::event::LatencyHopName(static_cast<LatencyHop>(i))
+				<< std::right << std::fixed << std::setprecision(1) << std::setw(12) << snapshot.count
+				<< std::setw(12) << static_cast<double>(snapshot.sum) / snapshot.count / 1000.0 << std::setw(12)
+				<< static_cast<double>(snapshot.Percentile(50)) / 1000.0 << std::setw(12)
+				<< static_cast<double>(snapshot.Percentile(99)) / 1000.0 << std::setw(12)
+				<< static_cast<double>(snapshot.max) / 1000.0;
+		s->AddStr(0, (*line_no)++, out_str.str().c_str());
+	}
+}
+
 void GeneralChannelMessage::RenderDebugString(const Screen* s, int key, int* line_no) {
 	if (has_message_come()) {
 		if (raw_msg_class_ == nullptr) {
@@ -22,8 +22,10 @@
 #include <string>
 #include <vector>
 
+#include "cyber/common/global_data.h"
 #include "cyber/cyber.h"
 #include "cyber/message/raw_message.h"
+#include "cyber/transport/shm/state.h"
 #include "cyber/tools/cyber_monitor/general_message_base.h"
 
 class CyberTopologyMessage;
@@ -62,9 +64,7 @@ class GeneralChannelMessage : public GeneralMessageBase {
     }
   }
 
-  std::string GetChannelName(void) const {
-    return channel_reader_->GetChannelName();
-  }
+  const std::string& GetChannelName(void) const { return channel_name_; }
 
   void set_message_type(const std::string& msgTypeName) {
     message_type_ = msgTypeName;
@@ -76,6 +76,16 @@ class GeneralChannelMessage : public GeneralMessageBase {
 
   double frame_ratio(void) override;
 
+  // Samples the shared memory counters of the channel, which needs no reader.
+  // Rates are refreshed at most once per second.
+  void UpdateStats(void);
+  bool has_stats(void) const { return has_stats_; }
+  const apollo::cyber::transport::ChannelStats& stats(void) const {
+    return stats_;
+  }
+  double bandwidth(void) const { return bandwidth_; }
+  double drop_ratio(void) const { return drop_ratio_; }
+
   const std::string& NodeName(void) const { return node_name_; }
 
   void add_reader(const std::string& reader) { DoAdd(&readers_, reader); }
@@ -108,6 +118,8 @@ class GeneralChannelMessage : public GeneralMessageBase {
         current_state_(State::ShowDebugString),
         has_message_come_(false),
         message_type_(),
+        channel_name_(),
+        channel_id_(0),
         frame_counter_(0),
         last_time_(apollo::cyber::Time::MonoTime()),
         msg_time_(last_time_.ToNanosecond() + 1),
@@ -165,18 +177,32 @@ class GeneralChannelMessage : public GeneralMessageBase {
 
   void RenderDebugString(const Screen* s, int key, int* line_no);
   void RenderInfo(const Screen* s, int key, int* line_no);
+  void RenderLatency(const Screen* s, int* line_no);
 
   void set_has_message_come(bool b) { has_message_come_ = b; }
+  void set_channel_name(const std::string& channel_name) {
+    channel_name_ = channel_name;
+    channel_id_ =
+        apollo::cyber::common::GlobalData::RegisterChannel(channel_name);
+  }
 
-  enum class State { ShowDebugString, ShowInfo } current_state_;
+  enum class State { ShowDebugString, ShowInfo, ShowLatency } current_state_;
 
   bool has_message_come_;
   std::string message_type_;
+  std::string channel_name_;
+  uint64_t channel_id_;
   std::atomic<int> frame_counter_;
   apollo::cyber::Time last_time_;
   apollo::cyber::Time msg_time_;
   apollo::cyber::Time time_last_calc_ = apollo::cyber::Time::MonoTime();
 
+  bool has_stats_ = false;
+  apollo::cyber::transport::ChannelStats stats_;
+  apollo::cyber::Time stats_time_;
+  double bandwidth_ = 0.0;
+  double drop_ratio_ = 0.0;
+
   std::unique_ptr<apollo::cyber::Node> channel_node_;
 
   std::string node_name_;
@@ -61,14 +61,15 @@ const char Screen::InteractiveCmdStr[] =
     "   s | S -- the same with Down Arrow key\n"
     "\n"
     "Commands for Topology message:\n"
-    "   f | F -- show frame ratio for all channel messages\n"
+    "   f | F -- show frame ratio, bandwidth and drops for all channels\n"
     "   t | T -- show channel message type\n"
     "\n"
-    "   Space -- Enable|Disable channel Message\n"
+    "   Space -- Enable|Disable the reader of channel Message\n"
     "\n"
     "Commands for Channel:\n"
     "   i | I -- show Reader and Writers of Channel\n"
     "   b | B -- show Debug String of Channel Message\n"
+    "   l | L -- show traced latency of Channel Message per hop\n"
     "\n"
     "Commands for Channel Repeated Datum:\n"
     "   n | N -- next repeated data item\n"
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "cyber/event/perf_event_file.h"
+
+void DisplayUsage(const std::string& binary) {
+	std::cout << "usage: " << binary << " perf_file [trace.json]\n"
+	<< "Convert a cyber_perf_*.data file to the Chrome trace event format,\n"
+	<< "for chrome://tracing or ui.perfetto.dev. Writes to stdout without\n"
+	<< "an output file.\n"
+	<< std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::string binary = argv[0];
+	if (argc < 2 || argc > 3 || std::string(argv[1]) == "-h") {
+		DisplayUsage(binary);
+		return -1;
+	}
+	apollo::cyber::event::PerfFileContent content;
+	if (!apollo::cyber::event::ReadPerfFile(argv[1], &content)) {
+		std::cerr << "read " << argv[1] << " failed." << std::endl;
+		return -1;
+	}
+	if (content.lost > 0) {
+		std::cerr << content.lost << " events were lost while recording." << std::endl;
+	}
+	if (argc == 2) {
+		apollo::cyber::event::WriteChromeTrace(content, &std::cout);
+		return 0;
+	}
+	std::ofstream out(argv[2], std::ios::trunc);
+	if (!out) {
+		std::cerr << "open " << argv[2] << " failed." << std::endl;
+		return -1;
+	}
+	apollo::cyber::event::WriteChromeTrace(content, &out);
+	std::cout << content.events.size() << " events written to " << argv[2] << std::endl;
+	return 0;
+}
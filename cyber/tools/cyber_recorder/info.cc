@@ -16,6 +16,10 @@
 
 #include "cyber/tools/cyber_recorder/info.h"
 
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
 #include "cyber/record/record_message.h"
 
 namespace apollo {
@@ -89,12 +93,43 @@ bool Info::Display(const std::string& file) {
   std::cout << std::setw(w) << "channel_number: " << hdr.channel_number()
             << std::endl;
 
+  // messages lost while recording
+  if (hdr.dropped_number() > 0) {
+    std::cout << std::setw(w) << "dropped_number: " << hdr.dropped_number()
+              << std::endl;
+  }
+
   // read index section
   if (!file_reader.ReadIndex()) {
     AERROR << "read index section of the file fail. file: " << file;
     return false;
   }
 
+  // per-channel size and rate, only available with a time index
+  std::unordered_map<std::string, std::pair<uint64_t, double>> channel_stats;
+  if (hdr.time_index_position() > 0 && file_reader.ReadTimeIndex()) {
+    const proto::TimeIndex& time_index = file_reader.GetTimeIndex();
+    for (int i = 0; i < time_index.channels_size(); ++i) {
+      const auto& channel_index = time_index.channels(i);
+      uint64_t bytes = 0;
+      for (int j = 0; j < channel_index.size_size(); ++j) {
+        bytes += channel_index.size(j);
+      }
+      double rate = 0.0;
+      int num = channel_index.time_size();
+      if (num > 1) {
+        auto range = std::minmax_element(channel_index.time().begin(),
+                                         channel_index.time().end());
+        uint64_t span_ns = *range.second - *range.first;
+        if (span_ns > 0) {
+          rate = static_cast<double>(num - 1) * 1e9 /
+                 static_cast<double>(span_ns);
+        }
+      }
+      channel_stats[channel_index.name()] = std::make_pair(bytes, rate);
+    }
+  }
+
   // channel info
   std::cout << std::setw(w) << "channel_info: " << std::endl;
   proto::Index idx = file_reader.GetIndex();
@@ -108,6 +143,19 @@ bool Info::Display(const std::string& file) {
       std::cout << std::setw(8) << cache->message_number();
       std::cout << std::setw(0) << " messages: ";
       std::cout << cache->message_type();
+      auto stats = channel_stats.find(cache->name());
+      if (stats != channel_stats.end()) {
+        auto flags = std::cout.flags();
+        auto precision = std::cout.precision();
+        std::cout << std::fixed << std::setprecision(2) << ", "
+                  << static_cast<double>(stats->second.first) / kKB << " KB, "
+                  << stats->second.second << " Hz";
+        std::cout.flags(flags);
+        std::cout.precision(precision);
+      }
+      if (cache->dropped_number() > 0) {
+        std::cout << ", " << cache->dropped_number() << " dropped";
+      }
       std::cout << std::endl;
     }
   }
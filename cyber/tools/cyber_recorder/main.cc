@@ -40,9 +40,10 @@ using apollo::cyber::record::PlayParam;
 using apollo::cyber::record::Recorder;
 using apollo::cyber::record::Recoverer;
 using apollo::cyber::record::Spliter;
+using apollo::cyber::record::StagingPolicy;
 
 const char INFO_OPTIONS[] = "h";
-const char RECORD_OPTIONS[] = "o:ac:k:i:m:h";
+const char RECORD_OPTIONS[] = "o:ac:k:i:m:xn:q:y:g:h";
 const char PLAY_OPTIONS[] = "f:ac:k:lr:b:e:s:d:p:h";
 const char SPLIT_OPTIONS[] = "f:o:c:k:b:e:h";
 const char RECOVER_OPTIONS[] = "f:o:h";
@@ -131,6 +132,21 @@ void DisplayUsage(const std::string& binary, const std::string& command, const s
 		case 'm':
 		std::cout << "\t-m, --segment-size <MB>\t\t\t" << command << " segmented every n megabyte(s)" << std::endl;
 		break;
+		case 'x':
+		std::cout << "\t-x, --time-index\t\t\t" << command << " with a per-channel time index" << std::endl;
+		break;
+		case 'n':
+		std::cout << "\t-n, --checkpoint <chunks>\t\t" << command << " with an index checkpoint every n chunk(s), unreadable by older tools" << std::endl;
+		break;
+		case 'q':
+		std::cout << "\t-q, --queue-size <1000>\t\t\tstaged messages per channel before the policy applies" << std::endl;
+		break;
+		case 'y':
+		std::cout << "\t-y, --queue-policy <block>\t\tblock, drop-newest or drop-oldest when a channel queue is full" << std::endl;
+		break;
+		case 'g':
+		std::cout << "\t-g, --priority-channel <name>\t\twrite the specified channel first when the disk falls behind" << std::endl;
+		break;
 		case 'h':
 		std::cout << "\t-h, --help\t\t\t\tshow help message" << std::endl;
 		break;
@@ -156,7 +172,7 @@ int main(int argc, char** argv) {
 	}
 
 	int long_index = 0;
-	const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:h";
+	const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:xn:q:y:g:h";
 	static const struct option long_opts[] = {
 		{"files", required_argument, nullptr, 'f'},
 		{"white-channel", required_argument, nullptr, 'c'},
@@ -172,6 +188,11 @@ int main(int argc, char** argv) {
 		{"preload", required_argument, nullptr, 'p'},
 		{"segment-interval", required_argument, nullptr, 'i'},
 		{"segment-size", required_argument, nullptr, 'm'},
+		{"time-index", no_argument, nullptr, 'x'},
+		{"checkpoint", required_argument, nullptr, 'n'},
+		{"queue-size", required_argument, nullptr, 'q'},
+		{"queue-policy", required_argument, nullptr, 'y'},
+		{"priority-channel", required_argument, nullptr, 'g'},
 		{"help", no_argument, nullptr, 'h'}
 	};
 
@@ -188,6 +209,9 @@ int main(int argc, char** argv) {
 	uint64_t opt_delay = 0;
 	uint32_t opt_preload = 3;
 	auto opt_header = HeaderBuilder::GetHeader();
+	uint32_t opt_queue_size = 1000;
+	StagingPolicy opt_queue_policy = StagingPolicy::BLOCK;
+	std::vector<std::string> opt_priority_channels;
 
 	do {
 		int opt = getopt_long(argc, argv, short_opts.c_str(), long_opts, &long_index);
@@ -332,6 +356,64 @@ int main(int argc, char** argv) {
 		return -1;
 		}
 		break;
+		case 'x':
+		opt_header.set_time_index(true);
+		break;
+		case 'n':
+		try {
+		int chunk_number = std::stoi(optarg);
+		if (chunk_number < 0) {
+		std::cout << "Argument is less than zero: -n/--checkpoint "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		}
+		opt_header.set_checkpoint_chunk_number(static_cast<uint64_t>(chunk_number));
+		} catch (std::invalid_argument& ia) {
+		std::cout << "Invalid argument: -n/--checkpoint "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		} catch (const std::out_of_range& e) {
+		std::cout << "Argument is out of range: -n/--checkpoint "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		}
+		break;
+		case 'q':
+		try {
+		int queue_size = std::stoi(optarg);
+		if (queue_size <= 0) {
+		std::cout << "Argument should be greater than zero: -q/--queue-size "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		}
+		opt_queue_size = static_cast<uint32_t>(queue_size);
+		} catch (std::invalid_argument& ia) {
+		std::cout << "Invalid argument: -q/--queue-size "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		} catch (const std::out_of_range& e) {
+		std::cout << "Argument is out of range: -q/--queue-size "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		}
+		break;
+		case 'y':
+		if (!apollo::cyber::record::ParseStagingPolicy(optarg, &opt_queue_policy)) {
+		std::cout << "Invalid argument: -y/--queue-policy "
+		<< std::string(optarg) << std::endl;
+		return -1;
+		}
+		break;
+		case 'g':
+		opt_priority_channels.emplace_back(std::string(optarg));
+		for (int i = optind; i < argc; i++) {
+		if (*argv[i] != '-') {
+		opt_priority_channels.emplace_back(std::string(argv[i]));
+		} else {
+		break;
+		}
+		}
+		break;
 		case 'h':
 		DisplayUsage(binary, command);
 		return 0;
@@ -407,6 +489,7 @@ int main(int argc, char** argv) {
 		auto recorder = std::make_shared<Recorder>(opt_output_vec[0], opt_all,
 		opt_white_channels,
 		opt_black_channels, opt_header);
+		recorder->SetStaging(opt_queue_size, opt_queue_policy, opt_priority_channels);
 		bool record_result = recorder->Start();
 		if (record_result) {
 			while (!::apollo::cyber::IsShutdown()) {
@@ -16,49 +16,46 @@
 
 #include "cyber/tools/cyber_recorder/player/play_task_buffer.h"
 
-#include <utility>
+#include "cyber/common/log.h"
 
 namespace apollo {
 namespace cyber {
 namespace record {
 
-PlayTaskBuffer::PlayTaskBuffer() {}
+const uint64_t PlayTaskBuffer::kDefaultCapacity = 1UL << 16;
 
-PlayTaskBuffer::~PlayTaskBuffer() { tasks_.clear(); }
-
-size_t PlayTaskBuffer::Size() const {
-  std::lock_guard<std::mutex> lck(mutex_);
-  return tasks_.size();
+PlayTaskBuffer::PlayTaskBuffer(uint64_t capacity) {
+  if (!tasks_.Init(capacity)) {
+    AERROR << "invalid task buffer capacity: " << capacity
+           << ", we will use default value: " << kDefaultCapacity;
+    tasks_.Init(kDefaultCapacity);
+  }
 }
 
-bool PlayTaskBuffer::Empty() const {
-  std::lock_guard<std::mutex> lck(mutex_);
-  return tasks_.empty();
-}
+PlayTaskBuffer::~PlayTaskBuffer() {}
+
+size_t PlayTaskBuffer::Size() const { return tasks_.Size(); }
 
-void PlayTaskBuffer::Push(const TaskPtr& task) {
+bool PlayTaskBuffer::Empty() const { return tasks_.Empty(); }
+
+size_t PlayTaskBuffer::Capacity() const { return tasks_.Capacity(); }
+
+bool PlayTaskBuffer::Push(const TaskPtr& task) {
   if (task == nullptr) {
-    return;
+    return true;
   }
-  std::lock_guard<std::mutex> lck(mutex_);
-  tasks_.insert(std::make_pair(task->msg_play_time_ns(), task));
+  return tasks_.Enqueue(task);
 }
 
 PlayTaskBuffer::TaskPtr PlayTaskBuffer::Front() {
-  std::lock_guard<std::mutex> lck(mutex_);
-  if (tasks_.empty()) {
+  auto front = tasks_.Front();
+  if (front == nullptr) {
     return nullptr;
   }
-  auto res = tasks_.begin()->second;
-  return res;
+  return *front;
 }
 
-void PlayTaskBuffer::PopFront() {
-  std::lock_guard<std::mutex> lck(mutex_);
-  if (!tasks_.empty()) {
-    tasks_.erase(tasks_.begin());
-  }
-}
+void PlayTaskBuffer::PopFront() { tasks_.PopFront(); }
 
 }  // namespace record
 }  // namespace cyber
@@ -18,35 +18,39 @@
 #define CYBER_TOOLS_CYBER_RECORDER_PLAYER_PLAY_TASK_BUFFER_H_
 
 #include <cstdint>
-#include <map>
 #include <memory>
-#include <mutex>
 
+#include "cyber/base/spsc_queue.h"
 #include "cyber/tools/cyber_recorder/player/play_task.h"
 
 namespace apollo {
 namespace cyber {
 namespace record {
 
+// Tasks come out of RecordViewer already ordered by play time, so the buffer
+// is a plain FIFO shared by exactly one producer and one consumer thread.
 class PlayTaskBuffer {
 public:
-using TaskPtr = std::shared_ptr<PlayTask>;
-// if all tasks are in order, we can use other container to replace this
-using TaskMap = std::multimap<uint64_t, TaskPtr>;
+	using TaskPtr = std::shared_ptr<PlayTask>;
+	using TaskQueue = base::SpscQueue<TaskPtr>;
 
-PlayTaskBuffer();
-virtual ~PlayTaskBuffer();
+	explicit PlayTaskBuffer(uint64_t capacity = kDefaultCapacity);
+	virtual ~PlayTaskBuffer();
 
-size_t Size() const;
-bool Empty() const;
+	size_t Size() const;
+	bool Empty() const;
+	size_t Capacity() const;
 
-void Push(const TaskPtr& task);
-TaskPtr Front();
-void PopFront();
+	// producer side, returns false when the ring is full
+	bool Push(const TaskPtr& task);
+	// consumer side
+	TaskPtr Front();
+	void PopFront();
+
+	static const uint64_t kDefaultCapacity;
 
 private:
-TaskMap tasks_;
-mutable std::mutex mutex_;
+	TaskQueue tasks_;
 };
 
 }  // namespace record
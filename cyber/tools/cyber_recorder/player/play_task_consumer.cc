@@ -16,6 +16,11 @@
 
 #include "cyber/tools/cyber_recorder/player/play_task_consumer.h"
 
+#include <time.h>
+
+#include <algorithm>
+
+#include "cyber/base/macros.h"
 #include "cyber/common/log.h"
 #include "cyber/time/time.h"
 
@@ -25,6 +30,9 @@ namespace record {
 
 const uint64_t PlayTaskConsumer::kPauseSleepNanoSec = 100000000UL;
 const uint64_t PlayTaskConsumer::kWaitProduceSleepNanoSec = 5000000UL;
+const uint64_t PlayTaskConsumer::kSpinTailNanoSec = 50000UL;
+const uint64_t PlayTimingStats::kLateThresholdNanoSec = 1000000UL;
+const uint32_t PlayTaskConsumer::kMaxBatchSize = 64;
 const uint64_t PlayTaskConsumer::MIN_SLEEP_DURATION_NS = 200000000UL;
 
 PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer, double play_rate)
@@ -36,7 +44,8 @@ PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer, double play
 	is_playonce_(false),
 	base_msg_play_time_ns_(0),
 	base_msg_real_time_ns_(0),
-	last_played_msg_real_time_ns_(0) 
+	last_played_msg_real_time_ns_(0),
+	accumulated_pause_time_ns_(0)
 {
 	if (play_rate_ <= 0) {
 		AERROR << "invalid play rate: " << play_rate_ << " , we will use default value(1.0).";
@@ -64,9 +73,70 @@ void PlayTaskConsumer::Stop() {
 	}
 }
 
+void PlayTimingStats::Add(uint64_t error_ns) {
+	++played_num;
+	total_error_ns += error_ns;
+	if (error_ns > max_error_ns) {
+		max_error_ns = error_ns;
+	}
+	if (error_ns > kLateThresholdNanoSec) {
+		++late_num;
+	}
+	int bucket = error_ns == 0 ? 0 : 64 - __builtin_clzll(error_ns);
+	histogram[std::min(bucket, 63)] += 1;
+}
+
+uint64_t PlayTimingStats::Percentile(double ratio) const {
+	if (played_num == 0) {
+		return 0;
+	}
+	uint64_t target = static_cast<uint64_t>(static_cast<double>(played_num) * ratio);
+	uint64_t count = 0;
+	for (int i = 0; i < 64; ++i) {
+		count += histogram[i];
+		if (count > target) {
+			// upper bound of the bucket
+			return i == 0 ? 0 : std::min((1ULL << i) - 1, static_cast<unsigned long long>(max_error_ns));
+		}
+	}
+	return max_error_ns;
+}
+
+double PlayTimingStats::MeanErrorNs() const {
+	if (played_num == 0) {
+		return 0.0;
+	}
+	return static_cast<double>(total_error_ns) / static_cast<double>(played_num);
+}
+
+bool PlayTaskConsumer::WaitUntil(uint64_t deadline_mono_ns) {
+	// sleep on an absolute deadline so that wakeup latency does not accumulate,
+	// in bounded slices to stay responsive to Stop()
+	while (!is_stopped_.load()) {
+		uint64_t now_ns = Time::MonoTime().ToNanosecond();
+		if (now_ns + kSpinTailNanoSec >= deadline_mono_ns) {
+			break;
+		}
+		uint64_t wake_ns = std::min(deadline_mono_ns - kSpinTailNanoSec, now_ns + MIN_SLEEP_DURATION_NS);
+		struct timespec ts;
+		ts.tv_sec = static_cast<time_t>(wake_ns / 1000000000UL);
+		ts.tv_nsec = static_cast<long>(wake_ns % 1000000000UL);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr);
+	}
+	// spin the last few microseconds, the scheduler can not wake us that precisely
+	while (!is_stopped_.load() && Time::MonoTime().ToNanosecond() < deadline_mono_ns) {
+		cpu_relax();
+	}
+	return !is_stopped_.load();
+}
+
+uint64_t PlayTaskConsumer::TaskDeadline(const PlayTaskBuffer::TaskPtr& task, uint64_t base_real_time_ns) const {
+	uint64_t task_interval_ns = static_cast<uint64_t>(static_cast<double>(task->msg_play_time_ns() - base_msg_play_time_ns_) / play_rate_);
+	return base_real_time_ns + accumulated_pause_time_ns_ + task_interval_ns;
+}
+
 void PlayTaskConsumer::ThreadFunc() {
 	uint64_t base_real_time_ns = 0;
-	uint64_t accumulated_pause_time_ns = 0;
 
 	while (!is_stopped_.load()) {
 		auto task = task_buffer_->Front();
@@ -75,48 +145,53 @@ void PlayTaskConsumer::ThreadFunc() {
 			continue;
 		}
 
-		uint64_t sleep_ns = 0;
-
 		if (base_msg_play_time_ns_ == 0) {
 			base_msg_play_time_ns_ = task->msg_play_time_ns();
 			base_msg_real_time_ns_ = task->msg_real_time_ns();
+			base_real_time_ns = Time::MonoTime().ToNanosecond();
 			if (base_msg_play_time_ns_ > begin_time_ns_) {
-				sleep_ns = static_cast<uint64_t>(static_cast<double>(base_msg_play_time_ns_ - begin_time_ns_) /play_rate_);
-				while (sleep_ns > MIN_SLEEP_DURATION_NS && !is_stopped_.load()) {
-					std::this_thread::sleep_for(std::chrono::nanoseconds(MIN_SLEEP_DURATION_NS));
-					sleep_ns -= MIN_SLEEP_DURATION_NS;
-				}
-
-				if (is_stopped_.load()) {
-					break;
-				}
-
-				std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
+				base_real_time_ns += static_cast<uint64_t>(static_cast<double>(base_msg_play_time_ns_ - begin_time_ns_) / play_rate_);
 			}
-			base_real_time_ns = Time::Now().ToNanosecond();
 			ADEBUG << "base_msg_play_time_ns: " << base_msg_play_time_ns_ << "base_real_time_ns: " << base_real_time_ns;
 		}
 
-		uint64_t task_interval_ns = static_cast<uint64_t>(static_cast<double>(task->msg_play_time_ns() - base_msg_play_time_ns_) /play_rate_);
-		uint64_t real_time_interval_ns = Time::Now().ToNanosecond() -
-		base_real_time_ns - accumulated_pause_time_ns;
-		if (task_interval_ns > real_time_interval_ns) {
-			sleep_ns = task_interval_ns - real_time_interval_ns;
-			std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
+		uint64_t deadline_ns = TaskDeadline(task, base_real_time_ns);
+		if (!WaitUntil(deadline_ns)) {
+			break;
 		}
 
-		task->Play();
+		// play every task that is already due back to back, stepping while
+		// paused always plays exactly one message
+		uint32_t batch_size = is_paused_.load() ? 1 : kMaxBatchSize;
+		uint64_t now_ns = Time::MonoTime().ToNanosecond();
+		for (uint32_t i = 0; i < batch_size; ++i) {
+			timing_stats_.Add(now_ns > deadline_ns ? now_ns - deadline_ns : 0);
+			task->Play();
+			last_played_msg_real_time_ns_ = task->msg_real_time_ns();
+			task_buffer_->PopFront();
+
+			task = task_buffer_->Front();
+			if (task == nullptr) {
+				break;
+			}
+			deadline_ns = TaskDeadline(task, base_real_time_ns);
+			now_ns = Time::MonoTime().ToNanosecond();
+			if (deadline_ns > now_ns) {
+				break;
+			}
+		}
 		is_playonce_.store(false);
 
-		last_played_msg_real_time_ns_ = task->msg_real_time_ns();
-		while (is_paused_.load() && !is_stopped_.load()) {
-			if (is_playonce_.load()) {
-				break;
+		if (is_paused_.load() && !is_stopped_.load()) {
+			uint64_t pause_begin_ns = Time::MonoTime().ToNanosecond();
+			while (is_paused_.load() && !is_stopped_.load()) {
+				if (is_playonce_.load()) {
+					break;
+				}
+				std::this_thread::sleep_for(std::chrono::nanoseconds(kPauseSleepNanoSec));
 			}
-			std::this_thread::sleep_for(std::chrono::nanoseconds(kPauseSleepNanoSec));
-			accumulated_pause_time_ns += kPauseSleepNanoSec;
+			accumulated_pause_time_ns_ += Time::MonoTime().ToNanosecond() - pause_begin_ns;
 		}
-		task_buffer_->PopFront();
 	}
 }
 
@@ -28,6 +28,22 @@ namespace apollo {
 namespace cyber {
 namespace record {
 
+// Deviation of the actual write time from the scheduled deadline.
+struct PlayTimingStats {
+	uint64_t played_num = 0;
+	uint64_t late_num = 0;
+	uint64_t total_error_ns = 0;
+	uint64_t max_error_ns = 0;
+	// bucket i counts errors in [2^(i-1), 2^i) ns, bucket 0 counts zero errors
+	uint64_t histogram[64] = {0};
+
+	void Add(uint64_t error_ns);
+	uint64_t Percentile(double ratio) const;
+	double MeanErrorNs() const;
+
+	static const uint64_t kLateThresholdNanoSec;
+};
+
 class PlayTaskConsumer {
 public:
 	using ThreadPtr = std::unique_ptr<std::thread>;
@@ -47,9 +63,14 @@ public:
 	uint64_t last_played_msg_real_time_ns() const {
 		return last_played_msg_real_time_ns_;
 	}
+	// only stable after Stop() has joined the consume thread
+	const PlayTimingStats& timing_stats() const { return timing_stats_; }
 
 private:
 	void ThreadFunc();
+	// returns false if stopped before the deadline is reached
+	bool WaitUntil(uint64_t deadline_mono_ns);
+	uint64_t TaskDeadline(const PlayTaskBuffer::TaskPtr& task, uint64_t base_real_time_ns) const;
 
 	double play_rate_;
 	ThreadPtr consume_th_;
@@ -61,8 +82,12 @@ private:
 	uint64_t base_msg_play_time_ns_;
 	uint64_t base_msg_real_time_ns_;
 	uint64_t last_played_msg_real_time_ns_;
+	uint64_t accumulated_pause_time_ns_;
+	PlayTimingStats timing_stats_;
 	static const uint64_t kPauseSleepNanoSec;
 	static const uint64_t kWaitProduceSleepNanoSec;
+	static const uint64_t kSpinTailNanoSec;
+	static const uint32_t kMaxBatchSize;
 	static const uint64_t MIN_SLEEP_DURATION_NS;
 };
 
@@ -16,6 +16,7 @@
 
 #include "cyber/tools/cyber_recorder/player/play_task_producer.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -32,6 +33,7 @@ namespace record {
 const uint32_t PlayTaskProducer::kMinTaskBufferSize = 500;
 const uint32_t PlayTaskProducer::kPreloadTimeSec = 3;
 const uint64_t PlayTaskProducer::kSleepIntervalNanoSec = 1000000;
+const uint64_t PlayTaskProducer::kMinSleepIntervalNanoSec = 100000;
 
 PlayTaskProducer::PlayTaskProducer(const TaskBufferPtr& task_buffer, const PlayParam& play_param)
 	: play_param_(play_param),
@@ -221,6 +223,8 @@ void PlayTaskProducer::ThreadFunc() {
 	if (total_msg_num_ > 0) {
 		avg_interval_time_ns = loop_time_ns / total_msg_num_;
 	}
+	// dense records average to next to nothing, do not spin on a full buffer
+	const auto wait_time = std::chrono::nanoseconds(std::max(avg_interval_time_ns, kMinSleepIntervalNanoSec));
 
 	double avg_freq_hz = static_cast<double>(total_msg_num_) / (static_cast<double>(loop_time_ns) * 1e-9);
 	uint32_t preload_size = (uint32_t)avg_freq_hz * play_param_.preload_time_s;
@@ -228,6 +232,10 @@ void PlayTaskProducer::ThreadFunc() {
 	if (preload_size < kMinTaskBufferSize) {
 		preload_size = kMinTaskBufferSize;
 	}
+	if (preload_size >= task_buffer_->Capacity()) {
+		preload_size = static_cast<uint32_t>(task_buffer_->Capacity() - 1);
+		AINFO << "preload_size is limited by task buffer capacity: " << preload_size;
+	}
 
 	auto record_viewer = std::make_shared<RecordViewer>(record_readers_, play_param_.begin_time_ns, play_param_.end_time_ns,
 		play_param_.channels_to_play);
@@ -240,7 +248,7 @@ void PlayTaskProducer::ThreadFunc() {
 
 		while (itr != itr_end && !is_stopped_.load()) {
 			while (!is_stopped_.load() && task_buffer_->Size() > preload_size) {
-				std::this_thread::sleep_for(std::chrono::nanoseconds(avg_interval_time_ns));
+				std::this_thread::sleep_for(wait_time);
 			}
 			for (; itr != itr_end && !is_stopped_.load(); ++itr) {
 				if (task_buffer_->Size() > preload_size) {
@@ -254,7 +262,9 @@ void PlayTaskProducer::ThreadFunc() {
 
 				auto raw_msg = std::make_shared<message::RawMessage>(itr->content);
 				auto task = std::make_shared<PlayTask>(raw_msg, search->second, itr->time, itr->time + plus_time_ns);
-				task_buffer_->Push(task);
+				while (!task_buffer_->Push(task) && !is_stopped_.load()) {
+					std::this_thread::sleep_for(wait_time);
+				}
 			}
 		}
 
@@ -84,6 +84,7 @@ private:
 	static const uint32_t kMinTaskBufferSize;
 	static const uint32_t kPreloadTimeSec;
 	static const uint64_t kSleepIntervalNanoSec;
+	static const uint64_t kMinSleepIntervalNanoSec;
 };
 
 }  // namespace record
@@ -167,6 +167,19 @@ bool Player::Start() {
 	}
 
 	std::cout << "\nplay finished." << std::endl;
+	// join the consume thread so that the timing statistics are final
+	consumer_->Stop();
+	{
+		auto& stats = consumer_->timing_stats();
+		std::cout << std::setprecision(3)
+			<< "timing error, played: " << stats.played_num
+			<< ", mean: " << stats.MeanErrorNs() / 1e3 << " us"
+			<< ", p50: " << static_cast<double>(stats.Percentile(0.5)) / 1e3 << " us"
+			<< ", p99: " << static_cast<double>(stats.Percentile(0.99)) / 1e3 << " us"
+			<< ", max: " << static_cast<double>(stats.max_error_ns) / 1e3 << " us"
+			<< ", late(>" << PlayTimingStats::kLateThresholdNanoSec / 1000000 << "ms): "
+			<< stats.late_num << std::endl;
+	}
 	std::cout.flags(before);
 	return true;
 }
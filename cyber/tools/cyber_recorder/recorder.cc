@@ -58,6 +58,22 @@ bool Recorder::Start() {
 		return false;
 	}
 
+	// reader callbacks only stage messages, serialization and disk writes
+	// happen on the stager thread
+	auto writer = writer_;
+	stager_.reset(new MessageStager(
+	[writer](const std::string& channel_name, const std::shared_ptr<RawMessage>& message, uint64_t time) {
+		return writer->WriteMessage(channel_name, message, time);
+	},
+	queue_size_, policy_));
+	stager_->SetDropCallback([writer](const std::string& channel_name, uint64_t count) {
+		writer->AddDroppedNumber(channel_name, count);
+	});
+	for (const auto& channel_name : priority_channels_) {
+		stager_->AddChannel(channel_name, 1);
+	}
+	stager_->Start();
+
 	std::string node_name = "cyber_recorder_record_" + std::to_string(getpid());
 	node_ = ::apollo::cyber::CreateNode(node_name);
 	if (node_ == nullptr) {
@@ -90,6 +106,13 @@ bool Recorder::Stop() {
 		AERROR << " _free_readers error.";
 		return false;
 	}
+	stager_->Stop();
+	for (const auto& item : channel_reader_map_) {
+		uint64_t dropped = stager_->GetDroppedNumber(item.first);
+		if (dropped > 0) {
+			AWARN << "dropped " << dropped << " messages of channel: " << item.first;
+		}
+	}
 	writer_->Close();
 	node_.reset();
 	if (display_thread_ && display_thread_->joinable()) {
@@ -101,6 +124,13 @@ bool Recorder::Stop() {
 	return true;
 }
 
+void Recorder::SetStaging(uint32_t queue_size, StagingPolicy policy,
+	const std::vector<std::string>& priority_channels) {
+	queue_size_ = queue_size;
+	policy_ = policy;
+	priority_channels_ = priority_channels;
+}
+
 void Recorder::TopologyCallback(const ChangeMsg& change_message) {
 	ADEBUG << "ChangeMsg in Topology Callback:" << std::endl
 		<< change_message.ShortDebugString();
@@ -212,8 +242,8 @@ void Recorder::ReaderCallback(const std::shared_ptr<RawMessage>& message, const
 	}
 
 	message_time_ = Time::Now().ToNanosecond();
-	if (!writer_->WriteMessage(channel_name, message, message_time_)) {
-		AERROR << "write data fail, channel: " << channel_name;
+	if (!stager_->Stage(channel_name, message, message_time_)) {
+		ADEBUG << "staging queue full, drop message of channel: " << channel_name;
 		return;
 	}
 
@@ -225,7 +255,7 @@ void Recorder::ShowProgress() {
 		std::cout << "\r[RUNNING]  Record Time: " << std::setprecision(3)
 			<< message_time_ / 1000000000
 			<< "    Progress: " << channel_reader_map_.size() << " channels, "
-			<< message_count_ << " messages";
+			<< message_count_ << " messages, " << stager_->GetDroppedNumber() << " dropped";
 		std::cout.flush();
 		std::this_thread::sleep_for(std::chrono::milliseconds(100));
 	}
@@ -28,6 +28,7 @@
 #include "cyber/message/raw_message.h"
 #include "cyber/proto/record.pb.h"
 #include "cyber/proto/topology_change.pb.h"
+#include "cyber/record/message_stager.h"
 #include "cyber/record/record_writer.h"
 
 using apollo::cyber::Node;
@@ -56,12 +57,20 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
   ~Recorder();
   bool Start();
   bool Stop();
+  // must be called before Start(), messages of priority channels are written
+  // first when the disk falls behind
+  void SetStaging(uint32_t queue_size, StagingPolicy policy,
+                  const std::vector<std::string>& priority_channels);
 
  private:
   bool is_started_ = false;
   bool is_stopping_ = false;
   std::shared_ptr<Node> node_ = nullptr;
   std::shared_ptr<RecordWriter> writer_ = nullptr;
+  std::unique_ptr<MessageStager> stager_ = nullptr;
+  uint32_t queue_size_ = 1000;
+  StagingPolicy policy_ = StagingPolicy::BLOCK;
+  std::vector<std::string> priority_channels_;
   std::shared_ptr<std::thread> display_thread_ = nullptr;
   Connection<const ChangeMsg&> change_conn_;
   std::string output_;
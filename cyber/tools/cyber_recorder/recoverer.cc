@@ -16,6 +16,10 @@
 
 #include "cyber/tools/cyber_recorder/recoverer.h"
 
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+
 #include "cyber/base/for_each.h"
 #include "cyber/record/header_builder.h"
 
@@ -38,6 +42,11 @@ bool Recoverer::Proc() {
     AERROR << "open input file failed, file: " << input_file_;
     return false;
   }
+  const Header& header = reader_.GetHeader();
+  if (!header.is_complete() && header.checkpoint_position() > 0 &&
+      reader_.ReadIndex()) {
+    return ProcByCheckpoint();
+  }
 
   // open output file
   proto::Header new_hdr = HeaderBuilder::GetHeader();
@@ -83,6 +92,10 @@ bool Recoverer::Proc() {
       break;
     }
     switch (section.type) {
+      case SectionType::SECTION_INDEX_CHECKPOINT: {
+        reader_.SkipSection(section.size);
+        break;
+      }
       case SectionType::SECTION_CHANNEL: {
         Channel chan;
         if (!reader_.ReadSection<Channel>(section.size, &chan)) {
@@ -128,6 +141,52 @@ bool Recoverer::Proc() {
   return true;
 }  // end for Proc()
 
+bool Recoverer::ProcByCheckpoint() {
+  uint64_t length = reader_.valid_end_position();
+  if (output_file_ != input_file_ && !CopyPrefix(length)) {
+    AERROR << "copy input file failed, file: " << input_file_;
+    return false;
+  }
+  if (!writer_.Finalize(output_file_, reader_.GetHeader(), reader_.GetIndex(),
+                        length)) {
+    AERROR << "write index to output file failed. file: " << output_file_;
+    return false;
+  }
+  AINFO << "recover record file done by checkpoint, chunk number: "
+        << reader_.GetHeader().chunk_number()
+        << ", message number: " << reader_.GetHeader().message_number();
+  return true;
+}
+
+bool Recoverer::CopyPrefix(uint64_t length) {
+  int in_fd = open(input_file_.c_str(), O_RDONLY);
+  if (in_fd < 0) {
+    AERROR << "open input file failed, file: " << input_file_
+           << ", errno: " << errno;
+    return false;
+  }
+  int out_fd = open(output_file_.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
+                    S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  if (out_fd < 0) {
+    AERROR << "open output file failed, file: " << output_file_
+           << ", errno: " << errno;
+    close(in_fd);
+    return false;
+  }
+  // no decoding needed, let the kernel move the bytes
+  off_t offset = 0;
+  while (static_cast<uint64_t>(offset) < length) {
+    ssize_t count = sendfile(out_fd, in_fd, &offset, length - offset);
+    if (count <= 0) {
+      AERROR << "sendfile failed, offset: " << offset << ", errno: " << errno;
+      break;
+    }
+  }
+  close(in_fd);
+  close(out_fd);
+  return static_cast<uint64_t>(offset) == length;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -43,6 +43,11 @@ class Recoverer {
   bool Proc();
 
  private:
+  // rebuild the index from the last checkpoint, copy the intact prefix
+  // verbatim (nothing to copy when recovering in place) and add the trailer
+  bool ProcByCheckpoint();
+  bool CopyPrefix(uint64_t length);
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
@@ -68,6 +68,7 @@ bool Spliter::Proc() {
 
   // open output file
   Header new_hdr = HeaderBuilder::GetHeader();
+  new_hdr.set_time_index(header.time_index());
   if (!writer_.Open(output_file_)) {
     AERROR << "open output file failed. file: " << output_file_;
     return false;
@@ -77,6 +78,11 @@ bool Spliter::Proc() {
     return false;
   }
 
+  if (!white_channels_.empty() && header.time_index_position() > 0 &&
+      reader_.ReadIndex() && reader_.ReadTimeIndex()) {
+    return ProcByTimeIndex();
+  }
+
   // read through record file
   bool skip_next_chunk_body(false);
   reader_.Reset();
@@ -90,6 +96,10 @@ bool Spliter::Proc() {
       break;
     }
     switch (section.type) {
+      case SectionType::SECTION_INDEX_CHECKPOINT: {
+        reader_.SkipSection(section.size);
+        break;
+      }
       case SectionType::SECTION_CHANNEL: {
         Channel chan;
         if (!reader_.ReadSection<Channel>(section.size, &chan)) {
@@ -162,6 +172,78 @@ bool Spliter::Proc() {
   return true;
 }  // end for Proc()
 
+bool Spliter::IsWanted(const std::string& channel_name) const {
+  if (!white_channels_.empty() &&
+      std::find(white_channels_.begin(), white_channels_.end(),
+                channel_name) == white_channels_.end()) {
+    return false;
+  }
+  return std::find(black_channels_.begin(), black_channels_.end(),
+                   channel_name) == black_channels_.end();
+}
+
+bool Spliter::ProcByTimeIndex() {
+  const proto::Index& index = reader_.GetIndex();
+  for (int i = 0; i < index.indexes_size(); ++i) {
+    const auto& single_idx = index.indexes(i);
+    if (single_idx.type() != SectionType::SECTION_CHANNEL ||
+        !single_idx.has_channel_cache() ||
+        !IsWanted(single_idx.channel_cache().name())) {
+      continue;
+    }
+    Channel chan;
+    chan.set_name(single_idx.channel_cache().name());
+    chan.set_message_type(single_idx.channel_cache().message_type());
+    chan.set_proto_desc(single_idx.channel_cache().proto_desc());
+    writer_.WriteChannel(chan);
+  }
+
+  struct Location {
+    uint32_t chunk;
+    uint64_t offset;
+    uint32_t size;
+  };
+  std::vector<Location> locations;
+  const proto::TimeIndex& time_index = reader_.GetTimeIndex();
+  for (int i = 0; i < time_index.channels_size(); ++i) {
+    const auto& channel_index = time_index.channels(i);
+    if (!IsWanted(channel_index.name())) {
+      continue;
+    }
+    for (int j = 0; j < channel_index.time_size(); ++j) {
+      if (channel_index.time(j) < begin_time_ ||
+          channel_index.time(j) > end_time_) {
+        continue;
+      }
+      locations.push_back(
+          {channel_index.chunk(j), channel_index.offset(j),
+           channel_index.size(j)});
+    }
+  }
+  // keep the original message order, which also keeps the reads sequential
+  std::sort(locations.begin(), locations.end(),
+            [](const Location& a, const Location& b) {
+              return a.chunk < b.chunk ||
+                     (a.chunk == b.chunk && a.offset < b.offset);
+            });
+
+  proto::SingleMessage message;
+  for (const auto& location : locations) {
+    if (!reader_.ReadIndexedMessage(location.chunk, location.offset,
+                                    location.size, &message)) {
+      AERROR << "read indexed message fail.";
+      return false;
+    }
+    if (!writer_.WriteMessage(message)) {
+      AERROR << "add new message failed.";
+      return false;
+    }
+  }
+  AINFO << "split record file done by time index, message number: "
+        << locations.size();
+  return true;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
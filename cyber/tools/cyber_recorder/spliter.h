@@ -49,6 +49,10 @@ class Spliter {
   bool Proc();
 
  private:
+  bool IsWanted(const std::string& channel_name) const;
+  // extract white listed channels by seeks only, needs a time index
+  bool ProcByTimeIndex();
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
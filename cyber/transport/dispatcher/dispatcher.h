@@ -73,8 +73,9 @@ public:
 
 protected:
 	std::atomic<bool> is_shutdown_;
-	// key: channel_id of message
+	// key: channel_id of message, a channel is dropped with its last listener
 	AtomicHashMap<uint64_t, ListenerHandlerBasePtr> msg_listeners_;
+	// serializes adding and removing listeners, readers copy the handler
 	base::AtomicRWLock rw_lock_;
 };
 
@@ -85,6 +86,7 @@ void Dispatcher::AddListener(const RoleAttributes& self_attr, const MessageListe
 	}
 	uint64_t channel_id = self_attr.channel_id();
 
+	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
 	std::shared_ptr<ListenerHandler<MessageT>> handler;
 	ListenerHandlerBasePtr* handler_base = nullptr;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
@@ -111,6 +113,7 @@ void Dispatcher::AddListener(const RoleAttributes& self_attr, const RoleAttribut
 	}
 	uint64_t channel_id = self_attr.channel_id();
 
+	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
 	std::shared_ptr<ListenerHandler<MessageT>> handler;
 	ListenerHandlerBasePtr* handler_base = nullptr;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
@@ -137,9 +140,13 @@ void Dispatcher::RemoveListener(const RoleAttributes& self_attr) {
 	}
 	uint64_t channel_id = self_attr.channel_id();
 
+	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
 	ListenerHandlerBasePtr* handler_base = nullptr;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
 		(*handler_base)->Disconnect(self_attr.id());
+		if ((*handler_base)->IsEmpty()) {
+			msg_listeners_.Remove(channel_id);
+		}
 	}
 }
 
@@ -150,9 +157,13 @@ void Dispatcher::RemoveListener(const RoleAttributes& self_attr, const RoleAttri
 	}
 	uint64_t channel_id = self_attr.channel_id();
 
+	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
 	ListenerHandlerBasePtr* handler_base = nullptr;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
 		(*handler_base)->Disconnect(self_attr.id(), opposite_attr.id());
+		if ((*handler_base)->IsEmpty()) {
+			msg_listeners_.Remove(channel_id);
+		}
 	}
 }
 
@@ -276,6 +276,7 @@ class IntraDispatcher : public Dispatcher {
   DECLARE_SINGLETON(IntraDispatcher)
 
  private:
+  // with rw_lock_ held, creates the handler of a new channel
   template <typename MessageT>
   std::shared_ptr<ListenerHandler<MessageT>> GetHandler(uint64_t channel_id);
 
@@ -289,12 +290,13 @@ void IntraDispatcher::OnMessage(uint64_t channel_id,
   if (is_shutdown_.load()) {
     return;
   }
-  ListenerHandlerBasePtr* handler_base = nullptr;
+  // a copy, the entry goes away with the last listener of the channel
+  ListenerHandlerBasePtr handler_base;
   ADEBUG << "intra on message, channel:"
          << common::GlobalData::GetChannelById(channel_id);
   if (msg_listeners_.Get(channel_id, &handler_base)) {
     auto handler =
-        std::dynamic_pointer_cast<ListenerHandler<MessageT>>(*handler_base);
+        std::dynamic_pointer_cast<ListenerHandler<MessageT>>(handler_base);
     if (handler) {
       handler->Run(message, message_info);
     } else {
@@ -308,7 +310,7 @@ void IntraDispatcher::OnMessage(uint64_t channel_id,
       msg.resize(msg_size);
       if (message::SerializeToHC(*message, const_cast<char*>(msg.data()),
                                  msg_size)) {
-        (*handler_base)->RunFromString(msg, message_info);
+        handler_base->RunFromString(msg, message_info);
       } else {
         AERROR << "Failed to serialize message. channel["
                << common::GlobalData::GetChannelById(channel_id) << "]";
@@ -356,6 +358,7 @@ void IntraDispatcher::AddListener(const RoleAttributes& self_attr,
   bool created =
       chain_->AddListener(self_id, channel_id, message_type, listener);
 
+  WriteLockGuard<base::AtomicRWLock> lg(rw_lock_);
   auto handler = GetHandler<MessageT>(self_attr.channel_id());
   if (handler && created) {
     auto listener_wrapper = [this, self_id, channel_id, message_type](
@@ -384,6 +387,7 @@ void IntraDispatcher::AddListener(const RoleAttributes& self_attr,
   bool created =
       chain_->AddListener(self_id, oppo_id, channel_id, message_type, listener);
 
+  WriteLockGuard<base::AtomicRWLock> lg(rw_lock_);
   auto handler = GetHandler<MessageT>(self_attr.channel_id());
   if (handler && created) {
     auto listener_wrapper = [this, self_id, oppo_id, channel_id, message_type](
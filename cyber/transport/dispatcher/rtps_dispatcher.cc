@@ -70,9 +70,10 @@ void RtpsDispatcher::OnMessage(uint64_t channel_id, const std::shared_ptr<std::s
 		return;
 	}
 
-	ListenerHandlerBasePtr* handler_base = nullptr;
+	// a copy, the entry goes away with the last listener of the channel
+	ListenerHandlerBasePtr handler_base;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
-		auto handler = std::dynamic_pointer_cast<ListenerHandler<std::string>>(*handler_base);
+		auto handler = std::dynamic_pointer_cast<ListenerHandler<std::string>>(handler_base);
 		handler->Run(msg_str, msg_info);
 	}
 }
@@ -25,6 +25,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/event/latency_tracer.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
 #include "cyber/transport/rtps/attributes_filler.h"
@@ -75,10 +76,15 @@ private:
 
 template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr, const MessageListener<MessageT>& listener) {
-	auto listener_adapter = [listener](const std::shared_ptr<std::string>& msg_str,const MessageInfo& msg_info) 
+	uint64_t channel_id = self_attr.channel_id();
+	auto listener_adapter = [listener, channel_id](const std::shared_ptr<std::string>& msg_str,const MessageInfo& msg_info) 
 							{
 								auto msg = std::make_shared<MessageT>();
 								RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
+								if (msg_info.arrive_time() != 0) {
+									event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::PARSE,
+																msg_info.arrive_time(), event::LatencyTracer::Now());
+								}
 								listener(msg, msg_info);
 							};
 
@@ -89,9 +95,14 @@ void RtpsDispatcher::AddListener(const RoleAttributes& self_attr, const MessageL
 template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr, const RoleAttributes& opposite_attr, const MessageListener<MessageT>& listener)
 {
-	auto listener_adapter = [listener](const std::shared_ptr<std::string>& msg_str, const MessageInfo& msg_info) {
+	uint64_t channel_id = self_attr.channel_id();
+	auto listener_adapter = [listener, channel_id](const std::shared_ptr<std::string>& msg_str, const MessageInfo& msg_info) {
 							auto msg = std::make_shared<MessageT>();
 							RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
+							if (msg_info.arrive_time() != 0) {
+								event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::PARSE,
+															msg_info.arrive_time(), event::LatencyTracer::Now());
+							}
 							listener(msg, msg_info);
 							};
 
@@ -15,6 +15,7 @@
  *****************************************************************************/
 
 #include "cyber/transport/dispatcher/shm_dispatcher.h"
+#include "cyber/base/magazine_pool.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/util.h"
 #include "cyber/scheduler/scheduler_factory.h"
@@ -58,7 +59,7 @@ void ShmDispatcher::AddSegment(const RoleAttributes& self_attr) {
 
 void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
 	ADEBUG << "Reading sharedmem message: " << GlobalData::GetChannelById(channel_id) << " from block: " << block_index;
-	auto rb = std::make_shared<ReadableBlock>();
+	auto rb = std::allocate_shared<ReadableBlock>(base::PoolAllocator<ReadableBlock>());
 	rb->index = block_index;
 	if (!segments_[channel_id]->AcquireBlockToRead(rb.get())) {
 		AWARN << "fail to acquire block, channel: " << GlobalData::GetChannelById(channel_id) << " index: " << block_index;
@@ -69,6 +70,11 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
 	const char* msg_info_addr = reinterpret_cast<char*>(rb->buf) + rb->block->msg_size();
 
 	if (msg_info.DeserializeFrom(msg_info_addr, rb->block->msg_info_size())) {
+		if (msg_info.send_time() != 0 && event::LatencyTracer::Instance()->enabled()) {
+			msg_info.set_arrive_time(event::LatencyTracer::Now());
+			event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::TRANSPORT,
+												msg_info.serialize_time(), msg_info.arrive_time());
+		}
 		OnMessage(channel_id, rb, msg_info);
 	} else {
 		AERROR << "error msg info of channel:" << GlobalData::GetChannelById(channel_id);
@@ -80,12 +86,13 @@ void ShmDispatcher::OnMessage(uint64_t channel_id, const std::shared_ptr<Readabl
 	if (is_shutdown_.load()) {
 		return;
 	}
-	ListenerHandlerBasePtr* handler_base = nullptr;
+	// a copy, the entry goes away with the last listener of the channel
+	ListenerHandlerBasePtr handler_base;
 	if (msg_listeners_.Get(channel_id, &handler_base)) {
-		auto handler = std::dynamic_pointer_cast<ListenerHandler<ReadableBlock>>(*handler_base);
+		auto handler = std::dynamic_pointer_cast<ListenerHandler<ReadableBlock>>(handler_base);
 		handler->Run(rb, msg_info);
 	} else {
-		AERROR << "Cannot find " << GlobalData::GetChannelById(channel_id)<< "'s handler.";
+		ADEBUG << "Cannot find " << GlobalData::GetChannelById(channel_id)<< "'s handler.";
 	}
 }
 
@@ -27,6 +27,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/event/latency_tracer.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
 #include "cyber/transport/shm/notifier_factory.h"
@@ -77,9 +78,14 @@ private:
 template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr, const MessageListener<MessageT>& listener) {
 	// FIXME: make it more clean
-	auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) {
+	uint64_t channel_id = self_attr.channel_id();
+	auto listener_adapter = [listener, channel_id](const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) {
 		auto msg = std::make_shared<MessageT>();
 		RETURN_IF(!message::ParseFromArray(rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
+		if (msg_info.arrive_time() != 0) {
+			event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::PARSE, msg_info.arrive_time(),
+												event::LatencyTracer::Now());
+		}
 		listener(msg, msg_info);
 	};
 
@@ -90,10 +96,15 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr, const MessageLi
 template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr, const RoleAttributes& opposite_attr, const MessageListener<MessageT>& listener) {
 	// FIXME: make it more clean
-	auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) 
+	uint64_t channel_id = self_attr.channel_id();
+	auto listener_adapter = [listener, channel_id](const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) 
 	{
 		auto msg = std::make_shared<MessageT>();
 		RETURN_IF(!message::ParseFromArray(rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
+		if (msg_info.arrive_time() != 0) {
+			event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::PARSE, msg_info.arrive_time(),
+												event::LatencyTracer::Now());
+		}
 		listener(msg, msg_info);
 	};
 
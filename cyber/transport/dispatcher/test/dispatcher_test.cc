@@ -130,6 +130,39 @@ TEST_F(DispatcherTest, has_channel) {
   EXPECT_FALSE(dispatcher_.HasChannel(common::Hash("has_channel")));
 }
 
+TEST_F(DispatcherTest, remove_last_listener) {
+  RoleAttributes self_attr;
+  self_attr.set_channel_name("remove_last_listener");
+  self_attr.set_channel_id(common::Hash("remove_last_listener"));
+  Identity self_id;
+  self_attr.set_id(self_id.HashValue());
+
+  RoleAttributes oppo_attr(self_attr);
+  Identity oppo_id;
+  oppo_attr.set_id(oppo_id.HashValue());
+
+  dispatcher_.AddListener<proto::Chatter>(
+      self_attr,
+      [](const std::shared_ptr<proto::Chatter>&, const MessageInfo&) {});
+  dispatcher_.AddListener<proto::Chatter>(
+      self_attr, oppo_attr,
+      [](const std::shared_ptr<proto::Chatter>&, const MessageInfo&) {});
+  EXPECT_TRUE(dispatcher_.HasChannel(self_attr.channel_id()));
+
+  dispatcher_.RemoveListener<proto::Chatter>(self_attr);
+  EXPECT_TRUE(dispatcher_.HasChannel(self_attr.channel_id()));
+  dispatcher_.RemoveListener<proto::Chatter>(self_attr, oppo_attr);
+  EXPECT_FALSE(dispatcher_.HasChannel(self_attr.channel_id()));
+
+  // a channel dropped this way can be listened to again
+  dispatcher_.AddListener<proto::Chatter>(
+      self_attr,
+      [](const std::shared_ptr<proto::Chatter>&, const MessageInfo&) {});
+  EXPECT_TRUE(dispatcher_.HasChannel(self_attr.channel_id()));
+  dispatcher_.RemoveListener<proto::Chatter>(self_attr);
+  EXPECT_FALSE(dispatcher_.HasChannel(self_attr.channel_id()));
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
@@ -17,12 +17,17 @@
 #ifndef CYBER_TRANSPORT_MESSAGE_LISTENER_HANDLER_H_
 #define CYBER_TRANSPORT_MESSAGE_LISTENER_HANDLER_H_
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
+#include "cyber/base/epoch_reclaimer.h"
 #include "cyber/base/signal.h"
 #include "cyber/common/log.h"
 #include "cyber/message/message_traits.h"
@@ -47,6 +52,8 @@ public:
 
 	virtual void Disconnect(uint64_t self_id) = 0;
 	virtual void Disconnect(uint64_t self_id, uint64_t oppo_id) = 0;
+	// true once every listener has been disconnected
+	virtual bool IsEmpty() = 0;
 	inline bool IsRawMessage() const { return is_raw_message_; }
 	virtual void RunFromString(const std::string& str, const MessageInfo& msg_info) = 0;
 
@@ -65,30 +72,36 @@ public:
 	using ConnectionMap = std::unordered_map<uint64_t, MessageConnection>;
 
 	ListenerHandler() {}
-	virtual ~ListenerHandler() {}
+	virtual ~ListenerHandler() { delete signals_.load(std::memory_order_acquire); }
 
 	void Connect(uint64_t self_id, const Listener& listener);
 	void Connect(uint64_t self_id, uint64_t oppo_id, const Listener& listener);
 
 	void Disconnect(uint64_t self_id) override;
 	void Disconnect(uint64_t self_id, uint64_t oppo_id) override;
+	bool IsEmpty() override;
 
 	void Run(const Message& msg, const MessageInfo& msg_info);
 	void RunFromString(const std::string& str, const MessageInfo& msg_info) override;
 
 private:
 	using SignalPtr = std::shared_ptr<MessageSignal>;
-	using MessageSignalMap = std::unordered_map<uint64_t, SignalPtr>;
+	// sorted by oppo_id, never modified once published
+	using MessageSignalMap = std::vector<std::pair<uint64_t, SignalPtr>>;
+
+	// with rw_lock_ held, replaces signals_ by signals
+	void Publish(MessageSignalMap* signals);
 
 	// used for self_id
 	MessageSignal signal_;
 	ConnectionMap signal_conns_;  // key: self_id
 
-	// used for self_id and oppo_id
-	MessageSignalMap signals_;  // key: oppo_id
+	// used for self_id and oppo_id, read by Run without locking
+	std::atomic<MessageSignalMap*> signals_ = {new MessageSignalMap()};
 	// key: oppo_id
 	std::unordered_map<uint64_t, ConnectionMap> signals_conns_;
 
+	// taken by Connect and Disconnect only
 	base::AtomicRWLock rw_lock_;
 };
 
@@ -111,20 +124,25 @@ void ListenerHandler<MessageT>::Connect(uint64_t self_id, const Listener& listen
 template <typename MessageT>
 void ListenerHandler<MessageT>::Connect(uint64_t self_id, uint64_t oppo_id,const Listener& listener) {
 	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-	if (signals_.find(oppo_id) == signals_.end()) {
-		signals_[oppo_id] = std::make_shared<MessageSignal>();
+	auto signals = signals_.load(std::memory_order_relaxed);
+	auto search = std::lower_bound(signals->begin(), signals->end(), oppo_id,
+		[](const std::pair<uint64_t, SignalPtr>& item, uint64_t id) { return item.first < id; });
+	SignalPtr signal;
+	if (search != signals->end() && search->first == oppo_id) {
+		signal = search->second;
+	} else {
+		signal = std::make_shared<MessageSignal>();
+		auto updated = new MessageSignalMap(*signals);
+		updated->emplace(updated->begin() + (search - signals->begin()), oppo_id, signal);
+		Publish(updated);
 	}
 
-	auto connection = signals_[oppo_id]->Connect(listener);
+	auto connection = signal->Connect(listener);
 	if (!connection.IsConnected()) {
 		AWARN << oppo_id << " " << self_id << " connect failed!";
 		return;
 	}
 
-	if (signals_conns_.find(oppo_id) == signals_conns_.end()) {
-		signals_conns_[oppo_id] = ConnectionMap();
-	}
-
 	signals_conns_[oppo_id][self_id] = connection;
 }
 
@@ -142,28 +160,63 @@ void ListenerHandler<MessageT>::Disconnect(uint64_t self_id) {
 template <typename MessageT>
 void ListenerHandler<MessageT>::Disconnect(uint64_t self_id, uint64_t oppo_id) {
 	WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-	if (signals_conns_.find(oppo_id) == signals_conns_.end()) {
+	auto conns = signals_conns_.find(oppo_id);
+	if (conns == signals_conns_.end()) {
 		return;
 	}
 
-	if (signals_conns_[oppo_id].find(self_id) == signals_conns_[oppo_id].end()) {
+	auto conn = conns->second.find(self_id);
+	if (conn == conns->second.end()) {
 		return;
 	}
 
-	signals_conns_[oppo_id][self_id].Disconnect();
-	signals_conns_[oppo_id].erase(self_id);
+	conn->second.Disconnect();
+	conns->second.erase(conn);
+	if (!conns->second.empty()) {
+		return;
+	}
+
+	// nobody listens to oppo_id any more
+	signals_conns_.erase(conns);
+	auto signals = signals_.load(std::memory_order_relaxed);
+	auto updated = new MessageSignalMap();
+	updated->reserve(signals->size());
+	for (auto& item : *signals) {
+		if (item.first != oppo_id) {
+			updated->emplace_back(item);
+		}
+	}
+	Publish(updated);
+}
+
+template <typename MessageT>
+bool ListenerHandler<MessageT>::IsEmpty() {
+	ReadLockGuard<AtomicRWLock> lock(rw_lock_);
+	return signal_conns_.empty() && signals_conns_.empty();
 }
 
 template <typename MessageT>
 void ListenerHandler<MessageT>::Run(const Message& msg, const MessageInfo& msg_info) {
 	signal_(msg, msg_info);
 	uint64_t oppo_id = msg_info.sender_id().HashValue();
-	ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-	if (signals_.find(oppo_id) == signals_.end()) {
+	base::EpochReclaimer::Guard guard;
+	auto signals = signals_.load(std::memory_order_acquire);
+	if (signals->empty()) {
 		return;
 	}
+	auto search = std::lower_bound(signals->begin(), signals->end(), oppo_id,
+		[](const std::pair<uint64_t, SignalPtr>& item, uint64_t id) { return item.first < id; });
+	if (search == signals->end() || search->first != oppo_id) {
+		return;
+	}
+
+	(*search->second)(msg, msg_info);
+}
 
-	(*signals_[oppo_id])(msg, msg_info);
+template <typename MessageT>
+void ListenerHandler<MessageT>::Publish(MessageSignalMap* signals) {
+	auto old_signals = signals_.exchange(signals, std::memory_order_acq_rel);
+	base::EpochReclaimer::Instance()->Retire(old_signals);
 }
 
 template <typename MessageT>
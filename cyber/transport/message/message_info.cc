@@ -25,6 +25,8 @@ namespace cyber {
 namespace transport {
 
 const std::size_t MessageInfo::kSize = 2 * ID_SIZE + sizeof(uint64_t);
+const std::size_t MessageInfo::kTraceSize = 2 * sizeof(uint64_t);
+const std::size_t MessageInfo::kDeadlineSize = sizeof(uint64_t);
 
 MessageInfo::MessageInfo() : sender_id_(false), spare_id_(false) {}
 
@@ -39,7 +41,11 @@ MessageInfo::MessageInfo(const MessageInfo& another)
     : sender_id_(another.sender_id_),
       channel_id_(another.channel_id_),
       seq_num_(another.seq_num_),
-      spare_id_(another.spare_id_) {}
+      spare_id_(another.spare_id_),
+      send_time_(another.send_time_),
+      serialize_time_(another.serialize_time_),
+      arrive_time_(another.arrive_time_),
+      deadline_(another.deadline_) {}
 
 MessageInfo::~MessageInfo() {}
 
@@ -49,6 +55,10 @@ MessageInfo& MessageInfo::operator=(const MessageInfo& another) {
     channel_id_ = another.channel_id_;
     seq_num_ = another.seq_num_;
     spare_id_ = another.spare_id_;
+    send_time_ = another.send_time_;
+    serialize_time_ = another.serialize_time_;
+    arrive_time_ = another.arrive_time_;
+    deadline_ = another.deadline_;
   }
   return *this;
 }
@@ -69,12 +79,25 @@ bool MessageInfo::SerializeTo(std::string* dst) const {
   dst->assign(sender_id_.data(), ID_SIZE);
   dst->append(reinterpret_cast<const char*>(&seq_num_), sizeof(seq_num_));
   dst->append(spare_id_.data(), ID_SIZE);
+  if (send_time_ != 0) {
+    dst->append(reinterpret_cast<const char*>(&send_time_), sizeof(send_time_));
+    dst->append(reinterpret_cast<const char*>(&serialize_time_),
+                sizeof(serialize_time_));
+  }
+  if (deadline_ != 0) {
+    dst->append(reinterpret_cast<const char*>(&deadline_), sizeof(deadline_));
+  }
 
   return true;
 }
 
+std::size_t MessageInfo::SerializedSize() const {
+  return kSize + (send_time_ == 0 ? 0 : kTraceSize) +
+         (deadline_ == 0 ? 0 : kDeadlineSize);
+}
+
 bool MessageInfo::SerializeTo(char* dst, std::size_t len) const {
-  if (dst == nullptr || len < kSize) {
+  if (dst == nullptr || len < SerializedSize()) {
     return false;
   }
 
@@ -84,6 +107,16 @@ bool MessageInfo::SerializeTo(char* dst, std::size_t len) const {
   std::memcpy(ptr, reinterpret_cast<const char*>(&seq_num_), sizeof(seq_num_));
   ptr += sizeof(seq_num_);
   std::memcpy(ptr, spare_id_.data(), ID_SIZE);
+  ptr += ID_SIZE;
+  if (send_time_ != 0) {
+    std::memcpy(ptr, &send_time_, sizeof(send_time_));
+    ptr += sizeof(send_time_);
+    std::memcpy(ptr, &serialize_time_, sizeof(serialize_time_));
+    ptr += sizeof(serialize_time_);
+  }
+  if (deadline_ != 0) {
+    std::memcpy(ptr, &deadline_, sizeof(deadline_));
+  }
 
   return true;
 }
@@ -94,7 +127,13 @@ bool MessageInfo::DeserializeFrom(const std::string& src) {
 
 bool MessageInfo::DeserializeFrom(const char* src, std::size_t len) {
   RETURN_VAL_IF_NULL(src, false);
-  if (len != kSize) {
+  // the trace and deadline sizes differ, so the length tells which of them
+  // follow
+  bool traced = len == kSize + kTraceSize ||
+                len == kSize + kTraceSize + kDeadlineSize;
+  bool has_deadline = len == kSize + kDeadlineSize ||
+                      len == kSize + kTraceSize + kDeadlineSize;
+  if (len != kSize && !traced && !has_deadline) {
     AWARN << "src size mismatch, given[" << len << "] target[" << kSize << "]";
     return false;
   }
@@ -105,6 +144,19 @@ bool MessageInfo::DeserializeFrom(const char* src, std::size_t len) {
   std::memcpy(reinterpret_cast<char*>(&seq_num_), ptr, sizeof(seq_num_));
   ptr += sizeof(seq_num_);
   spare_id_.set_data(ptr);
+  ptr += ID_SIZE;
+  send_time_ = 0;
+  serialize_time_ = 0;
+  deadline_ = 0;
+  if (traced) {
+    std::memcpy(&send_time_, ptr, sizeof(send_time_));
+    ptr += sizeof(send_time_);
+    std::memcpy(&serialize_time_, ptr, sizeof(serialize_time_));
+    ptr += sizeof(serialize_time_);
+  }
+  if (has_deadline) {
+    std::memcpy(&deadline_, ptr, sizeof(deadline_));
+  }
 
   return true;
 }
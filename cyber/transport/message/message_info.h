@@ -57,13 +57,40 @@ public:
 	const Identity& spare_id() const { return spare_id_; }
 	void set_spare_id(const Identity& spare_id) { spare_id_ = spare_id; }
 
+	// latency trace stamps in Time::Now() nanoseconds, 0 when not traced.
+	// send and serialize time travel with the message, arrive time is set
+	// by the dispatcher of the reading process.
+	uint64_t send_time() const { return send_time_; }
+	void set_send_time(uint64_t send_time) { send_time_ = send_time; }
+
+	uint64_t serialize_time() const { return serialize_time_; }
+	void set_serialize_time(uint64_t serialize_time) { serialize_time_ = serialize_time; }
+
+	uint64_t arrive_time() const { return arrive_time_; }
+	void set_arrive_time(uint64_t arrive_time) { arrive_time_ = arrive_time; }
+
+	// Time::Now() nanoseconds after which a service request is worthless,
+	// 0 when there is none. It travels with the message.
+	uint64_t deadline() const { return deadline_; }
+	void set_deadline(uint64_t deadline) { deadline_ = deadline; }
+
+	// kSize, plus kTraceSize for a traced message and kDeadlineSize for one
+	// with a deadline
+	std::size_t SerializedSize() const;
+
 	static const std::size_t kSize;
+	static const std::size_t kTraceSize;
+	static const std::size_t kDeadlineSize;
 
 private:
 	Identity sender_id_;
 	uint64_t channel_id_ = 0;
 	uint64_t seq_num_ = 0;
 	Identity spare_id_;
+	uint64_t send_time_ = 0;
+	uint64_t serialize_time_ = 0;
+	uint64_t arrive_time_ = 0;
+	uint64_t deadline_ = 0;
 };
 
 }  // namespace transport
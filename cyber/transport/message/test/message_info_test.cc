@@ -70,6 +70,75 @@ TEST(MessageInfoTest, test) {
   EXPECT_EQ(msgInfo3, msgInfo4);
 }
 
+TEST(MessageInfoTest, trace) {
+  Identity id;
+  MessageInfo info(id, 123);
+  EXPECT_EQ(MessageInfo::kSize, info.SerializedSize());
+
+  info.set_send_time(1000);
+  info.set_serialize_time(2000);
+  info.set_arrive_time(3000);
+  EXPECT_EQ(MessageInfo::kSize + MessageInfo::kTraceSize,
+            info.SerializedSize());
+
+  std::string str;
+  EXPECT_TRUE(info.SerializeTo(&str));
+  EXPECT_EQ(info.SerializedSize(), str.size());
+  std::string buf(info.SerializedSize(), '\0');
+  EXPECT_FALSE(info.SerializeTo(&buf[0], MessageInfo::kSize));
+  EXPECT_TRUE(info.SerializeTo(&buf[0], buf.size()));
+  EXPECT_EQ(str, buf);
+
+  MessageInfo traced;
+  EXPECT_TRUE(traced.DeserializeFrom(buf));
+  EXPECT_EQ(123, traced.seq_num());
+  EXPECT_EQ(1000, traced.send_time());
+  EXPECT_EQ(2000, traced.serialize_time());
+  // the arrive time belongs to the reading process
+  EXPECT_EQ(0, traced.arrive_time());
+
+  // an untraced message clears the stamps of a reused MessageInfo
+  MessageInfo plain(id, 456);
+  EXPECT_TRUE(plain.SerializeTo(&str));
+  EXPECT_TRUE(traced.DeserializeFrom(str));
+  EXPECT_EQ(456, traced.seq_num());
+  EXPECT_EQ(0, traced.send_time());
+  EXPECT_FALSE(traced.DeserializeFrom(buf.data(), buf.size() - 1));
+}
+
+TEST(MessageInfoTest, deadline) {
+  Identity id;
+  MessageInfo info(id, 123);
+  info.set_deadline(5000);
+  EXPECT_EQ(MessageInfo::kSize + MessageInfo::kDeadlineSize,
+            info.SerializedSize());
+
+  std::string str;
+  EXPECT_TRUE(info.SerializeTo(&str));
+  MessageInfo received;
+  EXPECT_TRUE(received.DeserializeFrom(str));
+  EXPECT_EQ(5000, received.deadline());
+  EXPECT_EQ(0, received.send_time());
+
+  // both trailers, the deadline comes last
+  info.set_send_time(1000);
+  info.set_serialize_time(2000);
+  EXPECT_EQ(MessageInfo::kSize + MessageInfo::kTraceSize +
+                MessageInfo::kDeadlineSize,
+            info.SerializedSize());
+  std::string buf(info.SerializedSize(), '\0');
+  EXPECT_TRUE(info.SerializeTo(&buf[0], buf.size()));
+  EXPECT_TRUE(received.DeserializeFrom(buf));
+  EXPECT_EQ(1000, received.send_time());
+  EXPECT_EQ(2000, received.serialize_time());
+  EXPECT_EQ(5000, received.deadline());
+
+  MessageInfo plain(id, 456);
+  EXPECT_TRUE(plain.SerializeTo(&str));
+  EXPECT_TRUE(received.DeserializeFrom(str));
+  EXPECT_EQ(0, received.deadline());
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
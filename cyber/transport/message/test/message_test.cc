@@ -179,6 +179,20 @@ TEST(ListenerHandlerTest, listener_handler_test) {
   listener_handler.Disconnect(self_id, opposite_id);
   listener_handler.Disconnect(self_id, opposite_id);
   listener_handler.Run(message, message_info);
+  EXPECT_EQ(2, call_count);
+
+  // listeners of one sender
+  uint64_t sender_hash = sender_id2.HashValue();
+  listener_handler.Connect(self_id, sender_hash, listener);
+  listener_handler.Connect(self_id + 1, sender_hash, listener);
+  listener_handler.Run(message, message_info);
+  EXPECT_EQ(4, call_count);
+  listener_handler.Disconnect(self_id, sender_hash);
+  listener_handler.Run(message, message_info);
+  EXPECT_EQ(5, call_count);
+  listener_handler.Disconnect(self_id + 1, sender_hash);
+  listener_handler.Run(message, message_info);
+  EXPECT_EQ(5, call_count);
 }
 
 }  // namespace transport
@@ -77,8 +77,15 @@ const QosProfile QosProfileConf::QOS_PROFILE_TF_STATIC = CreateQosProfile(
     QosReliabilityPolicy::RELIABILITY_RELIABLE,
     QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
 
+// late joiners get the last changes only, anything older reaches them through
+// QOS_PROFILE_TOPO_SNAPSHOT
 const QosProfile QosProfileConf::QOS_PROFILE_TOPO_CHANGE = CreateQosProfile(
-    QosHistoryPolicy::HISTORY_KEEP_ALL, 10, QOS_MPS_SYSTEM_DEFAULT,
+    QosHistoryPolicy::HISTORY_KEEP_LAST, 64, QOS_MPS_SYSTEM_DEFAULT,
+    QosReliabilityPolicy::RELIABILITY_RELIABLE,
+    QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
+
+const QosProfile QosProfileConf::QOS_PROFILE_TOPO_SNAPSHOT = CreateQosProfile(
+    QosHistoryPolicy::HISTORY_KEEP_LAST, 1, QOS_MPS_SYSTEM_DEFAULT,
     QosReliabilityPolicy::RELIABILITY_RELIABLE,
     QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
 
@@ -51,6 +51,7 @@ class QosProfileConf {
   static const QosProfile QOS_PROFILE_SYSTEM_DEFAULT;
   static const QosProfile QOS_PROFILE_TF_STATIC;
   static const QosProfile QOS_PROFILE_TOPO_CHANGE;
+  static const QosProfile QOS_PROFILE_TOPO_SNAPSHOT;
 };
 
 }  // namespace transport
@@ -18,6 +18,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
+#include "cyber/event/latency_tracer.h"
 
 namespace apollo {
 namespace cyber {
@@ -54,6 +55,19 @@ void SubListener::onNewDataMessage(eprosima::fastrtps::Subscriber* sub) {
 	uint64_t seq_num = ((int64_t)m_info.related_sample_identity.sequence_number().high) << 32 |
 						m_info.related_sample_identity.sequence_number().low;
 	msg_info_.set_seq_num(seq_num);
+	msg_info_.set_deadline(static_cast<uint64_t>(static_cast<uint32_t>(m.timestamp())) << 32 |
+						   static_cast<uint32_t>(m.seq()));
+
+	// the rtps source timestamp stands in for the send time of the writer
+	if (event::LatencyTracer::Instance()->enabled()) {
+		const auto& source = m_info.sourceTimestamp;
+		uint64_t send_time = static_cast<uint64_t>(source.seconds) * 1000000000ULL +
+							((static_cast<uint64_t>(source.fraction) * 1000000000ULL) >> 32);
+		msg_info_.set_send_time(send_time);
+		msg_info_.set_arrive_time(event::LatencyTracer::Now());
+		event::LatencyTracer::Instance()->Record(channel_id, event::LatencyHop::TRANSPORT, send_time,
+												msg_info_.arrive_time());
+	}
 
 	// fetch message string
 	std::shared_ptr<std::string> msg_str = std::make_shared<std::string>(m.data());
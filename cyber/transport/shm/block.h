@@ -53,6 +53,10 @@ private:
 
 	uint64_t msg_size_;
 	uint64_t msg_info_size_;
+
+	// sequence of the message held, and whether no reader has taken it yet
+	uint64_t msg_seq_ = 0;
+	std::atomic<bool> unread_ = {false};
 };
 
 }  // namespace transport
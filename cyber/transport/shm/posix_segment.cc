@@ -211,6 +211,24 @@ bool PosixSegment::OpenOnly() {
   return true;
 }
 
+bool PosixSegment::ReadStats(uint64_t channel_id, ChannelStats* stats) {
+  RETURN_VAL_IF_NULL(stats, false);
+  int fd = shm_open(std::to_string(channel_id).c_str(), O_RDONLY, 0644);
+  if (fd == -1) {
+    return false;
+  }
+
+  void* addr = mmap(nullptr, sizeof(State), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+
+  reinterpret_cast<const State*>(addr)->GetStats(stats);
+  munmap(addr, sizeof(State));
+  return true;
+}
+
 bool PosixSegment::Remove() {
   if (shm_unlink(shm_name_.c_str()) < 0) {
     AERROR << "shm_unlink failed: " << strerror(errno);
@@ -32,6 +32,9 @@ class PosixSegment : public Segment {
 
   static const char* Type() { return "posix"; }
 
+  // reads the counters of an existing segment without attaching to it
+  static bool ReadStats(uint64_t channel_id, ChannelStats* stats);
+
  private:
   void Reset() override;
   bool Remove() override;
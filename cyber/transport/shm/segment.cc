@@ -70,7 +70,10 @@ void Segment::ReleaseWrittenBlock(const WritableBlock& writable_block) {
 	if (index >= conf_.block_num()) {
 		return;
 	}
-	blocks_[index].ReleaseWriteLock();
+	Block& block = blocks_[index];
+	block.msg_seq_ = state_->AddWritten(block.msg_size());
+	block.unread_.store(true, std::memory_order_relaxed);
+	block.ReleaseWriteLock();
 }
 
 bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
@@ -99,6 +102,8 @@ bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
 	if (!blocks_[index].TryLockForRead()) {
 		return false;
 	}
+	blocks_[index].unread_.store(false, std::memory_order_relaxed);
+	state_->UpdateReaderLag(blocks_[index].msg_seq_);
 	readable_block->block = blocks_ + index;
 	readable_block->buf = block_buf_addrs_[index];
 	return true;
@@ -154,6 +159,10 @@ uint32_t Segment::GetNextWritableBlockIndex() {
 	while (1) {
 		uint32_t try_idx = state_->FetchAddSeq(1) % block_num;
 		if (blocks_[try_idx].TryLockForWrite()) {
+			// the previous message of this block never reached any reader
+			if (blocks_[try_idx].unread_.load(std::memory_order_relaxed)) {
+				state_->AddOverwritten();
+			}
 			return try_idx;
 		}
 	}
@@ -30,7 +30,9 @@ namespace transport {
 
 using apollo::cyber::common::GlobalData;
 
-auto SegmentFactory::CreateSegment(uint64_t channel_id) -> SegmentPtr {
+namespace {
+
+std::string SegmentType() {
 	std::string segment_type(XsiSegment::Type());
 	auto& shm_conf = GlobalData::Instance()->Config();
 	if (shm_conf.has_transport_conf() &&
@@ -39,7 +41,13 @@ auto SegmentFactory::CreateSegment(uint64_t channel_id) -> SegmentPtr {
 	{
 		segment_type = shm_conf.transport_conf().shm_conf().shm_type();
 	}
+	return segment_type;
+}
+
+}  // namespace
 
+auto SegmentFactory::CreateSegment(uint64_t channel_id) -> SegmentPtr {
+	std::string segment_type = SegmentType();
 	ADEBUG << "segment type: " << segment_type;
 
 	if (segment_type == PosixSegment::Type()) {
@@ -49,6 +57,13 @@ auto SegmentFactory::CreateSegment(uint64_t channel_id) -> SegmentPtr {
 	return std::make_shared<XsiSegment>(channel_id);
 }
 
+bool SegmentFactory::ReadStats(uint64_t channel_id, ChannelStats* stats) {
+	if (SegmentType() == PosixSegment::Type()) {
+		return PosixSegment::ReadStats(channel_id, stats);
+	}
+	return XsiSegment::ReadStats(channel_id, stats);
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
@@ -26,6 +26,9 @@ namespace transport {
 class SegmentFactory {
 public:
 	static SegmentPtr CreateSegment(uint64_t channel_id);
+
+	// passive read of the channel counters, false if the channel has no segment
+	static bool ReadStats(uint64_t channel_id, ChannelStats* stats);
 };
 
 }  // namespace transport
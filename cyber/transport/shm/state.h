@@ -26,6 +26,18 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
+// Per-channel traffic counters kept in the shared state of a segment, so that
+// tools can read them without subscribing to the channel.
+struct ChannelStats {
+	uint64_t messages = 0;
+	uint64_t bytes = 0;
+	uint64_t overwritten = 0;
+	uint64_t reader_lag = 0;
+	uint64_t max_reader_lag = 0;
+	uint64_t max_msg_size = 0;
+	uint32_t reference_counts = 0;
+};
+
 class State {
 public:
 	explicit State(const uint64_t& ceiling_msg_size);
@@ -52,11 +64,53 @@ public:
 	uint64_t ceiling_msg_size() { return ceiling_msg_size_.load(); }
 	uint32_t reference_counts() { return reference_count_.load(); }
 
+	// returns the sequence of the written message, starting from 1
+	uint64_t AddWritten(uint64_t msg_size) {
+		bytes_.fetch_add(msg_size, std::memory_order_relaxed);
+		uint64_t max_size = max_msg_size_.load(std::memory_order_relaxed);
+		while (msg_size > max_size &&
+				!max_msg_size_.compare_exchange_weak(max_size, msg_size, std::memory_order_relaxed)) {
+		}
+		return messages_.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	void AddOverwritten() { overwritten_.fetch_add(1, std::memory_order_relaxed); }
+
+	// lag is the number of messages written after the one being read
+	void UpdateReaderLag(uint64_t msg_seq) {
+		uint64_t messages = messages_.load(std::memory_order_relaxed);
+		uint64_t lag = messages > msg_seq ? messages - msg_seq : 0;
+		reader_lag_.store(lag, std::memory_order_relaxed);
+		uint64_t max_lag = max_reader_lag_.load(std::memory_order_relaxed);
+		while (lag > max_lag &&
+				!max_reader_lag_.compare_exchange_weak(max_lag, lag, std::memory_order_relaxed)) {
+		}
+	}
+
+	uint64_t messages() const { return messages_.load(std::memory_order_relaxed); }
+
+	void GetStats(ChannelStats* stats) const {
+		stats->messages = messages_.load(std::memory_order_relaxed);
+		stats->bytes = bytes_.load(std::memory_order_relaxed);
+		stats->overwritten = overwritten_.load(std::memory_order_relaxed);
+		stats->reader_lag = reader_lag_.load(std::memory_order_relaxed);
+		stats->max_reader_lag = max_reader_lag_.load(std::memory_order_relaxed);
+		stats->max_msg_size = max_msg_size_.load(std::memory_order_relaxed);
+		stats->reference_counts = reference_count_.load(std::memory_order_relaxed);
+	}
+
 private:
 	std::atomic<bool> need_remap_ = {false};
 	std::atomic<uint32_t> seq_ = {0};
 	std::atomic<uint32_t> reference_count_ = {0};
 	std::atomic<uint64_t> ceiling_msg_size_;
+
+	std::atomic<uint64_t> messages_ = {0};
+	std::atomic<uint64_t> bytes_ = {0};
+	std::atomic<uint64_t> overwritten_ = {0};
+	std::atomic<uint64_t> reader_lag_ = {0};
+	std::atomic<uint64_t> max_reader_lag_ = {0};
+	std::atomic<uint64_t> max_msg_size_ = {0};
 };
 
 }  // namespace transport
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/shm/segment.h"
+
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "cyber/transport/shm/posix_segment.h"
+#include "cyber/transport/shm/xsi_segment.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+void WriteMessage(Segment* segment, uint64_t msg_size, uint32_t* index) {
+  WritableBlock wb;
+  ASSERT_TRUE(segment->AcquireBlockToWrite(msg_size, &wb));
+  wb.block->set_msg_size(msg_size);
+  wb.block->set_msg_info_size(0);
+  segment->ReleaseWrittenBlock(wb);
+  if (index != nullptr) {
+    *index = wb.index;
+  }
+}
+
+template <typename SegmentType>
+void CheckStats(uint64_t channel_id) {
+  ChannelStats stats;
+  EXPECT_FALSE(SegmentType::ReadStats(channel_id, &stats));
+  {
+    SegmentType writer(channel_id);
+    SegmentType reader(channel_id);
+    uint32_t index = 0;
+    WriteMessage(&writer, 100, nullptr);
+    WriteMessage(&writer, 300, &index);
+    WriteMessage(&writer, 200, nullptr);
+
+    ASSERT_TRUE(SegmentType::ReadStats(channel_id, &stats));
+    EXPECT_EQ(3, stats.messages);
+    EXPECT_EQ(600, stats.bytes);
+    EXPECT_EQ(300, stats.max_msg_size);
+    EXPECT_EQ(0, stats.overwritten);
+    EXPECT_EQ(1, stats.reference_counts);
+
+    ReadableBlock rb;
+    rb.index = index;
+    ASSERT_TRUE(reader.AcquireBlockToRead(&rb));
+    reader.ReleaseReadBlock(rb);
+    ASSERT_TRUE(SegmentType::ReadStats(channel_id, &stats));
+    EXPECT_EQ(1, stats.reader_lag);
+    EXPECT_EQ(2, stats.reference_counts);
+
+    // wrap around once, the two unread blocks get overwritten
+    const uint32_t block_num = ShmConf().block_num();
+    for (uint32_t i = 0; i < block_num; ++i) {
+      WriteMessage(&writer, 100, nullptr);
+    }
+    rb.index = index;
+    ASSERT_TRUE(reader.AcquireBlockToRead(&rb));
+    reader.ReleaseReadBlock(rb);
+    ASSERT_TRUE(SegmentType::ReadStats(channel_id, &stats));
+    EXPECT_EQ(3 + block_num, stats.messages);
+    EXPECT_EQ(2, stats.overwritten);
+    EXPECT_EQ(1, stats.reader_lag);
+  }
+  EXPECT_FALSE(SegmentType::ReadStats(channel_id, &stats));
+}
+
+TEST(SegmentTest, posix_stats) { CheckStats<PosixSegment>(0x5e600000 + getpid()); }
+
+TEST(SegmentTest, xsi_stats) { CheckStats<XsiSegment>(0x5e700000 + getpid()); }
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
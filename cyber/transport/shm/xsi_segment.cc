@@ -207,6 +207,23 @@ bool XsiSegment::OpenOnly() {
 	return true;
 }
 
+bool XsiSegment::ReadStats(uint64_t channel_id, ChannelStats* stats) {
+	RETURN_VAL_IF_NULL(stats, false);
+	int shmid = shmget(static_cast<key_t>(channel_id), 0, 0644);
+	if (shmid == -1) {
+		return false;
+	}
+
+	void* addr = shmat(shmid, nullptr, SHM_RDONLY);
+	if (addr == reinterpret_cast<void*>(-1)) {
+		return false;
+	}
+
+	reinterpret_cast<const State*>(addr)->GetStats(stats);
+	shmdt(addr);
+	return true;
+}
+
 bool XsiSegment::Remove() {
 	int shmid = shmget(key_, 0, 0644);
 	if (shmid == -1 || shmctl(shmid, IPC_RMID, 0) == -1) {
@@ -30,6 +30,9 @@ public:
 
 	static const char* Type() { return "xsi"; }
 
+	// reads the counters of an existing segment without attaching to it
+	static bool ReadStats(uint64_t channel_id, ChannelStats* stats);
+
 private:
 	void Reset() override;
 	bool Remove() override;
@@ -255,7 +255,8 @@ void HybridTransmitter<M>::TransmitHistoryMsg(const RoleAttributes& opposite_att
 	}
 
 	auto attr = opposite_attr;
-	cyber::Async(&HybridTransmitter<M>::ThreadFunc, this, attr, unsent_msgs);
+	// bulk replay, must not hold up latency critical tasks
+	cyber::AsyncWithPriority(TaskPriority::LOW, &HybridTransmitter<M>::ThreadFunc, this, attr, unsent_msgs);
 }
 
 template <typename M>
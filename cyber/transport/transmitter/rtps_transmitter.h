@@ -100,6 +100,15 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 
 	UnderlayMessage m;
 	RETURN_VAL_IF(!message::SerializeToString(msg, &m.data()), false);
+	// the otherwise unused timestamp and seq carry the deadline
+	m.timestamp(static_cast<int32_t>(msg_info.deadline() >> 32));
+	m.seq(static_cast<int32_t>(msg_info.deadline() & 0xFFFFFFFF));
+	uint64_t serialize_time = 0;
+	if (msg_info.send_time() != 0) {
+		serialize_time = LatencyTracer::Now();
+		LatencyTracer::Instance()->Record(this->attr_.channel_id(), LatencyHop::SERIALIZE, msg_info.send_time(),
+											serialize_time);
+	}
 
 	eprosima::fastrtps::rtps::WriteParams wparams;
 
@@ -116,7 +125,12 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 	if (participant_->is_shutdown()) {
 		return false;
 	}
-	return publisher_->write(reinterpret_cast<void*>(&m), wparams);
+	bool result = publisher_->write(reinterpret_cast<void*>(&m), wparams);
+	if (serialize_time != 0) {
+		LatencyTracer::Instance()->Record(this->attr_.channel_id(), LatencyHop::SEND, serialize_time,
+											LatencyTracer::Now());
+	}
+	return result;
 }
 
 }  // namespace transport
@@ -118,13 +118,24 @@ bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 	}
 	wb.block->set_msg_size(msg_size);
 
+	// a traced message also carries when it was serialized
+	const MessageInfo* info = &msg_info;
+	MessageInfo traced_info;
+	if (msg_info.send_time() != 0) {
+		traced_info = msg_info;
+		traced_info.set_serialize_time(LatencyTracer::Now());
+		LatencyTracer::Instance()->Record(channel_id_, LatencyHop::SERIALIZE, msg_info.send_time(),
+											traced_info.serialize_time());
+		info = &traced_info;
+	}
+
 	char* msg_info_addr = reinterpret_cast<char*>(wb.buf) + msg_size;
-	if (!msg_info.SerializeTo(msg_info_addr, MessageInfo::kSize)) {
+	if (!info->SerializeTo(msg_info_addr, info->SerializedSize())) {
 		AERROR << "serialize message info failed.";
 		segment_->ReleaseWrittenBlock(wb);
 		return false;
 	}
-	wb.block->set_msg_info_size(MessageInfo::kSize);
+	wb.block->set_msg_info_size(info->SerializedSize());
 	segment_->ReleaseWrittenBlock(wb);
 
 	ReadableInfo readable_info(host_id_, wb.index, channel_id_);
@@ -133,7 +144,12 @@ bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 		<< common::GlobalData::GetChannelById(channel_id_)
 		<< " to block: " << wb.index;
 	
-	return notifier_->Notify(readable_info);
+	bool result = notifier_->Notify(readable_info);
+	if (msg_info.send_time() != 0) {
+		LatencyTracer::Instance()->Record(channel_id_, LatencyHop::SEND, traced_info.serialize_time(),
+											LatencyTracer::Now());
+	}
+	return result;
 }
 
 }  // namespace transport
@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 
+#include "cyber/event/latency_tracer.h"
 #include "cyber/event/perf_event_cache.h"
 #include "cyber/transport/common/endpoint.h"
 #include "cyber/transport/message/message_info.h"
@@ -29,6 +30,8 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
+using apollo::cyber::event::LatencyHop;
+using apollo::cyber::event::LatencyTracer;
 using apollo::cyber::event::PerfEventCache;
 using apollo::cyber::event::TransPerf;
 
@@ -72,6 +75,9 @@ Transmitter<M>::~Transmitter() {}
 template <typename M>
 bool Transmitter<M>::Transmit(const MessagePtr& msg) {
 	msg_info_.set_seq_num(NextSeqNum());
+	if (LatencyTracer::Instance()->enabled()) {
+		msg_info_.set_send_time(LatencyTracer::Now());
+	}
 	PerfEventCache::Instance()->AddTransportEvent(TransPerf::TRANSMIT_BEGIN, attr_.channel_id(), msg_info_.seq_num());
 	return Transmit(msg, msg_info_);
 }